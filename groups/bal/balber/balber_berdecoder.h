@@ -26,13 +26,25 @@ BSLS_IDENT("$Id: $")
 // that contains a parameterized 'decode' function.  The 'decode' function
 // decodes data read from a specified stream and loads the corresponding object
 // to an object of the parameterized type.  The 'decode' method is overloaded
-// for two types of input streams:
+// for three types of input:
 //: o 'bsl::streambuf'
 //: o 'bsl::istream'
+//: o a contiguous buffer, supplied as a 'const char *' and a length
 //
 // This class decodes objects based on the X.690 BER specification and is
 // restricted to types supported by the 'bdlat' framework.
 //
+///Decoding From a Contiguous Buffer
+///---------------------------------
+// The decoder reads identifier, length, and contents octets through the
+// public 'bsl::streambuf' interface.  For a stream buffer whose get area holds
+// the encoded data (e.g., 'bdlsb::FixedMemInStreamBuf'), the single-octet
+// reads that dominate typical messages are inline, bounds-checked loads; for
+// a stream buffer without a get area, each octet costs a virtual call.  When
+// the entire message is already in memory, clients should therefore prefer
+// the overload taking a 'const char *' and a length, which guarantees the
+// inline path.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -157,6 +169,10 @@ BSLS_IDENT("$Id: $")
 #include <bdlb_variant.h>
 #endif
 
+#ifndef INCLUDED_BDLSB_FIXEDMEMINSTREAMBUF
+#include <bdlsb_fixedmeminstreambuf.h>
+#endif
+
 #ifndef INCLUDED_BDLSB_MEMOUTSTREAMBUF
 #include <bdlsb_memoutstreambuf.h>
 #endif
@@ -169,6 +185,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_objectbuffer.h>
 #endif
 
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
 #ifndef INCLUDED_BSL_ISTREAM
 #include <bsl_istream.h>
 #endif
@@ -314,6 +334,17 @@ class BerDecoder {
         // 'streamBuf' and load the result into the specified 'variable'.
         // Return 0 on success, and a non-zero value otherwise.
 
+    template <typename TYPE>
+    int decode(const char *buffer, bsl::size_t length, TYPE *variable);
+        // Decode an object of parameterized 'TYPE' from the specified
+        // contiguous 'buffer' of the specified 'length' and load the result
+        // into the specified 'variable'.  Return 0 on success, and a non-zero
+        // value otherwise.  The behavior is undefined unless 'buffer' refers
+        // to at least 'length' bytes.  Note that every octet is read from
+        // 'buffer' by an inline, bounds-checked access, so this is the
+        // preferred overload when the entire BER message is already in
+        // memory.
+
     template <typename TYPE>
     int decode(bsl::istream& stream, TYPE *variable);
         // Decode an object of parameterized 'TYPE' from the specified 'stream'
@@ -660,6 +691,23 @@ bsl::ostream& BerDecoder::logStream()
     return *d_logStream;
 }
 
+template <typename TYPE>
+inline
+int BerDecoder::decode(const char  *buffer,
+                       bsl::size_t  length,
+                       TYPE        *variable)
+{
+    BSLS_ASSERT(buffer || 0 == length);
+
+    // The get area of a 'bdlsb::FixedMemInStreamBuf' spans all of 'buffer',
+    // so the 'sbumpc' and 'sgetc' calls made by 'BerUtil' never reach a
+    // virtual function.
+
+    bdlsb::FixedMemInStreamBuf streamBuf(buffer, length);
+
+    return this->decode(&streamBuf, variable);
+}
+
 template <typename TYPE>
 inline
 int BerDecoder::decode(bsl::istream& stream, TYPE *variable)
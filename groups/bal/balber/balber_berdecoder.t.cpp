@@ -10058,7 +10058,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 18: {
+      case 19: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -10076,6 +10076,86 @@ int main(int argc, char *argv[])
 
         if (verbose) bsl::cout << "\nEnd of test." << bsl::endl;
       } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // TESTING 'decode' FROM A CONTIGUOUS BUFFER
+        //
+        // Concerns:
+        //: 1 Decoding from a buffer holding a complete encoding succeeds and
+        //:   yields the same value as decoding from a 'bsl::streambuf'.
+        //:
+        //: 2 Decoding from any proper prefix of an encoding fails (i.e.,
+        //:   every read is bounds-checked).
+        //:
+        //: 3 An empty buffer, including a null one, is handled.
+        //
+        // Plan:
+        //: 1 Encode a 'test::BigRecord' holding several 'test::BasicRecord'
+        //:   elements into a contiguous buffer.  Decode it from the buffer
+        //:   and compare to the original.  (C-1)
+        //:
+        //: 2 Decode from every proper prefix of the encoding, copied into a
+        //:   buffer of exactly that length, and verify failure.  (C-2..3)
+        //
+        // Testing:
+        //   int decode(const char *, bsl::size_t, TYPE *);
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nTESTING 'decode' FROM A CONTIGUOUS BUFFER"
+                               << "\n========================================="
+                               << bsl::endl;
+
+        test::BasicRecord basicRec;
+        basicRec.i1() = 11;
+        basicRec.i2() = 300;
+        basicRec.dt() = bdlt::DatetimeTz(
+                                    bdlt::Datetime(bdlt::Date(2007, 9, 3),
+                                                   bdlt::Time(16, 30)), 0);
+        basicRec.s()  = "The quick brown fox jumped over the lazy dog.";
+
+        test::BigRecord bigRec;
+        bigRec.name() = "This record is so big, it has its own gravity.";
+        for (int i = 0; i < 4; ++i) {
+            basicRec.i1() = -i * 1000;
+            bigRec.array().push_back(basicRec);
+        }
+
+        bsl::vector<char> buffer(4096);
+        bsl::size_t       length = 0;
+
+        ASSERT(0 == encoder.encode(&buffer[0],
+                                   buffer.size(),
+                                   &length,
+                                   bigRec));
+        ASSERT(0 <  length);
+
+        if (veryVerbose) { P(length) }
+
+        {
+            balber::BerDecoder mX;
+            test::BigRecord    value;
+
+            ASSERT(0      == mX.decode(&buffer[0], length, &value));
+            ASSERT(bigRec == value);
+
+            bdlsb::FixedMemInStreamBuf isb(&buffer[0], length);
+            test::BigRecord            streamValue;
+
+            ASSERT(0     == mX.decode(&isb, &streamValue));
+            ASSERT(value == streamValue);
+        }
+
+        for (bsl::size_t len = 0; len < length; ++len) {
+            bsl::vector<char> prefix(buffer.begin(), buffer.begin() + len);
+
+            balber::BerDecoder mX;
+            test::BigRecord    value;
+
+            const char *BUFFER = prefix.empty() ? 0 : &prefix[0];
+
+            LOOP_ASSERT(len, 0 != mX.decode(BUFFER, len, &value));
+        }
+      } break;
       case 17: {
         // --------------------------------------------------------------------
         // TESTING decoding for date/time components using a variant
@@ -14256,7 +14336,43 @@ int main(int argc, char *argv[])
                   << elapsed          << " seconds, "
                   << (reps / elapsed) << " reps/sec" << bsl::endl;
 
+        // Measure encoding into, and decoding from, a contiguous buffer:
+        bsl::vector<char> buffer(MAX_BUF_SIZE);
+        bsl::size_t       length = 0;
+
+        stopwatch.reset();
+        stopwatch.start();
+        for (int i = 0; i < reps; ++i) {
+            balber::BerEncoder encoder;  // Typical usage: single-use object
+            encoder.encode(&buffer[0], buffer.size(), &length, request);
+        }
+        stopwatch.stop();
+
+        ASSERT(osb.length() == length);
+        elapsed = stopwatch.elapsedTime();
+        ASSERT(elapsed > 0);
+
+        bsl::cout << "    balber::BerEncoder (buffer): "
+                  << elapsed          << " seconds, "
+                  << (reps / elapsed) << " reps/sec" << bsl::endl;
+
+        inRequests = new test::TimingRequest[reps];
+        stopwatch.reset();
+        stopwatch.start();
+        for (int i = 0; i < reps; ++i) {
+            balber::BerDecoder decoder;  // Typical usage: single-use object
+            decoder.decode(&buffer[0], length, &inRequests[i]);
+        }
+        stopwatch.stop();
+
+        ASSERT(*inRequests == request);
+        elapsed = stopwatch.elapsedTime();
+        ASSERT(elapsed > 0);
         delete[] inRequests;
+
+        bsl::cout << "    balber::BerDecoder (buffer): "
+                  << elapsed          << " seconds, "
+                  << (reps / elapsed) << " reps/sec" << bsl::endl;
       } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
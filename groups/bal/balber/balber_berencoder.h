@@ -26,13 +26,23 @@ BSLS_IDENT("$Id: $")
 // that contains a parameterized 'encode' function.  The 'encode' function
 // encodes data read from a specified stream and loads the corresponding object
 // to an object of the parameterized type.  The 'encode' method is overloaded
-// for two types of input streams:
+// for three types of output:
 //: o 'bsl::streambuf'
-//: o 'bsl::istream'
+//: o 'bsl::ostream'
+//: o a pre-sized contiguous buffer, supplied as a 'char *' and a length
 //
 // This component encodes objects based on the X.690 BER specification.  It can
 // only be used with types supported by the 'bdlat' framework.
 //
+///Encoding To a Contiguous Buffer
+///-------------------------------
+// The encoder writes octets through the public 'bsl::streambuf' interface,
+// which is an inline, bounds-checked store only while the stream buffer has
+// room in its put area.  When an upper bound on the size of the encoding is
+// known, clients should prefer the overload taking a 'char *' and a length:
+// it writes directly into the supplied buffer, never allocates, and fails
+// (rather than growing the buffer) if the encoding does not fit.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -232,6 +242,10 @@ BSLS_IDENT("$Id: $")
 #include <bsl_string.h>
 #endif
 
+#ifndef INCLUDED_BDLSB_FIXEDMEMOUTSTREAMBUF
+#include <bdlsb_fixedmemoutstreambuf.h>
+#endif
+
 #ifndef INCLUDED_BDLSB_MEMOUTSTREAMBUF
 #include <bdlsb_memoutstreambuf.h>
 #endif
@@ -240,6 +254,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_objectbuffer.h>
 #endif
 
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
 #ifndef INCLUDED_BSL_OSTREAM
 #include <bsl_ostream.h>
 #endif
@@ -456,6 +474,23 @@ class BerEncoder {
         // Encode the specified non-modifiable 'value' to the specified
         // 'streamBuf'.  Return 0 on success, and a non-zero value otherwise.
 
+    template <typename TYPE>
+    int encode(char        *buffer,
+               bsl::size_t  bufferLength,
+               bsl::size_t *numBytesWritten,
+               const TYPE&  value);
+        // Encode the specified non-modifiable 'value' into the specified
+        // contiguous 'buffer' of the specified 'bufferLength' and load the
+        // number of bytes written into the specified 'numBytesWritten'.
+        // Return 0 on success, and a non-zero value otherwise (in particular,
+        // if the encoding of 'value' does not fit in 'bufferLength' bytes).
+        // The contents of 'buffer' and 'numBytesWritten' are unspecified if
+        // a non-zero value is returned.  The behavior is undefined unless
+        // 'buffer' refers to at least 'bufferLength' writable bytes.  Note
+        // that every octet is written to 'buffer' by an inline,
+        // bounds-checked store, so this is the preferred overload when the
+        // caller can pre-size the output buffer.
+
     template <typename TYPE>
     int encode(bsl::ostream& stream, const TYPE& value);
         // Encode the specified non-modifiable 'value' to the specified
@@ -759,6 +794,28 @@ int BerEncoder::encode(bsl::streambuf *streamBuf, const TYPE& value)
     return rc;
 }
 
+template <typename TYPE>
+int BerEncoder::encode(char        *buffer,
+                       bsl::size_t  bufferLength,
+                       bsl::size_t *numBytesWritten,
+                       const TYPE&  value)
+{
+    BSLS_ASSERT(buffer || 0 == bufferLength);
+    BSLS_ASSERT(numBytesWritten);
+
+    // The put area of a 'bdlsb::FixedMemOutStreamBuf' spans all of 'buffer',
+    // so the 'sputc' calls made by 'BerUtil' reach a virtual function only
+    // once the buffer is full, at which point the encoding fails.
+
+    bdlsb::FixedMemOutStreamBuf streamBuf(buffer, bufferLength);
+
+    const int rc = this->encode(&streamBuf, value);
+
+    *numBytesWritten = streamBuf.length();
+
+    return rc;
+}
+
 template <typename TYPE>
 int BerEncoder::encode(bsl::ostream& stream, const TYPE& value)
 {
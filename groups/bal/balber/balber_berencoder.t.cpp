@@ -9349,7 +9349,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -9373,6 +9373,87 @@ int main(int argc, char *argv[])
         usageExample();
 
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING 'encode' TO A CONTIGUOUS BUFFER
+        //
+        // Concerns:
+        //: 1 Encoding into a buffer that is large enough succeeds, produces
+        //:   exactly the octets produced by encoding to a 'bsl::streambuf',
+        //:   and loads the number of those octets into 'numBytesWritten'.
+        //:
+        //: 2 Encoding into a buffer that is too small, by any amount, fails
+        //:   and never writes past the end of the buffer.
+        //
+        // Plan:
+        //: 1 Encode a 'test::BigRecord' holding several 'test::BasicRecord'
+        //:   elements to a 'bdlsb::MemOutStreamBuf'.  Then, for every buffer
+        //:   length from 0 to 2 more than the length of that encoding, encode
+        //:   the same object into a buffer of that length followed by a
+        //:   guard area, and verify the result.  (C-1..2)
+        //
+        // Testing:
+        //   int encode(char *, bsl::size_t, bsl::size_t *, const TYPE&);
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nTESTING 'encode' TO A CONTIGUOUS BUFFER"
+                               << "\n======================================="
+                               << bsl::endl;
+
+        test::BasicRecord basicRec;
+        basicRec.i1() = 11;
+        basicRec.i2() = 300;
+        basicRec.dt() = bdlt::DatetimeTz(
+                                    bdlt::Datetime(bdlt::Date(2007, 9, 3),
+                                                   bdlt::Time(16, 30)), 0);
+        basicRec.s()  = "The quick brown fox jumped over the lazy dog.";
+
+        test::BigRecord bigRec;
+        bigRec.name() = "This record is so big, it has its own gravity.";
+        for (int i = 0; i < 4; ++i) {
+            basicRec.i1() = i * 1000;
+            bigRec.array().push_back(basicRec);
+        }
+
+        bdlsb::MemOutStreamBuf osb;
+        ASSERT(0 == encoder.encode(&osb, bigRec));
+
+        const int EXP_LEN = static_cast<int>(osb.length());
+
+        if (veryVerbose) { P(EXP_LEN) }
+
+        enum { k_GUARD_LENGTH = 8, k_GUARD_CHAR = 0x5A };
+
+        bsl::vector<char> buffer;
+
+        for (int len = 0; len <= EXP_LEN + 2; ++len) {
+            buffer.assign(len + k_GUARD_LENGTH, k_GUARD_CHAR);
+
+            balber::BerEncoder mX;
+            bsl::size_t        numBytesWritten = 0;
+
+            const int rc = mX.encode(&buffer[0],
+                                     len,
+                                     &numBytesWritten,
+                                     bigRec);
+
+            if (len < EXP_LEN) {
+                LOOP_ASSERT(len, 0 != rc);
+            }
+            else {
+                LOOP_ASSERT(len, 0 == rc);
+                LOOP2_ASSERT(len, numBytesWritten,
+                             EXP_LEN == static_cast<int>(numBytesWritten));
+                LOOP_ASSERT(len, 0 == bsl::memcmp(&buffer[0],
+                                                  osb.data(),
+                                                  EXP_LEN));
+            }
+
+            for (int j = len; j < len + k_GUARD_LENGTH; ++j) {
+                LOOP2_ASSERT(len, j, k_GUARD_CHAR == buffer[j]);
+            }
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING 'encode' for date/time components
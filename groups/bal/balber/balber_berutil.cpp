@@ -154,8 +154,6 @@ const bsls::Types::Uint64 DOUBLE_SIGN_MASK     = 0x8000000000000000ULL;
 enum {
     // These constants are used by the implementation of this component.
 
-    TAG_CLASS_MASK  = 0xC0,   // mask for tag class  from first octet
-    TAG_TYPE_MASK   = 0x20,   // mask for tag type   from first octet
     TAG_NUMBER_MASK = 0x1f,   // mask for tag number from first octet
 
     MAX_TAG_NUMBER_IN_ONE_OCTET        =    30,  // the maximum tag number if
@@ -168,9 +166,6 @@ enum {
     LONG_FORM_LENGTH_FLAG_MASK         =  0x80,  // mask that indicates a
                                                  // "long-form" length
 
-    LONG_FORM_LENGTH_VALUE_MASK        =  0x7f,  // mask for value from
-                                                 // "long-form" length
-
     NUM_BITS_IN_ONE_TAG_OCTET          =     7,
 
     MAX_TAG_NUMBER_OCTETS              =
@@ -428,142 +423,6 @@ bsls::Types::Int64 getSerialDatetimeValue(const bdlt::Datetime& value)
 }  // close unnamed namespace
 
 namespace balber {
-                               // --------------
-                               // struct BerUtil
-                               // --------------
-
-int BerUtil::getIdentifierOctets(
-                            bsl::streambuf         *streamBuf,
-                            BerConstants::TagClass *tagClass,
-                            BerConstants::TagType  *tagType,
-                            int                    *tagNumber,
-                            int                    *accumNumBytesConsumed)
-{
-    enum { SUCCESS = 0, FAILURE = -1 };
-
-    int nextOctet = streamBuf->sbumpc();
-
-    if (bsl::streambuf::traits_type::eof() == nextOctet) {
-        return FAILURE;                                               // RETURN
-    }
-
-    ++*accumNumBytesConsumed;
-
-    *tagClass = static_cast<BerConstants::TagClass>
-                                                  (nextOctet & TAG_CLASS_MASK);
-
-    *tagType = static_cast<BerConstants::TagType>
-                                                   (nextOctet & TAG_TYPE_MASK);
-
-    if (TAG_NUMBER_MASK != (nextOctet & TAG_NUMBER_MASK)) {
-        // The tag number fits in a single octet.
-
-        *tagNumber = nextOctet & TAG_NUMBER_MASK;
-        return SUCCESS;                                               // RETURN
-    }
-
-    *tagNumber = 0;
-
-    for (int i = 0; i < MAX_TAG_NUMBER_OCTETS; ++i) {
-        nextOctet = streamBuf->sbumpc();
-        if (bsl::streambuf::traits_type::eof() == nextOctet) {
-            return FAILURE;                                           // RETURN
-        }
-
-        ++*accumNumBytesConsumed;
-
-        *tagNumber <<= NUM_VALUE_BITS_IN_TAG_OCTET;
-        *tagNumber  |= nextOctet & SEVEN_BITS_MASK;
-
-        if (!(nextOctet & CHAR_MSB_MASK)) {
-            return SUCCESS;                                           // RETURN
-        }
-    }
-
-    return FAILURE;
-}
-
-int BerUtil::putIdentifierOctets(bsl::streambuf              *streamBuf,
-                                      BerConstants::TagClass  tagClass,
-                                      BerConstants::TagType   tagType,
-                                      int                     tagNumber)
-    // Write the specified 'tag*' to the specified 'streamBuf'.
-{
-    enum { SUCCESS = 0, FAILURE = -1 };
-
-    if (tagNumber < 0) {
-        return FAILURE;                                               // RETURN
-    }
-
-    if (tagNumber <= MAX_TAG_NUMBER_IN_ONE_OCTET) {
-        unsigned char octet = static_cast<unsigned char>(tagClass
-                                                         | tagType
-                                                         | tagNumber);
-
-        return octet == streamBuf->sputc(octet) ? SUCCESS
-                                                : FAILURE;            // RETURN
-    }
-
-    // Send multiple identifier octets.
-
-    unsigned char firstOctet = static_cast<unsigned char>(tagClass
-                                                          | tagType
-                                                          | TAG_NUMBER_MASK);
-
-    if (firstOctet != streamBuf->sputc(firstOctet)) {
-        return FAILURE;                                               // RETURN
-    }
-
-    // Find the number of octets required.
-
-    int numOctetsRequired = 0;
-
-    {
-        enum {
-            INT_NUM_BITS = sizeof(int) * BerUtil_Imp::e_BITS_PER_OCTET
-        };
-
-        int          shift = 0;
-        unsigned int mask  = SEVEN_BITS_MASK;
-
-        for (int i = 0; INT_NUM_BITS > shift; ++i) {
-            if (tagNumber & mask) {
-                numOctetsRequired = i + 1;
-            }
-
-            shift += NUM_VALUE_BITS_IN_TAG_OCTET;
-            mask <<= NUM_VALUE_BITS_IN_TAG_OCTET;
-        }
-    }
-
-    BSLS_ASSERT(numOctetsRequired <= MAX_TAG_NUMBER_OCTETS);
-
-    // Put all octets except the last one.
-
-    int          shift = (numOctetsRequired - 1) * NUM_VALUE_BITS_IN_TAG_OCTET;
-    unsigned int mask  = SEVEN_BITS_MASK << shift;
-
-    for (int i = 0; i < numOctetsRequired - 1; ++i) {
-        unsigned char nextOctet = static_cast<unsigned char>(
-                                  (mask & tagNumber) >> shift | CHAR_MSB_MASK);
-
-        if (nextOctet != streamBuf->sputc(nextOctet)) {
-            return FAILURE;                                           // RETURN
-        }
-
-        shift -= NUM_VALUE_BITS_IN_TAG_OCTET;
-        mask   = SEVEN_BITS_MASK << shift;
-    }
-
-    // Put the final octet.
-
-    tagNumber &= SEVEN_BITS_MASK;
-
-    return tagNumber == streamBuf->sputc(static_cast<char>(tagNumber))
-           ? SUCCESS
-           : FAILURE;
-}
-
                              // ------------------
                              // struct BerUtil_Imp
                              // ------------------
@@ -1041,56 +900,58 @@ int BerUtil_Imp::getIntegerValue(bsl::streambuf *streamBuf,
     return SUCCESS;
 }
 
-int BerUtil_Imp::getLength(bsl::streambuf *streamBuf,
-                           int            *result,
-                           int            *accumNumBytesConsumed)
+int BerUtil_Imp::getLongFormLength(bsl::streambuf *streamBuf,
+                                   int            *result,
+                                   int             numOctets,
+                                   int            *accumNumBytesConsumed)
 {
     enum { SUCCESS = 0, FAILURE = -1 };
 
-    int nextOctet = streamBuf->sbumpc();
-    if (bsl::streambuf::traits_type::eof() == nextOctet) {
+    if (numOctets > static_cast<int>(sizeof(int))) {
         return FAILURE;                                               // RETURN
     }
 
-    ++*accumNumBytesConsumed;
-
-    if (nextOctet == BerUtil_Imp::e_INDEFINITE_LENGTH_OCTET) {
-        *result = BerUtil_Imp::e_INDEFINITE_LENGTH;
+    *result = 0;
+    for (int i = 0; i < numOctets; ++i) {
+        const int nextOctet = streamBuf->sbumpc();
+        if (bsl::streambuf::traits_type::eof() == nextOctet) {
+            return FAILURE;                                           // RETURN
+        }
 
-        return SUCCESS;                                               // RETURN
+        *result <<= BerUtil_Imp::e_BITS_PER_OCTET;
+        *result |=  nextOctet;
     }
 
-    unsigned int numOctets = (unsigned int) nextOctet;
-
-    // Length has been transmitted in short form.
-
-    if (!(numOctets & LONG_FORM_LENGTH_FLAG_MASK)) {
-        *result = numOctets;
-        return SUCCESS;                                               // RETURN
-    }
+    *accumNumBytesConsumed += numOctets;
 
-    // Length has been transmitted in long form.
+    return SUCCESS;
+}
 
-    numOctets &= LONG_FORM_LENGTH_VALUE_MASK;
+int BerUtil_Imp::getLongFormTagNumber(bsl::streambuf *streamBuf,
+                                      int            *tagNumber,
+                                      int            *accumNumBytesConsumed)
+{
+    enum { SUCCESS = 0, FAILURE = -1 };
 
-    if (numOctets > sizeof(int)) {
-        return FAILURE;                                               // RETURN
-    }
+    *tagNumber = 0;
 
-    *result = 0;
-    for (unsigned int i = 0; i < numOctets; ++i) {
-        nextOctet = streamBuf->sbumpc();
+    for (int i = 0; i < MAX_TAG_NUMBER_OCTETS; ++i) {
+        const int nextOctet = streamBuf->sbumpc();
         if (bsl::streambuf::traits_type::eof() == nextOctet) {
             return FAILURE;                                           // RETURN
         }
 
-        *result <<= BerUtil_Imp::e_BITS_PER_OCTET;
-        *result |=  nextOctet;
-    }
+        ++*accumNumBytesConsumed;
 
-    *accumNumBytesConsumed += numOctets;
+        *tagNumber <<= NUM_VALUE_BITS_IN_TAG_OCTET;
+        *tagNumber  |= nextOctet & SEVEN_BITS_MASK;
 
-    return SUCCESS;
+        if (!(nextOctet & CHAR_MSB_MASK)) {
+            return SUCCESS;                                           // RETURN
+        }
+    }
+
+    return FAILURE;
 }
 
 int BerUtil_Imp::getValue(bsl::streambuf *streamBuf,
@@ -1407,22 +1268,79 @@ int BerUtil_Imp::putDoubleValue(bsl::streambuf *stream, double value)
          ? FAILURE : SUCCESS;
 }
 
-int BerUtil_Imp::putLength(bsl::streambuf *streamBuf, int length)
+int BerUtil_Imp::putLongFormIdentifierOctets(
+                                      bsl::streambuf         *streamBuf,
+                                      BerConstants::TagClass  tagClass,
+                                      BerConstants::TagType   tagType,
+                                      int                     tagNumber)
 {
     enum { SUCCESS = 0, FAILURE = -1 };
 
-    if (length < 0) {
+    BSLS_ASSERT(MAX_TAG_NUMBER_IN_ONE_OCTET < tagNumber);
+
+    unsigned char firstOctet = static_cast<unsigned char>(tagClass
+                                                          | tagType
+                                                          | TAG_NUMBER_MASK);
+
+    if (firstOctet != streamBuf->sputc(firstOctet)) {
         return FAILURE;                                               // RETURN
     }
 
-    if (length <= 127) {
-        const char lengthChar = static_cast<char>(length);
-        return length == streamBuf->sputc(lengthChar)
-             ? SUCCESS
-             : FAILURE;                                               // RETURN
+    // Find the number of octets required.
+
+    int numOctetsRequired = 0;
+
+    {
+        enum {
+            INT_NUM_BITS = sizeof(int) * BerUtil_Imp::e_BITS_PER_OCTET
+        };
+
+        int          shift = 0;
+        unsigned int mask  = SEVEN_BITS_MASK;
+
+        for (int i = 0; INT_NUM_BITS > shift; ++i) {
+            if (tagNumber & mask) {
+                numOctetsRequired = i + 1;
+            }
+
+            shift += NUM_VALUE_BITS_IN_TAG_OCTET;
+            mask <<= NUM_VALUE_BITS_IN_TAG_OCTET;
+        }
+    }
+
+    BSLS_ASSERT(numOctetsRequired <= MAX_TAG_NUMBER_OCTETS);
+
+    // Put all octets except the last one.
+
+    int          shift = (numOctetsRequired - 1) * NUM_VALUE_BITS_IN_TAG_OCTET;
+    unsigned int mask  = SEVEN_BITS_MASK << shift;
+
+    for (int i = 0; i < numOctetsRequired - 1; ++i) {
+        unsigned char nextOctet = static_cast<unsigned char>(
+                                  (mask & tagNumber) >> shift | CHAR_MSB_MASK);
+
+        if (nextOctet != streamBuf->sputc(nextOctet)) {
+            return FAILURE;                                           // RETURN
+        }
+
+        shift -= NUM_VALUE_BITS_IN_TAG_OCTET;
+        mask   = SEVEN_BITS_MASK << shift;
     }
 
-    // length > 127.
+    // Put the final octet.
+
+    tagNumber &= SEVEN_BITS_MASK;
+
+    return tagNumber == streamBuf->sputc(static_cast<char>(tagNumber))
+           ? SUCCESS
+           : FAILURE;
+}
+
+int BerUtil_Imp::putLongFormLength(bsl::streambuf *streamBuf, int length)
+{
+    enum { SUCCESS = 0, FAILURE = -1 };
+
+    BSLS_ASSERT(e_MAX_SHORT_FORM_LENGTH < length);
 
     int numOctets = sizeof(int);
     for (unsigned int mask = ~((unsigned int) -1 >> e_BITS_PER_OCTET);
@@ -28,6 +28,12 @@ BSLS_IDENT("$Id: $")
 // and BDE date/time types is also implemented.
 //
 // These utility functions operate on 'bsl::streambuf' for buffer management.
+// The single-octet forms of identifier and length octets, which are by far the
+// most common, are encoded and decoded by inline functions that use only the
+// non-virtual 'sbumpc' and 'sputc' members of 'bsl::streambuf'.  Hence, for a
+// stream buffer whose get (or put) area spans the data (e.g.,
+// 'bdlsb::FixedMemInStreamBuf' or 'bdlsb::FixedMemOutStreamBuf'), these
+// octets are read and written without any virtual function calls.
 //
 // More information about BER constructs can be found in the BER specification
 // (X.690).  A copy of the specification can be found at the URL:
@@ -340,6 +346,22 @@ struct BerUtil_Imp {
       , e_INDEFINITE_LENGTH_OCTET = 0x80  // value that indicates an indefinite
                                           // length
 
+      , e_TAG_CLASS_MASK          = 0xC0  // mask for tag class  from first
+                                          // identifier octet
+
+      , e_TAG_TYPE_MASK           = 0x20  // mask for tag type   from first
+                                          // identifier octet
+
+      , e_TAG_NUMBER_MASK         = 0x1F  // mask for tag number from first
+                                          // identifier octet
+
+      , e_MAX_TAG_NUMBER_IN_ONE_OCTET = 30
+                                          // largest tag number that fits in
+                                          // the first identifier octet
+
+      , e_MAX_SHORT_FORM_LENGTH   = 127   // largest length that is encoded
+                                          // in a single length octet
+
     };
 
     // CLASS METHODS
@@ -358,6 +380,32 @@ struct BerUtil_Imp {
     static int getLength(bsl::streambuf *streamBuf,
                          int            *result,
                          int            *accumNumBytesConsumed);
+        // Decode the length octets from the specified 'streamBuf' as
+        // described by 'BerUtil::getLength'.  Note that the common,
+        // single-octet (short form) case is handled inline, so that decoding
+        // from a 'streamBuf' whose get area holds the encoded data (e.g., a
+        // 'bdlsb::FixedMemInStreamBuf') involves no out-of-line or virtual
+        // function calls.
+
+    static int getLongFormLength(bsl::streambuf *streamBuf,
+                                 int            *result,
+                                 int             numOctets,
+                                 int            *accumNumBytesConsumed);
+        // Decode the specified 'numOctets' subsequent length octets of a long
+        // form length from the specified 'streamBuf', load the result into
+        // the specified 'result', and add 'numOctets' to the specified
+        // 'accumNumBytesConsumed'.  Return 0 on success, and a non-zero value
+        // otherwise.
+
+    static int getLongFormTagNumber(bsl::streambuf *streamBuf,
+                                    int            *tagNumber,
+                                    int            *accumNumBytesConsumed);
+        // Decode the subsequent identifier octets of a tag number that does
+        // not fit in the first identifier octet from the specified
+        // 'streamBuf', load the result into the specified 'tagNumber', and
+        // add the number of bytes consumed to the specified
+        // 'accumNumBytesConsumed'.  Return 0 on success, and a non-zero value
+        // otherwise.
 
     template <typename TYPE>
     static int getValue(bsl::streambuf               *streamBuf,
@@ -473,6 +521,26 @@ struct BerUtil_Imp {
     static int putIntegerValue(bsl::streambuf *streamBuf, TYPE value);
 
     static int putLength(bsl::streambuf *streamBuf, int length);
+        // Encode the specified 'length' to the specified 'streamBuf' as
+        // described by 'BerUtil::putLength'.  Note that the common,
+        // single-octet (short form) case is handled inline.
+
+    static int putLongFormIdentifierOctets(
+                                      bsl::streambuf         *streamBuf,
+                                      BerConstants::TagClass  tagClass,
+                                      BerConstants::TagType   tagType,
+                                      int                     tagNumber);
+        // Encode the identifier octets for the specified 'tagClass',
+        // 'tagType', and 'tagNumber' to the specified 'streamBuf' using the
+        // multi-octet form.  Return 0 on success, and a non-zero value
+        // otherwise.  The behavior is undefined unless
+        // 'e_MAX_TAG_NUMBER_IN_ONE_OCTET < tagNumber'.
+
+    static int putLongFormLength(bsl::streambuf *streamBuf, int length);
+        // Encode the specified 'length' to the specified 'streamBuf' using
+        // the long form.  Return 0 on success, and a non-zero value
+        // otherwise.  The behavior is undefined unless
+        // 'e_MAX_SHORT_FORM_LENGTH < length'.
 
     static int putStringValue(bsl::streambuf *streamBuf,
                               const char     *value,
@@ -636,6 +704,41 @@ int BerUtil::getEndOfContentOctets(bsl::streambuf *streamBuf,
          : k__FAILURE;
 }
 
+inline
+int BerUtil::getIdentifierOctets(
+                                bsl::streambuf         *streamBuf,
+                                BerConstants::TagClass *tagClass,
+                                BerConstants::TagType  *tagType,
+                                int                    *tagNumber,
+                                int                    *accumNumBytesConsumed)
+{
+    enum { k_SUCCESS = 0, k_FAILURE = -1 };
+
+    const int nextOctet = streamBuf->sbumpc();
+    if (bsl::streambuf::traits_type::eof() == nextOctet) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    ++*accumNumBytesConsumed;
+
+    *tagClass = static_cast<BerConstants::TagClass>(
+                                   nextOctet & BerUtil_Imp::e_TAG_CLASS_MASK);
+    *tagType  = static_cast<BerConstants::TagType>(
+                                    nextOctet & BerUtil_Imp::e_TAG_TYPE_MASK);
+
+    const int firstTagNumber = nextOctet & BerUtil_Imp::e_TAG_NUMBER_MASK;
+    if (BerUtil_Imp::e_TAG_NUMBER_MASK != firstTagNumber) {
+        // The tag number fits in a single octet.
+
+        *tagNumber = firstTagNumber;
+        return k_SUCCESS;                                             // RETURN
+    }
+
+    return BerUtil_Imp::getLongFormTagNumber(streamBuf,
+                                             tagNumber,
+                                             accumNumBytesConsumed);
+}
+
 inline
 int BerUtil::getLength(bsl::streambuf *streamBuf,
                             int       *result,
@@ -687,6 +790,33 @@ int BerUtil::putEndOfContentOctets(bsl::streambuf *streamBuf)
          : k_FAILURE;
 }
 
+inline
+int BerUtil::putIdentifierOctets(bsl::streambuf         *streamBuf,
+                                 BerConstants::TagClass  tagClass,
+                                 BerConstants::TagType   tagType,
+                                 int                     tagNumber)
+{
+    enum { k_SUCCESS = 0, k_FAILURE = -1 };
+
+    if (tagNumber < 0) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    if (tagNumber <= BerUtil_Imp::e_MAX_TAG_NUMBER_IN_ONE_OCTET) {
+        const unsigned char octet = static_cast<unsigned char>(tagClass
+                                                               | tagType
+                                                               | tagNumber);
+
+        return octet == streamBuf->sputc(octet) ? k_SUCCESS
+                                                : k_FAILURE;          // RETURN
+    }
+
+    return BerUtil_Imp::putLongFormIdentifierOctets(streamBuf,
+                                                    tagClass,
+                                                    tagType,
+                                                    tagNumber);
+}
+
 inline
 int BerUtil::putIndefiniteLengthOctet(bsl::streambuf *streamBuf)
 {
@@ -768,6 +898,41 @@ int BerUtil_Imp::getIntegerValue(bsl::streambuf *streamBuf,
     return k_SUCCESS;
 }
 
+inline
+int BerUtil_Imp::getLength(bsl::streambuf *streamBuf,
+                           int            *result,
+                           int            *accumNumBytesConsumed)
+{
+    enum { k_SUCCESS = 0, k_FAILURE = -1 };
+
+    const int nextOctet = streamBuf->sbumpc();
+    if (bsl::streambuf::traits_type::eof() == nextOctet) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    ++*accumNumBytesConsumed;
+
+    if (nextOctet <= e_MAX_SHORT_FORM_LENGTH) {
+        // Length has been transmitted in short form.
+
+        *result = nextOctet;
+        return k_SUCCESS;                                             // RETURN
+    }
+
+    if (e_INDEFINITE_LENGTH_OCTET == nextOctet) {
+        *result = e_INDEFINITE_LENGTH;
+        return k_SUCCESS;                                             // RETURN
+    }
+
+    // Length has been transmitted in long form; the low seven bits of the
+    // first octet hold the number of subsequent length octets.
+
+    return getLongFormLength(streamBuf,
+                             result,
+                             nextOctet & e_MAX_SHORT_FORM_LENGTH,
+                             accumNumBytesConsumed);
+}
+
 template <typename TYPE>
 inline
 int BerUtil_Imp::getValue(bsl::streambuf *streamBuf,
@@ -1024,6 +1189,24 @@ int BerUtil_Imp::putIntegerValue(bsl::streambuf *streamBuf,
     return putIntegerGivenLength(streamBuf, value, length);
 }
 
+inline
+int BerUtil_Imp::putLength(bsl::streambuf *streamBuf, int length)
+{
+    enum { k_SUCCESS = 0, k_FAILURE = -1 };
+
+    if (length < 0) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    if (length <= e_MAX_SHORT_FORM_LENGTH) {
+        return length == streamBuf->sputc(static_cast<char>(length))
+             ? k_SUCCESS
+             : k_FAILURE;                                             // RETURN
+    }
+
+    return putLongFormLength(streamBuf, length);
+}
+
 inline
 int BerUtil_Imp::putStringValue(bsl::streambuf  *streamBuf,
                                 const char      *value,
@@ -4276,7 +4276,41 @@ int main(int argc, char *argv[])
                 LOOP3_ASSERT(LINE, NUMBER, theNumber, NUMBER == theNumber);
                 LOOP3_ASSERT(LINE, EXP_LEN,   numBytesConsumed,
                                    EXP_LEN == numBytesConsumed);
+
+                // Every proper prefix of the encoding fails to decode, and a
+                // fixed-size buffer that is too small fails to encode.
+
+                for (int len = 0; len < EXP_LEN; ++len) {
+                    bdlsb::FixedMemInStreamBuf shortIsb(osb.data(), len);
+                    int                        numConsumed = 0;
+
+                    LOOP2_ASSERT(LINE, len,
+                                 SUCCESS != Util::getIdentifierOctets(
+                                                              &shortIsb,
+                                                              &theClass,
+                                                              &theType,
+                                                              &theNumber,
+                                                              &numConsumed));
+
+                    char                        buffer[8];
+                    bdlsb::FixedMemOutStreamBuf shortOsb(buffer, len);
+
+                    LOOP2_ASSERT(LINE, len,
+                                 SUCCESS != Util::putIdentifierOctets(
+                                                                     &shortOsb,
+                                                                     CLASS,
+                                                                     TYPE,
+                                                                     NUMBER));
+                }
             }
+
+            bdlsb::MemOutStreamBuf osb;
+            ASSERT(SUCCESS != Util::putIdentifierOctets(
+                                         &osb,
+                                         balber::BerConstants::e_UNIVERSAL,
+                                         balber::BerConstants::e_PRIMITIVE,
+                                         -1));
+            ASSERT(0       == osb.length());
         }
       } break;
       case 16: {
@@ -4893,6 +4927,48 @@ int main(int argc, char *argv[])
                 LOOP3_ASSERT(LINE, LEN, len, len == LEN);
                 LOOP3_ASSERT(LINE, EXP_LEN, numBytesConsumed,
                              EXP_LEN == numBytesConsumed);
+
+                // Every proper prefix of the encoding fails to decode, and a
+                // fixed-size buffer that is too small fails to encode.
+
+                for (int j = 0; j < EXP_LEN; ++j) {
+                    bdlsb::FixedMemInStreamBuf shortIsb(osb.data(), j);
+                    int                        numConsumed = 0;
+
+                    LOOP2_ASSERT(LINE, j, SUCCESS != Util::getLength(
+                                                                &shortIsb,
+                                                                &len,
+                                                                &numConsumed));
+
+                    char                        buffer[8];
+                    bdlsb::FixedMemOutStreamBuf shortOsb(buffer, j);
+
+                    LOOP2_ASSERT(LINE, j,
+                                 SUCCESS != Util::putLength(&shortOsb, LEN));
+                }
+            }
+
+            if (verbose) bsl::cout << "\nIndefinite and invalid lengths."
+                                   << bsl::endl;
+            {
+                int len              = 0;
+                int numBytesConsumed = 0;
+
+                bdlsb::FixedMemInStreamBuf isb("\x80", 1);
+                ASSERT(SUCCESS == Util::getLength(&isb, &len,
+                                                  &numBytesConsumed));
+                ASSERT(Util::e_INDEFINITE_LENGTH == len);
+                ASSERT(1       == numBytesConsumed);
+
+                // More than 'sizeof(int)' subsequent length octets.
+
+                bdlsb::FixedMemInStreamBuf tooLongIsb("\x85\0\0\0\0\x01", 6);
+                ASSERT(SUCCESS != Util::getLength(&tooLongIsb, &len,
+                                                  &numBytesConsumed));
+
+                bdlsb::MemOutStreamBuf osb;
+                ASSERT(SUCCESS != Util::putLength(&osb, -1));
+                ASSERT(0       == osb.length());
             }
         }
       } break;
@@ -33,9 +33,9 @@ BSLS_IDENT("$Id: $")
 //  datetimeFractionalSecondPrecision
 //                      int            3               >= 0 and <= 6
 //  maxFloatPrecision   int            bsl::numeric_limits<float>::digits10
-//                                                     >= 1 and <= 9
+//                                                     >= 0 and <= 9
 //  maxDoublePrecision  int            bsl::numeric_limits<double>::digits10
-//                                                     >= 1 and <= 17
+//                                                     >= 0 and <= 17
 //..
 //: o 'encodingStyle': encoding style used to encode the JSON data.
 //:
@@ -66,10 +66,14 @@ BSLS_IDENT("$Id: $")
 //:                                        'DatetimeTz'.
 //:
 //: o 'maxFloatPrecision': option specifying the maximum number of decimal
-//:                        places used to encode each 'float' value.
+//:                        places used to encode each 'float' value.  If
+//:                        set to 0, each value is encoded using the fewest
+//:                        digits that decode to exactly that value.
 //:
 //: o 'maxDoublePrecision': option specifying the maximum number of decimal
-//:                         places used to encode each 'double' value.
+//:                         places used to encode each 'double' value.  If
+//:                         set to 0, each value is encoded using the fewest
+//:                         digits that decode to exactly that value.
 //
 ///Usage
 ///-----
@@ -211,10 +215,14 @@ class EncoderOptions {
                                          // 'DatetimeTz'
 
     int           d_maxFloatPrecision;   // maximum number of decimal places
-                                         // used to encode 'float' values
+                                         // used to encode 'float' values, or
+                                         // 0 for the shortest round-trip
+                                         // representation
 
     int           d_maxDoublePrecision;  // maximum number of decimal places
-                                         // used to encode 'double' values
+                                         // used to encode 'double' values, or
+                                         // 0 for the shortest round-trip
+                                         // representation
 
   public:
     // CREATORS
@@ -278,12 +286,14 @@ class EncoderOptions {
     void setMaxFloatPrecision(int value);
         // Set the 'maxFloatPrecision' attribute of this object to the
         // specified 'value'.  The behavior is undefined unless
-        // '1 <= value <= 9'.
+        // '0 <= value <= 9'.  Note that 0 selects the shortest representation
+        // that decodes to the encoded value.
 
     void setMaxDoublePrecision(int value);
         // Set the 'maxDoublePrecision' attribute of this object to the
         // specified 'value'.  The behavior is undefined unless
-        // '1 <= value <= 17'.
+        // '0 <= value <= 17'.  Note that 0 selects the shortest
+        // representation that decodes to the encoded value.
 
     // ACCESSORS
     int initialIndentLevel() const;
@@ -452,7 +462,7 @@ void EncoderOptions::setDatetimeFractionalSecondPrecision(int value)
 inline
 void EncoderOptions::setMaxFloatPrecision(int value)
 {
-    BSLS_ASSERT_SAFE(1 <= value     );
+    BSLS_ASSERT_SAFE(0 <= value     );
     BSLS_ASSERT_SAFE(     value <= 9);
 
     d_maxFloatPrecision = value;
@@ -461,7 +471,7 @@ void EncoderOptions::setMaxFloatPrecision(int value)
 inline
 void EncoderOptions::setMaxDoublePrecision(int value)
 {
-    BSLS_ASSERT_SAFE(1 <= value     );
+    BSLS_ASSERT_SAFE(0 <= value     );
     BSLS_ASSERT_SAFE(     value <= 17);
 
     d_maxDoublePrecision = value;
@@ -2163,16 +2163,18 @@ int main(int argc, char *argv[])
 
             if (veryVerbose) cout << "\tmaxFloatPrecision" << endl;
             {
-                ASSERT_SAFE_FAIL(obj.setMaxFloatPrecision(0));
-                ASSERT_SAFE_PASS(obj.setMaxFloatPrecision(1));
+                ASSERT_SAFE_FAIL(obj.setMaxFloatPrecision(-1));
+                ASSERT_SAFE_PASS(obj.setMaxFloatPrecision( 0));
+                ASSERT_SAFE_PASS(obj.setMaxFloatPrecision( 1));
                 ASSERT_SAFE_PASS(obj.setMaxFloatPrecision(9));
                 ASSERT_SAFE_FAIL(obj.setMaxFloatPrecision(10));
             }
 
             if (veryVerbose) cout << "\tmaxDoublePrecision" << endl;
             {
-                ASSERT_SAFE_FAIL(obj.setMaxDoublePrecision(0));
-                ASSERT_SAFE_PASS(obj.setMaxDoublePrecision(1));
+                ASSERT_SAFE_FAIL(obj.setMaxDoublePrecision(-1));
+                ASSERT_SAFE_PASS(obj.setMaxDoublePrecision( 0));
+                ASSERT_SAFE_PASS(obj.setMaxDoublePrecision( 1));
                 ASSERT_SAFE_PASS(obj.setMaxDoublePrecision(17));
                 ASSERT_SAFE_FAIL(obj.setMaxDoublePrecision(18));
             }
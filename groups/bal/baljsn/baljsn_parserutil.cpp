@@ -10,6 +10,7 @@ BSLS_IDENT_RCSID(baljsn_parserutil_cpp,"$Id$ $CSID$")
 #include <bdlde_charconvertutf32.h>
 
 #include <bdlb_chartype.h>
+#include <bdlb_numericparseutil.h>
 #include <bdlb_string.h>
 
 #include <bdldfp_decimalutil.h>
@@ -20,7 +21,6 @@ BSLS_IDENT_RCSID(baljsn_parserutil_cpp,"$Id$ $CSID$")
 #include <bsl_algorithm.h>
 #include <bsl_cmath.h>
 #include <bsl_cctype.h>
-#include <bsl_cerrno.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iosfwd.h>
@@ -312,24 +312,12 @@ int ParserUtil::getValue(double *value, bslstl::StringRef data)
         return loadInfOrNan(value, data);                             // RETURN
     }
 
-    const int k_MAX_STRING_LENGTH = 63;
-    char      buffer[k_MAX_STRING_LENGTH + 1];
+    // 'parseDouble' reports a value that overflows, or that underflows to
+    // zero, by a positive return value; both are errors here.
 
-    bdlma::BufferedSequentialAllocator allocator(buffer,
-                                                 k_MAX_STRING_LENGTH + 1);
-    bsl::string                        dataString(data.data(),
-                                                  data.length(),
-                                                  &allocator);
-
-    char   *endPtr = 0;
-    errno          = 0;
-    double  tmp    = bsl::strtod(dataString.c_str(), &endPtr);
-
-    if (endPtr    != dataString.end()
-     || (0        == tmp && 0 != errno)
-     ||  HUGE_VAL == tmp
-     || -HUGE_VAL == tmp
-     || !bsl::isdigit(*(dataString.end() - 1))) {
+    double tmp;
+    if (0 != bdlb::NumericParseUtil::parseDouble(&tmp, data)
+     || !bsl::isdigit(static_cast<unsigned char>(data[data.length() - 1]))) {
         return -1;                                                    // RETURN
     }
 
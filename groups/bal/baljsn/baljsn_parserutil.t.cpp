@@ -2214,6 +2214,14 @@ int main(int argc, char *argv[])
                 {  L_,    "1e-1",                    0.1,       true    },
                 {  L_,    "1E-1",                    0.1,       true    },
 
+                {  L_,    "4.9406564584124654e-324",
+                                         4.9406564584124654e-324,  true    },
+                {  L_,    "1.7976931348623157e308",
+                                          1.7976931348623157e308,  true    },
+                {  L_,    "0.1000000000000000055511151231257827021181583404541"
+                          "015625",                  0.1,       true    },
+                {  L_,    "9007199254740993",  9007199254740992.0,  true    },
+
                 {  L_,    "\"NaN\"", bsl::numeric_limits<Type>::quiet_NaN(),
                                                                 true    },
 
@@ -2295,9 +2303,12 @@ int main(int argc, char *argv[])
                 {  L_,  "34.56Z1",    ERROR_VALUE,   false   },
                 {  L_,  "34.56eZ",    ERROR_VALUE,   false   },
 
-// TBD:
-//                 {  L_,    "0x12",     ERROR_VALUE,   false   },
-//                 {  L_,    "0x256",    ERROR_VALUE,   false   },
+                {  L_,    "0x12",     ERROR_VALUE,   false   },
+                {  L_,    "0x256",    ERROR_VALUE,   false   },
+                {  L_,    "0x1p3",    ERROR_VALUE,   false   },
+                {  L_,    "1e400",    ERROR_VALUE,   false   },
+                {  L_,    "-1e400",   ERROR_VALUE,   false   },
+                {  L_,    "1e-400",   ERROR_VALUE,   false   },
                 {  L_,    "1.1}",     ERROR_VALUE,   false   },
                 {  L_,    "1.1,",     ERROR_VALUE,   false   },
                 {  L_,    "1.1]",     ERROR_VALUE,   false   },
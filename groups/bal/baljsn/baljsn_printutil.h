@@ -96,6 +96,10 @@ BSLS_IDENT("$Id: $")
 #include <bdlb_float.h>
 #endif
 
+#ifndef INCLUDED_BDLB_NUMERICFORMATTERUTIL
+#include <bdlb_numericformatterutil.h>
+#endif
+
 #ifndef INCLUDED_BDLDFP_DECIMAL
 #include <bdldfp_decimal.h>
 #endif
@@ -104,6 +108,10 @@ BSLS_IDENT("$Id: $")
 #include <bdldfp_decimalconvertutil.h>
 #endif
 
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
 #ifndef INCLUDED_BSLS_TYPES
 #include <bsls_types.h>
 #endif
@@ -152,8 +160,10 @@ struct PrintUtil {
     template <class TYPE>
     static int maxStreamPrecision(const baljsn::EncoderOptions *options);
         // Return the maximum precision for streaming values of the specified
-        // template parameter 'TYPE' using the specified 'options' to decide.
-        // The behavior is undefined unless 'TYPE' is 'float' or 'double'.
+        // template parameter 'TYPE' using the specified 'options' to decide,
+        // or 0 if values are to be encoded using the shortest representation
+        // that round-trips.  The behavior is undefined unless 'TYPE' is
+        // 'float' or 'double'.
 
   public:
     // CLASS METHODS
@@ -271,7 +281,6 @@ inline
 int PrintUtil::maxStreamPrecision<double>(
                                          const baljsn::EncoderOptions *options)
 {
-
     return options
            ? options->maxDoublePrecision()
            : bsl::numeric_limits<double>::digits10;
@@ -334,20 +343,35 @@ int PrintUtil::printFloatingPoint(bsl::ostream&                 stream,
         const int SIZE = 32;
         char      buffer[SIZE];
 
+        const int precision = maxStreamPrecision<TYPE>(options);
+
+        if (0 == precision) {
+            // Encode the shortest representation that round-trips.
+
+            const char *end = bdlb::NumericFormatterUtil::toChars(
+                                                                buffer,
+                                                                buffer + SIZE,
+                                                                value);
+            BSLS_ASSERT(0 != end);
+
+            stream.write(buffer, end - buffer);
+        }
+        else {
 #if defined(BSLS_PLATFORM_CMP_MSVC)
 #define snprintf _snprintf
 #endif
 
-        const int len = snprintf(buffer,
-                                 SIZE,
-                                 "%-1.*g",
-                                 maxStreamPrecision<TYPE>(options),
-                                 value);
+            const int len = snprintf(buffer,
+                                     SIZE,
+                                     "%-1.*g",
+                                     precision,
+                                     value);
 
 #if defined(BSLS_PLATFORM_CMP_MSVC)
 #undef snprintf
 #endif
-        stream.write(buffer, len);
+            stream.write(buffer, len);
+        }
       }
     }
     return 0;
@@ -756,7 +756,9 @@ int main(int argc, char *argv[])
                 { L_,           10.0, 3, "10" },
                 { L_,           -1.5, 1, "-2" },
                 { L_,           -1.5, 2, "-1.5" },
+                { L_,         1.0e-1, 0, "0.1" },
                 { L_,         1.0e-1, 1, "0.1" },
+                { L_,   0.1234567891, 0, "0.12345679" },
                 { L_,   0.1234567891, 1, "0.1" },
                 { L_,   0.1234567891, 4, "0.1235" },
                 { L_,   0.1234567891, 9, "0.123456791" },
@@ -876,6 +878,8 @@ int main(int argc, char *argv[])
       { L_,                   1.0e-1,  1, "0.1" },
       { L_,                2.23e-308,  2, "2.2e-308" },
       { L_,                2.23e-308, 17, "2.2300000000000001e-308" },
+      { L_,                0.1 + 0.2,  0, "0.30000000000000004" },
+      { L_,     0.123456789012345678,  0, "0.12345678901234568" },
       { L_,     0.123456789012345678,  1, "0.1" },
       { L_,     0.123456789012345678,  2, "0.12" },
       { L_,     0.123456789012345678, 15, "0.123456789012346" },
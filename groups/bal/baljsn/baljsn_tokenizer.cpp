@@ -4,14 +4,25 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 
-#include <bdlb_chartype.h>
+#include <bdlb_bitutil.h>
+#include <bdlsb_fixedmeminstreambuf.h>
 
-#include <bsl_cstring.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cstdint.h>
 #include <bsl_ios.h>
 #include <bsl_streambuf.h>
 
 #include <baljsn_parserutil.h>                 // for testing only
 
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                        \
+ || (defined(BSLS_PLATFORM_CPU_X86) && defined(__SSE2__))
+#define BALJSN_TOKENIZER_SSE2 1
+#include <emmintrin.h>
+#endif
+
 // IMPLEMENTATION NOTES
 // --------------------
 // The following table provides the various transitions that need to be handled
@@ -52,12 +63,194 @@ BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 //   END_OBJECT                   '}'         ']'              END_ARRAY
 //   END_ARRAY                    ']'         ']'              END_ARRAY
 //..
+//
+// The tokenizer spends most of its time searching the data for the first
+// character of the next token, the end of an unquoted value, and the end of a
+// string value.  Each of these searches is performed by a function that
+// classifies 16 characters at a time, producing a bit mask of the characters
+// that end the search, using SSE2 instructions where available.  The few
+// characters remaining at the end of the data, and all characters on other
+// platforms, are classified using the 'CHAR_CLASS' table.
 
 namespace BloombergLP {
 namespace {
 
-    static const char *WHITESPACE = " \n\t\v\f\r";
-    static const char *TOKENS     = "{}[]:,";
+enum {
+    // This 'enum' lists the classes of characters significant to the
+    // tokenizer, as bits of the elements of 'CHAR_CLASS'.
+
+    e_WHITESPACE = 1,  // ' ', '\t', '\n', '\v', '\f', and '\r'
+    e_DELIMITER  = 2,  // '{', '}', '[', ']', ':', ',', and '\0', which end an
+                       // unquoted value
+    e_QUOTE      = 4   // '"' and '\\', which are significant within a string
+};
+
+static const unsigned char CHAR_CLASS[256] = {
+    // This table maps each character, cast to 'unsigned char', to the bitwise
+    // OR of the character classes to which it belongs.
+
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0,   // 0x00
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   // 0x10
+    1, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,   // 0x20
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,   // 0x30
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   // 0x40
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 2, 0, 0,   // 0x50
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   // 0x60
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0,   // 0x70
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   // 0x80
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   // 0x90
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   // 0xA0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   // 0xB0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   // 0xC0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   // 0xD0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   // 0xE0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   // 0xF0
+};
+
+inline
+bool isInClass(char character, int charClass)
+    // Return 'true' if the specified 'character' belongs to the specified
+    // 'charClass', and 'false' otherwise.
+{
+    return CHAR_CLASS[static_cast<unsigned char>(character)] & charClass;
+}
+
+#ifdef BALJSN_TOKENIZER_SSE2
+inline
+int whitespaceMask(__m128i characters)
+    // Return a bit mask having bit 'i' set if byte 'i' of the specified
+    // 'characters' is a whitespace character, and unset otherwise.
+{
+    // '\t', '\n', '\v', '\f', and '\r' are the consecutive values 9 to 13.
+
+    const __m128i offset    = _mm_sub_epi8(characters, _mm_set1_epi8(9));
+    const __m128i isControl = _mm_cmpeq_epi8(
+                                    _mm_min_epu8(offset, _mm_set1_epi8(4)),
+                                    offset);
+    const __m128i isSpace   = _mm_cmpeq_epi8(characters, _mm_set1_epi8(' '));
+
+    return _mm_movemask_epi8(_mm_or_si128(isControl, isSpace));
+}
+
+inline
+int delimiterMask(__m128i characters)
+    // Return a bit mask having bit 'i' set if byte 'i' of the specified
+    // 'characters' is a delimiter character, and unset otherwise.
+{
+    const __m128i braces   = _mm_or_si128(
+                          _mm_cmpeq_epi8(characters, _mm_set1_epi8('{')),
+                          _mm_cmpeq_epi8(characters, _mm_set1_epi8('}')));
+    const __m128i brackets = _mm_or_si128(
+                          _mm_cmpeq_epi8(characters, _mm_set1_epi8('[')),
+                          _mm_cmpeq_epi8(characters, _mm_set1_epi8(']')));
+    const __m128i others   = _mm_or_si128(
+                          _mm_or_si128(
+                               _mm_cmpeq_epi8(characters, _mm_set1_epi8(':')),
+                               _mm_cmpeq_epi8(characters, _mm_set1_epi8(','))),
+                          _mm_cmpeq_epi8(characters, _mm_setzero_si128()));
+
+    return _mm_movemask_epi8(
+                  _mm_or_si128(_mm_or_si128(braces, brackets), others));
+}
+
+inline
+int quoteMask(__m128i characters)
+    // Return a bit mask having bit 'i' set if byte 'i' of the specified
+    // 'characters' is a quote or a backslash, and unset otherwise.
+{
+    return _mm_movemask_epi8(_mm_or_si128(
+                         _mm_cmpeq_epi8(characters, _mm_set1_epi8('"')),
+                         _mm_cmpeq_epi8(characters, _mm_set1_epi8('\\'))));
+}
+
+inline
+__m128i load16(const char *address)
+    // Return the 16 characters at the specified 'address'.
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(address));
+}
+
+inline
+const char *firstOf(const char *block, int mask)
+    // Return the address of the character of the specified 16-character
+    // 'block' corresponding to the lowest set bit of the specified non-zero
+    // 'mask'.
+{
+    return block + bdlb::BitUtil::numTrailingUnsetBits(
+                                            static_cast<bsl::uint32_t>(mask));
+}
+#endif
+
+const char *findNonWhitespace(const char *begin, const char *end)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' that is not whitespace, or 'end' if there is no such
+    // character.
+{
+    // Tokens are usually separated by no whitespace or a single space, so the
+    // first two characters are checked before classifying blocks.
+
+    for (int i = 0; i < 2; ++i, ++begin) {
+        if (begin >= end || !isInClass(*begin, e_WHITESPACE)) {
+            return begin;                                             // RETURN
+        }
+    }
+
+#ifdef BALJSN_TOKENIZER_SSE2
+    for (; end - begin >= 16; begin += 16) {
+        const int mask = ~whitespaceMask(load16(begin)) & 0xFFFF;
+        if (mask) {
+            return firstOf(begin, mask);                              // RETURN
+        }
+    }
+#endif
+
+    while (begin < end && isInClass(*begin, e_WHITESPACE)) {
+        ++begin;
+    }
+    return begin;
+}
+
+const char *findWhitespaceOrDelimiter(const char *begin, const char *end)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' that is whitespace or a delimiter, or 'end' if there is
+    // no such character.
+{
+#ifdef BALJSN_TOKENIZER_SSE2
+    for (; end - begin >= 16; begin += 16) {
+        const __m128i characters = load16(begin);
+        const int     mask       = whitespaceMask(characters)
+                                 | delimiterMask(characters);
+        if (mask) {
+            return firstOf(begin, mask);                              // RETURN
+        }
+    }
+#endif
+
+    while (begin < end && !isInClass(*begin, e_WHITESPACE | e_DELIMITER)) {
+        ++begin;
+    }
+    return begin;
+}
+
+const char *findQuote(const char *begin, const char *end)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' that is a quote or a backslash, or 'end' if there is no
+    // such character.
+{
+#ifdef BALJSN_TOKENIZER_SSE2
+    for (; end - begin >= 16; begin += 16) {
+        const int mask = quoteMask(load16(begin));
+        if (mask) {
+            return firstOf(begin, mask);                              // RETURN
+        }
+    }
+#endif
+
+    while (begin < end && !isInClass(*begin, e_QUOTE)) {
+        ++begin;
+    }
+    return begin;
+}
 
 }  // close unnamed namespace
 
@@ -70,27 +263,61 @@ namespace baljsn {
 // PRIVATE MANIPULATORS
 int Tokenizer::reloadStringBuffer()
 {
+    d_cursor = 0;
+
+    if (d_memStreambuf_p) {
+        // Read all the remaining data of the stream buffer in place.
+
+        const bsl::streamoff position = d_memStreambuf_p->pubseekoff(
+                                                           0,
+                                                           bsl::ios_base::cur,
+                                                           bsl::ios_base::in);
+        d_data_p     = d_memStreambuf_p->data() + position;
+        d_dataLength = d_memStreambuf_p->length();
+
+        d_memStreambuf_p->pubseekoff(0, bsl::ios_base::end, bsl::ios_base::in);
+
+        return static_cast<int>(bsl::min<bsl::size_t>(d_dataLength,
+                                                      INT_MAX));  // RETURN
+    }
+
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
     const int numRead =
                      static_cast<int>(d_streambuf_p->sgetn(&d_stringBuffer[0],
                                                            k_MAX_STRING_SIZE));
-    d_cursor = 0;
     d_stringBuffer.resize(numRead);
+    setDataToStringBuffer();
     return numRead;
 }
 
+void Tokenizer::setDataToStringBuffer()
+{
+    d_data_p     = d_stringBuffer.data();
+    d_dataLength = d_stringBuffer.length();
+}
+
 int Tokenizer::expandBufferForLargeValue()
 {
+    if (d_memStreambuf_p) {
+        return -1;                                                    // RETURN
+    }
+
     d_stringBuffer.resize(d_stringBuffer.length() + k_MAX_STRING_SIZE);
 
     const int numRead =
             static_cast<int>(d_streambuf_p->sgetn(&d_stringBuffer[d_valueIter],
                                                   k_MAX_STRING_SIZE));
+    d_stringBuffer.resize(d_valueIter + numRead);
+    setDataToStringBuffer();
     return numRead ? 0 : -1;
 }
 
 int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 {
+    if (d_memStreambuf_p) {
+        return 0;                                                     // RETURN
+    }
+
     d_stringBuffer.erase(d_stringBuffer.begin(),
                          d_stringBuffer.begin() + d_valueBegin);
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
@@ -101,10 +328,9 @@ int Tokenizer::moveValueCharsToStartAndReloadBuffer()
        static_cast<int>(d_streambuf_p->sgetn(&d_stringBuffer[d_valueIter],
                                              k_MAX_STRING_SIZE - d_valueIter));
 
-    if (numRead > 0) {
-        d_stringBuffer.resize(d_valueIter + numRead);
-        d_valueBegin = 0;
-    }
+    d_stringBuffer.resize(d_valueIter + numRead);
+    d_valueBegin = 0;
+    setDataToStringBuffer();
 
     return numRead;
 }
@@ -112,10 +338,10 @@ int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 int Tokenizer::skipWhitespace()
 {
     while (true) {
-        bsl::size_t pos = d_stringBuffer.find_first_not_of(WHITESPACE,
-                                                           d_cursor);
-        if (bsl::string::npos != pos) {
-            d_cursor = pos;
+        const char *end = d_data_p + d_dataLength;
+        const char *pos = findNonWhitespace(d_data_p + d_cursor, end);
+        if (pos < end) {
+            d_cursor = pos - d_data_p;
             break;
         }
 
@@ -129,61 +355,60 @@ int Tokenizer::skipWhitespace()
 
 int Tokenizer::extractStringValue()
 {
-    bool firstTime    = true;
-    char previousChar = 0;
+    bool firstTime = true;
+    bool escaped   = false;  // 'true' if the character at 'd_valueIter'
+                             // follows a backslash
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && '"' != d_stringBuffer[d_valueIter]) {
-
-            if ('\\' == d_stringBuffer[d_valueIter]
-             && '\\' == previousChar) {
-                previousChar = 0;
-            }
-            else {
-                previousChar = d_stringBuffer[d_valueIter];
+        if (d_valueIter < d_dataLength) {
+            if (escaped) {
+                ++d_valueIter;
+                escaped = false;
+                continue;
             }
 
-            ++d_valueIter;
-        }
+            d_valueIter = findQuote(d_data_p + d_valueIter,
+                                    d_data_p + d_dataLength) - d_data_p;
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+            if (d_valueIter < d_dataLength) {
+                if ('"' == d_data_p[d_valueIter]) {
+                    d_valueEnd = d_valueIter;
+                    return 0;                                         // RETURN
+                }
 
-            // There isn't enough room in the internal buffer to hold the
-            // value.  If this is the first time through the loop, we move the
-            // current sequence of characters being processed to the front of
-            // the internal buffer, otherwise we must expand the internal
-            // buffer to hold additional characters.  If we are at the
-            // beginning of the string buffer then we dont need to move any
-            // characters and we simply expand the string buffer.
+                // Skip the backslash, and then the character it escapes.
 
-            if (0 == d_valueBegin) {
-                firstTime = false;
+                ++d_valueIter;
+                escaped = true;
+                continue;
             }
+        }
 
-            if (firstTime) {
-                const int numRead = moveValueCharsToStartAndReloadBuffer();
-                if (0 == numRead) {
-                    return -1;                                        // RETURN
-                }
+        // There isn't enough room in the internal buffer to hold the value.
+        // If this is the first time through the loop, we move the current
+        // sequence of characters being processed to the front of the internal
+        // buffer, otherwise we must expand the internal buffer to hold
+        // additional characters.  If we are at the beginning of the string
+        // buffer then we dont need to move any characters and we simply expand
+        // the string buffer.
 
-                firstTime = false;
-            }
-            else {
-                const int rc = expandBufferForLargeValue();
-                if (rc) {
-                    return rc;                                        // RETURN
-                }
+        if (0 == d_valueBegin) {
+            firstTime = false;
+        }
+
+        if (firstTime) {
+            const int numRead = moveValueCharsToStartAndReloadBuffer();
+            if (0 == numRead) {
+                return -1;                                            // RETURN
             }
+
+            firstTime = false;
         }
         else {
-            if ('\\' == previousChar) {
-                ++d_valueIter;
-                previousChar = 0;
-                continue;
+            const int rc = expandBufferForLargeValue();
+            if (rc) {
+                return rc;                                            // RETURN
             }
-            d_valueEnd = d_valueIter;
-            return 0;                                                 // RETURN
         }
     }
     return 0;
@@ -194,13 +419,11 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
     bool firstTime = true;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && !bdlb::CharType::isSpace(d_stringBuffer[d_valueIter])
-            && !bsl::strchr(TOKENS, d_stringBuffer[d_valueIter])) {
-            ++d_valueIter;
-        }
+        d_valueIter = findWhitespaceOrDelimiter(d_data_p + d_valueIter,
+                                                d_data_p + d_dataLength)
+                                                                    - d_data_p;
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        if (d_valueIter >= d_dataLength) {
 
             // There isn't enough room in the internal buffer to hold the
             // value.  If this is the first time through the loop, we move the
@@ -233,13 +456,26 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
 }
 
 // MANIPULATORS
+void Tokenizer::reset(bsl::streambuf *streambuf)
+{
+    d_streambuf_p    = streambuf;
+    d_memStreambuf_p = dynamic_cast<bdlsb::FixedMemInStreamBuf *>(streambuf);
+    d_stringBuffer.clear();
+    setDataToStringBuffer();
+    d_cursor         = 0;
+    d_valueBegin     = 0;
+    d_valueEnd       = 0;
+    d_valueIter      = 0;
+    d_tokenType      = e_BEGIN;
+}
+
 int Tokenizer::advanceToNextToken()
 {
     if (e_ERROR == d_tokenType) {
         return -1;                                                    // RETURN
     }
 
-    if (d_cursor >= d_stringBuffer.size()) {
+    if (d_cursor >= d_dataLength) {
         const int numRead = reloadStringBuffer();
         if (0 == numRead) {
             d_tokenType = e_ERROR;
@@ -258,7 +494,7 @@ int Tokenizer::advanceToNextToken()
             return -1;                                                // RETURN
         }
 
-        switch (d_stringBuffer[d_cursor]) {
+        switch (d_data_p[d_cursor]) {
           case '{': {
             if ((e_ELEMENT_NAME == d_tokenType && ':' == previousChar)
              || e_START_ARRAY   == d_tokenType
@@ -464,12 +700,11 @@ int Tokenizer::advanceToNextToken()
 
 int Tokenizer::resetStreamBufGetPointer()
 {
-    if (d_cursor >= d_stringBuffer.size()) {
+    if (d_cursor >= d_dataLength) {
         return 0;                                                     // RETURN
     }
 
-    const int numExtraCharsRead = static_cast<int>(d_stringBuffer.size()
-                                                                   - d_cursor);
+    const int numExtraCharsRead = static_cast<int>(d_dataLength - d_cursor);
     const bsl::streamoff newPos = d_streambuf_p->pubseekoff(-numExtraCharsRead,
                                                             bsl::ios_base::cur,
                                                             bsl::ios_base::in);
@@ -483,8 +718,7 @@ int Tokenizer::value(bslstl::StringRef *data) const
     if ((e_ELEMENT_NAME == d_tokenType
                                         || e_ELEMENT_VALUE == d_tokenType)
      && d_valueBegin != d_valueEnd) {
-        data->assign(&d_stringBuffer[d_valueBegin],
-                     &d_stringBuffer[d_valueEnd]);
+        data->assign(d_data_p + d_valueBegin, d_data_p + d_valueEnd);
         return 0;                                                     // RETURN
     }
     return -1;
@@ -25,6 +25,21 @@ BSLS_IDENT("$Id: $")
 // package and in most cases clients should use the 'baljsn_decoder' component
 // instead of using this 'class'.
 //
+///Performance
+///-----------
+// The tokenizer finds the boundaries of tokens, and the end of string values,
+// by classifying 16 characters at a time using SSE2 instructions on platforms
+// that support them, and a lookup table otherwise.
+//
+// If the 'bsl::streambuf' supplied to 'reset' is a
+// 'bdlsb::FixedMemInStreamBuf', the tokenizer reads the JSON data directly
+// from the memory of that stream buffer, rather than copying it into an
+// internal buffer in blocks, and the string references returned by the 'value'
+// accessor refer to that memory.  This is the fastest way to tokenize (or
+// decode, using 'baljsn_decoder') JSON data that is already in memory.  Note
+// that, in this case, the get pointer of the stream buffer is moved to the end
+// of the data when the first token is read.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -150,6 +165,9 @@ BSLS_IDENT("$Id: $")
 #endif
 
 namespace BloombergLP {
+
+namespace bdlsb { class FixedMemInStreamBuf; }
+
 namespace baljsn {
 
                               // ===============
@@ -206,6 +224,26 @@ class Tokenizer {
                                                                  // (held, not
                                                                  // owned)
 
+    bdlsb::FixedMemInStreamBuf          *d_memStreambuf_p;       // streambuf,
+                                                                 // if its data
+                                                                 // is read in
+                                                                 // place, and
+                                                                 // 0 otherwise
+                                                                 // (held, not
+                                                                 // owned)
+
+    const char                          *d_data_p;               // data being
+                                                                 // tokenized,
+                                                                 // in the
+                                                                 // string
+                                                                 // buffer or
+                                                                 // streambuf
+                                                                 // (held, not
+                                                                 // owned)
+
+    bsl::size_t                          d_dataLength;           // length of
+                                                                 // data
+
     bsl::size_t                          d_cursor;               // current
                                                                  // cursor
 
@@ -251,19 +289,28 @@ class Tokenizer {
         // additional characters, from the internally-held 'streambuf'
         // ('d_streambuf_p') to the end of that sequence up to a maximum
         // sequence length of 'd_buffer.size()' characters.  Return the number
-        // of bytes read from the 'streambuf'.
+        // of bytes read from the 'streambuf'.  Note that if the 'streambuf' is
+        // read in place, there are no additional characters and this method
+        // has no effect.
 
     int reloadStringBuffer();
         // Reload the string buffer with new data read from the underlying
         // 'streambuf' and overwriting the current buffer.  After reading
         // update the cursor to the new read location.  Return the number of
-        // bytes read from the 'streambuf'.
+        // bytes read from the 'streambuf'.  Note that if the 'streambuf' is
+        // read in place, all of its data is "read" by the first call.
+
+    void setDataToStringBuffer();
+        // Set the data being tokenized to the contents of the string buffer,
+        // 'd_stringBuffer'.
 
     int expandBufferForLargeValue();
         // Increase the size of the string buffer, 'd_stringBuffer', and then
         // append additional characters, from the internally-held 'streambuf' (
         // 'd_streambuf_p') to the end of the current sequence of characters.
-        // Return 0 on success and a non-zero value otherwise.
+        // Return 0 on success and a non-zero value otherwise.  Note that if
+        // the 'streambuf' is read in place, there are no additional characters
+        // and this method returns a non-zero value.
 
     int skipWhitespace();
         // Skip all whitespace characters and position the cursor onto the
@@ -293,7 +340,9 @@ class Tokenizer {
         // Reset this tokenizer to read data from the specified 'streambuf'.
         // Note that the reader will not be on a valid node until
         // 'advanceToNextToken' is called.  Note that this function does not
-        // change the value of the 'allowStandAloneValues' option.
+        // change the value of the 'allowStandAloneValues' option.  Also note
+        // that if 'streambuf' is a 'bdlsb::FixedMemInStreamBuf' its data is
+        // read in place (see {Performance}).
 
     int advanceToNextToken();
         // Move to the next token in the data steam.  Return 0 on success and a
@@ -359,6 +408,9 @@ Tokenizer::Tokenizer(bslma::Allocator *basicAllocator)
 : d_allocator(d_buffer.buffer(), k_BUFSIZE, basicAllocator)
 , d_stringBuffer(&d_allocator)
 , d_streambuf_p(0)
+, d_memStreambuf_p(0)
+, d_data_p(0)
+, d_dataLength(0)
 , d_cursor(0)
 , d_valueBegin(0)
 , d_valueEnd(0)
@@ -377,18 +429,6 @@ Tokenizer::~Tokenizer()
 }
 
 // MANIPULATORS
-inline
-void Tokenizer::reset(bsl::streambuf *streambuf)
-{
-    d_streambuf_p = streambuf;
-    d_stringBuffer.clear();
-    d_cursor      = 0;
-    d_valueBegin  = 0;
-    d_valueEnd    = 0;
-    d_valueIter   = 0;
-    d_tokenType   = e_BEGIN;
-}
-
 inline
 void Tokenizer::setAllowStandAloneValues(bool value)
 {
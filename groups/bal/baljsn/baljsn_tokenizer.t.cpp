@@ -15,12 +15,16 @@
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 
+#include <bsls_stopwatch.h>
+
 #include <bdlsb_memoutstreambuf.h>            // for testing only
 #include <bdlsb_fixedmemoutstreambuf.h>       // for testing only
 #include <bdlsb_fixedmeminstreambuf.h>        // for testing only
 
+#include <bsl_cstdio.h>
 #include <bsl_cstring.h>
 #include <bsl_cstdlib.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -59,7 +63,9 @@ using bsl::endl;
 // [ 3] int value(bslstl::StringRef *data) const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [15] CONCERN: Data read in place is tokenized as if read in blocks.
+// [16] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -173,6 +179,46 @@ void confirmStreamBufReset(bsl::streambuf     *sb,
     }
 }
 
+void tokenize(bsl::vector<bsl::string> *tokens, bsl::streambuf *sb)
+    // Load into the specified 'tokens' a description of each token, and its
+    // value, read by a tokenizer from the specified 'sb' until
+    // 'advanceToNextToken' fails, followed by the description of the token on
+    // which the tokenizer stopped.
+{
+    Obj mX;
+
+    mX.reset(sb);
+
+    tokens->clear();
+    while (0 == mX.advanceToNextToken()) {
+        bsl::ostringstream token;
+        token << mX.tokenType();
+
+        bslstl::StringRef value;
+        if (0 == mX.value(&value)) {
+            token << ' ' << value;
+        }
+        tokens->push_back(token.str());
+    }
+
+    bsl::ostringstream token;
+    token << mX.tokenType();
+    tokens->push_back(token.str());
+}
+
+bsl::string whitespace(int length)
+    // Return a string of the specified 'length' consisting of each of the
+    // whitespace characters in turn.
+{
+    static const char WHITESPACE[] = " \t\n\v\f\r";
+
+    bsl::string result;
+    for (int i = 0; i < length; ++i) {
+        result += WHITESPACE[i % (sizeof WHITESPACE - 1)];
+    }
+    return result;
+}
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -194,7 +240,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -316,6 +362,230 @@ int main(int argc, char *argv[])
     ASSERT(10022           == address.d_zipcode);
 //..
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING IN-PLACE TOKENIZATION
+        //
+        // Concerns:
+        //: 1 JSON data supplied in a 'bdlsb::FixedMemInStreamBuf' is read in
+        //:   place, and the values of its tokens refer to that data.
+        //:
+        //: 2 Data read in place is tokenized exactly as the same data read
+        //:   from another kind of 'streambuf', which is read in blocks.
+        //:
+        //: 3 Whitespace, values, and strings are correctly delimited
+        //:   regardless of their length and of their position relative to the
+        //:   blocks of characters that are classified together, including
+        //:   escaped quotes and backslashes at any position.
+        //:
+        //: 4 Values longer than the internal buffer are correctly tokenized.
+        //:
+        //: 5 A stand-alone value preceded by whitespace and ending the data is
+        //:   tokenized.
+        //:
+        //: 6 After reading data in place, 'resetStreamBufGetPointer' resets
+        //:   the get pointer of the 'streambuf' to the byte following the last
+        //:   processed byte.
+        //
+        // Plan:
+        //: 1 Tokenize a short document from a 'bdlsb::FixedMemInStreamBuf',
+        //:   and verify that the value of a token refers to the memory of the
+        //:   stream buffer.  (C-1)
+        //:
+        //: 2 Generate documents having runs of whitespace, unquoted values,
+        //:   and strings of every length up to 40 characters, the strings
+        //:   having an escaped character at every position.  Tokenize each
+        //:   document from a 'bdlsb::FixedMemInStreamBuf' and from a
+        //:   'bsl::stringbuf', and verify that the tokens, their values, and
+        //:   the final state are the same, and that the value of each string
+        //:   is as expected.  (C-2..3)
+        //:
+        //: 3 Repeat P-2 for documents having strings and unquoted values of
+        //:   about 20,000 characters, and an array of more than 8K of values.
+        //:   (C-4)
+        //:
+        //: 4 Tokenize a stand-alone value preceded by whitespace from each
+        //:   kind of 'streambuf', and verify its value.  (C-5)
+        //:
+        //: 5 Tokenize part of a document from a 'bdlsb::FixedMemInStreamBuf',
+        //:   call 'resetStreamBufGetPointer', and verify the remaining
+        //:   characters of the stream buffer.  (C-6)
+        //
+        // Testing:
+        //   CONCERN: Data read in place is tokenized as if read in blocks.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING IN-PLACE TOKENIZATION" << endl
+                          << "=============================" << endl;
+
+        if (verbose) cout << "Verify that data is read in place." << endl;
+        {
+            const char INPUT[] = "{ \"name\" : \"value\" }";
+
+            bdlsb::FixedMemInStreamBuf isb(INPUT, sizeof INPUT - 1);
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset(&isb);
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(Obj::e_ELEMENT_NAME == X.tokenType());
+
+            bslstl::StringRef value;
+            ASSERT(0 == X.value(&value));
+            ASSERT("name"    == value);
+            ASSERT(INPUT + 3 == value.data());
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(Obj::e_ELEMENT_VALUE == X.tokenType());
+            ASSERT(0 == X.value(&value));
+            ASSERT("\"value\"" == value);
+            ASSERT(INPUT + 11  == value.data());
+        }
+
+        if (verbose) cout << "Compare in-place and block tokenization."
+                          << endl;
+        {
+            bsl::vector<bsl::string> documents;
+            bsl::vector<bsl::string> strings;
+
+            for (int length = 0; length <= 40; ++length) {
+                const bsl::string SPACE  = whitespace(length);
+                const bsl::string NUMBER = bsl::string(length + 1, '7');
+
+                bsl::string document = "[" + SPACE + NUMBER + SPACE + ","
+                                     + SPACE + "{" + SPACE + "\"key\"" + SPACE
+                                     + ":" + SPACE + "-" + NUMBER + "e5"
+                                     + SPACE + "}" + SPACE + "," + NUMBER
+                                     + "]";
+                documents.push_back(document);
+                strings.push_back("");
+
+                for (int position = 0; position < length; ++position) {
+                    for (int escaped = 0; escaped < 2; ++escaped) {
+                        bsl::string string(length, 'a');
+                        string[position] = '\\';
+                        if (position + 1 < length) {
+                            string[position + 1] = escaped ? '"' : '\\';
+                        }
+                        else {
+                            string += escaped ? '"' : '\\';
+                        }
+
+                        document = "{\"" + string + "\":[\"" + string
+                                 + "\"" + SPACE + "]," + SPACE + "\"" + string
+                                 + "\"" + ":" + NUMBER + "}";
+                        documents.push_back(document);
+                        strings.push_back(string);
+                    }
+                }
+            }
+
+            const bsl::string LONG_STRING = bsl::string(9000, 'x') + "\\\""
+                                          + bsl::string(8190, 'y') + "\\\\"
+                                          + bsl::string(3000, 'z');
+            const bsl::string LONG_NUMBER(20000, '9');
+
+            documents.push_back("{\"" + LONG_STRING + "\":\"" + LONG_STRING
+                                + "\"}");
+            strings.push_back(LONG_STRING);
+
+            documents.push_back("{ \"value\" : " + LONG_NUMBER + " }");
+            strings.push_back("");
+
+            bsl::string array = "[";
+            for (int i = 0; i < 3000; ++i) {
+                array += "1.25," + whitespace(i % 7) + "\"s\",";
+            }
+            array += "[]]";
+            documents.push_back(array);
+            strings.push_back("");
+
+            for (bsl::size_t i = 0; i < documents.size(); ++i) {
+                const bsl::string& DOCUMENT = documents[i];
+                const bsl::string& STRING   = strings[i];
+
+                if (veryVerbose) {
+                    P_(i) P(DOCUMENT.size())
+                }
+
+                bsl::vector<bsl::string> expected;
+                bsl::vector<bsl::string> actual;
+
+                bsl::stringbuf sb(DOCUMENT);
+                tokenize(&expected, &sb);
+
+                bdlsb::FixedMemInStreamBuf isb(DOCUMENT.data(),
+                                               DOCUMENT.size());
+                tokenize(&actual, &isb);
+
+                ASSERTV(i, expected == actual);
+
+                // The tokenizer reaches the end of the data after the last
+                // token.
+
+                ASSERTV(i, 2 <= expected.size());
+                ASSERTV(i, "e_ERROR" == expected.back());
+
+                const bsl::string LAST = expected[expected.size() - 2];
+                ASSERTV(i, LAST, "e_END_OBJECT" == LAST
+                              || "e_END_ARRAY"  == LAST);
+
+                if (!STRING.empty()) {
+                    ASSERTV(i, 3 <= expected.size());
+                    ASSERTV(i, "e_ELEMENT_NAME " + STRING == expected[1]);
+                }
+            }
+        }
+
+        if (verbose) cout << "Verify a stand-alone value ending the data."
+                          << endl;
+        {
+            const char INPUT[] = "   123";
+
+            bsl::stringbuf             sb(INPUT);
+            bdlsb::FixedMemInStreamBuf isb(INPUT, sizeof INPUT - 1);
+
+            bsl::streambuf *const STREAMBUFS[] = { &sb, &isb };
+
+            for (int i = 0; i < 2; ++i) {
+                Obj mX;  const Obj& X = mX;
+                mX.reset(STREAMBUFS[i]);
+
+                ASSERTV(i, 0 == mX.advanceToNextToken());
+                ASSERTV(i, Obj::e_ELEMENT_VALUE == X.tokenType());
+
+                bslstl::StringRef value;
+                ASSERTV(i, 0 == X.value(&value));
+                ASSERTV(i, value, "123" == value);
+            }
+        }
+
+        if (verbose) cout << "Verify 'resetStreamBufGetPointer'." << endl;
+        {
+            const char INPUT[] = "  [ 1, 2 ]  XYZ";
+
+            bdlsb::FixedMemInStreamBuf isb(INPUT, sizeof INPUT - 1);
+
+            Obj mX;
+            mX.reset(&isb);
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(0 == mX.advanceToNextToken());
+
+            ASSERT(0 == isb.length());
+
+            ASSERT(0 == mX.resetStreamBufGetPointer());
+            ASSERT(5 == isb.length());
+
+            char remaining[6] = { 0 };
+            ASSERT(5 == isb.sgetn(remaining, 5));
+            ASSERT(0 == bsl::strcmp("  XYZ", remaining));
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TESTING 'setAllowHeterogenousArrays' and 'allowHeterogenousArrays'
@@ -6394,6 +6664,90 @@ int main(int argc, char *argv[])
         Obj mX;  const Obj& X = mX;
         ASSERTV(X.tokenType(), Obj::e_BEGIN == X.tokenType());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 The throughput of the tokenizer, in MB/s, for a large document
+        //:   that is read in place and read in blocks.
+        //
+        // Plan:
+        //: 1 Generate a document describing a snapshot of market data, and
+        //:   report the rate at which it is tokenized from a
+        //:   'bdlsb::FixedMemInStreamBuf' and from a 'bsl::stringbuf'.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST" << endl
+             << "================" << endl;
+
+        const int NUM_QUOTES = argc > 2 ? atoi(argv[2]) : 100000;
+
+        bsl::string document = "{\n  \"quotes\" : [\n";
+        for (int i = 0; i < NUM_QUOTES; ++i) {
+            char quote[512];
+            sprintf(quote,
+                    "    {\n"
+                    "      \"ticker\" : \"SEC%d US Equity\",\n"
+                    "      \"exchange\" : \"XNYS\",\n"
+                    "      \"bid\" : %d.%02d,\n"
+                    "      \"ask\" : %d.%02d,\n"
+                    "      \"bidSize\" : %d,\n"
+                    "      \"askSize\" : %d,\n"
+                    "      \"time\" : \"2016-03-07T14:30:%02d.%06d\",\n"
+                    "      \"conditions\" : [ \"R\", \"T\" ]\n"
+                    "    }%s\n",
+                    i,
+                    100 + i % 900, i % 100,
+                    100 + i % 900, (i + 1) % 100,
+                    100 * (i % 50),
+                    200 * (i % 40),
+                    i % 60, i % 1000000,
+                    i + 1 < NUM_QUOTES ? "," : "");
+            document += quote;
+        }
+        document += "  ]\n}\n";
+
+        const double MB = document.size() / (1024.0 * 1024.0);
+
+        cout << "Document size: " << MB << " MB" << endl;
+
+        for (int inPlace = 1; inPlace >= 0; --inPlace) {
+            bdlsb::FixedMemInStreamBuf isb(document.data(), document.size());
+            bsl::stringbuf             sb(document);
+
+            Obj mX;
+
+            bsls::Stopwatch timer;
+            timer.start();
+
+            mX.reset(inPlace ? static_cast<bsl::streambuf *>(&isb) : &sb);
+
+            bsls::Types::Int64 numTokens = 0;
+            bsl::size_t        length    = 0;
+            while (0 == mX.advanceToNextToken()) {
+                bslstl::StringRef value;
+                if (0 == mX.value(&value)) {
+                    length += value.length();
+                }
+                ++numTokens;
+            }
+
+            timer.stop();
+
+            ASSERT(Obj::e_ERROR == mX.tokenType());
+            ASSERT(0 < length);
+
+            cout << (inPlace ? "bdlsb::FixedMemInStreamBuf: "
+                             : "bsl::stringbuf:             ")
+                 << numTokens << " tokens, "
+                 << MB / timer.elapsedTime() << " MB/s" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
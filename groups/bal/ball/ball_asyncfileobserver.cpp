@@ -31,6 +31,7 @@ BSLS_IDENT_RCSID(ball_asyncfileobserver_cpp,"$Id$ $CSID$")
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
 #include <bsl_memory.h>
+#include <bsl_vector.h>
 
 // IMPLEMENTATION NOTE: 'shutdownThread' clears the queue in order to simplify
 // the implementation.  To guarantee that a thread sees the
@@ -41,6 +42,12 @@ BSLS_IDENT_RCSID(ball_asyncfileobserver_cpp,"$Id$ $CSID$")
 // record (when the thread is restarted) the queue is cleared.  Alternative
 // designs are possible, but are not perceived to be worth the added
 // complexity.
+//
+// The publication thread drains the queue in batches of at most
+// 'MAX_BATCH_SIZE' records.  Draining stops at an 'e_END' record, so records
+// pushed after the end marker (e.g., by a 'publish' that races with
+// 'stopPublicationThread') stay in the queue, exactly as they did when records
+// were popped one at a time.
 
 namespace BloombergLP {
 namespace ball {
@@ -49,7 +56,8 @@ namespace {
 
 enum {
     DEFAULT_FIXED_QUEUE_SIZE = 8192,
-    FORCE_WARN_THRESHOLD     = 5000
+    FORCE_WARN_THRESHOLD     = 5000,
+    MAX_BATCH_SIZE           = 256
 };
 
 static const char LOG_CATEGORY[] = "BALL.ASYNCFILEOBSERVER";
@@ -92,19 +100,64 @@ void AsyncFileObserver::publishThreadEntryPoint()
     d_droppedRecordWarning.fixedFields().setThreadID(
                                           bslmt::ThreadUtil::selfIdAsUint64());
 
+    // The slots of 'batch' are reused from one batch to the next; 'records'
+    // holds the addresses of the records handed to the file observer.
+
+    bsl::vector<AsyncRecord>    batch(MAX_BATCH_SIZE, d_allocator_p);
+    bsl::vector<const Record *> records(MAX_BATCH_SIZE, 0, d_allocator_p);
+
     while (!done) {
-        AsyncRecord asyncRecord = d_recordQueue.popFront();
+        // Block for the first record, then drain whatever else is already
+        // queued, stopping after an end-of-publication marker.
 
-        // Publish the next log record on the queue only if the observer is
-        // not shutting down.
+        d_recordQueue.popFront(&batch[0]);
+        int numPopped = 1;
 
-        if (Transmission::e_END == asyncRecord.d_context.transmissionCause()
-            || d_shuttingDownFlag) {
+        while (numPopped < MAX_BATCH_SIZE
+            && Transmission::e_END !=
+                    batch[numPopped - 1].d_context.transmissionCause()
+            && 0 == d_recordQueue.tryPopFront(&batch[numPopped])) {
+            ++numPopped;
+        }
+
+        const int queueLength = numPopped + d_recordQueue.length();
+        if (queueLength > d_maxRecordQueueLength.loadRelaxed()) {
+            d_maxRecordQueueLength.storeRelaxed(queueLength);
+        }
+
+        int numRecords = numPopped;
+        if (Transmission::e_END ==
+                         batch[numPopped - 1].d_context.transmissionCause()) {
+            --numRecords;
             done = true;
         }
-        else {
-            d_fileObserver.publish(*asyncRecord.d_record,
-                                   asyncRecord.d_context);
+
+        // Publish the popped log records only if the observer is not shutting
+        // down.
+
+        if (d_shuttingDownFlag) {
+            numRecords = 0;
+            done       = true;
+        }
+
+        if (0 < numRecords) {
+            for (int i = 0; i < numRecords; ++i) {
+                records[i] = batch[i].d_record.get();
+            }
+            d_fileObserver.publishBatch(&records[0], numRecords);
+
+            d_numPublishedBatches.addRelaxed(1);
+            d_numPublishedRecords.addRelaxed(numRecords);
+            if (numRecords > d_maxRecordsPerBatch.loadRelaxed()) {
+                d_maxRecordsPerBatch.storeRelaxed(numRecords);
+            }
+        }
+
+        // Release the records so that their memory is not held until the
+        // slots are reused.
+
+        for (int i = 0; i < numPopped; ++i) {
+            batch[i].d_record.reset();
         }
 
         // Publish the count of dropped records.  To avoid repeatedly
@@ -131,9 +184,14 @@ int AsyncFileObserver::startThread()
 {
     if (bslmt::ThreadUtil::invalidHandle() == d_threadHandle) {
         bslmt::ThreadAttributes attr;
-        return bslmt::ThreadUtil::create(&d_threadHandle,
-                                         attr,
-                                         d_publishThreadEntryPoint);  // RETURN
+        attr.setCpuSet(d_publicationThreadCpuSet);
+        int rc = bslmt::ThreadUtil::create(&d_threadHandle,
+                                           attr,
+                                           d_publishThreadEntryPoint);
+        if (0 != rc) {
+            d_threadHandle = bslmt::ThreadUtil::invalidHandle();
+        }
+        return rc;                                                    // RETURN
     }
     return 0;
 }
@@ -204,6 +262,7 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
+, d_publicationThreadCpuSet(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -217,6 +276,7 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
+, d_publicationThreadCpuSet(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -231,6 +291,7 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
+, d_publicationThreadCpuSet(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -247,6 +308,7 @@ AsyncFileObserver::AsyncFileObserver(
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(dropRecordsOnFullQueueThreshold)
 , d_droppedRecordWarning(basicAllocator)
+, d_publicationThreadCpuSet(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -298,6 +360,13 @@ int AsyncFileObserver::stopPublicationThread()
     return stopThread();
 }
 
+void AsyncFileObserver::setPublicationThreadCpuSet(
+                                               const bsl::vector<int>& cpuSet)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    d_publicationThreadCpuSet = cpuSet;
+}
+
 int AsyncFileObserver::shutdownPublicationThread()
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
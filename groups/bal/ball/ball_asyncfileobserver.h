@@ -60,6 +60,10 @@ BSLS_IDENT("$Id: $")
 //                         |              isUserFieldsLoggingEnabled
 //                         |              isPublishInLocalTimeEnabled
 //                         |              isPublicationThreadRunning
+//                         |              maxRecordQueueLength
+//                         |              maxRecordsPerBatch
+//                         |              numPublishedBatches
+//                         |              numPublishedRecords
 //                         |              recordQueueLength
 //                         |              rotationLifetime
 //                         |              rotationSize
@@ -193,6 +197,38 @@ BSLS_IDENT("$Id: $")
 // Note that timestamp pattern elements in a log file name are typically
 // selected so they produce unique names for each rotation.
 //
+///Batch Publication
+///-----------------
+// The publication thread does not write queued records one at a time.  Each
+// time it wakes up, it drains up to 256 records from the record queue, and
+// hands them to the underlying file observer as a single batch: the records
+// are formatted into one contiguous buffer that is written to the log file
+// with a single write operation, acquiring the file observer's lock once per
+// batch rather than once per record (see 'ball::FileObserver2::publishBatch').
+// Under light load batches hold a single record, so records are written as
+// promptly as before; under heavy load the per-record cost of publication
+// drops, which lets the publication thread keep up with the producers.
+//
+// The following accessors can be used to monitor the record queue and the
+// batching behavior of the publication thread:
+//: o 'recordQueueLength': the number of records currently in the queue
+//: o 'maxRecordQueueLength': the largest queue length observed by the
+//:   publication thread
+//: o 'numPublishedBatches': the number of batches written
+//: o 'numPublishedRecords': the number of records written
+//: o 'maxRecordsPerBatch': the size of the largest batch written
+//
+// The average number of records per batch is
+// 'numPublishedRecords() / numPublishedBatches()'.
+//
+///Pinning the Publication Thread
+///------------------------------
+// On a multi-core host, a latency-sensitive application may want to keep the
+// publication thread off the cores used by its critical threads.
+// 'setPublicationThreadCpuSet' restricts the publication thread to a set of
+// CPUs; the set applies the next time the publication thread is started, so
+// it is typically supplied before 'startPublicationThread' is called.
+//
 ///Thread Safety
 ///-------------
 // All public methods of 'ball::AsyncFileObserver' are thread-safe, and can be
@@ -351,6 +387,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_atomic.h>
 #endif
 
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
 #ifndef INCLUDED_BSL_FUNCTIONAL
 #include <bsl_functional.h>
 #endif
@@ -363,6 +403,10 @@ BSLS_IDENT("$Id: $")
 #include <bsl_string.h>
 #endif
 
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
 namespace BloombergLP {
 namespace ball {
 
@@ -410,6 +454,25 @@ class AsyncFileObserver : public Observer {
                                                      // records, reset when
                                                      // published
 
+    bsls::AtomicInt64              d_numPublishedBatches;
+                                                     // number of batches
+                                                     // written by the
+                                                     // publication thread
+
+    bsls::AtomicInt64              d_numPublishedRecords;
+                                                     // number of records
+                                                     // written by the
+                                                     // publication thread
+
+    bsls::AtomicInt                d_maxRecordsPerBatch;
+                                                     // size of the largest
+                                                     // batch written
+
+    bsls::AtomicInt                d_maxRecordQueueLength;
+                                                     // largest queue length
+                                                     // observed by the
+                                                     // publication thread
+
     bsl::function<void()>          d_publishThreadEntryPoint;
                                                      // functor that contains
                                                      // publication thread
@@ -421,6 +484,11 @@ class AsyncFileObserver : public Observer {
                                                      // count of dropped log
                                                      // records
 
+    bsl::vector<int>               d_publicationThreadCpuSet;
+                                                     // CPUs to which the
+                                                     // publication thread is
+                                                     // restricted, or empty
+
     mutable bslmt::Mutex           d_mutex;          // serialize operations
 
     bslma::Allocator              *d_allocator_p;    // memory allocator (held,
@@ -446,12 +514,13 @@ class AsyncFileObserver : public Observer {
 
     void publishThreadEntryPoint();
         // Thread function of the publication thread.  The publication thread
-        // pops record shared pointers and contexts from queue and writes the
-        // records referred by these shared pointers to files or 'stdout'.  The
-        // behavior is undefined if this method is invoked concurrently from
-        // multiple threads (i.e., it is *not* *thread-safe*).  Publish records
-        // from the record queue until signaled to stop.  This is the entry
-        // point function for the publication thread.
+        // pops batches of record shared pointers and contexts from queue and
+        // writes the records referred by these shared pointers to files or
+        // 'stdout', one batch at a time.  The behavior is undefined if this
+        // method is invoked concurrently from multiple threads (i.e., it is
+        // *not* *thread-safe*).  Publish records from the record queue until
+        // signaled to stop.  This is the entry point function for the
+        // publication thread.
 
     int shutdownThread();
         // Stop the publication thread without waiting for remaining log
@@ -681,6 +750,16 @@ class AsyncFileObserver : public Observer {
         // used when publishing log records.  See "Log Record Formatting" under
         // @DESCRIPTION for details of formatting syntax.
 
+    void setPublicationThreadCpuSet(const bsl::vector<int>& cpuSet);
+        // Restrict the publication thread subsequently started by this async
+        // file observer to run only on the CPUs having the indices in the
+        // specified 'cpuSet', or, if 'cpuSet' is empty, do not restrict it.
+        // A publication thread that is already running is unaffected.  Note
+        // that 'startPublicationThread' fails if the thread cannot be
+        // restricted to 'cpuSet' (e.g., if 'cpuSet' contains a CPU that does
+        // not exist), and that CPU affinity is not supported on all platforms
+        // (see 'bslmt_threadutil').
+
     int shutdownPublicationThread();
         // Stop the publication thread without waiting for remaining log
         // records in the record queue to be published.  Discard currently
@@ -724,6 +803,26 @@ class AsyncFileObserver : public Observer {
         // Return 'true' if the publication thread is running, and 'false'
         // otherwise.
 
+    int maxRecordQueueLength() const;
+        // Return the largest number of log records observed in this
+        // observer's log record queue by the publication thread when it
+        // dequeued a batch of records.  Note that this value is a lower bound
+        // on the actual high-water mark of the queue.
+
+    int maxRecordsPerBatch() const;
+        // Return the largest number of log records written by the publication
+        // thread in a single batch.
+
+    bsls::Types::Int64 numPublishedBatches() const;
+        // Return the number of batches of log records written by the
+        // publication thread of this observer.
+
+    bsls::Types::Int64 numPublishedRecords() const;
+        // Return the number of log records written by the publication thread
+        // of this observer.  Note that records dropped because the record
+        // queue was full, or discarded by 'shutdownPublicationThread', are not
+        // counted.
+
     int recordQueueLength() const;
         // Return the number of log records currently in this observer's log
         // record queue.
@@ -875,6 +974,30 @@ bdlt::DatetimeInterval AsyncFileObserver::rotationLifetime() const
     return d_fileObserver.rotationLifetime();
 }
 
+inline
+int AsyncFileObserver::maxRecordQueueLength() const
+{
+    return d_maxRecordQueueLength.loadRelaxed();
+}
+
+inline
+int AsyncFileObserver::maxRecordsPerBatch() const
+{
+    return d_maxRecordsPerBatch.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 AsyncFileObserver::numPublishedBatches() const
+{
+    return d_numPublishedBatches.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 AsyncFileObserver::numPublishedRecords() const
+{
+    return d_numPublishedRecords.loadRelaxed();
+}
+
 inline
 int AsyncFileObserver::recordQueueLength() const
 {
@@ -28,6 +28,8 @@
 #include <bdlt_currenttime.h>
 #include <bdlt_localtimeoffset.h>
 
+#include <bslmt_threadutil.h>
+
 #include <bsls_assert.h>
 #include <bsls_platform.h>
 #include <bsls_stopwatch.h>
@@ -38,9 +40,11 @@
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_ctime.h>       // 'time_t'
+#include <bsl_fstream.h>
 #include <bsl_iomanip.h>     // 'setfill'
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 
 #include <bsl_c_stdio.h>     // 'tempname'
@@ -97,11 +101,16 @@ using bsl::flush;
 // [ 3] void rotateOnTimeInterval(const bdlt::DatetimeInterval timeInterval)
 // [ 1] void setStdoutThreshold(ball::Severity::Level stdoutThreshold)
 // [ 1] void setLogFormat(const char*, const char*)
+// [11] void setPublicationThreadCpuSet(const bsl::vector<int>&);
 // [ 1] void startPublicationThread();
 // [ 1] void stopPublicationThread();
 //
 // ACCESSORS
 // [ 9] int recordQueueLength() const
+// [10] int maxRecordQueueLength() const
+// [10] int maxRecordsPerBatch() const
+// [10] bsls::Types::Int64 numPublishedBatches() const
+// [10] bsls::Types::Int64 numPublishedRecords() const
 // [ 1] bool isFileLoggingEnabled() const
 // [ 1] bool isStdoutLoggingPrefixEnabled() const
 // [ 1] void getLogFormat(const char**, const char**) const
@@ -111,7 +120,8 @@ using bsl::flush;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] CONCERN: CONCURRENT PUBLICATION
-// [10] USAGE EXAMPLE
+// [10] CONCERN: RECORDS ARE PUBLISHED IN BATCHES, IN ORDER
+// [12] USAGE EXAMPLE
 //
 //=============================================================================
 //                        STANDARD BDE ASSERT TEST MACROS
@@ -604,7 +614,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator allocator; bslma::TestAllocator *Z = &allocator;
 
     switch (test) { case 0:
-      case 10: {
+      case 12: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -663,6 +673,190 @@ int main(int argc, char *argv[])
         asyncFileObserver.stopPublicationThread();
         removeFilesByPrefix(fileName.c_str());
       } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // TESTING: 'setPublicationThreadCpuSet'
+        //
+        // Concerns:
+        //:  1 The publication thread started after
+        //:    'setPublicationThreadCpuSet' is restricted to the supplied CPU
+        //:    set and publishes records.
+        //:
+        //:  2 'startPublicationThread' fails if the publication thread cannot
+        //:    be restricted to the supplied CPU set.
+        //:
+        //:  3 An empty CPU set removes the restriction.
+        //
+        // Plan:
+        //:  1 Restrict the publication thread to the first CPU on which the
+        //:    test driver may run, start and stop the publication thread, and
+        //:    verify that a published record was written.  (C-1)
+        //:
+        //:  2 Restrict the publication thread to a CPU that does not exist,
+        //:    and verify that 'startPublicationThread' fails.  Then supply an
+        //:    empty CPU set, and verify that it succeeds.  (C-2..3)
+        //
+        // Testing:
+        //   void setPublicationThreadCpuSet(const bsl::vector<int>&);
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "Testing: 'setPublicationThreadCpuSet'" << endl
+                 << "=====================================" << endl;
+
+        bsl::vector<int> available;
+        if (0 != bslmt::ThreadUtil::getThreadCpuSet(
+                                               &available,
+                                               bslmt::ThreadUtil::self())) {
+            if (verbose) cout << "\tCPU affinity is not supported." << endl;
+            break;
+        }
+        ASSERT(!available.empty());
+
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+        Obj mX(ball::Severity::e_OFF, false, 1024, &ta);  const Obj& X = mX;
+
+        mX.setPublicationThreadCpuSet(bsl::vector<int>(1, available[0]));
+        ASSERT(0 == mX.startPublicationThread());
+        ASSERT(X.isPublicationThreadRunning());
+
+        bsl::shared_ptr<ball::Record> record;
+        record.createInplace(&ta);
+        record->fixedFields().setSeverity(ball::Severity::e_ERROR);
+        record->fixedFields().setMessage("pinned");
+
+        mX.publish(record,
+                   ball::Context(ball::Transmission::e_PASSTHROUGH, 0, 1));
+
+        ASSERT(0 == mX.stopPublicationThread());
+        ASSERT(1 == X.numPublishedRecords());
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+        mX.setPublicationThreadCpuSet(bsl::vector<int>(1, 1023));
+        ASSERT(0 != mX.startPublicationThread());
+        ASSERT(!X.isPublicationThreadRunning());
+#endif
+
+        mX.setPublicationThreadCpuSet(bsl::vector<int>());
+        ASSERT(0 == mX.startPublicationThread());
+        ASSERT(0 == mX.stopPublicationThread());
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING: BATCH PUBLICATION AND METRICS
+        //
+        // Concerns:
+        //:  1 The publication thread drains queued records in batches of at
+        //:    most 256 records.
+        //:
+        //:  2 Records are written to the log file in the order in which they
+        //:    were published.
+        //:
+        //:  3 The publication metrics are 0 for a new observer, and reflect
+        //:    the number of records and batches written, the size of the
+        //:    largest batch, and the largest queue length observed.
+        //
+        // Plan:
+        //:  1 Create an async file observer, verify the metrics are 0, and
+        //:    publish a number of records, each having a distinct message,
+        //:    before starting the publication thread.  Start and then stop the
+        //:    publication thread, verify the metrics, and verify that the log
+        //:    file contains the messages in order.  (C-1..3)
+        //
+        // Testing:
+        //   int maxRecordQueueLength() const;
+        //   int maxRecordsPerBatch() const;
+        //   bsls::Types::Int64 numPublishedBatches() const;
+        //   bsls::Types::Int64 numPublishedRecords() const;
+        //   CONCERN: RECORDS ARE PUBLISHED IN BATCHES, IN ORDER
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "Testing: Batch Publication And Metrics" << endl
+                 << "======================================" << endl;
+
+        enum { NUM_RECORDS = 600, MAX_BATCH_SIZE = 256 };
+
+        bsl::string fileName = tempFileName(veryVerbose);
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+        Obj mX(ball::Severity::e_OFF, false, 1024, &ta);  const Obj& X = mX;
+
+        ASSERT(0 == X.numPublishedBatches());
+        ASSERT(0 == X.numPublishedRecords());
+        ASSERT(0 == X.maxRecordsPerBatch());
+        ASSERT(0 == X.maxRecordQueueLength());
+
+        mX.setLogFormat("%m\n", "%m\n");
+        ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            bsl::ostringstream oss;
+            oss << "message " << i;
+
+            bsl::shared_ptr<ball::Record> record;
+            record.createInplace(&ta);
+            record->fixedFields().setSeverity(ball::Severity::e_ERROR);
+            record->fixedFields().setMessage(oss.str().c_str());
+
+            mX.publish(record,
+                       ball::Context(ball::Transmission::e_PASSTHROUGH, 0, 1));
+        }
+        ASSERT(NUM_RECORDS == X.recordQueueLength());
+
+        mX.startPublicationThread();
+        mX.stopPublicationThread();
+
+        if (veryVerbose) {
+            P_(X.numPublishedBatches()) P(X.numPublishedRecords())
+            P_(X.maxRecordsPerBatch())  P(X.maxRecordQueueLength())
+        }
+
+        ASSERT(0           == X.recordQueueLength());
+        ASSERT(NUM_RECORDS == X.numPublishedRecords());
+        const int NUM_BATCHES = (NUM_RECORDS + MAX_BATCH_SIZE - 1)
+                                                             / MAX_BATCH_SIZE;
+        ASSERTV(X.numPublishedBatches(),
+                NUM_BATCHES == X.numPublishedBatches());
+        ASSERTV(X.maxRecordsPerBatch(),
+                MAX_BATCH_SIZE == X.maxRecordsPerBatch());
+
+        // Note that the end-of-publication marker pushed by
+        // 'stopPublicationThread' may be queued before the first batch is
+        // dequeued.
+
+        ASSERTV(X.maxRecordQueueLength(),
+                NUM_RECORDS     <= X.maxRecordQueueLength());
+        ASSERTV(X.maxRecordQueueLength(),
+                NUM_RECORDS + 1 >= X.maxRecordQueueLength());
+
+        mX.disableFileLogging();
+
+        bsl::ifstream fs(fileName.c_str());
+        ASSERT(fs.is_open());
+
+        int         numLines = 0;
+        bsl::string line;
+        while (bsl::getline(fs, line)) {
+            if (line.empty()) {
+                continue;
+            }
+
+            bsl::ostringstream oss;
+            oss << "message " << numLines;
+
+            ASSERTV(numLines, line, oss.str() == line);
+            ++numLines;
+        }
+        fs.close();
+
+        ASSERTV(numLines, NUM_RECORDS == numLines);
+
+        removeFilesByPrefix(fileName.c_str());
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // TESTING: 'recordQueueLength'
@@ -18,6 +18,7 @@ BSLS_IDENT_RCSID(ball_defaultobserver_cpp,"$Id$ $CSID$")
 #include <bslstl_stringref.h>
 
 #include <bsl_ostream.h>
+#include <bsl_string.h>
 
 namespace BloombergLP {
 namespace ball {
@@ -61,8 +62,15 @@ void DefaultObserver::publish(const Record& record, const Context&)
               << fixedFields.lineNumber()              << ' '
               << fixedFields.category()                << ' ';
 
-    bslstl::StringRef message = fixedFields.messageRef();
-    d_stream->write(message.data(), message.length());
+    if (record.deferredMessage().hasFormat()) {
+        bsl::string message;
+        record.deferredMessage().render(&message);
+        d_stream->write(message.data(), message.length());
+    }
+    else {
+        bslstl::StringRef message = fixedFields.messageRef();
+        d_stream->write(message.data(), message.length());
+    }
 
     *d_stream << ' ';
 
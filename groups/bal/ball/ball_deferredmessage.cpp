@@ -0,0 +1,585 @@
+// ball_deferredmessage.cpp                                           -*-C++-*-
+#include <ball_deferredmessage.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_deferredmessage_cpp,"$Id$ $CSID$")
+
+#include <bslim_printer.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstdarg.h>
+#include <bsl_cstring.h>
+#include <bsl_ostream.h>
+
+#include <stdio.h>  // *NOT* <bsl_cstdio.h>, which does not declare 'vsnprintf'
+
+///IMPLEMENTATION NOTES
+///--------------------
+// 'render' walks the format string, copying ordinary characters to the result
+// and rewriting each conversion specification before passing it, with a
+// single argument, to 'vsnprintf'.  The flags, field width, and precision of
+// the specification are kept (a '*' width or precision being replaced by the
+// value of its argument), whereas its length modifier is replaced by one
+// matching the type in which the argument is passed: 'long long' (or
+// 'unsigned long long') for integral conversions, 'double' (or 'long double')
+// for floating-point conversions.  The integral value is first converted to
+// the type designated by the *original* length modifier, so that, e.g., "%hx"
+// renders only the low 16 bits of its argument, exactly as 'printf' would.
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+
+enum LengthModifier {
+    // Enumerate the length modifiers of a conversion specification that
+    // affect the rendering of an integral argument.
+
+    e_LENGTH_NONE,
+    e_LENGTH_HH,       // 'char'
+    e_LENGTH_H,        // 'short'
+    e_LENGTH_L,        // 'long'
+    e_LENGTH_LL,       // 'long long' (also 'q', 'j', and 'L')
+    e_LENGTH_Z,        // 'size_t'
+    e_LENGTH_T         // 'ptrdiff_t'
+};
+
+class ArgumentReader {
+    // This class provides a cursor over the encoded arguments of a
+    // 'DeferredMessage', checking that each argument lies within the encoded
+    // data.
+
+    // DATA
+    const char *d_cursor_p;  // next argument
+    const char *d_end_p;     // end of encoded data
+
+  public:
+    // CREATORS
+    ArgumentReader(const char *data, int numBytes)
+    : d_cursor_p(data)
+    , d_end_p(data + numBytes)
+        // Create a reader of the specified 'data' having the specified
+        // 'numBytes'.
+    {
+    }
+
+    // MANIPULATORS
+    int next(int *tag, const char **value)
+        // Load into the specified 'tag' the type tag of the next argument,
+        // and into the specified 'value' the address of its value bytes, and
+        // advance to the following argument.  Return 0 on success, and a
+        // non-zero value, with no effect, if there are no more arguments or
+        // if the next argument is malformed.
+    {
+        if (d_cursor_p >= d_end_p) {
+            return -1;                                                // RETURN
+        }
+
+        const int   argumentTag = static_cast<unsigned char>(*d_cursor_p);
+        const char *argument    = d_cursor_p + 1;
+        bsl::size_t numBytes    = 0;
+
+        switch (argumentTag) {
+          case DeferredMessage::e_SIGNED:
+          case DeferredMessage::e_UNSIGNED:
+          case DeferredMessage::e_POINTER: {
+            numBytes = sizeof(bsls::Types::Uint64);
+          } break;
+          case DeferredMessage::e_DOUBLE: {
+            numBytes = sizeof(double);
+          } break;
+          case DeferredMessage::e_LONG_DOUBLE: {
+            numBytes = sizeof(long double);
+          } break;
+          case DeferredMessage::e_STRING: {
+            const bsl::size_t addressSize = sizeof(bsls::Types::Uint64);
+            if (static_cast<bsl::size_t>(d_end_p - argument) < addressSize) {
+                return -1;                                            // RETURN
+            }
+            const char *text = argument + addressSize;
+            const void *nul  = bsl::memchr(text, 0, d_end_p - text);
+            if (!nul) {
+                return -1;                                            // RETURN
+            }
+            numBytes = static_cast<const char *>(nul) - argument + 1;
+          } break;
+          case DeferredMessage::e_NULL_STRING: {
+            numBytes = 0;
+          } break;
+          default: {
+            return -1;                                                // RETURN
+          }
+        }
+
+        if (static_cast<bsl::size_t>(d_end_p - argument) < numBytes) {
+            return -1;                                                // RETURN
+        }
+
+        *tag        = argumentTag;
+        *value      = argument;
+        d_cursor_p  = argument + numBytes;
+        return 0;
+    }
+
+    int nextInteger(bsls::Types::Uint64 *value, bool acceptStrings = false)
+        // Load into the specified 'value' the bits of the next argument, and
+        // advance to the following argument.  Optionally specify
+        // 'acceptStrings' to also accept a string argument, whose address is
+        // loaded.  Return 0 on success, and a non-zero value if there are no
+        // more arguments, or if the next argument is malformed or is not
+        // integral (or an address).
+    {
+        int         tag;
+        const char *bytes;
+        if (0 != next(&tag, &bytes)) {
+            return -1;                                                // RETURN
+        }
+        if (acceptStrings && DeferredMessage::e_NULL_STRING == tag) {
+            *value = 0;
+            return 0;                                                 // RETURN
+        }
+        if (DeferredMessage::e_SIGNED   != tag
+         && DeferredMessage::e_UNSIGNED != tag
+         && DeferredMessage::e_POINTER  != tag
+         && (!acceptStrings || DeferredMessage::e_STRING != tag)) {
+            return -1;                                                // RETURN
+        }
+        bsl::memcpy(value, bytes, sizeof *value);
+        return 0;
+    }
+};
+
+bsls::Types::Int64 toSigned(bsls::Types::Uint64 bits, LengthModifier length)
+    // Return the value of the specified 'bits' converted to the signed type
+    // designated by the specified 'length' modifier, then widened to
+    // 'bsls::Types::Int64'.
+{
+    switch (length) {
+      case e_LENGTH_HH: return static_cast<signed char>(bits);        // RETURN
+      case e_LENGTH_H:  return static_cast<short>(bits);              // RETURN
+      case e_LENGTH_NONE: return static_cast<int>(bits);              // RETURN
+      case e_LENGTH_L:  return static_cast<long>(bits);               // RETURN
+      case e_LENGTH_T:  return static_cast<bsl::ptrdiff_t>(bits);     // RETURN
+      case e_LENGTH_Z:
+      case e_LENGTH_LL: break;
+    }
+    return static_cast<bsls::Types::Int64>(bits);
+}
+
+bsls::Types::Uint64 toUnsigned(bsls::Types::Uint64 bits,
+                               LengthModifier      length)
+    // Return the value of the specified 'bits' converted to the unsigned type
+    // designated by the specified 'length' modifier, then widened to
+    // 'bsls::Types::Uint64'.
+{
+    switch (length) {
+      case e_LENGTH_HH: return static_cast<unsigned char>(bits);      // RETURN
+      case e_LENGTH_H:  return static_cast<unsigned short>(bits);     // RETURN
+      case e_LENGTH_NONE: return static_cast<unsigned int>(bits);     // RETURN
+      case e_LENGTH_L:  return static_cast<unsigned long>(bits);      // RETURN
+      case e_LENGTH_Z:  return static_cast<bsl::size_t>(bits);        // RETURN
+      case e_LENGTH_T:
+      case e_LENGTH_LL: break;
+    }
+    return bits;
+}
+
+void appendFormatted(bsl::string *result, const char *format, ...)
+    // Append to the specified 'result' the text produced by 'vsnprintf' for
+    // the specified 'format' and the subsequent arguments.
+{
+    char buffer[256];
+
+    bsl::va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buffer, sizeof buffer, format, args);
+    va_end(args);
+
+    if (0 <= length && length < static_cast<int>(sizeof buffer)) {
+        result->append(buffer, length);
+        return;                                                       // RETURN
+    }
+
+    // The output was truncated.  Most implementations of 'vsnprintf' return
+    // the length of the complete output, but a few older ones return -1, in
+    // which case the buffer is grown until the output fits.
+
+    bsl::vector<char> largeBuffer(result->get_allocator());
+    bsl::size_t       size = 0 <= length ? length + 1 : 2 * sizeof buffer;
+    for (;;) {
+        largeBuffer.resize(size);
+
+        va_start(args, format);
+        length = vsnprintf(&largeBuffer[0], size, format, args);
+        va_end(args);
+
+        if (0 <= length && static_cast<bsl::size_t>(length) < size) {
+            result->append(&largeBuffer[0], length);
+            return;                                                   // RETURN
+        }
+        size = 0 <= length ? length + 1 : 2 * size;
+    }
+}
+
+}  // close unnamed namespace
+
+                           // ---------------------
+                           // class DeferredMessage
+                           // ---------------------
+
+// PRIVATE MANIPULATORS
+void DeferredMessage::appendTagAndValue(ArgumentType  tag,
+                                        const void   *value,
+                                        bsl::size_t   numBytes)
+{
+    const bsl::size_t offset = d_arguments.size();
+    d_arguments.resize(offset + 1 + numBytes);
+    d_arguments[offset] = static_cast<char>(tag);
+    if (numBytes) {
+        bsl::memcpy(&d_arguments[offset + 1], value, numBytes);
+    }
+}
+
+// MANIPULATORS
+void DeferredMessage::appendArgument(const char *value)
+{
+    if (value) {
+        const bsls::Types::Uint64 address =
+                                 reinterpret_cast<bsls::Types::UintPtr>(value);
+        const bsl::size_t         length  = bsl::strlen(value) + 1;
+
+        appendTagAndValue(e_STRING, &address, sizeof address);
+        d_arguments.insert(d_arguments.end(), value, value + length);
+    }
+    else {
+        appendTagAndValue(e_NULL_STRING, 0, 0);
+    }
+}
+
+// ACCESSORS
+int DeferredMessage::render(bsl::string *result) const
+{
+    BSLS_ASSERT(result);
+
+    if (!d_format_p) {
+        return 0;                                                     // RETURN
+    }
+
+    ArgumentReader reader(argumentData(), argumentDataLength());
+    int            status = 0;
+    const char    *p      = d_format_p;
+
+    // Rewritten conversion specifications are at most 'k_MAX_SPEC_LENGTH'
+    // characters long; longer ones are copied verbatim.
+
+    enum { k_MAX_SPEC_LENGTH = 48 };
+
+    while (*p) {
+        if ('%' != *p) {
+            const char *end = p;
+            while (*end && '%' != *end) {
+                ++end;
+            }
+            result->append(p, end);
+            p = end;
+            continue;
+        }
+
+        const char *specBegin = p++;
+        if ('%' == *p) {
+            result->push_back('%');
+            ++p;
+            continue;
+        }
+
+        char spec[k_MAX_SPEC_LENGTH + 16];
+        int  specLength = 0;
+        bool isValid    = true;
+
+        spec[specLength++] = '%';
+
+        // Flags.
+
+        while (*p && bsl::strchr("-+ #0", *p)) {
+            if (specLength < k_MAX_SPEC_LENGTH) {
+                spec[specLength++] = *p;
+            }
+            else {
+                isValid = false;
+            }
+            ++p;
+        }
+
+        // Field width and precision.
+
+        for (int part = 0; part < 2; ++part) {
+            if (1 == part) {
+                if ('.' != *p) {
+                    break;
+                }
+                ++p;
+            }
+
+            if ('*' == *p) {
+                ++p;
+                bsls::Types::Uint64 bits;
+                if (0 != reader.nextInteger(&bits)) {
+                    isValid = false;
+                    continue;
+                }
+                const int value = static_cast<int>(bits);
+
+                // A negative precision is taken as if the precision were
+                // omitted.
+
+                if (1 == part && value < 0) {
+                    continue;
+                }
+                if (specLength < k_MAX_SPEC_LENGTH) {
+                    specLength += snprintf(spec + specLength,
+                                           sizeof spec - specLength,
+                                           1 == part ? ".%d" : "%d",
+                                           value);
+                }
+                else {
+                    isValid = false;
+                }
+                continue;
+            }
+
+            if (1 == part) {
+                if (specLength < k_MAX_SPEC_LENGTH) {
+                    spec[specLength++] = '.';
+                }
+                else {
+                    isValid = false;
+                }
+            }
+            while ('0' <= *p && *p <= '9') {
+                if (specLength < k_MAX_SPEC_LENGTH) {
+                    spec[specLength++] = *p;
+                }
+                else {
+                    isValid = false;
+                }
+                ++p;
+            }
+        }
+
+        // Length modifier.
+
+        LengthModifier length = e_LENGTH_NONE;
+        switch (*p) {
+          case 'h': {
+            ++p;
+            length = 'h' == *p ? (++p, e_LENGTH_HH) : e_LENGTH_H;
+          } break;
+          case 'l': {
+            ++p;
+            length = 'l' == *p ? (++p, e_LENGTH_LL) : e_LENGTH_L;
+          } break;
+          case 'q':
+          case 'j':
+          case 'L': {
+            ++p;
+            length = e_LENGTH_LL;
+          } break;
+          case 'z': {
+            ++p;
+            length = e_LENGTH_Z;
+          } break;
+          case 't': {
+            ++p;
+            length = e_LENGTH_T;
+          } break;
+        }
+
+        // Conversion.
+
+        const char conversion = *p;
+        if (conversion) {
+            ++p;
+        }
+
+        if (isValid) {
+            int         tag;
+            const char *bytes;
+
+            switch (conversion) {
+              case 'd':
+              case 'i': {
+                bsls::Types::Uint64 bits;
+                if (0 != reader.nextInteger(&bits)) {
+                    isValid = false;
+                    break;
+                }
+                bsl::strcpy(spec + specLength, "lld");
+                appendFormatted(result,
+                                spec,
+                                static_cast<long long>(
+                                                     toSigned(bits, length)));
+              } break;
+              case 'u':
+              case 'o':
+              case 'x':
+              case 'X': {
+                bsls::Types::Uint64 bits;
+                if (0 != reader.nextInteger(&bits)) {
+                    isValid = false;
+                    break;
+                }
+                spec[specLength++] = 'l';
+                spec[specLength++] = 'l';
+                spec[specLength++] = conversion;
+                spec[specLength]   = 0;
+                appendFormatted(result,
+                                spec,
+                                static_cast<unsigned long long>(
+                                                   toUnsigned(bits, length)));
+              } break;
+              case 'c': {
+                bsls::Types::Uint64 bits;
+                if (0 != reader.nextInteger(&bits)) {
+                    isValid = false;
+                    break;
+                }
+                bsl::strcpy(spec + specLength, "c");
+                appendFormatted(result,
+                                spec,
+                                static_cast<int>(
+                                            static_cast<unsigned char>(bits)));
+              } break;
+              case 'e':
+              case 'E':
+              case 'f':
+              case 'F':
+              case 'g':
+              case 'G':
+              case 'a':
+              case 'A': {
+                if (0 != reader.next(&tag, &bytes)) {
+                    isValid = false;
+                    break;
+                }
+                if (e_DOUBLE == tag) {
+                    double value;
+                    bsl::memcpy(&value, bytes, sizeof value);
+                    spec[specLength++] = conversion;
+                    spec[specLength]   = 0;
+                    appendFormatted(result, spec, value);
+                }
+                else if (e_LONG_DOUBLE == tag) {
+                    long double value;
+                    bsl::memcpy(&value, bytes, sizeof value);
+                    spec[specLength++] = 'L';
+                    spec[specLength++] = conversion;
+                    spec[specLength]   = 0;
+                    appendFormatted(result, spec, value);
+                }
+                else {
+                    isValid = false;
+                }
+              } break;
+              case 's': {
+                if (0 != reader.next(&tag, &bytes)) {
+                    isValid = false;
+                    break;
+                }
+                if (e_STRING != tag && e_NULL_STRING != tag) {
+                    isValid = false;
+                    break;
+                }
+                bsl::strcpy(spec + specLength, "s");
+                appendFormatted(result,
+                                spec,
+                                e_STRING == tag
+                                ? bytes + sizeof(bsls::Types::Uint64)
+                                : "(null)");
+              } break;
+              case 'p': {
+                bsls::Types::Uint64 bits;
+                if (0 != reader.nextInteger(&bits, true)) {
+                    isValid = false;
+                    break;
+                }
+                bsl::strcpy(spec + specLength, "p");
+                appendFormatted(result,
+                                spec,
+                                reinterpret_cast<void *>(
+                                     static_cast<bsls::Types::UintPtr>(bits)));
+              } break;
+              case 'n': {
+                if (0 != reader.next(&tag, &bytes)) {
+                    isValid = false;
+                }
+              } break;
+              default: {
+                isValid = false;
+              } break;
+            }
+        }
+
+        if (!isValid) {
+            result->append(specBegin, p);
+            status = -1;
+        }
+    }
+
+    return status;
+}
+
+bsl::ostream& DeferredMessage::print(bsl::ostream& stream,
+                                     int           level,
+                                     int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;                                                // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    if (d_format_p) {
+        bsl::string text(d_arguments.get_allocator());
+        render(&text);
+
+        printer.printAttribute("format", d_format_p);
+        printer.printAttribute("text", text);
+    }
+    else {
+        printer.printAttribute("format", "NULL");
+    }
+    printer.end();
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+bool ball::operator==(const DeferredMessage& lhs, const DeferredMessage& rhs)
+{
+    if (!lhs.d_format_p || !rhs.d_format_p) {
+        return lhs.d_format_p == rhs.d_format_p;                      // RETURN
+    }
+    return (lhs.d_format_p == rhs.d_format_p
+            || 0 == bsl::strcmp(lhs.d_format_p, rhs.d_format_p))
+        && lhs.d_arguments == rhs.d_arguments;
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
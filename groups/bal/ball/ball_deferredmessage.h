@@ -0,0 +1,516 @@
+// ball_deferredmessage.h                                             -*-C++-*-
+#ifndef INCLUDED_BALL_DEFERREDMESSAGE
+#define INCLUDED_BALL_DEFERREDMESSAGE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a 'printf'-style format and its arguments for later use.
+//
+//@CLASSES:
+//  ball::DeferredMessage: a captured 'printf'-style format and arguments
+//
+//@SEE_ALSO: ball_record, ball_log, ball_recordstringformatter
+//
+//@DESCRIPTION: This component provides a value-semantic class,
+// 'ball::DeferredMessage', that captures a 'printf'-style format string and
+// the values of its arguments, so that the text of a log message can be
+// rendered after (and on a different thread than) the logging call that
+// supplied it.  The arguments are held in a compact binary encoding, each
+// argument consisting of a one-byte type tag followed by the bytes of its
+// value: integral arguments are widened to 64 bits, floating-point arguments
+// are held as 'double' (or 'long double'), pointers are held as 64-bit
+// integers, and strings are copied (including their null terminator) along
+// with their address, so that a 'char' pointer may be rendered by either a
+// "%s" or a "%p" conversion.
+//
+// The format string itself is *not* copied: the address supplied to
+// 'setFormat' is held, and serves as an identifier of the format.  The format
+// string must therefore remain valid, and unchanged, for as long as the
+// deferred message (and any copy of it) may be rendered.  String literals, as
+// typically supplied to the 'printf'-style logging macros, satisfy this
+// requirement.
+//
+///Rendering
+///---------
+// The 'render' method appends to a string the text that 'snprintf' would
+// produce for the captured format and arguments.  Each conversion
+// specification of the format consumes the next captured argument (or two or
+// three arguments if its field width or precision is given by '*'), and the
+// length modifiers of the specification (e.g., 'l' or 'hh') determine, as for
+// 'printf', the type to which integral arguments are converted before they
+// are rendered.  So, for example, a captured 'int' having the value -1
+// renders as "4294967295" when matched by a "%u" conversion.  Unlike
+// 'printf', however, a conversion whose argument is missing or is of an
+// incompatible kind (e.g., a "%s" conversion matching an integer) does not
+// have undefined behavior: the conversion specification is copied to the
+// result verbatim, and 'render' returns a non-zero value.  The '%n'
+// conversion consumes its argument and writes nothing.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Capturing and Rendering a Message
+/// - - - - - - - - - - - - - - - - - - - - - -
+// First, we capture a format and its arguments, as a logging macro does when
+// deferred formatting is enabled:
+//..
+//  ball::DeferredMessage message;
+//  message.setFormat("order %d for %s filled at %.2f");
+//  message.appendArgument(42);
+//  message.appendArgument("IBM");
+//  message.appendArgument(123.456);
+//..
+// Notice that the string argument is copied, so the buffer that held it may
+// be reused once 'appendArgument' returns.
+//
+// Then, at some later time and possibly on another thread, we render the text
+// of the message:
+//..
+//  bsl::string text;
+//  int rc = message.render(&text);
+//
+//  assert(0 == rc);
+//  assert("order 42 for IBM filled at 123.46" == text);
+//..
+
+#ifndef INCLUDED_BALSCM_VERSION
+#include <balscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_IOSFWD
+#include <bsl_iosfwd.h>
+#endif
+
+#ifndef INCLUDED_BSL_STRING
+#include <bsl_string.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+namespace BloombergLP {
+namespace ball {
+
+                           // =====================
+                           // class DeferredMessage
+                           // =====================
+
+class DeferredMessage {
+    // This class implements a value-semantic type holding the address of a
+    // 'printf'-style format string and a compact binary encoding of the
+    // values of its arguments.  A default-constructed object holds no format,
+    // in which case 'hasFormat' returns 'false'.
+
+  public:
+    // TYPES
+    enum ArgumentType {
+        // Enumerate the type tags preceding each argument in the encoded
+        // argument data.
+
+        e_SIGNED      = 1,  // 'bsls::Types::Int64'
+        e_UNSIGNED    = 2,  // 'bsls::Types::Uint64'
+        e_DOUBLE      = 3,  // 'double'
+        e_LONG_DOUBLE = 4,  // 'long double'
+        e_STRING      = 5,  // 'bsls::Types::Uint64' holding an address,
+                            // followed by a null-terminated sequence of
+                            // 'char'
+        e_NULL_STRING = 6,  // null string pointer (no value bytes)
+        e_POINTER     = 7   // 'bsls::Types::Uint64' holding an address
+    };
+
+  private:
+    // DATA
+    const char        *d_format_p;   // format string (held, not owned), or 0
+
+    bsl::vector<char>  d_arguments;  // encoded arguments
+
+    // FRIENDS
+    friend bool operator==(const DeferredMessage&, const DeferredMessage&);
+
+    // PRIVATE MANIPULATORS
+    void appendTagAndValue(ArgumentType  tag,
+                           const void   *value,
+                           bsl::size_t   numBytes);
+        // Append to the encoded arguments of this object the specified 'tag'
+        // followed by the specified 'numBytes' bytes at the specified
+        // 'value' address.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(DeferredMessage,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit DeferredMessage(bslma::Allocator *basicAllocator = 0);
+        // Create a 'DeferredMessage' object holding no format and no
+        // arguments.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    DeferredMessage(const DeferredMessage&  original,
+                    bslma::Allocator       *basicAllocator = 0);
+        // Create a 'DeferredMessage' object having the same value as the
+        // specified 'original' object.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
+    //! ~DeferredMessage() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    DeferredMessage& operator=(const DeferredMessage& rhs);
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+
+    void reset();
+        // Reset this object to hold no format and no arguments.
+
+    void setFormat(const char *format);
+        // Set the format of this object to the specified 'format' and remove
+        // all arguments from this object.  The behavior is undefined unless
+        // 'format' is null-terminated and remains valid, and unchanged, for as
+        // long as this object (or any copy of it) holds it.
+
+    void appendArgument(int                value);
+    void appendArgument(long               value);
+    void appendArgument(long long          value);
+        // Append the specified signed integral 'value' to the arguments of
+        // this object.  Note that arguments of type 'char', 'short', 'bool',
+        // and of unscoped enumeration types, are promoted to 'int'.
+
+    void appendArgument(unsigned int       value);
+    void appendArgument(unsigned long      value);
+    void appendArgument(unsigned long long value);
+        // Append the specified unsigned integral 'value' to the arguments of
+        // this object.
+
+    void appendArgument(double             value);
+    void appendArgument(long double        value);
+        // Append the specified floating-point 'value' to the arguments of
+        // this object.  Note that arguments of type 'float' are promoted to
+        // 'double'.
+
+    void appendArgument(const char        *value);
+        // Append a copy of the specified null-terminated string 'value', and
+        // its address, or a null string if 'value' is 0, to the arguments of
+        // this object.
+
+    void appendArgument(const void        *value);
+        // Append the specified address 'value' to the arguments of this
+        // object.
+
+    void setArgumentData(const char *data, int numBytes);
+        // Set the encoded arguments of this object to the specified 'data'
+        // having the specified 'numBytes', as returned by 'argumentData' and
+        // 'argumentDataLength' (possibly of an object in another process).
+        // The behavior is undefined unless '0 <= numBytes'.  Note that
+        // 'render' tolerates malformed argument data.
+
+                                  // Aspects
+
+    void swap(DeferredMessage& other);
+        // Efficiently exchange the value of this object with the value of the
+        // specified 'other' object.  This method provides the no-throw
+        // exception guarantee if 'allocator()' is the same as
+        // 'other.allocator()', and the basic exception guarantee otherwise.
+
+    // ACCESSORS
+    bool hasFormat() const;
+        // Return 'true' if this object holds a format, and 'false' otherwise.
+
+    const char *format() const;
+        // Return the address of the format held by this object, or 0 if this
+        // object holds no format.
+
+    const char *argumentData() const;
+        // Return the address of the encoded arguments of this object.  The
+        // returned address may be 0 if 'argumentDataLength()' is 0.
+
+    int argumentDataLength() const;
+        // Return the number of bytes of the encoded arguments of this object.
+
+    int render(bsl::string *result) const;
+        // Append to the specified 'result' the text produced by formatting
+        // the arguments of this object according to its format, as described
+        // in {Rendering}.  Return 0 on success, and a non-zero value if a
+        // conversion of the format has a missing or incompatible argument, or
+        // if the argument data is malformed (in which case the text for the
+        // remaining conversions is appended verbatim).  This method has no
+        // effect, and returns 0, if this object holds no format.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level = 0,
+                        int           spacesPerLevel = 4) const;
+        // Write the value of this object to the specified output 'stream' in
+        // a human-readable format, and return a reference to 'stream'.
+        // Optionally specify an initial indentation 'level', whose absolute
+        // value is incremented recursively for nested objects.  If 'level' is
+        // specified, optionally specify 'spacesPerLevel', whose absolute
+        // value indicates the number of spaces per indentation level for this
+        // and all of its nested objects.  If 'level' is negative, suppress
+        // indentation of the first line.  If 'spacesPerLevel' is negative,
+        // format the entire output on one line, suppressing all but the
+        // initial indentation (as governed by 'level').  If 'stream' is not
+        // valid on entry, this operation has no effect.  Note that the format
+        // is not fully specified, and can change without notice.
+};
+
+// FREE OPERATORS
+bool operator==(const DeferredMessage& lhs, const DeferredMessage& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'DeferredMessage' objects have the
+    // same value if neither holds a format, or if both hold format strings
+    // having the same characters and both have the same encoded arguments.
+    // Note that the encoding of a string argument includes its address.
+
+bool operator!=(const DeferredMessage& lhs, const DeferredMessage& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'DeferredMessage' objects do
+    // not have the same value if only one holds a format, if they hold format
+    // strings having different characters, or if they have different encoded
+    // arguments.
+
+bsl::ostream& operator<<(bsl::ostream& stream, const DeferredMessage& object);
+    // Write the value of the specified 'object' to the specified output
+    // 'stream' in a single-line format, and return a reference to 'stream'.
+    // If 'stream' is not valid on entry, this operation has no effect.  Note
+    // that this human-readable format is not fully specified, can change
+    // without notice, and is logically equivalent to:
+    //..
+    //  print(stream, 0, -1);
+    //..
+
+// FREE FUNCTIONS
+void swap(DeferredMessage& a, DeferredMessage& b);
+    // Swap the value of the specified 'a' object with the value of the
+    // specified 'b' object.  This method provides the no-throw exception
+    // guarantee if 'a.allocator()' is the same as 'b.allocator()', and the
+    // basic exception guarantee otherwise.
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // class DeferredMessage
+                           // ---------------------
+
+// CREATORS
+inline
+DeferredMessage::DeferredMessage(bslma::Allocator *basicAllocator)
+: d_format_p(0)
+, d_arguments(basicAllocator)
+{
+}
+
+inline
+DeferredMessage::DeferredMessage(const DeferredMessage&  original,
+                                 bslma::Allocator       *basicAllocator)
+: d_format_p(original.d_format_p)
+, d_arguments(original.d_arguments, basicAllocator)
+{
+}
+
+// MANIPULATORS
+inline
+DeferredMessage& DeferredMessage::operator=(const DeferredMessage& rhs)
+{
+    d_format_p  = rhs.d_format_p;
+    d_arguments = rhs.d_arguments;
+    return *this;
+}
+
+inline
+void DeferredMessage::reset()
+{
+    d_format_p = 0;
+    d_arguments.clear();
+}
+
+inline
+void DeferredMessage::setFormat(const char *format)
+{
+    d_format_p = format;
+    d_arguments.clear();
+}
+
+inline
+void DeferredMessage::appendArgument(int value)
+{
+    const bsls::Types::Int64 widened = value;
+    appendTagAndValue(e_SIGNED, &widened, sizeof widened);
+}
+
+inline
+void DeferredMessage::appendArgument(long value)
+{
+    const bsls::Types::Int64 widened = value;
+    appendTagAndValue(e_SIGNED, &widened, sizeof widened);
+}
+
+inline
+void DeferredMessage::appendArgument(long long value)
+{
+    const bsls::Types::Int64 widened = value;
+    appendTagAndValue(e_SIGNED, &widened, sizeof widened);
+}
+
+inline
+void DeferredMessage::appendArgument(unsigned int value)
+{
+    const bsls::Types::Uint64 widened = value;
+    appendTagAndValue(e_UNSIGNED, &widened, sizeof widened);
+}
+
+inline
+void DeferredMessage::appendArgument(unsigned long value)
+{
+    const bsls::Types::Uint64 widened = value;
+    appendTagAndValue(e_UNSIGNED, &widened, sizeof widened);
+}
+
+inline
+void DeferredMessage::appendArgument(unsigned long long value)
+{
+    const bsls::Types::Uint64 widened = value;
+    appendTagAndValue(e_UNSIGNED, &widened, sizeof widened);
+}
+
+inline
+void DeferredMessage::appendArgument(double value)
+{
+    appendTagAndValue(e_DOUBLE, &value, sizeof value);
+}
+
+inline
+void DeferredMessage::appendArgument(long double value)
+{
+    appendTagAndValue(e_LONG_DOUBLE, &value, sizeof value);
+}
+
+inline
+void DeferredMessage::appendArgument(const void *value)
+{
+    const bsls::Types::Uint64 address =
+                                 reinterpret_cast<bsls::Types::UintPtr>(value);
+    appendTagAndValue(e_POINTER, &address, sizeof address);
+}
+
+inline
+void DeferredMessage::setArgumentData(const char *data, int numBytes)
+{
+    d_arguments.assign(data, data + numBytes);
+}
+
+inline
+void DeferredMessage::swap(DeferredMessage& other)
+{
+    const char *format = d_format_p;
+    d_format_p         = other.d_format_p;
+    other.d_format_p   = format;
+    d_arguments.swap(other.d_arguments);
+}
+
+// ACCESSORS
+inline
+bool DeferredMessage::hasFormat() const
+{
+    return 0 != d_format_p;
+}
+
+inline
+const char *DeferredMessage::format() const
+{
+    return d_format_p;
+}
+
+inline
+const char *DeferredMessage::argumentData() const
+{
+    return d_arguments.empty() ? 0 : &d_arguments[0];
+}
+
+inline
+int DeferredMessage::argumentDataLength() const
+{
+    return static_cast<int>(d_arguments.size());
+}
+
+inline
+bslma::Allocator *DeferredMessage::allocator() const
+{
+    return d_arguments.get_allocator().mechanism();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool ball::operator!=(const DeferredMessage& lhs, const DeferredMessage& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline
+bsl::ostream& ball::operator<<(bsl::ostream&          stream,
+                               const DeferredMessage& object)
+{
+    return object.print(stream, 0, -1);
+}
+
+// FREE FUNCTIONS
+inline
+void ball::swap(DeferredMessage& a, DeferredMessage& b)
+{
+    a.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,937 @@
+// ball_deferredmessage.t.cpp                                         -*-C++-*-
+#include <ball_deferredmessage.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_types.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstdarg.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+#include <stdio.h>  // 'snprintf'
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                   TEST PLAN
+// ----------------------------------------------------------------------------
+//                                   Overview
+//                                   --------
+// The component under test implements a value-semantic type holding the
+// address of a 'printf'-style format and an encoding of its arguments.  We
+// first establish the basic value-semantic behavior, then verify that
+// 'render' produces the same text as 'snprintf' for a table of formats and
+// arguments, and finally verify that mismatched arguments and malformed
+// argument data are rendered verbatim and reported.
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+//: o No memory is ever allocated from the default allocator.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit DeferredMessage(bslma::Allocator *basicAllocator = 0);
+// [ 2] DeferredMessage(const DeferredMessage& original, *ba = 0);
+//
+// MANIPULATORS
+// [ 2] DeferredMessage& operator=(const DeferredMessage& rhs);
+// [ 2] void reset();
+// [ 2] void setFormat(const char *format);
+// [ 3] void appendArgument(int value);
+// [ 3] void appendArgument(long value);
+// [ 3] void appendArgument(long long value);
+// [ 3] void appendArgument(unsigned int value);
+// [ 3] void appendArgument(unsigned long value);
+// [ 3] void appendArgument(unsigned long long value);
+// [ 3] void appendArgument(double value);
+// [ 3] void appendArgument(long double value);
+// [ 3] void appendArgument(const char *value);
+// [ 3] void appendArgument(const void *value);
+// [ 4] void setArgumentData(const char *data, int numBytes);
+// [ 2] void swap(DeferredMessage& other);
+//
+// ACCESSORS
+// [ 2] bool hasFormat() const;
+// [ 2] const char *format() const;
+// [ 2] const char *argumentData() const;
+// [ 2] int argumentDataLength() const;
+// [ 3] int render(bsl::string *result) const;
+// [ 2] bslma::Allocator *allocator() const;
+// [ 5] ostream& print(ostream& s, int level = 0, int sPL = 4) const;
+//
+// FREE OPERATORS
+// [ 2] bool operator==(const DeferredMessage&, const DeferredMessage&);
+// [ 2] bool operator!=(const DeferredMessage&, const DeferredMessage&);
+// [ 5] ostream& operator<<(ostream&, const DeferredMessage&);
+//
+// FREE FUNCTIONS
+// [ 2] void swap(DeferredMessage& a, DeferredMessage& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] MISMATCHED ARGUMENTS AND MALFORMED DATA
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::DeferredMessage Obj;
+
+// ============================================================================
+//                                 TYPE TRAITS
+// ----------------------------------------------------------------------------
+
+BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+
+// ============================================================================
+//                      HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bsl::string expected(const char *format, ...)
+    // Return the text produced by 'vsnprintf' for the specified 'format' and
+    // the subsequent arguments.
+{
+    char buffer[1024];
+
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof buffer, format, args);
+    va_end(args);
+
+    return buffer;
+}
+
+static bsl::string rendered(const Obj& message, int *status = 0)
+    // Return the text rendered by the specified 'message'.  Optionally
+    // specify 'status' in which to load the value returned by 'render'.
+{
+    bsl::string result;
+    int         rc = message.render(&result);
+    if (status) {
+        *status = rc;
+    }
+    return result;
+}
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator         ta("usage", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard guard(&ta);
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Capturing and Rendering a Message
+/// - - - - - - - - - - - - - - - - - - - - - -
+// First, we capture a format and its arguments, as a logging macro does when
+// deferred formatting is enabled:
+//..
+    ball::DeferredMessage message;
+    message.setFormat("order %d for %s filled at %.2f");
+    message.appendArgument(42);
+    message.appendArgument("IBM");
+    message.appendArgument(123.456);
+//..
+// Notice that the string argument is copied, so the buffer that held it may
+// be reused once 'appendArgument' returns.
+//
+// Then, at some later time and possibly on another thread, we render the text
+// of the message:
+//..
+    bsl::string text;
+    int rc = message.render(&text);
+//
+    ASSERT(0 == rc);
+    ASSERT("order 42 for IBM filled at 123.46" == text);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // PRINT AND OUTPUT OPERATOR
+        //
+        // Concerns:
+        //: 1 'print' and 'operator<<' write the format and the rendered text
+        //:   of an object holding a format, and indicate the absence of a
+        //:   format otherwise.
+        //:
+        //: 2 'print' honors 'level' and 'spacesPerLevel'.
+        //
+        // Plan:
+        //: 1 Print objects with and without a format, on a single line and
+        //:   on multiple lines, and compare with the expected output.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   ostream& print(ostream& s, int level = 0, int sPL = 4) const;
+        //   ostream& operator<<(ostream&, const DeferredMessage&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRINT AND OUTPUT OPERATOR" << endl
+                          << "=========================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        Obj mX(&ta);  const Obj& X = mX;
+        {
+            bsl::ostringstream os(&ta);
+            os << X;
+            ASSERTV(os.str(), "[ format = \"NULL\" ]" == os.str());
+        }
+
+        mX.setFormat("x=%d");
+        mX.appendArgument(7);
+        {
+            bsl::ostringstream os(&ta);
+            os << X;
+            ASSERTV(os.str(),
+                    "[ format = \"x=%d\" text = \"x=7\" ]" == os.str());
+        }
+        {
+            bsl::ostringstream os(&ta);
+            X.print(os, 1, 2);
+            ASSERTV(os.str(),
+                    "  [\n    format = \"x=%d\"\n    text = \"x=7\"\n  ]\n"
+                                                                  == os.str());
+        }
+        {
+            bsl::ostringstream os(&ta);
+            os.setstate(bsl::ios::badbit);
+            X.print(os);
+            ASSERT(os.str().empty());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // MISMATCHED ARGUMENTS AND MALFORMED DATA
+        //
+        // Concerns:
+        //: 1 A conversion having no argument, or an argument of an
+        //:   incompatible kind, is copied verbatim and 'render' returns a
+        //:   non-zero value; the remaining conversions are still rendered.
+        //:
+        //: 2 An unknown conversion, or a '%' ending the format, is copied
+        //:   verbatim and reported.
+        //:
+        //: 3 Truncated or corrupted argument data (including an unterminated
+        //:   string and an unknown type tag) never causes a read beyond the
+        //:   data, and is reported.
+        //:
+        //: 4 'setArgumentData' installs the encoded arguments of another
+        //:   object, so that both render the same text.
+        //
+        // Plan:
+        //: 1 Render formats having missing and incompatible arguments and
+        //:   verify the text and status.  (C-1..2)
+        //:
+        //: 2 For every proper prefix of the encoded arguments of a message,
+        //:   install the prefix with 'setArgumentData' into a buffer exactly
+        //:   the size of the prefix and verify that rendering fails without
+        //:   error.  Then corrupt the type tag and verify the status.
+        //:   (C-3..4)
+        //
+        // Testing:
+        //   void setArgumentData(const char *data, int numBytes);
+        //   MISMATCHED ARGUMENTS AND MALFORMED DATA
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MISMATCHED ARGUMENTS AND MALFORMED DATA" << endl
+                          << "=======================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tMissing and incompatible arguments." << endl;
+        {
+            int status;
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            mX.setFormat("a=%d b=%s c=%5.2f");
+            mX.appendArgument(1);
+            mX.appendArgument(2);
+            ASSERTV(rendered(X),
+                    "a=1 b=%s c=%5.2f" == rendered(X, &status));
+            ASSERT(0 != status);
+
+            mX.setFormat("%s %f %d %p");
+            mX.appendArgument(1.5);
+            mX.appendArgument("x");
+            mX.appendArgument(3.0);
+            mX.appendArgument(4.0);
+            ASSERTV(rendered(X), "%s %f %d %p" == rendered(X, &status));
+            ASSERT(0 != status);
+
+            mX.setFormat("%*d|");
+            mX.appendArgument("w");
+            mX.appendArgument(3);
+            ASSERTV(rendered(X), "%*d|" == rendered(X, &status));
+            ASSERT(0 != status);
+
+            mX.setFormat("%y and %");
+            ASSERTV(rendered(X), "%y and %" == rendered(X, &status));
+            ASSERT(0 != status);
+
+            mX.setFormat("100%% done");
+            ASSERTV(rendered(X), "100% done" == rendered(X, &status));
+            ASSERT(0 == status);
+
+            // Extra arguments are ignored, as by 'printf'.
+
+            mX.setFormat("%d");
+            mX.appendArgument(1);
+            mX.appendArgument(2);
+            ASSERTV(rendered(X), "1" == rendered(X, &status));
+            ASSERT(0 == status);
+        }
+
+        if (verbose) cout << "\tTruncated and corrupted data." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            mX.setFormat("%d %s %Lf %f %p %s");
+            mX.appendArgument(-5);
+            mX.appendArgument("abc");
+            mX.appendArgument(1.5L);
+            mX.appendArgument(2.5);
+            mX.appendArgument(static_cast<const void *>(0));
+            mX.appendArgument(static_cast<const char *>(0));
+
+            int status;
+            const bsl::string FULL = rendered(X, &status);
+            ASSERT(0 == status);
+
+            const int LENGTH = X.argumentDataLength();
+
+            for (int i = 0; i <= LENGTH; ++i) {
+                // Copy into an exactly-sized allocation so that any read past
+                // the end is detectable by memory checkers.
+
+                char *data = static_cast<char *>(ta.allocate(i ? i : 1));
+                bsl::memcpy(data, X.argumentData(), i);
+
+                Obj mY(&ta);  const Obj& Y = mY;
+                mY.setFormat(X.format());
+                mY.setArgumentData(data, i);
+
+                ta.deallocate(data);
+
+                const bsl::string TEXT = rendered(Y, &status);
+                if (veryVerbose) { T_ P_(i) P(TEXT) }
+
+                ASSERTV(i, (LENGTH == i) == (0 == status));
+                ASSERTV(i, (LENGTH == i) == (FULL == TEXT));
+                ASSERTV(i, (LENGTH == i) == (X == Y));
+            }
+
+            bsl::string data(X.argumentData(), LENGTH, &ta);
+            data[0] = 99;  // unknown type tag
+
+            Obj mY(&ta);  const Obj& Y = mY;
+            mY.setFormat(X.format());
+            mY.setArgumentData(data.data(), LENGTH);
+            ASSERTV(rendered(Y), 0 != Y.render(&data));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // RENDERING
+        //
+        // Concerns:
+        //: 1 Each 'appendArgument' overload captures its argument such that
+        //:   'render' produces the text 'snprintf' would for each conversion
+        //:   (including flags, field width, precision, and '*').
+        //:
+        //: 2 Length modifiers narrow integral arguments as 'printf' does.
+        //:
+        //: 3 String arguments are copied, and null strings render as
+        //:   "(null)".
+        //:
+        //: 4 '%%' renders as '%' and consumes no argument, and '%n' consumes
+        //:   an argument and writes nothing.
+        //:
+        //: 5 Long output (exceeding any internal buffer) is rendered in full.
+        //:
+        //: 6 An object holding no format renders nothing, successfully.
+        //:
+        //: 7 'render' appends to its argument.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, capture a format and a single
+        //:   argument of each supported type, and compare the rendered text
+        //:   with that of 'snprintf'.  (C-1..2)
+        //:
+        //: 2 Capture strings from a buffer that is then overwritten, and a
+        //:   null string.  (C-3)
+        //:
+        //: 3 Exercise the remaining concerns directly.  (C-4..7)
+        //
+        // Testing:
+        //   void appendArgument(int value);
+        //   void appendArgument(long value);
+        //   void appendArgument(long long value);
+        //   void appendArgument(unsigned int value);
+        //   void appendArgument(unsigned long value);
+        //   void appendArgument(unsigned long long value);
+        //   void appendArgument(double value);
+        //   void appendArgument(long double value);
+        //   void appendArgument(const char *value);
+        //   void appendArgument(const void *value);
+        //   int render(bsl::string *result) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "RENDERING" << endl
+                          << "=========" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tIntegral conversions." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_format_p;
+                long long   d_value;
+            } DATA[] = {
+                //LINE  FORMAT         VALUE
+                //----  ----------     --------------------
+                { L_,   "%d",          0                    },
+                { L_,   "%d",          -17                  },
+                { L_,   "%+5d",        17                   },
+                { L_,   "%-5d|",       17                   },
+                { L_,   "%05d",        -17                  },
+                { L_,   "% d",         17                   },
+                { L_,   "%.4i",        17                   },
+                { L_,   "%x",          255                  },
+                { L_,   "%#X",         255                  },
+                { L_,   "%#o",         8                    },
+                { L_,   "%u",          -1                   },
+                { L_,   "%c",          'q'                  },
+                { L_,   "%hd",         70000                },
+                { L_,   "%hhu",        511                  },
+                { L_,   "%hx",         -1                   },
+                { L_,   "%ld",         LLONG_MIN / 3        },
+                { L_,   "%lld",        LLONG_MIN            },
+                { L_,   "%llu",        -1                   },
+                { L_,   "%lx",         0x123456789abcLL     },
+                { L_,   "%zu",         12345                },
+                { L_,   "%td",         -12345               },
+                { L_,   "%jd",         LLONG_MAX            },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int        LINE   = DATA[ti].d_line;
+                const char      *FORMAT = DATA[ti].d_format_p;
+                const long long  VALUE  = DATA[ti].d_value;
+
+                // 'printf' requires the argument to have the type designated
+                // by the length modifier; the value is passed as 'long long'
+                // and converted by the format for 'EXP'.
+
+                bsl::string exp;
+                if (bsl::strstr(FORMAT, "ll") || bsl::strchr(FORMAT, 'j')) {
+                    exp = expected(FORMAT, VALUE);
+                }
+                else if (bsl::strchr(FORMAT, 'l')) {
+                    exp = expected(FORMAT, static_cast<long>(VALUE));
+                }
+                else if (bsl::strchr(FORMAT, 'z')) {
+                    exp = expected(FORMAT, static_cast<bsl::size_t>(VALUE));
+                }
+                else if (bsl::strchr(FORMAT, 't')) {
+                    exp = expected(FORMAT, static_cast<bsl::ptrdiff_t>(VALUE));
+                }
+                else {
+                    exp = expected(FORMAT, static_cast<int>(VALUE));
+                }
+
+                // Capture the value using each signed and unsigned overload
+                // whose type can represent it.
+
+                for (int overload = 0; overload < 4; ++overload) {
+                    Obj mX(&ta);  const Obj& X = mX;
+                    mX.setFormat(FORMAT);
+                    switch (overload) {
+                      case 0: {
+                        if (VALUE < INT_MIN || INT_MAX < VALUE) {
+                            continue;
+                        }
+                        mX.appendArgument(static_cast<int>(VALUE));
+                      } break;
+                      case 1: {
+                        if (VALUE < LONG_MIN || LONG_MAX < VALUE) {
+                            continue;
+                        }
+                        mX.appendArgument(static_cast<long>(VALUE));
+                      } break;
+                      case 2: {
+                        mX.appendArgument(VALUE);
+                      } break;
+                      case 3: {
+                        mX.appendArgument(
+                                       static_cast<unsigned long long>(VALUE));
+                      } break;
+                    }
+
+                    int               status;
+                    const bsl::string TEXT = rendered(X, &status);
+                    if (veryVerbose) { T_ P_(LINE) P_(overload) P(TEXT) }
+
+                    ASSERTV(LINE, overload, status, 0 == status);
+                    ASSERTV(LINE, overload, exp, TEXT, exp == TEXT);
+                }
+            }
+        }
+
+        if (verbose) cout << "\tFloating-point conversions." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_format_p;
+                double      d_value;
+            } DATA[] = {
+                //LINE  FORMAT         VALUE
+                //----  ----------     ----------
+                { L_,   "%f",          0.0        },
+                { L_,   "%f",          -1.5       },
+                { L_,   "%.2f",        123.456    },
+                { L_,   "%10.3f|",     3.14159    },
+                { L_,   "%-10.1e|",    31415.9    },
+                { L_,   "%E",          1e300      },
+                { L_,   "%g",          1e-10      },
+                { L_,   "%#G",         2.0        },
+                { L_,   "%+.0f",       2.5        },
+                { L_,   "%a",          1.0        },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int     LINE   = DATA[ti].d_line;
+                const char   *FORMAT = DATA[ti].d_format_p;
+                const double  VALUE  = DATA[ti].d_value;
+
+                const bsl::string EXP = expected(FORMAT, VALUE);
+
+                Obj mX(&ta);  const Obj& X = mX;
+                mX.setFormat(FORMAT);
+                mX.appendArgument(VALUE);
+
+                int               status;
+                const bsl::string TEXT = rendered(X, &status);
+                if (veryVerbose) { T_ P_(LINE) P(TEXT) }
+
+                ASSERTV(LINE, 0 == status);
+                ASSERTV(LINE, EXP, TEXT, EXP == TEXT);
+
+                // A 'long double' is rendered with the 'L' modifier, present
+                // or not.  Note that the hexadecimal rendering of a 'long
+                // double' may differ from that of the same 'double' value.
+
+                if (bsl::strchr(FORMAT, 'a')) {
+                    continue;
+                }
+
+                Obj mY(&ta);  const Obj& Y = mY;
+                mY.setFormat(FORMAT);
+                mY.appendArgument(static_cast<long double>(VALUE));
+
+                ASSERTV(LINE, EXP, rendered(Y), EXP == rendered(Y));
+            }
+        }
+
+        if (verbose) cout << "\tStrings and addresses." << endl;
+        {
+            char buffer[16];
+            bsl::strcpy(buffer, "hello");
+
+            Obj mX(&ta);  const Obj& X = mX;
+            mX.setFormat("[%s] [%8s] [%-8s] [%.3s] [%s]");
+            for (int i = 0; i < 4; ++i) {
+                mX.appendArgument(static_cast<const char *>(buffer));
+            }
+            mX.appendArgument(static_cast<const char *>(0));
+
+            bsl::strcpy(buffer, "XXXXX");
+
+            ASSERTV(rendered(X),
+                    "[hello] [   hello] [hello   ] [hel] [(null)]"
+                                                               == rendered(X));
+
+            int         i;
+            const void *ADDRESS = &i;
+
+            Obj mY(&ta);  const Obj& Y = mY;
+            mY.setFormat("%p");
+            mY.appendArgument(ADDRESS);
+
+            ASSERTV(rendered(Y), expected("%p", ADDRESS) == rendered(Y));
+
+            // A string argument may also be rendered as an address.
+
+            mY.setFormat("%p %p");
+            mY.appendArgument(static_cast<const char *>(buffer));
+            mY.appendArgument(static_cast<const char *>(0));
+
+            const bsl::string EXP = expected("%p %p",
+                                             static_cast<void *>(buffer),
+                                             static_cast<void *>(0));
+            ASSERTV(EXP, rendered(Y), EXP == rendered(Y));
+        }
+
+        if (verbose) cout << "\t'*', '%%', and '%n'." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            mX.setFormat("%*d|%-*d|%.*f|%*.*s|%.*d|%n%%");
+            mX.appendArgument(5);
+            mX.appendArgument(1);
+            mX.appendArgument(-5);
+            mX.appendArgument(2);
+            mX.appendArgument(3);
+            mX.appendArgument(3.14159);
+            mX.appendArgument(6);
+            mX.appendArgument(2);
+            mX.appendArgument("abc");
+            mX.appendArgument(-1);
+            mX.appendArgument(42);
+            mX.appendArgument(static_cast<const void *>(0));
+
+            const bsl::string EXP = expected("%*d|%-*d|%.*f|%*.*s|%.*d|%%",
+                                             5, 1, -5, 2, 3, 3.14159,
+                                             6, 2, "abc", -1, 42);
+
+            int status;
+            ASSERTV(EXP, rendered(X), EXP == rendered(X, &status));
+            ASSERT(0 == status);
+        }
+
+        if (verbose) cout << "\tLong output." << endl;
+        {
+            const bsl::string LONG(5000, 'z', &ta);
+
+            Obj mX(&ta);  const Obj& X = mX;
+            mX.setFormat("<%s><%2000d>");
+            mX.appendArgument(LONG.c_str());
+            mX.appendArgument(7);
+
+            const bsl::string TEXT = rendered(X);
+            ASSERT(5000 + 2000 + 4 == TEXT.length());
+            ASSERT("<" + LONG + ">" == TEXT.substr(0, 5002));
+            ASSERT("7>" == TEXT.substr(TEXT.length() - 2));
+        }
+
+        if (verbose) cout << "\tNo format; appending." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            bsl::string result("abc", &ta);
+            ASSERT(0 == X.render(&result));
+            ASSERT("abc" == result);
+
+            mX.setFormat("-%d");
+            mX.appendArgument(1);
+            ASSERT(0 == X.render(&result));
+            ASSERT("abc-1" == result);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // VALUE SEMANTICS
+        //
+        // Concerns:
+        //: 1 A default-constructed object holds no format and no arguments,
+        //:   and uses the supplied (or default) allocator.
+        //:
+        //: 2 'setFormat' holds the supplied address and clears the arguments,
+        //:   and 'reset' restores the default-constructed state.
+        //:
+        //: 3 Two objects are equal if neither holds a format, or if their
+        //:   formats have the same characters (at any addresses) and their
+        //:   arguments are the same.
+        //:
+        //: 4 Copy construction and assignment produce equal objects using
+        //:   their own allocators, and 'swap' exchanges values.
+        //
+        // Plan:
+        //: 1 Exercise each concern directly, using test allocators to verify
+        //:   the source of memory.  (C-1..4)
+        //
+        // Testing:
+        //   explicit DeferredMessage(bslma::Allocator *basicAllocator = 0);
+        //   DeferredMessage(const DeferredMessage& original, *ba = 0);
+        //   DeferredMessage& operator=(const DeferredMessage& rhs);
+        //   void reset();
+        //   void setFormat(const char *format);
+        //   void swap(DeferredMessage& other);
+        //   bool hasFormat() const;
+        //   const char *format() const;
+        //   const char *argumentData() const;
+        //   int argumentDataLength() const;
+        //   bslma::Allocator *allocator() const;
+        //   bool operator==(const DeferredMessage&, const DeferredMessage&);
+        //   bool operator!=(const DeferredMessage&, const DeferredMessage&);
+        //   void swap(DeferredMessage& a, DeferredMessage& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VALUE SEMANTICS" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("other",  veryVeryVeryVerbose);
+
+        {
+            Obj mD;  const Obj& D = mD;
+            ASSERT(&defaultAllocator == D.allocator());
+        }
+
+        Obj mX(&ta);  const Obj& X = mX;
+
+        ASSERT(&ta   == X.allocator());
+        ASSERT(false == X.hasFormat());
+        ASSERT(0     == X.format());
+        ASSERT(0     == X.argumentDataLength());
+        ASSERT(0     == X.argumentData());
+
+        static const char FORMAT[] = "%d %s";
+        const char        *A = "a";
+        char              copy[sizeof FORMAT];
+        bsl::strcpy(copy, FORMAT);
+
+        mX.setFormat(FORMAT);
+        mX.appendArgument(1);
+        mX.appendArgument(A);
+
+        ASSERT(true   == X.hasFormat());
+        ASSERT(FORMAT == X.format());
+        ASSERT(1 + 8 + 1 + 8 + 2 == X.argumentDataLength());
+        ASSERT(Obj::e_SIGNED == X.argumentData()[0]);
+        ASSERT(Obj::e_STRING == X.argumentData()[9]);
+        ASSERT(0 == bsl::strcmp("a", X.argumentData() + 18));
+
+        Obj mY(&oa);  const Obj& Y = mY;
+        ASSERT(X != Y);  ASSERT(Y != X);
+
+        mY.setFormat(copy);
+        ASSERT(X != Y);
+
+        mY.appendArgument(1);
+        mY.appendArgument(A);
+        ASSERT(X == Y);  ASSERT(!(X != Y));
+
+        mY.appendArgument(2);
+        ASSERT(X != Y);
+
+        mY.setFormat(copy);
+        ASSERT(0 == Y.argumentDataLength());
+        mY.appendArgument(1LL);
+        mY.appendArgument(A);
+        ASSERT(X == Y);
+
+        mY.setFormat(copy);
+        mY.appendArgument(1u);
+        mY.appendArgument(A);
+        ASSERT(X != Y);
+
+        {
+            Obj mZ(X, &oa);  const Obj& Z = mZ;
+            ASSERT(X   == Z);
+            ASSERT(&oa == Z.allocator());
+
+            bslma::TestAllocatorMonitor tam(&ta);
+            Obj mW(&oa);  const Obj& W = mW;
+            mW = X;
+            ASSERT(X == W);
+            ASSERT(tam.isTotalSame());
+
+            mW = W;
+            ASSERT(X == W);
+
+            mW.reset();
+            ASSERT(Obj() == W);
+            ASSERT(false == W.hasFormat());
+            ASSERT(0     == W.argumentDataLength());
+
+            mW.swap(mZ);
+            ASSERT(X == W);
+            ASSERT(false == Z.hasFormat());
+
+            swap(mW, mZ);
+            ASSERT(X == Z);
+            ASSERT(false == W.hasFormat());
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Capture a format and arguments, render them, copy the object,
+        //:   and compare.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        Obj mX(&ta);  const Obj& X = mX;
+        ASSERT(!X.hasFormat());
+        ASSERT("" == rendered(X));
+
+        mX.setFormat("%s=%d (%.1f%%)");
+        mX.appendArgument("count");
+        mX.appendArgument(12);
+        mX.appendArgument(99.5);
+
+        if (veryVerbose) { T_ P(X) }
+
+        ASSERTV(rendered(X), "count=12 (99.5%)" == rendered(X));
+
+        Obj mY(X, &ta);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        mY.reset();
+        ASSERT(X != Y);
+        ASSERT("" == rendered(Y));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    ASSERT(0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -40,6 +40,7 @@ BSLS_IDENT("$Id: $")
 //                         |              enableStdoutLoggingPrefix
 //                         |              enablePublishInLocalTime
 //                         |              forceRotation
+//                         |              publishBatch
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
 //                         |              setOnFileRotationCallback
@@ -509,6 +510,16 @@ class FileObserver : public Observer {
         // 'stdout' if the severity of 'record' is at least as severe as the
         // severity level specified at construction.
 
+    void publishBatch(const Record *const *records, int numRecords);
+        // Process the specified 'numRecords' log records addressed by the
+        // elements of the specified 'records' array, in order, as if by
+        // calling 'publish' on each of them, but acquiring the lock of this
+        // object only once, writing the records selected for 'stdout' with a
+        // single write, and writing the records to the log file (if file
+        // logging is enabled) using 'FileObserver2::publishBatch'.  The
+        // behavior is undefined unless '0 <= numRecords' and each of the
+        // first 'numRecords' elements of 'records' is non-null.
+
     void releaseRecords();
         // Discard any shared reference to a 'Record' object that was supplied
         // to the 'publish' method, and is held by this observer.  Note that
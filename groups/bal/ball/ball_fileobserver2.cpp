@@ -50,6 +50,9 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #include <bsl_iostream.h>
 #include <bsl_memory.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_errno.h>
 #include <bsl_c_time.h>
@@ -411,8 +414,15 @@ void FileObserver2::logRecordDefault(bsl::ostream& stream,
     stream << buffer;
     stream << fixedFields.category();
     stream << ' ';
-    bslstl::StringRef message = fixedFields.messageRef();
-    stream.write(message.data(), message.length());
+    if (record.deferredMessage().hasFormat()) {
+        bsl::string message;
+        record.deferredMessage().render(&message);
+        stream.write(message.data(), message.length());
+    }
+    else {
+        bslstl::StringRef message = fixedFields.messageRef();
+        stream.write(message.data(), message.length());
+    }
     stream << ' ';
 
     const ball::UserFields& customFields = record.customFields();
@@ -492,39 +502,82 @@ int FileObserver2::rotateFile(bsl::string *rotatedLogFileName)
     return returnStatus;
 }
 
-int FileObserver2::rotateIfNecessary(bsl::string           *rotatedLogFileName,
-                                     const bdlt::Datetime&  currentLogTimeUtc)
+bool FileObserver2::isRotationNecessary(
+                                  bsls::Types::Uint64   numPendingBytes,
+                                  const bdlt::Datetime& currentLogTimeUtc)
 {
     BSLS_ASSERT(d_rotationSize >= 0);
     BSLS_ASSERT(d_rotationInterval.totalSeconds() >= 0);
-    BSLS_ASSERT(rotatedLogFileName);
 
     if (!d_logStreamBuf.isOpened()) {
-        return 1;                                                     // RETURN
+        return false;                                                 // RETURN
     }
 
     if (d_rotationSize) {
         // 'tellp' returns -1 on failure.  Rotate the log file if either
         // 'tellp' fails, or the rotation size is exceeded.
 
-        if (static_cast<bsls::Types::Uint64>(d_logOutStream.tellp()) >
-            static_cast<bsls::Types::Uint64>(d_rotationSize) * 1024) {
+        typedef bsls::Types::Uint64 Uint64;
 
-            return rotateFile(rotatedLogFileName);                    // RETURN
+        const bsl::streamoff position = d_logOutStream.tellp();
+
+        if (position < 0
+         || static_cast<Uint64>(position) + numPendingBytes >
+                                  static_cast<Uint64>(d_rotationSize) * 1024) {
+            return true;                                              // RETURN
         }
     }
 
-    if (d_rotationInterval.totalSeconds()
-     && d_nextRotationTimeUtc <= currentLogTimeUtc) {
-        return rotateFile(rotatedLogFileName);                        // RETURN
+    return d_rotationInterval.totalSeconds()
+        && d_nextRotationTimeUtc <= currentLogTimeUtc;
+}
+
+int FileObserver2::rotateIfNecessary(bsl::string           *rotatedLogFileName,
+                                     const bdlt::Datetime&  currentLogTimeUtc)
+{
+    BSLS_ASSERT(rotatedLogFileName);
+
+    if (!isRotationNecessary(0, currentLogTimeUtc)) {
+        return 1;                                                     // RETURN
     }
-    return 1;
+    return rotateFile(rotatedLogFileName);
+}
+
+void FileObserver2::writeBatchBuffer()
+{
+    const bsl::size_t length = d_batchStreamBuf.length();
+
+    if (0 < length && d_logStreamBuf.isOpened()) {
+        // Flush anything a formatting functor may have left in the log stream
+        // so that the batch is written after it.
+
+        d_logOutStream.flush();
+
+        const int numBytes = static_cast<int>(length);
+
+        if (!d_logOutStream
+         || numBytes != bdls::FilesystemUtil::write(
+                                              d_logStreamBuf.fileDescriptor(),
+                                              d_batchStreamBuf.data(),
+                                              numBytes)) {
+            fprintf(stderr, "%s Error on file stream for %s: %s\n",
+                    errorMsgPrefix,
+                    d_logFileName.c_str(), bsl::strerror(getErrorCode()));
+
+            d_logStreamBuf.clear();
+        }
+    }
+
+    d_batchStreamBuf.pubseekpos(0);
+    d_batchOutStream.clear();
 }
 
 // CREATORS
 FileObserver2::FileObserver2(bslma::Allocator *basicAllocator)
 : d_logStreamBuf(bdls::FilesystemUtil::k_INVALID_FD, false)
 , d_logOutStream(&d_logStreamBuf)
+, d_batchStreamBuf(basicAllocator)
+, d_batchOutStream(&d_batchStreamBuf)
 , d_logFilePattern(basicAllocator)
 , d_logFileName(basicAllocator)
 , d_logFileFunctor(
@@ -682,6 +735,62 @@ void FileObserver2::publish(const Record& record, const Context&)
     }
 }
 
+void FileObserver2::publishBatch(const Record *const *records,
+                                 int                  numRecords)
+{
+    BSLS_ASSERT(records || 0 == numRecords);
+    BSLS_ASSERT(0 <= numRecords);
+
+    typedef bsl::pair<int, bsl::string> RotationResult;
+
+    bsl::vector<RotationResult> rotationResults;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        for (int i = 0; i < numRecords; ++i) {
+            BSLS_ASSERT(records[i]);
+
+            const Record&         record    = *records[i];
+            const bdlt::Datetime& timestamp = record.fixedFields().timestamp();
+
+            // Rotation conditions are evaluated for every record, taking into
+            // account the bytes already formatted for this batch, so that the
+            // records land in the same files as if published one at a time.
+
+            if (isRotationNecessary(d_batchStreamBuf.length(), timestamp)) {
+                writeBatchBuffer();
+
+                bsl::string rotatedFileName;
+                const int   rotationStatus = rotateIfNecessary(
+                                                              &rotatedFileName,
+                                                              timestamp);
+                if (0 >= rotationStatus) {
+                    rotationResults.push_back(
+                                    RotationResult(rotationStatus,
+                                                   rotatedFileName));
+                }
+            }
+
+            if (d_logStreamBuf.isOpened()) {
+                d_logFileFunctor(d_batchOutStream, record);
+            }
+        }
+
+        writeBatchBuffer();
+    }
+
+    if (!rotationResults.empty()) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationCbMutex);
+        if (d_onRotationCb) {
+            for (bsl::size_t i = 0; i < rotationResults.size(); ++i) {
+                d_onRotationCb(rotationResults[i].first,
+                               rotationResults[i].second);
+            }
+        }
+    }
+}
+
 void FileObserver2::rotateOnLifetime(
                                     const bdlt::DatetimeInterval& timeInterval)
 {
@@ -39,6 +39,7 @@ BSLS_IDENT("$Id: $")
 //                         |              enableFileLogging
 //                         |              enablePublishInLocalTime
 //                         |              forceRotation
+//                         |              publishBatch
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
 //                         |              setLogFileFunctor
@@ -166,6 +167,18 @@ BSLS_IDENT("$Id: $")
 // Note that timestamp pattern elements in a log file name are typically
 // selected so they produce unique names for each rotation.
 //
+///Batch Publication
+///-----------------
+// Each call to 'publish' acquires the lock of the file observer, formats a
+// single record, and flushes it to the log file, resulting in (at least) one
+// system call per record.  A client that has several records available at
+// once (e.g., 'ball::AsyncFileObserver') can instead call 'publishBatch',
+// which acquires the lock once, formats all of the records into a contiguous
+// in-memory buffer, and writes that buffer to the log file with a single write
+// operation.  File rotation conditions are evaluated for each record in the
+// batch, so the log files produced are the same as those that would result
+// from publishing the records individually.
+//
 ///Thread Safety
 ///-------------
 // All methods of 'ball::FileObserver2' are thread-safe, and can be called
@@ -225,6 +238,10 @@ BSLS_IDENT("$Id: $")
 #include <bdls_fdstreambuf.h>
 #endif
 
+#ifndef INCLUDED_BDLSB_MEMOUTSTREAMBUF
+#include <bdlsb_memoutstreambuf.h>
+#endif
+
 #ifndef INCLUDED_BDLT_DATETIME
 #include <bdlt_datetime.h>
 #endif
@@ -249,6 +266,10 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_mutex.h>
 #endif
 
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
 #ifndef INCLUDED_BSL_FSTREAM
 #include <bsl_fstream.h>
 #endif
@@ -318,6 +339,16 @@ class FileObserver2 : public Observer {
                                                        // to the buffer
                                                        // 'd_logStreamBuf')
 
+    bdlsb::MemOutStreamBuf d_batchStreamBuf;           // stream buffer in
+                                                       // which a batch of
+                                                       // records is formatted
+                                                       // by 'publishBatch'
+
+    bsl::ostream           d_batchOutStream;           // output stream for
+                                                       // batch formatting
+                                                       // (refers to the buffer
+                                                       // 'd_batchStreamBuf')
+
     bsl::string            d_logFilePattern;           // log filename pattern
 
     bsl::string            d_logFileName;              // current filename
@@ -402,6 +433,23 @@ class FileObserver2 : public Observer {
         // and the 'rotateOnSize' methods respectively.  The behavior is
         // undefined unless the caller acquired the lock for this object.
 
+    bool isRotationNecessary(bsls::Types::Uint64   numPendingBytes,
+                             const bdlt::Datetime& currentLogTimeUtc);
+        // Return 'true' if the log file is open and either the specified
+        // 'currentLogTimeUtc' is later than the scheduled rotation time of the
+        // current log file, or the size of the log file, increased by the
+        // specified 'numPendingBytes' that are formatted but not yet written,
+        // is larger than the allowable size, and 'false' otherwise.  The
+        // behavior is undefined unless the caller acquired the lock for this
+        // object.
+
+    void writeBatchBuffer();
+        // Write the records formatted in the batch buffer of this file
+        // observer to the log file using a single write operation (after
+        // flushing any output pending in the log stream), and empty the batch
+        // buffer.  If the write fails, close the log file.  The behavior is
+        // undefined unless the caller acquired the lock for this object.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(FileObserver2, bslma::UsesBslmaAllocator);
@@ -514,6 +562,19 @@ class FileObserver2 : public Observer {
         // a file if file logging is enabled for this file observer.  The
         // method has no effect if file logging is not enabled.
 
+    void publishBatch(const Record *const *records, int numRecords);
+        // Write the specified 'numRecords' log records addressed by the
+        // elements of the specified 'records' array, in order, to a file if
+        // file logging is enabled for this file observer.  The records are
+        // formatted into a single contiguous buffer that is written to the
+        // file with one write operation, and the lock of this object is
+        // acquired only once for the whole batch.  The resulting file
+        // contents, including any file rotations, are the same as if
+        // 'publish' were called on each record in turn.  This method has no
+        // effect if file logging is not enabled.  The behavior is undefined
+        // unless '0 <= numRecords' and each of the first 'numRecords' elements
+        // of 'records' is non-null.
+
     void releaseRecords();
         // Discard any shared reference to a 'Record' object that was supplied
         // to the 'publish' method, and is held by this observer.  Note that
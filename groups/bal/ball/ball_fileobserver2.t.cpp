@@ -43,11 +43,13 @@
 
 #include <bsls_assert.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
 
 #include <bdlb_tokenizer.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_climits.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstdio.h>
@@ -56,6 +58,7 @@
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_stdio.h>  // tempname()
 
@@ -101,6 +104,7 @@ using bsl::flush;
 // [ 1] int enableFileLogging(const char *fileName, bool timestampFlag = false)
 // [ 1] void enablePublishInLocalTime()
 // [ 1] void publish(const ball::Record& record, const ball::Context& context)
+// [13] void publishBatch(const Record *const *records, int numRecords);
 // [ 2] void forceRotation()
 // [ 2] void rotateOnSize(int size)
 // [ 9] void rotateOnTimeInterval(const bdlt::DatetimeInterval& interval);
@@ -122,6 +126,7 @@ using bsl::flush;
 // [ 8] CONCERN: 'rotateOnSize' triggers correctly for existing files
 // [ 7] CONCERN: Rotation on size is based on file size
 // [12] CONCERN: Published Records Show Current Local-Time Offset
+// [-2] PERFORMANCE: 'publish' vs. 'publishBatch'
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -508,6 +513,31 @@ void publishRecord(Obj *mX, const char *message)
 }
 
 
+void makeRecords(bsl::vector<ball::Record> *records,
+                 int                        numRecords,
+                 int                        messageLength)
+    // Load into the specified 'records' the specified 'numRecords' log
+    // records, each having a distinct message of (at least) the specified
+    // 'messageLength' characters.
+{
+    records->clear();
+    for (int i = 0; i < numRecords; ++i) {
+        bsl::ostringstream oss;
+        oss << "message " << i << ' ';
+        oss << bsl::string(messageLength, 'x');
+
+        ball::RecordAttributes attr(bdlt::CurrentTime::utc(),
+                                    1,
+                                    2,
+                                    "FILENAME",
+                                    3 + i,
+                                    "CATEGORY",
+                                    32,
+                                    oss.str().c_str());
+        records->push_back(ball::Record(attr, ball::UserFields()));
+    }
+}
+
 int getNumLines(const char *filename)
 {
     bsl::ifstream fs;
@@ -730,6 +760,162 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING 'publishBatch'
+        //
+        // Concerns:
+        //: 1 'publishBatch' writes the supplied records, in order, with the
+        //:   same content as publishing each record with 'publish'.
+        //:
+        //: 2 Records published with 'publish' and 'publishBatch' can be
+        //:   interleaved.
+        //:
+        //: 3 A batch of 0 records has no effect.
+        //:
+        //: 4 'publishBatch' has no effect if file logging is disabled.
+        //:
+        //: 5 Rotation conditions are evaluated for each record of a batch, so
+        //:   a batch spanning the rotation size results in the same number of
+        //:   rotations as publishing its records individually.
+        //
+        // Plan:
+        //: 1 Publish a sequence of records to one file observer one at a time,
+        //:   and to another in batches of varying sizes (interleaving single
+        //:   'publish' calls), and compare the contents of the two log files.
+        //:   (C-1..3)
+        //:
+        //: 2 Call 'publishBatch' on an observer with file logging disabled.
+        //:   (C-4)
+        //:
+        //: 3 Enable rotation on size for two observers, publish the same
+        //:   records individually and in one batch, and compare the number of
+        //:   rotations reported to the rotation callbacks.  (C-5)
+        //
+        // Testing:
+        //   void publishBatch(const Record *const *records, int numRecords);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'publishBatch'" << endl
+                                  << "======================" << endl;
+
+        bslma::TestAllocator ta("ta", veryVeryVeryVerbose);
+
+        const ball::Context CONTEXT(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        if (verbose) cout << "\tComparing with 'publish'." << endl;
+        {
+            const int NUM_RECORDS = 200;
+
+            bsl::vector<ball::Record> records(&ta);
+            makeRecords(&records, NUM_RECORDS, 20);
+
+            bsl::vector<const ball::Record *> pointers(&ta);
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                pointers.push_back(&records[i]);
+            }
+
+            const bsl::string SINGLE_NAME = tempFileName(veryVerbose);
+            const bsl::string BATCH_NAME  = tempFileName(veryVerbose);
+
+            Obj mS(&ta);
+            Obj mB(&ta);
+
+            ASSERT(0 == mS.enableFileLogging(SINGLE_NAME.c_str()));
+            ASSERT(0 == mB.enableFileLogging(BATCH_NAME.c_str()));
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                mS.publish(records[i], CONTEXT);
+            }
+
+            mB.publishBatch(&pointers[0], 0);
+
+            int i = 0, batchSize = 1;
+            while (i < NUM_RECORDS) {
+                const int n = bsl::min(batchSize, NUM_RECORDS - i);
+                mB.publishBatch(&pointers[i], n);
+                i += n;
+                if (i < NUM_RECORDS) {
+                    mB.publish(records[i], CONTEXT);
+                    ++i;
+                }
+                batchSize = batchSize * 2 + 1;
+            }
+
+            mS.disableFileLogging();
+            mB.disableFileLogging();
+
+            bsl::string singleContent, batchContent;
+            readFileIntoString(__LINE__, SINGLE_NAME, singleContent);
+            readFileIntoString(__LINE__, BATCH_NAME, batchContent);
+            ASSERT(!singleContent.empty());
+            ASSERT(singleContent == batchContent);
+
+            if (veryVerbose) {
+                P_(singleContent.size()) P(batchContent.size())
+            }
+
+            mB.publishBatch(&pointers[0], NUM_RECORDS);
+
+            bsl::string disabledContent;
+            readFileIntoString(__LINE__, BATCH_NAME, disabledContent);
+            ASSERT(batchContent == disabledContent);
+
+            removeFilesByPrefix(SINGLE_NAME.c_str());
+            removeFilesByPrefix(BATCH_NAME.c_str());
+        }
+
+        if (verbose) cout << "\tRotation on size within a batch." << endl;
+        {
+            const int NUM_RECORDS = 100;
+
+            bsl::vector<ball::Record> records(&ta);
+            makeRecords(&records, NUM_RECORDS, 100);
+
+            bsl::vector<const ball::Record *> pointers(&ta);
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                pointers.push_back(&records[i]);
+            }
+
+            const bsl::string SINGLE_NAME = tempFileName(veryVerbose);
+            const bsl::string BATCH_NAME  = tempFileName(veryVerbose);
+
+            Obj mS(&ta);
+            Obj mB(&ta);
+
+            RotCb singleCb(&ta);
+            RotCb batchCb(&ta);
+
+            mS.setOnFileRotationCallback(singleCb);
+            mB.setOnFileRotationCallback(batchCb);
+
+            ASSERT(0 == mS.enableFileLogging(SINGLE_NAME.c_str()));
+            ASSERT(0 == mB.enableFileLogging(BATCH_NAME.c_str()));
+
+            mS.rotateOnSize(1);
+            mB.rotateOnSize(1);
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                mS.publish(records[i], CONTEXT);
+            }
+            mB.publishBatch(&pointers[0], NUM_RECORDS);
+
+            if (veryVerbose) {
+                P_(singleCb.numInvocations()) P(batchCb.numInvocations())
+            }
+
+            ASSERT(1 < singleCb.numInvocations());
+            ASSERTV(singleCb.numInvocations(), batchCb.numInvocations(),
+                    singleCb.numInvocations() == batchCb.numInvocations());
+            ASSERTV(batchCb.status(), 0 == batchCb.status());
+
+            mS.disableFileLogging();
+            mB.disableFileLogging();
+
+            removeFilesByPrefix(SINGLE_NAME.c_str());
+            removeFilesByPrefix(BATCH_NAME.c_str());
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // TESTING: Published Records Show Current Local-Time Offset
@@ -3454,6 +3640,81 @@ int main(int argc, char *argv[])
 
         ball::LoggerManager::shutDownSingleton();
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'publish' vs. 'publishBatch'
+        //
+        // Concern:
+        //: 1 Publishing records in batches is faster than publishing them one
+        //:   at a time.
+        //
+        // Plan:
+        //: 1 Time writing the same records to a file with 'publish', and with
+        //:   'publishBatch' for several batch sizes, and report the results.
+        //
+        // Testing:
+        //   PERFORMANCE: 'publish' vs. 'publishBatch'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: 'publish' vs. 'publishBatch'"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        const int NUM_RECORDS = 100000;
+
+        bslma::TestAllocator ta("ta", veryVeryVeryVerbose);
+
+        bsl::vector<ball::Record> records(&ta);
+        makeRecords(&records, 1024, 60);
+
+        bsl::vector<const ball::Record *> pointers(&ta);
+        for (int i = 0; i < 1024; ++i) {
+            pointers.push_back(&records[i]);
+        }
+
+        const ball::Context CONTEXT(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        const int BATCH_SIZES[] = { 0, 1, 16, 64, 256, 1024 };
+        const int NUM_BATCH_SIZES = sizeof BATCH_SIZES / sizeof *BATCH_SIZES;
+
+        for (int ti = 0; ti < NUM_BATCH_SIZES; ++ti) {
+            const int BATCH_SIZE = BATCH_SIZES[ti];
+
+            const bsl::string BASENAME = tempFileName(veryVerbose);
+
+            Obj mX(&ta);
+            ASSERT(0 == mX.enableFileLogging(BASENAME.c_str()));
+
+            bsls::Stopwatch timer;
+            timer.start();
+
+            if (0 == BATCH_SIZE) {
+                for (int i = 0; i < NUM_RECORDS; ++i) {
+                    mX.publish(records[i % 1024], CONTEXT);
+                }
+            }
+            else {
+                for (int i = 0; i < NUM_RECORDS; i += BATCH_SIZE) {
+                    mX.publishBatch(&pointers[0],
+                                    bsl::min(BATCH_SIZE, NUM_RECORDS - i));
+                }
+            }
+
+            timer.stop();
+            mX.disableFileLogging();
+
+            const double elapsed = timer.elapsedTime();
+            cout << (0 == BATCH_SIZE ? "publish" : "publishBatch")
+                 << " batch size " << BATCH_SIZE << ": "
+                 << elapsed << "s, "
+                 << (elapsed > 0 ? NUM_RECORDS / elapsed : 0.0)
+                 << " records/s" << endl;
+
+            removeFilesByPrefix(BASENAME.c_str());
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
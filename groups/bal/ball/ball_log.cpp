@@ -18,7 +18,7 @@ BSLS_IDENT_RCSID(ball_log_cpp,"$Id$ $CSID$")
 #include <ball_attributecontext.h>
 #include <ball_defaultattributecontainer.h>
 #include <ball_defaultobserver.h>             // for testing only
-#include <ball_loggermanagerconfiguration.h>  // for testing only
+#include <ball_loggermanagerconfiguration.h>
 #include <ball_record.h>
 #include <ball_testobserver.h>                // for testing only
 
@@ -200,13 +200,25 @@ Log_Formatter::Log_Formatter(const Category *category,
 : d_category_p(category)
 , d_record_p(Log::getRecord(category, fileName, lineNumber))
 , d_severity(severity)
+, d_buffer_p(0)
+, d_bufferLen(0)
 , d_mutex_p(0)
+, d_isDeferred(category
+            && LoggerManagerConfiguration::e_DEFERRED_FORMATTING ==
+                               LoggerManager::singleton().messageFormatting())
 {
-    d_buffer_p = Log::obtainMessageBuffer(&d_mutex_p, &d_bufferLen);
+    if (!d_isDeferred) {
+        d_buffer_p = Log::obtainMessageBuffer(&d_mutex_p, &d_bufferLen);
+    }
 }
 
 Log_Formatter::~Log_Formatter()
 {
+    if (d_isDeferred) {
+        Log::logMessage(d_category_p, d_severity, d_record_p);
+        return;                                                       // RETURN
+    }
+
     d_buffer_p[d_bufferLen - 1] = '\0';
     bslmt::LockGuard<bslmt::Mutex> lockGuard(d_mutex_p, 1);
     d_record_p->fixedFields().setMessage(d_buffer_p);
@@ -194,6 +194,29 @@ BSLS_IDENT("$Id: $")
 //      otherwise.
 //..
 //
+///Deferred Formatting
+///-------------------
+// If the logger manager singleton is configured for deferred message
+// formatting (see 'ball::LoggerManagerConfiguration::setMessageFormatting'),
+// the 'printf'-style macros do not format the message when it is logged.
+// Instead, they capture the address of the format string and the values of
+// the arguments in the 'ball::DeferredMessage' held by the log record, and the
+// text of the message is rendered by the observer when (and if) the record is
+// published, typically by 'ball::RecordStringFormatter' on the publication
+// thread of an asynchronous observer.  In this mode:
+//
+//: o 'MSG' must have static storage duration (e.g., be a string literal), as
+//:   it is referenced by the record until the record is published.
+//:
+//: o Each argument must be of arithmetic, enumeration, or pointer type (the
+//:   only types that are valid for 'printf' conversions); string arguments
+//:   ('char' pointers) are copied when logged.
+//:
+//: o A conversion having no argument, or an argument of an incompatible kind,
+//:   is rendered verbatim rather than having undefined behavior.
+//
+// The C++ stream-based macros are unaffected by this mode.
+//
 ///Usage
 ///-----
 // The following code fragments illustrate the standard pattern of macro usage.
@@ -687,9 +710,16 @@ do {                                                                       \
             ball::Log_Formatter ball_lOcAl_FoRmAtTeR(BALL_LOG_CATEGORY,    \
                                                      __FILE__, __LINE__,   \
                                                      BALL_SEVERITY);       \
-            ball::Log::format(ball_lOcAl_FoRmAtTeR.messageBuffer(),        \
-                              ball_lOcAl_FoRmAtTeR.messageBufferLen(),     \
-                              MSG);                                        \
+            if (ball_lOcAl_FoRmAtTeR.isFormattingDeferred()) {             \
+                ball::DeferredMessage& ball_lOcAl_MeSsAgE =                \
+                                   ball_lOcAl_FoRmAtTeR.deferredMessage(); \
+                ball_lOcAl_MeSsAgE.setFormat(MSG);                         \
+            }                                                              \
+            else {                                                         \
+                ball::Log::format(ball_lOcAl_FoRmAtTeR.messageBuffer(),    \
+                                  ball_lOcAl_FoRmAtTeR.messageBufferLen(), \
+                                  MSG);                                    \
+            }                                                              \
         }                                                                  \
     }                                                                      \
 } while(0)
@@ -703,9 +733,17 @@ do {                                                                       \
             ball::Log_Formatter ball_lOcAl_FoRmAtTeR(BALL_LOG_CATEGORY,    \
                                                      __FILE__, __LINE__,   \
                                                      BALL_SEVERITY);       \
-            ball::Log::format(ball_lOcAl_FoRmAtTeR.messageBuffer(),        \
-                              ball_lOcAl_FoRmAtTeR.messageBufferLen(),     \
-                              MSG, ARG1);                                  \
+            if (ball_lOcAl_FoRmAtTeR.isFormattingDeferred()) {             \
+                ball::DeferredMessage& ball_lOcAl_MeSsAgE =                \
+                                   ball_lOcAl_FoRmAtTeR.deferredMessage(); \
+                ball_lOcAl_MeSsAgE.setFormat(MSG);                         \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG1);                   \
+            }                                                              \
+            else {                                                         \
+                ball::Log::format(ball_lOcAl_FoRmAtTeR.messageBuffer(),    \
+                                  ball_lOcAl_FoRmAtTeR.messageBufferLen(), \
+                                  MSG, ARG1);                              \
+            }                                                              \
         }                                                                  \
     }                                                                      \
 } while(0)
@@ -719,9 +757,18 @@ do {                                                                       \
             ball::Log_Formatter ball_lOcAl_FoRmAtTeR(BALL_LOG_CATEGORY,    \
                                                      __FILE__, __LINE__,   \
                                                      BALL_SEVERITY);       \
-            ball::Log::format(ball_lOcAl_FoRmAtTeR.messageBuffer(),        \
-                              ball_lOcAl_FoRmAtTeR.messageBufferLen(),     \
-                              MSG, ARG1, ARG2);                            \
+            if (ball_lOcAl_FoRmAtTeR.isFormattingDeferred()) {             \
+                ball::DeferredMessage& ball_lOcAl_MeSsAgE =                \
+                                   ball_lOcAl_FoRmAtTeR.deferredMessage(); \
+                ball_lOcAl_MeSsAgE.setFormat(MSG);                         \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG1);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG2);                   \
+            }                                                              \
+            else {                                                         \
+                ball::Log::format(ball_lOcAl_FoRmAtTeR.messageBuffer(),    \
+                                  ball_lOcAl_FoRmAtTeR.messageBufferLen(), \
+                                  MSG, ARG1, ARG2);                        \
+            }                                                              \
         }                                                                  \
     }                                                                      \
 } while(0)
@@ -735,9 +782,19 @@ do {                                                                       \
             ball::Log_Formatter ball_lOcAl_FoRmAtTeR(BALL_LOG_CATEGORY,    \
                                                      __FILE__, __LINE__,   \
                                                      BALL_SEVERITY);       \
-            ball::Log::format(ball_lOcAl_FoRmAtTeR.messageBuffer(),        \
-                              ball_lOcAl_FoRmAtTeR.messageBufferLen(),     \
-                              MSG, ARG1, ARG2, ARG3);                      \
+            if (ball_lOcAl_FoRmAtTeR.isFormattingDeferred()) {             \
+                ball::DeferredMessage& ball_lOcAl_MeSsAgE =                \
+                                   ball_lOcAl_FoRmAtTeR.deferredMessage(); \
+                ball_lOcAl_MeSsAgE.setFormat(MSG);                         \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG1);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG2);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG3);                   \
+            }                                                              \
+            else {                                                         \
+                ball::Log::format(ball_lOcAl_FoRmAtTeR.messageBuffer(),    \
+                                  ball_lOcAl_FoRmAtTeR.messageBufferLen(), \
+                                  MSG, ARG1, ARG2, ARG3);                  \
+            }                                                              \
         }                                                                  \
     }                                                                      \
 } while(0)
@@ -751,9 +808,20 @@ do {                                                                       \
             ball::Log_Formatter ball_lOcAl_FoRmAtTeR(BALL_LOG_CATEGORY,    \
                                                      __FILE__, __LINE__,   \
                                                      BALL_SEVERITY);       \
-            ball::Log::format(ball_lOcAl_FoRmAtTeR.messageBuffer(),        \
-                              ball_lOcAl_FoRmAtTeR.messageBufferLen(),     \
-                              MSG, ARG1, ARG2, ARG3, ARG4);                \
+            if (ball_lOcAl_FoRmAtTeR.isFormattingDeferred()) {             \
+                ball::DeferredMessage& ball_lOcAl_MeSsAgE =                \
+                                   ball_lOcAl_FoRmAtTeR.deferredMessage(); \
+                ball_lOcAl_MeSsAgE.setFormat(MSG);                         \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG1);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG2);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG3);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG4);                   \
+            }                                                              \
+            else {                                                         \
+                ball::Log::format(ball_lOcAl_FoRmAtTeR.messageBuffer(),    \
+                                  ball_lOcAl_FoRmAtTeR.messageBufferLen(), \
+                                  MSG, ARG1, ARG2, ARG3, ARG4);            \
+            }                                                              \
         }                                                                  \
     }                                                                      \
 } while(0)
@@ -767,9 +835,21 @@ do {                                                                       \
             ball::Log_Formatter ball_lOcAl_FoRmAtTeR(BALL_LOG_CATEGORY,    \
                                                      __FILE__, __LINE__,   \
                                                      BALL_SEVERITY);       \
-            ball::Log::format(ball_lOcAl_FoRmAtTeR.messageBuffer(),        \
-                              ball_lOcAl_FoRmAtTeR.messageBufferLen(),     \
-                              MSG, ARG1, ARG2, ARG3, ARG4, ARG5);          \
+            if (ball_lOcAl_FoRmAtTeR.isFormattingDeferred()) {             \
+                ball::DeferredMessage& ball_lOcAl_MeSsAgE =                \
+                                   ball_lOcAl_FoRmAtTeR.deferredMessage(); \
+                ball_lOcAl_MeSsAgE.setFormat(MSG);                         \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG1);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG2);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG3);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG4);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG5);                   \
+            }                                                              \
+            else {                                                         \
+                ball::Log::format(ball_lOcAl_FoRmAtTeR.messageBuffer(),    \
+                                  ball_lOcAl_FoRmAtTeR.messageBufferLen(), \
+                                  MSG, ARG1, ARG2, ARG3, ARG4, ARG5);      \
+            }                                                              \
         }                                                                  \
     }                                                                      \
 } while(0)
@@ -783,9 +863,22 @@ do {                                                                       \
             ball::Log_Formatter ball_lOcAl_FoRmAtTeR(BALL_LOG_CATEGORY,    \
                                                      __FILE__, __LINE__,   \
                                                      BALL_SEVERITY);       \
-            ball::Log::format(ball_lOcAl_FoRmAtTeR.messageBuffer(),        \
-                              ball_lOcAl_FoRmAtTeR.messageBufferLen(),     \
-                              MSG, ARG1, ARG2, ARG3, ARG4, ARG5, ARG6);    \
+            if (ball_lOcAl_FoRmAtTeR.isFormattingDeferred()) {             \
+                ball::DeferredMessage& ball_lOcAl_MeSsAgE =                \
+                                   ball_lOcAl_FoRmAtTeR.deferredMessage(); \
+                ball_lOcAl_MeSsAgE.setFormat(MSG);                         \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG1);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG2);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG3);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG4);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG5);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG6);                   \
+            }                                                              \
+            else {                                                         \
+                ball::Log::format(ball_lOcAl_FoRmAtTeR.messageBuffer(),    \
+                                  ball_lOcAl_FoRmAtTeR.messageBufferLen(), \
+                                  MSG, ARG1, ARG2, ARG3, ARG4, ARG5, ARG6);\
+            }                                                              \
         }                                                                  \
     }                                                                      \
 } while(0)
@@ -800,10 +893,24 @@ do {                                                                       \
             ball::Log_Formatter ball_lOcAl_FoRmAtTeR(BALL_LOG_CATEGORY,    \
                                                      __FILE__, __LINE__,   \
                                                      BALL_SEVERITY);       \
-            ball::Log::format(ball_lOcAl_FoRmAtTeR.messageBuffer(),        \
-                              ball_lOcAl_FoRmAtTeR.messageBufferLen(),     \
-                              MSG, ARG1, ARG2, ARG3, ARG4, ARG5, ARG6,     \
-                              ARG7);                                       \
+            if (ball_lOcAl_FoRmAtTeR.isFormattingDeferred()) {             \
+                ball::DeferredMessage& ball_lOcAl_MeSsAgE =                \
+                                   ball_lOcAl_FoRmAtTeR.deferredMessage(); \
+                ball_lOcAl_MeSsAgE.setFormat(MSG);                         \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG1);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG2);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG3);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG4);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG5);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG6);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG7);                   \
+            }                                                              \
+            else {                                                         \
+                ball::Log::format(ball_lOcAl_FoRmAtTeR.messageBuffer(),    \
+                                  ball_lOcAl_FoRmAtTeR.messageBufferLen(), \
+                                  MSG, ARG1, ARG2, ARG3, ARG4, ARG5, ARG6, \
+                                  ARG7);                                   \
+            }                                                              \
         }                                                                  \
     }                                                                      \
 } while(0)
@@ -818,10 +925,25 @@ do {                                                                       \
             ball::Log_Formatter ball_lOcAl_FoRmAtTeR(BALL_LOG_CATEGORY,    \
                                                      __FILE__, __LINE__,   \
                                                      BALL_SEVERITY);       \
-            ball::Log::format(ball_lOcAl_FoRmAtTeR.messageBuffer(),        \
-                              ball_lOcAl_FoRmAtTeR.messageBufferLen(),     \
-                              MSG, ARG1, ARG2, ARG3, ARG4, ARG5, ARG6,     \
-                              ARG7, ARG8);                                 \
+            if (ball_lOcAl_FoRmAtTeR.isFormattingDeferred()) {             \
+                ball::DeferredMessage& ball_lOcAl_MeSsAgE =                \
+                                   ball_lOcAl_FoRmAtTeR.deferredMessage(); \
+                ball_lOcAl_MeSsAgE.setFormat(MSG);                         \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG1);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG2);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG3);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG4);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG5);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG6);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG7);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG8);                   \
+            }                                                              \
+            else {                                                         \
+                ball::Log::format(ball_lOcAl_FoRmAtTeR.messageBuffer(),    \
+                                  ball_lOcAl_FoRmAtTeR.messageBufferLen(), \
+                                  MSG, ARG1, ARG2, ARG3, ARG4, ARG5, ARG6, \
+                                  ARG7, ARG8);                             \
+            }                                                              \
         }                                                                  \
     }                                                                      \
 } while(0)
@@ -836,10 +958,26 @@ do {                                                                       \
             ball::Log_Formatter ball_lOcAl_FoRmAtTeR(BALL_LOG_CATEGORY,    \
                                                      __FILE__, __LINE__,   \
                                                      BALL_SEVERITY);       \
-            ball::Log::format(ball_lOcAl_FoRmAtTeR.messageBuffer(),        \
-                              ball_lOcAl_FoRmAtTeR.messageBufferLen(),     \
-                              MSG, ARG1, ARG2, ARG3, ARG4, ARG5, ARG6,     \
-                              ARG7, ARG8, ARG9);                           \
+            if (ball_lOcAl_FoRmAtTeR.isFormattingDeferred()) {             \
+                ball::DeferredMessage& ball_lOcAl_MeSsAgE =                \
+                                   ball_lOcAl_FoRmAtTeR.deferredMessage(); \
+                ball_lOcAl_MeSsAgE.setFormat(MSG);                         \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG1);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG2);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG3);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG4);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG5);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG6);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG7);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG8);                   \
+                ball_lOcAl_MeSsAgE.appendArgument(ARG9);                   \
+            }                                                              \
+            else {                                                         \
+                ball::Log::format(ball_lOcAl_FoRmAtTeR.messageBuffer(),    \
+                                  ball_lOcAl_FoRmAtTeR.messageBufferLen(), \
+                                  MSG, ARG1, ARG2, ARG3, ARG4, ARG5, ARG6, \
+                                  ARG7, ARG8, ARG9);                       \
+            }                                                              \
         }                                                                  \
     }                                                                      \
 } while(0)
@@ -1302,6 +1440,12 @@ class Log_Formatter {
     // constructed and the mutex is locked.  As a side-effect of destroying the
     // object, the record is logged and the mutex unlocked.
     //
+    // If the logger manager is configured for deferred message formatting
+    // (see 'ball_loggermanagerconfiguration'), no buffer is obtained (and no
+    // mutex is locked); the macros instead capture the format and arguments
+    // in the deferred message of the record, as returned by
+    // 'deferredMessage'.
+    //
     // This class should *not* be used directly by client code.  It is an
     // implementation detail of the macros provided by this component.
 
@@ -1320,6 +1464,10 @@ class Log_Formatter {
 
     bslmt::Mutex   *d_mutex_p;     // mutex to lock buffer (held, not owned)
 
+    bool            d_isDeferred;  // 'true' if the message is captured in
+                                   // the deferred message of the record
+                                   // rather than formatted in the buffer
+
   private:
     // NOT IMPLEMENTED
     Log_Formatter(const Log_Formatter&);
@@ -1333,9 +1481,9 @@ class Log_Formatter {
                   int             severity);
         // Create a logging formatter that holds (1) the specified 'category'
         // and 'severity', (2) a record that is created from the specified
-        // 'fileName' and 'lineNumber', and (3) a buffer into which the log
-        // message is formatted, and for which a lock is acquired for exclusive
-        // access to the buffer.
+        // 'fileName' and 'lineNumber', and (3) unless message formatting is
+        // deferred, a buffer into which the log message is formatted, and for
+        // which a lock is acquired for exclusive access to the buffer.
 
     ~Log_Formatter();
         // Log the record held by this logging formatter to the held category
@@ -1352,13 +1500,24 @@ class Log_Formatter {
     char *messageBuffer();
         // Return the address of the modifiable buffer held by this logging
         // formatter.  The address is valid until this logging formatter is
-        // destroyed.
+        // destroyed.  The behavior is undefined if 'isFormattingDeferred()'.
+
+    DeferredMessage& deferredMessage();
+        // Return a reference providing modifiable access to the deferred
+        // message of the log record held by this logging formatter.  The
+        // reference is valid until this logging formatter is destroyed.
 
     // ACCESSORS
     const Category *category() const;
         // Return the address of the non-modifiable category held by this
         // logging formatter.
 
+    bool isFormattingDeferred() const;
+        // Return 'true' if the message of the record held by this logging
+        // formatter is to be captured in its deferred message (rather than
+        // formatted in the buffer held by this logging formatter), and
+        // 'false' otherwise.
+
     int messageBufferLen() const;
         // Return the length (in bytes) of the buffer held by this logging
         // formatter.
@@ -1429,6 +1588,12 @@ char *Log_Formatter::messageBuffer()
     return d_buffer_p;
 }
 
+inline
+DeferredMessage& Log_Formatter::deferredMessage()
+{
+    return d_record_p->deferredMessage();
+}
+
 // ACCESSORS
 inline
 const Category *Log_Formatter::category() const
@@ -1436,6 +1601,12 @@ const Category *Log_Formatter::category() const
     return d_category_p;
 }
 
+inline
+bool Log_Formatter::isFormattingDeferred() const
+{
+    return d_isDeferred;
+}
+
 inline
 int Log_Formatter::messageBufferLen() const
 {
@@ -19,6 +19,7 @@
 #include <ball_categorymanager.h>
 #include <ball_loggermanagerconfiguration.h>
 #include <ball_record.h>
+#include <ball_recordstringformatter.h>
 #include <ball_rule.h>
 #include <ball_predicate.h>
 #include <ball_testobserver.h>
@@ -144,8 +145,9 @@ using bsl::flush;
 //                                          ball::Record *);
 // [27] BALL_LOG_IS_ENABLED(SEVERITY)
 //-----------------------------------------------------------------------------
-// [28] USAGE EXAMPLE
-// [29] RULE-BASED LOGGING USAGE EXAMPLE
+// [28] DEFERRED FORMATTING OF PRINTF-STYLE MACROS
+// [29] USAGE EXAMPLE
+// [30] RULE-BASED LOGGING USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -984,6 +986,63 @@ struct ThreadFunctor {
 
 }  // close namespace BALL_LOG_TEST_CASE_MINUS_1
 
+//=============================================================================
+//                         CASE -2 RELATED ENTITIES
+//-----------------------------------------------------------------------------
+
+namespace BALL_LOG_TEST_CASE_MINUS_2 {
+
+using namespace BloombergLP;
+
+enum {
+    NUM_MSGS = 100000  // number of messages logged by each thread
+};
+
+class NullObserver : public ball::Observer {
+    // This concrete implementation of 'ball::Observer' discards all records
+    // published to it, so that benchmarks measure the cost of logging rather
+    // than that of writing records.
+
+  public:
+    // MANIPULATORS
+    void publish(const ball::Record&, const ball::Context&)
+        // Discard the published record.
+    {
+    }
+};
+
+bslmt::Mutex categoryMutex;
+
+extern "C" {
+void *streamWorkerThread(void *)
+    // Log 'NUM_MSGS' messages using the stream-style macro.
+{
+    categoryMutex.lock();
+    BALL_LOG_SET_CATEGORY("BENCHMARK");
+    categoryMutex.unlock();
+
+    for (int i = 0; i < NUM_MSGS; ++i) {
+        BALL_LOG_INFO << "message " << i << BALL_LOG_END;
+    }
+    return 0;
+}
+
+void *printfWorkerThread(void *)
+    // Log 'NUM_MSGS' messages using the 'printf'-style macro.
+{
+    categoryMutex.lock();
+    BALL_LOG_SET_CATEGORY("BENCHMARK");
+    categoryMutex.unlock();
+
+    for (int i = 0; i < NUM_MSGS; ++i) {
+        BALL_LOG1_INFO("message %d", i);
+    }
+    return 0;
+}
+}  // extern "C"
+
+}  // close namespace BALL_LOG_TEST_CASE_MINUS_2
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -1005,7 +1064,7 @@ int main(int argc, char *argv[])
     TestAllocator ta(veryVeryVerbose); const TestAllocator& TA = ta;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 29: {
+      case 30: {
         //---------------------------------------------------------------------
         // TESTING RULE BASED LOGGING USAGE EXAMPLE
         //
@@ -1078,7 +1137,7 @@ int main(int argc, char *argv[])
 // ERROR example.cpp:129 EXAMPLE.CATEGORY Processing the third message.
 //..
       } break;
-      case 28: {
+      case 29: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -1197,6 +1256,172 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case 28: {
+        // --------------------------------------------------------------------
+        // DEFERRED FORMATTING OF PRINTF-STYLE MACROS
+        //
+        // Concerns:
+        //: 1 When the logger manager is configured for deferred formatting,
+        //:   each 'printf'-style macro publishes a record whose deferred
+        //:   message holds the format and arguments, and whose message
+        //:   attribute is empty.
+        //:
+        //: 2 The rendered text of the deferred message is that which the
+        //:   macro would have formatted immediately.
+        //:
+        //: 3 String arguments are copied when logged.
+        //:
+        //: 4 A record obtained after a deferred record (e.g., by a stream
+        //:   macro) holds no deferred message.
+        //:
+        //: 5 'ball::RecordStringFormatter' renders the deferred message for
+        //:   '%m'.
+        //
+        // Plan:
+        //: 1 Initialize the logger manager for deferred formatting with a test
+        //:   observer, log with each of 'BALL_LOG0' .. 'BALL_LOG9', and
+        //:   verify the published record.  (C-1..2)
+        //:
+        //: 2 Log a string from a buffer, overwrite the buffer, and verify the
+        //:   rendered text.  (C-3)
+        //:
+        //: 3 Log with a stream macro, and verify the published record.  (C-4)
+        //:
+        //: 4 Format a published record with a 'ball::RecordStringFormatter'.
+        //:   (C-5)
+        //
+        // Testing:
+        //   DEFERRED FORMATTING OF PRINTF-STYLE MACROS
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            bsl::cout << "\nDEFERRED FORMATTING OF PRINTF-STYLE MACROS"
+                      << "\n==========================================\n";
+
+        using namespace BloombergLP;
+
+        ball::LoggerManagerConfiguration configuration;
+        configuration.setMessageFormatting(
+                   ball::LoggerManagerConfiguration::e_DEFERRED_FORMATTING);
+
+        ball::LoggerManagerScopedGuard guard(TO, configuration, &ta);
+
+        ASSERT(ball::LoggerManagerConfiguration::e_DEFERRED_FORMATTING ==
+                         ball::LoggerManager::singleton().messageFormatting());
+
+        ball::Administration::addCategory("deferred",
+                                          ball::Severity::e_TRACE,
+                                          ball::Severity::e_TRACE,
+                                          0,
+                                          0);
+        BALL_LOG_SET_CATEGORY("deferred");
+
+        const int INFO = ball::Severity::e_INFO;
+
+        static const char *const FORMAT[] = {
+            "m",
+            "m:%d",
+            "m:%d:%d",
+            "m:%d:%d:%d",
+            "m:%d:%d:%d:%d",
+            "m:%d:%d:%d:%d:%d",
+            "m:%d:%d:%d:%d:%d:%d",
+            "m:%d:%d:%d:%d:%d:%d:%d",
+            "m:%d:%d:%d:%d:%d:%d:%d:%d",
+            "m:%d:%d:%d:%d:%d:%d:%d:%d:%d"
+        };
+
+        const char *const MESSAGE[] = {
+            "m",
+            "m:1",
+            "m:1:2",
+            "m:1:2:3",
+            "m:1:2:3:4",
+            "m:1:2:3:4:5",
+            "m:1:2:3:4:5:6",
+            "m:1:2:3:4:5:6:7",
+            "m:1:2:3:4:5:6:7:8",
+            "m:1:2:3:4:5:6:7:8:9"
+        };
+
+        if (veryVerbose) bsl::cout << "\tTesting 'BALL_LOG0' .. 'BALL_LOG9'."
+                                   << bsl::endl;
+
+        for (int n = 0; n <= 9; ++n) {
+            const int numPublished = TO->numPublishedRecords();
+
+            switch (n) {
+              case 0: BALL_LOG0(INFO, FORMAT[0]); break;
+              case 1: BALL_LOG1(INFO, FORMAT[1], 1); break;
+              case 2: BALL_LOG2(INFO, FORMAT[2], 1, 2); break;
+              case 3: BALL_LOG3(INFO, FORMAT[3], 1, 2, 3); break;
+              case 4: BALL_LOG4(INFO, FORMAT[4], 1, 2, 3, 4); break;
+              case 5: BALL_LOG5(INFO, FORMAT[5], 1, 2, 3, 4, 5); break;
+              case 6: BALL_LOG6(INFO, FORMAT[6], 1, 2, 3, 4, 5, 6); break;
+              case 7: BALL_LOG7(INFO, FORMAT[7], 1, 2, 3, 4, 5, 6, 7); break;
+              case 8: {
+                BALL_LOG8(INFO, FORMAT[8], 1, 2, 3, 4, 5, 6, 7, 8);
+              } break;
+              case 9: {
+                BALL_LOG9(INFO, FORMAT[9], 1, 2, 3, 4, 5, 6, 7, 8, 9);
+              } break;
+            }
+
+            LOOP_ASSERT(n, numPublished + 1 == TO->numPublishedRecords());
+
+            const ball::Record& record = TO->lastPublishedRecord();
+
+            LOOP_ASSERT(n, record.deferredMessage().hasFormat());
+            LOOP_ASSERT(n, FORMAT[n] == record.deferredMessage().format());
+            LOOP_ASSERT(n, 0 == record.fixedFields().messageRef().length());
+
+            bsl::string text;
+            record.messageText(&text);
+            LOOP2_ASSERT(n, text, MESSAGE[n] == text);
+        }
+
+        if (veryVerbose) bsl::cout << "\tTesting argument types."
+                                   << bsl::endl;
+        {
+            char buffer[16];
+            bsl::strcpy(buffer, "IBM");
+
+            const bsls::Types::Int64 quantity = -1000000000000LL;
+
+            BALL_LOG6(INFO, "%s %u %.1f %c %lld %hu",
+                      buffer, 7u, 2.5f, 'x', quantity, 65537);
+
+            bsl::strcpy(buffer, "XXX");
+
+            bsl::string text;
+            TO->lastPublishedRecord().messageText(&text);
+            LOOP_ASSERT(text, "IBM 7 2.5 x -1000000000000 1" == text);
+        }
+
+        if (veryVerbose) bsl::cout << "\tTesting record reuse." << bsl::endl;
+        {
+            BALL_LOG_INFO << "streamed" << BALL_LOG_END;
+
+            const ball::Record& record = TO->lastPublishedRecord();
+
+            ASSERT(!record.deferredMessage().hasFormat());
+
+            bsl::string text;
+            record.messageText(&text);
+            LOOP_ASSERT(text, "streamed" == text);
+        }
+
+        if (veryVerbose) bsl::cout << "\tTesting 'RecordStringFormatter'."
+                                   << bsl::endl;
+        {
+            BALL_LOG2(INFO, "%s-%d", "abc", 12);
+
+            ball::RecordStringFormatter formatter("<%m>");
+            bsl::ostringstream          os;
+            formatter(os, TO->lastPublishedRecord());
+            LOOP_ASSERT(os.str(), "<abc-12>" == os.str());
+        }
+      } break;
       case 27: {
         // --------------------------------------------------------------------
         // BALL_LOG_IS_ENABLED(SEVERITY);
@@ -6087,6 +6312,68 @@ int main(int argc, char *argv[])
 
         // just exit the program, which will kill the threads
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // MULTI-THREADED LOGGING THROUGHPUT BENCHMARK
+        //
+        // Concerns:
+        //: 1 The throughput of logging through the default logger, using
+        //:   both stream-style and 'printf'-style macros, scales with the
+        //:   number of logging threads.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, and 8 threads, have each thread log 'NUM_MSGS'
+        //:   messages to a category whose messages are passed to an observer
+        //:   that discards them, and report the number of messages logged per
+        //:   second.  (C-1)
+        //
+        // Testing:
+        //   MULTI-THREADED LOGGING THROUGHPUT BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << bsl::endl
+                               << "MULTI-THREADED LOGGING THROUGHPUT BENCHMARK"
+                               << bsl::endl
+                               << "==========================================="
+                               << bsl::endl;
+
+        using namespace BALL_LOG_TEST_CASE_MINUS_2;
+
+        NullObserver observer;
+
+        ball::LoggerManagerConfiguration configuration;
+        configuration.setDefaultThresholdLevelsIfValid(0,     // record level
+                                                       INFO,  // pass level
+                                                       0,     // trigger level
+                                                       0);    // trigger-all
+
+        ball::LoggerManagerScopedGuard guard(&observer, configuration);
+
+        const int NUM_THREADS[] = { 1, 2, 4, 8 };
+        const int NUM_RUNS      = sizeof NUM_THREADS / sizeof *NUM_THREADS;
+
+        for (int i = 0; i < NUM_RUNS; ++i) {
+            const int numThreads = NUM_THREADS[i];
+            const double numMsgs = static_cast<double>(numThreads) * NUM_MSGS;
+
+            bsls::Types::Int64 t = bsls::TimeUtil::getTimer();
+            executeInParallel(numThreads, streamWorkerThread);
+            const double streamSeconds =
+                        static_cast<double>(bsls::TimeUtil::getTimer() - t)
+                                                                       / 1.0e9;
+
+            t = bsls::TimeUtil::getTimer();
+            executeInParallel(numThreads, printfWorkerThread);
+            const double printfSeconds =
+                        static_cast<double>(bsls::TimeUtil::getTimer() - t)
+                                                                       / 1.0e9;
+
+            bsl::cout << "threads = " << numThreads
+                      << "\tstream: "  << numMsgs / streamSeconds
+                      << " msgs/sec\tprintf: " << numMsgs / printfSeconds
+                      << " msgs/sec" << bsl::endl;
+        }
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
@@ -25,6 +25,7 @@ BSLS_IDENT_RCSID(ball_loggermanager_cpp,"$Id$ $CSID$")
 #include <bslma_default.h>
 #include <bslma_managedptr.h>
 
+#include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
 #include <bslmt_once.h>
 #include <bslmt_qlock.h>
@@ -34,6 +35,7 @@ BSLS_IDENT_RCSID(ball_loggermanager_cpp,"$Id$ $CSID$")
 #include <bslmt_writelockguard.h>
 
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_log.h>
 #include <bsls_objectbuffer.h>
 #include <bsls_platform.h>
@@ -95,6 +97,33 @@ BSLS_IDENT_RCSID(ball_loggermanager_cpp,"$Id$ $CSID$")
 //        // ...
 //    }
 //..
+//
+///Per-Thread Message Buffers and Record Caches
+///--------------------------------------------
+// A single logger (typically the default logger of the logger manager) is
+// usually shared by every thread in a program.  To avoid serializing those
+// threads on a single message buffer, and on the free list of a single record
+// pool, each thread logging through a logger is given a
+// 'ball::Logger_ThreadCache' holding its own message buffer (allocated on the
+// first call to 'obtainMessageBuffer') and a small stack of recycled records.
+// The caches of a thread (one per logger it uses) are kept in a list stored
+// in thread-specific storage under a single process-wide key, and are used
+// only by their owning thread; records released by a thread having no cache
+// for the logger (e.g., the publication thread of an asynchronous observer),
+// or whose cache is full, are returned to the shared record pool.
+//
+// Each logger also keeps a list of its thread caches.  These lists are
+// guarded by a single lock that is acquired only when a cache is created or
+// destroyed, by 'numRecordsInUse', and by the destructor of a logger.  Each
+// cache is owned by its thread, and is destroyed only by that thread (when it
+// exits, or when it next creates a cache, or destroys a logger).  The
+// destructor of a logger does not destroy the caches of other threads; under
+// the lock, it returns their records and message buffers to the logger and
+// marks them as orphaned.  Since the key is never deleted, a thread that is
+// exiting while a logger is destroyed finds its cache either still attached
+// to the logger or already orphaned, and never a dangling one.  Should the
+// key or the cache of a thread fail to be created, the logger falls back to
+// the shared message buffer and record pool.
 //-----------------------------------------------------------------------------
 
 namespace BloombergLP {
@@ -233,6 +262,416 @@ void copyAttributesWithoutMessage(ball::Record                  *record,
 
 }  // close unnamed namespace
 
+                          // ========================
+                          // class Logger_ThreadCache
+                          // ========================
+
+class Logger_ThreadCache {
+    // This component-private class holds the message buffer and the cache of
+    // recycled records used by a single thread of execution when logging
+    // through a particular 'Logger'.  A thread cache is accessed only by its
+    // owning thread, except that 'numCachedRecords' and 'orphanAll' may be
+    // called from any thread.  The caches of a thread form a list held in
+    // thread-specific storage under a process-wide key that is never deleted,
+    // so that each cache is destroyed by its owning thread, and by no other.
+
+  public:
+    // TYPES
+    enum {
+        k_MAX_NUM_RECORDS = 16  // maximum number of cached records
+    };
+
+  private:
+    // DATA
+    bsls::AtomicPointer<Logger>
+                        d_logger_p;    // logger of this cache (held), or 0
+                                       // if this cache is orphaned
+
+    Record             *d_records[k_MAX_NUM_RECORDS];
+                                       // recycled records (owned by the
+                                       // record pool of 'd_logger_p')
+
+    bsls::AtomicInt     d_numRecords;  // number of records in 'd_records'
+
+    char               *d_buffer_p;    // message buffer (owned), allocated
+                                       // on first use
+
+    bslmt::Mutex        d_bufferMutex; // mutex handed out with 'd_buffer_p'
+
+    Logger_ThreadCache *d_next_p;      // next cache of 'd_logger_p'
+
+    Logger_ThreadCache *d_prev_p;      // previous cache of 'd_logger_p'
+
+    Logger_ThreadCache *d_nextInThread_p;
+                                       // next cache of the owning thread
+
+    bslma::Allocator   *d_allocator_p; // allocator of this object (held)
+
+    // NOT IMPLEMENTED
+    Logger_ThreadCache(const Logger_ThreadCache&);
+    Logger_ThreadCache& operator=(const Logger_ThreadCache&);
+
+    // PRIVATE CLASS METHODS
+    static void removeOrphans();
+        // Destroy the orphaned caches of the calling thread.  The behavior is
+        // undefined unless the calling thread holds 's_threadCachesLock'.
+
+    // PRIVATE MANIPULATORS
+    void orphan();
+        // Unlink this cache from the list of caches of its logger, return the
+        // cached records to the record pool of the logger, release the
+        // message buffer, and reset the logger of this cache to 0.  This
+        // method has no effect if this cache is already orphaned.  The
+        // behavior is undefined unless the calling thread holds
+        // 's_threadCachesLock'.
+
+  public:
+    // CLASS METHODS
+    static bool initialize();
+        // Create, if not already done, the key of the thread-specific lists of
+        // caches.  Return 'true' if the key is available, and 'false'
+        // otherwise.
+
+    static Logger_ThreadCache *lookup(const Logger& logger);
+        // Return the address of the cache of the calling thread for the
+        // specified 'logger', or 0 if the calling thread has no such cache.
+
+    static Logger_ThreadCache *lookupOrCreate(Logger *logger);
+        // Return the address of the cache of the calling thread for the
+        // specified 'logger', creating the cache if the calling thread has
+        // none.  Return 0 if the cache could not be created.
+
+    static void releaseRecord(Logger *logger, Record *record);
+        // Return the specified 'record', obtained from the specified 'logger',
+        // to the cache of the calling thread for 'logger' or, if the calling
+        // thread has no such cache or that cache is full, to the record pool
+        // of 'logger'.
+
+    static void destroyList(Logger_ThreadCache *head);
+        // Orphan and destroy the caches in the list having the specified
+        // 'head'.  The behavior is undefined unless 'head' is the list of
+        // caches of the calling thread, which is exiting.
+
+    static void orphanAll(Logger *logger);
+        // Orphan every cache of the specified 'logger'.  The caches themselves
+        // are destroyed by their owning threads.
+
+    static int numCachedRecords(const Logger& logger);
+        // Return a snapshot of the number of records held by the caches of the
+        // specified 'logger'.
+
+    // CREATORS
+    Logger_ThreadCache(Logger *logger, bslma::Allocator *basicAllocator);
+        // Create an empty cache for the specified 'logger', using the
+        // specified 'basicAllocator' to supply memory for this object.  Note
+        // that the message buffer is allocated by the allocator of 'logger'.
+
+    ~Logger_ThreadCache();
+        // Destroy this object.  The behavior is undefined unless this cache is
+        // orphaned.
+
+    // MANIPULATORS
+    char *obtainMessageBuffer(bslmt::Mutex **mutex);
+        // Lock the message buffer of this cache, allocating it if necessary,
+        // load the address of its mutex into the specified '*mutex', and
+        // return the address of the buffer.
+
+    Record *popRecord();
+        // Remove a record from this cache and return its address, or return 0
+        // if this cache is empty.
+
+    bool pushRecord(Record *record);
+        // Add the specified 'record' to this cache and return 'true', or
+        // return 'false', with no effect, if this cache is full.
+};
+
+namespace {
+
+bslmt::QLock           s_threadCachesLock = BSLMT_QLOCK_INITIALIZER;
+    // lock protecting the lists of caches of all loggers, and the logger of
+    // each cache
+
+bslmt::ThreadUtil::Key s_threadCachesKey;
+    // key of the thread-specific lists of caches, never deleted
+
+bool                   s_hasThreadCachesKey = false;
+    // 'true' if the creation of 's_threadCachesKey' succeeded
+
+extern "C" void ballLoggerThreadCacheCleanup(void *head)
+    // Destroy the list of caches having the specified 'head'.  Note that this
+    // function is installed as the cleanup function of the thread-specific
+    // storage key of the caches, and is invoked when a thread having a cache
+    // exits.
+{
+    Logger_ThreadCache::destroyList(static_cast<Logger_ThreadCache *>(head));
+}
+
+class RecordDeleter {
+    // This class provides a deleter for the shared pointers to records handed
+    // to record buffers and observers, returning each record to its logger.
+
+    // DATA
+    Logger *d_logger_p;  // logger from which the record was obtained (held)
+
+  public:
+    // CREATORS
+    explicit RecordDeleter(Logger *logger)
+    : d_logger_p(logger)
+        // Create a deleter returning records to the specified 'logger'.
+    {
+    }
+
+    // ACCESSORS
+    void operator()(Record *record) const
+        // Return the specified 'record' to the logger of this deleter.
+    {
+        Logger_ThreadCache::releaseRecord(d_logger_p, record);
+    }
+};
+
+}  // close unnamed namespace
+
+                          // ------------------------
+                          // class Logger_ThreadCache
+                          // ------------------------
+
+// PRIVATE CLASS METHODS
+void Logger_ThreadCache::removeOrphans()
+{
+    Logger_ThreadCache *head = static_cast<Logger_ThreadCache *>(
+                            bslmt::ThreadUtil::getSpecific(s_threadCachesKey));
+
+    // Remove the orphans following the head first, so that the head is
+    // replaced, below, only if the list has no other orphan.
+
+    Logger_ThreadCache *cache = head;
+    while (cache && cache->d_nextInThread_p) {
+        Logger_ThreadCache *next = cache->d_nextInThread_p;
+        if (next->d_logger_p.loadRelaxed()) {
+            cache = next;
+        }
+        else {
+            cache->d_nextInThread_p = next->d_nextInThread_p;
+            next->d_allocator_p->deleteObjectRaw(next);
+        }
+    }
+
+    if (head
+     && !head->d_logger_p.loadRelaxed()
+     && 0 == bslmt::ThreadUtil::setSpecific(s_threadCachesKey,
+                                            head->d_nextInThread_p)) {
+        head->d_allocator_p->deleteObjectRaw(head);
+    }
+}
+
+// PRIVATE MANIPULATORS
+void Logger_ThreadCache::orphan()
+{
+    Logger *logger = d_logger_p.loadRelaxed();
+    if (!logger) {
+        return;                                                       // RETURN
+    }
+
+    if (d_prev_p) {
+        d_prev_p->d_next_p = d_next_p;
+    }
+    else {
+        logger->d_threadCaches_p = d_next_p;
+    }
+    if (d_next_p) {
+        d_next_p->d_prev_p = d_prev_p;
+    }
+    d_next_p = 0;
+    d_prev_p = 0;
+
+    const int numRecords = d_numRecords.loadRelaxed();
+    for (int i = 0; i < numRecords; ++i) {
+        logger->d_recordPool.releaseObject(d_records[i]);
+    }
+    d_numRecords.storeRelaxed(0);
+
+    if (d_buffer_p) {
+        logger->d_allocator_p->deallocate(d_buffer_p);
+        d_buffer_p = 0;
+    }
+
+    d_logger_p.storeRelaxed(0);
+}
+
+// CLASS METHODS
+bool Logger_ThreadCache::initialize()
+{
+    BSLMT_ONCE_DO {
+        s_hasThreadCachesKey = 0 == bslmt::ThreadUtil::createKey(
+                                                &s_threadCachesKey,
+                                                &ballLoggerThreadCacheCleanup);
+    }
+    return s_hasThreadCachesKey;
+}
+
+inline
+Logger_ThreadCache *Logger_ThreadCache::lookup(const Logger& logger)
+{
+    if (!logger.d_hasThreadCacheKey) {
+        return 0;                                                     // RETURN
+    }
+    Logger_ThreadCache *cache = static_cast<Logger_ThreadCache *>(
+                            bslmt::ThreadUtil::getSpecific(s_threadCachesKey));
+    while (cache && &logger != cache->d_logger_p.loadRelaxed()) {
+        cache = cache->d_nextInThread_p;
+    }
+    return cache;
+}
+
+Logger_ThreadCache *Logger_ThreadCache::lookupOrCreate(Logger *logger)
+{
+    BSLS_ASSERT(logger);
+
+    if (!logger->d_hasThreadCacheKey) {
+        return 0;                                                     // RETURN
+    }
+
+    Logger_ThreadCache *cache = lookup(*logger);
+    if (cache) {
+        return cache;                                                 // RETURN
+    }
+
+    bslma::Allocator *allocator = bslma::Default::globalAllocator();
+    cache = new (*allocator) Logger_ThreadCache(logger, allocator);
+
+    bslmt::QLockGuard guard(&s_threadCachesLock);
+
+    removeOrphans();
+
+    cache->d_nextInThread_p = static_cast<Logger_ThreadCache *>(
+                            bslmt::ThreadUtil::getSpecific(s_threadCachesKey));
+    if (0 != bslmt::ThreadUtil::setSpecific(s_threadCachesKey, cache)) {
+        cache->d_logger_p.storeRelaxed(0);
+        allocator->deleteObjectRaw(cache);
+        return 0;                                                     // RETURN
+    }
+
+    cache->d_next_p = logger->d_threadCaches_p;
+    if (logger->d_threadCaches_p) {
+        logger->d_threadCaches_p->d_prev_p = cache;
+    }
+    logger->d_threadCaches_p = cache;
+
+    return cache;
+}
+
+void Logger_ThreadCache::releaseRecord(Logger *logger, Record *record)
+{
+    BSLS_ASSERT(logger);
+    BSLS_ASSERT(record);
+
+    Logger_ThreadCache *cache = lookup(*logger);
+    if (!cache || !cache->pushRecord(record)) {
+        logger->d_recordPool.releaseObject(record);
+    }
+}
+
+void Logger_ThreadCache::destroyList(Logger_ThreadCache *head)
+{
+    bslmt::QLockGuard guard(&s_threadCachesLock);
+
+    while (head) {
+        Logger_ThreadCache *cache = head;
+        head = head->d_nextInThread_p;
+
+        cache->orphan();
+        cache->d_allocator_p->deleteObjectRaw(cache);
+    }
+}
+
+void Logger_ThreadCache::orphanAll(Logger *logger)
+{
+    BSLS_ASSERT(logger);
+
+    bslmt::QLockGuard guard(&s_threadCachesLock);
+
+    while (logger->d_threadCaches_p) {
+        logger->d_threadCaches_p->orphan();
+    }
+
+    // The calling thread may never exit (e.g., the main thread), so destroy
+    // its orphaned caches now.
+
+    removeOrphans();
+}
+
+int Logger_ThreadCache::numCachedRecords(const Logger& logger)
+{
+    bslmt::QLockGuard guard(&s_threadCachesLock);
+
+    int numRecords = 0;
+    for (const Logger_ThreadCache *cache = logger.d_threadCaches_p;
+         cache;
+         cache = cache->d_next_p) {
+        numRecords += cache->d_numRecords.loadRelaxed();
+    }
+    return numRecords;
+}
+
+// CREATORS
+Logger_ThreadCache::Logger_ThreadCache(Logger           *logger,
+                                       bslma::Allocator *basicAllocator)
+: d_logger_p(logger)
+, d_numRecords(0)
+, d_buffer_p(0)
+, d_next_p(0)
+, d_prev_p(0)
+, d_nextInThread_p(0)
+, d_allocator_p(basicAllocator)
+{
+    BSLS_ASSERT(logger);
+    BSLS_ASSERT(d_allocator_p);
+}
+
+Logger_ThreadCache::~Logger_ThreadCache()
+{
+    BSLS_ASSERT(!d_logger_p.loadRelaxed());
+    BSLS_ASSERT(!d_buffer_p);
+}
+
+// MANIPULATORS
+char *Logger_ThreadCache::obtainMessageBuffer(bslmt::Mutex **mutex)
+{
+    BSLS_ASSERT(mutex);
+
+    if (!d_buffer_p) {
+        Logger *logger = d_logger_p.loadRelaxed();
+        d_buffer_p = static_cast<char *>(
+                 logger->d_allocator_p->allocate(logger->d_scratchBufferSize));
+    }
+    d_bufferMutex.lock();
+    *mutex = &d_bufferMutex;
+    return d_buffer_p;
+}
+
+inline
+Record *Logger_ThreadCache::popRecord()
+{
+    const int numRecords = d_numRecords.loadRelaxed();
+    if (0 == numRecords) {
+        return 0;                                                     // RETURN
+    }
+    d_numRecords.storeRelaxed(numRecords - 1);
+    return d_records[numRecords - 1];
+}
+
+inline
+bool Logger_ThreadCache::pushRecord(Record *record)
+{
+    const int numRecords = d_numRecords.loadRelaxed();
+    if (k_MAX_NUM_RECORDS == numRecords) {
+        return false;                                                 // RETURN
+    }
+    d_records[numRecords] = record;
+    d_numRecords.storeRelaxed(numRecords + 1);
+    return true;
+}
+
                            // ------------
                            // class Logger
                            // ------------
@@ -253,6 +692,8 @@ Logger::Logger(
 , d_populator(populator)
 , d_publishAll(publishAllCallback)
 , d_scratchBufferSize(scratchBufferSize)
+, d_hasThreadCacheKey(false)
+, d_threadCaches_p(0)
 , d_logOrder(logOrder)
 , d_triggerMarkers(triggerMarkers)
 , d_allocator_p(globalAllocator)
@@ -263,6 +704,8 @@ Logger::Logger(
 
     // 'snprintf' message buffer
     d_scratchBuffer_p = (char *)d_allocator_p->allocate(d_scratchBufferSize);
+
+    d_hasThreadCacheKey = Logger_ThreadCache::initialize();
 }
 
 Logger::~Logger()
@@ -274,6 +717,10 @@ Logger::~Logger()
     BSLS_ASSERT(d_allocator_p);
 
     d_recordBuffer_p->removeAll();
+
+    if (d_hasThreadCacheKey) {
+        Logger_ThreadCache::orphanAll(this);
+    }
     d_allocator_p->deallocate(d_scratchBuffer_p);
 }
 
@@ -327,7 +774,9 @@ void Logger::logMessage(const Category&            category,
         d_populator(&record->customFields());
     }
 
-    bsl::shared_ptr<Record> handle(record, &d_recordPool, d_allocator_p);
+    bsl::shared_ptr<Record> handle(record,
+                                   RecordDeleter(this),
+                                   d_allocator_p);
 
     if (levels.recordLevel() >= severity) {
         d_recordBuffer_p->pushBack(handle);
@@ -356,7 +805,7 @@ void Logger::logMessage(const Category&            category,
                                        record->fixedFields().lineNumber());
 
             bsl::shared_ptr<Record> handle(marker,
-                                           &d_recordPool,
+                                           RecordDeleter(this),
                                            d_allocator_p);
 
             copyAttributesWithoutMessage(handle.get(), record->fixedFields());
@@ -390,7 +839,7 @@ void Logger::logMessage(const Category&            category,
                                        record->fixedFields().lineNumber());
 
             bsl::shared_ptr<Record> handle(marker,
-                                           &d_recordPool,
+                                           RecordDeleter(this),
                                            d_allocator_p);
 
             copyAttributesWithoutMessage(handle.get(), record->fixedFields());
@@ -418,9 +867,14 @@ void Logger::logMessage(const Category&            category,
 // MANIPULATORS
 Record *Logger::getRecord(const char *file, int line)
 {
-    Record *record = d_recordPool.getObject();
+    Logger_ThreadCache *cache  = Logger_ThreadCache::lookupOrCreate(this);
+    Record             *record = cache ? cache->popRecord() : 0;
+    if (!record) {
+        record = d_recordPool.getObject();
+    }
     record->customFields().removeAll();
     record->fixedFields().clearMessage();
+    record->deferredMessage().reset();
     record->fixedFields().setFileName(file);
     record->fixedFields().setLineNumber(line);
     return record;
@@ -451,7 +905,7 @@ void Logger::logMessage(const Category&  category,
 {
     ThresholdAggregate thresholds(0, 0, 0, 0);
     if (!isCategoryEnabled(&thresholds, category, severity)) {
-        d_recordPool.deleteObject(record);
+        Logger_ThreadCache::releaseRecord(this, record);
         return;                                                       // RETURN
     }
     logMessage(category, severity, record, thresholds);
@@ -469,6 +923,12 @@ void Logger::removeAll()
 
 char *Logger::obtainMessageBuffer(bslmt::Mutex **mutex, int *bufferSize)
 {
+    Logger_ThreadCache *cache = Logger_ThreadCache::lookupOrCreate(this);
+    if (cache) {
+        *bufferSize = d_scratchBufferSize;
+        return cache->obtainMessageBuffer(mutex);                     // RETURN
+    }
+
     d_scratchBufferMutex.lock();
     *mutex = &d_scratchBufferMutex;
     *bufferSize = d_scratchBufferSize;
@@ -484,8 +944,9 @@ int Logger::messageBufferSize() const
 
 int Logger::numRecordsInUse() const
 {
-    return d_recordPool.numObjects() -
-           d_recordPool.numAvailableObjects();
+    return d_recordPool.numObjects()
+         - d_recordPool.numAvailableObjects()
+         - Logger_ThreadCache::numCachedRecords(*this);
 }
 
                            // -------------------
@@ -736,6 +1197,7 @@ LoggerManager::LoggerManager(
 , d_defaultLoggers(bslma::Default::globalAllocator(globalAllocator))
 , d_logOrder(configuration.logOrder())
 , d_triggerMarkers(configuration.triggerMarkers())
+, d_messageFormatting(configuration.messageFormatting())
 , d_allocator_p(bslma::Default::globalAllocator(globalAllocator))
 {
     BSLS_ASSERT(observer);
@@ -317,6 +317,14 @@ BSLS_IDENT("$Id: $")
 // loggers.  Note that each thread may have at most one logger, but a single
 // logger may be used by any number of threads.
 //
+// A logger shared by several threads does not serialize the formatting of
+// their messages: each thread logging through a logger is supplied its own
+// message buffer (see 'obtainMessageBuffer') and recycles records through its
+// own small cache of records, falling back to the object pool shared by all
+// threads only when that cache is empty (or full).  The per-thread buffer and
+// record cache are reclaimed when the thread exits or when the logger is
+// destroyed, whichever happens first.
+//
 // Multi-threaded users of logging may prefer to allocate and install one
 // logger per thread in order to take advantage of the "trace-back" feature
 // described above on a per-thread basis.  In the event of an error condition
@@ -910,6 +918,7 @@ namespace BloombergLP {
 namespace ball {
 
 class LoggerManager;
+class Logger_ThreadCache;
 class Observer;
 class RecordBuffer;
 
@@ -953,13 +962,22 @@ class Logger {
                           d_publishAll;         // publishAll callback functor
 
     char                 *d_scratchBuffer_p;    // buffer for formatting log
-                                                // messages (owned)
+                                                // messages, used only if
+                                                // per-thread caches are
+                                                // unavailable (owned)
 
     int                   d_scratchBufferSize;  // message buffer size (bytes)
 
     bslmt::Mutex          d_scratchBufferMutex; // ensure thread-safety of
                                                 // message buffer
 
+    bool                  d_hasThreadCacheKey;  // 'true' if per-thread
+                                                // caches are available
+
+    Logger_ThreadCache   *d_threadCaches_p;     // list of per-thread caches
+                                                // (held, owned by their
+                                                // threads)
+
     LoggerManagerConfiguration::LogOrder
                           d_logOrder;           // logging order
 
@@ -971,6 +989,7 @@ class Logger {
 
     // FRIENDS
     friend class LoggerManager;
+    friend class Logger_ThreadCache;
 
     // NOT IMPLEMENTED
     Logger(const Logger&);
@@ -1039,8 +1058,9 @@ class Logger {
     // MANIPULATORS
     Record *getRecord(const char *file, int line);
         // Return the address of a modifiable record having the specified
-        // 'file' and 'line' attributes, and retrieved from the object pool
-        // managed by this logger.
+        // 'file' and 'line' attributes, and retrieved from the per-thread
+        // record cache of the calling thread or, if that cache is empty, from
+        // the object pool managed by this logger.
 
     void logMessage(const Category&  category,
                     int              severity,
@@ -1108,9 +1128,12 @@ class Logger {
         // the buffer remains locked by this thread of execution, until this
         // thread calls 'mutex->unlock()'.  The behavior is undefined if this
         // thread of execution currently holds a lock on the buffer.  Note that
-        // the buffer is intended to be used *only* for formatting log messages
-        // immediately before calling 'logMessage'; other use may adversely
-        // affect performance for the entire program.
+        // each thread of execution is supplied its own buffer, so that threads
+        // formatting messages concurrently do not contend for the buffer
+        // (unless the per-thread buffer could not be created, in which case a
+        // buffer shared by all threads is supplied).  Also note that the
+        // buffer is intended to be used *only* for formatting log messages
+        // immediately before calling 'logMessage'.
 
 
     // ACCESSORS
@@ -1121,7 +1144,8 @@ class Logger {
     int numRecordsInUse() const;
         // Return a *snapshot* of number of records that have been dispensed by
         // 'getRecord' but have not yet been supplied (returned) using
-        // 'logRecord'.
+        // 'logRecord'.  Note that records held in the per-thread record
+        // caches of this logger are not in use.
 };
 
                            // ===================
@@ -1227,6 +1251,11 @@ class LoggerManager {
     LoggerManagerConfiguration::TriggerMarkers
                            d_triggerMarkers;     // trigger markers
 
+    LoggerManagerConfiguration::MessageFormatting
+                           d_messageFormatting;  // when messages of the
+                                                 // 'printf'-style macros are
+                                                 // formatted
+
     bslma::Allocator      *d_allocator_p;        // memory allocator (held,
                                                  // not owned)
 
@@ -1586,6 +1615,13 @@ class LoggerManager {
         // Return the default trigger-all threshold level of this logger
         // manager.
 
+    LoggerManagerConfiguration::MessageFormatting messageFormatting() const;
+        // Return the message formatting mode of this logger manager, which
+        // determines whether the 'printf'-style logging macros format the
+        // message of a record when it is logged, or capture the format and
+        // arguments in the deferred message of the record (see
+        // 'ball_loggermanagerconfiguration').
+
     int maxNumCategories() const;
         // Return the current capacity of the category registry of this logger
         // manager.  A capacity of 0 implies that no limit will be imposed;
@@ -1686,6 +1722,13 @@ void LoggerManager::visitCategories(const CATEGORY_VISITOR& visitor)
 }
 
 // ACCESSORS
+inline
+LoggerManagerConfiguration::MessageFormatting
+LoggerManager::messageFormatting() const
+{
+    return d_messageFormatting;
+}
+
 template <class CATEGORY_VISITOR>
 inline
 void LoggerManager::visitCategories(const CATEGORY_VISITOR& visitor) const
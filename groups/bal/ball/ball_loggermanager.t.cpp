@@ -103,6 +103,8 @@ using namespace bdlf::PlaceHolders;
 // [ 7] void publish();
 // [ 7] void removeAll();
 // [ 7] char *obtainMessageBuffer(Mutex **mutex, int *bufferSize);
+// [26] char *obtainMessageBuffer(Mutex **mutex, int *bufferSize);
+// [26] ball::Record *getRecord(const char *file, int line);
 // [ 7] char *messageBuffer();
 // [ 7] int messageBufferSize() const;
 // [27] int numRecordsInUse() const;
@@ -166,10 +168,11 @@ using namespace bdlf::PlaceHolders;
 // [21] TESTING: isCategoryEnabled (RULE BASED LOGGING)
 // [22] TESTING: 'ball::Logger::logMessage' (RULE BASED LOGGING)
 // [23] TESTING: '~LoggerManager' calls 'Observer::releaseRecords'
-// [26] USAGE EXAMPLE #1
-// [27] USAGE EXAMPLE #2
-// [28] USAGE EXAMPLE #3
-// [29] USAGE EXAMPLE #4
+// [26] TESTING: PER-THREAD MESSAGE BUFFERS AND RECORD CACHES
+// [27] USAGE EXAMPLE #1
+// [28] USAGE EXAMPLE #2
+// [29] USAGE EXAMPLE #3
+// [30] USAGE EXAMPLE #4
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -1287,6 +1290,75 @@ extern "C" {
 
 }  // close namespace BALL_LOGGERMANAGER_TEST_CASE_24
 
+// ============================================================================
+//                         CASE 26 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace BALL_LOGGERMANAGER_TEST_CASE_26 {
+enum {
+    NUM_THREADS = 4 // number of threads
+};
+ball::Logger   *logger;
+ball::Category *category;
+bslmt::Barrier  barrier(NUM_THREADS);
+bslmt::Barrier  exitBarrier(NUM_THREADS + 1);
+char           *buffers[NUM_THREADS];
+bool            isSameBuffer[NUM_THREADS];
+bool            isRecycled[NUM_THREADS];
+
+extern "C" {
+    void *workerThreadCache(void *arg)
+        // Obtain a message buffer from 'logger' and hold it until every
+        // thread holds its own, then release it and verify that the buffer
+        // obtained next by this thread is the same.  Also verify that a record
+        // returned to 'logger' by this thread is supplied by the next call to
+        // 'getRecord' made by this thread.
+    {
+        const int id = static_cast<int>(bsls::Types::IntPtr(arg));
+
+        bslmt::Mutex *mutex      = 0;
+        int           bufferSize = 0;
+
+        buffers[id] = logger->obtainMessageBuffer(&mutex, &bufferSize);
+        barrier.wait();
+        mutex->unlock();
+
+        char *buffer = logger->obtainMessageBuffer(&mutex, &bufferSize);
+        isSameBuffer[id] = buffer == buffers[id];
+        mutex->unlock();
+
+        ball::Record *record = logger->getRecord(__FILE__, __LINE__);
+        logger->logMessage(*category, ball::Severity::e_TRACE, record);
+
+        ball::Record *next = logger->getRecord(__FILE__, __LINE__);
+        isRecycled[id] = next == record;
+        logger->logMessage(*category, ball::Severity::e_TRACE, next);
+
+        return 0;
+    }
+
+    void *workerExit(void *arg)
+        // Obtain a message buffer and a cached record from 'logger', then
+        // signal 'exitBarrier' and exit while 'logger' is being destroyed.
+    {
+        (void)arg;
+
+        bslmt::Mutex *mutex      = 0;
+        int           bufferSize = 0;
+
+        logger->obtainMessageBuffer(&mutex, &bufferSize);
+        mutex->unlock();
+
+        ball::Record *record = logger->getRecord(__FILE__, __LINE__);
+        logger->logMessage(*category, ball::Severity::e_TRACE, record);
+
+        exitBarrier.wait();
+        return 0;
+    }
+}  // extern "C"
+
+}  // close namespace BALL_LOGGERMANAGER_TEST_CASE_26
+
 //=============================================================================
 //                  GLOBAL HELPER FUNCTIONS FOR TESTING
 //-----------------------------------------------------------------------------
@@ -1339,7 +1411,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 29: {
+      case 30: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE #4
         //
@@ -1375,7 +1447,7 @@ int main(int argc, char *argv[])
         }
 
       } break;
-      case 28: {
+      case 29: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE #3
         //
@@ -1420,7 +1492,7 @@ int main(int argc, char *argv[])
         }
 
       } break;
-      case 27: {
+      case 28: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE #2
         //
@@ -1442,7 +1514,7 @@ int main(int argc, char *argv[])
         BALL_LOGGERMANAGER_USAGE_EXAMPLE_2::main();
 
       } break;
-      case 26: {
+      case 27: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE #1
         //
@@ -1463,6 +1535,163 @@ int main(int argc, char *argv[])
 
         BALL_LOGGERMANAGER_USAGE_EXAMPLE_1::main();
 
+      } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING: PER-THREAD MESSAGE BUFFERS AND RECORD CACHES
+        //   Ensure that each thread logging through a logger is supplied its
+        //   own message buffer and recycles its own records.
+        //
+        // Concerns:
+        //: 1 Threads obtaining a message buffer from the same logger are
+        //:   supplied distinct buffers, and may hold them concurrently.
+        //:
+        //: 2 A thread obtaining a message buffer several times is supplied
+        //:   the same buffer each time.
+        //:
+        //: 3 A record returned to a logger is supplied by the next call to
+        //:   'getRecord' made by the same thread.
+        //:
+        //: 4 Records held in a per-thread cache are not reported as in use.
+        //:
+        //: 5 The per-thread buffers and caches are reclaimed when their
+        //:   threads exit, and when the logger is destroyed.
+        //:
+        //: 6 A logger may be destroyed while threads having a cache for it are
+        //:   exiting.
+        //
+        // Plan:
+        //: 1 Using a barrier, have several threads hold a message buffer of
+        //:   the default logger at the same time, and verify that the buffers
+        //:   are distinct and that each thread obtains the same buffer again.
+        //:   (C-1..2)
+        //:
+        //: 2 In each thread, obtain a record and log it to a disabled
+        //:   category, then verify that the next record obtained is the same.
+        //:   (C-3)
+        //:
+        //: 3 Verify that 'numRecordsInUse' returns 0 after the threads have
+        //:   logged their records.  (C-4)
+        //:
+        //: 4 Run the threads twice, and verify that the second run does not
+        //:   increase the memory in use; finally destroy the logger manager,
+        //:   and verify that all memory is returned to the test allocator.
+        //:   (C-5)
+        //:
+        //: 5 Repeatedly create a logger manager (other than the singleton),
+        //:   have several threads create a cache for its default logger, then
+        //:   destroy the logger manager while those threads exit.  Verify
+        //:   that all memory is returned to the test allocator.  (C-6)
+        //
+        // Testing:
+        //   char *obtainMessageBuffer(Mutex **mutex, int *bufferSize);
+        //   ball::Record *getRecord(const char *file, int line);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING: PER-THREAD MESSAGE BUFFERS AND RECORD "
+                          << "CACHES" << endl
+                          << "==============================================="
+                          << "======" << endl;
+
+        using namespace BALL_LOGGERMANAGER_TEST_CASE_26;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            ball::TestObserver to(bsl::cout, &ta);
+            ball::LoggerManagerConfiguration lmc;
+            ball::LoggerManager::initSingleton(&to, lmc, &ta);
+            ball::LoggerManager& manager = ball::LoggerManager::singleton();
+
+            logger   = &manager.getLogger();
+            category = manager.addCategory("DISABLED", 0, 0, 0, 0);
+            ASSERT(category);
+
+            if (verbose) cout << "\tTesting in the main thread." << endl;
+            {
+                ball::Record *record = logger->getRecord(__FILE__, __LINE__);
+                ASSERT(1 == logger->numRecordsInUse());
+
+                logger->logMessage(*category, ball::Severity::e_TRACE, record);
+                ASSERT(0 == logger->numRecordsInUse());
+
+                ASSERT(record == logger->getRecord(__FILE__, __LINE__));
+                ASSERT(1 == logger->numRecordsInUse());
+
+                logger->logMessage(*category, ball::Severity::e_TRACE, record);
+                ASSERT(0 == logger->numRecordsInUse());
+            }
+
+            if (verbose) cout << "\tTesting in several threads." << endl;
+
+            bsls::Types::Int64 numBlocks = 0;
+            for (int run = 0; run < 2; ++run) {
+                bslmt::ThreadUtil::Handle threads[NUM_THREADS];
+                for (int i = 0; i < NUM_THREADS; ++i) {
+                    ASSERT(0 == bslmt::ThreadUtil::create(
+                                                       &threads[i],
+                                                       workerThreadCache,
+                                                       (void *)(ptrdiff_t)i));
+                }
+                for (int i = 0; i < NUM_THREADS; ++i) {
+                    ASSERT(0 == bslmt::ThreadUtil::join(threads[i]));
+                }
+
+                for (int i = 0; i < NUM_THREADS; ++i) {
+                    ASSERTV(run, i, isSameBuffer[i]);
+                    ASSERTV(run, i, isRecycled[i]);
+                    for (int j = 0; j < i; ++j) {
+                        ASSERTV(run, i, j, buffers[i] != buffers[j]);
+                    }
+                }
+                ASSERT(0 == logger->numRecordsInUse());
+
+                if (0 == run) {
+                    numBlocks = ta.numBlocksInUse();
+                }
+                else {
+                    ASSERTV(numBlocks, ta.numBlocksInUse(),
+                            numBlocks == ta.numBlocksInUse());
+                }
+            }
+
+            ball::LoggerManager::shutDownSingleton();
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting destruction while threads exit."
+                          << endl;
+
+        for (int iteration = 0; iteration < 100; ++iteration) {
+            {
+                ball::TestObserver               to(bsl::cout, &ta);
+                ball::LoggerManagerConfiguration lmc;
+                ball::LoggerManager *manager =
+                                 new (ta) ball::LoggerManager(lmc, &to, &ta);
+
+                logger   = &manager->getLogger();
+                category = manager->addCategory("DISABLED", 0, 0, 0, 0);
+                ASSERT(category);
+
+                bslmt::ThreadUtil::Handle threads[NUM_THREADS];
+                for (int i = 0; i < NUM_THREADS; ++i) {
+                    ASSERT(0 == bslmt::ThreadUtil::create(&threads[i],
+                                                          workerExit,
+                                                          0));
+                }
+                exitBarrier.wait();
+
+                ta.deleteObject(manager);
+
+                for (int i = 0; i < NUM_THREADS; ++i) {
+                    ASSERT(0 == bslmt::ThreadUtil::join(threads[i]));
+                }
+            }
+            ASSERTV(iteration,
+                    ta.numBlocksInUse(),
+                    0 == ta.numBlocksInUse());
+        }
+
       } break;
       case 25: {
         // --------------------------------------------------------------------
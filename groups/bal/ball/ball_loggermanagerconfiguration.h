@@ -64,6 +64,8 @@ BSLS_IDENT("$Id: $")
 //
 //  TriggerMarkers                               triggerMarkers
 //
+//  MessageFormatting                            messageFormatting
+//
 //  NAME                            DESCRIPTION
 //  -------------------             -------------------------------------------
 //  defaults                        constrained defaults for buffer size and
@@ -92,6 +94,13 @@ BSLS_IDENT("$Id: $")
 //                                  sequence of records logged due to a Trigger
 //                                  or Trigger-All event; default is
 //                                  'e_BEGIN_END_MARKERS'.
+//
+//  messageFormatting               defines whether the 'printf'-style logging
+//                                  macros format the message of a record when
+//                                  it is logged, or capture the format and
+//                                  arguments for rendering when the record is
+//                                  published; default is
+//                                  'e_IMMEDIATE_FORMATTING'.
 //..
 // The constraints are as follows:
 //..
@@ -109,6 +118,8 @@ BSLS_IDENT("$Id: $")
 //  +--------------------------------+--------------------------------+
 //  | triggerMarkers                 | (none)                         |
 //  +--------------------------------+--------------------------------+
+//  | messageFormatting              | (none)                         |
+//  +--------------------------------+--------------------------------+
 //..
 // For convenience, the 'ball::LoggerManagerConfiguration' interface contains
 // manipulators and accessors to configure and inspect the value of its
@@ -203,6 +214,7 @@ BSLS_IDENT("$Id: $")
 //      Default Threshold Callback functor is null
 //      Logging order is FIFO
 //      Trigger markers are NO_MARKERS
+//      Message formatting is IMMEDIATE
 //  ]
 //..
 
@@ -309,6 +321,24 @@ class LoggerManagerConfiguration {
 
     };
 
+    enum MessageFormatting {
+        // The 'MessageFormatting' enumeration defines when the message of a
+        // record logged by the 'printf'-style logging macros (e.g.,
+        // 'BALL_LOG2') is formatted.  If this attribute is
+        // 'e_DEFERRED_FORMATTING', the macros capture the format string and
+        // the values of the arguments in a 'ball::DeferredMessage' held by the
+        // record, and the text of the message is rendered by the observer
+        // when (and if) the record is published, moving the cost of
+        // formatting off the logging thread (e.g., onto the publication
+        // thread of 'ball::AsyncFileObserver').  The default value of this
+        // attribute is 'e_IMMEDIATE_FORMATTING'.
+
+        e_IMMEDIATE_FORMATTING,  // format when logged (default)
+
+        e_DEFERRED_FORMATTING    // capture format and arguments when logged,
+                                 // and format when published
+    };
+
   private:
     // DATA
     LoggerManagerDefaults d_defaults;             // default buffer size for
@@ -336,6 +366,10 @@ class LoggerManagerConfiguration {
 
     TriggerMarkers        d_triggerMarkers;       // trigger marker
 
+    MessageFormatting     d_messageFormatting;    // when messages of the
+                                                  // 'printf'-style macros
+                                                  // are formatted
+
     bslma::Allocator     *d_allocator_p;          // memory allocator (held,
                                                   // not owned)
 
@@ -458,6 +492,10 @@ class LoggerManagerConfiguration {
         // Set the trigger marker attribute of this object to the specified
         // 'value'.
 
+    void setMessageFormatting(MessageFormatting value);
+        // Set the message formatting attribute of this object to the
+        // specified 'value'.
+
     // ACCESSORS
     const LoggerManagerDefaults& defaults() const;
         // Return a reference to the non-modifiable defaults object attribute
@@ -508,6 +546,10 @@ class LoggerManagerConfiguration {
         // Return the trigger marker attribute of this object.  See attributes
         // description for effects of the trigger markers.
 
+    MessageFormatting messageFormatting() const;
+        // Return the message formatting attribute of this object.  See
+        // attributes description for effects of the message formatting.
+
     bsl::ostream& print(bsl::ostream& stream,
                         int           level          = 0,
                         int           spacesPerLevel = 4) const;
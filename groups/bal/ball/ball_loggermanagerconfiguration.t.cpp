@@ -54,6 +54,7 @@ using namespace bsl;  // automatically added by script
 // [ 1] void setDefaultValues(const ball::LMD& defaults);
 // [ 5] void setLogOrder(LogOrder value);
 // [ 6] void setTriggerMarkers(TriggerMarkers value);
+// [ 7] void setMessageFormatting(MessageFormatting value);
 // [ 1] void setUserFieldsPopulatorCallback(const Populator&);
 // [ 1] void setCategoryNameFilterCallback(const CNF& nameFilter);
 // [ 1] void setDefaultThresholdLevelsCallback(const DTC& );
@@ -61,6 +62,7 @@ using namespace bsl;  // automatically added by script
 // [ 1] const ball::LMD& defaults() const;
 // [ 5] const LogOrder logOrder() const;
 // [ 6] const TriggerMarkers triggerMarkers() const;
+// [ 7] MessageFormatting messageFormatting() const;
 // [ 1] const Populator& userFieldsPopulatorCallback() const;
 // [ 1] const CNF& categoryNameFilterCallback() const;
 // [ 1] const DTC& defaultThresholdLevelsCallback() const;
@@ -70,7 +72,7 @@ using namespace bsl;  // automatically added by script
 // [ 1] bool operator!=(const ball::LMC& lhs, const ball::LMC& rhs);
 // [ 1] bsl::ostream& operator<<(bsl::ostream&, const ball::LMC);
 //-----------------------------------------------------------------------------
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -223,6 +225,7 @@ typedef bsl::function<void(int *, int *, int *, int *, const char*)> DtCb;
 //      Default Threshold Callback functor is null
 //      Logging order is FIFO
 //      Trigger markers are NO_MARKERS
+//      Message formatting is IMMEDIATE
 //  ]
 //..
 
@@ -309,7 +312,7 @@ int main(int argc, char *argv[])
     const DtCb   DTCB1(dtCb1);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -328,6 +331,65 @@ int main(int argc, char *argv[])
 
         initializeConfiguration(verbose);
 
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING  'setMessageFormatting' AND 'messageFormatting':
+        //   Verify 'setMessageFormatting' and 'messageFormatting'.
+        //
+        // Concern:
+        //   That 'setMessageFormatting' and 'messageFormatting' work
+        //   correctly, and that the attribute participates in copying,
+        //   assignment, equality, and printing.
+        //
+        // Plan:
+        //   1. Create a configuration and verify 'messageFormatting'.
+        //   2. Invoke 'setMessageFormatting' with 'e_DEFERRED_FORMATTING' and
+        //      verify 'messageFormatting', equality, copying, assignment, and
+        //      printing.
+        //   3. Invoke 'setMessageFormatting' with 'e_IMMEDIATE_FORMATTING'
+        //      and verify 'messageFormatting'.
+        //
+        // Testing:
+        //   void setMessageFormatting(MessageFormatting value);
+        //   MessageFormatting messageFormatting() const;
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "\nTESTING 'setMessageFormatting' AND 'messageFormatting'"
+                 << "\n"
+                 << "=====================================================\n";
+
+        Obj lmc;  const Obj& LMC = lmc;
+        ASSERT(LMC.messageFormatting() == Obj::e_IMMEDIATE_FORMATTING);
+
+        const Obj DEFAULT;
+
+        lmc.setMessageFormatting(Obj::e_DEFERRED_FORMATTING);
+        ASSERT(LMC.messageFormatting() == Obj::e_DEFERRED_FORMATTING);
+        ASSERT(DEFAULT != LMC);
+
+        {
+            const Obj COPY(LMC);
+            ASSERT(COPY == LMC);
+            ASSERT(COPY.messageFormatting() == Obj::e_DEFERRED_FORMATTING);
+
+            Obj assigned;
+            assigned = LMC;
+            ASSERT(assigned == LMC);
+        }
+
+        {
+            bsl::ostringstream os;
+            os << LMC;
+            ASSERT(bsl::string::npos !=
+                              os.str().find("Message formatting is DEFERRED"));
+        }
+
+        lmc.setMessageFormatting(Obj::e_IMMEDIATE_FORMATTING);
+        ASSERT(LMC.messageFormatting() == Obj::e_IMMEDIATE_FORMATTING);
+        ASSERT(DEFAULT == LMC);
+
       } break;
       case 6: {
         // --------------------------------------------------------------------
@@ -8,6 +8,10 @@ BSLS_IDENT_RCSID(ball_record_cpp,"$Id$ $CSID$")
 
 #include <bdlb_print.h>
 
+#include <bslstl_stringref.h>
+
+#include <bsls_assert.h>
+
 #include <bsl_ostream.h>
 
 namespace BloombergLP {
@@ -18,6 +22,19 @@ namespace ball {
                            // ------------
 
 // ACCESSORS
+void Record::messageText(bsl::string *result) const
+{
+    BSLS_ASSERT(result);
+
+    if (d_deferredMessage.hasFormat()) {
+        d_deferredMessage.render(result);
+    }
+    else {
+        const bslstl::StringRef message = d_fixedFields.messageRef();
+        result->append(message.data(), message.length());
+    }
+}
+
 bsl::ostream& Record::print(bsl::ostream& stream,
                             int           level,
                             int           spacesPerLevel) const
@@ -54,8 +71,20 @@ bsl::ostream& Record::print(bsl::ostream& stream,
     }
     d_customFields.print(stream, levelPlus1, spacesPerLevel);
 
-    if (0 <= spacesPerLevel) {
+    if (d_deferredMessage.hasFormat()) {
+        // Both 'UserFields::print' and 'DeferredMessage::print' terminate
+        // multi-line output with a newline.
+
+        if (0 > spacesPerLevel) {
+            stream << ' ';
+        }
+        d_deferredMessage.print(stream, levelPlus1, spacesPerLevel);
+    }
+    else if (0 <= spacesPerLevel) {
         stream << '\n';
+    }
+
+    if (0 <= spacesPerLevel) {
         bdlb::Print::indent(stream, level, spacesPerLevel);
         stream << "]\n";
     }
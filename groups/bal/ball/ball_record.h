@@ -20,7 +20,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  ball::Record: container for fixed and user-defined log record fields
 //
-//@SEE_ALSO: ball_recordattributes, ball_logger
+//@SEE_ALSO: ball_recordattributes, ball_logger, ball_deferredmessage
 //
 //@DESCRIPTION: This component defines a container, 'ball::Record', that
 // aggregates a set of fixed fields and a set of user-defined fields into one
@@ -30,6 +30,18 @@ BSLS_IDENT("$Id: $")
 // the total memory required for the class.  Also note that this class is not
 // thread-safe.
 //
+///Deferred Messages
+///-----------------
+// A record may additionally hold a 'ball::DeferredMessage', a 'printf'-style
+// format and its captured arguments, whose rendered text stands in place of
+// the message attribute of the fixed fields.  Records created by the
+// 'printf'-style logging macros hold a deferred message (and an empty message
+// attribute) when the logger manager is configured for deferred message
+// formatting (see 'ball_loggermanagerconfiguration'), and observers render
+// the text of the message when the record is published.  The 'messageText'
+// accessor, and the '%m' specifier of 'ball::RecordStringFormatter', supply
+// the text of the message of a record in either case.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -79,6 +91,10 @@ BSLS_IDENT("$Id: $")
 #include <ball_countingallocator.h>
 #endif
 
+#ifndef INCLUDED_BALL_DEFERREDMESSAGE
+#include <ball_deferredmessage.h>
+#endif
+
 #ifndef INCLUDED_BALL_RECORDATTRIBUTES
 #include <ball_recordattributes.h>
 #endif
@@ -134,6 +150,10 @@ class Record {
     // fields.  For each of these two sub-containers there is an accessor for
     // obtaining the container value and a manipulator for changing that value.
     //
+    // A 'Record' also holds a 'DeferredMessage' that, if it holds a format,
+    // supplies the text of the message of the record in place of the message
+    // attribute of its fixed fields.
+    //
     // Additionally, this class supports a complete set of *value* *semantic*
     // operations, including copy construction, assignment and equality
     // comparison, and 'ostream' printing.  A precise operational definition of
@@ -152,6 +172,10 @@ class Record {
 
     ball::UserFields   d_customFields;  // bytes used by user fields
 
+    DeferredMessage    d_deferredMessage;
+                                        // format and arguments of the message,
+                                        // if its formatting is deferred
+
     bslma::Allocator  *d_allocator_p;   // allocator used to supply memory;
                                         // held but not own
 
@@ -213,6 +237,10 @@ class Record {
         // Return a reference providing modifiable access to the custom
         // user-defined fields of this log record.
 
+    DeferredMessage& deferredMessage();
+        // Return a reference providing modifiable access to the deferred
+        // message of this log record.
+
     // ACCESSORS
     const RecordAttributes& fixedFields() const;
         // Return the non-modifiable fixed fields of this log record.
@@ -221,6 +249,16 @@ class Record {
         // Return a reference providing non-modifiable access to the custom
         // user-defined fields of this log record.
 
+    const DeferredMessage& deferredMessage() const;
+        // Return a reference providing non-modifiable access to the deferred
+        // message of this log record.
+
+    void messageText(bsl::string *result) const;
+        // Append to the specified 'result' the text of the message of this
+        // log record: the rendered text of the deferred message of this record
+        // if it holds a format, and the message attribute of the fixed fields
+        // of this record otherwise.
+
     int numAllocatedBytes() const;
         // Return the total number of bytes of dynamic memory allocated by
         // this log record object.  Note that this value does not include
@@ -245,14 +283,14 @@ class Record {
 bool operator==(const Record& lhs, const Record& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' log records have the same
     // value, and 'false' otherwise.  Two log records have the same value if
-    // the respective fixed fields have the same value and the respective
-    // user-defined fields have the same value.
+    // the respective fixed fields, user-defined fields, and deferred messages
+    // have the same value.
 
 bool operator!=(const Record& lhs, const Record& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' log records do not have
     // the same value, and 'false' otherwise.  Two log records do not have the
-    // same value if either the respective fixed fields or user-defined fields
-    // do not have the same value.
+    // same value if the respective fixed fields, user-defined fields, or
+    // deferred messages do not have the same value.
 
 bsl::ostream& operator<<(bsl::ostream& stream, const Record& record);
     // Format the members of the specified 'record' to the specified output
@@ -279,6 +317,7 @@ Record::Record(bslma::Allocator *basicAllocator)
 : d_allocator(basicAllocator)
 , d_fixedFields(&d_allocator)
 , d_customFields(&d_allocator)
+, d_deferredMessage(&d_allocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -290,6 +329,7 @@ Record::Record(const RecordAttributes&  fixedFields,
 : d_allocator(basicAllocator)
 , d_fixedFields(fixedFields, &d_allocator)
 , d_customFields(customFields, &d_allocator)
+, d_deferredMessage(&d_allocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -299,6 +339,7 @@ Record::Record(const Record& original, bslma::Allocator *basicAllocator)
 : d_allocator(basicAllocator)
 , d_fixedFields(original.d_fixedFields, &d_allocator)
 , d_customFields(original.d_customFields, &d_allocator)
+, d_deferredMessage(original.d_deferredMessage, &d_allocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -308,8 +349,9 @@ inline
 Record& Record::operator=(const Record& rhs)
 {
     if (this != &rhs) {
-        d_fixedFields  = rhs.d_fixedFields;
-        d_customFields = rhs.d_customFields;
+        d_fixedFields     = rhs.d_fixedFields;
+        d_customFields    = rhs.d_customFields;
+        d_deferredMessage = rhs.d_deferredMessage;
     }
     return *this;
 }
@@ -338,6 +380,12 @@ ball::UserFields& Record::customFields()
     return d_customFields;
 }
 
+inline
+DeferredMessage& Record::deferredMessage()
+{
+    return d_deferredMessage;
+}
+
 // ACCESSORS
 inline
 const RecordAttributes& Record::fixedFields() const
@@ -351,6 +399,12 @@ const ball::UserFields& Record::customFields() const
     return d_customFields;
 }
 
+inline
+const DeferredMessage& Record::deferredMessage() const
+{
+    return d_deferredMessage;
+}
+
 inline
 int Record::numAllocatedBytes() const
 {
@@ -363,8 +417,9 @@ int Record::numAllocatedBytes() const
 inline
 bool ball::operator==(const Record& lhs, const Record& rhs)
 {
-    return lhs.d_fixedFields  == rhs.d_fixedFields
-        && lhs.d_customFields == rhs.d_customFields;
+    return lhs.d_fixedFields     == rhs.d_fixedFields
+        && lhs.d_customFields    == rhs.d_customFields
+        && lhs.d_deferredMessage == rhs.d_deferredMessage;
 }
 
 inline
@@ -75,6 +75,9 @@ using namespace bsl;  // automatically added by script
 // [ 4] const ball::RecordAttributes& fixedFields() const;
 // [ 4] const ball::UserFields& customFields() const;
 // [ 9] int numAllocatedBytes() const;
+// [10] DeferredMessage& deferredMessage();
+// [10] const DeferredMessage& deferredMessage() const;
+// [10] void messageText(bsl::string *result) const;
 // [  ] bsl::ostream& print(bsl::ostream& stream, int level, int spl) const;
 // [ 6] bool operator==(const ball::Record& lhs, const ball::Record& rhs);
 // [ 6] operator!=(const ball::Record& lhs, const ball::Record& rhs);
@@ -83,8 +86,7 @@ using namespace bsl;  // automatically added by script
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 3] TESTING GENERATOR FUNCTIONS 'GG' AND 'GGG' ('ball::UserFields')
-// [10] USAGE EXAMPLE 1
-// [11] USAGE EXAMPLE 2
+// [11] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -253,7 +255,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -318,6 +320,88 @@ int main(int argc, char *argv[])
     }
 
       } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING DEFERRED MESSAGE
+        //
+        // Concerns:
+        //: 1 A record initially holds a deferred message having no format,
+        //:   and 'messageText' then supplies the message attribute of the
+        //:   fixed fields.
+        //:
+        //: 2 When the deferred message holds a format, 'messageText' supplies
+        //:   its rendered text instead.
+        //:
+        //: 3 The deferred message participates in copy construction,
+        //:   assignment, and equality, and its memory is counted by
+        //:   'numAllocatedBytes'.
+        //:
+        //: 4 The deferred message is printed only if it holds a format.
+        //
+        // Plan:
+        //: 1 Exercise each concern directly.  (C-1..4)
+        //
+        // Testing:
+        //   DeferredMessage& deferredMessage();
+        //   const DeferredMessage& deferredMessage() const;
+        //   void messageText(bsl::string *result) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING DEFERRED MESSAGE" << endl
+                                  << "========================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        Obj mX(&ta);  const Obj& X = mX;
+        ASSERT(false == X.deferredMessage().hasFormat());
+
+        mX.fixedFields().setMessage("immediate");
+        {
+            bsl::string text("<", &ta);
+            X.messageText(&text);
+            LOOP_ASSERT(text, "<immediate" == text);
+        }
+
+        bsl::ostringstream immediateOut;
+        immediateOut << X;
+
+        const int NUM_BYTES = X.numAllocatedBytes();
+
+        mX.deferredMessage().setFormat("%s %d");
+        mX.deferredMessage().appendArgument("deferred");
+        mX.deferredMessage().appendArgument(7);
+
+        ASSERT(NUM_BYTES < X.numAllocatedBytes());
+        {
+            bsl::string text("<", &ta);
+            X.messageText(&text);
+            LOOP_ASSERT(text, "<deferred 7" == text);
+        }
+
+        Obj mY(X, &ta);  const Obj& Y = mY;
+        ASSERT(X == Y);
+        ASSERT(X.deferredMessage() == Y.deferredMessage());
+
+        mY.deferredMessage().reset();
+        ASSERT(X != Y);
+
+        mY = X;
+        ASSERT(X == Y);
+
+        bsl::ostringstream deferredOut;
+        deferredOut << X;
+        if (veryVerbose) { P(deferredOut.str()) }
+
+        ASSERT(bsl::string::npos == immediateOut.str().find("deferred 7"));
+        ASSERT(bsl::string::npos != deferredOut.str().find("deferred 7"));
+
+        bsl::ostringstream multiLineOut;
+        X.print(multiLineOut, 1, 2);
+        if (veryVerbose) { P(multiLineOut.str()) }
+
+        ASSERT(bsl::string::npos !=
+                             multiLineOut.str().find("text = \"deferred 7\""));
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // TESTING FUNCTION numAllocatedBytes()
@@ -13,6 +13,13 @@
 // significant performance overhead.  For this reason, the 'operator()' method
 // is implemented by writing the formatted string to a buffer before inserting
 // to a stream.
+//
+// The format specification is compiled (by 'compileFormat') into a vector of
+// 'Field' objects, each of which is either a run of literal text, stored in
+// 'd_literals', or a conversion character.  'operator()' simply iterates over
+// the fields.  The text of the timestamp conversions up to (but excluding)
+// the fractional seconds is cached in 'd_cache' for the most recent second
+// and time zone offset; the fractional seconds are rendered for each record.
 
 #include <ball_recordstringformatter.h>
 
@@ -30,20 +37,24 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 #include <bdlma_bufferedsequentialallocator.h>
 
 #include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_localtimeoffset.h>
 #include <bdlt_iso8601util.h>
 #include <bdlt_iso8601utilconfiguration.h>
 
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
 #include <bslstl_stringref.h>
 
 #include <bsl_climits.h>   // for 'INT_MAX'
+#include <bsl_cstddef.h>   // for 'bsl::size_t'
 #include <bsl_cstring.h>   // for 'bsl::strcmp'
 #include <bsl_c_stdlib.h>
-#include <bsl_c_stdio.h>   // for 'snprintf'
 
 #include <bsl_iomanip.h>
 #include <bsl_ostream.h>
@@ -58,42 +69,73 @@ const char *const DEFAULT_FORMAT_SPEC = "\n%d %p:%t %s %f:%l %c %m %u\n";
 namespace BloombergLP {
 
 // STATIC HELPER FUNCTIONS
-static void appendToString(bsl::string *result, int value)
+static void appendToString(bsl::string *result, bsls::Types::Uint64 value)
     // Convert the specified 'value' into ASCII characters and append it to the
     // specified 'result.
 {
-    char buffer[16];
+    char  buffer[32];
+    char *end  = buffer + sizeof buffer;
+    char *iter = end;
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
-
-    snprintf(buffer, sizeof buffer, "%d", value);
+    do {
+        *--iter = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value);
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
-
-    *result += buffer;
+    result->append(iter, end);
 }
 
-static void appendToString(bsl::string *result, bsls::Types::Uint64 value)
+static void appendToString(bsl::string *result, int value)
     // Convert the specified 'value' into ASCII characters and append it to the
     // specified 'result.
 {
-    char buffer[32];
+    if (value < 0) {
+        *result += '-';
+        appendToString(result,
+                       static_cast<bsls::Types::Uint64>(
+                             -static_cast<bsls::Types::Int64>(value)));
+    }
+    else {
+        appendToString(result, static_cast<bsls::Types::Uint64>(value));
+    }
+}
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
+static void appendFraction(bsl::string *result,
+                           int          microseconds,
+                           int          precision)
+    // Append to the specified 'result' a decimal point followed by the
+    // specified 'precision' most significant digits of the specified
+    // 'microseconds', expressed as six decimal digits.  The behavior is
+    // undefined unless '0 <= microseconds < 1000000' and
+    // '0 <= precision <= 6'.
+{
+    BSLS_ASSERT(0 <= microseconds);
+    BSLS_ASSERT(microseconds < 1000000);
+    BSLS_ASSERT(0 <= precision);
+    BSLS_ASSERT(precision <= 6);
 
-    snprintf(buffer, sizeof(buffer), "%llu", value);
+    char buffer[7];
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
+    buffer[0] = '.';
+    for (int i = 6; i > 0; --i) {
+        if (i <= precision) {
+            buffer[i] = static_cast<char>('0' + microseconds % 10);
+        }
+        microseconds /= 10;
+    }
+
+    result->append(buffer, precision + 1);
+}
+
+static void truncateToSecond(bdlt::Datetime *datetime)
+    // Set the millisecond and microsecond attributes of the specified
+    // 'datetime' to 0.
+{
+    BSLS_ASSERT(datetime);
 
-    *result += buffer;
+    datetime->setTime(datetime->hour(),
+                      datetime->minute(),
+                      datetime->second());
 }
 
 namespace ball {
@@ -114,14 +156,20 @@ const int RecordStringFormatter::k_DISABLE_PUBLISH_IN_LOCALTIME = INT_MIN;
 RecordStringFormatter::RecordStringFormatter(bslma::Allocator *basicAllocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, basicAllocator)
 , d_timestampOffset(0)
+, d_fields(basicAllocator)
+, d_literals(basicAllocator)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(const char       *format,
                                              bslma::Allocator *basicAllocator)
 : d_formatSpec(format, basicAllocator)
 , d_timestampOffset(0)
+, d_fields(basicAllocator)
+, d_literals(basicAllocator)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -129,7 +177,10 @@ RecordStringFormatter::RecordStringFormatter(
                                  bslma::Allocator              *basicAllocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, basicAllocator)
 , d_timestampOffset(offset)
+, d_fields(basicAllocator)
+, d_literals(basicAllocator)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -143,7 +194,10 @@ RecordStringFormatter::RecordStringFormatter(
                     publishInLocalTime
                     ?  k_ENABLE_PUBLISH_IN_LOCALTIME
                     : k_DISABLE_PUBLISH_IN_LOCALTIME)
+, d_fields(basicAllocator)
+, d_literals(basicAllocator)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -152,7 +206,10 @@ RecordStringFormatter::RecordStringFormatter(
                                  bslma::Allocator              *basicAllocator)
 : d_formatSpec(format, basicAllocator)
 , d_timestampOffset(offset)
+, d_fields(basicAllocator)
+, d_literals(basicAllocator)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -167,7 +224,10 @@ RecordStringFormatter::RecordStringFormatter(
                     publishInLocalTime
                     ?  k_ENABLE_PUBLISH_IN_LOCALTIME
                     : k_DISABLE_PUBLISH_IN_LOCALTIME)
+, d_fields(basicAllocator)
+, d_literals(basicAllocator)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -175,7 +235,117 @@ RecordStringFormatter::RecordStringFormatter(
                                   bslma::Allocator             *basicAllocator)
 : d_formatSpec(original.d_formatSpec, basicAllocator)
 , d_timestampOffset(original.d_timestampOffset)
+, d_fields(basicAllocator)
+, d_literals(basicAllocator)
 {
+    compileFormat();
+}
+
+// PRIVATE MANIPULATORS
+void RecordStringFormatter::compileFormat()
+{
+    d_fields.clear();
+    d_literals.clear();
+    d_hasTimestamp = false;
+
+    d_cache.d_hasText = false;
+
+    // Step through the format string, appending literal text to 'd_literals'
+    // and adding a field for each conversion and for each run of literal text
+    // that precedes a conversion (or the end of the format string).
+
+    const char *iter = d_formatSpec.data();
+    const char *end  = iter + d_formatSpec.length();
+
+    bsl::size_t literalBegin = 0;  // offset of the current run of literal text
+
+    while (iter != end) {
+        char conversion = 0;
+
+        switch (*iter) {
+          case '%': {
+            if (++iter == end) {
+                break;
+            }
+            switch (*iter) {
+              case '%': {
+                d_literals += '%';
+              } break;
+              case 'd':                                         // FALL THROUGH
+              case 'D':                                         // FALL THROUGH
+              case 'I':                                         // FALL THROUGH
+              case 'O':                                         // FALL THROUGH
+              case 'i': {
+                d_hasTimestamp = true;
+                conversion     = *iter;
+              } break;
+              case 'p':                                         // FALL THROUGH
+              case 't':                                         // FALL THROUGH
+              case 's':                                         // FALL THROUGH
+              case 'f':                                         // FALL THROUGH
+              case 'F':                                         // FALL THROUGH
+              case 'l':                                         // FALL THROUGH
+              case 'c':                                         // FALL THROUGH
+              case 'm':                                         // FALL THROUGH
+              case 'x':                                         // FALL THROUGH
+              case 'X':                                         // FALL THROUGH
+              case 'u': {
+                conversion = *iter;
+              } break;
+              default: {
+                // Undefined: we just output the verbatim characters.
+
+                d_literals += '%';
+                d_literals += *iter;
+              }
+            }
+            ++iter;
+          } break;
+          case '\\': {
+            if (++iter == end) {
+                break;
+            }
+            switch (*iter) {
+              case 'n': {
+                d_literals += '\n';
+              } break;
+              case 't': {
+                d_literals += '\t';
+              } break;
+              case '\\': {
+                d_literals += '\\';
+              } break;
+              default: {
+                // Undefined: we just output the verbatim characters.
+
+                d_literals += '\\';
+                d_literals += *iter;
+              }
+            }
+            ++iter;
+          } break;
+          default: {
+            d_literals += *iter;
+            ++iter;
+          }
+        }
+
+        if (conversion || iter == end) {
+            if (literalBegin < d_literals.length()) {
+                Field literal = { 0,
+                                  static_cast<int>(literalBegin),
+                                  static_cast<int>(d_literals.length()
+                                                              - literalBegin)
+                                };
+                d_fields.push_back(literal);
+                literalBegin = d_literals.length();
+            }
+            if (conversion) {
+                Field field = { conversion, 0, 0 };
+                d_fields.push_back(field);
+            }
+        }
+    }
 }
 
 // MANIPULATORS
@@ -185,37 +355,98 @@ RecordStringFormatter& RecordStringFormatter::operator=(
     if (this != &rhs) {
         d_formatSpec      = rhs.d_formatSpec;
         d_timestampOffset = rhs.d_timestampOffset;
+        compileFormat();
     }
 
     return *this;
 }
 
-// ACCESSORS
-void RecordStringFormatter::operator()(bsl::ostream& stream,
-                                       const Record& record) const
+void RecordStringFormatter::setFormat(const char *format)
+{
+    d_formatSpec = format;
+    compileFormat();
+}
 
+// PRIVATE ACCESSORS
+void RecordStringFormatter::loadTimestamp(
+                                TimestampCache        *result,
+                                bdlt::Datetime        *adjustedTimestamp,
+                                const bdlt::Datetime&  timestamp) const
 {
-    const RecordAttributes& fixedFields = record.fixedFields();
-    bdlt::DatetimeInterval  offset;
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(adjustedTimestamp);
+
+    bdlt::DatetimeInterval offset;
 
     if (k_ENABLE_PUBLISH_IN_LOCALTIME ==
                                        d_timestampOffset.totalMilliseconds()) {
         bsls::Types::Int64 localTimeOffsetInSeconds =
-            bdlt::LocalTimeOffset::localTimeOffset(
-                                       fixedFields.timestamp()).totalSeconds();
+            bdlt::LocalTimeOffset::localTimeOffset(timestamp).totalSeconds();
         offset.setTotalSeconds(localTimeOffsetInSeconds);
     } else if (k_DISABLE_PUBLISH_IN_LOCALTIME !=
                                        d_timestampOffset.totalMilliseconds()) {
         offset = d_timestampOffset;
     }
 
-    bdlt::DatetimeTz timestamp(fixedFields.timestamp() + offset,
-                               static_cast<int>(offset.totalMinutes()));
+    *adjustedTimestamp = timestamp + offset;
+
+    bdlt::Datetime adjustedSecond(*adjustedTimestamp);
+    truncateToSecond(&adjustedSecond);
+
+    const int offsetInMinutes = static_cast<int>(offset.totalMinutes());
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_cacheMutex);
+
+    if (!d_cache.d_hasText
+     || d_cache.d_localSecond     != adjustedSecond
+     || d_cache.d_offsetInMinutes != offsetInMinutes) {
+        d_cache.d_localSecond     = adjustedSecond;
+        d_cache.d_offsetInMinutes = offsetInMinutes;
+
+        d_cache.d_datetimeLength = adjustedSecond.printToBuffer(
+                                               d_cache.d_datetime,
+                                               sizeof d_cache.d_datetime,
+                                               0);
+
+        // Use ISO8601 "extended" format.
+
+        bdlt::Iso8601UtilConfiguration config;
+        config.setFractionalSecondPrecision(0);
+        config.setUseZAbbreviationForUtc(true);
+
+        d_cache.d_iso8601Length = bdlt::Iso8601Util::generateRaw(
+                               d_cache.d_iso8601,
+                               bdlt::DatetimeTz(adjustedSecond,
+                                                offsetInMinutes),
+                               config);
+        d_cache.d_iso8601[d_cache.d_iso8601Length] = '\0';
+
+        d_cache.d_hasText = true;
+    }
+
+    *result = d_cache;
+}
+
+// ACCESSORS
+void RecordStringFormatter::operator()(bsl::ostream& stream,
+                                       const Record& record) const
+
+{
+    const RecordAttributes& fixedFields = record.fixedFields();
 
-    // Step through the format string, outputting the required elements.
+    // Obtain the text of the timestamp that precedes its fractional seconds
+    // only if the format specification has a timestamp conversion.
 
-    const char* iter = d_formatSpec.data();
-    const char* end  = iter + d_formatSpec.length();
+    TimestampCache timestampText;
+    int            microseconds = 0;  // fractional seconds of the timestamp
+
+    if (d_hasTimestamp) {
+        bdlt::Datetime timestamp;
+        loadTimestamp(&timestampText, &timestamp, fixedFields.timestamp());
+
+        microseconds = timestamp.millisecond() * 1000
+                                                     + timestamp.microsecond();
+    }
 
     // Create a buffer on the stack for formatting the record.  Note that the
     // size of the buffer should be slightly larger than the amount we reserve
@@ -231,181 +462,140 @@ void RecordStringFormatter::operator()(bsl::ostream& stream,
     bsl::string output(&stringAllocator);
     output.reserve(STRING_RESERVATION);
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
-
-    while (iter != end) {
-        switch (*iter) {
-          case '%': {
-            if (++iter == end) {
-                break;
-            }
-            switch (*iter) {
-              case '%': {
-                output += '%';
-              } break;
-              case 'd': // fall through intentionally
-              case 'D': {
-                const int fractionalSecondPrecision = 'd' == *iter ? 3 : 6;
-
-                char buffer[32];
-                timestamp.localDatetime().printToBuffer(
-                                                    buffer,
-                                                    sizeof buffer,
-                                                    fractionalSecondPrecision);
-
-                output += buffer;
-              } break;
-              case 'I':                                         // FALL THROUGH
-              case 'O':                                         // FALL THROUGH
-              case 'i': {
-                // Use ISO8601 "extended" format.
-
-                const int fractionalSecondPrecision = 'O' == *iter ? 6 : 3;
-
-                bdlt::Iso8601UtilConfiguration config;
-                config.setFractionalSecondPrecision(fractionalSecondPrecision);
-                config.setUseZAbbreviationForUtc(true);
-
-                char buffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN + 1];
-
-                int outputLength = bdlt::Iso8601Util::generateRaw(buffer,
-                                                                  timestamp,
-                                                                  config);
-
-                if ('i' == *iter) {
-                    // Remove milliseconds part.
+    // Step through the compiled format specification, outputting the required
+    // elements.
 
-                    enum { k_DECIMAL_SIGN_OFFSET = 19,
-                           k_TZINFO_OFFSET       = k_DECIMAL_SIGN_OFFSET + 4 };
-                    bslstl::StringRef head(buffer, k_DECIMAL_SIGN_OFFSET);
+    const bsl::vector<Field>::const_iterator end = d_fields.end();
+    for (bsl::vector<Field>::const_iterator iter = d_fields.begin();
+         iter != end;
+         ++iter) {
+        switch (iter->d_conversion) {
+          case 0: {
+            output.append(d_literals.data() + iter->d_offset, iter->d_length);
+          } break;
+          case 'd': // fall through intentionally
+          case 'D': {
+            const int fractionalSecondPrecision =
+                                             'd' == iter->d_conversion ? 3 : 6;
+
+            output.append(timestampText.d_datetime,
+                          timestampText.d_datetimeLength);
+            appendFraction(&output, microseconds, fractionalSecondPrecision);
+          } break;
+          case 'I':                                         // FALL THROUGH
+          case 'O':                                         // FALL THROUGH
+          case 'i': {
+            // The cached text omits the fractional seconds, which are
+            // inserted before the time zone designator for '%I' and '%O'.
 
-                    bslstl::StringRef tail(buffer + k_TZINFO_OFFSET,
-                                           outputLength - k_TZINFO_OFFSET);
+            enum { k_DECIMAL_SIGN_OFFSET = 19 };
 
-                    output += head + tail;
-                }
-                else {
-                    output.append(buffer, outputLength);
-                }
-              } break;
-              case 'p': {
-                appendToString(&output, fixedFields.processID());
-              } break;
-              case 't': {
-                appendToString(&output, fixedFields.threadID());
-              } break;
-              case 's': {
-                output += Severity::toAscii(
+            if ('i' == iter->d_conversion) {
+                output.append(timestampText.d_iso8601,
+                              timestampText.d_iso8601Length);
+            }
+            else {
+                const int fractionalSecondPrecision =
+                                             'O' == iter->d_conversion ? 6 : 3;
+
+                output.append(timestampText.d_iso8601, k_DECIMAL_SIGN_OFFSET);
+                appendFraction(&output,
+                               microseconds,
+                               fractionalSecondPrecision);
+                output.append(timestampText.d_iso8601 + k_DECIMAL_SIGN_OFFSET,
+                              timestampText.d_iso8601Length
+                                                     - k_DECIMAL_SIGN_OFFSET);
+            }
+          } break;
+          case 'p': {
+            appendToString(&output, fixedFields.processID());
+          } break;
+          case 't': {
+            appendToString(&output, fixedFields.threadID());
+          } break;
+          case 's': {
+            output += Severity::toAscii(
                                  (Severity::Level)fixedFields.severity());
-              } break;
-              case 'f': {
-                output += fixedFields.fileName();
-              } break;
-              case 'F': {
-                const bsl::string& filename = fixedFields.fileName();
-                bsl::string::size_type rightmostSlashIndex =
+          } break;
+          case 'f': {
+            output += fixedFields.fileName();
+          } break;
+          case 'F': {
+            const bsl::string& filename = fixedFields.fileName();
+            bsl::string::size_type rightmostSlashIndex =
 #ifdef BSLS_PLATFORM_OS_WINDOWS
-                    filename.rfind('\\');
+                filename.rfind('\\');
 #else
-                    filename.rfind('/');
+                filename.rfind('/');
 #endif
-                if (bsl::string::npos == rightmostSlashIndex) {
-                    output += filename;
-                }
-                else {
-                    output += filename.substr(rightmostSlashIndex + 1);
-                }
-              } break;
-              case 'l': {
-                appendToString(&output, fixedFields.lineNumber());
-              } break;
-              case 'c': {
-                output += fixedFields.category();
-              } break;
-              case 'm': {
-                bslstl::StringRef message = fixedFields.messageRef();
-                output.append(message.data(), message.length());
-              } break;
-              case 'x': {
-                bsl::stringstream ss;
-                int length = static_cast<int>(
-                                      fixedFields.messageStreamBuf().length());
-                bdlb::Print::printString(ss,
-                                        fixedFields.message(),
-                                        length,
-                                        false);
-                output += ss.str();
-              } break;
-              case 'X': {
-                bsl::stringstream ss;
-                int length = static_cast<int>(
+            if (bsl::string::npos == rightmostSlashIndex) {
+                output += filename;
+            }
+            else {
+                output.append(filename, rightmostSlashIndex + 1,
+                              bsl::string::npos);
+            }
+          } break;
+          case 'l': {
+            appendToString(&output, fixedFields.lineNumber());
+          } break;
+          case 'c': {
+            output += fixedFields.category();
+          } break;
+          case 'm': {
+            record.messageText(&output);
+          } break;
+          case 'x':                                         // FALL THROUGH
+          case 'X': {
+            // Note that the message of a record whose formatting is not
+            // deferred is printed in full, including any terminating null
+            // character supplied by the logging macros.
+
+            bsl::string message;
+            const char *data;
+            int         length;
+            if (record.deferredMessage().hasFormat()) {
+                record.deferredMessage().render(&message);
+                data   = message.data();
+                length = static_cast<int>(message.length());
+            }
+            else {
+                data   = fixedFields.message();
+                length = static_cast<int>(
                                       fixedFields.messageStreamBuf().length());
-                bdlb::Print::singleLineHexDump(ss,
-                                              fixedFields.message(),
-                                              length);
-                output += ss.str();
-              } break;
-              case 'u': {
-                typedef ball::UserFields Values;
-                const Values& customFields = record.customFields();
-                const int numCustomFields  = customFields.length();
-
-                if (numCustomFields > 0) {
-                    bsl::stringstream ss;
-                    Values::ConstIterator it = customFields.begin();
-                    ss << *it;
-                    ++it;
-                    for (; it != customFields.end(); ++it) {
-                        ss << " " << *it;
-                    }
-                    output += ss.str();
-                }
-              } break;
-              default: {
-                // Undefined: we just output the verbatim characters.
+            }
 
-                output += '%';
-                output += *iter;
-              }
+            bsl::stringstream ss;
+            if ('x' == iter->d_conversion) {
+                bdlb::Print::printString(ss, data, length, false);
             }
-            ++iter;
-          } break;
-          case '\\': {
-            if (++iter == end) {
-                break;
+            else {
+                bdlb::Print::singleLineHexDump(ss, data, length);
             }
-            switch (*iter) {
-              case 'n': {
-                output += '\n';
-              } break;
-              case 't': {
-                output += '\t';
-              } break;
-              case '\\': {
-                output += '\\';
-              } break;
-              default: {
-                // Undefined: we just output the verbatim characters.
+            output += ss.str();
+          } break;
+          case 'u': {
+            typedef ball::UserFields Values;
+            const Values& customFields = record.customFields();
+            const int numCustomFields  = customFields.length();
 
-                output += '\\';
-                output += *iter;
-              }
+            if (numCustomFields > 0) {
+                bsl::stringstream ss;
+                Values::ConstIterator it = customFields.begin();
+                ss << *it;
+                ++it;
+                for (; it != customFields.end(); ++it) {
+                    ss << " " << *it;
+                }
+                output += ss.str();
             }
-            ++iter;
           } break;
           default: {
-            output += *iter;
-            ++iter;
+            BSLS_ASSERT(!"Unreachable");
           }
         }
     }
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
-
     stream.write(output.c_str(), output.size());
     stream.flush();
 }
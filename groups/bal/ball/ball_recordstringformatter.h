@@ -83,6 +83,13 @@ BSLS_IDENT("$Id: $")
 // Any other text included in the format specification of the record formatter
 // is output verbatim.
 //
+// If the record holds a deferred message (see 'ball_deferredmessage'), as do
+// records logged by the 'printf'-style macros when the logger manager is
+// configured for deferred message formatting, '%m', '%x', and '%X' render the
+// text of the deferred message in place of the message attribute of the
+// record.  Note that the message is rendered each time the record is
+// formatted, on the thread that formats it.
+//
 // When not supplied at construction, the default format specification of a
 // record formatter is:
 //..
@@ -94,6 +101,20 @@ BSLS_IDENT("$Id: $")
 // 27AUG2007_16:09:46.161 2040:1 WARN subdir/process.cpp:542 FOO.BAR.BAZ <text>
 //..
 //
+///Performance
+///-----------
+// The format specification is parsed once, when it is supplied (at
+// construction or by 'setFormat'), into a sequence of literal text runs and
+// conversions; formatting a record does not re-scan the specification.  In
+// addition, the portion of each timestamp conversion ('%d', '%D', '%i', '%I',
+// and '%O') that precedes the fractional seconds is cached for the most
+// recently formatted second (and time zone offset), so that formatting
+// successive records logged within the same second renders only their
+// fractional-second digits.  The cache is guarded by a mutex, so a record
+// formatter may still be used to format records concurrently from multiple
+// threads.  Note that the local time offset (if publishing in local time is
+// enabled) is still obtained for each formatted record.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate how to use an instance of
@@ -132,10 +153,18 @@ BSLS_IDENT("$Id: $")
 #include <balscm_version.h>
 #endif
 
+#ifndef INCLUDED_BDLT_DATETIME
+#include <bdlt_datetime.h>
+#endif
+
 #ifndef INCLUDED_BDLT_DATETIMEINTERVAL
 #include <bdlt_datetimeinterval.h>
 #endif
 
+#ifndef INCLUDED_BDLT_ISO8601UTIL
+#include <bdlt_iso8601util.h>
+#endif
+
 #ifndef INCLUDED_BSLMA_ALLOCATOR
 #include <bslma_allocator.h>
 #endif
@@ -152,10 +181,18 @@ BSLS_IDENT("$Id: $")
 #include <bsl_iosfwd.h>
 #endif
 
+#ifndef INCLUDED_BSLMT_MUTEX
+#include <bslmt_mutex.h>
+#endif
+
 #ifndef INCLUDED_BSL_STRING
 #include <bsl_string.h>
 #endif
 
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
 #ifndef BDE_DONT_ALLOW_TRANSITIVE_INCLUDES
 
 #ifndef INCLUDED_BSLALG_TYPETRAITS
@@ -181,6 +218,46 @@ class RecordStringFormatter {
     // to a given stream.  The timestamp offset of the record formatter is
     // added to each timestamp that is output to the stream.
 
+    // PRIVATE TYPES
+    struct Field {
+        // This 'struct' describes one element of a compiled format
+        // specification: either a run of literal text (including any
+        // interpolated '\'-escape sequences) or a conversion that is replaced
+        // by an attribute of the formatted record.
+
+        char d_conversion;  // conversion character, or 0 for literal text
+        int  d_offset;      // offset of literal text within 'd_literals'
+        int  d_length;      // length of literal text
+    };
+
+    struct TimestampCache {
+        // This 'struct' holds the portions of a formatted timestamp that are
+        // common to all records having timestamps within the same second.
+
+        bdlt::Datetime      d_localSecond;   // adjusted time, truncated to
+                                             // seconds, that is rendered in
+                                             // 'd_datetime' and 'd_iso8601'
+
+        int                 d_offsetInMinutes;
+                                             // time zone offset rendered in
+                                             // 'd_iso8601'
+
+        bool                d_hasText;       // 'true' if 'd_datetime' and
+                                             // 'd_iso8601' are valid
+
+        char                d_datetime[32];  // '%d' text, without fractional
+                                             // seconds (null-terminated)
+
+        int                 d_datetimeLength;
+                                             // length of 'd_datetime'
+
+        char                d_iso8601[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN
+                                                                         + 1];
+                                             // '%i' text (null-terminated)
+
+        int                 d_iso8601Length; // length of 'd_iso8601'
+    };
+
     // CLASS DATA
     static const int k_DISABLE_PUBLISH_IN_LOCALTIME;
                                               // Reserved offset (a value
@@ -202,6 +279,35 @@ class RecordStringFormatter {
     bsl::string            d_formatSpec;       // 'printf'-style format spec.
     bdlt::DatetimeInterval d_timestampOffset;  // offset added to timestamps
 
+    bsl::vector<Field>     d_fields;           // compiled 'd_formatSpec'
+
+    bsl::string            d_literals;         // literal text referred to by
+                                               // 'd_fields'
+
+    bool                   d_hasTimestamp;     // 'true' if 'd_formatSpec' has
+                                               // a timestamp conversion
+
+    mutable TimestampCache d_cache;            // timestamp text of the most
+                                               // recently formatted second
+
+    mutable bslmt::Mutex   d_cacheMutex;       // guard for 'd_cache'
+
+    // PRIVATE MANIPULATORS
+    void compileFormat();
+        // Parse 'd_formatSpec' into 'd_fields' and 'd_literals', and
+        // invalidate the cached timestamp text.
+
+    // PRIVATE ACCESSORS
+    void loadTimestamp(TimestampCache        *result,
+                       bdlt::Datetime        *adjustedTimestamp,
+                       const bdlt::Datetime&  timestamp) const;
+        // Load into the specified 'adjustedTimestamp' the specified
+        // 'timestamp' adjusted by the timestamp offset of this record
+        // formatter, and load into the specified 'result' the text of the
+        // timestamp conversions of 'adjustedTimestamp' that precede its
+        // fractional seconds.  Use the cached text of this record formatter
+        // if it refers to the same second, and update the cache otherwise.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(RecordStringFormatter,
@@ -376,12 +482,6 @@ void RecordStringFormatter::enablePublishInLocalTime()
     d_timestampOffset.setTotalMilliseconds(k_ENABLE_PUBLISH_IN_LOCALTIME);
 }
 
-inline
-void RecordStringFormatter::setFormat(const char *format)
-{
-    d_formatSpec = format;
-}
-
 inline
 void RecordStringFormatter::setTimestampOffset(
                                           const bdlt::DatetimeInterval& offset)
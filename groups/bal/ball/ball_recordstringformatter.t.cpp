@@ -19,6 +19,7 @@
 #include <bslim_testutil.h>
 
 #include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
 #include <bdlt_iso8601util.h>
 #include <bdlt_localtimeoffset.h>
 
@@ -27,6 +28,7 @@
 #include <bslma_testallocator.h>
 #include <bslma_testallocatormonitor.h>
 #include <bsls_platform.h>
+#include <bsls_timeutil.h>
 #include <bsls_types.h>
 
 
@@ -92,6 +94,8 @@ using bsl::string;
 // ----------------------------------------------------------------------------
 // [ 1] breathing test
 // [12] USAGE example
+// [14] COMPILED FORMAT AND CACHED TIMESTAMP
+// [-1] PERFORMANCE TEST
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -265,6 +269,179 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
+      case 14: {
+        // --------------------------------------------------------------------
+        // COMPILED FORMAT AND CACHED TIMESTAMP
+        //
+        // Concerns:
+        //: 1 A format specification is formatted identically whether it is
+        //:   supplied at construction, by 'setFormat', by copy construction,
+        //:   or by assignment, including literal text adjacent to
+        //:   conversions, escape sequences, undefined conversions, and a
+        //:   trailing '%' or '\'.
+        //:
+        //: 2 The timestamp conversions of records having timestamps within
+        //:   the same second differ only in their fractional seconds, and
+        //:   those of records in different seconds, or formatted with a
+        //:   different timestamp offset, reflect that second and offset.
+        //
+        // Plan:
+        //: 1 Using a table of format specifications and their expected
+        //:   output for a record having fixed attributes, verify the output
+        //:   of formatters having each specification.  (C-1)
+        //:
+        //: 2 For a sequence of timestamps, some within the same second and
+        //:   some not, and for a set of timestamp offsets, format each
+        //:   timestamp conversion and compare the result against that of
+        //:   'bdlt::Datetime::printToBuffer' and 'bdlt::Iso8601Util'.  (C-2)
+        //
+        // Testing:
+        //   COMPILED FORMAT AND CACHED TIMESTAMP
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCOMPILED FORMAT AND CACHED TIMESTAMP"
+                          << "\n====================================" << endl;
+
+        if (verbose) cout << "\nTesting compiled format specifications."
+                          << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_format;
+                const char *d_expected;
+            } DATA[] = {
+                //LINE  FORMAT               EXPECTED
+                //----  -------------------  ---------------------------
+                { L_,   "",                  ""                          },
+                { L_,   "abc",               "abc"                       },
+                { L_,   "%",                 ""                          },
+                { L_,   "\\",                ""                          },
+                { L_,   "%%",                "%"                         },
+                { L_,   "a%%b",              "a%b"                       },
+                { L_,   "%l",                "42"                        },
+                { L_,   "<%l>",              "<42>"                      },
+                { L_,   "%l%l",              "4242"                      },
+                { L_,   "%s %l",             "WARN 42"                   },
+                { L_,   "%c:%m",             "CAT:msg"                   },
+                { L_,   "%F",                "file.cpp"                  },
+                { L_,   "%f",                "dir/file.cpp"              },
+                { L_,   "\\n%l\\t\\\\",      "\n42\t\\"                  },
+                { L_,   "%q%l",              "%q42"                      },
+                { L_,   "\\q%l",             "\\q42"                     },
+                { L_,   "%l%",               "42"                        },
+                { L_,   "%l\\",              "42"                        },
+                { L_,   "x%tx",              "x7x"                       },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            Rec mR;  const Rec& R = mR;
+            mR.fixedFields().setLineNumber(42);
+            mR.fixedFields().setThreadID(7);
+            mR.fixedFields().setSeverity(ball::Severity::e_WARN);
+            mR.fixedFields().setCategory("CAT");
+            mR.fixedFields().setFileName("dir/file.cpp");
+            mR.fixedFields().setMessage("msg");
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE     = DATA[ti].d_line;
+                const char *FORMAT   = DATA[ti].d_format;
+                const char *EXPECTED = DATA[ti].d_expected;
+
+                if (veryVerbose) { T_ P_(LINE) P(FORMAT) }
+
+                Obj mX(FORMAT);  const Obj& X = mX;
+                Obj mY;          const Obj& Y = mY;
+                mY.setFormat("%m %m %m");
+                mY.setFormat(FORMAT);
+                Obj mZ(X);       const Obj& Z = mZ;
+                Obj mW("%d");    const Obj& W = mW;
+                mW = X;
+
+                const Obj *const OBJECTS[] = { &X, &Y, &Z, &W };
+
+                for (int oi = 0; oi < 4; ++oi) {
+                    ostringstream os;
+                    (*OBJECTS[oi])(os, R);
+                    LOOP3_ASSERT(LINE, oi, os.str(), EXPECTED == os.str());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting cached timestamps." << endl;
+        {
+            const bdlt::Datetime BASE(2017, 12, 31, 23, 59, 58);
+
+            static const bsls::Types::Int64 STEPS[] = {
+                // Microseconds added to the previous timestamp.
+
+                0, 1, 999, 123456, 1, 500000, 374543, 0, 1000000,
+                3600 * 1000000LL, 1, 86400 * 1000000LL, 999999, 1
+            };
+            const int NUM_STEPS = sizeof STEPS / sizeof *STEPS;
+
+            const bdlt::DatetimeInterval OFFSETS[] = {
+                bdlt::DatetimeInterval(0),
+                bdlt::DatetimeInterval(0, 0, 0, 1),
+                bdlt::DatetimeInterval(0, -5),
+                bdlt::DatetimeInterval(0, 5, 30),
+                bdlt::DatetimeInterval(0, 0, 0, 0, 250)
+            };
+            const int NUM_OFFSETS = sizeof OFFSETS / sizeof *OFFSETS;
+
+            Obj mX("%d|%D|%i|%I|%O");  const Obj& X = mX;
+
+            for (int oi = 0; oi < NUM_OFFSETS; ++oi) {
+                const bdlt::DatetimeInterval& OFFSET = OFFSETS[oi];
+
+                mX.setTimestampOffset(OFFSET);
+
+                bdlt::Datetime timestamp(BASE);
+
+                for (int si = 0; si < NUM_STEPS; ++si) {
+                    timestamp.addMicroseconds(STEPS[si]);
+
+                    Rec mR;  const Rec& R = mR;
+                    mR.fixedFields().setTimestamp(timestamp);
+
+                    const bdlt::Datetime adjusted = timestamp + OFFSET;
+                    const bdlt::DatetimeTz adjustedTz(
+                                  adjusted,
+                                  static_cast<int>(OFFSET.totalMinutes()));
+
+                    bsl::string expected;
+                    char        buffer[64];
+
+                    adjusted.printToBuffer(buffer, sizeof buffer, 3);
+                    expected += buffer;
+                    expected += '|';
+                    adjusted.printToBuffer(buffer, sizeof buffer, 6);
+                    expected += buffer;
+
+                    static const int PRECISIONS[] = { 0, 3, 6 };
+                    for (int pi = 0; pi < 3; ++pi) {
+                        bdlt::Iso8601UtilConfiguration config;
+                        config.setFractionalSecondPrecision(PRECISIONS[pi]);
+                        config.setUseZAbbreviationForUtc(true);
+
+                        const int length = bdlt::Iso8601Util::generateRaw(
+                                                                   buffer,
+                                                                   adjustedTz,
+                                                                   config);
+                        expected += '|';
+                        expected.append(buffer, length);
+                    }
+
+                    ostringstream os;
+                    X(os, R);
+
+                    if (veryVerbose) { T_ P_(oi) P_(si) P(os.str()) }
+
+                    LOOP4_ASSERT(oi, si, expected, os.str(),
+                                 expected == os.str());
+                }
+            }
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING: Records Show Calculated Local-Time Offset
@@ -960,6 +1137,38 @@ int main(int argc, char *argv[])
             mRecord.fixedFields().setMessage(MSG);
         }
 
+        if (verbose) cout << "\n  Testing deferred messages." << endl;
+        {
+            mRecord.deferredMessage().setFormat("%s=%d\n");
+            mRecord.deferredMessage().appendArgument("count");
+            mRecord.deferredMessage().appendArgument(42);
+
+            oss1.str("");
+            mX.setFormat("[%m]");
+            X(oss1, record);
+            if (veryVerbose) { P(oss1.str()) }
+            ASSERT("[count=42\n]" == oss1.str());
+
+            oss1.str("");
+            mX.setFormat("%x");
+            X(oss1, record);
+            if (veryVerbose) { P(oss1.str()) }
+            ASSERT("count=42\\x0A" == oss1.str());
+
+            oss1.str("");
+            mX.setFormat("%X");
+            X(oss1, record);
+            if (veryVerbose) { P(oss1.str()) }
+            ASSERT("636F756E743D34320A" == oss1.str());
+
+            mRecord.deferredMessage().reset();
+
+            oss1.str("");
+            mX.setFormat("%m");
+            X(oss1, record);
+            ASSERT(oss1.str() == MSG);
+        }
+
         if (verbose) cout << "\n  Testing \"%u\"." << endl;
         {
             oss1.str("");
@@ -1769,6 +1978,60 @@ int main(int argc, char *argv[])
         ASSERT( 1 == (X1 == X4));        ASSERT(0 == (X1 != X4));
       } break;
 
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Formatting records having the default format specification, and
+        //:   timestamps that advance by less than a second, is fast.
+        //
+        // Plan:
+        //: 1 Format a large number of records, each with a timestamp one
+        //:   millisecond later than the last, and report the elapsed time.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE TEST"
+                          << "\n================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+
+        Obj mX;  const Obj& X = mX;
+
+        Rec mR;
+        mR.fixedFields().setTimestamp(bdlt::CurrentTime::utc());
+        mR.fixedFields().setLineNumber(542);
+        mR.fixedFields().setThreadID(1);
+        mR.fixedFields().setProcessID(2040);
+        mR.fixedFields().setSeverity(ball::Severity::e_WARN);
+        mR.fixedFields().setCategory("FOO.BAR.BAZ");
+        mR.fixedFields().setFileName("subdir/process.cpp");
+        mR.fixedFields().setMessage("Hello, World!");
+
+        ostringstream os;
+
+        const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            mR.fixedFields().setTimestamp(mR.fixedFields().timestamp() +
+                                         bdlt::DatetimeInterval(0,
+                                                                0,
+                                                                0,
+                                                                0,
+                                                                1));
+            os.seekp(0);
+            X(os, mR);
+        }
+
+        const bsls::Types::Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+        cout << NUM_ITERATIONS << " records formatted in "
+             << static_cast<double>(elapsed) / 1.0e9 << "s ("
+             << elapsed / NUM_ITERATIONS << "ns per record)" << endl;
+      } break;
       default:
         {
             cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
@@ -19,6 +19,7 @@ BSLS_IDENT_RCSID(balm_collectorrepository_cpp,"$Id$ $CSID$")
 
 #include <bslma_allocator.h>
 #include <bslma_default.h>
+#include <bslma_managedptr.h>
 #include <bsls_assert.h>
 
 #include <bsl_algorithm.h>   // for 'bsl::min' and 'bsl::max'
@@ -56,8 +57,9 @@ class CollectorRepository_Collectors {
     // This implementation class provides a container mechanism for managing a
     // set of objects of templatized type 'COLLECTOR' that are all associated
     // with a single metric.  The behavior is undefined unless the templatized
-    // type 'COLLECTOR' is either 'Collector' or
-    // 'IntegerCollector'.  A 'CollectorRepository_Collectors'
+    // type 'COLLECTOR' is 'Collector', 'IntegerCollector',
+    // 'ShardedIntegerCollector', or 'HistogramCollector'.  A
+    // 'CollectorRepository_Collectors'
     // object is supplied a 'MetricId' at construction, and provides a
     // default 'COLLECTOR' as well as a set of additional 'COLLECTOR' objects
     // for the identified metric.  Additional 'COLLECTOR' objects (beyond the
@@ -98,8 +100,9 @@ class CollectorRepository_Collectors {
         // 'metricId'.   Optionally specify a 'basicAllocator' used to supply
         // memory.  If 'basicAllocator' is 0, the currently installed default
         // allocator is used.  The behavior is undefined unless the
-        // templatized type 'COLLECTOR' is either 'Collector' or
-        // 'IntegerCollector', and 'metricId.isValid()' is 'true'.
+        // templatized type 'COLLECTOR' is 'Collector', 'IntegerCollector',
+        // 'ShardedIntegerCollector', or 'HistogramCollector', and
+        // 'metricId.isValid()' is 'true'.
 
     ~CollectorRepository_Collectors();
         // Destroy this object.
@@ -127,6 +130,17 @@ class CollectorRepository_Collectors {
         // collectors within this object record values for the same metric id,
         // so they can be aggregated into a single record.
 
+    void collectAndReset(MetricRecord *record, QuantileRecord *quantiles);
+        // Load into the specified 'record' the aggregate value of all the
+        // records collected by the collectors owned by this object and, if
+        // the specified 'quantiles' is not 0, load into 'quantiles' the
+        // quantiles of the merged distribution of the values recorded by
+        // those collectors; then reset those collectors to their default
+        // values.  The behavior is undefined unless the templatized type
+        // 'COLLECTOR' is 'HistogramCollector'.  Note that the values recorded
+        // by the added collectors are transferred to the default collector
+        // before being loaded.
+
     void collect(MetricRecord *record);
         // Load into the specified 'record' the aggregate value of all the
         // records collected by the collectors owned by this object.  Note
@@ -136,6 +150,14 @@ class CollectorRepository_Collectors {
         // subsequent 'collect' invocations will effectively re-collect the
         // current values.
 
+    void collect(MetricRecord *record, QuantileRecord *quantiles);
+        // Load into the specified 'record' the aggregate value of all the
+        // records collected by the collectors owned by this object and, if
+        // the specified 'quantiles' is not 0, load into 'quantiles' the
+        // quantiles of the merged distribution of the values recorded by
+        // those collectors.  The behavior is undefined unless the templatized
+        // type 'COLLECTOR' is 'HistogramCollector'.
+
     // ACCESSORS
     int getAddedCollectors(
                    bsl::vector<bsl::shared_ptr<COLLECTOR> > *collectors) const;
@@ -215,6 +237,19 @@ CollectorRepository_Collectors<COLLECTOR>::collectAndReset(
     }
 }
 
+template <class COLLECTOR>
+void
+CollectorRepository_Collectors<COLLECTOR>::collectAndReset(
+                                                     MetricRecord   *record,
+                                                     QuantileRecord *quantiles)
+{
+    typename CollectorSet::iterator it = d_addedCollectors.begin();
+    for (; it != d_addedCollectors.end(); ++it) {
+        d_defaultCollector.accumulateAndReset(it->get());
+    }
+    d_defaultCollector.loadAndReset(record, quantiles);
+}
+
 template <class COLLECTOR>
 void
 CollectorRepository_Collectors<COLLECTOR>::collect(MetricRecord *record)
@@ -228,6 +263,30 @@ CollectorRepository_Collectors<COLLECTOR>::collect(MetricRecord *record)
     }
 }
 
+template <class COLLECTOR>
+void
+CollectorRepository_Collectors<COLLECTOR>::collect(MetricRecord   *record,
+                                                   QuantileRecord *quantiles)
+{
+    if (d_addedCollectors.empty()) {
+        d_defaultCollector.load(record, quantiles);
+        return;                                                       // RETURN
+    }
+
+    // Merge the distributions recorded by the collectors into a temporary
+    // collector, so as not to modify the collectors themselves.
+
+    bslma::ManagedPtr<COLLECTOR> aggregate(
+                new (*d_allocator_p) COLLECTOR(d_defaultCollector.metricId()),
+                d_allocator_p);
+    aggregate->accumulate(d_defaultCollector);
+    typename CollectorSet::iterator it = d_addedCollectors.begin();
+    for (; it != d_addedCollectors.end(); ++it) {
+        aggregate->accumulate(**it);
+    }
+    aggregate->load(record, quantiles);
+}
+
 // ACCESSORS
 template <class COLLECTOR>
 int
@@ -256,23 +315,45 @@ CollectorRepository_Collectors<COLLECTOR>::metricId() const
 
 class CollectorRepository_MetricCollectors {
     // This implementation class provides a container mechanism for managing
-    // the 'Collector' and 'IntegerCollector' objects associated with a single
-    // metric.  The 'collector' and 'intCollector' methods are provided to
-    // access the individual containers for 'Collector' objects and
-    // 'IntegerCollector' objects, respectively.   The 'collectAndReset' method
-    // obtains the aggregate value of all the owned collectors and integer
-    // collectors, and then resets those collectors and integer collectors to
-    // their default state.
+    // the 'Collector', 'IntegerCollector', 'ShardedIntegerCollector', and
+    // 'HistogramCollector' objects associated with a single metric.  The
+    // 'collector' and 'intCollector' methods are provided to access the
+    // individual containers for 'Collector' objects and 'IntegerCollector'
+    // objects, respectively.  The containers for 'ShardedIntegerCollector'
+    // and 'HistogramCollector' objects are created only on demand (by
+    // 'createShardedIntCollectors' and 'createHistogramCollectors'), as those
+    // collectors are comparatively large, and are accessed using
+    // 'shardedIntCollectors' and 'histogramCollectors'.  The
+    // 'collectAndReset' method obtains the aggregate value of all the owned
+    // collectors, and then resets those collectors to their default state.
 
     // PRIVATE TYPES
     typedef CollectorRepository_Collectors<Collector>
                                                         Collectors;
     typedef CollectorRepository_Collectors<IntegerCollector>
                                                         IntCollectors;
+    typedef CollectorRepository_Collectors<ShardedIntegerCollector>
+                                                        ShardedIntCollectors;
+    typedef CollectorRepository_Collectors<HistogramCollector>
+                                                        HistogramCollectors;
 
     // DATA
-    Collectors    d_collectors;     // collector objects
-    IntCollectors d_intCollectors;  // integer collector objects
+    Collectors                             d_collectors;
+                                              // collector objects
+
+    IntCollectors                          d_intCollectors;
+                                              // integer collector objects
+
+    bslma::ManagedPtr<ShardedIntCollectors> d_shardedIntCollectors_mp;
+                                              // sharded integer collector
+                                              // objects (created on demand)
+
+    bslma::ManagedPtr<HistogramCollectors> d_histogramCollectors_mp;
+                                              // histogram collector objects
+                                              // (created on demand)
+
+    bslma::Allocator                      *d_allocator_p;
+                                              // allocator (held, not owned)
 
     // NOT IMPLEMENTED
     CollectorRepository_MetricCollectors(
@@ -306,6 +387,29 @@ class CollectorRepository_MetricCollectors {
         // Return a reference to the modifiable container of
         // 'IntegerCollector' objects.
 
+    CollectorRepository_Collectors<ShardedIntegerCollector> *
+                                                        shardedIntCollectors();
+        // Return the address of the modifiable container of
+        // 'ShardedIntegerCollector' objects, or 0 if that container has not
+        // been created.
+
+    CollectorRepository_Collectors<ShardedIntegerCollector>&
+                                                  createShardedIntCollectors();
+        // Return a reference to the modifiable container of
+        // 'ShardedIntegerCollector' objects, creating that container if it
+        // does not already exist.
+
+    CollectorRepository_Collectors<HistogramCollector> *histogramCollectors();
+        // Return the address of the modifiable container of
+        // 'HistogramCollector' objects, or 0 if that container has not been
+        // created.
+
+    CollectorRepository_Collectors<HistogramCollector>&
+                                                   createHistogramCollectors();
+        // Return a reference to the modifiable container of
+        // 'HistogramCollector' objects, creating that container if it does
+        // not already exist.
+
     void collectAndReset(MetricRecord *record);
         // Load into the specified 'record' the aggregate value of all the
         // records collected by the collectors owned by this object; then
@@ -313,6 +417,15 @@ class CollectorRepository_MetricCollectors {
         // collectors within this object record values for the same metric id,
         // so they can be aggregated into a single record.
 
+    bool collectAndReset(MetricRecord *record, QuantileRecord *quantiles);
+        // Load into the specified 'record' the aggregate value of all the
+        // records collected by the collectors owned by this object and, if
+        // this object has histogram collectors and the specified 'quantiles'
+        // is not 0, load into 'quantiles' the quantiles of the values
+        // recorded by those histogram collectors; then reset those collectors
+        // to their default values.  Return 'true' if 'quantiles' was loaded,
+        // and 'false' otherwise.
+
     void collect(MetricRecord *record);
         // Load into the specified 'record' the aggregate value of all the
         // records collected by the collectors owned by this object.  Note
@@ -322,6 +435,14 @@ class CollectorRepository_MetricCollectors {
         // subsequent 'collect' invocations will effectively re-collect the
         // current values.
 
+    bool collect(MetricRecord *record, QuantileRecord *quantiles);
+        // Load into the specified 'record' the aggregate value of all the
+        // records collected by the collectors owned by this object and, if
+        // this object has histogram collectors and the specified 'quantiles'
+        // is not 0, load into 'quantiles' the quantiles of the values
+        // recorded by those histogram collectors.  Return 'true' if
+        // 'quantiles' was loaded, and 'false' otherwise.
+
     // ACCESSORS
     const CollectorRepository_Collectors<Collector>& collectors() const;
         // Return a reference to the non-modifiable container of 'Collector'
@@ -349,6 +470,9 @@ CollectorRepository_MetricCollectors(const MetricId&   id,
                                      bslma::Allocator *basicAllocator)
 : d_collectors(id, basicAllocator)
 , d_intCollectors(id, basicAllocator)
+, d_shardedIntCollectors_mp()
+, d_histogramCollectors_mp()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
 
@@ -373,21 +497,94 @@ CollectorRepository_MetricCollectors::intCollectors()
     return d_intCollectors;
 }
 
+inline
+CollectorRepository_Collectors<ShardedIntegerCollector> *
+CollectorRepository_MetricCollectors::shardedIntCollectors()
+{
+    return d_shardedIntCollectors_mp.ptr();
+}
+
+CollectorRepository_Collectors<ShardedIntegerCollector>&
+CollectorRepository_MetricCollectors::createShardedIntCollectors()
+{
+    if (!d_shardedIntCollectors_mp) {
+        d_shardedIntCollectors_mp.load(
+                   new (*d_allocator_p) ShardedIntCollectors(metricId(),
+                                                             d_allocator_p),
+                   d_allocator_p);
+    }
+    return *d_shardedIntCollectors_mp;
+}
+
+inline
+CollectorRepository_Collectors<HistogramCollector> *
+CollectorRepository_MetricCollectors::histogramCollectors()
+{
+    return d_histogramCollectors_mp.ptr();
+}
+
+CollectorRepository_Collectors<HistogramCollector>&
+CollectorRepository_MetricCollectors::createHistogramCollectors()
+{
+    if (!d_histogramCollectors_mp) {
+        d_histogramCollectors_mp.load(
+                    new (*d_allocator_p) HistogramCollectors(metricId(),
+                                                             d_allocator_p),
+                    d_allocator_p);
+    }
+    return *d_histogramCollectors_mp;
+}
+
+inline
 void CollectorRepository_MetricCollectors::collectAndReset(
                                                           MetricRecord *record)
+{
+    collectAndReset(record, 0);
+}
+
+bool CollectorRepository_MetricCollectors::collectAndReset(
+                                                     MetricRecord   *record,
+                                                     QuantileRecord *quantiles)
 {
     d_collectors.collectAndReset(record);
     MetricRecord tempRecord;
     d_intCollectors.collectAndReset(&tempRecord);
     combine(record, tempRecord);
+    if (d_shardedIntCollectors_mp) {
+        d_shardedIntCollectors_mp->collectAndReset(&tempRecord);
+        combine(record, tempRecord);
+    }
+    if (d_histogramCollectors_mp) {
+        d_histogramCollectors_mp->collectAndReset(&tempRecord, quantiles);
+        combine(record, tempRecord);
+        return 0 != quantiles;                                        // RETURN
+    }
+    return false;
 }
 
+inline
 void CollectorRepository_MetricCollectors::collect(MetricRecord *record)
+{
+    collect(record, 0);
+}
+
+bool CollectorRepository_MetricCollectors::collect(MetricRecord   *record,
+                                                   QuantileRecord *quantiles)
 {
     d_collectors.collect(record);
     MetricRecord tempRecord;
     d_intCollectors.collect(&tempRecord);
     combine(record, tempRecord);
+    if (d_shardedIntCollectors_mp) {
+        d_shardedIntCollectors_mp->collect(&tempRecord);
+        combine(record, tempRecord);
+    }
+    if (d_histogramCollectors_mp) {
+        d_histogramCollectors_mp->collect(&tempRecord, quantiles);
+        combine(record, tempRecord);
+        return 0 != quantiles;                                        // RETURN
+    }
+    return false;
 }
 
 // ACCESSORS
@@ -449,6 +646,14 @@ CollectorRepository::getMetricCollectors(const MetricId& metricId)
 // MANIPULATORS
 void CollectorRepository::collectAndReset(bsl::vector<MetricRecord> *records,
                                           const Category            *category)
+{
+    collectAndReset(records, 0, category);
+}
+
+void CollectorRepository::collectAndReset(
+                                  bsl::vector<MetricRecord>   *records,
+                                  bsl::vector<QuantileRecord> *quantileRecords,
+                                  const Category              *category)
 {
     bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
 
@@ -463,8 +668,13 @@ void CollectorRepository::collectAndReset(bsl::vector<MetricRecord> *records,
         // Each 'MetricCollectors' object (in the 'd_categories' map) contains
         // the collectors for a single metric.
         for (; metricIt != metricCollectors.end(); ++metricIt) {
-            MetricRecord record;
-            (*metricIt)->collectAndReset(&record);
+            MetricRecord   record;
+            QuantileRecord quantiles;
+            if ((*metricIt)->collectAndReset(
+                                       &record,
+                                       quantileRecords ? &quantiles : 0)) {
+                quantileRecords->push_back(quantiles);
+            }
             records->push_back(record);
         }
     }
@@ -473,7 +683,14 @@ void CollectorRepository::collectAndReset(bsl::vector<MetricRecord> *records,
 void CollectorRepository::collect(bsl::vector<MetricRecord> *records,
                                   const Category            *category)
 {
-    // PRIVATE TYPES
+    collect(records, 0, category);
+}
+
+void CollectorRepository::collect(
+                                  bsl::vector<MetricRecord>   *records,
+                                  bsl::vector<QuantileRecord> *quantileRecords,
+                                  const Category              *category)
+{
     bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
 
     CategorizedCollectors::iterator catIt = d_categories.find(category);
@@ -487,8 +704,12 @@ void CollectorRepository::collect(bsl::vector<MetricRecord> *records,
         // Each 'MetricCollectors' object (in the 'd_categories' map) contains
         // the collectors for a single metric.
         for (; metricIt != metricCollectors.end(); ++metricIt) {
-            MetricRecord record;
-            (*metricIt)->collect(&record);
+            MetricRecord   record;
+            QuantileRecord quantiles;
+            if ((*metricIt)->collect(&record,
+                                     quantileRecords ? &quantiles : 0)) {
+                quantileRecords->push_back(quantiles);
+            }
             records->push_back(record);
         }
     }
@@ -531,6 +752,51 @@ IntegerCollector *CollectorRepository::getDefaultIntegerCollector(
     return getMetricCollectors(metricId).intCollectors().defaultCollector();
 }
 
+ShardedIntegerCollector *
+CollectorRepository::getDefaultShardedIntegerCollector(
+                                                      const MetricId& metricId)
+{
+    // First, obtain a read-lock, and test if the 'MetricCollectors' object
+    // for 'metricId', and its sharded integer collectors, already exist.
+    {
+        bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+        Collectors::iterator it = d_collectors.find(metricId);
+        if (it != d_collectors.end() && it->second->shardedIntCollectors()) {
+            return it->second->shardedIntCollectors()->defaultCollector();
+                                                                      // RETURN
+        }
+    }
+
+    // Use 'getMetricCollectors' and 'createShardedIntCollectors' to create the
+    // required objects (if they have not been created since the read-lock was
+    // released).
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    return getMetricCollectors(metricId).createShardedIntCollectors()
+                                                          .defaultCollector();
+}
+
+HistogramCollector *
+CollectorRepository::getDefaultHistogramCollector(const MetricId& metricId)
+{
+    // First, obtain a read-lock, and test if the 'MetricCollectors' object
+    // for 'metricId', and its histogram collectors, already exist.
+    {
+        bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+        Collectors::iterator it = d_collectors.find(metricId);
+        if (it != d_collectors.end() && it->second->histogramCollectors()) {
+            return it->second->histogramCollectors()->defaultCollector();
+                                                                      // RETURN
+        }
+    }
+
+    // Use 'getMetricCollectors' and 'createHistogramCollectors' to create the
+    // required objects (if they have not been created since the read-lock was
+    // released).
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    return getMetricCollectors(metricId).createHistogramCollectors()
+                                                          .defaultCollector();
+}
+
 bsl::shared_ptr<Collector> CollectorRepository::addCollector(
                                                       const MetricId& metricId)
 {
@@ -545,6 +811,22 @@ CollectorRepository::addIntegerCollector(const MetricId& metricId)
     return getMetricCollectors(metricId).intCollectors().addCollector();
 }
 
+bsl::shared_ptr<ShardedIntegerCollector>
+CollectorRepository::addShardedIntegerCollector(const MetricId& metricId)
+{
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    return getMetricCollectors(metricId).createShardedIntCollectors()
+                                                              .addCollector();
+}
+
+bsl::shared_ptr<HistogramCollector>
+CollectorRepository::addHistogramCollector(const MetricId& metricId)
+{
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    return getMetricCollectors(metricId).createHistogramCollectors()
+                                                              .addCollector();
+}
+
 int CollectorRepository::getAddedCollectors(
                bsl::vector<bsl::shared_ptr<Collector> >         *collectors,
                bsl::vector<bsl::shared_ptr<IntegerCollector> >  *intCollectors,
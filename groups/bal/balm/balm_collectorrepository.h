@@ -20,7 +20,9 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //   balm::CollectorRepository: a repository for collectors
 //
-//@SEE_ALSO: balm_collector, balm_integercollector, balm_metricsmanager
+//@SEE_ALSO: balm_collector, balm_integercollector,
+//           balm_shardedintegercollector, balm_histogramcollector,
+//           balm_metricsmanager
 //
 //@DESCRIPTION: This component defines a class, 'balm::CollectorRepository',
 // that serves as a repository for 'balm::Collector' and
@@ -36,9 +38,20 @@ BSLS_IDENT("$Id: $")
 // can safely collect values from multiple threads, however, the collector does
 // use a mutex: Applications anticipating high contention for that lock can use
 // 'addCollector' (and 'addIntegerCollector') to obtain multiple collectors and
-// thereby reduce contention.  Finally, the 'collectAndReset' operation
+// thereby reduce contention.  Alternatively, applications can use
+// 'getDefaultShardedIntegerCollector' (or 'addShardedIntegerCollector') to
+// obtain a 'balm::ShardedIntegerCollector', which records integral values
+// without taking a lock (see 'balm_shardedintegercollector').  Similarly,
+// 'getDefaultHistogramCollector' (or 'addHistogramCollector') obtains a
+// 'balm::HistogramCollector', which additionally records the distribution of
+// the values of a metric so that its quantiles can be reported (see
+// 'balm_histogramcollector').  Finally, the 'collectAndReset' operation
 // collects and returns metric records from each of the collectors in the
-// repository.
+// repository, merging the values recorded by all the collectors (of any type)
+// for a metric into a single record.  An overload of 'collectAndReset' also
+// returns a 'balm::QuantileRecord' for each metric having histogram
+// collectors, merging the distributions recorded by all the histogram
+// collectors for that metric.
 //
 ///Thread Safety
 ///-------------
@@ -111,6 +124,10 @@ BSLS_IDENT("$Id: $")
 #include <balm_collector.h>
 #endif
 
+#ifndef INCLUDED_BALM_HISTOGRAMCOLLECTOR
+#include <balm_histogramcollector.h>
+#endif
+
 #ifndef INCLUDED_BALM_INTEGERCOLLECTOR
 #include <balm_integercollector.h>
 #endif
@@ -127,6 +144,14 @@ BSLS_IDENT("$Id: $")
 #include <balm_metricregistry.h>
 #endif
 
+#ifndef INCLUDED_BALM_QUANTILERECORD
+#include <balm_quantilerecord.h>
+#endif
+
+#ifndef INCLUDED_BALM_SHARDEDINTEGERCOLLECTOR
+#include <balm_shardedintegercollector.h>
+#endif
+
 #ifndef INCLUDED_BSLMT_RWMUTEX
 #include <bslmt_rwmutex.h>
 #endif
@@ -167,11 +192,12 @@ class CollectorRepository_MetricCollectors;  // defined in implementation
 
 class CollectorRepository {
     // This class defines a fully thread-safe repository mechanism for
-    // 'Collector' and 'IntegerCollector' objects.  Collectors are identified
-    // in the repository by a 'MetricId' object and also grouped together
-    // according to the category of the metric.  This repository supports
-    // operations to create, find, and collect metric records from the
-    // collectors in the repository.
+    // 'Collector', 'IntegerCollector', 'ShardedIntegerCollector', and
+    // 'HistogramCollector' objects.  Collectors are identified in the
+    // repository by a 'MetricId' object and also grouped together according
+    // to the category of the metric.  This repository supports operations to
+    // create, find, and collect metric records (and quantile records) from
+    // the collectors in the repository.
 
     // PRIVATE TYPES
     typedef CollectorRepository_MetricCollectors     MetricCollectors;
@@ -241,6 +267,16 @@ class CollectorRepository {
         // specified 'category'; then reset those collectors to their default
         // values.
 
+    void collectAndReset(bsl::vector<MetricRecord>   *records,
+                         bsl::vector<QuantileRecord> *quantileRecords,
+                         const Category              *category);
+        // Append to the specified 'records' the collected metric record
+        // values from the collectors in this repository belonging to the
+        // specified 'category', and append to the specified
+        // 'quantileRecords' the collected quantiles for each of those metrics
+        // having one or more histogram collectors; then reset those
+        // collectors to their default values.
+
     void collect(bsl::vector<MetricRecord> *records,
                  const Category            *category);
         // Append to the specified 'records' the collected metric record
@@ -249,6 +285,17 @@ class CollectorRepository {
         // managed collectors, so subsequent collection operations will
         // effectively re-collect the current values.
 
+    void collect(bsl::vector<MetricRecord>   *records,
+                 bsl::vector<QuantileRecord> *quantileRecords,
+                 const Category              *category);
+        // Append to the specified 'records' the collected metric record
+        // values from the collectors in this repository belonging to the
+        // specified 'category', and append to the specified
+        // 'quantileRecords' the collected quantiles for each of those metrics
+        // having one or more histogram collectors.  Note that this operation
+        // does not reset the managed collectors, so subsequent collection
+        // operations will effectively re-collect the current values.
+
     Collector *getDefaultCollector(const char *category,
                                    const char *metricName);
         // Return the address of the modifiable default collector identified by
@@ -291,6 +338,58 @@ class CollectorRepository {
         // repository, create one, add it to the repository, and return its
         // address.
 
+    ShardedIntegerCollector *getDefaultShardedIntegerCollector(
+                                                       const char *category,
+                                                       const char *metricName);
+        // Return the address of the modifiable default sharded integer
+        // collector identified by the specified 'category' and 'metricName'.
+        // If a default sharded integer collector for the identified metric
+        // does not already exist in the repository, create one, add it to the
+        // repository, and return its address.  In addition, if the identified
+        // metric has not already been registered, add the identified metric
+        // to the 'metricRegistry' supplied at construction.  The behavior is
+        // undefined unless 'category' and 'metricName' are null-terminated.
+        // Note that this operation is logically equivalent to:
+        //..
+        //  getDefaultShardedIntegerCollector(
+        //                              registry().getId(category, metricName))
+        //..
+
+    ShardedIntegerCollector *getDefaultShardedIntegerCollector(
+                                                     const MetricId& metricId);
+        // Return the address of the modifiable default sharded integer
+        // collector identified by the specified 'metricId'.  If a default
+        // sharded integer collector for the identified metric does not
+        // already exist in the repository, create one, add it to the
+        // repository, and return its address.  Note that, unlike the default
+        // collector and default integer collector, the default sharded integer
+        // collector for a metric is created only on demand.
+
+    HistogramCollector *getDefaultHistogramCollector(const char *category,
+                                                     const char *metricName);
+        // Return the address of the modifiable default histogram collector
+        // identified by the specified 'category' and 'metricName'.  If a
+        // default histogram collector for the identified metric does not
+        // already exist in the repository, create one, add it to the
+        // repository, and return its address.  In addition, if the identified
+        // metric has not already been registered, add the identified metric
+        // to the 'metricRegistry' supplied at construction.  The behavior is
+        // undefined unless 'category' and 'metricName' are null-terminated.
+        // Note that this operation is logically equivalent to:
+        //..
+        //  getDefaultHistogramCollector(
+        //                              registry().getId(category, metricName))
+        //..
+
+    HistogramCollector *getDefaultHistogramCollector(
+                                                     const MetricId& metricId);
+        // Return the address of the modifiable default histogram collector
+        // identified by the specified 'metricId'.  If a default histogram
+        // collector for the identified metric does not already exist in the
+        // repository, create one, add it to the repository, and return its
+        // address.  Note that, as for sharded integer collectors, the default
+        // histogram collector for a metric is created only on demand.
+
     bsl::shared_ptr<Collector> addCollector(const char *category,
                                             const char *metricName);
         // Return a shared pointer to a newly-created modifiable collector
@@ -330,6 +429,50 @@ class CollectorRepository {
         // repository.  The behavior is undefined unless 'metricId' is a valid
         // id returned by the 'MetricRepository' supplied at construction.
 
+    bsl::shared_ptr<ShardedIntegerCollector> addShardedIntegerCollector(
+                                                       const char *category,
+                                                       const char *metricName);
+        // Return a shared pointer to a newly created modifiable sharded
+        // integer collector identified by the specified 'category' and
+        // 'metricName' and add that collector to the repository.  If is not
+        // already registered, also add the identified metric to the
+        // 'metricRegistry' supplied at construction.  The behavior is
+        // undefined unless 'category' and 'metricName' are null-terminated.
+        // Note that this operation is logically equivalent to:
+        //..
+        //  addShardedIntegerCollector(registry().getId(category, metricName))
+        //..
+
+    bsl::shared_ptr<ShardedIntegerCollector> addShardedIntegerCollector(
+                                                     const MetricId& metricId);
+        // Return a shared pointer to a newly-created modifiable sharded
+        // integer collector identified by the specified 'metricId' and add
+        // that collector to the repository.  The behavior is undefined unless
+        // 'metricId' is a valid id returned by the 'MetricRepository'
+        // supplied at construction.
+
+    bsl::shared_ptr<HistogramCollector> addHistogramCollector(
+                                                       const char *category,
+                                                       const char *metricName);
+        // Return a shared pointer to a newly created modifiable histogram
+        // collector identified by the specified 'category' and 'metricName'
+        // and add that collector to the repository.  If is not already
+        // registered, also add the identified metric to the 'metricRegistry'
+        // supplied at construction.  The behavior is undefined unless
+        // 'category' and 'metricName' are null-terminated.  Note that this
+        // operation is logically equivalent to:
+        //..
+        //  addHistogramCollector(registry().getId(category, metricName))
+        //..
+
+    bsl::shared_ptr<HistogramCollector> addHistogramCollector(
+                                                     const MetricId& metricId);
+        // Return a shared pointer to a newly-created modifiable histogram
+        // collector identified by the specified 'metricId' and add that
+        // collector to the repository.  The behavior is undefined unless
+        // 'metricId' is a valid id returned by the 'MetricRepository'
+        // supplied at construction.
+
     int getAddedCollectors(
                bsl::vector<bsl::shared_ptr<Collector> >         *collectors,
                bsl::vector<bsl::shared_ptr<IntegerCollector> >  *intCollectors,
@@ -396,6 +539,24 @@ IntegerCollector *CollectorRepository::getDefaultIntegerCollector(
                                                           metricName));
 }
 
+inline
+ShardedIntegerCollector *
+CollectorRepository::getDefaultShardedIntegerCollector(const char *category,
+                                                       const char *metricName)
+{
+    return getDefaultShardedIntegerCollector(d_registry_p->getId(category,
+                                                                 metricName));
+}
+
+inline
+HistogramCollector *
+CollectorRepository::getDefaultHistogramCollector(const char *category,
+                                                  const char *metricName)
+{
+    return getDefaultHistogramCollector(d_registry_p->getId(category,
+                                                            metricName));
+}
+
 inline
 bsl::shared_ptr<Collector> CollectorRepository::addCollector(
                                                         const char *category,
@@ -412,6 +573,23 @@ CollectorRepository::addIntegerCollector(const char *category,
     return addIntegerCollector(d_registry_p->getId(category, metricName));
 }
 
+inline
+bsl::shared_ptr<ShardedIntegerCollector>
+CollectorRepository::addShardedIntegerCollector(const char *category,
+                                                const char *metricName)
+{
+    return addShardedIntegerCollector(d_registry_p->getId(category,
+                                                          metricName));
+}
+
+inline
+bsl::shared_ptr<HistogramCollector>
+CollectorRepository::addHistogramCollector(const char *category,
+                                           const char *metricName)
+{
+    return addHistogramCollector(d_registry_p->getId(category, metricName));
+}
+
 inline
 MetricRegistry& CollectorRepository::registry()
 {
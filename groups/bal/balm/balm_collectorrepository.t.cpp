@@ -63,6 +63,16 @@ using bsl::flush;
 // [ 2] addCollector(const MetricId& metricId);
 // [ 5] addIntegerCollector(const StringRef&, const StringRef&);
 // [ 2] addIntegerCollector(const MetricId&);
+// [ 9] getDefaultShardedIntegerCollector(const char *, const char *);
+// [ 9] getDefaultShardedIntegerCollector(const MetricId&);
+// [ 9] addShardedIntegerCollector(const char *, const char *);
+// [ 9] addShardedIntegerCollector(const MetricId&);
+// [10] void collectAndReset(v<MR> *, v<QR> *, const Category *);
+// [10] void collect(v<MR> *, v<QR> *, const Category *);
+// [10] getDefaultHistogramCollector(const char *, const char *);
+// [10] getDefaultHistogramCollector(const MetricId&);
+// [10] addHistogramCollector(const char *, const char *);
+// [10] addHistogramCollector(const MetricId&);
 // [ 2] int getAddedCollectors(v<C *> *, v<IC *> *, const MetricId&);
 // [ 2] MetricRegistry &registry();
 // [ 4] void collectAndReset(v<MetricRecord> *, const Category *);
@@ -72,7 +82,7 @@ using bsl::flush;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] CONCURRENCY TEST
-// [ 9] USAGE EXAMPLE
+// [11] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -387,7 +397,7 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 11: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -464,6 +474,309 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING HISTOGRAM COLLECTORS
+        //
+        // Concerns:
+        //: 1 'getDefaultHistogramCollector' returns the same collector for
+        //:   the same metric, and a different collector for a different
+        //:   metric, whether the metric is identified by name or by id.
+        //:
+        //: 2 'addHistogramCollector' returns a new collector for the
+        //:   identified metric on each invocation.
+        //:
+        //: 3 'collect' and 'collectAndReset' combine the count, total,
+        //:   minimum, and maximum recorded by the histogram collectors for a
+        //:   metric with those recorded by its other collectors.
+        //:
+        //: 4 The overloads taking a vector of quantile records append one
+        //:   quantile record for each metric having histogram collectors,
+        //:   computed over the values recorded by all of those collectors.
+        //:
+        //: 5 'collectAndReset' resets the histogram collectors, and 'collect'
+        //:   does not.
+        //:
+        //: 6 All memory is supplied by the allocator supplied at
+        //:   construction.
+        //
+        // Plan:
+        //: 1 Create a repository, obtain default and added collectors for a
+        //:   number of metrics, and verify their identity.  (C-1..2)
+        //:
+        //: 2 Update the collectors and verify the records returned by
+        //:   'collect' and then by 'collectAndReset', with and without
+        //:   quantile records, and that a subsequent 'collect' returns
+        //:   default values.  (C-3..5)
+        //:
+        //: 3 Verify that the default allocator was not used.  (C-6)
+        //
+        // Testing:
+        //   void collectAndReset(v<MR> *, v<QR> *, const Category *);
+        //   void collect(v<MR> *, v<QR> *, const Category *);
+        //   getDefaultHistogramCollector(const char *, const char *);
+        //   getDefaultHistogramCollector(const MetricId&);
+        //   addHistogramCollector(const char *, const char *);
+        //   addHistogramCollector(const MetricId&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING HISTOGRAM COLLECTORS"
+                          << endl << "============================"
+                          << endl;
+
+        typedef balm::HistogramCollector HCol;
+        typedef balm::QuantileRecord     QRec;
+
+        Registry reg(Z);
+        Obj      mX(&reg, Z);
+
+        const balm::Category *CATEGORY = reg.getCategory("Histogram");
+
+        // 'A' has a default integer collector, a default histogram collector,
+        // and an added histogram collector.  'B' has only a default histogram
+        // collector.  'C' has no histogram collector.
+
+        ICol *iColA = mX.getDefaultIntegerCollector("Histogram", "A");
+        HCol *hColA = mX.getDefaultHistogramCollector("Histogram", "A");
+        HCol *hColB = mX.getDefaultHistogramCollector("Histogram", "B");
+        ICol *iColC = mX.getDefaultIntegerCollector("Histogram", "C");
+
+        const Id ID_A = reg.getId("Histogram", "A");
+        const Id ID_B = reg.getId("Histogram", "B");
+        const Id ID_C = reg.getId("Histogram", "C");
+
+        ASSERT(0     != hColA);
+        ASSERT(0     != hColB);
+        ASSERT(hColA != hColB);
+        ASSERT(ID_A  == hColA->metricId());
+        ASSERT(ID_B  == hColB->metricId());
+        ASSERT(hColA == mX.getDefaultHistogramCollector("Histogram", "A"));
+        ASSERT(hColA == mX.getDefaultHistogramCollector(ID_A));
+        ASSERT(hColB == mX.getDefaultHistogramCollector(ID_B));
+        ASSERT(iColA == mX.getDefaultIntegerCollector(ID_A));
+
+        bsl::shared_ptr<HCol> addedA1 =
+                                  mX.addHistogramCollector("Histogram", "A");
+        bsl::shared_ptr<HCol> addedA2 = mX.addHistogramCollector(ID_A);
+        ASSERT(addedA1.get() != addedA2.get());
+        ASSERT(addedA1.get() != hColA);
+        ASSERT(ID_A          == addedA1->metricId());
+        ASSERT(ID_A          == addedA2->metricId());
+
+        // Record 1..10 for 'A', split across its histogram collectors, so
+        // that the quantiles are exact.
+
+        iColA->update(100);
+        for (int i = 1; i <= 10; ++i) {
+            switch (i % 3) {
+              case 0: hColA->update(i);    break;
+              case 1: addedA1->update(i);  break;
+              default: addedA2->update(i); break;
+            }
+        }
+        hColB->update(7);
+        iColC->update(3);
+
+        for (int i = 0; i < 3; ++i) {
+            bsl::vector<Rec>  records(Z);
+            bsl::vector<QRec> quantiles(Z);
+            switch (i) {
+              case 0: mX.collect(&records, CATEGORY);                  break;
+              case 1: mX.collect(&records, &quantiles, CATEGORY);      break;
+              default: mX.collectAndReset(&records, &quantiles, CATEGORY);
+            }
+            ASSERTV(i, records.size(), 3 == records.size());
+
+            for (bsl::size_t j = 0; j < records.size(); ++j) {
+                const Rec& R = records[j];
+                if (ID_A == R.metricId()) {
+                    ASSERTV(i, R.count(), 11     == R.count());
+                    ASSERTV(i, R.total(), 155.0  == R.total());
+                    ASSERTV(i, R.min(),   1.0    == R.min());
+                    ASSERTV(i, R.max(),   100.0  == R.max());
+                }
+                else if (ID_B == R.metricId()) {
+                    ASSERTV(i, R.count(), 1   == R.count());
+                    ASSERTV(i, R.total(), 7.0 == R.total());
+                }
+                else {
+                    ASSERTV(i, ID_C == R.metricId());
+                    ASSERTV(i, R.count(), 1   == R.count());
+                    ASSERTV(i, R.total(), 3.0 == R.total());
+                }
+            }
+
+            if (0 == i) {
+                ASSERTV(quantiles.size(), quantiles.empty());
+                continue;
+            }
+            ASSERTV(i, quantiles.size(), 2 == quantiles.size());
+            for (bsl::size_t j = 0; j < quantiles.size(); ++j) {
+                const QRec& QR = quantiles[j];
+                if (ID_A == QR.metricId()) {
+                    ASSERTV(i, QR.count(),    10   == QR.count());
+                    ASSERTV(i, QR.value(0),   5.0  == QR.value(0));
+                    ASSERTV(i, QR.value(1),   9.0  == QR.value(1));
+                    ASSERTV(i, QR.value(2),   10.0 == QR.value(2));
+                    ASSERTV(i, QR.value(3),   10.0 == QR.value(3));
+                }
+                else {
+                    ASSERTV(i, ID_B == QR.metricId());
+                    ASSERTV(i, QR.count(),    1   == QR.count());
+                    ASSERTV(i, QR.value(0),   7.0 == QR.value(0));
+                    ASSERTV(i, QR.value(3),   7.0 == QR.value(3));
+                }
+            }
+        }
+
+        bsl::vector<Rec>  records(Z);
+        bsl::vector<QRec> quantiles(Z);
+        mX.collect(&records, &quantiles, CATEGORY);
+        ASSERT(3 == records.size());
+        ASSERT(2 == quantiles.size());
+        for (bsl::size_t j = 0; j < records.size(); ++j) {
+            ASSERTV(j, 0                  == records[j].count());
+            ASSERTV(j, Rec::k_DEFAULT_MIN == records[j].min());
+            ASSERTV(j, Rec::k_DEFAULT_MAX == records[j].max());
+        }
+        for (bsl::size_t j = 0; j < quantiles.size(); ++j) {
+            ASSERTV(j, 0 == quantiles[j].count());
+        }
+
+        ASSERT(0 == defaultAllocator.numBytesInUse());
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING SHARDED INTEGER COLLECTORS
+        //
+        // Concerns:
+        //: 1 'getDefaultShardedIntegerCollector' returns the same collector
+        //:   for the same metric, and a different collector for a different
+        //:   metric, whether the metric is identified by name or by id.
+        //:
+        //: 2 'addShardedIntegerCollector' returns a new collector for the
+        //:   identified metric on each invocation.
+        //:
+        //: 3 'collect' and 'collectAndReset' combine the values recorded by
+        //:   the sharded integer collectors for a metric with those recorded
+        //:   by its other collectors, and 'collectAndReset' resets the
+        //:   sharded integer collectors.
+        //:
+        //: 4 A metric having only sharded integer collectors is collected.
+        //:
+        //: 5 Creating the default sharded integer collector of a metric
+        //:   whose other collectors already exist does not affect them.
+        //:
+        //: 6 All memory is supplied by the allocator supplied at
+        //:   construction.
+        //
+        // Plan:
+        //: 1 Create a repository, obtain default and added collectors of each
+        //:   type for a number of metrics, and verify their identity.
+        //:   (C-1..2, 5)
+        //:
+        //: 2 Update the collectors and verify the records returned by
+        //:   'collect' and then by 'collectAndReset', and that a subsequent
+        //:   'collect' returns default values.  (C-3..4)
+        //:
+        //: 3 Verify that the default allocator was not used.  (C-6)
+        //
+        // Testing:
+        //   getDefaultShardedIntegerCollector(const char *, const char *);
+        //   getDefaultShardedIntegerCollector(const MetricId&);
+        //   addShardedIntegerCollector(const char *, const char *);
+        //   addShardedIntegerCollector(const MetricId&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING SHARDED INTEGER COLLECTORS"
+                          << endl << "==================================="
+                          << endl;
+
+        typedef balm::ShardedIntegerCollector SICol;
+
+        Registry reg(Z);
+        Obj      mX(&reg, Z);
+
+        const balm::Category *CATEGORY = reg.getCategory("Sharded");
+
+        // 'A' has a default collector of each type, and an added sharded
+        // integer collector.  'B' has only a default sharded integer
+        // collector.
+
+        Col   *colA  = mX.getDefaultCollector("Sharded", "A");
+        ICol  *iColA = mX.getDefaultIntegerCollector("Sharded", "A");
+        SICol *sColA = mX.getDefaultShardedIntegerCollector("Sharded", "A");
+        SICol *sColB = mX.getDefaultShardedIntegerCollector("Sharded", "B");
+
+        const Id ID_A = reg.getId("Sharded", "A");
+        const Id ID_B = reg.getId("Sharded", "B");
+
+        ASSERT(0     != sColA);
+        ASSERT(0     != sColB);
+        ASSERT(sColA != sColB);
+        ASSERT(ID_A  == sColA->metricId());
+        ASSERT(ID_B  == sColB->metricId());
+        ASSERT(sColA == mX.getDefaultShardedIntegerCollector("Sharded", "A"));
+        ASSERT(sColA == mX.getDefaultShardedIntegerCollector(ID_A));
+        ASSERT(sColB == mX.getDefaultShardedIntegerCollector(ID_B));
+        ASSERT(colA  == mX.getDefaultCollector(ID_A));
+        ASSERT(iColA == mX.getDefaultIntegerCollector(ID_A));
+
+        bsl::shared_ptr<SICol> addedA1 =
+                            mX.addShardedIntegerCollector("Sharded", "A");
+        bsl::shared_ptr<SICol> addedA2 = mX.addShardedIntegerCollector(ID_A);
+        ASSERT(addedA1.get() != addedA2.get());
+        ASSERT(addedA1.get() != sColA);
+        ASSERT(ID_A          == addedA1->metricId());
+        ASSERT(ID_A          == addedA2->metricId());
+
+        colA->update(1.0);
+        iColA->update(2);
+        sColA->update(3);
+        sColA->update(-4);
+        addedA1->update(10);
+        addedA2->accumulateCountTotalMinMax(2, 20, 5, 15);
+        sColB->update(7);
+
+        for (int i = 0; i < 2; ++i) {
+            bsl::vector<Rec> records(Z);
+            if (0 == i) {
+                mX.collect(&records, CATEGORY);
+            }
+            else {
+                mX.collectAndReset(&records, CATEGORY);
+            }
+            ASSERTV(i, records.size(), 2 == records.size());
+
+            for (bsl::size_t j = 0; j < records.size(); ++j) {
+                const Rec& R = records[j];
+                if (ID_A == R.metricId()) {
+                    ASSERTV(i, R.count(), 7     == R.count());
+                    ASSERTV(i, R.total(), 32.0  == R.total());
+                    ASSERTV(i, R.min(),   -4.0  == R.min());
+                    ASSERTV(i, R.max(),   15.0  == R.max());
+                }
+                else {
+                    ASSERTV(i, ID_B == R.metricId());
+                    ASSERTV(i, R.count(), 1   == R.count());
+                    ASSERTV(i, R.total(), 7.0 == R.total());
+                    ASSERTV(i, R.min(),   7.0 == R.min());
+                    ASSERTV(i, R.max(),   7.0 == R.max());
+                }
+            }
+        }
+
+        bsl::vector<Rec> records(Z);
+        mX.collect(&records, CATEGORY);
+        ASSERT(2 == records.size());
+        for (bsl::size_t j = 0; j < records.size(); ++j) {
+            ASSERTV(j, 0                  == records[j].count());
+            ASSERTV(j, Rec::k_DEFAULT_MIN == records[j].min());
+            ASSERTV(j, Rec::k_DEFAULT_MAX == records[j].max());
+        }
+
+        ASSERT(0 == defaultAllocator.numBytesInUse());
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // CONCURRENCY TEST
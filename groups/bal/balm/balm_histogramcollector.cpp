@@ -0,0 +1,229 @@
+// balm_histogramcollector.cpp                                        -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_histogramcollector_cpp,"$Id$ $CSID$")
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+
+namespace BloombergLP {
+
+                         // ------------------------
+                         // class HistogramCollector
+                         // ------------------------
+
+// PUBLIC CONSTANTS
+const bsls::Types::Int64 balm::HistogramCollector::k_DEFAULT_MIN = LLONG_MAX;
+const bsls::Types::Int64 balm::HistogramCollector::k_DEFAULT_MAX = LLONG_MIN;
+
+namespace balm {
+
+// PRIVATE ACCESSORS
+void HistogramCollector::loadRecords(
+                               MetricRecord             *record,
+                               QuantileRecord           *quantiles,
+                               const bsls::Types::Int64 *bucketCounts,
+                               bsls::Types::Int64        total,
+                               bsls::Types::Int64        min,
+                               bsls::Types::Int64        max) const
+{
+    bsls::Types::Int64 count = 0;
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        count += bucketCounts[i];
+    }
+
+    record->metricId() = d_metricId;
+    record->count()    = static_cast<int>(count);
+    record->total()    = static_cast<double>(total);
+    record->min()      = (k_DEFAULT_MIN == min)
+                       ? MetricRecord::k_DEFAULT_MIN
+                       : static_cast<double>(min);
+    record->max()      = (k_DEFAULT_MAX == max)
+                       ? MetricRecord::k_DEFAULT_MAX
+                       : static_cast<double>(max);
+
+    if (!quantiles) {
+        return;                                                       // RETURN
+    }
+
+    quantiles->metricId() = d_metricId;
+    quantiles->reset();
+    quantiles->count() = static_cast<int>(count);
+    if (0 == count) {
+        return;                                                       // RETURN
+    }
+
+    // Find, in a single pass over the buckets, the bucket holding the value
+    // of each quantile (in increasing order).  The rank of a quantile 'q' is
+    // 'q * count' rounded to the nearest integer (but at least 1), as for
+    // HdrHistogram.
+
+    bsls::Types::Int64 cumulative = 0;
+    int                bucket     = -1;
+    for (int q = 0; q < QuantileRecord::k_NUM_QUANTILES; ++q) {
+        bsls::Types::Int64 rank = static_cast<bsls::Types::Int64>(
+                  QuantileRecord::quantile(q) * static_cast<double>(count)
+                                                                       + 0.5);
+        rank = bsl::max(rank, static_cast<bsls::Types::Int64>(1));
+
+        while (cumulative < rank && bucket + 1 < k_NUM_BUCKETS) {
+            cumulative += bucketCounts[++bucket];
+        }
+
+        // Report the highest value in the bucket, limited to the range of
+        // recorded values.
+
+        bsls::Types::Int64 value = bucketUpperBound(bsl::max(bucket, 0));
+        if (k_DEFAULT_MAX != max) {
+            value = bsl::min(value, max);
+        }
+        if (k_DEFAULT_MIN != min) {
+            value = bsl::max(value, min);
+        }
+        quantiles->value(q) = static_cast<double>(value);
+    }
+}
+
+// CLASS METHODS
+bsls::Types::Int64 HistogramCollector::bucketLowerBound(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_BUCKETS);
+
+    if (index < (1 << k_SUB_BUCKET_BITS)) {
+        return index;                                                 // RETURN
+    }
+    const int shift = index / k_NUM_SUB_BUCKETS - 1;
+    const int sub   = index - shift * k_NUM_SUB_BUCKETS;
+
+    return static_cast<bsls::Types::Int64>(sub) << shift;
+}
+
+bsls::Types::Int64 HistogramCollector::bucketUpperBound(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_BUCKETS);
+
+    if (index < (1 << k_SUB_BUCKET_BITS)) {
+        return index;                                                 // RETURN
+    }
+    const int shift = index / k_NUM_SUB_BUCKETS - 1;
+    const int sub   = index - shift * k_NUM_SUB_BUCKETS;
+
+    // Compute the bound using unsigned arithmetic, as the bound of the final
+    // bucket is the maximum 'Int64' value.
+
+    const bsls::Types::Uint64 bound =
+                     (static_cast<bsls::Types::Uint64>(sub + 1) << shift) - 1;
+    return static_cast<bsls::Types::Int64>(bound);
+}
+
+// CREATORS
+HistogramCollector::HistogramCollector(const MetricId& metricId)
+: d_metricId(metricId)
+, d_total(0)
+, d_min(k_DEFAULT_MIN)
+, d_max(k_DEFAULT_MAX)
+{
+}
+
+// MANIPULATORS
+void HistogramCollector::accumulate(const HistogramCollector& other)
+{
+    BSLS_ASSERT(&other != this);
+
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        const bsls::Types::Int64 count = other.d_buckets[i].loadRelaxed();
+        if (count) {
+            d_buckets[i].addRelaxed(count);
+        }
+    }
+    d_total.addRelaxed(other.d_total.load());
+    updateMin(&d_min, other.d_min.load());
+    updateMax(&d_max, other.d_max.load());
+}
+
+void HistogramCollector::accumulateAndReset(HistogramCollector *other)
+{
+    BSLS_ASSERT(other);
+    BSLS_ASSERT(other != this);
+
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        if (other->d_buckets[i].loadRelaxed()) {
+            d_buckets[i].addRelaxed(other->d_buckets[i].swap(0));
+        }
+    }
+    d_total.addRelaxed(other->d_total.swap(0));
+    updateMin(&d_min, other->d_min.swap(k_DEFAULT_MIN));
+    updateMax(&d_max, other->d_max.swap(k_DEFAULT_MAX));
+}
+
+void HistogramCollector::loadAndReset(MetricRecord   *record,
+                                      QuantileRecord *quantiles)
+{
+    BSLS_ASSERT(record);
+
+    bsls::Types::Int64 bucketCounts[k_NUM_BUCKETS];
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        // Avoid writing to buckets that have no recorded values, so as not to
+        // contend needlessly with concurrent updates.
+
+        bucketCounts[i] = d_buckets[i].loadRelaxed()
+                        ? d_buckets[i].swap(0)
+                        : 0;
+    }
+    const bsls::Types::Int64 total = d_total.swap(0);
+    const bsls::Types::Int64 min   = d_min.swap(k_DEFAULT_MIN);
+    const bsls::Types::Int64 max   = d_max.swap(k_DEFAULT_MAX);
+
+    loadRecords(record, quantiles, bucketCounts, total, min, max);
+}
+
+void HistogramCollector::reset()
+{
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        d_buckets[i].storeRelaxed(0);
+    }
+    d_total.storeRelaxed(0);
+    d_min.storeRelaxed(k_DEFAULT_MIN);
+    d_max.storeRelaxed(k_DEFAULT_MAX);
+}
+
+// ACCESSORS
+void HistogramCollector::load(MetricRecord   *record,
+                              QuantileRecord *quantiles) const
+{
+    BSLS_ASSERT(record);
+
+    bsls::Types::Int64 bucketCounts[k_NUM_BUCKETS];
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        bucketCounts[i] = d_buckets[i].loadRelaxed();
+    }
+
+    loadRecords(record,
+                quantiles,
+                bucketCounts,
+                d_total.load(),
+                d_min.load(),
+                d_max.load());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
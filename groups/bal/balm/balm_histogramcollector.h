@@ -0,0 +1,443 @@
+// balm_histogramcollector.h                                          -*-C++-*-
+#ifndef INCLUDED_BALM_HISTOGRAMCOLLECTOR
+#define INCLUDED_BALM_HISTOGRAMCOLLECTOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-free histogram for collecting metric quantiles.
+//
+//@CLASSES:
+//   balm::HistogramCollector: lock-free histogram of integral metric values
+//
+//@SEE_ALSO: balm_quantilerecord, balm_histogramscopedguard,
+//           balm_collectorrepository
+//
+//@DESCRIPTION: This component provides a class, 'balm::HistogramCollector',
+// for collecting the distribution of the (non-negative) integral values of a
+// metric, such as request latencies, so that quantiles of those values (e.g.,
+// the 99th percentile) can be reported.  In addition to the count, total,
+// minimum, and maximum of the recorded values, loaded into a
+// 'balm::MetricRecord' exactly as by the other collectors in this package, a
+// 'balm::HistogramCollector' loads a 'balm::QuantileRecord' reporting the
+// values at the quantiles described in 'balm_quantilerecord'.
+//
+///Histogram Buckets
+///-----------------
+// A 'balm::HistogramCollector' counts recorded values in a fixed array of
+// buckets arranged on a *log-linear* scale, in the style of HdrHistogram:
+// values in the range '[0 .. 63]' each have their own bucket, and each range
+// of values '[2^n .. 2^(n+1) - 1]' (for 'n >= 6') is divided into 32 buckets
+// of equal width.  Every non-negative 64-bit value is therefore counted, in
+// one of 'k_NUM_BUCKETS' (1888) buckets, using a fixed amount of memory
+// (about 15K bytes per collector), and the width of the bucket holding a
+// value is never more than 1/32 of that value.  A quantile is reported as the
+// highest value in the bucket containing it (limited to the range of values
+// actually recorded), so a reported quantile exceeds the exact quantile of
+// the recorded values by at most about 3%.  The class methods 'bucketIndex',
+// 'bucketLowerBound', and 'bucketUpperBound' describe the mapping from values
+// to buckets.
+//
+// Recording a value increments the count of its bucket and adds the value to
+// the total using relaxed atomic operations, and updates the minimum and
+// maximum using atomic compare-and-swap operations that are performed only
+// when the value is a new minimum or maximum; an 'update' never blocks.
+//
+///Thread Safety
+///-------------
+// 'balm::HistogramCollector' is fully *thread-safe*, meaning that all
+// non-creator operations on a given instance can be safely invoked
+// simultaneously from multiple threads.  As with
+// 'balm::ShardedIntegerCollector', however, the operations that read or write
+// the state of the collector as a whole ('load', 'loadAndReset', 'reset',
+// 'accumulate', and 'accumulateAndReset') are not atomic with respect to a
+// concurrent 'update': a value recorded concurrently with 'loadAndReset' is
+// reported in either the current or the next collection, and, rarely, its
+// contributions to the bucket counts, total, minimum, and maximum may be
+// reported in different collections.  No value recorded by 'update' is ever
+// lost or reported twice by 'loadAndReset'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reporting the Quantiles of Request Latencies
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example we record the latency of a series of requests, and report
+// the quantiles of those latencies.  We start by creating a 'balm::MetricId'
+// object by hand, but in practice, an id should be obtained from a
+// 'balm::MetricRegistry' object (such as the one owned by a
+// 'balm::MetricsManager'):
+//..
+//  balm::Category           myCategory("MyCategory");
+//  balm::MetricDescription  description(&myCategory, "RequestLatency");
+//  balm::MetricId           latencyId(&description);
+//..
+// Then, we create a 'balm::HistogramCollector' object for 'latencyId', and
+// record the latencies (in microseconds) of 1000 requests: 989 requests take
+// 100us, 10 requests take 1000us, and 1 request takes 50000us.  In practice
+// the calls to 'update' would be made by many threads concurrently:
+//..
+//  balm::HistogramCollector collector(latencyId);
+//
+//  for (int i = 0; i < 989; ++i) {
+//      collector.update(100);
+//  }
+//  for (int i = 0; i < 10; ++i) {
+//      collector.update(1000);
+//  }
+//  collector.update(50000);
+//..
+// Next, we collect the recorded values.  The metric record summarizes the
+// latencies as for any other collector:
+//..
+//  balm::MetricRecord   record;
+//  balm::QuantileRecord quantiles;
+//  collector.loadAndReset(&record, &quantiles);
+//
+//  assert(latencyId == record.metricId());
+//  assert(1000      == record.count());
+//  assert(158900    == record.total());
+//  assert(100       == record.min());
+//  assert(50000     == record.max());
+//..
+// Finally, we verify the reported quantiles.  Note that the average latency
+// (about 160us) hides the slow requests, which are evident in the 99th and
+// 99.9th percentiles.  Also note that 100 and 1000 are not the highest values
+// in their respective buckets, so the reported quantiles slightly exceed the
+// exact values:
+//..
+//  assert(latencyId == quantiles.metricId());
+//  assert(1000      == quantiles.count());
+//  assert(101       == quantiles.value(0));    // median
+//  assert(101       == quantiles.value(1));    // 90th percentile
+//  assert(1007      == quantiles.value(2));    // 99th percentile
+//  assert(1007      == quantiles.value(3));    // 99.9th percentile
+//..
+
+#ifndef INCLUDED_BALSCM_VERSION
+#include <balscm_version.h>
+#endif
+
+#ifndef INCLUDED_BALM_METRICID
+#include <balm_metricid.h>
+#endif
+
+#ifndef INCLUDED_BALM_METRICRECORD
+#include <balm_metricrecord.h>
+#endif
+
+#ifndef INCLUDED_BALM_QUANTILERECORD
+#include <balm_quantilerecord.h>
+#endif
+
+#ifndef INCLUDED_BDLB_BITUTIL
+#include <bdlb_bitutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDINT
+#include <bsl_cstdint.h>
+#endif
+
+namespace BloombergLP {
+namespace balm {
+
+                         // ========================
+                         // class HistogramCollector
+                         // ========================
+
+class HistogramCollector {
+    // This class provides a mechanism for collecting the distribution of the
+    // non-negative integral values of a metric over a period of time, that
+    // can be updated from many threads concurrently without blocking.  The
+    // collector contains a 'MetricId' object identifying the metric being
+    // collected, the number of recorded values falling in each of a fixed
+    // set of log-linear buckets, and the total, minimum, and maximum of the
+    // recorded values.  The default count of each bucket is 0, the default
+    // value for the total is 0, the default value for the minimum is
+    // 'k_DEFAULT_MIN', and the default value for the maximum is
+    // 'k_DEFAULT_MAX'.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_SUB_BUCKET_BITS = 6,    // 'log2' of the number of values counted
+                                  // individually
+
+        k_NUM_SUB_BUCKETS = 1 << (k_SUB_BUCKET_BITS - 1),
+                                  // number of buckets for each power-of-two
+                                  // range of values (other than the first)
+
+        k_NUM_BUCKETS     = (64 - k_SUB_BUCKET_BITS + 1) * k_NUM_SUB_BUCKETS
+                                  // total number of buckets
+    };
+
+    static const bsls::Types::Int64 k_DEFAULT_MIN;  // default minimum value
+    static const bsls::Types::Int64 k_DEFAULT_MAX;  // default maximum value
+
+  private:
+    // DATA
+    MetricId          d_metricId;                // metric identifier
+
+    bsls::AtomicInt64 d_total;                   // total of values
+
+    bsls::AtomicInt64 d_min;                     // minimum value
+
+    bsls::AtomicInt64 d_max;                     // maximum value
+
+    bsls::AtomicInt64 d_buckets[k_NUM_BUCKETS];  // number of values in each
+                                                 // bucket
+
+    // NOT IMPLEMENTED
+    HistogramCollector(const HistogramCollector&);
+    HistogramCollector& operator=(const HistogramCollector&);
+
+    // PRIVATE CLASS METHODS
+    static void updateMin(bsls::AtomicInt64 *min, bsls::Types::Int64 value);
+        // Set the specified 'min' to the specified 'value' if 'value' is less
+        // than 'min'.
+
+    static void updateMax(bsls::AtomicInt64 *max, bsls::Types::Int64 value);
+        // Set the specified 'max' to the specified 'value' if 'value' is
+        // greater than 'max'.
+
+    // PRIVATE ACCESSORS
+    void loadRecords(MetricRecord             *record,
+                     QuantileRecord           *quantiles,
+                     const bsls::Types::Int64 *bucketCounts,
+                     bsls::Types::Int64        total,
+                     bsls::Types::Int64        min,
+                     bsls::Types::Int64        max) const;
+        // Load into the specified 'record' and, unless it is 0, the specified
+        // 'quantiles' the id of the metric being collected and the aggregate
+        // values described by the specified 'bucketCounts' array of
+        // 'k_NUM_BUCKETS' counts, and the specified 'total', 'min', and 'max'.
+
+  public:
+    // CLASS METHODS
+    static int bucketIndex(bsls::Types::Int64 value);
+        // Return the index of the bucket counting the specified 'value'.  The
+        // behavior is undefined unless '0 <= value'.
+
+    static bsls::Types::Int64 bucketLowerBound(int index);
+        // Return the lowest value counted by the bucket at the specified
+        // 'index'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    static bsls::Types::Int64 bucketUpperBound(int index);
+        // Return the highest value counted by the bucket at the specified
+        // 'index'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    // CREATORS
+    explicit HistogramCollector(const MetricId& metricId);
+        // Create a histogram collector for a metric having the specified
+        // 'metricId', having no recorded values, a total of 0, a minimum of
+        // 'k_DEFAULT_MIN', and a maximum of 'k_DEFAULT_MAX'.
+
+    ~HistogramCollector();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void accumulate(const HistogramCollector& other);
+        // Add the values recorded by the specified 'other' collector to the
+        // values recorded by this collector.  The behavior is undefined if
+        // 'other' is this collector.
+
+    void accumulateAndReset(HistogramCollector *other);
+        // Add the values recorded by the specified 'other' collector to the
+        // values recorded by this collector, then reset 'other' to its
+        // default state.  Each value recorded in 'other' by a concurrent
+        // 'update' is transferred either by this operation or by a subsequent
+        // one (see {Thread Safety}).  The behavior is undefined if 'other' is
+        // this collector.
+
+    void loadAndReset(MetricRecord *record);
+    void loadAndReset(MetricRecord *record, QuantileRecord *quantiles);
+        // Load into the specified 'record' the id of the metric being
+        // collected as well as the current count, total, minimum, and maximum
+        // aggregated values for that metric and, optionally, load into the
+        // specified 'quantiles' the id of the metric and the values at each
+        // of the quantiles described by 'QuantileRecord'; then reset this
+        // collector to its default state.  A minimum value of
+        // 'k_DEFAULT_MIN' will populate a minimum value of
+        // 'MetricRecord::k_DEFAULT_MIN' and a maximum value of
+        // 'k_DEFAULT_MAX' will populate a maximum value of
+        // 'MetricRecord::k_DEFAULT_MAX'.  Note that each value recorded by a
+        // concurrent 'update' is loaded either by this operation or by a
+        // subsequent one (see {Thread Safety}).
+
+    void reset();
+        // Reset this collector to its default state, having no recorded
+        // values, a total of 0, a minimum of 'k_DEFAULT_MIN', and a maximum
+        // of 'k_DEFAULT_MAX'.  Note that values recorded by concurrent
+        // 'update' operations may, or may not, be discarded.
+
+    void update(bsls::Types::Int64 value);
+        // Record the specified 'value': increment the count of the bucket
+        // counting 'value', add 'value' to the total, if 'value' is less than
+        // the minimum value, set 'value' to be the minimum value, and if
+        // 'value' is greater than the maximum value, set 'value' to be the
+        // maximum value.  This operation does not block.  The behavior is
+        // undefined unless '0 <= value'.
+
+    // ACCESSORS
+    const MetricId& metricId() const;
+        // Return a reference to the non-modifiable 'MetricId' object
+        // identifying the metric for which this object collects values.
+
+    bsls::Types::Int64 bucketCount(int index) const;
+        // Return the number of recorded values counted by the bucket at the
+        // specified 'index'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    void load(MetricRecord *record) const;
+    void load(MetricRecord *record, QuantileRecord *quantiles) const;
+        // Load into the specified 'record' the id of the metric being
+        // collected as well as the current count, total, minimum, and maximum
+        // aggregated values for that metric and, optionally, load into the
+        // specified 'quantiles' the id of the metric and the values at each
+        // of the quantiles described by 'QuantileRecord'.  A minimum value of
+        // 'k_DEFAULT_MIN' will populate a minimum value of
+        // 'MetricRecord::k_DEFAULT_MIN' and a maximum value of
+        // 'k_DEFAULT_MAX' will populate a maximum value of
+        // 'MetricRecord::k_DEFAULT_MAX'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                         // ------------------------
+                         // class HistogramCollector
+                         // ------------------------
+
+// PRIVATE CLASS METHODS
+inline
+void HistogramCollector::updateMin(bsls::AtomicInt64  *min,
+                                   bsls::Types::Int64  value)
+{
+    bsls::Types::Int64 current = min->loadRelaxed();
+    while (value < current) {
+        const bsls::Types::Int64 previous = min->testAndSwap(current, value);
+        if (previous == current) {
+            break;
+        }
+        current = previous;
+    }
+}
+
+inline
+void HistogramCollector::updateMax(bsls::AtomicInt64  *max,
+                                   bsls::Types::Int64  value)
+{
+    bsls::Types::Int64 current = max->loadRelaxed();
+    while (value > current) {
+        const bsls::Types::Int64 previous = max->testAndSwap(current, value);
+        if (previous == current) {
+            break;
+        }
+        current = previous;
+    }
+}
+
+// CLASS METHODS
+inline
+int HistogramCollector::bucketIndex(bsls::Types::Int64 value)
+{
+    BSLS_ASSERT_SAFE(0 <= value);
+
+    if (value < (1 << k_SUB_BUCKET_BITS)) {
+        return static_cast<int>(value);                               // RETURN
+    }
+
+    // 'shift' is chosen so that 'value >> shift' is in the range
+    // '[k_NUM_SUB_BUCKETS .. 2 * k_NUM_SUB_BUCKETS - 1]'.
+
+    const int msb   = 63 - bdlb::BitUtil::numLeadingUnsetBits(
+                                         static_cast<bsl::uint64_t>(value));
+    const int shift = msb - k_SUB_BUCKET_BITS + 1;
+
+    return shift * k_NUM_SUB_BUCKETS + static_cast<int>(value >> shift);
+}
+
+// CREATORS
+inline
+HistogramCollector::~HistogramCollector()
+{
+}
+
+// MANIPULATORS
+inline
+void HistogramCollector::update(bsls::Types::Int64 value)
+{
+    BSLS_ASSERT_SAFE(0 <= value);
+
+    d_buckets[bucketIndex(value)].addRelaxed(1);
+    d_total.addRelaxed(value);
+    updateMin(&d_min, value);
+    updateMax(&d_max, value);
+}
+
+inline
+void HistogramCollector::loadAndReset(MetricRecord *record)
+{
+    loadAndReset(record, 0);
+}
+
+// ACCESSORS
+inline
+const MetricId& HistogramCollector::metricId() const
+{
+    return d_metricId;
+}
+
+inline
+bsls::Types::Int64 HistogramCollector::bucketCount(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < k_NUM_BUCKETS);
+
+    return d_buckets[index].loadRelaxed();
+}
+
+inline
+void HistogramCollector::load(MetricRecord *record) const
+{
+    load(record, 0);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1061 @@
+// balm_histogramcollector.t.cpp                                      -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <balm_integercollector.h>
+#include <balm_metricdescription.h>
+#include <balm_category.h>
+
+#include <bslim_testutil.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bdlf_bind.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cmath.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The 'balm::HistogramCollector' is a mechanism for collecting the
+// distribution of metric values without taking a lock.  Ensure that the
+// buckets partition the range of non-negative 64-bit values with the
+// documented precision, that the count, total, minimum, and maximum of the
+// recorded values are loaded correctly, that the reported quantiles are
+// within the documented error of the exact quantiles, and that no value is
+// lost or reported twice when values are collected concurrently with updates.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2]  static int bucketIndex(bsls::Types::Int64 value);
+// [ 2]  static bsls::Types::Int64 bucketLowerBound(int index);
+// [ 2]  static bsls::Types::Int64 bucketUpperBound(int index);
+//
+// CREATORS
+// [ 3]  balm::HistogramCollector(const balm::MetricId& metricId);
+// [ 3]  ~balm::HistogramCollector();
+//
+// MANIPULATORS
+// [ 6]  void accumulate(const balm::HistogramCollector& other);
+// [ 6]  void accumulateAndReset(balm::HistogramCollector *other);
+// [ 5]  void loadAndReset(balm::MetricRecord *record);
+// [ 5]  void loadAndReset(balm::MetricRecord *, balm::QuantileRecord *);
+// [ 5]  void reset();
+// [ 3]  void update(bsls::Types::Int64 value);
+//
+// ACCESSORS
+// [ 3]  const balm::MetricId& metricId() const;
+// [ 3]  bsls::Types::Int64 bucketCount(int index) const;
+// [ 3]  void load(balm::MetricRecord *record) const;
+// [ 4]  void load(balm::MetricRecord *, balm::QuantileRecord *) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] CONCURRENCY TEST
+// [ 8] USAGE EXAMPLE
+// [-1] UPDATE BENCHMARK
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        bsl::cout << "Error " << __FILE__ << "(" << i << "): " << s
+                  << "    (failed)" << bsl::endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::HistogramCollector Obj;
+typedef balm::MetricRecord       Rec;
+typedef balm::QuantileRecord     QRec;
+typedef balm::MetricDescription  Desc;
+typedef balm::MetricId           Id;
+typedef bsls::Types::Int64       Int64;
+
+const int NUM_QUANTILES = QRec::k_NUM_QUANTILES;
+
+// ============================================================================
+//                      GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+Int64 exactQuantile(const bsl::vector<Int64>& sortedValues, double quantile)
+    // Return the value at the specified 'quantile' of the specified
+    // 'sortedValues', using the same definition of rank as
+    // 'balm::HistogramCollector'.  The behavior is undefined unless
+    // 'sortedValues' is sorted and non-empty.
+{
+    const Int64 count = static_cast<Int64>(sortedValues.size());
+    Int64       rank  = static_cast<Int64>(quantile * count + 0.5);
+    rank = bsl::max(rank, static_cast<Int64>(1));
+    return sortedValues[static_cast<bsl::size_t>(rank - 1)];
+}
+
+// ============================================================================
+//                      GLOBAL STUB CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace TEST_CASE_CONCURRENCY {
+
+struct Totals {
+    // This 'struct' accumulates the values loaded by the collecting thread.
+
+    Int64  d_count;
+    Int64  d_total;
+    double d_min;
+    double d_max;
+    int    d_numCollections;
+};
+
+void updateJob(Obj            *collector,
+               bslmt::Barrier *barrier,
+               int             threadIndex,
+               int             numUpdates)
+    // Wait on the specified 'barrier', then record the specified 'numUpdates'
+    // values, derived from the specified 'threadIndex', in the specified
+    // 'collector'.
+{
+    barrier->wait();
+    for (int i = 0; i < numUpdates; ++i) {
+        collector->update(threadIndex * 1000 + i % 1000);
+    }
+}
+
+void collectJob(Obj             *collector,
+                bslmt::Barrier  *barrier,
+                bsls::AtomicInt *done,
+                Totals          *totals)
+    // Wait on the specified 'barrier', then repeatedly call 'loadAndReset' on
+    // the specified 'collector', accumulating the loaded values into the
+    // specified 'totals', until the specified 'done' flag is set.
+{
+    barrier->wait();
+    do {
+        Rec  record;
+        QRec quantiles;
+        collector->loadAndReset(&record, &quantiles);
+        ASSERTV(record.count(), quantiles.count(),
+                record.count() == quantiles.count());
+        totals->d_count += record.count();
+        totals->d_total += static_cast<Int64>(record.total());
+        totals->d_min    = bsl::min(totals->d_min, record.min());
+        totals->d_max    = bsl::max(totals->d_max, record.max());
+        ++totals->d_numCollections;
+    } while (!done->loadAcquire());
+}
+
+}  // close namespace TEST_CASE_CONCURRENCY
+
+namespace TEST_CASE_UPDATE_BENCHMARK {
+
+template <class COLLECTOR>
+void benchmarkJob(COLLECTOR      *collector,
+                  bslmt::Barrier *barrier,
+                  int             numUpdates)
+    // Wait on the specified 'barrier', then call 'update' on the specified
+    // 'collector' the specified 'numUpdates' times.
+{
+    barrier->wait();
+    for (int i = 0; i < numUpdates; ++i) {
+        collector->update(i & 65535);
+    }
+    barrier->wait();
+}
+
+template <class COLLECTOR>
+double benchmark(int numThreads, int numUpdates)
+    // Return the number of millions of updates per second made to a single
+    // collector of the (template parameter) type 'COLLECTOR' by the specified
+    // 'numThreads' threads, each making the specified 'numUpdates' updates.
+{
+    COLLECTOR          collector(Id(0));
+    bslmt::Barrier     barrier(numThreads + 1);
+    bslmt::ThreadGroup threads;
+
+    for (int i = 0; i < numThreads; ++i) {
+        threads.addThread(bdlf::BindUtil::bind(&benchmarkJob<COLLECTOR>,
+                                               &collector,
+                                               &barrier,
+                                               numUpdates));
+    }
+
+    bsls::Stopwatch timer;
+    barrier.wait();
+    timer.start();
+    barrier.wait();
+    timer.stop();
+    threads.joinAll();
+
+    Rec record;
+    collector.load(&record);
+    ASSERT(numThreads * numUpdates == record.count());
+
+    return static_cast<double>(numThreads) * numUpdates
+                                           / timer.elapsedTime() / 1000000.0;
+}
+
+}  // close namespace TEST_CASE_UPDATE_BENCHMARK
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;
+
+    balm::Category cat_A("A", true);
+    Desc desc_A(&cat_A, "A"); const Desc *DESC_A = &desc_A;
+    Desc desc_B(&cat_A, "B"); const Desc *DESC_B = &desc_B;
+
+    Id metric_A(DESC_A); const Id& METRIC_A = metric_A;
+    Id metric_B(DESC_B); const Id& METRIC_B = metric_B;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file must
+        //:   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Usage Example"
+                          << "\n=====================" << endl;
+
+///Example 1: Reporting the Quantiles of Request Latencies
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example we record the latency of a series of requests, and report
+// the quantiles of those latencies.  We start by creating a 'balm::MetricId'
+// object by hand, but in practice, an id should be obtained from a
+// 'balm::MetricRegistry' object (such as the one owned by a
+// 'balm::MetricsManager'):
+//..
+    balm::Category           myCategory("MyCategory");
+    balm::MetricDescription  description(&myCategory, "RequestLatency");
+    balm::MetricId           latencyId(&description);
+//..
+// Then, we create a 'balm::HistogramCollector' object for 'latencyId', and
+// record the latencies (in microseconds) of 1000 requests: 989 requests take
+// 100us, 10 requests take 1000us, and 1 request takes 50000us.  In practice
+// the calls to 'update' would be made by many threads concurrently:
+//..
+    balm::HistogramCollector collector(latencyId);
+
+    for (int i = 0; i < 989; ++i) {
+        collector.update(100);
+    }
+    for (int i = 0; i < 10; ++i) {
+        collector.update(1000);
+    }
+    collector.update(50000);
+//..
+// Next, we collect the recorded values.  The metric record summarizes the
+// latencies as for any other collector:
+//..
+    balm::MetricRecord   record;
+    balm::QuantileRecord quantiles;
+    collector.loadAndReset(&record, &quantiles);
+
+    ASSERT(latencyId == record.metricId());
+    ASSERT(1000      == record.count());
+    ASSERT(158900    == record.total());
+    ASSERT(100       == record.min());
+    ASSERT(50000     == record.max());
+//..
+// Finally, we verify the reported quantiles.  Note that the average latency
+// (about 160us) hides the slow requests, which are evident in the 99th and
+// 99.9th percentiles.  Also note that 100 and 1000 are not the highest values
+// in their respective buckets, so the reported quantiles slightly exceed the
+// exact values:
+//..
+    ASSERT(latencyId == quantiles.metricId());
+    ASSERT(1000      == quantiles.count());
+    ASSERT(101       == quantiles.value(0));    // median
+    ASSERT(101       == quantiles.value(1));    // 90th percentile
+    ASSERT(1007      == quantiles.value(2));    // 99th percentile
+    ASSERT(1007      == quantiles.value(3));    // 99.9th percentile
+//..
+
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Values recorded concurrently by many threads are all counted.
+        //:
+        //: 2 No value is lost, or reported twice, when 'loadAndReset' is
+        //:   called concurrently with 'update'.
+        //
+        // Plan:
+        //: 1 Start a number of threads that each record a known sequence of
+        //:   values, and a thread that repeatedly calls 'loadAndReset' until
+        //:   the updating threads have completed, accumulating the loaded
+        //:   values.  Then call 'loadAndReset' a final time and verify that
+        //:   the accumulated count, total, minimum, and maximum match those
+        //:   of the recorded values.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TEST CONCURRENCY" << endl
+                                  << "================" << endl;
+
+        using namespace TEST_CASE_CONCURRENCY;
+
+        const int NUM_THREADS = 8;
+        const int NUM_UPDATES = 100000;
+
+        Obj mX(METRIC_A);
+
+        Totals totals = { 0, 0, Rec::k_DEFAULT_MIN, Rec::k_DEFAULT_MAX, 0 };
+
+        bslmt::Barrier     barrier(NUM_THREADS + 1);
+        bsls::AtomicInt    done(0);
+        bslmt::ThreadGroup updaters;
+        bslmt::ThreadGroup collectors;
+
+        collectors.addThread(bdlf::BindUtil::bind(&collectJob,
+                                                  &mX,
+                                                  &barrier,
+                                                  &done,
+                                                  &totals));
+        for (int i = 0; i < NUM_THREADS - 1; ++i) {
+            updaters.addThread(bdlf::BindUtil::bind(&updateJob,
+                                                    &mX,
+                                                    &barrier,
+                                                    i,
+                                                    NUM_UPDATES));
+        }
+        updateJob(&mX, &barrier, NUM_THREADS - 1, NUM_UPDATES);
+        updaters.joinAll();
+        done.storeRelease(1);
+        collectors.joinAll();
+
+        Rec last;
+        mX.loadAndReset(&last);
+        totals.d_count += last.count();
+        totals.d_total += static_cast<Int64>(last.total());
+        totals.d_min    = bsl::min(totals.d_min, last.min());
+        totals.d_max    = bsl::max(totals.d_max, last.max());
+
+        Int64 expTotal = 0;
+        for (int t = 0; t < NUM_THREADS; ++t) {
+            for (int i = 0; i < NUM_UPDATES; ++i) {
+                expTotal += t * 1000 + i % 1000;
+            }
+        }
+
+        if (verbose) {
+            P_(totals.d_numCollections); P(totals.d_count);
+        }
+
+        ASSERTV(totals.d_count,
+                NUM_THREADS * NUM_UPDATES == totals.d_count);
+        ASSERTV(expTotal, totals.d_total, expTotal == totals.d_total);
+        ASSERTV(totals.d_min, 0 == totals.d_min);
+        ASSERTV(totals.d_max,
+                (NUM_THREADS - 1) * 1000 + 999 == totals.d_max);
+
+        Rec empty;
+        mX.load(&empty);
+        ASSERT(0                  == empty.count());
+        ASSERT(Rec::k_DEFAULT_MIN == empty.min());
+        ASSERT(Rec::k_DEFAULT_MAX == empty.max());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING MANIPULATORS: accumulate, accumulateAndReset
+        //
+        // Concerns:
+        //: 1 'accumulate' adds the bucket counts, total, minimum, and maximum
+        //:   of another collector to this collector, and does not modify the
+        //:   other collector.
+        //:
+        //: 2 'accumulateAndReset' adds the values of another collector to this
+        //:   collector, and resets the other collector.
+        //:
+        //: 3 The metric id of this collector is not modified.
+        //
+        // Plan:
+        //: 1 Record disjoint sets of values in two collectors, accumulate one
+        //:   into the other, and verify the result is the same as recording
+        //:   the union of the values in a single collector.  (C-1..3)
+        //
+        // Testing:
+        //   void accumulate(const balm::HistogramCollector& other);
+        //   void accumulateAndReset(balm::HistogramCollector *other);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING accumulate" << endl
+                                  << "==================" << endl;
+
+        for (int reset = 0; reset < 2; ++reset) {
+            Obj mX(METRIC_A); const Obj& X = mX;
+            Obj mY(METRIC_B); const Obj& Y = mY;
+            Obj mZ(METRIC_A); const Obj& Z = mZ;
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.update(i);
+                mZ.update(i);
+            }
+            for (int i = 0; i < 100; ++i) {
+                mY.update(100000 + i * 7);
+                mZ.update(100000 + i * 7);
+            }
+
+            if (reset) {
+                mX.accumulateAndReset(&mY);
+            }
+            else {
+                mX.accumulate(Y);
+            }
+
+            ASSERTV(reset, METRIC_A == X.metricId());
+            ASSERTV(reset, METRIC_B == Y.metricId());
+
+            Rec  rx, rz, ry;
+            QRec qx, qz, qy;
+            X.load(&rx, &qx);
+            Z.load(&rz, &qz);
+            Y.load(&ry, &qy);
+
+            ASSERTV(reset, rx, rz, rx == rz);
+            ASSERTV(reset, qx, qz, qx == qz);
+            for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+                ASSERTV(reset, i, Z.bucketCount(i) == X.bucketCount(i));
+            }
+
+            if (reset) {
+                ASSERTV(ry.count(), 0                  == ry.count());
+                ASSERTV(ry.total(), 0                  == ry.total());
+                ASSERTV(ry.min(),   Rec::k_DEFAULT_MIN == ry.min());
+                ASSERTV(ry.max(),   Rec::k_DEFAULT_MAX == ry.max());
+                ASSERTV(qy.count(), 0                  == qy.count());
+            }
+            else {
+                ASSERTV(ry.count(), 100    == ry.count());
+                ASSERTV(ry.min(),   100000 == ry.min());
+                ASSERTV(ry.max(),   100693 == ry.max());
+            }
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(METRIC_A);
+            Obj mY(METRIC_B);
+
+            ASSERT_PASS(mX.accumulate(mY));
+            ASSERT_FAIL(mX.accumulate(mX));
+            ASSERT_PASS(mX.accumulateAndReset(&mY));
+            ASSERT_FAIL(mX.accumulateAndReset(&mX));
+            ASSERT_FAIL(mX.accumulateAndReset(0));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING MANIPULATORS: loadAndReset, reset
+        //
+        // Concerns:
+        //: 1 'loadAndReset' loads the same values as 'load', then resets the
+        //:   collector to its default state.
+        //:
+        //: 2 'reset' resets the collector to its default state.
+        //:
+        //: 3 The metric id is not modified by either operation.
+        //
+        // Plan:
+        //: 1 Record a set of values, call 'loadAndReset', and compare the
+        //:   result with the values loaded by a prior call to 'load'.  Verify
+        //:   the collector is then in its default state.  (C-1, 3)
+        //:
+        //: 2 Record a set of values, call 'reset', and verify the collector is
+        //:   in its default state.  (C-2..3)
+        //
+        // Testing:
+        //   void loadAndReset(balm::MetricRecord *record);
+        //   void loadAndReset(balm::MetricRecord *, balm::QuantileRecord *);
+        //   void reset();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING loadAndReset and reset" << endl
+                                  << "==============================" << endl;
+
+        const Int64 VALUES[] = { 0, 1, 63, 64, 1000, 123456789, LLONG_MAX };
+        const int   NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        for (int withQuantiles = 0; withQuantiles < 2; ++withQuantiles) {
+            Obj mX(METRIC_A); const Obj& X = mX;
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                mX.update(VALUES[i]);
+            }
+
+            Rec  r1, r2;
+            QRec q1, q2;
+            X.load(&r1, &q1);
+            if (withQuantiles) {
+                mX.loadAndReset(&r2, &q2);
+                ASSERTV(q1, q2, q1 == q2);
+            }
+            else {
+                mX.loadAndReset(&r2);
+            }
+            ASSERTV(r1, r2, r1 == r2);
+            ASSERT(NUM_VALUES == r2.count());
+            ASSERT(0          == r2.min());
+            ASSERT(LLONG_MAX  == r2.max());
+
+            ASSERT(METRIC_A == X.metricId());
+            X.load(&r1, &q1);
+            ASSERT(METRIC_A           == r1.metricId());
+            ASSERT(0                  == r1.count());
+            ASSERT(0                  == r1.total());
+            ASSERT(Rec::k_DEFAULT_MIN == r1.min());
+            ASSERT(Rec::k_DEFAULT_MAX == r1.max());
+            ASSERT(QRec(METRIC_A)     == q1);
+            for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+                ASSERTV(i, 0 == X.bucketCount(i));
+            }
+        }
+
+        {
+            Obj mX(METRIC_A); const Obj& X = mX;
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                mX.update(VALUES[i]);
+            }
+            mX.reset();
+
+            Rec  r;
+            QRec q;
+            X.load(&r, &q);
+            ASSERT(METRIC_A           == X.metricId());
+            ASSERT(METRIC_A           == r.metricId());
+            ASSERT(0                  == r.count());
+            ASSERT(0                  == r.total());
+            ASSERT(Rec::k_DEFAULT_MIN == r.min());
+            ASSERT(Rec::k_DEFAULT_MAX == r.max());
+            ASSERT(QRec(METRIC_A)     == q);
+            for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+                ASSERTV(i, 0 == X.bucketCount(i));
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING QUANTILES
+        //
+        // Concerns:
+        //: 1 The count of the loaded quantile record is the number of
+        //:   recorded values, and its metric id is that of the collector.
+        //:
+        //: 2 Each reported quantile is no less than the exact quantile of the
+        //:   recorded values, and exceeds it by no more than 1/32 of its
+        //:   value.
+        //:
+        //: 3 Reported quantiles lie within the range of recorded values.
+        //:
+        //: 4 Quantiles of a single recorded value are that value.
+        //:
+        //: 5 The quantiles of an empty collector are 0.
+        //
+        // Plan:
+        //: 1 For a number of distributions of values (uniform, exponential,
+        //:   and bimodal), record the values, load the quantiles, and compare
+        //:   each with the exact quantile computed from the sorted values.
+        //:   (C-1..3)
+        //:
+        //: 2 Record a single value, and verify each quantile is that value.
+        //:   (C-4)
+        //:
+        //: 3 Load the quantiles of an empty collector.  (C-5)
+        //
+        // Testing:
+        //   void load(balm::MetricRecord *, balm::QuantileRecord *) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING QUANTILES" << endl
+                                  << "=================" << endl;
+
+        enum { k_NUM_DISTRIBUTIONS = 4 };
+
+        for (int d = 0; d < k_NUM_DISTRIBUTIONS; ++d) {
+            bsl::vector<Int64> values;
+
+            switch (d) {
+              case 0: {                                    // small uniform
+                for (int i = 0; i < 50; ++i) {
+                    values.push_back(i);
+                }
+              } break;
+              case 1: {                                    // large uniform
+                for (int i = 1; i <= 100000; ++i) {
+                    values.push_back(i * 13);
+                }
+              } break;
+              case 2: {                                    // exponential
+                for (int i = 0; i < 10000; ++i) {
+                    values.push_back(static_cast<Int64>(
+                                     bsl::exp(static_cast<double>(i) / 400)));
+                }
+              } break;
+              case 3: {                                    // bimodal
+                for (int i = 0; i < 9950; ++i) {
+                    values.push_back(200 + i % 50);
+                }
+                for (int i = 0; i < 50; ++i) {
+                    values.push_back(1000000000LL + i);
+                }
+              } break;
+            }
+
+            Obj mX(METRIC_A); const Obj& X = mX;
+            for (bsl::size_t i = 0; i < values.size(); ++i) {
+                mX.update(values[i]);
+            }
+            bsl::sort(values.begin(), values.end());
+
+            Rec  record;
+            QRec quantiles;
+            X.load(&record, &quantiles);
+
+            ASSERTV(d, METRIC_A == quantiles.metricId());
+            ASSERTV(d, static_cast<int>(values.size()) == quantiles.count());
+            ASSERTV(d, record.count() == quantiles.count());
+
+            for (int q = 0; q < NUM_QUANTILES; ++q) {
+                const double EXACT  = static_cast<double>(
+                                 exactQuantile(values, QRec::quantile(q)));
+                const double ACTUAL = quantiles.value(q);
+
+                if (veryVerbose) {
+                    T_ P_(d) P_(QRec::quantileName(q)) P_(EXACT) P(ACTUAL);
+                }
+
+                ASSERTV(d, q, EXACT, ACTUAL, EXACT <= ACTUAL);
+                ASSERTV(d, q, EXACT, ACTUAL, ACTUAL <= EXACT + EXACT / 32);
+                ASSERTV(d, q, ACTUAL, values.front() <= ACTUAL);
+                ASSERTV(d, q, ACTUAL, values.back()  >= ACTUAL);
+            }
+        }
+
+        if (verbose) cout << "\tTesting a single value." << endl;
+        {
+            const Int64 VALUES[] = { 0, 1, 100, 1000, 123456789, LLONG_MAX };
+            const int   NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                Obj mX(METRIC_A); const Obj& X = mX;
+                mX.update(VALUES[i]);
+
+                Rec  record;
+                QRec quantiles;
+                X.load(&record, &quantiles);
+                ASSERTV(i, 1 == quantiles.count());
+                for (int q = 0; q < NUM_QUANTILES; ++q) {
+                    ASSERTV(i, q, static_cast<double>(VALUES[i]) ==
+                                                          quantiles.value(q));
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTesting an empty collector." << endl;
+        {
+            Obj mX(METRIC_B); const Obj& X = mX;
+
+            Rec  record;
+            QRec quantiles(METRIC_A);
+            quantiles.count()  = 7;
+            quantiles.value(0) = 3;
+            X.load(&record, &quantiles);
+            ASSERT(QRec(METRIC_B) == quantiles);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING CONSTRUCTOR, update, AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A newly constructed collector has the supplied metric id, and no
+        //:   recorded values.
+        //:
+        //: 2 'update' increments the count of the bucket holding the value,
+        //:   and updates the total, minimum, and maximum loaded by 'load'.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Construct a collector and verify its initial state.  (C-1)
+        //:
+        //: 2 For a sequence of values, call 'update', and verify the values
+        //:   loaded by 'load' and reported by 'bucketCount'.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-3)
+        //
+        // Testing:
+        //   balm::HistogramCollector(const balm::MetricId& metricId);
+        //   ~balm::HistogramCollector();
+        //   void update(bsls::Types::Int64 value);
+        //   const balm::MetricId& metricId() const;
+        //   bsls::Types::Int64 bucketCount(int index) const;
+        //   void load(balm::MetricRecord *record) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING update" << endl
+                                  << "==============" << endl;
+
+        const Int64 UPDATES[] = { 0, 12, 1321123, 2131241, 1321, 43145, 1,
+                                  64, 63, 12, 1LL << 40, LLONG_MAX / 4 };
+        const int   NUM_UPDATES = sizeof UPDATES / sizeof *UPDATES;
+
+        for (int i = 0; i < NUM_UPDATES; ++i) {
+            const Desc *METRIC = (const Desc *)(i + 1);
+            Obj mX((Id(METRIC))); const Obj& X = mX;
+
+            ASSERTV(i, Id(METRIC) == X.metricId());
+
+            Rec r1, r2;
+            X.load(&r1);
+            ASSERTV(i, METRIC             == r1.metricId().description());
+            ASSERTV(i, 0                  == r1.count());
+            ASSERTV(i, 0                  == r1.total());
+            ASSERTV(i, Rec::k_DEFAULT_MIN == r1.min());
+            ASSERTV(i, Rec::k_DEFAULT_MAX == r1.max());
+
+            Int64 total = 0;
+            Int64 min   = UPDATES[i];
+            Int64 max   = UPDATES[i];
+            for (int j = 0; j < NUM_UPDATES; ++j) {
+                const int   INDEX  = (i + j) % NUM_UPDATES;
+                const Int64 VALUE  = UPDATES[INDEX];
+                const int   BUCKET = Obj::bucketIndex(VALUE);
+                const Int64 COUNT  = X.bucketCount(BUCKET);
+
+                mX.update(VALUE);
+
+                total += VALUE;
+                min    = bsl::min(min, VALUE);
+                max    = bsl::max(max, VALUE);
+
+                ASSERTV(i, j, COUNT + 1 == X.bucketCount(BUCKET));
+
+                X.load(&r1);
+                ASSERTV(i, j, METRIC == r1.metricId().description());
+                ASSERTV(i, j, j + 1  == r1.count());
+                ASSERTV(i, j, static_cast<double>(total) == r1.total());
+                ASSERTV(i, j, static_cast<double>(min)   == r1.min());
+                ASSERTV(i, j, static_cast<double>(max)   == r1.max());
+
+                X.load(&r2);
+                ASSERTV(i, j, r1 == r2);
+            }
+
+            Int64 sum = 0;
+            for (int b = 0; b < Obj::k_NUM_BUCKETS; ++b) {
+                sum += X.bucketCount(b);
+            }
+            ASSERTV(i, NUM_UPDATES == sum);
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(METRIC_A); const Obj& X = mX;
+            Rec r;
+
+            ASSERT_SAFE_PASS(mX.update(0));
+            ASSERT_SAFE_FAIL(mX.update(-1));
+
+            ASSERT_SAFE_PASS(X.bucketCount(0));
+            ASSERT_SAFE_PASS(X.bucketCount(Obj::k_NUM_BUCKETS - 1));
+            ASSERT_SAFE_FAIL(X.bucketCount(-1));
+            ASSERT_SAFE_FAIL(X.bucketCount(Obj::k_NUM_BUCKETS));
+
+            ASSERT_PASS(X.load(&r));
+            ASSERT_FAIL(X.load(0));
+            ASSERT_PASS(mX.loadAndReset(&r));
+            ASSERT_FAIL(mX.loadAndReset(0));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CLASS METHODS
+        //
+        // Concerns:
+        //: 1 The buckets partition the range '[0 .. LLONG_MAX]': the lower
+        //:   bound of the first bucket is 0, the upper bound of the final
+        //:   bucket is 'LLONG_MAX', and each bucket begins immediately after
+        //:   the previous one ends.
+        //:
+        //: 2 'bucketIndex' maps each value to the bucket whose bounds contain
+        //:   it.
+        //:
+        //: 3 The values in '[0 .. 63]' each have their own bucket, and the
+        //:   width of every other bucket is at most 1/32 of its lower bound.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Iterate over every bucket, verifying the bounds of consecutive
+        //:   buckets, and that 'bucketIndex' maps each bound (and the
+        //:   midpoint of the bounds) to that bucket.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-4)
+        //
+        // Testing:
+        //   static int bucketIndex(bsls::Types::Int64 value);
+        //   static bsls::Types::Int64 bucketLowerBound(int index);
+        //   static bsls::Types::Int64 bucketUpperBound(int index);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING CLASS METHODS" << endl
+                                  << "=====================" << endl;
+
+        ASSERT(1888 == Obj::k_NUM_BUCKETS);
+
+        ASSERT(0 == Obj::bucketLowerBound(0));
+        ASSERT(LLONG_MAX == Obj::bucketUpperBound(Obj::k_NUM_BUCKETS - 1));
+
+        for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+            const Int64 LOWER = Obj::bucketLowerBound(i);
+            const Int64 UPPER = Obj::bucketUpperBound(i);
+            const Int64 MID   = LOWER + (UPPER - LOWER) / 2;
+
+            if (veryVeryVerbose) {
+                T_ P_(i) P_(LOWER) P(UPPER);
+            }
+
+            ASSERTV(i, LOWER, UPPER, LOWER <= UPPER);
+            if (0 < i) {
+                ASSERTV(i, LOWER == Obj::bucketUpperBound(i - 1) + 1);
+            }
+            if (i < 64) {
+                ASSERTV(i, LOWER == i);
+                ASSERTV(i, UPPER == i);
+            }
+            else {
+                ASSERTV(i, LOWER, UPPER, UPPER - LOWER < LOWER / 32);
+            }
+
+            ASSERTV(i, i == Obj::bucketIndex(LOWER));
+            ASSERTV(i, i == Obj::bucketIndex(UPPER));
+            ASSERTV(i, i == Obj::bucketIndex(MID));
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_SAFE_PASS(Obj::bucketIndex(0));
+            ASSERT_SAFE_PASS(Obj::bucketIndex(LLONG_MAX));
+            ASSERT_SAFE_FAIL(Obj::bucketIndex(-1));
+
+            ASSERT_PASS(Obj::bucketLowerBound(0));
+            ASSERT_PASS(Obj::bucketLowerBound(Obj::k_NUM_BUCKETS - 1));
+            ASSERT_FAIL(Obj::bucketLowerBound(-1));
+            ASSERT_FAIL(Obj::bucketLowerBound(Obj::k_NUM_BUCKETS));
+
+            ASSERT_PASS(Obj::bucketUpperBound(0));
+            ASSERT_PASS(Obj::bucketUpperBound(Obj::k_NUM_BUCKETS - 1));
+            ASSERT_FAIL(Obj::bucketUpperBound(-1));
+            ASSERT_FAIL(Obj::bucketUpperBound(Obj::k_NUM_BUCKETS));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST:
+        //   Developers' Sandbox.
+        //
+        // Plan:
+        //   Perform ad-hoc test of the primary modifiers and accessors.
+        //
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(METRIC_A); const Obj& X = mX;
+        Obj mY(METRIC_B); const Obj& Y = mY;
+
+        ASSERT(METRIC_A == X.metricId());
+        ASSERT(METRIC_B == Y.metricId());
+
+        Rec  r1;
+        QRec q1;
+
+        X.load(&r1, &q1);
+        ASSERT(METRIC_A == r1.metricId());
+        ASSERT(0  == r1.count());
+        ASSERT(0  == r1.total());
+        ASSERT(Rec::k_DEFAULT_MIN == r1.min());
+        ASSERT(Rec::k_DEFAULT_MAX == r1.max());
+        ASSERT(METRIC_A == q1.metricId());
+        ASSERT(0  == q1.count());
+
+        for (int i = 1; i <= 100; ++i) {
+            mX.update(i);
+        }
+        X.load(&r1, &q1);
+        ASSERT(100  == r1.count());
+        ASSERT(5050 == r1.total());
+        ASSERT(1    == r1.min());
+        ASSERT(100  == r1.max());
+        ASSERT(100  == q1.count());
+        ASSERT(50   <= q1.value(0));
+        ASSERT(51   >= q1.value(0));
+        ASSERT(100  == q1.value(3));
+
+        mX.loadAndReset(&r1, &q1);
+        ASSERT(100  == r1.count());
+
+        X.load(&r1, &q1);
+        ASSERT(0  == r1.count());
+        ASSERT(0  == q1.count());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // UPDATE BENCHMARK
+        //
+        // Concerns:
+        //: 1 Recording a value in a 'balm::HistogramCollector' is not
+        //:   significantly more expensive than in a 'balm::IntegerCollector',
+        //:   and does not degrade as badly under contention.
+        //
+        // Plan:
+        //: 1 For an increasing number of threads, measure the aggregate rate
+        //:   at which the threads can update a single 'balm::IntegerCollector'
+        //:   and a single 'balm::HistogramCollector', and report the results.
+        //
+        // Testing:
+        //   UPDATE BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "UPDATE BENCHMARK" << endl
+                                  << "================" << endl;
+
+        using namespace TEST_CASE_UPDATE_BENCHMARK;
+
+        const int MAX_THREADS = 16;
+        const int NUM_UPDATES = 1000000;
+
+        cout << "threads    IntegerCollector    HistogramCollector\n"
+             << "           (M updates/s)       (M updates/s)" << endl;
+
+        for (int numThreads = 1; numThreads <= MAX_THREADS; numThreads *= 2) {
+            const double locked =
+                benchmark<balm::IntegerCollector>(numThreads, NUM_UPDATES);
+            const double histogram =
+                          benchmark<Obj>(numThreads, NUM_UPDATES);
+
+            cout << numThreads << "\t   " << locked << "\t\t       "
+                 << histogram << endl;
+        }
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << bsl::endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,67 @@
+// balm_histogramscopedguard.cpp                                      -*-C++-*-
+#include <balm_histogramscopedguard.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_histogramscopedguard_cpp,"$Id$ $CSID$")
+
+#include <balm_collectorrepository.h>
+#include <balm_defaultmetricsmanager.h>
+#include <balm_metricsmanager.h>
+
+namespace BloombergLP {
+
+namespace balm {
+
+                         // --------------------------
+                         // class HistogramScopedGuard
+                         // --------------------------
+
+// PRIVATE CLASS METHODS
+HistogramCollector *
+HistogramScopedGuard::lookupCollector(const MetricId&  metricId,
+                                      MetricsManager  *manager)
+{
+    manager = DefaultMetricsManager::manager(manager);
+    if (!manager) {
+        return 0;                                                     // RETURN
+    }
+    HistogramCollector *collector =
+              manager->collectorRepository().getDefaultHistogramCollector(
+                                                                     metricId);
+    return collector->metricId().category()->enabled() ? collector : 0;
+}
+
+HistogramCollector *
+HistogramScopedGuard::lookupCollector(const char     *category,
+                                      const char     *name,
+                                      MetricsManager *manager)
+{
+    manager = DefaultMetricsManager::manager(manager);
+    if (!manager) {
+        return 0;                                                     // RETURN
+    }
+    HistogramCollector *collector =
+              manager->collectorRepository().getDefaultHistogramCollector(
+                                                                     category,
+                                                                     name);
+    return collector->metricId().category()->enabled() ? collector : 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,367 @@
+// balm_histogramscopedguard.h                                        -*-C++-*-
+#ifndef INCLUDED_BALM_HISTOGRAMSCOPEDGUARD
+#define INCLUDED_BALM_HISTOGRAMSCOPEDGUARD
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a scoped guard recording elapsed time to a histogram.
+//
+//@CLASSES:
+// balm::HistogramScopedGuard: guard recording elapsed time to a histogram
+//
+//@SEE_ALSO: balm_histogramcollector, balm_stopwatchscopedguard,
+//           balm_metricsmanager
+//
+//@DESCRIPTION: This component provides a scoped guard class,
+// 'balm::HistogramScopedGuard', intended to simplify the task of recording
+// the distribution of the elapsed time of a block of code (e.g., the latency
+// of a request).  A 'balm::HistogramScopedGuard' is supplied the identity of
+// a metric on construction, and an optional enumerated constant indicating
+// the time units to record values in (by default, values are recorded in
+// microseconds).  The guard measures the elapsed time between its
+// construction and destruction, and on destruction records that elapsed time,
+// as an integral number of the indicated time units, to the default
+// 'balm::HistogramCollector' for the supplied metric.  The published records
+// for the metric therefore include the estimated quantiles (e.g., the median
+// and 99th percentile) of the recorded times, in addition to their count,
+// total, minimum, and maximum.
+//
+///Comparison with 'balm::StopwatchScopedGuard'
+///--------------------------------------------
+// A 'balm::StopwatchScopedGuard' records elapsed times to a 'balm::Collector',
+// which maintains only the count, total, minimum, and maximum of the recorded
+// times, so the average time is available but outliers in the distribution
+// of times are hidden.  A 'balm::HistogramScopedGuard' additionally provides
+// the quantiles of the recorded times, at the cost of recording times as
+// integral values (so the time units should be chosen to be small relative to
+// the times being measured) and of the memory used by the histogram collector
+// (see 'balm_histogramcollector').
+//
+///Thread Safety
+///-------------
+// 'balm::HistogramScopedGuard' is *const* *thread-safe*, meaning that
+// accessors may be invoked concurrently from different threads, but it is not
+// safe to access or modify a 'balm::HistogramScopedGuard' in one thread while
+// another thread modifies the same object.  Note however, that at this time
+// 'balm::HistogramScopedGuard' provides no manipulator methods.
+//
+///Usage
+///-----
+// The following example demonstrates how to record the distribution of the
+// elapsed time of a function using a 'balm::HistogramScopedGuard'.
+//
+///Example 1: Recording the Distribution of Request Latencies
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// We start by creating a 'balm::MetricsManager' (an application would
+// typically use the 'balm::DefaultMetricsManager' instance instead):
+//..
+//  balm::MetricsManager manager;
+//..
+// Then, we define a function that processes a request, and records the time
+// taken to do so, in microseconds, to a histogram for the metric
+// "Requests.latency":
+//..
+//  void processRequest(balm::MetricsManager *manager)
+//      // Process a request, recording the elapsed time to the metric
+//      // "Requests.latency" using the specified 'manager'.
+//  {
+//      balm::HistogramScopedGuard guard("Requests",
+//                                       "latency",
+//                                       balm::HistogramScopedGuard::
+//                                                              k_MICROSECONDS,
+//                                       manager);
+//
+//      // ... process the request ...
+//  }
+//..
+// Next, we process some requests:
+//..
+//  for (int i = 0; i < 100; ++i) {
+//      processRequest(&manager);
+//  }
+//..
+// Finally, we collect a sample of the recorded metrics, and verify that it
+// includes the quantiles of the recorded latencies:
+//..
+//  balm::MetricSample                sample;
+//  bsl::vector<balm::MetricRecord>   records;
+//  bsl::vector<balm::QuantileRecord> quantiles;
+//  manager.collectSample(&sample, &records, &quantiles);
+//
+//  assert(1   == records.size());
+//  assert(100 == records[0].count());
+//  assert(1   == quantiles.size());
+//  assert(100 == quantiles[0].count());
+//  assert(quantiles[0].value(0) <= quantiles[0].value(3));
+//..
+
+#ifndef INCLUDED_BALSCM_VERSION
+#include <balscm_version.h>
+#endif
+
+#ifndef INCLUDED_BALM_HISTOGRAMCOLLECTOR
+#include <balm_histogramcollector.h>
+#endif
+
+#ifndef INCLUDED_BALM_METRICID
+#include <balm_metricid.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TIMEUTIL
+#include <bsls_timeutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+
+namespace balm {
+
+class MetricsManager;
+
+                         // ==========================
+                         // class HistogramScopedGuard
+                         // ==========================
+
+class HistogramScopedGuard {
+    // This class provides a mechanism for recording, to a histogram collector,
+    // the elapsed time from the construction of an instance of the guard
+    // until that instance goes out of scope (and is destroyed).  The
+    // constructor of this class takes an optional argument indicating the
+    // time units in which to record the elapsed time; by default a guard
+    // records time in microseconds.  Each instance of this class delegates to
+    // a 'HistogramCollector' for the metric, determined on construction based
+    // on the constructor arguments.  If this scoped guard is not initialized
+    // with an enabled metric, or if the category of the metric becomes
+    // disabled before the scoped guard is destroyed, then 'isActive()' will
+    // return 'false' and no value will be recorded.
+
+  public:
+    // PUBLIC TYPES
+    enum Units {
+        // An enumeration of supported time units.
+
+        k_NANOSECONDS   = 1000000000,
+        k_MICROSECONDS  = 1000000,
+        k_MILLISECONDS  = 1000,
+        k_SECONDS       = 1
+    };
+
+  private:
+    // DATA
+    bsls::Types::Int64  d_startTime;    // timer value (in nanoseconds) at
+                                        // construction
+
+    Units               d_timeUnits;    // time units to record elapsed time
+                                        // in
+
+    HistogramCollector *d_collector_p;  // histogram collector (held, not
+                                        // owned); may be 0, but cannot be
+                                        // invalid
+
+    // NOT IMPLEMENTED
+    HistogramScopedGuard(const HistogramScopedGuard&);
+    HistogramScopedGuard& operator=(const HistogramScopedGuard&);
+
+    // PRIVATE CLASS METHODS
+    static HistogramCollector *lookupCollector(const MetricId&  metricId,
+                                               MetricsManager  *manager);
+    static HistogramCollector *lookupCollector(const char     *category,
+                                               const char     *name,
+                                               MetricsManager *manager);
+        // Return the address of the default histogram collector for the
+        // metric identified by the specified 'metricId', or by the specified
+        // 'category' and 'name', from the specified 'manager', or 0 if the
+        // category of that metric is disabled.  If 'manager' is 0, use the
+        // 'DefaultMetricsManager' instance, and return 0 if that instance has
+        // not been created.
+
+  public:
+    // CREATORS
+    explicit HistogramScopedGuard(HistogramCollector *collector,
+                                  Units               timeUnits =
+                                                              k_MICROSECONDS);
+        // Initialize this scoped guard to record elapsed time using the
+        // specified 'collector'.  Optionally specify the 'timeUnits' in which
+        // to record elapsed time.  If 'collector' is 0 or
+        // 'collector->metricId().category()->enabled()' is 'false', this
+        // object will be inactive (i.e., will not record any values).  The
+        // behavior is undefined unless
+        // 'collector == 0 || collector->metricId().isValid()'.
+
+    explicit HistogramScopedGuard(const MetricId&  metricId,
+                                  MetricsManager  *manager = 0);
+    HistogramScopedGuard(const MetricId&  metricId,
+                         Units            timeUnits,
+                         MetricsManager  *manager = 0);
+        // Initialize this scoped guard to record an elapsed time to the
+        // default histogram collector for the specified 'metricId' from the
+        // optionally specified 'manager'.  Optionally specify the 'timeUnits'
+        // in which to record elapsed time.  If 'timeUnits' is not provided,
+        // the elapsed time will be recorded in microseconds.  If 'manager' is
+        // 0, the 'DefaultMetricsManager' singleton instance is used.  If no
+        // 'manager' is supplied and the default instance has not been
+        // created, this object will be inactive (i.e., it will not record any
+        // values); similarly, if the metric's associated category is disabled
+        // (i.e., 'metricId.category()->enabled()' is 'false'), then this
+        // object will be inactive.  The behavior is undefined unless
+        // 'metricId' is a valid id returned by the 'MetricRegistry' object
+        // owned by the indicated metrics manager.
+
+    HistogramScopedGuard(const char     *category,
+                         const char     *name,
+                         MetricsManager *manager = 0);
+    HistogramScopedGuard(const char     *category,
+                         const char     *name,
+                         Units           timeUnits,
+                         MetricsManager *manager = 0);
+        // Initialize this scoped guard to record an elapsed time to the
+        // default histogram collector for the metric, identified by the
+        // specified 'category' and 'name', from the optionally specified
+        // 'manager'.  Optionally specify the 'timeUnits' in which to record
+        // elapsed time.  If 'timeUnits' is not provided, the elapsed time
+        // will be recorded in microseconds.  If 'manager' is 0, use the
+        // 'DefaultMetricsManager' instance.  If no 'manager' is supplied, and
+        // the default instance has not been created, this object will be
+        // inactive (i.e., it will not record any values); similarly, if the
+        // identified 'category' is disabled, then this object will be
+        // inactive.  The behavior is undefined unless 'category' and 'name'
+        // are null-terminated.
+
+    ~HistogramScopedGuard();
+        // Destroy this scoped guard and, if the scoped guard is active,
+        // record the elapsed time from its creation, truncated to an integral
+        // number of the time units supplied at construction.
+
+    // ACCESSORS
+    bool isActive() const;
+        // Return 'true' if this scoped guard will actively record metrics, and
+        // 'false' otherwise.  If the returned value is 'false' the destructor
+        // will not record a value to the metric.  A scoped guard will be
+        // inactive if either (1) it was not initialized with a valid metric,
+        // (2) the category of the metric it was initialized with was disabled
+        // at the time of construction, or (3) that category is currently
+        // disabled.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                         // --------------------------
+                         // class HistogramScopedGuard
+                         // --------------------------
+
+// CREATORS
+inline
+HistogramScopedGuard::HistogramScopedGuard(HistogramCollector *collector,
+                                           Units               timeUnits)
+: d_startTime(0)
+, d_timeUnits(timeUnits)
+, d_collector_p((collector && collector->metricId().category()->enabled())
+                ? collector
+                : 0)
+{
+    if (d_collector_p) {
+        d_startTime = bsls::TimeUtil::getTimer();
+    }
+}
+
+inline
+HistogramScopedGuard::HistogramScopedGuard(const MetricId&  metricId,
+                                           MetricsManager  *manager)
+: d_startTime(0)
+, d_timeUnits(k_MICROSECONDS)
+, d_collector_p(lookupCollector(metricId, manager))
+{
+    if (d_collector_p) {
+        d_startTime = bsls::TimeUtil::getTimer();
+    }
+}
+
+inline
+HistogramScopedGuard::HistogramScopedGuard(const MetricId&  metricId,
+                                           Units            timeUnits,
+                                           MetricsManager  *manager)
+: d_startTime(0)
+, d_timeUnits(timeUnits)
+, d_collector_p(lookupCollector(metricId, manager))
+{
+    if (d_collector_p) {
+        d_startTime = bsls::TimeUtil::getTimer();
+    }
+}
+
+inline
+HistogramScopedGuard::HistogramScopedGuard(const char     *category,
+                                           const char     *name,
+                                           MetricsManager *manager)
+: d_startTime(0)
+, d_timeUnits(k_MICROSECONDS)
+, d_collector_p(lookupCollector(category, name, manager))
+{
+    if (d_collector_p) {
+        d_startTime = bsls::TimeUtil::getTimer();
+    }
+}
+
+inline
+HistogramScopedGuard::HistogramScopedGuard(const char     *category,
+                                           const char     *name,
+                                           Units           timeUnits,
+                                           MetricsManager *manager)
+: d_startTime(0)
+, d_timeUnits(timeUnits)
+, d_collector_p(lookupCollector(category, name, manager))
+{
+    if (d_collector_p) {
+        d_startTime = bsls::TimeUtil::getTimer();
+    }
+}
+
+inline
+HistogramScopedGuard::~HistogramScopedGuard()
+{
+    if (isActive()) {
+        // Divide (rather than multiply) to convert the elapsed nanoseconds to
+        // the time units, to avoid overflow.
+
+        const bsls::Types::Int64 elapsed = bsls::TimeUtil::getTimer()
+                                         - d_startTime;
+        d_collector_p->update(elapsed / (k_NANOSECONDS / d_timeUnits));
+    }
+}
+
+// ACCESSORS
+inline
+bool HistogramScopedGuard::isActive() const
+{
+    return 0 != d_collector_p
+        && d_collector_p->metricId().category()->enabled();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
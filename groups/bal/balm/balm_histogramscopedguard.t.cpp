@@ -0,0 +1,517 @@
+// balm_histogramscopedguard.t.cpp                                    -*-C++-*-
+#include <balm_histogramscopedguard.h>
+
+#include <balm_category.h>
+#include <balm_collectorrepository.h>
+#include <balm_defaultmetricsmanager.h>
+#include <balm_metricdescription.h>
+#include <balm_metricrecord.h>
+#include <balm_metricregistry.h>
+#include <balm_metricsample.h>
+#include <balm_metricsmanager.h>
+#include <balm_quantilerecord.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The 'balm::HistogramScopedGuard' provides a mechanism for recording the
+// elapsed time of a block of code to a histogram collector.  The class
+// provides several constructor variants, but no manipulator methods, and a
+// single accessor.  Ensure that each constructor selects the correct
+// collector (or none, if the metric is disabled or no metrics manager is
+// available), and that the destructor records a reasonable elapsed time in the
+// requested units.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2]  HistogramScopedGuard(HistogramCollector *, Units = k_MICROSECONDS);
+// [ 3]  HistogramScopedGuard(const MetricId&, MetricsManager * = 0);
+// [ 3]  HistogramScopedGuard(const MetricId&, Units, MetricsManager * = 0);
+// [ 3]  HistogramScopedGuard(const char *, const char *, MetricsManager *);
+// [ 3]  HistogramScopedGuard(const char *, const char *, Units, ...);
+// [ 2]  ~HistogramScopedGuard();
+//
+// ACCESSORS
+// [ 2]  bool isActive() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] ELAPSED TIME VALUE
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        bsl::cout << "Error " << __FILE__ << "(" << i << "): " << s
+                  << "    (failed)" << bsl::endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::HistogramScopedGuard       Obj;
+typedef Obj::Units                       Units;
+typedef balm::HistogramCollector         HCol;
+typedef balm::MetricsManager             MetricsManager;
+typedef balm::DefaultMetricsManager      DefaultManager;
+typedef balm::MetricId                   Id;
+typedef balm::MetricRecord               Rec;
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// The following example demonstrates how to record the distribution of the
+// elapsed time of a function using a 'balm::HistogramScopedGuard'.
+//
+///Example 1: Recording the Distribution of Request Latencies
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// We start by creating a 'balm::MetricsManager' (an application would
+// typically use the 'balm::DefaultMetricsManager' instance instead):
+//..
+//  balm::MetricsManager manager;
+//..
+// Then, we define a function that processes a request, and records the time
+// taken to do so, in microseconds, to a histogram for the metric
+// "Requests.latency":
+//..
+    void processRequest(balm::MetricsManager *manager)
+        // Process a request, recording the elapsed time to the metric
+        // "Requests.latency" using the specified 'manager'.
+    {
+        balm::HistogramScopedGuard guard("Requests",
+                                         "latency",
+                                         balm::HistogramScopedGuard::
+                                                               k_MICROSECONDS,
+                                         manager);
+
+        // ... process the request ...
+    }
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+
+    bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;
+
+    bslma::TestAllocator testAlloc;
+    bslma::TestAllocator *Z = &testAlloc;
+    bslma::TestAllocator defaultAllocator;
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //
+        // Concerns:
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove leading
+        //   comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Usage Example"
+                          << "\n=====================" << endl;
+
+    balm::MetricsManager manager(Z);
+//..
+// Next, we process some requests:
+//..
+    for (int i = 0; i < 100; ++i) {
+        processRequest(&manager);
+    }
+//..
+// Finally, we collect a sample of the recorded metrics, and verify that it
+// includes the quantiles of the recorded latencies:
+//..
+    balm::MetricSample                sample(Z);
+    bsl::vector<balm::MetricRecord>   records(Z);
+    bsl::vector<balm::QuantileRecord> quantiles(Z);
+    manager.collectSample(&sample, &records, &quantiles);
+
+    ASSERT(1   == records.size());
+    ASSERT(100 == records[0].count());
+    ASSERT(1   == quantiles.size());
+    ASSERT(100 == quantiles[0].count());
+    ASSERT(quantiles[0].value(0) <= quantiles[0].value(3));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ELAPSED TIME VALUE
+        //
+        // Concerns:
+        //: 1 The recorded value is the elapsed time between the construction
+        //:   and destruction of the guard, in the requested units.
+        //
+        // Plan:
+        //: 1 For each of the time units, measure the time taken by a guard
+        //:   around a short sleep, and verify that the recorded value lies
+        //:   between the sleep time and the independently measured time.
+        //:   (C-1)
+        //
+        // Testing:
+        //   ELAPSED TIME VALUE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "ELAPSED TIME VALUE" << endl
+                                  << "==================" << endl;
+
+        const int SLEEP_US = 20000;
+
+        struct {
+            int   d_line;
+            Units d_units;
+        } DATA[] = {
+            { L_, Obj::k_NANOSECONDS  },
+            { L_, Obj::k_MICROSECONDS },
+            { L_, Obj::k_MILLISECONDS },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        balm::Category          category("A");
+        balm::MetricDescription desc(&category, "A");
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const int   LINE  = DATA[i].d_line;
+            const Units UNITS = DATA[i].d_units;
+
+            const Id ID(&desc);
+            HCol     collector(ID);
+
+            bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+            {
+                Obj mX(&collector, UNITS);
+                bslmt::ThreadUtil::microSleep(SLEEP_US);
+            }
+            bsls::Types::Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+            const bsls::Types::Int64 DIVISOR = Obj::k_NANOSECONDS / UNITS;
+            const bsls::Types::Int64 MIN     = SLEEP_US * 1000LL / DIVISOR;
+            const bsls::Types::Int64 MAX     = elapsed / DIVISOR;
+
+            Rec record;
+            collector.load(&record);
+            if (veryVerbose) {
+                P_(LINE); P_(MIN); P_(MAX); P(record);
+            }
+            ASSERTV(LINE, 1   == record.count());
+            ASSERTV(LINE, record.total(), MIN, MIN <= record.total());
+            ASSERTV(LINE, record.total(), MAX, MAX >= record.total());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING METRIC LOOKUP CONSTRUCTORS
+        //
+        // Concerns:
+        //: 1 The constructors taking a metric id, or a category and name,
+        //:   record to the default histogram collector for that metric from
+        //:   the supplied metrics manager.
+        //:
+        //: 2 If no metrics manager is supplied, the default metrics manager
+        //:   is used, and the guard is inactive if there is no default
+        //:   metrics manager.
+        //:
+        //: 3 The guard is inactive if the category of the metric is
+        //:   disabled.
+        //:
+        //: 4 The time units default to microseconds.
+        //
+        // Plan:
+        //: 1 Create guards using each constructor, with a supplied metrics
+        //:   manager and with the default metrics manager (before and after
+        //:   it is created), with the category enabled and disabled, and
+        //:   verify 'isActive' and the values recorded to the collectors.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   HistogramScopedGuard(const MetricId&, MetricsManager * = 0);
+        //   HistogramScopedGuard(const MetricId&, Units, MetricsManager *);
+        //   HistogramScopedGuard(const char *, const char *, MetricsManager*);
+        //   HistogramScopedGuard(const char *, const char *, Units, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING METRIC LOOKUP CONSTRUCTORS"
+                          << endl << "=================================="
+                          << endl;
+
+        for (int useDefault = 0; useDefault < 2; ++useDefault) {
+            ASSERT(0 == DefaultManager::instance());
+
+            MetricsManager  localManager(Z);
+            MetricsManager *manager     = useDefault
+                                        ? DefaultManager::create(Z)
+                                        : &localManager;
+            MetricsManager *managerArg  = useDefault ? 0 : manager;
+
+            {
+                // Without a default metrics manager, guards that are not
+                // supplied a manager are inactive.
+
+                Obj mA(manager->metricRegistry().getId("A", "A"));
+                Obj mB("A", "A");
+                Obj mC("A", "A", Obj::k_SECONDS);
+                ASSERTV(useDefault, useDefault == mA.isActive());
+                ASSERTV(useDefault, useDefault == mB.isActive());
+                ASSERTV(useDefault, useDefault == mC.isActive());
+            }
+
+            const Id ID_A = manager->metricRegistry().getId("A", "A");
+            const Id ID_B = manager->metricRegistry().getId("B", "B");
+
+            balm::CollectorRepository& repository =
+                                                manager->collectorRepository();
+
+            HCol *colA = repository.getDefaultHistogramCollector(ID_A);
+            HCol *colB = repository.getDefaultHistogramCollector(ID_B);
+            colA->reset();
+            colB->reset();
+
+            {
+                Obj mW(ID_A, managerArg);
+                Obj mX(ID_A, Obj::k_NANOSECONDS, managerArg);
+                Obj mY("B", "B", managerArg);
+                Obj mZ("B", "B", Obj::k_NANOSECONDS, managerArg);
+                ASSERT(mW.isActive());
+                ASSERT(mX.isActive());
+                ASSERT(mY.isActive());
+                ASSERT(mZ.isActive());
+
+                bslmt::ThreadUtil::microSleep(2000);
+            }
+
+            Rec recA, recB;
+            colA->load(&recA);
+            colB->load(&recB);
+            ASSERTV(useDefault, recA.count(), 2 == recA.count());
+            ASSERTV(useDefault, recB.count(), 2 == recB.count());
+
+            // The microsecond value is (much) less than the nanosecond value.
+
+            ASSERTV(useDefault, recA.min(), 1000 <= recA.min());
+            ASSERTV(useDefault, recA.min(), recA.max(),
+                    recA.min() * 100 < recA.max());
+            ASSERTV(useDefault, recB.min(), recB.max(),
+                    recB.min() * 100 < recB.max());
+
+            // Guards for a disabled category are inactive.
+
+            manager->setCategoryEnabled("A", false);
+            {
+                Obj mX(ID_A, managerArg);
+                Obj mY("A", "A", Obj::k_NANOSECONDS, managerArg);
+                ASSERT(!mX.isActive());
+                ASSERT(!mY.isActive());
+            }
+            colA->load(&recA);
+            ASSERTV(useDefault, recA.count(), 2 == recA.count());
+
+            // A guard becomes inactive if its category is disabled.
+
+            manager->setCategoryEnabled("B", true);
+            {
+                Obj mX("B", "B", managerArg);
+                ASSERT(mX.isActive());
+                manager->setCategoryEnabled("B", false);
+                ASSERT(!mX.isActive());
+            }
+            colB->load(&recB);
+            ASSERTV(useDefault, recB.count(), 2 == recB.count());
+
+            if (useDefault) {
+                DefaultManager::destroy();
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING COLLECTOR CONSTRUCTOR
+        //
+        // Concerns:
+        //: 1 A guard supplied a collector records the elapsed time to that
+        //:   collector on destruction, in the supplied time units.
+        //:
+        //: 2 A guard supplied a null collector, or a collector whose category
+        //:   is disabled, is inactive and records nothing.
+        //:
+        //: 3 A guard whose category is disabled after construction records
+        //:   nothing.
+        //
+        // Plan:
+        //: 1 Create guards for collectors in enabled and disabled categories,
+        //:   and verify 'isActive' and the values recorded.  (C-1..3)
+        //
+        // Testing:
+        //   HistogramScopedGuard(HistogramCollector *, Units);
+        //   ~HistogramScopedGuard();
+        //   bool isActive() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING COLLECTOR CONSTRUCTOR" << endl
+                                  << "=============================" << endl;
+
+        balm::Category          category("A");
+        balm::MetricDescription desc(&category, "A");
+        const Id                ID(&desc);
+        HCol                    collector(ID);
+        Rec                     record;
+
+        {
+            Obj mX(0);
+            ASSERT(!mX.isActive());
+        }
+        {
+            Obj mX(&collector, Obj::k_SECONDS);
+            ASSERT(mX.isActive());
+        }
+        collector.load(&record);
+        ASSERT(1   == record.count());
+        ASSERT(0.0 == record.total());
+
+        {
+            Obj mX(&collector, Obj::k_NANOSECONDS);
+            ASSERT(mX.isActive());
+            bslmt::ThreadUtil::microSleep(1000);
+        }
+        collector.loadAndReset(&record);
+        ASSERT(2       == record.count());
+        ASSERT(1000000 <= record.total());
+
+        category.setEnabled(false);
+        {
+            Obj mX(&collector);
+            ASSERT(!mX.isActive());
+            category.setEnabled(true);
+            ASSERT(!mX.isActive());
+        }
+        {
+            Obj mX(&collector);
+            ASSERT(mX.isActive());
+            category.setEnabled(false);
+            ASSERT(!mX.isActive());
+        }
+        collector.load(&record);
+        ASSERT(0 == record.count());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST:
+        //   Developers' Sandbox.
+        //
+        // Plan:
+        //   Perform and ad-hoc test of the primary modifiers and accessors.
+        //
+        // Testing:
+        //   This "test" *exercises* basic functionality, but *tests* nothing.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        MetricsManager manager(Z);
+        {
+            Obj mX("A", "A", &manager);
+            ASSERT(mX.isActive());
+        }
+        {
+            Obj mX("A", "A", Obj::k_MILLISECONDS, &manager);
+            ASSERT(mX.isActive());
+        }
+        Rec record;
+        manager.collectorRepository().getDefaultHistogramCollector("A", "A")
+                                                               ->load(&record);
+        ASSERT(2 == record.count());
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << bsl::endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -19,7 +19,8 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //
-//@SEE_ALSO: balm_collector, balm_integercollector, balm_defaultmetricsmanager
+//@SEE_ALSO: balm_collector, balm_integercollector,
+//           balm_shardedintegercollector, balm_defaultmetricsmanager
 //
 //@DESCRIPTION: This component provides a suite of macros to simplify the
 // process of collecting metrics.  A metric records the number of times an
@@ -78,6 +79,12 @@ BSLS_IDENT("$Id: $")
 //       publication type.  'CATEGORY' and 'METRIC' must be *runtime*
 //       *constants*.
 //
+//   BALM_METRICS_SHARDED_INT_UPDATE(CATEGORY, METRIC, VALUE)
+//   BALM_METRICS_SHARDED_INCREMENT(CATEGORY, METRIC)
+//       Update (or increment) the identified metric using a lock-free,
+//       sharded collector, suited to metrics updated at a high rate from many
+//       threads.  'CATEGORY' and 'METRIC' must be *runtime* *constants*.
+//
 //   BALM_METRICS_DYNAMIC_UPDATE(CATEGORY, METRIC, VALUE)
 //   BALM_METRICS_DYNAMIC_INT_UPDATE(CATEGORY, METRIC, VALUE)
 //       Update the identified metric by 'VALUE'.  This operation performs a
@@ -240,6 +247,24 @@ BSLS_IDENT("$Id: $")
 //   BALM_METRICS_TYPED_INCREMENT(CATEGORY, METRIC, PREFERRED_TYPE)
 //       The behavior of this macro is logically equivalent to
 //       'BALM_METRICS_TYPED_UPDATE(CATEGORY, METRIC, 1, PREFERRED_TYPE)'.
+//
+//   BALM_METRICS_SHARDED_INT_UPDATE(CATEGORY, METRIC, VALUE)
+//       The behavior of this macro is logically equivalent to
+//       'BALM_METRICS_INT_UPDATE(CATEGORY, METRIC, VALUE)', except that the
+//       value is recorded using the default 'balm::ShardedIntegerCollector'
+//       for the indicated metric, rather than its default
+//       'balm::IntegerCollector'.  A sharded integer collector records
+//       values without taking a lock, and the updates made by threads
+//       running on different CPUs do not (typically) contend for the same
+//       cache line (see 'balm_shardedintegercollector').  This macro should
+//       be preferred for metrics updated at a high rate from many threads.
+//       Note that the values recorded by this macro and those recorded by
+//       'BALM_METRICS_INT_UPDATE' (or 'BALM_METRICS_UPDATE') for the same
+//       metric are combined when the metric is published.
+//
+//   BALM_METRICS_SHARDED_INCREMENT(CATEGORY, METRIC)
+//       The behavior of this macro is logically equivalent to
+//       'BALM_METRICS_SHARDED_INT_UPDATE(CATEGORY, METRIC, 1)'.
 //..
 //  The following are the dynamic macros provided by this component for
 //  updating a metric's value; these macros do not statically cache the
@@ -529,6 +554,10 @@ BSLS_IDENT("$Id: $")
 #include <balm_publicationtype.h>
 #endif
 
+#ifndef INCLUDED_BALM_SHARDEDINTEGERCOLLECTOR
+#include <balm_shardedintegercollector.h>
+#endif
+
 #ifndef INCLUDED_BALM_STOPWATCHSCOPEDGUARD
 #include <balm_stopwatchscopedguard.h>
 #endif
@@ -1022,6 +1051,29 @@ do {                                                                          \
 #define BALM_METRICS_DYNAMIC_INCREMENT(CATEGORY, METRIC)                      \
     BALM_METRICS_DYNAMIC_INT_UPDATE(CATEGORY, METRIC, 1)
 
+                        // ===============================
+                        // BALM_METRICS_SHARDED_INT_UPDATE
+                        // ===============================
+
+#define BALM_METRICS_SHARDED_INT_UPDATE(CATEGORY, METRIC1, VALUE1) do {       \
+   using namespace BloombergLP;                                               \
+   typedef balm::Metrics_Helper Helper;                                       \
+   static balm::CategoryHolder holder = { false, 0, 0 };                      \
+   static balm::ShardedIntegerCollector *collector1 = 0;                      \
+   if (0 == holder.category() && balm::DefaultMetricsManager::instance()) {   \
+     Helper::logEmptyName(CATEGORY,Helper::e_TYPE_CATEGORY,__FILE__,__LINE__);\
+     Helper::logEmptyName(METRIC1, Helper::e_TYPE_METRIC, __FILE__, __LINE__);\
+       collector1 = Helper::getShardedIntegerCollector(CATEGORY, METRIC1);    \
+       Helper::initializeCategoryHolder(&holder, CATEGORY);                   \
+   }                                                                          \
+   if (holder.enabled()) {                                                    \
+       collector1->update(VALUE1);                                            \
+   }                                                                          \
+ } while (0)
+
+#define BALM_METRICS_SHARDED_INCREMENT(CATEGORY, METRIC)                      \
+    BALM_METRICS_SHARDED_INT_UPDATE(CATEGORY, METRIC, 1)
+
                         // =======================
                         // BALM_METRICS_TIME_BLOCK
                         // =======================
@@ -1224,6 +1276,14 @@ struct Metrics_Helper {
         // The behavior is undefined unless the 'balm' metrics manager
         // singleton is valid.
 
+    static ShardedIntegerCollector *getShardedIntegerCollector(
+                                                          const char *category,
+                                                          const char *metric);
+        // Return the address of the default sharded integer metrics collector
+        // for the metric identified by the specified 'category' and 'metric'
+        // names.  The behavior is undefined unless the 'balm' metrics manager
+        // singleton is valid.
+
     static void setPublicationType(const MetricId&        id,
                                    PublicationType::Value type);
         // Set the publication type for the metric identified by the specified
@@ -1278,6 +1338,17 @@ IntegerCollector *Metrics_Helper::getIntegerCollector(const char *category,
                                                                      metric);
 }
 
+inline
+ShardedIntegerCollector *
+Metrics_Helper::getShardedIntegerCollector(const char *category,
+                                           const char *metric)
+{
+    MetricsManager *manager = DefaultMetricsManager::instance();
+    return manager->collectorRepository().getDefaultShardedIntegerCollector(
+                                                                     category,
+                                                                     metric);
+}
+
 inline
 void Metrics_Helper::setPublicationType(const MetricId&        id,
                                         PublicationType::Value type)
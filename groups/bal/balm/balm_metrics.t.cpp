@@ -101,7 +101,9 @@ using bsl::flush;
 //                                             const char *file,
 //                                             int         line);
 // [18] WARNING LOG TEST: ALL MACROS
-// [19] USAGE EXAMPLE
+// [19] BALM_METRICS_SHARDED_INT_UPDATE(CATEGORY, NAME, VALUE)
+// [19] BALM_METRICS_SHARDED_INCREMENT(CATEGORY, NAME)
+// [20] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -146,6 +148,8 @@ typedef BALM::MetricRegistry        Registry;
 typedef BALM::CollectorRepository   Repository;
 typedef BALM::Collector             Collector;
 typedef BALM::IntegerCollector      IntCollector;
+typedef BALM::ShardedIntegerCollector
+                                    ShardedIntCollector;
 typedef BALM::MetricId              Id;
 typedef BALM::Category              Category;
 typedef BALM::PublicationType       Type;
@@ -179,6 +183,15 @@ BALM::MetricRecord recordVal(const BALM::IntegerCollector *collector)
     return record;
 }
 
+inline
+BALM::MetricRecord recordVal(const BALM::ShardedIntegerCollector *collector)
+    // Return the current record value of the specified 'collector'.
+{
+    BALM::MetricRecord record;
+    collector->load(&record);
+    return record;
+}
+
 bool within(double         value,
             SWGuard::Units scale,
             double         expectedS,
@@ -951,6 +964,21 @@ void StandardIntMacroConcurrencyTest::runTest()
     d_pool.drain();
 }
 
+// ------------------- case 19: ShardedIntMacroTest -------------------------
+
+void shardedIntMacroJob(Corp::bslmt::Barrier *barrier, int count)
+    // Wait on the specified 'barrier', then update the metrics "A" and "B"
+    // in the enabled category "S" and the metric "A" in the disabled
+    // category "T", the specified 'count' times, using the sharded macros.
+{
+    barrier->wait();
+    for (int i = 0; i < count; ++i) {
+        BALM_METRICS_SHARDED_INCREMENT("S", "A");
+        BALM_METRICS_SHARDED_INT_UPDATE("S", "B", i % 10);
+        BALM_METRICS_SHARDED_INCREMENT("T", "A");
+    }
+}
+
 // ------------------- case 15: DynamicIntMacroConcurrencyTest ----------------
 
 class DynamicIntMacroConcurrencyTest {
@@ -1378,7 +1406,7 @@ int main(int argc, char *argv[])
     Corp::bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 19: {
+      case 20: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -1436,6 +1464,112 @@ int main(int argc, char *argv[])
 
     }
     } break;
+      case 19: {
+        // --------------------------------------------------------------------
+        // TESTING SHARDED INT MACROS
+        //
+        // Concerns:
+        //: 1 The sharded macros have no effect if the default metrics manager
+        //:   has not been created.
+        //:
+        //: 2 The sharded macros update the default sharded integer collector
+        //:   for the identified metric, and the values recorded by many
+        //:   threads are all accounted for.
+        //:
+        //: 3 The sharded macros have no effect if the category is disabled.
+        //:
+        //: 4 The values recorded by the sharded macros are published along
+        //:   with those recorded by the other macros for the same metric.
+        //
+        // Plan:
+        //: 1 Invoke the macros before creating the default metrics manager.
+        //:   (C-1)
+        //:
+        //: 2 Create the default metrics manager, disable one category, and
+        //:   invoke the macros from a number of threads.  Verify the values
+        //:   held by the default sharded integer collectors.  (C-2..3)
+        //:
+        //: 3 Update one of the metrics using 'BALM_METRICS_INT_UPDATE', and
+        //:   verify that 'collectAndReset' on the repository returns the
+        //:   combined values.  (C-4)
+        //
+        // Testing:
+        //   BALM_METRICS_SHARDED_INT_UPDATE(CATEGORY, NAME, VALUE)
+        //   BALM_METRICS_SHARDED_INCREMENT(CATEGORY, NAME)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING SHARDED INT MACROS" << endl
+                          << "==========================" << endl;
+
+        Corp::bslma::TestAllocator defaultAllocator;
+        Corp::bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+        Corp::bslma::TestAllocator testAllocator;
+
+        ASSERT(0 == DefaultManager::instance());
+        BALM_METRICS_SHARDED_INCREMENT("S", "A");
+        BALM_METRICS_SHARDED_INT_UPDATE("S", "B", 5);
+
+        BALM::DefaultMetricsManagerScopedGuard scopedGuard(&testAllocator);
+        BALM::MetricsManager& mgr        = *DefaultManager::instance();
+        Repository&           repository = mgr.collectorRepository();
+
+        mgr.setCategoryEnabled("T", false);
+
+        const int NUM_THREADS = 8;
+        const int COUNT       = 10000;
+        {
+            Corp::bdlmt::FixedThreadPool pool(NUM_THREADS,
+                                              NUM_THREADS,
+                                              &testAllocator);
+            Corp::bslmt::Barrier         barrier(NUM_THREADS);
+            pool.start();
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                pool.enqueueJob(Corp::bdlf::BindUtil::bind(&shardedIntMacroJob,
+                                                           &barrier,
+                                                           COUNT));
+            }
+            pool.drain();
+        }
+
+        const int REPS = NUM_THREADS * COUNT;
+
+        ShardedIntCollector *SA =
+                          repository.getDefaultShardedIntegerCollector("S",
+                                                                       "A");
+        ShardedIntCollector *SB =
+                          repository.getDefaultShardedIntegerCollector("S",
+                                                                       "B");
+        ShardedIntCollector *TA =
+                          repository.getDefaultShardedIntegerCollector("T",
+                                                                       "A");
+
+        ASSERT(BALM::MetricRecord(SA->metricId(), REPS, REPS, 1, 1)
+                                                             == recordVal(SA));
+        ASSERT(BALM::MetricRecord(SB->metricId(),
+                                  REPS,
+                                  4.5 * REPS,
+                                  0,
+                                  9)                         == recordVal(SB));
+        ASSERT(0 == recordVal(TA).count());
+
+        BALM_METRICS_INT_UPDATE("S", "A", 10);
+
+        bsl::vector<BALM::MetricRecord> records(&testAllocator);
+        repository.collectAndReset(&records, mgr.metricRegistry()
+                                                         .getCategory("S"));
+        ASSERT(2 == records.size());
+        for (bsl::size_t i = 0; i < records.size(); ++i) {
+            if (SA->metricId() == records[i].metricId()) {
+                ASSERT(BALM::MetricRecord(SA->metricId(),
+                                          REPS + 1,
+                                          REPS + 10,
+                                          1,
+                                          10) == records[i]);
+            }
+        }
+        ASSERT(0 == recordVal(SA).count());
+      } break;
       case 18: {
         // --------------------------------------------------------------------
         // Testing:
@@ -45,6 +45,20 @@ MetricSampleGroup::print(bsl::ostream& stream,
 
     bdlb::Print::indent(stream, level + 1, spacesPerLevel);
     stream << "]" << NL;
+
+    if (0 < d_numQuantileRecords) {
+        bdlb::Print::indent(stream, level + 1, spacesPerLevel);
+        stream << "[" << NL;
+
+        for (int i = 0; i < d_numQuantileRecords; ++i) {
+            bdlb::Print::indent(stream, level + 2, spacesPerLevel);
+            stream << d_quantileRecords_p[i] << NL;
+        }
+
+        bdlb::Print::indent(stream, level + 1, spacesPerLevel);
+        stream << "]" << NL;
+    }
+
     bdlb::Print::indent(stream, level, spacesPerLevel);
     stream << "]" << NL;
     return stream;
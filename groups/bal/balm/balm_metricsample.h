@@ -21,7 +21,7 @@ BSLS_IDENT("$Id: $")
 // balm::MetricSampleGroup: a group of records describing the same time period
 //      balm::MetricSample: a sample of collected metric records
 //
-//@SEE_ALSO: balm_publisher, balm_metricrecord
+//@SEE_ALSO: balm_publisher, balm_metricrecord, balm_quantilerecord
 //
 //@DESCRIPTION: This component provides a container used to store a sample of
 // recorded metric information.  A 'balm::MetricSample' contains a collection
@@ -34,6 +34,13 @@ BSLS_IDENT("$Id: $")
 // object contains a timestamp value used to indicate when the sample was
 // taken.
 //
+// A 'balm::MetricSampleGroup' may additionally refer to a sequence of
+// (external) 'balm::QuantileRecord' objects, holding the estimated quantiles
+// (e.g., the median and 99th percentile) of the values recorded for those
+// metrics in the group that were collected using a
+// 'balm::HistogramCollector'.  The quantile records of a group are optional,
+// and are not counted by 'numRecords'.
+//
 ///Thread Safety
 ///-------------
 // 'balm::MetricSample' and 'balm::MetricSampleGroup' are both *const*
@@ -132,6 +139,10 @@ BSLS_IDENT("$Id: $")
 #include <balm_metricrecord.h>
 #endif
 
+#ifndef INCLUDED_BALM_QUANTILERECORD
+#include <balm_quantilerecord.h>
+#endif
+
 #ifndef INCLUDED_BDLT_DATETIMETZ
 #include <bdlt_datetimetz.h>
 #endif
@@ -167,16 +178,25 @@ class MetricSampleGroup {
     // This class provides an *in-core* value-semantic representation of a
     // group of metric record values.  This class contains the address of an
     // array of (externally managed) 'MetricRecord' objects, the number of
-    // records in that array, and an elapsed time value (used to indicate the
-    // time span over which the metric values were aggregated).
+    // records in that array, the address and length of an (optional) array
+    // of (externally managed) 'QuantileRecord' objects, and an elapsed time
+    // value (used to indicate the time span over which the metric values
+    // were aggregated).
 
     // DATA
-    const MetricRecord *d_records_p;   // array of records (held, not
-                                       // owned)
+    const MetricRecord   *d_records_p;          // array of records (held,
+                                                // not owned)
 
-    int                 d_numRecords;  // number of records in array
+    int                   d_numRecords;         // number of records in array
 
-    bsls::TimeInterval  d_elapsedTime; // interval described by records
+    const QuantileRecord *d_quantileRecords_p;  // array of quantile records
+                                                // (held, not owned)
+
+    int                   d_numQuantileRecords; // number of quantile records
+                                                // in array
+
+    bsls::TimeInterval    d_elapsedTime;        // interval described by
+                                                // records
 
   public:
     // PUBLIC TYPES
@@ -187,8 +207,9 @@ class MetricSampleGroup {
     // CREATORS
     MetricSampleGroup();
         // Create an empty sample group.  By default, the 'records()' address
-        // is 0, 'numRecords()' is 0, and the 'elapsedTime()' is the default-
-        // constructed 'bsls::TimeInterval'.
+        // is 0, 'numRecords()' is 0, the 'quantileRecords()' address is 0,
+        // 'numQuantileRecords()' is 0, and the 'elapsedTime()' is the
+        // default-constructed 'bsls::TimeInterval'.
 
     MetricSampleGroup(const MetricRecord             *records,
                            int                        numRecords,
@@ -203,6 +224,24 @@ class MetricSampleGroup {
         // or until the records are set to a different sequence by calling the
         // 'setRecords' manipulator.
 
+    MetricSampleGroup(const MetricRecord        *records,
+                      int                        numRecords,
+                      const QuantileRecord      *quantileRecords,
+                      int                        numQuantileRecords,
+                      const bsls::TimeInterval&  elapsedTime);
+        // Create a sample group containing the specified sequence of
+        // 'records' of specified length 'numRecords', and the specified
+        // sequence of 'quantileRecords' of specified length
+        // 'numQuantileRecords', recorded over a period whose duration is the
+        // specified 'elapsedTime'.  The behavior is undefined unless
+        // '0 <= numRecords', '0 <= numQuantileRecords', 'records' points to a
+        // contiguous sequence of (at least) 'numRecords' metric records, and
+        // 'quantileRecords' points to a contiguous sequence of (at least)
+        // 'numQuantileRecords' quantile records.  Note that neither sequence
+        // is copied, and the supplied arrays must remain valid for the
+        // productive lifetime of this object or until they are set to a
+        // different sequence.
+
     MetricSampleGroup(const MetricSampleGroup& original);
         // Create a sample group having the same (in-core) value as the
         // specified 'original' sample group.
@@ -233,6 +272,17 @@ class MetricSampleGroup {
         // or until the records are set to a different sequence by calling the
         // 'setRecords' manipulator.
 
+    void setQuantileRecords(const QuantileRecord *quantileRecords,
+                            int                   numQuantileRecords);
+        // Set the sequence of quantile records referred to by this sample
+        // group to the specified sequence of 'quantileRecords' of specified
+        // length 'numQuantileRecords'.  The behavior is undefined unless
+        // '0 <= numQuantileRecords', and 'quantileRecords' refers to a
+        // contiguous sequence of (at least) 'numQuantileRecords'.  Note that
+        // the contents of 'quantileRecords' is *not* copied and the supplied
+        // array must remain valid for the productive lifetime of this object
+        // or until the quantile records are set to a different sequence.
+
     // ACCESSORS
     const MetricRecord *records() const;
         // Return the address of the contiguous sequence of non-modifiable
@@ -242,6 +292,14 @@ class MetricSampleGroup {
         // Return the number of records (referenced to by 'records()') in this
         // object.
 
+    const QuantileRecord *quantileRecords() const;
+        // Return the address of the contiguous sequence of non-modifiable
+        // quantile records of length 'numQuantileRecords()'.
+
+    int numQuantileRecords() const;
+        // Return the number of quantile records (referenced to by
+        // 'quantileRecords()') in this object.
+
     const bsls::TimeInterval& elapsedTime() const;
         // Return a reference to the non-modifiable elapsed time interval over
         // which this object's metric records were aggregated.
@@ -274,14 +332,16 @@ bool operator==(const MetricSampleGroup& lhs,
     // Return 'true' if the specified 'lhs' and 'rhs' sample groups have the
     // same value, and 'false' otherwise.  Two sample groups have the same
     // value if the respective record sequence-addresses, number of records,
-    // and elapsed time are the same.
+    // quantile record sequence-addresses, number of quantile records, and
+    // elapsed time are the same.
 
 bool operator!=(const MetricSampleGroup& lhs,
                 const MetricSampleGroup& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' sample groups do not
     // have the same value, and 'false' otherwise.  Two sample groups do not
     // have the same value if any of the respective record-sequence addresses,
-    // number of records, or elapsed time, are not the same.
+    // number of records, quantile record-sequence addresses, number of
+    // quantile records, or elapsed time, are not the same.
 
 bsl::ostream& operator<<(bsl::ostream&            stream,
                          const MetricSampleGroup& rhs);
@@ -392,6 +452,25 @@ class MetricSample {
         //  appendGroup(MetricSampleGroup(records, numRecords, elapsedTime));
         //..
 
+    void appendGroup(const MetricRecord        *records,
+                     int                        numRecords,
+                     const QuantileRecord      *quantileRecords,
+                     int                        numQuantileRecords,
+                     const bsls::TimeInterval&  elapsedTime);
+        // Append to the sequence of groups maintained by this sample a new
+        // group containing the specified sequence of 'records' of specified
+        // length 'numRecords', and the specified sequence of
+        // 'quantileRecords' of specified length 'numQuantileRecords',
+        // measuring the specified 'elapsedTime'.  If 'numRecords' is 0 this
+        // method has no effect.  The behavior is undefined unless
+        // '0 <= numRecords', '0 <= numQuantileRecords', 'records' and
+        // 'quantileRecords' refer to contiguous sequences of size (at least)
+        // 'numRecords' and 'numQuantileRecords' respectively, and
+        // 'elapsedTime > bsls::TimeInterval(0, 0)'.  Note that neither
+        // sequence is copied: hence, the supplied arrays must remain valid
+        // for the lifetime of this object or until the records are removed by
+        // calling 'removeAllRecords()'.
+
     void removeAllRecords();
         // Remove all metric records from this sample.
 
@@ -473,6 +552,8 @@ inline
 MetricSampleGroup::MetricSampleGroup()
 : d_records_p(0)
 , d_numRecords(0)
+, d_quantileRecords_p(0)
+, d_numQuantileRecords(0)
 , d_elapsedTime()
 {
 }
@@ -483,6 +564,23 @@ MetricSampleGroup::MetricSampleGroup(const MetricRecord        *records,
                                      const bsls::TimeInterval&  elapsedTime)
 : d_records_p(records)
 , d_numRecords(numRecords)
+, d_quantileRecords_p(0)
+, d_numQuantileRecords(0)
+, d_elapsedTime(elapsedTime)
+{
+}
+
+inline
+MetricSampleGroup::MetricSampleGroup(
+                                 const MetricRecord        *records,
+                                 int                        numRecords,
+                                 const QuantileRecord      *quantileRecords,
+                                 int                        numQuantileRecords,
+                                 const bsls::TimeInterval&  elapsedTime)
+: d_records_p(records)
+, d_numRecords(numRecords)
+, d_quantileRecords_p(quantileRecords)
+, d_numQuantileRecords(numQuantileRecords)
 , d_elapsedTime(elapsedTime)
 {
 }
@@ -491,6 +589,8 @@ inline
 MetricSampleGroup::MetricSampleGroup(const MetricSampleGroup& original)
 : d_records_p(original.d_records_p)
 , d_numRecords(original.d_numRecords)
+, d_quantileRecords_p(original.d_quantileRecords_p)
+, d_numQuantileRecords(original.d_numQuantileRecords)
 , d_elapsedTime(original.d_elapsedTime)
 {
 }
@@ -499,9 +599,11 @@ MetricSampleGroup::MetricSampleGroup(const MetricSampleGroup& original)
 inline
 MetricSampleGroup& MetricSampleGroup::operator=(const MetricSampleGroup& rhs)
 {
-    d_records_p   = rhs.d_records_p;
-    d_numRecords  = rhs.d_numRecords;
-    d_elapsedTime = rhs.d_elapsedTime;
+    d_records_p          = rhs.d_records_p;
+    d_numRecords         = rhs.d_numRecords;
+    d_quantileRecords_p  = rhs.d_quantileRecords_p;
+    d_numQuantileRecords = rhs.d_numQuantileRecords;
+    d_elapsedTime        = rhs.d_elapsedTime;
     return *this;
 }
 
@@ -519,6 +621,15 @@ void MetricSampleGroup::setRecords(const MetricRecord *records,
     d_numRecords = numRecords;
 }
 
+inline
+void MetricSampleGroup::setQuantileRecords(
+                                 const QuantileRecord *quantileRecords,
+                                 int                   numQuantileRecords)
+{
+    d_quantileRecords_p  = quantileRecords;
+    d_numQuantileRecords = numQuantileRecords;
+}
+
 // ACCESSORS
 inline
 const MetricRecord *MetricSampleGroup::records() const
@@ -532,6 +643,18 @@ int MetricSampleGroup::numRecords() const
     return d_numRecords;
 }
 
+inline
+const QuantileRecord *MetricSampleGroup::quantileRecords() const
+{
+    return d_quantileRecords_p;
+}
+
+inline
+int MetricSampleGroup::numQuantileRecords() const
+{
+    return d_numQuantileRecords;
+}
+
 inline
 const bsls::TimeInterval& MetricSampleGroup::elapsedTime() const
 {
@@ -557,9 +680,11 @@ inline
 bool balm::operator==(const MetricSampleGroup& lhs,
                       const MetricSampleGroup& rhs)
 {
-    return lhs.records()     == rhs.records()
-        && lhs.numRecords()  == rhs.numRecords()
-        && lhs.elapsedTime() == rhs.elapsedTime();
+    return lhs.records()            == rhs.records()
+        && lhs.numRecords()         == rhs.numRecords()
+        && lhs.quantileRecords()    == rhs.quantileRecords()
+        && lhs.numQuantileRecords() == rhs.numQuantileRecords()
+        && lhs.elapsedTime()        == rhs.elapsedTime();
 }
 
 inline
@@ -622,6 +747,23 @@ void MetricSample::appendGroup(const MetricRecord        *records,
     }
 }
 
+inline
+void MetricSample::appendGroup(const MetricRecord        *records,
+                               int                        numRecords,
+                               const QuantileRecord      *quantileRecords,
+                               int                        numQuantileRecords,
+                               const bsls::TimeInterval&  elapsedTime)
+{
+    if (0 < numRecords) {
+        d_records.push_back(SampleGroup(records,
+                                        numRecords,
+                                        quantileRecords,
+                                        numQuantileRecords,
+                                        elapsedTime));
+        d_numRecords += numRecords;
+    }
+}
+
 inline
 void MetricSample::removeAllRecords()
 {
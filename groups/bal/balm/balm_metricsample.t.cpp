@@ -49,15 +49,19 @@ using bsl::flush;
 // [ 4]  balm::MetricSampleGroup(const balm::MetricRecord  *,
 //                              int                       ,
 //                              const bsls::TimeInterval&  );
+// [19]  balm::MetricSampleGroup(const MR *, int, const QR *, int, ...);
 // [ 6]  balm::MetricSampleGroup(const balm::MetricSampleGroup& );
 // [ 3]  ~balm::MetricSampleGroup();
 // MANIPULATORS
 // [ 7]  balm::MetricSampleGroup& operator=(balm::MetricSampleGroup&);
 // [ 3]  void setElapsedTime(const bsls::TimeInterval& );
 // [ 3]  void setRecords(const balm::MetricRecord *, int );
+// [19]  void setQuantileRecords(const balm::QuantileRecord *, int);
 // ACCESSORS
 // [ 3]  const balm::MetricRecord *records() const;
 // [ 3]  int numRecords() const;
+// [19]  const balm::QuantileRecord *quantileRecords() const;
+// [19]  int numQuantileRecords() const;
 // [ 3]  const bsls::TimeInterval& elapsedTime() const;
 // [ 9]  const_iterator begin() const;
 // [ 9]  const_iterator end() const;
@@ -83,6 +87,7 @@ using bsl::flush;
 // [18]  void appendGroup(const balm::MetricRecord  *,
 //                        int                       ,
 //                        const bsls::TimeInterval&  );
+// [19]  void appendGroup(const MR *, int, const QR *, int, ...);
 // [16]  void removeAllRecords();
 // ACCESSORS
 // [11]  const balm::MetricSampleGroup& sampleGroup(int ) const;
@@ -100,7 +105,7 @@ using bsl::flush;
 // [ 1] BREATHING TEST: 'balm::MetricSampleGroup'
 // [ 2] BREATHING TEST: 'balm::MetricSample'
 // [ 2] HELPER TEST: 'gg'
-// [19] USAGE EXAMPLE
+// [20] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -346,7 +351,7 @@ int main(int argc, char *argv[])
     recordBuffer.push_back(balm::MetricRecord( ID_A, 9, 9, 9, 9));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 19: {
+      case 20: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -448,6 +453,118 @@ int main(int argc, char *argv[])
 //  [ MyCategory.MetricC: 4 3 2 1 ]
 //..
       } break;
+      case 19: {
+        // --------------------------------------------------------------------
+        // TESTING QUANTILE RECORDS
+        //
+        // Concerns:
+        //: 1 A default constructed group, and a group created without quantile
+        //:   records, refer to no quantile records.
+        //:
+        //: 2 The quantile records supplied at construction, or using
+        //:   'setQuantileRecords', are returned by the accessors, and do not
+        //:   affect the other attributes.
+        //:
+        //: 3 Copy construction, assignment, and the equality operators
+        //:   account for the quantile records.
+        //:
+        //: 4 'print' writes the quantile records only if there are any.
+        //:
+        //: 5 'appendGroup' with quantile records appends a group referring to
+        //:   those quantile records, and 'numRecords' does not count them.
+        //
+        // Plan:
+        //: 1 Create groups with and without quantile records, and verify
+        //:   their attributes, copies, equality, and output.  (C-1..4)
+        //:
+        //: 2 Append groups with quantile records to a sample, and verify the
+        //:   appended groups.  (C-5)
+        //
+        // Testing:
+        //   balm::MetricSampleGroup(const MR *, int, const QR *, int, ...);
+        //   void setQuantileRecords(const balm::QuantileRecord *, int);
+        //   const balm::QuantileRecord *quantileRecords() const;
+        //   int numQuantileRecords() const;
+        //   void appendGroup(const MR *, int, const QR *, int, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING QUANTILE RECORDS"
+                          << "\n========================" << endl;
+
+        const bsls::TimeInterval  ELAPSED(1, 0);
+        const Rec                *RECS = RECORD_BUFFER.data();
+
+        balm::QuantileRecord quantiles[2];
+        quantiles[0].metricId() = ID_A;
+        quantiles[0].count()    = 3;
+        quantiles[0].value(0)   = 1.0;
+        quantiles[1].metricId() = ID_B;
+
+        if (verbose) cout << "\tTesting 'balm::MetricSampleGroup'." << endl;
+        {
+            const Group D;
+            ASSERT(0 == D.quantileRecords());
+            ASSERT(0 == D.numQuantileRecords());
+
+            const Group W(RECS, 2, ELAPSED);
+            ASSERT(0 == W.quantileRecords());
+            ASSERT(0 == W.numQuantileRecords());
+
+            const Group X(RECS, 2, quantiles, 2, ELAPSED);
+            ASSERT(RECS == X.records());
+            ASSERT(2             == X.numRecords());
+            ASSERT(quantiles     == X.quantileRecords());
+            ASSERT(2             == X.numQuantileRecords());
+            ASSERT(ELAPSED       == X.elapsedTime());
+
+            ASSERT(W != X);
+            ASSERT(X == Group(X));
+
+            Group mY(W); const Group& Y = mY;
+            ASSERT(W == Y);
+            mY.setQuantileRecords(quantiles, 2);
+            ASSERT(RECS == Y.records());
+            ASSERT(2             == Y.numRecords());
+            ASSERT(quantiles     == Y.quantileRecords());
+            ASSERT(2             == Y.numQuantileRecords());
+            ASSERT(X == Y);
+
+            mY.setQuantileRecords(quantiles, 1);
+            ASSERT(X != Y);
+
+            mY = X;
+            ASSERT(X == Y);
+
+            // 'print' writes the quantile records after the metric records.
+
+            bsl::ostringstream wBuf, xBuf;
+            W.print(wBuf, 0, -1);
+            X.print(xBuf, 0, -1);
+            bsl::ostringstream qBuf;
+            qBuf << quantiles[0];
+            ASSERT(bsl::string::npos == wBuf.str().find(qBuf.str()));
+            ASSERT(bsl::string::npos != xBuf.str().find(qBuf.str()));
+            if (veryVerbose) {
+                P(wBuf.str()); P(xBuf.str());
+            }
+        }
+
+        if (verbose) cout << "\tTesting 'balm::MetricSample'." << endl;
+        {
+            Obj mX(Z); const Obj& X = mX;
+
+            mX.appendGroup(RECS, 2, quantiles, 2, ELAPSED);
+            mX.appendGroup(RECS, 0, quantiles, 2, ELAPSED);
+            mX.appendGroup(RECS + 2, 1, quantiles + 1, 1, ELAPSED);
+            ASSERT(2 == X.numGroups());
+            ASSERT(3 == X.numRecords());
+            ASSERT(Group(RECS, 2, quantiles, 2, ELAPSED) ==
+                   X.sampleGroup(0));
+            ASSERT(Group(RECS + 2, 1, quantiles + 1, 1, ELAPSED) ==
+                   X.sampleGroup(1));
+        }
+        ASSERT(0 == defaultAllocator.numBytesInUse());
+      } break;
       case 18: {
         // --------------------------------------------------------------------
         // TESTING 'appendGroup(const balm::MetricRecord *, int, ...):
@@ -56,19 +56,26 @@ namespace {
 
 struct SampleDescription {
     // This type is used by 'collectSample' to indirectly refer to a series of
-    // records in a vector (in case the vector is resized).
+    // records, and a series of quantile records, in vectors (in case the
+    // vectors are resized).
 
     // PUBLIC DATA
     int                d_beginIndex;
     int                d_size;
+    int                d_quantileBeginIndex;
+    int                d_quantileSize;
     bsls::TimeInterval d_elapsedTime;
 
     // CREATORS
     SampleDescription(int                       beginIndex,
                       int                       size,
+                      int                       quantileBeginIndex,
+                      int                       quantileSize,
                       const bsls::TimeInterval& elapsedTime)
     : d_beginIndex(beginIndex)
     , d_size(size)
+    , d_quantileBeginIndex(quantileBeginIndex)
+    , d_quantileSize(quantileSize)
     , d_elapsedTime(elapsedTime)
     {
     }
@@ -100,14 +107,17 @@ struct MetricsManager_PublicationHelper {
         // for 'publisher' in the 'sampleCache', create one and add it to the
         // 'sampleCache'.
 
-    static void collect(bsl::vector<MetricRecord> *records,
-                        bsls::TimeInterval        *elapsedTime,
-                        MetricsManager            *manager,
-                        const Category            *category,
-                        const bsls::TimeInterval&  now,
-                        bool                       resetFlag);
+    static void collect(bsl::vector<MetricRecord>   *records,
+                        bsl::vector<QuantileRecord> *quantileRecords,
+                        bsls::TimeInterval          *elapsedTime,
+                        MetricsManager              *manager,
+                        const Category              *category,
+                        const bsls::TimeInterval&    now,
+                        bool                         resetFlag);
         // Append to the specified 'records' the metrics collected from the
-        // specified 'manager' for the specified 'category', and load into
+        // specified 'manager' for the specified 'category', append to the
+        // specified 'quantileRecords' (if not 0) the quantiles collected from
+        // the histogram collectors for 'category', and load into
         // specified 'elapsedTime' the time interval from when they were last
         // reset to the specified 'currentTime'; if 'resetFlag' is 'true',
         // reset the metrics to their default state.  This operation will
@@ -490,12 +500,13 @@ void MetricsManager_PublicationHelper::updateSampleCache(
 }
 
 void MetricsManager_PublicationHelper::collect(
-                                        bsl::vector<MetricRecord> *records,
-                                        bsls::TimeInterval        *elapsedTime,
-                                        MetricsManager            *manager,
-                                        const Category            *category,
-                                        const bsls::TimeInterval&  now,
-                                        bool                       resetFlag)
+                                  bsl::vector<MetricRecord>   *records,
+                                  bsl::vector<QuantileRecord> *quantileRecords,
+                                  bsls::TimeInterval          *elapsedTime,
+                                  MetricsManager              *manager,
+                                  const Category              *category,
+                                  const bsls::TimeInterval&    now,
+                                  bool                         resetFlag)
 {
     typedef MetricsManager::RecordsCollectionCallback Callback;
     typedef bsl::vector<const Callback *>             CBVector;
@@ -512,9 +523,11 @@ void MetricsManager_PublicationHelper::collect(
 
     // Collect records from the collector repository.
     if (resetFlag) {
-        manager->d_collectors.collectAndReset(records, category);
+        manager->d_collectors.collectAndReset(records,
+                                              quantileRecords,
+                                              category);
     } else {
-        manager->d_collectors.collect(records, category);
+        manager->d_collectors.collect(records, quantileRecords, category);
     }
 
     // Compute the elapsed time since the previous reset, and if 'resetFlag'
@@ -547,11 +560,17 @@ void MetricsManager_PublicationHelper::publish(
     }
     typedef bsl::vector<bsl::shared_ptr<bsl::vector<MetricRecord> > >
                                                                   RecordBuffer;
+    typedef bsl::vector<bsl::shared_ptr<bsl::vector<QuantileRecord> > >
+                                                                QuantileBuffer;
 
     // Iterate over the categories, storing their records in a 'RecordBuffer'
-    // and populating the samples in the 'SampleCache'.  The samples in the
-    // sample cache refer to records in the record buffer.
-    RecordBuffer recordBuffer;  // holds onto collected record vectors
+    // (and their quantile records in a 'QuantileBuffer') and populating the
+    // samples in the 'SampleCache'.  The samples in the sample cache refer to
+    // records in the record buffer.
+    RecordBuffer   recordBuffer;    // holds onto collected record vectors
+
+    QuantileBuffer quantileBuffer;  // holds onto collected quantile record
+                                    // vectors
 
     SampleCache  sampleCache;          // publisher -> sample (samples point to
                                        // records in the 'recordBuffer')
@@ -572,12 +591,20 @@ void MetricsManager_PublicationHelper::publish(
         }
         bsl::shared_ptr<bsl::vector<MetricRecord> > records;
         records.createInplace();
+        bsl::shared_ptr<bsl::vector<QuantileRecord> > quantileRecords;
+        quantileRecords.createInplace();
 
         // Hold the elapsed time over which these metrics were collected.
         bsls::TimeInterval elapsedTime;
 
         // Collect the metrics.
-        collect(records.get(), &elapsedTime, manager, *catIt, now, resetFlag);
+        collect(records.get(),
+                quantileRecords.get(),
+                &elapsedTime,
+                manager,
+                *catIt,
+                now,
+                resetFlag);
 
         // If their are no collected records then this category can be ignored.
         if (records->empty()) {
@@ -596,6 +623,15 @@ void MetricsManager_PublicationHelper::publish(
                                       static_cast<int>(records->size()),
                                       elapsedTime);
 
+        // Append the collected quantile records (if any) to the buffer of
+        // quantile records.
+        if (!quantileRecords->empty()) {
+            quantileBuffer.push_back(quantileRecords);
+            sampleGroup.setQuantileRecords(
+                                   quantileRecords->data(),
+                                   static_cast<int>(quantileRecords->size()));
+        }
+
         // Add 'sampleGroup' to all the general publishers and specific
         // publishers for 'category'.
         MetricsManager_PublisherRegistry::general_iterator gIt =
@@ -1009,6 +1045,33 @@ void MetricsManager::collectSample(MetricSample              *sample,
                                    const Category * const     categories[],
                                    int                        numCategories,
                                    bool                       resetFlag)
+{
+    collectSample(sample, records, 0, categories, numCategories, resetFlag);
+}
+
+void MetricsManager::collectSample(
+                                  MetricSample                *sample,
+                                  bsl::vector<MetricRecord>   *records,
+                                  bsl::vector<QuantileRecord> *quantileRecords,
+                                  bool                         resetFlag)
+{
+    bsl::vector<const Category *> allCategories;
+    d_metricRegistry.getAllCategories(&allCategories);
+    collectSample(sample,
+                  records,
+                  quantileRecords,
+                  allCategories.data(),
+                  static_cast<int>(allCategories.size()),
+                  resetFlag);
+}
+
+void MetricsManager::collectSample(
+                                  MetricSample                *sample,
+                                  bsl::vector<MetricRecord>   *records,
+                                  bsl::vector<QuantileRecord> *quantileRecords,
+                                  const Category * const       categories[],
+                                  int                          numCategories,
+                                  bool                         resetFlag)
 {
     bdlt::DatetimeTz   timeStamp(bdlt::CurrentTime::utc(), 0);
     bsls::TimeInterval now = bdlt::CurrentTime::now();
@@ -1016,7 +1079,7 @@ void MetricsManager::collectSample(MetricSample              *sample,
     sample->setTimeStamp(timeStamp);
 
     // We use an intermediate structure to hold indirect references into
-    // 'records' in case 'records' must be resized.
+    // 'records' (and 'quantileRecords') in case they must be resized.
     bsl::vector<SampleDescription> samples;
     samples.reserve(numCategories);
 
@@ -1033,18 +1096,33 @@ void MetricsManager::collectSample(MetricSample              *sample,
         // Hold the elapsed time over which these metrics were collected.
         bsls::TimeInterval elapsedTime;
 
-        int beginIndex = static_cast<int>(records->size());
+        int beginIndex         = static_cast<int>(records->size());
+        int quantileBeginIndex = quantileRecords
+                               ? static_cast<int>(quantileRecords->size())
+                               : 0;
 
         // Collect the metrics.
-        MetricsManager_PublicationHelper::collect(
-                     records, &elapsedTime, this, *category, now, resetFlag);
-
-        int size = static_cast<int>(records->size()) - beginIndex;
+        MetricsManager_PublicationHelper::collect(records,
+                                                  quantileRecords,
+                                                  &elapsedTime,
+                                                  this,
+                                                  *category,
+                                                  now,
+                                                  resetFlag);
+
+        int size         = static_cast<int>(records->size()) - beginIndex;
+        int quantileSize = quantileRecords
+                         ? static_cast<int>(quantileRecords->size())
+                                                          - quantileBeginIndex
+                         : 0;
 
         // If their are no collected records then this category can be ignored.
         if (0 < size) {
-            samples.push_back(
-                SampleDescription(beginIndex, size, elapsedTime));
+            samples.push_back(SampleDescription(beginIndex,
+                                                size,
+                                                quantileBeginIndex,
+                                                quantileSize,
+                                                elapsedTime));
         }
     }
 
@@ -1054,6 +1132,10 @@ void MetricsManager::collectSample(MetricSample              *sample,
     for (; it != samples.end(); ++it) {
         sample->appendGroup(&(*records)[it->d_beginIndex],
                             it->d_size,
+                            0 < it->d_quantileSize
+                            ? &(*quantileRecords)[it->d_quantileBeginIndex]
+                            : 0,
+                            it->d_quantileSize,
                             it->d_elapsedTime);
     }
 }
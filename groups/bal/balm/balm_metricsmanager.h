@@ -38,6 +38,12 @@ BSLS_IDENT("$Id: $")
 // event occurrences along with the total, minimum, and maximum aggregates of
 // the measured values.
 //
+// Metrics recorded using a 'balm::HistogramCollector' (obtained from the
+// collector repository) additionally provide estimated quantiles of the
+// measured values (e.g., the median and 99th percentile), which the metrics
+// manager supplies to publishers as 'balm::QuantileRecord' objects, alongside
+// the 'balm::MetricRecord' objects, in each 'balm::MetricSampleGroup'.
+//
 ///Thread Safety
 ///-------------
 // 'balm::MetricsManager' is fully *thread-safe*, meaning that all non-creator
@@ -671,6 +677,35 @@ class MetricsManager {
         // *addresses* of the metric records appended to 'records', and
         // modifying 'records' after this call returns may invalidate 'sample'.
 
+    void collectSample(MetricSample                *sample,
+                       bsl::vector<MetricRecord>   *records,
+                       bsl::vector<QuantileRecord> *quantileRecords,
+                       bool                         resetFlag = false);
+    void collectSample(MetricSample                *sample,
+                       bsl::vector<MetricRecord>   *records,
+                       bsl::vector<QuantileRecord> *quantileRecords,
+                       const Category      * const  categories[],
+                       int                          numCategories,
+                       bool                         resetFlag = false);
+        // Load into the specified 'sample' a metric sample collected from the
+        // indicated categories, append to 'records' those collected records
+        // which are referred to by 'sample', and append to the specified
+        // 'quantileRecords' the quantiles collected for those metrics
+        // (recorded using a 'HistogramCollector') which are referred to by
+        // 'sample'.  Optionally specify a sequence of 'categories' of length
+        // 'numCategories'.  If a sequence of categories is not supplied, a
+        // sample is collected from all registered categories.  Optionally
+        // specify a 'resetFlag' that determines if the collected metrics are
+        // reset as part of this operation.  This operation is otherwise
+        // identical to the 'collectSample' overloads that do not take
+        // 'quantileRecords'.  The behavior is undefined unless
+        // '0 <= numCategories', 'categories' refers to a contiguous sequence
+        // of (at least) 'numCategories', and each category in 'categories'
+        // appears only once.  Note that 'sample' is loaded with the
+        // *addresses* of the records appended to 'records' and
+        // 'quantileRecords', and modifying either vector after this call
+        // returns may invalidate 'sample'.
+
     void publish(const Category *category, bool resetFlag = true);
         // Publish metrics associated with the specified 'category' if
         // 'category' is enabled; otherwise (if 'category' is not enabled)
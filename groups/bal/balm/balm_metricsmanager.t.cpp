@@ -105,6 +105,8 @@ using bsl::flush;
 //                          const balm::Category            *[],
 //                          int                             ,
 //                          bool                            );
+// [26]  void collectSample(MS *, v<MR> *, v<QR> *, bool);
+// [26]  void collectSample(MS *, v<MR> *, v<QR> *, const C *[], int, bool);
 // [10]  void publish(const balm::Category  *, const bsls::TimeInterval& );
 // [ 8]  void publish(const balm::Category *[], int, const TimeInterval& );
 // [ 9]  void publish(const bsl::set<const balm::Category *>& ,
@@ -135,7 +137,7 @@ using bsl::flush;
 // [21] BSLMA ALLOCATION EXCEPTION TEST: publish
 // [23] TESTING: 'publish' with 'resetFlag'
 // [25] CONCURRENCY TEST
-// [26] USAGE EXAMPLE
+// [27] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -728,6 +730,74 @@ bool TestPublisher::contains(const balm::MetricId& id) const
     return indexOf(id) != -1;
 }
 
+                         // =======================
+                         // class QuantilePublisher
+                         // =======================
+
+class QuantilePublisher : public balm::Publisher {
+    // This class defines a test implementation of the 'balm::Publisher'
+    // protocol that records copies of the metric records, and of the quantile
+    // records, of the last published sample.  Note that the 'publish' method
+    // is *not* thread-safe.
+
+    // DATA
+    bsl::vector<balm::MetricRecord>   d_records;          // last records
+
+    bsl::vector<balm::QuantileRecord> d_quantileRecords;  // last quantile
+                                                          // records
+
+    // NOT IMPLEMENTED
+    QuantilePublisher(const QuantilePublisher& );
+    QuantilePublisher& operator=(const QuantilePublisher& );
+
+  public:
+    // CREATORS
+    explicit QuantilePublisher(bslma::Allocator *allocator)
+        // Create a test publisher using the specified 'allocator' to supply
+        // memory.
+    : d_records(allocator)
+    , d_quantileRecords(allocator)
+    {
+    }
+
+    virtual ~QuantilePublisher()
+        // Destroy this test publisher.
+    {
+    }
+
+    // MANIPULATORS
+    virtual void publish(const balm::MetricSample& sample)
+        // Set 'records()' and 'quantileRecords()' to copies of the metric
+        // records and quantile records referred to by the specified 'sample'.
+    {
+        d_records.clear();
+        d_quantileRecords.clear();
+        balm::MetricSample::const_iterator it = sample.begin();
+        for (; it != sample.end(); ++it) {
+            d_records.insert(d_records.end(), it->begin(), it->end());
+            d_quantileRecords.insert(
+                        d_quantileRecords.end(),
+                        it->quantileRecords(),
+                        it->quantileRecords() + it->numQuantileRecords());
+        }
+    }
+
+    // ACCESSORS
+    const bsl::vector<balm::MetricRecord>& records() const
+        // Return a reference to the non-modifiable metric records of the last
+        // published sample.
+    {
+        return d_records;
+    }
+
+    const bsl::vector<balm::QuantileRecord>& quantileRecords() const
+        // Return a reference to the non-modifiable quantile records of the
+        // last published sample.
+    {
+        return d_quantileRecords;
+    }
+};
+
                          // =========================
                          // class CombinationIterator
                          // =========================
@@ -1477,7 +1547,7 @@ int main(int argc, char *argv[])
     bdlt::CurrentTime::now();
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 26: {
+      case 27: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -1570,6 +1640,172 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING: quantiles
+        //
+        // Concerns:
+        //: 1 'publish' supplies publishers with the quantile records of the
+        //:   metrics recorded using histogram collectors, and with no quantile
+        //:   records for other metrics.
+        //:
+        //: 2 The metric record of a metric recorded using histogram
+        //:   collectors reflects the values recorded by those collectors.
+        //:
+        //: 3 'collectSample' with a vector of quantile records loads a sample
+        //:   whose groups refer to the quantile records appended to that
+        //:   vector, and the other 'collectSample' overloads ignore
+        //:   quantiles.
+        //
+        // Plan:
+        //: 1 Record values using histogram and integer collectors in several
+        //:   categories, publish them, and verify the records supplied to a
+        //:   publisher.  (C-1..2)
+        //:
+        //: 2 Record values using histogram collectors, collect a sample with
+        //:   and without a vector of quantile records, and verify the sample
+        //:   groups.  (C-3)
+        //
+        // Testing:
+        //   void collectSample(MS *, v<MR> *, v<QR> *, bool);
+        //   void collectSample(MS *, v<MR> *, v<QR> *, const C *[], int, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING: quantiles" << endl
+                                  << "==================" << endl;
+
+        if (veryVerbose) cout << "\tTest 'publish'." << endl;
+        {
+            Obj         mX(Z);
+            Repository& rep = mX.collectorRepository();
+            Registry&   reg = mX.metricRegistry();
+
+            bsl::shared_ptr<QuantilePublisher> publisher;
+            publisher.createInplace(Z, Z);
+            mX.addGeneralPublisher(publisher);
+
+            balm::HistogramCollector *hA =
+                                   rep.getDefaultHistogramCollector("A", "H");
+            balm::HistogramCollector *hB =
+                                   rep.getDefaultHistogramCollector("B", "H");
+            rep.getDefaultIntegerCollector("A", "I")->update(5);
+            rep.getDefaultIntegerCollector("C", "I")->update(6);
+
+            for (int i = 1; i <= 100; ++i) {
+                hA->update(i);
+            }
+            hB->update(7);
+
+            mX.publishAll();
+
+            const bsl::vector<balm::MetricRecord>&   R =
+                                                       publisher->records();
+            const bsl::vector<balm::QuantileRecord>& Q =
+                                               publisher->quantileRecords();
+
+            ASSERTV(R.size(), 4 == R.size());
+            ASSERTV(Q.size(), 2 == Q.size());
+
+            for (bsl::size_t i = 0; i < R.size(); ++i) {
+                if (reg.getId("A", "H") == R[i].metricId()) {
+                    ASSERTV(R[i].count(), 100    == R[i].count());
+                    ASSERTV(R[i].total(), 5050.0 == R[i].total());
+                    ASSERTV(R[i].min(),   1.0    == R[i].min());
+                    ASSERTV(R[i].max(),   100.0  == R[i].max());
+                }
+            }
+            for (bsl::size_t i = 0; i < Q.size(); ++i) {
+                if (reg.getId("A", "H") == Q[i].metricId()) {
+                    ASSERTV(Q[i].count(),    100   == Q[i].count());
+                    ASSERTV(Q[i].value(0),   50.0  <= Q[i].value(0));
+                    ASSERTV(Q[i].value(0),   52.0  >= Q[i].value(0));
+                    ASSERTV(Q[i].value(3),   100.0 == Q[i].value(3));
+                }
+                else {
+                    ASSERTV(reg.getId("B", "H") == Q[i].metricId());
+                    ASSERTV(Q[i].count(),    1   == Q[i].count());
+                    ASSERTV(Q[i].value(0),   7.0 == Q[i].value(0));
+                }
+            }
+
+            // The collectors were reset by 'publishAll'.
+
+            mX.publishAll();
+            ASSERTV(R.size(), 4 == R.size());
+            ASSERTV(Q.size(), 2 == Q.size());
+            for (bsl::size_t i = 0; i < Q.size(); ++i) {
+                ASSERTV(i, 0 == Q[i].count());
+            }
+        }
+
+        if (veryVerbose) cout << "\tTest 'collectSample'." << endl;
+        {
+            Obj         mX(Z);
+            Repository& rep = mX.collectorRepository();
+
+            rep.getDefaultHistogramCollector("A", "H")->update(3);
+            rep.getDefaultHistogramCollector("B", "H")->update(4);
+            rep.getDefaultIntegerCollector("C", "I")->update(5);
+
+            const Category *CATEGORIES[] = {
+                mX.metricRegistry().getCategory("A"),
+                mX.metricRegistry().getCategory("C"),
+                mX.metricRegistry().getCategory("B"),
+            };
+
+            for (int i = 0; i < 3; ++i) {
+                balm::MetricSample                sample(Z);
+                bsl::vector<balm::MetricRecord>   records(Z);
+                bsl::vector<balm::QuantileRecord> quantiles(Z);
+
+                switch (i) {
+                  case 0: {
+                    mX.collectSample(&sample, &records, CATEGORIES, 3);
+                  } break;
+                  case 1: {
+                    mX.collectSample(&sample,
+                                     &records,
+                                     &quantiles,
+                                     CATEGORIES,
+                                     3);
+                  } break;
+                  default: {
+                    mX.collectSample(&sample, &records, &quantiles, true);
+                  }
+                }
+
+                ASSERTV(i, sample.numGroups(), 3 == sample.numGroups());
+                ASSERTV(i, records.size(),     3 == records.size());
+                ASSERTV(i, quantiles.size(),
+                        (0 == i ? 0 : 2) == quantiles.size());
+
+                int numQuantileRecords = 0;
+                for (int j = 0; j < sample.numGroups(); ++j) {
+                    const balm::MetricSampleGroup& G = sample.sampleGroup(j);
+                    ASSERTV(i, j, 1 == G.numRecords());
+                    numQuantileRecords += G.numQuantileRecords();
+                    if (0 == G.numQuantileRecords()) {
+                        ASSERTV(i, j, 0 == G.quantileRecords());
+                        continue;
+                    }
+                    ASSERTV(i, j, 1 == G.numQuantileRecords());
+                    ASSERTV(i, j, G.records()->metricId() ==
+                                        G.quantileRecords()->metricId());
+                    ASSERTV(i, j, G.records()->max() ==
+                                        G.quantileRecords()->value(0));
+                }
+                ASSERTV(i, numQuantileRecords,
+                        static_cast<int>(quantiles.size()) ==
+                                                        numQuantileRecords);
+            }
+
+            // The final 'collectSample' reset the collectors.
+
+            balm::MetricRecord record;
+            rep.getDefaultHistogramCollector("A", "H")->load(&record);
+            ASSERT(0 == record.count());
+        }
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // CONCURRENCY TEST
@@ -0,0 +1,79 @@
+// balm_quantilerecord.cpp                                            -*-C++-*-
+#include <balm_quantilerecord.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_quantilerecord_cpp,"$Id$ $CSID$")
+
+#include <bslmf_assert.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+
+namespace {
+
+const double k_QUANTILES[] = { 0.5, 0.9, 0.99, 0.999 };
+
+const char *const k_QUANTILE_NAMES[] = { "p50", "p90", "p99", "p99.9" };
+
+BSLMF_ASSERT(balm::QuantileRecord::k_NUM_QUANTILES ==
+                                   sizeof k_QUANTILES / sizeof *k_QUANTILES);
+BSLMF_ASSERT(balm::QuantileRecord::k_NUM_QUANTILES ==
+                         sizeof k_QUANTILE_NAMES / sizeof *k_QUANTILE_NAMES);
+
+}  // close unnamed namespace
+
+namespace balm {
+
+                            // --------------------
+                            // class QuantileRecord
+                            // --------------------
+
+// CLASS METHODS
+double QuantileRecord::quantile(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_QUANTILES);
+
+    return k_QUANTILES[index];
+}
+
+const char *QuantileRecord::quantileName(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_QUANTILES);
+
+    return k_QUANTILE_NAMES[index];
+}
+
+// ACCESSORS
+bsl::ostream& QuantileRecord::print(bsl::ostream& stream) const
+{
+    stream << "[ " << d_metricId << ": " << d_count;
+    for (int i = 0; i < k_NUM_QUANTILES; ++i) {
+        stream << " " << k_QUANTILE_NAMES[i] << "=" << d_values[i];
+    }
+    stream << " ]";
+    return stream;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,376 @@
+// balm_quantilerecord.h                                              -*-C++-*-
+#ifndef INCLUDED_BALM_QUANTILERECORD
+#define INCLUDED_BALM_QUANTILERECORD
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a record of the quantiles of the values of a metric.
+//
+//@CLASSES:
+//   balm::QuantileRecord: a record of the quantiles of a metric's values
+//
+//@SEE_ALSO: balm_metricrecord, balm_histogramcollector, balm_metricsample
+//
+//@DESCRIPTION: This component implements an unconstrained pure-attribute class
+// used to represent the distribution of the values recorded for a metric.
+// Where a 'balm::MetricRecord' summarizes the recorded values of a metric by
+// their count, total, minimum, and maximum, a 'balm::QuantileRecord' reports
+// the values at a fixed set of quantiles (the median, and the 90th, 99th, and
+// 99.9th percentiles) of those recorded values.  Quantile records are
+// typically produced by a 'balm::HistogramCollector', and are published
+// alongside the metric records for the same metric (see 'balm_metricsample').
+// The attributes held by 'balm::QuantileRecord' are given in the following
+// table:
+//..
+//  Attribute      Type              Description                  Default
+//  ----------   --------------   --------------------------      ----------
+//   metricId     balm::MetricId   identifies the metric           invalid id
+//   count        int              count of metric values          0
+//   value(i)     double           value at the 'i'th quantile     0.0
+//..
+// The quantile reported by 'value(i)' is given by the class method
+// 'quantile(i)', and a short name for it (e.g., "p99") by 'quantileName(i)',
+// for each 'i' in the range '[0 .. k_NUM_QUANTILES - 1]':
+//..
+//  Index   quantile(i)   quantileName(i)
+//  -----   -----------   ---------------
+//    0       0.5           "p50"
+//    1       0.9           "p90"
+//    2       0.99          "p99"
+//    3       0.999         "p99.9"
+//..
+// Note that the quantile values of a record whose 'count' is 0 are not
+// meaningful.
+//
+///Thread Safety
+///-------------
+// 'balm::QuantileRecord' is *const* *thread-safe*, meaning that accessors may
+// be invoked concurrently from different threads, but it is not safe to access
+// or modify a 'balm::QuantileRecord' in one thread while another thread
+// modifies the same object.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reporting Latency Percentiles
+/// - - - - - - - - - - - - - - - - - - - -
+// In this example we populate a 'balm::QuantileRecord' by hand and print the
+// values it reports.  In practice, quantile records are populated by a
+// 'balm::HistogramCollector'.  We start by creating a 'balm::MetricId' object
+// by hand, but in practice, an id should be obtained from a
+// 'balm::MetricRegistry' object (such as the one owned by a
+// 'balm::MetricsManager'):
+//..
+//  balm::Category           myCategory("MyCategory");
+//  balm::MetricDescription  description(&myCategory, "RequestLatency");
+//  balm::MetricId           latencyId(&description);
+//..
+// Then, we create a quantile record describing 1000 request latencies (in
+// microseconds):
+//..
+//  balm::QuantileRecord record(latencyId);
+//
+//  record.count()    = 1000;
+//  record.value(0)   =  120;   // median
+//  record.value(1)   =  250;   // 90th percentile
+//  record.value(2)   =  900;   // 99th percentile
+//  record.value(3)   = 4000;   // 99.9th percentile
+//..
+// Finally, we iterate over the quantiles and write each one to 'bsl::cout':
+//..
+//  for (int i = 0; i < balm::QuantileRecord::k_NUM_QUANTILES; ++i) {
+//      bsl::cout << balm::QuantileRecord::quantileName(i) << " = "
+//                << record.value(i) << bsl::endl;
+//  }
+//..
+// The resulting output will be:
+//..
+//  p50 = 120
+//  p90 = 250
+//  p99 = 900
+//  p99.9 = 4000
+//..
+
+#ifndef INCLUDED_BALSCM_VERSION
+#include <balscm_version.h>
+#endif
+
+#ifndef INCLUDED_BALM_METRICID
+#include <balm_metricid.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSL_IOSFWD
+#include <bsl_iosfwd.h>
+#endif
+
+namespace BloombergLP {
+namespace balm {
+
+                            // ====================
+                            // class QuantileRecord
+                            // ====================
+
+class QuantileRecord {
+    // Each instance of this class represents the values at a fixed set of
+    // quantiles of the values recorded for a metric.  A quantile record
+    // contains a 'MetricId' object (identifying the metric), the number of
+    // values from which the quantiles were computed, and the value at each of
+    // the quantiles reported by 'quantile'.  The default 'metricId' is the
+    // invalid id value, the default 'count' is 0, and the default value at
+    // each quantile is 0.0.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_NUM_QUANTILES = 4  // number of quantiles in a record
+    };
+
+  private:
+    // DATA
+    MetricId d_metricId;                  // id for the metric
+    int      d_count;                     // number of values
+    double   d_values[k_NUM_QUANTILES];   // value at each quantile
+
+  public:
+    // CLASS METHODS
+    static double quantile(int index);
+        // Return the quantile (in the range '(0.0 .. 1.0)') whose value is
+        // reported by 'value(index)'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_QUANTILES'.
+
+    static const char *quantileName(int index);
+        // Return the address of a null-terminated string providing a short
+        // name (e.g., "p99") for the quantile reported by 'value(index)'.
+        // The behavior is undefined unless '0 <= index < k_NUM_QUANTILES'.
+
+    // CREATORS
+    QuantileRecord();
+        // Create a quantile record having the invalid 'metricId', a 'count'
+        // of 0, and the value 0.0 at each quantile.
+
+    explicit QuantileRecord(const MetricId& metricId);
+        // Create a quantile record having the specified 'metricId', a
+        // 'count' of 0, and the value 0.0 at each quantile.
+
+    QuantileRecord(const QuantileRecord& original);
+        // Create a quantile record having the value of the specified
+        // 'original' record.
+
+    // ~QuantileRecord() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    QuantileRecord& operator=(const QuantileRecord& rhs);
+        // Assign to this quantile record the value of the specified 'rhs'
+        // record, and return a reference to this modifiable record.
+
+    MetricId& metricId();
+        // Return a reference to the modifiable 'metricId' attribute
+        // representing the identifier for the metric being recorded.
+
+    int& count();
+        // Return a reference to the modifiable 'count' attribute representing
+        // the number of values from which the quantiles were computed.
+
+    double& value(int index);
+        // Return a reference to the modifiable value at the quantile
+        // 'quantile(index)' for the specified 'index'.  The behavior is
+        // undefined unless '0 <= index < k_NUM_QUANTILES'.
+
+    void reset();
+        // Reset the 'count' of this record to 0, and the value at each
+        // quantile to 0.0.  Note that 'metricId' is not modified.
+
+    // ACCESSORS
+    const MetricId& metricId() const;
+        // Return a reference to the non-modifiable 'metricId' attribute
+        // representing the identifier for the metric being recorded.
+
+    const int& count() const;
+        // Return a reference to the non-modifiable 'count' attribute
+        // representing the number of values from which the quantiles were
+        // computed.
+
+    const double& value(int index) const;
+        // Return a reference to the non-modifiable value at the quantile
+        // 'quantile(index)' for the specified 'index'.  The behavior is
+        // undefined unless '0 <= index < k_NUM_QUANTILES'.
+
+    bsl::ostream& print(bsl::ostream& stream) const;
+        // Write a description of this record to the specified 'stream' and
+        // return a reference to the modifiable 'stream'.
+};
+
+// FREE OPERATORS
+bool operator==(const QuantileRecord& lhs, const QuantileRecord& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' quantile records have the
+    // same value and 'false' otherwise.  Two records have the same value if
+    // they have the same values for their 'metricId' and 'count' attributes,
+    // and the same value at each quantile.
+
+bool operator!=(const QuantileRecord& lhs, const QuantileRecord& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' quantile records do not
+    // have the same value and 'false' otherwise.  Two records do not have the
+    // same value if they differ in their respective values for 'metricId' or
+    // 'count', or in their value at any quantile.
+
+bsl::ostream& operator<<(bsl::ostream& stream, const QuantileRecord& record);
+    // Write a formatted description of the specified 'record' to the specified
+    // 'stream' and return a reference to the modifiable 'stream'.
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                            // --------------------
+                            // class QuantileRecord
+                            // --------------------
+
+// CREATORS
+inline
+QuantileRecord::QuantileRecord()
+: d_metricId()
+, d_count(0)
+{
+    reset();
+}
+
+inline
+QuantileRecord::QuantileRecord(const MetricId& metricId)
+: d_metricId(metricId)
+, d_count(0)
+{
+    reset();
+}
+
+inline
+QuantileRecord::QuantileRecord(const QuantileRecord& original)
+: d_metricId(original.d_metricId)
+, d_count(original.d_count)
+{
+    for (int i = 0; i < k_NUM_QUANTILES; ++i) {
+        d_values[i] = original.d_values[i];
+    }
+}
+
+// MANIPULATORS
+inline
+QuantileRecord& QuantileRecord::operator=(const QuantileRecord& rhs)
+{
+    d_metricId = rhs.d_metricId;
+    d_count    = rhs.d_count;
+    for (int i = 0; i < k_NUM_QUANTILES; ++i) {
+        d_values[i] = rhs.d_values[i];
+    }
+    return *this;
+}
+
+inline
+MetricId& QuantileRecord::metricId()
+{
+    return d_metricId;
+}
+
+inline
+int& QuantileRecord::count()
+{
+    return d_count;
+}
+
+inline
+double& QuantileRecord::value(int index)
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < k_NUM_QUANTILES);
+
+    return d_values[index];
+}
+
+inline
+void QuantileRecord::reset()
+{
+    d_count = 0;
+    for (int i = 0; i < k_NUM_QUANTILES; ++i) {
+        d_values[i] = 0.0;
+    }
+}
+
+// ACCESSORS
+inline
+const MetricId& QuantileRecord::metricId() const
+{
+    return d_metricId;
+}
+
+inline
+const int& QuantileRecord::count() const
+{
+    return d_count;
+}
+
+inline
+const double& QuantileRecord::value(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < k_NUM_QUANTILES);
+
+    return d_values[index];
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool balm::operator==(const QuantileRecord& lhs, const QuantileRecord& rhs)
+{
+    if (lhs.metricId() != rhs.metricId() || lhs.count() != rhs.count()) {
+        return false;                                                 // RETURN
+    }
+    for (int i = 0; i < QuantileRecord::k_NUM_QUANTILES; ++i) {
+        if (lhs.value(i) != rhs.value(i)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+inline
+bool balm::operator!=(const QuantileRecord& lhs, const QuantileRecord& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline
+bsl::ostream& balm::operator<<(bsl::ostream&         stream,
+                               const QuantileRecord& record)
+{
+    return record.print(stream);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,515 @@
+// balm_quantilerecord.t.cpp                                          -*-C++-*-
+#include <balm_quantilerecord.h>
+
+#include <balm_category.h>
+#include <balm_metricdescription.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The 'balm::QuantileRecord' is a simple value object holding properties that
+// can be written and accessed freely, i.e., there are no constraints placed
+// upon their values.  Ensure the attributes can be set and read, that the
+// class methods describe the expected quantiles, and that the value-semantic
+// operations behave as expected.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3]  static double quantile(int index);
+// [ 3]  static const char *quantileName(int index);
+//
+// CREATORS
+// [ 2]  balm::QuantileRecord();
+// [ 2]  balm::QuantileRecord(const balm::MetricId& metricId);
+// [ 4]  balm::QuantileRecord(const balm::QuantileRecord& original);
+//
+// MANIPULATORS
+// [ 4]  balm::QuantileRecord& operator=(const balm::QuantileRecord& rhs);
+// [ 2]  balm::MetricId& metricId();
+// [ 2]  int& count();
+// [ 2]  double& value(int index);
+// [ 2]  void reset();
+//
+// ACCESSORS
+// [ 2]  const balm::MetricId& metricId() const;
+// [ 2]  const int& count() const;
+// [ 2]  const double& value(int index) const;
+// [ 5]  bsl::ostream& print(bsl::ostream& stream) const;
+//
+// FREE OPERATORS
+// [ 4]  bool operator==(const balm::QuantileRecord& lhs, rhs);
+// [ 4]  bool operator!=(const balm::QuantileRecord& lhs, rhs);
+// [ 5]  bsl::ostream& operator<<(bsl::ostream&, const balm::QuantileRecord&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        bsl::cout << "Error " << __FILE__ << "(" << i << "): " << s
+                  << "    (failed)" << bsl::endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::QuantileRecord    Obj;
+typedef balm::MetricDescription Desc;
+typedef balm::MetricId          Id;
+
+const int NUM_QUANTILES = Obj::k_NUM_QUANTILES;
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+
+    (void)veryVerbose;
+
+    bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;
+
+    balm::Category cat_A("A", true);
+    Desc desc_A(&cat_A, "A"); const Desc *DESC_A = &desc_A;
+    Desc desc_B(&cat_A, "B"); const Desc *DESC_B = &desc_B;
+
+    Id metric_A(DESC_A); const Id& METRIC_A = metric_A;
+    Id metric_B(DESC_B); const Id& METRIC_B = metric_B;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file must
+        //:   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Usage Example"
+                          << "\n=====================" << endl;
+
+        bsl::ostringstream out;
+
+///Example 1: Reporting Latency Percentiles
+/// - - - - - - - - - - - - - - - - - - - -
+// In this example we populate a 'balm::QuantileRecord' by hand and print the
+// values it reports.  In practice, quantile records are populated by a
+// 'balm::HistogramCollector'.  We start by creating a 'balm::MetricId' object
+// by hand, but in practice, an id should be obtained from a
+// 'balm::MetricRegistry' object (such as the one owned by a
+// 'balm::MetricsManager'):
+//..
+    balm::Category           myCategory("MyCategory");
+    balm::MetricDescription  description(&myCategory, "RequestLatency");
+    balm::MetricId           latencyId(&description);
+//..
+// Then, we create a quantile record describing 1000 request latencies (in
+// microseconds):
+//..
+    balm::QuantileRecord record(latencyId);
+
+    record.count()    = 1000;
+    record.value(0)   =  120;   // median
+    record.value(1)   =  250;   // 90th percentile
+    record.value(2)   =  900;   // 99th percentile
+    record.value(3)   = 4000;   // 99.9th percentile
+//..
+// Finally, we iterate over the quantiles and write each one to 'bsl::cout':
+//..
+    for (int i = 0; i < balm::QuantileRecord::k_NUM_QUANTILES; ++i) {
+        out << balm::QuantileRecord::quantileName(i) << " = "
+            << record.value(i) << bsl::endl;
+    }
+//..
+// The resulting output will be:
+//..
+//  p50 = 120
+//  p90 = 250
+//  p99 = 900
+//  p99.9 = 4000
+//..
+
+        ASSERTV(out.str(),
+                "p50 = 120\np90 = 250\np99 = 900\np99.9 = 4000\n" ==
+                                                                   out.str());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING PRINT AND OUTPUT OPERATOR
+        //
+        // Concerns:
+        //: 1 'print' and 'operator<<' write the metric id, the count, and the
+        //:   name and value of each quantile.
+        //
+        // Plan:
+        //: 1 Print a record having known attribute values to a string stream
+        //:   and compare the result to the expected output.  (C-1)
+        //
+        // Testing:
+        //   bsl::ostream& print(bsl::ostream& stream) const;
+        //   bsl::ostream& operator<<(bsl::ostream&, const QuantileRecord&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING PRINT AND OUTPUT OPERATOR" << endl
+                          << "=================================" << endl;
+
+        Obj mX(METRIC_A); const Obj& X = mX;
+        mX.count() = 10;
+        for (int i = 0; i < NUM_QUANTILES; ++i) {
+            mX.value(i) = i + 1;
+        }
+
+        bsl::ostringstream idStream;
+        idStream << METRIC_A;
+
+        const bsl::string EXPECTED = "[ " + idStream.str() +
+                                     ": 10 p50=1 p90=2 p99=3 p99.9=4 ]";
+
+        bsl::ostringstream out1, out2;
+        X.print(out1);
+        out2 << X;
+
+        ASSERTV(out1.str(), EXPECTED == out1.str());
+        ASSERTV(out2.str(), EXPECTED == out2.str());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING COPY CONSTRUCTOR, ASSIGNMENT, AND EQUALITY OPERATORS
+        //
+        // Concerns:
+        //: 1 Two records compare equal if and only if their metric ids,
+        //:   counts, and the values at each quantile are equal.
+        //:
+        //: 2 The copy constructor and assignment operator copy every
+        //:   attribute.
+        //
+        // Plan:
+        //: 1 Create a set of records that each differ from a reference record
+        //:   in a single attribute and verify that they compare unequal to
+        //:   the reference and to each other.  (C-1)
+        //:
+        //: 2 Copy construct and assign each record, and verify the result
+        //:   compares equal to the original.  (C-2)
+        //
+        // Testing:
+        //   balm::QuantileRecord(const balm::QuantileRecord& original);
+        //   balm::QuantileRecord& operator=(const balm::QuantileRecord& rhs);
+        //   bool operator==(const balm::QuantileRecord& lhs, rhs);
+        //   bool operator!=(const balm::QuantileRecord& lhs, rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING COPY, ASSIGNMENT, AND EQUALITY"
+                          << endl << "======================================"
+                          << endl;
+
+        enum { k_NUM_VALUES = 3 + Obj::k_NUM_QUANTILES };
+
+        Obj values[k_NUM_VALUES];
+        for (int i = 0; i < k_NUM_VALUES; ++i) {
+            Obj& value = values[i];
+            value.metricId() = METRIC_A;
+            value.count()    = 100;
+            for (int j = 0; j < NUM_QUANTILES; ++j) {
+                value.value(j) = 10.0 * (j + 1);
+            }
+        }
+        values[1].metricId() = METRIC_B;
+        values[2].count()    = 101;
+        for (int j = 0; j < NUM_QUANTILES; ++j) {
+            values[3 + j].value(j) += 0.5;
+        }
+
+        for (int i = 0; i < k_NUM_VALUES; ++i) {
+            for (int j = 0; j < k_NUM_VALUES; ++j) {
+                const Obj& U = values[i];
+                const Obj& V = values[j];
+                ASSERTV(i, j, (i == j) == (U == V));
+                ASSERTV(i, j, (i != j) == (U != V));
+            }
+
+            const Obj X(values[i]);
+            ASSERTV(i, values[i] == X);
+
+            Obj mY; const Obj& Y = mY;
+            ASSERTV(i, Y != X);
+            mY = X;
+            ASSERTV(i, values[i] == Y);
+
+            mY = Y;
+            ASSERTV(i, values[i] == Y);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING CLASS METHODS
+        //
+        // Concerns:
+        //: 1 'quantile' returns the documented, strictly increasing, sequence
+        //:   of quantiles in the range '(0.0 .. 1.0)'.
+        //:
+        //: 2 'quantileName' returns the documented names.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Compare the results of 'quantile' and 'quantileName' for each
+        //:   index with a table of expected values.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid indices (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-3)
+        //
+        // Testing:
+        //   static double quantile(int index);
+        //   static const char *quantileName(int index);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING CLASS METHODS"
+                          << endl << "=====================" << endl;
+
+        const struct {
+            double      d_quantile;
+            const char *d_name;
+        } DATA[] = {
+            { 0.5,   "p50"   },
+            { 0.9,   "p90"   },
+            { 0.99,  "p99"   },
+            { 0.999, "p99.9" },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        ASSERT(NUM_QUANTILES == NUM_DATA);
+
+        double prev = 0.0;
+        for (int i = 0; i < NUM_DATA; ++i) {
+            ASSERTV(i, DATA[i].d_quantile == Obj::quantile(i));
+            ASSERTV(i, 0 == bsl::strcmp(DATA[i].d_name,
+                                        Obj::quantileName(i)));
+            ASSERTV(i, prev < Obj::quantile(i));
+            ASSERTV(i, 1.0  > Obj::quantile(i));
+            prev = Obj::quantile(i);
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj::quantile(0));
+            ASSERT_PASS(Obj::quantile(NUM_QUANTILES - 1));
+            ASSERT_FAIL(Obj::quantile(-1));
+            ASSERT_FAIL(Obj::quantile(NUM_QUANTILES));
+
+            ASSERT_PASS(Obj::quantileName(0));
+            ASSERT_FAIL(Obj::quantileName(-1));
+            ASSERT_FAIL(Obj::quantileName(NUM_QUANTILES));
+
+            Obj mX;
+            ASSERT_SAFE_PASS(mX.value(0));
+            ASSERT_SAFE_FAIL(mX.value(-1));
+            ASSERT_SAFE_FAIL(mX.value(NUM_QUANTILES));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS, MANIPULATORS, AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed record has the invalid metric id, a count
+        //:   of 0, and the value 0.0 at each quantile.
+        //:
+        //: 2 A record constructed from a metric id has that metric id, and
+        //:   otherwise default attributes.
+        //:
+        //: 3 Each attribute can be independently set and read.
+        //:
+        //: 4 'reset' restores the default count and quantile values, but
+        //:   does not modify the metric id.
+        //
+        // Plan:
+        //: 1 Construct records and verify their attributes.  (C-1..2)
+        //:
+        //: 2 Set each attribute in turn and verify that only that attribute
+        //:   changes.  (C-3)
+        //:
+        //: 3 Call 'reset' and verify the resulting attributes.  (C-4)
+        //
+        // Testing:
+        //   balm::QuantileRecord();
+        //   balm::QuantileRecord(const balm::MetricId& metricId);
+        //   balm::MetricId& metricId();
+        //   int& count();
+        //   double& value(int index);
+        //   void reset();
+        //   const balm::MetricId& metricId() const;
+        //   const int& count() const;
+        //   const double& value(int index) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING CREATORS AND ATTRIBUTES"
+                          << endl << "===============================" << endl;
+
+        Obj mX; const Obj& X = mX;
+        ASSERT(Id() == X.metricId());
+        ASSERT(0    == X.count());
+        for (int i = 0; i < NUM_QUANTILES; ++i) {
+            ASSERTV(i, 0.0 == X.value(i));
+        }
+
+        Obj mY(METRIC_A); const Obj& Y = mY;
+        ASSERT(METRIC_A == Y.metricId());
+        ASSERT(0        == Y.count());
+        for (int i = 0; i < NUM_QUANTILES; ++i) {
+            ASSERTV(i, 0.0 == Y.value(i));
+        }
+
+        mX.metricId() = METRIC_B;
+        ASSERT(METRIC_B == X.metricId());
+        ASSERT(0        == X.count());
+
+        mX.count() = 42;
+        ASSERT(METRIC_B == X.metricId());
+        ASSERT(42       == X.count());
+
+        for (int i = 0; i < NUM_QUANTILES; ++i) {
+            mX.value(i) = 1.5 * (i + 1);
+            for (int j = 0; j < NUM_QUANTILES; ++j) {
+                ASSERTV(i, j, (j <= i ? 1.5 * (j + 1) : 0.0) == X.value(j));
+            }
+        }
+
+        mX.reset();
+        ASSERT(METRIC_B == X.metricId());
+        ASSERT(0        == X.count());
+        for (int i = 0; i < NUM_QUANTILES; ++i) {
+            ASSERTV(i, 0.0 == X.value(i));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST:
+        //   Developers' Sandbox.
+        //
+        // Plan:
+        //   Perform ad-hoc test of the primary modifiers and accessors.
+        //
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(METRIC_A); const Obj& X = mX;
+        Obj mY(METRIC_B); const Obj& Y = mY;
+
+        ASSERT(X != Y);
+
+        mX.count()  = 3;
+        mX.value(0) = 5.0;
+        mX.value(3) = 9.0;
+
+        mY = X;
+        ASSERT(X == Y);
+        ASSERT(3   == Y.count());
+        ASSERT(5.0 == Y.value(0));
+        ASSERT(0.0 == Y.value(1));
+        ASSERT(9.0 == Y.value(3));
+
+        if (veryVerbose) {
+            P(X);
+        }
+      } break;
+      default: {
+        cout << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cout << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,174 @@
+// balm_shardedintegercollector.cpp                                   -*-C++-*-
+#include <balm_shardedintegercollector.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_shardedintegercollector_cpp,"$Id$ $CSID$")
+
+#include <bslmt_threadutil.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_new.h>
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#include <sched.h>
+#endif
+
+namespace BloombergLP {
+
+                     // -----------------------------------
+                     // class balm::ShardedIntegerCollector
+                     // -----------------------------------
+
+// PUBLIC CONSTANTS
+const int balm::ShardedIntegerCollector::k_DEFAULT_MIN = INT_MAX;
+const int balm::ShardedIntegerCollector::k_DEFAULT_MAX = INT_MIN;
+
+namespace balm {
+
+// PRIVATE CLASS METHODS
+int ShardedIntegerCollector::currentShardIndex()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    // 'sched_getcpu' is serviced without a system call (via the vDSO, or the
+    // restartable-sequences area on recent kernels), and sharding by CPU
+    // minimizes the number of threads contending for each shard.
+
+    const int cpu = sched_getcpu();
+    if (0 <= cpu) {
+        return cpu & (k_NUM_SHARDS - 1);                              // RETURN
+    }
+#endif
+
+    // Thread ids are typically addresses aligned on a large power of 2, so
+    // mix the bits of the id before selecting a shard.
+
+    bsls::Types::Uint64 id = bslmt::ThreadUtil::selfIdAsUint64();
+    id ^= id >> 33;
+    id *= 0xff51afd7ed558ccdULL;
+    id ^= id >> 33;
+    return static_cast<int>(id & (k_NUM_SHARDS - 1));
+}
+
+// PRIVATE ACCESSORS
+void ShardedIntegerCollector::loadRecord(MetricRecord       *record,
+                                         bsls::Types::Int64  count,
+                                         bsls::Types::Int64  total,
+                                         int                 min,
+                                         int                 max) const
+{
+    record->metricId() = d_metricId;
+    record->count()    = static_cast<int>(count);
+    record->total()    = static_cast<double>(total);
+    record->min()      = (k_DEFAULT_MIN == min)
+                       ? MetricRecord::k_DEFAULT_MIN
+                       : min;
+    record->max()      = (k_DEFAULT_MAX == max)
+                       ? MetricRecord::k_DEFAULT_MAX
+                       : max;
+}
+
+// CREATORS
+ShardedIntegerCollector::ShardedIntegerCollector(const MetricId& metricId)
+: d_metricId(metricId)
+, d_shards_p(0)
+{
+    BSLMF_ASSERT(k_CACHE_LINE_SIZE == sizeof(Shard));
+    BSLMF_ASSERT(0 == (k_NUM_SHARDS & (k_NUM_SHARDS - 1)));
+
+    const int offset = bsls::AlignmentUtil::calculateAlignmentOffset(
+                                                            d_buffer,
+                                                            k_CACHE_LINE_SIZE);
+    d_shards_p = reinterpret_cast<Shard *>(d_buffer + offset);
+
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        Shard *shard = new (d_shards_p + i) Shard();
+        shard->d_min.storeRelaxed(k_DEFAULT_MIN);
+        shard->d_max.storeRelaxed(k_DEFAULT_MAX);
+    }
+}
+
+// MANIPULATORS
+void ShardedIntegerCollector::reset()
+{
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        Shard& shard = d_shards_p[i];
+        shard.d_count.storeRelaxed(0);
+        shard.d_total.storeRelaxed(0);
+        shard.d_min.storeRelaxed(k_DEFAULT_MIN);
+        shard.d_max.storeRelaxed(k_DEFAULT_MAX);
+    }
+}
+
+void ShardedIntegerCollector::loadAndReset(MetricRecord *record)
+{
+    bsls::Types::Int64 count = 0;
+    bsls::Types::Int64 total = 0;
+    int                min   = k_DEFAULT_MIN;
+    int                max   = k_DEFAULT_MAX;
+
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        Shard& shard = d_shards_p[i];
+        count += shard.d_count.swap(0);
+        total += shard.d_total.swap(0);
+        min    = bsl::min(min, shard.d_min.swap(k_DEFAULT_MIN));
+        max    = bsl::max(max, shard.d_max.swap(k_DEFAULT_MAX));
+    }
+    loadRecord(record, count, total, min, max);
+}
+
+void ShardedIntegerCollector::setCountTotalMinMax(int count,
+                                                  int total,
+                                                  int min,
+                                                  int max)
+{
+    reset();
+
+    Shard& shard = d_shards_p[0];
+    shard.d_count.storeRelaxed(count);
+    shard.d_total.storeRelaxed(total);
+    shard.d_min.storeRelaxed(min);
+    shard.d_max.storeRelaxed(max);
+}
+
+// ACCESSORS
+void ShardedIntegerCollector::load(MetricRecord *record) const
+{
+    bsls::Types::Int64 count = 0;
+    bsls::Types::Int64 total = 0;
+    int                min   = k_DEFAULT_MIN;
+    int                max   = k_DEFAULT_MAX;
+
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        const Shard& shard = d_shards_p[i];
+        count += shard.d_count.load();
+        total += shard.d_total.load();
+        min    = bsl::min(min, shard.d_min.load());
+        max    = bsl::max(max, shard.d_max.load());
+    }
+    loadRecord(record, count, total, min, max);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
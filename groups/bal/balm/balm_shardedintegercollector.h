@@ -0,0 +1,372 @@
+// balm_shardedintegercollector.h                                     -*-C++-*-
+#ifndef INCLUDED_BALM_SHARDEDINTEGERCOLLECTOR
+#define INCLUDED_BALM_SHARDEDINTEGERCOLLECTOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-free, sharded container for integral metric values.
+//
+//@CLASSES:
+//   balm::ShardedIntegerCollector: lock-free collector of integral values
+//
+//@SEE_ALSO: balm_integercollector, balm_collectorrepository, balm_metrics
+//
+//@DESCRIPTION: This component provides a class,
+// 'balm::ShardedIntegerCollector', for collecting and aggregating the values
+// of an integral metric from many threads concurrently.  Like
+// 'balm::IntegerCollector', a 'balm::ShardedIntegerCollector' records the
+// number of times an event occurs as well as the aggregated minimum, maximum,
+// and total of an associated integral measurement value, and provides the
+// same 'update', 'load', 'loadAndReset', and 'reset' operations.
+//
+// 'balm::IntegerCollector' protects its state with a mutex, which becomes a
+// point of contention when many threads update the same metric at a high
+// rate.  A 'balm::ShardedIntegerCollector' instead divides its state into a
+// fixed number of *shards*, each occupying its own cache line, and updates
+// the count, total, minimum, and maximum of a shard using atomic operations.
+// An 'update' is applied to the shard associated with the CPU on which the
+// calling thread is running (on platforms where that information is cheaply
+// available) or, otherwise, with the calling thread.  Threads running on
+// different CPUs therefore (almost always) update different cache lines, and
+// an 'update' never blocks.  The shards are merged into a single
+// 'balm::MetricRecord' by 'load' and 'loadAndReset', which are expected to be
+// invoked far less frequently (e.g., once per publication interval).
+//
+// The price of this scalability is memory (one cache line per shard, about
+// 2K bytes per collector on typical platforms) and a relaxed notion of
+// atomicity for the operations that read or write the collector as a whole;
+// see {Thread Safety}.  'balm::ShardedIntegerCollector' is therefore intended
+// for the (relatively few) metrics that are updated on hot code paths; a
+// 'balm::IntegerCollector' remains the appropriate choice for most metrics.
+//
+// A 'balm::CollectorRepository' manages sharded integer collectors alongside
+// its other collectors (see 'getDefaultShardedIntegerCollector'), and the
+// 'BALM_METRICS_SHARDED_INT_UPDATE' and 'BALM_METRICS_SHARDED_INCREMENT'
+// macros (see 'balm_metrics') record values using the default sharded integer
+// collector for a metric.
+//
+///Thread Safety
+///-------------
+// 'balm::ShardedIntegerCollector' is fully *thread-safe*, meaning that all
+// non-creator operations on a given instance can be safely invoked
+// simultaneously from multiple threads.  Unlike 'balm::IntegerCollector',
+// however, the operations that read or write the state of the collector as a
+// whole ('load', 'loadAndReset', 'reset', and 'setCountTotalMinMax') are not
+// atomic with respect to a concurrent 'update': a value recorded concurrently
+// with 'loadAndReset' is reported in either the current or the next
+// collection, and, rarely, its contributions to the count, total, minimum,
+// and maximum may be reported in different collections.  No value recorded
+// by 'update' is ever lost or reported twice by 'loadAndReset'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Collecting a Metric From Many Threads
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example we record the size of each message processed by a pool of
+// threads.  We start by creating a 'balm::MetricId' object by hand, but in
+// practice, an id should be obtained from a 'balm::MetricRegistry' object
+// (such as the one owned by a 'balm::MetricsManager'):
+//..
+//  balm::Category           myCategory("MyCategory");
+//  balm::MetricDescription  description(&myCategory, "MessageSize");
+//  balm::MetricId           messageSize(&description);
+//..
+// Then, we create a 'balm::ShardedIntegerCollector' object for 'messageSize'
+// and use the 'update' method to record values.  In practice the calls to
+// 'update' would be made by many threads concurrently:
+//..
+//  balm::ShardedIntegerCollector collector(messageSize);
+//
+//  collector.update(100);
+//  collector.update(300);
+//  collector.update(200);
+//..
+// Finally, we collect the aggregated values, which merges the values recorded
+// in each shard.  The result should have a count of 3, a total of 600, a
+// minimum of 100, and a maximum of 300:
+//..
+//  balm::MetricRecord record;
+//  collector.loadAndReset(&record);
+//
+//  assert(messageSize == record.metricId());
+//  assert(3           == record.count());
+//  assert(600         == record.total());
+//  assert(100         == record.min());
+//  assert(300         == record.max());
+//..
+
+#ifndef INCLUDED_BALSCM_VERSION
+#include <balscm_version.h>
+#endif
+
+#ifndef INCLUDED_BALM_METRICID
+#include <balm_metricid.h>
+#endif
+
+#ifndef INCLUDED_BALM_METRICRECORD
+#include <balm_metricrecord.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_PLATFORM
+#include <bslmt_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+namespace balm {
+
+                       // =============================
+                       // class ShardedIntegerCollector
+                       // =============================
+
+class ShardedIntegerCollector {
+    // This class provides a mechanism for collecting and aggregating the
+    // value of an integer metric over a period of time, that can be updated
+    // from many threads concurrently without blocking.  The collector
+    // contains a 'MetricId' object identifying the metric being collected,
+    // and a fixed number of cache-line sized shards, each holding a count of
+    // events and the total, minimum, and maximum aggregates of the associated
+    // measurement values recorded in that shard.  The default value for the
+    // count is 0, the default value for the total is 0, the default value for
+    // the minimum is 'k_DEFAULT_MIN', and the default value for the maximum
+    // is 'k_DEFAULT_MAX'.
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_CACHE_LINE_SIZE = bslmt::Platform::e_CACHE_LINE_SIZE,
+
+        k_NUM_SHARDS      = 32,  // must be a power of 2
+
+        k_SHARD_PADDING   = k_CACHE_LINE_SIZE
+                          - 2 * sizeof(bsls::AtomicInt64)
+                          - 2 * sizeof(bsls::AtomicInt)
+    };
+
+    // PRIVATE TYPES
+    struct Shard {
+        // This 'struct' holds the aggregated values recorded in one shard,
+        // padded to occupy a whole cache line.
+
+        bsls::AtomicInt64 d_count;  // aggregated count of events
+        bsls::AtomicInt64 d_total;  // total of values across events
+        bsls::AtomicInt   d_min;    // minimum value across events
+        bsls::AtomicInt   d_max;    // maximum value across events
+        char              d_pad[k_SHARD_PADDING];
+    };
+
+    // DATA
+    MetricId  d_metricId;  // metric identifier
+
+    Shard    *d_shards_p;  // cache-line aligned array of 'k_NUM_SHARDS'
+                           // shards within 'd_buffer'
+
+    char      d_buffer[(k_NUM_SHARDS + 1) * k_CACHE_LINE_SIZE];
+                           // storage for the shards, with one extra cache
+                           // line to allow for alignment
+
+    // NOT IMPLEMENTED
+    ShardedIntegerCollector(const ShardedIntegerCollector&);
+    ShardedIntegerCollector& operator=(const ShardedIntegerCollector&);
+
+    // PRIVATE CLASS METHODS
+    static int currentShardIndex();
+        // Return the index of the shard to be updated by the calling thread,
+        // in the range '[0 .. k_NUM_SHARDS - 1]'.  Note that the result is
+        // derived from the CPU on which the calling thread is running where
+        // that is cheaply available, and from the calling thread's id
+        // otherwise.
+
+    static void updateMin(bsls::AtomicInt *min, int value);
+        // Set the specified 'min' to the specified 'value' if 'value' is less
+        // than 'min'.
+
+    static void updateMax(bsls::AtomicInt *max, int value);
+        // Set the specified 'max' to the specified 'value' if 'value' is
+        // greater than 'max'.
+
+    // PRIVATE ACCESSORS
+    void loadRecord(MetricRecord       *record,
+                    bsls::Types::Int64  count,
+                    bsls::Types::Int64  total,
+                    int                 min,
+                    int                 max) const;
+        // Load into the specified 'record' the id of the metric being
+        // collected and the specified aggregate 'count', 'total', 'min', and
+        // 'max', converting a 'min' of 'k_DEFAULT_MIN' and a 'max' of
+        // 'k_DEFAULT_MAX' to the corresponding 'MetricRecord' defaults.
+
+  public:
+    // PUBLIC CONSTANTS
+    static const int k_DEFAULT_MIN;  // default minimum value (INT_MAX)
+    static const int k_DEFAULT_MAX;  // default maximum value (INT_MIN)
+
+    // CREATORS
+    explicit ShardedIntegerCollector(const MetricId& metricId);
+        // Create a sharded integer collector for a metric having the
+        // specified 'metricId', and having an initial count of 0, total of 0,
+        // min of 'k_DEFAULT_MIN', and max of 'k_DEFAULT_MAX'.
+
+    ~ShardedIntegerCollector();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void reset();
+        // Reset the count, total, minimum, and maximum values of the metric
+        // being collected to their default states.  After this operation, the
+        // count and total values will be 0, the minimum value will be
+        // 'k_DEFAULT_MIN', and the maximum value will be 'k_DEFAULT_MAX'.
+        // Note that values recorded by concurrent 'update' operations may, or
+        // may not, be discarded.
+
+    void loadAndReset(MetricRecord *record);
+        // Load into the specified 'record' the id of the metric being
+        // collected as well as the current count, total, minimum, and maximum
+        // aggregated values for that metric, merged across all shards; then
+        // reset the count, total, minimum, and maximum values to their
+        // default states.  A minimum value of 'k_DEFAULT_MIN' will populate a
+        // minimum value of 'MetricRecord::k_DEFAULT_MIN' and a maximum value
+        // of 'k_DEFAULT_MAX' will populate a maximum value of
+        // 'MetricRecord::k_DEFAULT_MAX'.  Note that each value recorded by a
+        // concurrent 'update' is loaded either by this operation or by a
+        // subsequent one (see {Thread Safety}).
+
+    void update(int value);
+        // Increment the event count by 1, add the specified 'value' to the
+        // total, if 'value' is less than the minimum value, set 'value' to be
+        // the minimum value, and if 'value' is greater than the maximum
+        // value, set 'value' to be the maximum value.  This operation does
+        // not block.
+
+    void accumulateCountTotalMinMax(int count, int total, int min, int max);
+        // Increment the event count by the specified 'count', add the
+        // specified 'total' to the accumulated total, and if the specified
+        // 'min' is less than the minimum value, set 'min' to be the minimum
+        // value, and if the specified 'max' is greater than the maximum value,
+        // set 'max' to be the maximum value.  This operation does not block.
+
+    void setCountTotalMinMax(int count, int total, int min, int max);
+        // Set the event count to the specified 'count', the total aggregate to
+        // the specified 'total', the minimum aggregate to the specified 'min'
+        // and the maximum aggregate to the specified 'max'.  Note that values
+        // recorded by concurrent 'update' operations may, or may not, be
+        // discarded.
+
+    // ACCESSORS
+    const MetricId& metricId() const;
+        // Return a reference to the non-modifiable 'MetricId' object
+        // identifying the metric for which this object collects values.
+
+    void load(MetricRecord *record) const;
+        // Load into the specified 'record' the id of the metric being
+        // collected, as well as the current count, total, minimum, and
+        // maximum aggregated values for the metric, merged across all shards.
+        // A minimum value of 'k_DEFAULT_MIN' will populate a minimum value of
+        // 'MetricRecord::k_DEFAULT_MIN' and a maximum value of
+        // 'k_DEFAULT_MAX' will populate a maximum value of
+        // 'MetricRecord::k_DEFAULT_MAX'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                       // -----------------------------
+                       // class ShardedIntegerCollector
+                       // -----------------------------
+
+// PRIVATE CLASS METHODS
+inline
+void ShardedIntegerCollector::updateMin(bsls::AtomicInt *min, int value)
+{
+    int current = min->loadRelaxed();
+    while (value < current) {
+        const int previous = min->testAndSwap(current, value);
+        if (previous == current) {
+            break;
+        }
+        current = previous;
+    }
+}
+
+inline
+void ShardedIntegerCollector::updateMax(bsls::AtomicInt *max, int value)
+{
+    int current = max->loadRelaxed();
+    while (value > current) {
+        const int previous = max->testAndSwap(current, value);
+        if (previous == current) {
+            break;
+        }
+        current = previous;
+    }
+}
+
+// CREATORS
+inline
+ShardedIntegerCollector::~ShardedIntegerCollector()
+{
+}
+
+// MANIPULATORS
+inline
+void ShardedIntegerCollector::update(int value)
+{
+    Shard& shard = d_shards_p[currentShardIndex()];
+    shard.d_count.addRelaxed(1);
+    shard.d_total.addRelaxed(value);
+    updateMin(&shard.d_min, value);
+    updateMax(&shard.d_max, value);
+}
+
+inline
+void ShardedIntegerCollector::accumulateCountTotalMinMax(int count,
+                                                         int total,
+                                                         int min,
+                                                         int max)
+{
+    Shard& shard = d_shards_p[currentShardIndex()];
+    shard.d_count.addRelaxed(count);
+    shard.d_total.addRelaxed(total);
+    updateMin(&shard.d_min, min);
+    updateMax(&shard.d_max, max);
+}
+
+// ACCESSORS
+inline
+const MetricId& ShardedIntegerCollector::metricId() const
+{
+    return d_metricId;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
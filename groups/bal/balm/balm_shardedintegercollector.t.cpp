@@ -0,0 +1,863 @@
+// balm_shardedintegercollector.t.cpp                                 -*-C++-*-
+#include <balm_shardedintegercollector.h>
+
+#include <balm_integercollector.h>
+#include <balm_metricdescription.h>
+#include <balm_category.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bdlf_bind.h>
+
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The 'balm::ShardedIntegerCollector' is a mechanism for collecting and
+// recording aggregated metric values without taking a lock.  Ensure values
+// can be accumulated into and read out of the container, that values recorded
+// by different threads (and so, typically, in different shards) are merged
+// correctly, and that no value is lost or reported twice when values are
+// collected concurrently with updates.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 3]  balm::ShardedIntegerCollector(const balm::MetricId& metric);
+// [ 3]  ~balm::ShardedIntegerCollector();
+//
+// MANIPULATORS
+// [ 7]  void reset();
+// [ 6]  void loadAndReset(balm::MetricRecord *record);
+// [ 2]  void update(int value);
+// [ 5]  void accumulateCountTotalMinMax(int count,
+//                                       int total,
+//                                       int min,
+//                                       int max);
+// [ 4]  void setCountTotalMinMax(int count, int total, int min, int max);
+//
+// ACCESSORS
+// [ 2]  const balm::MetricId& metricId() const;
+// [ 2]  void load(balm::MetricRecord *record) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] CONCURRENCY TEST
+// [ 9] USAGE EXAMPLE
+// [-1] CONTENTION BENCHMARK
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        bsl::cout << "Error " << __FILE__ << "(" << i << "): " << s
+                  << "    (failed)" << bsl::endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::ShardedIntegerCollector Obj;
+typedef balm::MetricRecord            Rec;
+typedef balm::MetricDescription       Desc;
+typedef balm::MetricId                Id;
+
+// ============================================================================
+//                      GLOBAL STUB CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace TEST_CASE_CONCURRENCY {
+
+struct Totals {
+    // This 'struct' accumulates the values loaded by the collecting thread.
+
+    bsls::Types::Int64 d_count;
+    bsls::Types::Int64 d_total;
+    double             d_min;
+    double             d_max;
+    int                d_numCollections;
+};
+
+void updateJob(Obj             *collector,
+               bslmt::Barrier  *barrier,
+               int              threadIndex,
+               int              numUpdates)
+    // Wait on the specified 'barrier', then record the specified 'numUpdates'
+    // values, derived from the specified 'threadIndex', in the specified
+    // 'collector'.  Every fourth value is recorded by
+    // 'accumulateCountTotalMinMax' rather than 'update'.
+{
+    barrier->wait();
+    for (int i = 0; i < numUpdates; ++i) {
+        const int value = threadIndex * 1000 + i % 1000 - 500;
+        if (3 == i % 4) {
+            collector->accumulateCountTotalMinMax(1, value, value, value);
+        }
+        else {
+            collector->update(value);
+        }
+    }
+}
+
+void collectJob(Obj             *collector,
+                bslmt::Barrier  *barrier,
+                bsls::AtomicInt *done,
+                Totals          *totals)
+    // Wait on the specified 'barrier', then repeatedly call 'loadAndReset' on
+    // the specified 'collector', accumulating the loaded values into the
+    // specified 'totals', until the specified 'done' flag is set.
+{
+    barrier->wait();
+    do {
+        Rec record;
+        collector->loadAndReset(&record);
+        totals->d_count += record.count();
+        totals->d_total += static_cast<bsls::Types::Int64>(record.total());
+        totals->d_min    = bsl::min(totals->d_min, record.min());
+        totals->d_max    = bsl::max(totals->d_max, record.max());
+        ++totals->d_numCollections;
+    } while (!done->loadAcquire());
+}
+
+}  // close namespace TEST_CASE_CONCURRENCY
+
+namespace TEST_CASE_CONTENTION_BENCHMARK {
+
+template <class COLLECTOR>
+void benchmarkJob(COLLECTOR      *collector,
+                  bslmt::Barrier *barrier,
+                  int             numUpdates)
+    // Wait on the specified 'barrier', then call 'update' on the specified
+    // 'collector' the specified 'numUpdates' times.
+{
+    barrier->wait();
+    for (int i = 0; i < numUpdates; ++i) {
+        collector->update(i & 1023);
+    }
+    barrier->wait();
+}
+
+template <class COLLECTOR>
+double benchmark(int numThreads, int numUpdates)
+    // Return the number of millions of updates per second made to a single
+    // collector of the (template parameter) type 'COLLECTOR' by the specified
+    // 'numThreads' threads, each making the specified 'numUpdates' updates.
+{
+    COLLECTOR          collector(Id(0));
+    bslmt::Barrier     barrier(numThreads + 1);
+    bslmt::ThreadGroup threads;
+
+    for (int i = 0; i < numThreads; ++i) {
+        threads.addThread(bdlf::BindUtil::bind(&benchmarkJob<COLLECTOR>,
+                                               &collector,
+                                               &barrier,
+                                               numUpdates));
+    }
+
+    bsls::Stopwatch timer;
+    barrier.wait();
+    timer.start();
+    barrier.wait();
+    timer.stop();
+    threads.joinAll();
+
+    Rec record;
+    collector.load(&record);
+    ASSERT(numThreads * numUpdates == record.count());
+
+    return static_cast<double>(numThreads) * numUpdates
+                                           / timer.elapsedTime() / 1000000.0;
+}
+
+}  // close namespace TEST_CASE_CONTENTION_BENCHMARK
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;
+
+    balm::Category cat_A("A", true);
+    Desc desc_A(&cat_A, "A"); const Desc *DESC_A = &desc_A;
+    Desc desc_B(&cat_A, "B"); const Desc *DESC_B = &desc_B;
+    Desc desc_C(&cat_A, "C"); const Desc *DESC_C = &desc_C;
+    Desc desc_D(&cat_A, "D"); const Desc *DESC_D = &desc_D;
+    Desc desc_E(&cat_A, "E"); const Desc *DESC_E = &desc_E;
+
+    Id metric_A(DESC_A); const Id& METRIC_A = metric_A;
+    Id metric_B(DESC_B); const Id& METRIC_B = metric_B;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file must
+        //:   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Usage Example"
+                          << "\n=====================" << endl;
+
+///Example 1: Collecting a Metric From Many Threads
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example we record the size of each message processed by a pool of
+// threads.  We start by creating a 'balm::MetricId' object by hand, but in
+// practice, an id should be obtained from a 'balm::MetricRegistry' object
+// (such as the one owned by a 'balm::MetricsManager'):
+//..
+    balm::Category           myCategory("MyCategory");
+    balm::MetricDescription  description(&myCategory, "MessageSize");
+    balm::MetricId           messageSize(&description);
+//..
+// Then, we create a 'balm::ShardedIntegerCollector' object for 'messageSize'
+// and use the 'update' method to record values.  In practice the calls to
+// 'update' would be made by many threads concurrently:
+//..
+    balm::ShardedIntegerCollector collector(messageSize);
+
+    collector.update(100);
+    collector.update(300);
+    collector.update(200);
+//..
+// Finally, we collect the aggregated values, which merges the values recorded
+// in each shard.  The result should have a count of 3, a total of 600, a
+// minimum of 100, and a maximum of 300:
+//..
+    balm::MetricRecord record;
+    collector.loadAndReset(&record);
+
+    ASSERT(messageSize == record.metricId());
+    ASSERT(3           == record.count());
+    ASSERT(600         == record.total());
+    ASSERT(100         == record.min());
+    ASSERT(300         == record.max());
+//..
+
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Values recorded concurrently by many threads (and so, typically,
+        //:   in different shards) are all merged by 'loadAndReset'.
+        //:
+        //: 2 No value is lost, or reported twice, when 'loadAndReset' is
+        //:   called concurrently with 'update' and
+        //:   'accumulateCountTotalMinMax'.
+        //
+        // Plan:
+        //: 1 Start a number of threads that each record a known sequence of
+        //:   values, and a thread that repeatedly calls 'loadAndReset' until
+        //:   the updating threads have completed, accumulating the loaded
+        //:   values.  Then call 'loadAndReset' a final time and verify that
+        //:   the accumulated count, total, minimum, and maximum match those
+        //:   of the recorded values.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TEST CONCURRENCY" << endl
+                                  << "================" << endl;
+
+        using namespace TEST_CASE_CONCURRENCY;
+
+        const int NUM_THREADS = 16;
+        const int NUM_UPDATES = 100000;
+
+        Obj mX(METRIC_A);
+
+        Totals totals = { 0, 0, Rec::k_DEFAULT_MIN, Rec::k_DEFAULT_MAX, 0 };
+
+        bslmt::Barrier     barrier(NUM_THREADS + 1);
+        bsls::AtomicInt    done(0);
+        bslmt::ThreadGroup updaters;
+        bslmt::ThreadGroup collectors;
+
+        collectors.addThread(bdlf::BindUtil::bind(&collectJob,
+                                                  &mX,
+                                                  &barrier,
+                                                  &done,
+                                                  &totals));
+        for (int i = 0; i < NUM_THREADS - 1; ++i) {
+            updaters.addThread(bdlf::BindUtil::bind(&updateJob,
+                                                    &mX,
+                                                    &barrier,
+                                                    i,
+                                                    NUM_UPDATES));
+        }
+        updateJob(&mX, &barrier, NUM_THREADS - 1, NUM_UPDATES);
+        updaters.joinAll();
+        done.storeRelease(1);
+        collectors.joinAll();
+
+        Rec last;
+        mX.loadAndReset(&last);
+        totals.d_count += last.count();
+        totals.d_total += static_cast<bsls::Types::Int64>(last.total());
+        totals.d_min    = bsl::min(totals.d_min, last.min());
+        totals.d_max    = bsl::max(totals.d_max, last.max());
+
+        bsls::Types::Int64 expTotal = 0;
+        for (int t = 0; t < NUM_THREADS - 1; ++t) {
+            for (int i = 0; i < NUM_UPDATES; ++i) {
+                expTotal += t * 1000 + i % 1000 - 500;
+            }
+        }
+        for (int i = 0; i < NUM_UPDATES; ++i) {
+            expTotal += (NUM_THREADS - 1) * 1000 + i % 1000 - 500;
+        }
+
+        if (verbose) {
+            P_(totals.d_numCollections); P(totals.d_count);
+        }
+
+        ASSERTV(totals.d_count,
+                NUM_THREADS * NUM_UPDATES == totals.d_count);
+        ASSERTV(expTotal, totals.d_total, expTotal == totals.d_total);
+        ASSERTV(totals.d_min, -500 == totals.d_min);
+        ASSERTV(totals.d_max,
+                (NUM_THREADS - 1) * 1000 + 499 == totals.d_max);
+
+        Rec empty;
+        mX.load(&empty);
+        ASSERT(0                  == empty.count());
+        ASSERT(Rec::k_DEFAULT_MIN == empty.min());
+        ASSERT(Rec::k_DEFAULT_MAX == empty.max());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING ADDITIONAL MANIPULATOR: reset
+        //
+        // Concerns:
+        //   reset
+        //
+        // Plan:
+        //   Create a table of test values.  Iterate over the test values
+        //   set them on the container.  Verify load returns the
+        //   correct value, call reset, verify the value is the default value.
+        //
+        // Testing:
+        // void reset()
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting reset." << endl;
+        struct {
+            const Desc *d_id;
+            int         d_count;
+            int         d_total;
+            int         d_min;
+            int         d_max;
+        } VALUES [] = {
+            {      0,      0,        0,           0,           0 },
+            { DESC_A,      1,        1,           1,           1 },
+            { DESC_B,      1,        2,           3,           4 },
+            { DESC_C,     -1,       -2,          -3,          -4 },
+            { DESC_D, 100000,  2000000,     3000000,     4000000 },
+            { DESC_E, INT_MAX, INT_MAX, INT_MIN + 1, INT_MAX - 1 },
+            { DESC_A, INT_MAX, INT_MIN, INT_MAX - 1, INT_MIN + 1 }
+        };
+        const int NUM_VALUES = sizeof(VALUES)/sizeof(*VALUES);
+
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            balm::MetricRecord r1, r2;
+            Obj mX((Id(VALUES[i].d_id))); const Obj& MX = mX;
+            mX.setCountTotalMinMax(VALUES[i].d_count,
+                                   VALUES[i].d_total,
+                                   VALUES[i].d_min,
+                                   VALUES[i].d_max);
+            MX.load(&r1);
+            ASSERT(VALUES[i].d_id    == r1.metricId());
+            ASSERT(VALUES[i].d_count == r1.count());
+            ASSERT(VALUES[i].d_total == r1.total());
+            ASSERT(VALUES[i].d_min   == r1.min());
+            ASSERT(VALUES[i].d_max   == r1.max());
+
+            mX.reset();
+            MX.load(&r2);
+            ASSERT(VALUES[i].d_id    == r2.metricId());
+            ASSERT(0                 == r2.count());
+            ASSERT(0.0               == r2.total());
+            ASSERT(Rec::k_DEFAULT_MIN  == r2.min());
+            ASSERT(Rec::k_DEFAULT_MAX  == r2.max());
+        }
+
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING ADDITIONAL MANIPULATOR: loadAndReset
+        //
+        // Concerns:
+        //   loadAndReset
+        //
+        // Plan:
+        //   Create a table of test values.  Iterate over the test values
+        //   set them on the container.  Verify loadAndReset returns the
+        //   correct values and that the collector is left in the correct
+        //   state.
+        //
+        // Testing:
+        // void loadAndReset(balm::MetricRecord *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting loadAndReset." << endl;
+        struct {
+            const Desc *d_id;
+            int         d_count;
+            int         d_total;
+            int         d_min;
+            int         d_max;
+        } VALUES [] = {
+            {      0,      0,        0,           0,           0 },
+            { DESC_A,      1,        1,           1,           1 },
+            { DESC_B,      1,        2,           3,           4 },
+            { DESC_C,     -1,       -2,          -3,          -4 },
+            { DESC_D, 100000,  2000000,     3000000,     4000000 },
+            { DESC_E, INT_MAX, INT_MAX, INT_MIN + 1, INT_MAX - 1 },
+            { DESC_A, INT_MAX, INT_MIN, INT_MAX - 1, INT_MIN + 1 }
+        };
+        const int NUM_VALUES = sizeof(VALUES)/sizeof(*VALUES);
+
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            balm::MetricRecord r1, r2, r3;
+            Obj mX((Id(VALUES[i].d_id))); const Obj& MX = mX;
+            mX.setCountTotalMinMax(VALUES[i].d_count,
+                                   VALUES[i].d_total,
+                                   VALUES[i].d_min,
+                                   VALUES[i].d_max);
+            MX.load(&r1);
+            ASSERT(VALUES[i].d_id    == r1.metricId());
+            ASSERT(VALUES[i].d_count == r1.count());
+            ASSERT(VALUES[i].d_total == r1.total());
+            ASSERT(VALUES[i].d_min   == r1.min());
+            ASSERT(VALUES[i].d_max   == r1.max());
+
+            mX.loadAndReset(&r2);
+            ASSERT(VALUES[i].d_id    == r2.metricId());
+            ASSERT(VALUES[i].d_count == r2.count());
+            ASSERT(VALUES[i].d_total == r2.total());
+            ASSERT(VALUES[i].d_min   == r2.min());
+            ASSERT(VALUES[i].d_max   == r2.max());
+
+            MX.load(&r3);
+            ASSERT(VALUES[i].d_id    == r3.metricId());
+            ASSERT(0                 == r3.count());
+            ASSERT(0.0               == r3.total());
+            ASSERT(Rec::k_DEFAULT_MIN  == r3.min());
+            ASSERT(Rec::k_DEFAULT_MAX  == r3.max());
+        }
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING ADDITIONAL MANIPULATOR: accumulateCountTotalMinMax
+        //
+        // Concerns:
+        //   accumulateCountTotalMinMax
+        //
+        // Plan:
+        //   Create a table of test values.  Iterate over the test values
+        //   selecting the first value, then iterate over the test values
+        //   starting at that first value and accumulate the values in the
+        //   collector.  Maintain a separate count, total, min, and max and
+        //   verify the values returned by the collector.
+        //
+        // Testing:
+        // void accumulateCountTotalMinMax(int , int , int , int );
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting accumulateCountTotalMinMax." << endl;
+
+        struct {
+            int d_count;
+            int d_total;
+            int d_min;
+            int d_max;
+        } VALUES [] = {
+            {         0,         0,               0,                0 },
+            {         1,         1,               1,                1 },
+            {      1210,   INT_MAX,     INT_MIN + 1,      INT_MAX - 1 },
+            {         1,         2,               3,                4 },
+            {        10,        -2,              -3,               -4 },
+            {      123110, INT_MIN,     INT_MAX - 1,      INT_MIN + 1 },
+            {     -12311,   231413,           -1123,           410001 },
+         };
+        const int NUM_VALUES = sizeof(VALUES)/sizeof(*VALUES);
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            Obj mX(Id(0)); const Obj& MX = mX;
+
+            int                count = 0;
+            bsls::Types::Int64 total = 0;
+            int                min   = VALUES[i].d_min;
+            int                max   = VALUES[i].d_max;
+            for (int j = 0; j < NUM_VALUES; ++j) {
+                int idx = (i + j) % NUM_VALUES;
+                balm::MetricRecord r;
+
+                count += VALUES[idx].d_count;
+                total += VALUES[idx].d_total;
+                min   =  bsl::min(VALUES[idx].d_min, min);
+                max   =  bsl::max(VALUES[idx].d_max, max);
+
+                mX.accumulateCountTotalMinMax(VALUES[idx].d_count,
+                                              VALUES[idx].d_total,
+                                              VALUES[idx].d_min,
+                                              VALUES[idx].d_max);
+                MX.load(&r);
+                ASSERT(0     == r.metricId());
+                ASSERT(count == r.count());
+                ASSERT(total == r.total());
+                ASSERT(min   == r.min());
+                ASSERT(max   == r.max());
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING ADDITIONAL MANIPULATOR: setCountTotalMinMax
+        //
+        // Concerns:
+        //   setCountTotalMinMax
+        //
+        // Plan:
+        //   Create a table of test values and set them to the object, verify
+        //   that values are set correctly.
+        //
+        // Testing:
+        // void setCountTotalMinMax(int , int , int , int );
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting setCountTotalMinMax." << endl;
+
+        struct {
+            int d_count;
+            int d_total;
+            int d_min;
+            int d_max;
+        } VALUES [] = {
+            {       0,           0,           0,           0 },
+            {       1,           1,           1,           1 },
+            {       1,           2,           3,           4 },
+            {      -1,          -2,          -3,          -4 },
+            {  100000,     2000000,     3000000,     4000000 },
+            { INT_MAX,     INT_MAX, INT_MIN + 1, INT_MAX - 1 },
+            { INT_MAX,     INT_MIN, INT_MAX - 1, INT_MIN + 1 }
+        };
+        const int NUM_VALUES = sizeof(VALUES)/sizeof(*VALUES);
+
+        Obj mX(Id(0)); const Obj& MX = mX;
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            balm::MetricRecord r;
+            mX.setCountTotalMinMax(VALUES[i].d_count,
+                                   VALUES[i].d_total,
+                                   VALUES[i].d_min,
+                                   VALUES[i].d_max);
+            MX.load(&r);
+            ASSERT(0                 == r.metricId());
+            ASSERT(VALUES[i].d_count == r.count());
+            ASSERT(VALUES[i].d_total == r.total());
+            ASSERT(VALUES[i].d_min   == r.min());
+            ASSERT(VALUES[i].d_max   == r.max());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING CONSTRUCTORS
+        //
+        // Concerns:
+        //   Test the constructor arguments
+        //
+        // Plan:
+        //   Verify the constructor by passing a value from a table of values
+        //   and verifying the object is initialized with the value..
+        //
+        //
+        // Testing:
+        //   balm::ShardedIntegerCollector(const balm::MetricId& )
+        //   ~balm::ShardedIntegerCollector()
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting constructor." << endl;
+
+        const Desc *IDS[]  = { 0, DESC_A, DESC_B, DESC_C, DESC_D, DESC_E };
+        const int NUM_IDS = sizeof(IDS)/sizeof(*IDS);
+        for (int i = 0; i < NUM_IDS; ++i) {
+            Obj mX((Id(IDS[i]))); const Obj& MX = mX;
+            ASSERT(IDS[i] == MX.metricId());
+        }
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING BASIC MANIPULATORS and ACCESSORS (BOOTSTRAP):
+        //
+        // Concerns:
+        //   The primary fields must be correctly modifiable and accessible.
+        //
+        // Plan:
+        //   First, verify the constructor by testing the value of the
+        //   resulting object.
+        //
+        //   Next, for a sequence of independent test values, add elements to
+        //   the container and used the basic accessors to verify the
+        //   modification.
+        //
+        // Testing:
+        //   balm::ShardedIntegerCollector(const balm::MetricId& )
+        //   void update(int );
+        //
+        //   const balm::MetricId *metric() const;
+        //   void load(balm::MetricRecord *record) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting basic manipulator and accessors."
+                          << endl;
+
+        int UPDATES[] = { 0, 12, -1321123, 2131241, 1321,
+                            43145, 1, -1, INT_MIN + 1, INT_MAX - 1};
+        const int NUM_UPDATES = sizeof(UPDATES)/sizeof(*UPDATES);
+
+        for (int i = 0; i < NUM_UPDATES; ++i) {
+            const Desc *METRIC = (const Desc *)(i + 1);
+            Obj mX((Id(METRIC))); const Obj& MX = mX;
+
+
+            balm::MetricRecord r1, r2;
+            MX.load(&r1);
+            ASSERT(METRIC           == r1.metricId().description());
+            ASSERT(0                == r1.count());
+            ASSERT(0                == r1.total());
+            ASSERT(Rec::k_DEFAULT_MIN == r1.min());
+            ASSERT(Rec::k_DEFAULT_MAX == r1.max());
+
+            bsls::Types::Int64 total = 0;
+            int                min   = UPDATES[i];
+            int                max   = UPDATES[i];
+            for (int j = 0; j < NUM_UPDATES; ++j) {
+                const int INDEX = (i + j) % NUM_UPDATES;
+                mX.update(UPDATES[INDEX]);
+
+                total += UPDATES[INDEX];
+                min   = bsl::min(min, UPDATES[INDEX]);
+                max   = bsl::max(max, UPDATES[INDEX]);
+
+                MX.load(&r1);
+                ASSERT(METRIC == r1.metricId().description());
+                ASSERT(j + 1  == r1.count());
+                ASSERT(total  == r1.total());
+                ASSERT(min    == r1.min());
+                LOOP2_ASSERT(max, r1.max(), max    == r1.max());
+
+                MX.load(&r2);
+                ASSERT(r1 == r2);
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST:
+        //   Developers' Sandbox.
+        //
+        // Plan:
+        //   Perform ad-hoc test of the primary modifiers and accessors.
+        //
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(METRIC_A); const Obj& MX = mX;
+        Obj mY(METRIC_B); const Obj& MY = mY;
+
+        ASSERT(METRIC_A == MX.metricId());
+        ASSERT(METRIC_B == MY.metricId());
+
+        balm::MetricRecord r1, r2;
+
+        MX.load(&r1);
+        ASSERT(METRIC_A == r1.metricId());
+        ASSERT(0  == r1.count());
+        ASSERT(0  == r1.total());
+        ASSERT(Rec::k_DEFAULT_MIN == r1.min());
+        ASSERT(Rec::k_DEFAULT_MAX == r1.max());
+
+        MY.load(&r2);
+        ASSERT(METRIC_B == r2.metricId());
+        ASSERT(0  == r2.count());
+        ASSERT(0  == r2.total());
+        ASSERT(Rec::k_DEFAULT_MIN == r2.min());
+        ASSERT(Rec::k_DEFAULT_MAX == r2.max());
+
+        mX.update(1);
+        mX.update(2);
+        mX.update(-5);
+        MX.load(&r1);
+        ASSERT(METRIC_A == r1.metricId());
+        ASSERT(3  == r1.count());
+        ASSERT(-2 == r1.total());
+        ASSERT(-5 == r1.min());
+        ASSERT(2  == r1.max());
+
+        mX.reset();
+        MX.load(&r1);
+        ASSERT(METRIC_A == r1.metricId());
+        ASSERT(0  == r1.count());
+        ASSERT(0  == r1.total());
+        ASSERT(Rec::k_DEFAULT_MIN == r1.min());
+        ASSERT(Rec::k_DEFAULT_MAX == r1.max());
+
+        mX.update(3);
+        mX.loadAndReset(&r1);
+        ASSERT(METRIC_A == r1.metricId());
+        ASSERT(1  == r1.count());
+        ASSERT(3  == r1.total());
+        ASSERT(3  == r1.min());
+        ASSERT(3  == r1.max());
+
+        MX.load(&r1);
+        ASSERT(METRIC_A == r1.metricId());
+        ASSERT(0  == r1.count());
+        ASSERT(0  == r1.total());
+        ASSERT(Rec::k_DEFAULT_MIN == r1.min());
+        ASSERT(Rec::k_DEFAULT_MAX == r1.max());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // CONTENTION BENCHMARK
+        //
+        // Concerns:
+        //: 1 The throughput of 'update' on a single
+        //:   'balm::ShardedIntegerCollector' scales with the number of
+        //:   updating threads, unlike that of a 'balm::IntegerCollector'.
+        //
+        // Plan:
+        //: 1 For an increasing number of threads, measure the aggregate rate
+        //:   at which the threads can update a single 'balm::IntegerCollector'
+        //:   and a single 'balm::ShardedIntegerCollector', and report the
+        //:   results.
+        //
+        // Testing:
+        //   CONTENTION BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONTENTION BENCHMARK" << endl
+                                  << "====================" << endl;
+
+        using namespace TEST_CASE_CONTENTION_BENCHMARK;
+
+        const int MAX_THREADS = 32;
+        const int NUM_UPDATES = 1000000;
+
+        cout << "threads    IntegerCollector    ShardedIntegerCollector\n"
+             << "           (M updates/s)       (M updates/s)" << endl;
+
+        for (int numThreads = 1; numThreads <= MAX_THREADS; numThreads *= 2) {
+            const double locked =
+                benchmark<balm::IntegerCollector>(numThreads, NUM_UPDATES);
+            const double sharded =
+                          benchmark<Obj>(numThreads, NUM_UPDATES);
+
+            cout << numThreads << "\t   " << locked << "\t\t       "
+                 << sharded << endl;
+        }
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << bsl::endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
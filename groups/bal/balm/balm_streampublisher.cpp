@@ -18,6 +18,7 @@ BSLS_IDENT_RCSID(balm_streampublisher_cpp,"$Id$ $CSID$")
 #include <balm_metricrecord.h>
 #include <balm_metricsample.h>
 #include <balm_metricid.h>
+#include <balm_quantilerecord.h>
 
 #include <bsls_timeinterval.h>
 #include <bsls_assert.h>
@@ -172,6 +173,35 @@ void publishRecord(bsl::ostream&             stream,
     stream << " ]\n";
 }
 
+void publishQuantileRecord(bsl::ostream&               stream,
+                           const balm::QuantileRecord& record)
+    // Publish, to the specified 'stream', the specified quantile 'record'.
+    // Note that the quantiles are formatted using the format specification
+    // (if any) for the maximum value of the metric, as they are measured in
+    // the same units.
+{
+    bsl::shared_ptr<const balm::MetricFormat> format =
+                                   record.metricId().description()->format();
+    const balm::MetricFormatSpec *formatSpec =
+                  format ? format->formatSpec(balm::PublicationType::e_MAX)
+                         : 0;
+
+    stream << "\t\t" << record.metricId() << "[ ";
+    for (int i = 0; i < balm::QuantileRecord::k_NUM_QUANTILES; ++i) {
+        if (0 != i) {
+            stream << ", ";
+        }
+        stream << balm::QuantileRecord::quantileName(i) << " = ";
+        if (0 == record.count()) {
+            stream << "undefined";
+        }
+        else {
+            formatValue(stream, record.value(i), formatSpec);
+        }
+    }
+    stream << " ]\n";
+}
+
 }  // close unnamed namespace
 
 namespace balm {
@@ -205,6 +235,9 @@ void StreamPublisher::publish(const MetricSample& metricValues)
             for (; rIt != gIt->end(); ++rIt) {
                 publishRecord(d_stream, *rIt, elapsedTime);
             }
+            for (int i = 0; i < gIt->numQuantileRecords(); ++i) {
+                publishQuantileRecord(d_stream, gIt->quantileRecords()[i]);
+            }
             prev = gIt;
         }
     }
@@ -37,6 +37,13 @@ BSLS_IDENT("$Id: $")
 // This implementation of the publisher protocol publishes records to an output
 // stream that is supplied at construction.
 //
+// The quantile records (if any) of each group in a published sample are
+// written after the metric records of that group, one line per quantile
+// record, e.g.:
+//..
+//     MyCategory.Latency [ p50 = 101, p90 = 101, p99 = 1007, p99.9 = 1007 ]
+//..
+//
 ///Usage
 ///-----
 // In the following example we illustrate how to create and publish records
@@ -11,6 +11,7 @@
 
 #include <balm_metricsample.h>
 #include <balm_metricformat.h>
+#include <balm_quantilerecord.h>
 
 #include <bdlt_datetimetz.h>
 #include <bdlt_currenttime.h>
@@ -39,7 +40,10 @@ using bsl::flush;
 //                                 Overview
 //                                 --------
 // ----------------------------------------------------------------------------
+// [ 2] virtual void publish(const balm::MetricSample& );
 // ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -101,7 +105,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 2: {
+      case 3: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -168,6 +172,89 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING QUANTILE RECORDS
+        //
+        // Concerns:
+        //: 1 The quantile records of a sample group are published, one line
+        //:   per record, after the metric records of that group.
+        //:
+        //: 2 The quantiles of a quantile record having a count of 0 are
+        //:   published as "undefined".
+        //:
+        //: 3 Samples without quantile records are published as before.
+        //
+        // Plan:
+        //: 1 Publish samples with and without quantile records to a string
+        //:   stream, and verify the output.  (C-1..3)
+        //
+        // Testing:
+        //   virtual void publish(const balm::MetricSample& );
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING QUANTILE RECORDS" << endl
+                                  << "========================" << endl;
+
+        bslma::TestAllocator ta;
+
+        balm::Category          myCategory("MyCategory");
+        balm::MetricDescription descA(&myCategory, "A");
+        balm::MetricDescription descB(&myCategory, "B");
+        balm::MetricId          metricA(&descA);
+        balm::MetricId          metricB(&descB);
+
+        balm::MetricRecord records[2] = {
+            balm::MetricRecord(metricA, 2, 3.0, 1.0, 2.0),
+            balm::MetricRecord(metricB)
+        };
+
+        balm::QuantileRecord quantiles[2];
+        quantiles[0].metricId() = metricA;
+        quantiles[0].count()    = 2;
+        quantiles[0].value(0)   = 1.0;
+        quantiles[0].value(1)   = 2.0;
+        quantiles[0].value(2)   = 2.0;
+        quantiles[0].value(3)   = 2.0;
+        quantiles[1].metricId() = metricB;
+
+        const char *EXP_RECORDS =
+            "\t\tMyCategory.A[ count = 2, total = 3, min = 1, max = 2 ]\n"
+            "\t\tMyCategory.B[ count = 0, total = 0, min = undefined, "
+                                                        "max = undefined ]\n";
+        const char *EXP_QUANTILES =
+            "\t\tMyCategory.A[ p50 = 1, p90 = 2, p99 = 2, p99.9 = 2 ]\n"
+            "\t\tMyCategory.B[ p50 = undefined, p90 = undefined, "
+                                 "p99 = undefined, p99.9 = undefined ]\n";
+
+        for (int numQuantiles = 0; numQuantiles <= 2; numQuantiles += 2) {
+            balm::MetricSample sample(&ta);
+            sample.setTimeStamp(bdlt::DatetimeTz(bdlt::CurrentTime::utc(), 0));
+            sample.appendGroup(records,
+                               2,
+                               quantiles,
+                               numQuantiles,
+                               bsls::TimeInterval(5, 0));
+
+            bsl::ostringstream stream;
+            Obj mX(stream);
+            mX.publish(sample);
+
+            const bsl::string& OUTPUT = stream.str();
+            if (veryVerbose) {
+                P(OUTPUT);
+            }
+
+            bsl::string expected(EXP_RECORDS);
+            if (numQuantiles) {
+                expected += EXP_QUANTILES;
+            }
+            const bsl::size_t pos = OUTPUT.find('\t');
+            ASSERTV(numQuantiles, bsl::string::npos != pos);
+            ASSERTV(numQuantiles, OUTPUT,
+                    "\tElapsed Time: 5s\n" + expected == OUTPUT.substr(pos));
+        }
+      } break;
       case 1: {
         // --------------------------------------------------------------------
         // BREATHING TEST:
@@ -1939,6 +1939,12 @@ int main(int argc, char *argv[])
                 { L_,     "123.4X",    123.4,           },
                 { L_,     "0.005X",    0.005            },
                 { L_,     "9.99E306X", 9.99E306         },
+                { L_,     "2.2250738585072011e-308X",
+                                       2.2250738585072011e-308  },
+                { L_,     "1e-400X",   0.0              },
+                { L_,     "0.10000000000000000555111512312578270211815834045"
+                          "41015625000000000000000000000000X",
+                                       0.1              },
                 { L_,     "+INFX",     posInf,          },
                 { L_,     "-INFX",     -posInf,         },
                 { L_,     "NaNX",      qNaN             },
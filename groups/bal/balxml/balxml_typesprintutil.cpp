@@ -14,6 +14,7 @@ BSLS_IDENT_RCSID(balxml_typesprintutil_cpp,"$Id$ $CSID$")
 
 #include <bdldfp_decimalutil.h>
 
+#include <bdlb_numericformatterutil.h>
 #include <bdlb_print.h>
 
 #include <bdlde_base64encoder.h>
@@ -724,6 +725,18 @@ bsl::ostream& printDecimalWithOptions(bsl::ostream& stream,
     return stream.write(buffer, (ptr - buffer) + fractionLen);
 }
 
+inline
+bool isShortestFormatRequested(const balxml::EncoderOptions *encoderOptions)
+    // Return 'true' if the specified 'encoderOptions' request that 'float'
+    // and 'double' values be printed using the fewest significant digits that
+    // parse back to the same value (i.e., 'significantDoubleDigits' is set to
+    // 0), and 'false' otherwise.
+{
+    return encoderOptions
+        && !encoderOptions->significantDoubleDigits().isNull()
+        && 0 == encoderOptions->significantDoubleDigits().value();
+}
+
 }  // close unnamed namespace
 
 namespace balxml {
@@ -909,11 +922,11 @@ TypesPrintUtil_Imp::printDecimal(bsl::ostream&               stream,
     return stream;
 }
 
-bsl::ostream& TypesPrintUtil_Imp::printDefault(
-                                            bsl::ostream&               stream,
-                                            const float&                object,
-                                            const EncoderOptions       *,
-                                            bdlat_TypeCategory::Simple)
+bsl::ostream&
+TypesPrintUtil_Imp::printDefault(bsl::ostream&               stream,
+                                 const float&                object,
+                                 const EncoderOptions       *encoderOptions,
+                                 bdlat_TypeCategory::Simple)
 {
     switch (bdlb::Float::classifyFine(object)) {
       case bdlb::Float::k_POSITIVE_INFINITY: {
@@ -929,6 +942,21 @@ bsl::ostream& TypesPrintUtil_Imp::printDefault(
       default: {
         // not a NaN and not +/- INFINITY
 
+        if (isShortestFormatRequested(encoderOptions)) {
+            // Write the shortest representation that parses back to
+            // 'object'.
+
+            char buffer[bdlb::NumericFormatterUtil::k_FLOAT_MAX_LENGTH];
+            const char *end = bdlb::NumericFormatterUtil::toChars(
+                                                       buffer,
+                                                       buffer + sizeof buffer,
+                                                       object);
+            BSLS_ASSERT(0 != end);
+
+            stream.write(buffer, end - buffer);
+            break;
+        }
+
         // On Sun, formatting a 'double' using 'ostream' is 60% slower than
         // 'sprintf', even though the former calls the latter.  Also, note that
         // 'snprintf' is 15% slower than 'sprintf' on Sun.
@@ -955,11 +983,11 @@ bsl::ostream& TypesPrintUtil_Imp::printDefault(
     return stream;
 }
 
-bsl::ostream& TypesPrintUtil_Imp::printDefault(
-                                            bsl::ostream&               stream,
-                                            const double&               object,
-                                            const EncoderOptions       *,
-                                            bdlat_TypeCategory::Simple)
+bsl::ostream&
+TypesPrintUtil_Imp::printDefault(bsl::ostream&               stream,
+                                 const double&               object,
+                                 const EncoderOptions       *encoderOptions,
+                                 bdlat_TypeCategory::Simple)
 {
     switch (bdlb::Float::classifyFine(object)) {
       case bdlb::Float::k_POSITIVE_INFINITY: {
@@ -975,6 +1003,21 @@ bsl::ostream& TypesPrintUtil_Imp::printDefault(
       default: {
         // not a NaN and not +/- INFINITY
 
+        if (isShortestFormatRequested(encoderOptions)) {
+            // Write the shortest representation that parses back to
+            // 'object'.
+
+            char buffer[bdlb::NumericFormatterUtil::k_DOUBLE_MAX_LENGTH];
+            const char *end = bdlb::NumericFormatterUtil::toChars(
+                                                       buffer,
+                                                       buffer + sizeof buffer,
+                                                       object);
+            BSLS_ASSERT(0 != end);
+
+            stream.write(buffer, end - buffer);
+            break;
+        }
+
         // On Sun, formatting a 'double' using 'ostream' is 60% slower than
         // 'sprintf', even though the former calls the latter.  Also, note that
         // 'snprintf' is 15% slower than 'sprintf' on Sun.
@@ -106,6 +106,16 @@ BSLS_IDENT("$Id: $")
 //      Enumeration                         TEXT
 //..
 //
+///Printing Floating-Point Values
+///------------------------------
+// 'printDefault' writes a finite 'float' ('double') value as 'printf' would
+// using the "%.*g" conversion specification with a precision of 'FLT_DIG + 1'
+// ('DBL_DIG + 1').  If the 'significantDoubleDigits' encoder option is set to
+// 0, the value is instead written using the fewest significant digits that
+// parse back to exactly the same value (see 'bdlb_numericformatterutil'), in
+// the same notation (e.g., "0.1", "1234.5", "1.5e-07", "1e+20").  Infinite
+// and NaN values are written as "+INF", "-INF", and "NaN".
+//
 ///Behavior of 'printText' on Non-Valid Strings
 ///--------------------------------------------
 // The output of 'printText' will always be valid XML 1.0 with UTF-8 encoding.
@@ -1708,6 +1708,78 @@ int main(int argc, char *argv[])
             }
         }
 
+        if (verbose) cout << "\nUsing 'float' and 'double' with shortest "
+                             "formatting." << endl;
+        {
+            balxml::EncoderOptions shortest;
+            shortest.setSignificantDoubleDigits(0);
+
+            balxml::EncoderOptions nonZero;
+            nonZero.setSignificantDoubleDigits(3);
+
+            static const struct {
+                int         d_lineNum;
+                float       d_input;
+                const char *d_result;
+                const char *d_defaultResult;
+            } FLOAT_DATA[] = {
+                //line  input         result           default result
+                //----  -----         ------           --------------
+                { L_,   0.1f,         "0.1",           "0.1"              },
+                { L_,   1.0f / 3,     "0.33333334",    "0.3333333"        },
+                { L_,   123456789.0f, "123456790",     "1.234568e+08"     },
+                { L_,   -1.5e-7f,     "-1.5e-07",      "-1.5e-07"         },
+            };
+            const int NUM_FLOAT_DATA = sizeof FLOAT_DATA / sizeof *FLOAT_DATA;
+
+            for (int i = 0; i < NUM_FLOAT_DATA; ++i) {
+                const int    LINE   = FLOAT_DATA[i].d_lineNum;
+                const float  INPUT  = FLOAT_DATA[i].d_input;
+                const char  *RESULT = FLOAT_DATA[i].d_result;
+                const char  *DEFAULT_RESULT = FLOAT_DATA[i].d_defaultResult;
+
+                bsl::stringstream ss;
+                Util::printDefault(ss, INPUT, &shortest);
+                LOOP2_ASSERT(LINE, ss.str(), RESULT == ss.str());
+
+                bsl::stringstream ds;
+                Util::printDefault(ds, INPUT, &nonZero);
+                LOOP2_ASSERT(LINE, ds.str(), DEFAULT_RESULT == ds.str());
+            }
+
+            static const struct {
+                int         d_lineNum;
+                double      d_input;
+                const char *d_result;
+                const char *d_defaultResult;
+            } DOUBLE_DATA[] = {
+                //line  input      result                default result
+                //----  -----      ------                --------------
+                { L_,   0.1,       "0.1",                "0.1"               },
+                { L_,   0.1 + 0.2, "0.30000000000000004","0.3"               },
+                { L_,   1.0 / 3,   "0.3333333333333333", "0.3333333333333333"},
+                { L_,   1.0e23,    "1e+23",
+                                         "9.999999999999999e+22"             },
+            };
+            const int NUM_DOUBLE_DATA =
+                                     sizeof DOUBLE_DATA / sizeof *DOUBLE_DATA;
+
+            for (int i = 0; i < NUM_DOUBLE_DATA; ++i) {
+                const int    LINE   = DOUBLE_DATA[i].d_lineNum;
+                const double INPUT  = DOUBLE_DATA[i].d_input;
+                const char  *RESULT = DOUBLE_DATA[i].d_result;
+                const char  *DEFAULT_RESULT = DOUBLE_DATA[i].d_defaultResult;
+
+                bsl::stringstream ss;
+                Util::printDefault(ss, INPUT, &shortest);
+                LOOP2_ASSERT(LINE, ss.str(), RESULT == ss.str());
+
+                bsl::stringstream ds;
+                Util::printDefault(ds, INPUT, &nonZero);
+                LOOP2_ASSERT(LINE, ds.str(), DEFAULT_RESULT == ds.str());
+            }
+        }
+
         if (verbose) cout << "\nUsing 'Decimal64'." << endl;
         {
             typedef bdldfp::Decimal64 Type;
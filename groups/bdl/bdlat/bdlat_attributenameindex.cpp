@@ -0,0 +1,115 @@
+// bdlat_attributenameindex.cpp                                       -*-C++-*-
+#include <bdlat_attributenameindex.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlat_attributenameindex_cpp,"$Id$ $CSID$")
+
+#include <bslma_newdeleteallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+
+namespace BloombergLP {
+
+                       // ------------------------------
+                       // class bdlat_AttributeNameIndex
+                       // ------------------------------
+
+// PRIVATE MANIPULATORS
+void bdlat_AttributeNameIndex::placeSlot(const Slot& slot)
+{
+    const bsl::size_t mask = d_slots.size() - 1;
+
+    bsl::size_t i = static_cast<bsl::size_t>(slot.d_hash) & mask;
+    while (0 <= d_slots[i].d_nameLength) {
+        i = (i + 1) & mask;
+    }
+    d_slots[i] = slot;
+}
+
+// CREATORS
+bdlat_AttributeNameIndex::bdlat_AttributeNameIndex(
+                                              bslma::Allocator *basicAllocator)
+: d_names(basicAllocator)
+, d_slots(basicAllocator)
+, d_numNames(0)
+{
+}
+
+// MANIPULATORS
+int bdlat_AttributeNameIndex::insert(const char *name,
+                                     int         nameLength,
+                                     int         id)
+{
+    BSLS_ASSERT(0 <= nameLength);
+    BSLS_ASSERT(name || 0 == nameLength);
+
+    const Uint64 hash = hashName(name, nameLength);
+
+    if (!d_slots.empty()
+     && 0 <= findSlot(name, nameLength, hash).d_nameLength) {
+        return -1;                                                    // RETURN
+    }
+
+    // Grow the hash table, if necessary, so that it remains at most half full
+    // after the insertion.
+
+    if (d_slots.size() < 2 * static_cast<bsl::size_t>(d_numNames + 1)) {
+        const Slot emptySlot = { 0, 0, -1, 0 };
+
+        bsl::vector<Slot> oldSlots(d_slots.get_allocator());
+        oldSlots.swap(d_slots);
+        d_slots.assign(oldSlots.empty() ? 8 : 2 * oldSlots.size(),
+                       emptySlot);
+
+        for (bsl::size_t i = 0; i < oldSlots.size(); ++i) {
+            if (0 <= oldSlots[i].d_nameLength) {
+                placeSlot(oldSlots[i]);
+            }
+        }
+    }
+
+    const Slot slot = { hash,
+                        static_cast<int>(d_names.size()),
+                        nameLength,
+                        id };
+
+    d_names.insert(d_names.end(), name, name + nameLength);
+    placeSlot(slot);
+    ++d_numNames;
+
+    return 0;
+}
+
+                  // ------------------------------------------
+                  // struct bdlat_AttributeNameIndexUtil_Holder
+                  // ------------------------------------------
+
+// CREATORS
+bdlat_AttributeNameIndexUtil_Holder::~bdlat_AttributeNameIndexUtil_Holder()
+{
+    void *address = bsls::AtomicOperations::swapPtrAcqRel(&d_index, 0);
+    if (address && this != address) {
+        bdlat_AttributeNameIndex *index =
+                              static_cast<bdlat_AttributeNameIndex *>(address);
+        bslma::NewDeleteAllocator::singleton().deleteObject(index);
+    }
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,711 @@
+// bdlat_attributenameindex.h                                         -*-C++-*-
+#ifndef INCLUDED_BDLAT_ATTRIBUTENAMEINDEX
+#define INCLUDED_BDLAT_ATTRIBUTENAMEINDEX
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a cached hash index from attribute names to attribute ids.
+//
+//@CLASSES:
+//  bdlat_AttributeNameIndex: hash index mapping attribute names to ids
+//  bdlat_AttributeNameIndexUtil: name-based sequence functions using an index
+//
+//@SEE_ALSO: bdlat_sequencefunctions, bdlat_attributeinfo
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'bdlat_AttributeNameIndex', that maps attribute names to attribute ids using
+// an open-addressing hash table, and a utility 'struct',
+// 'bdlat_AttributeNameIndexUtil', that provides drop-in replacements for the
+// name-based 'hasAttribute' and 'manipulateAttribute' functions of
+// 'bdlat_SequenceFunctions'.
+//
+// Decoders (e.g., for JSON and XML) resolve the name of each element they
+// read to an attribute of the sequence being decoded.  The name-based
+// functions of 'bdlat_SequenceFunctions' forward this lookup to the type
+// itself.  For types generated by 'bas_codegen.pl', the cost of the
+// generated 'lookupAttributeInfo' grows with the number of attributes: it
+// compares the name character by character with the attribute names of the
+// same length and, for a sequence having untagged choices, it first compares
+// the name case-insensitively with every selection name of those choices.
+// The functions of 'bdlat_AttributeNameIndexUtil' instead look the name up,
+// in constant time, in a 'bdlat_AttributeNameIndex' that is built the first
+// time a given sequence type is looked up, and then dispatch to the attribute
+// by id.
+//
+// A lookup in the index costs about as much as comparing the name with eight
+// attribute names in turn, and a name that is not in the index is then looked
+// up by the type itself as well.  Indexing therefore pays off only for types
+// having many attributes, and a type having fewer than
+// 'bdlat_AttributeNameIndexUtil::k_MIN_NUM_ATTRIBUTES' (16) attributes is not
+// indexed.  On a typical x86-64 host, a lookup in the index takes 6 to 10ns
+// whatever the number of names, whereas comparing the name with each of 4, 8,
+// 16, 32, and 160 typical attribute names in turn takes about 7ns, 8ns, 13ns,
+// 20ns, and 105ns, respectively (see test case -1 of the test driver).
+//
+///Which Types Are Indexed
+///-----------------------
+// An index is built only for types having the 'bdlat_TypeTraitBasicSequence'
+// trait (i.e., generated types), whose set of attributes is a property of the
+// type and not of a particular object, and having at least
+// 'bdlat_AttributeNameIndexUtil::k_MIN_NUM_ATTRIBUTES' attributes.  Whether a
+// generated type has enough attributes to be indexed is determined, once, the
+// first time it is looked up.  The lookups of types that are not indexed
+// (including types plugged into the 'bdlat' framework by overloading the
+// 'bdlat_sequence*' functions, whose attributes may vary from object to
+// object) are forwarded directly to the corresponding
+// 'bdlat_SequenceFunctions' function.
+//
+// The index of a type contains only those attribute names that the type's own
+// name-based lookup resolves to the same attribute.  Names that are not in the
+// index (e.g., names that are unknown, that differ from an attribute name only
+// in case, or that name a selection of an untagged choice) are forwarded to
+// the corresponding 'bdlat_SequenceFunctions' function, so that the result of
+// every function of 'bdlat_AttributeNameIndexUtil' is the same as that of the
+// function it replaces.
+//
+///Thread Safety
+///-------------
+// 'bdlat_AttributeNameIndex' is *const* *thread-safe*: distinct threads may
+// safely call its accessors concurrently.  The functions of
+// 'bdlat_AttributeNameIndexUtil' are *thread-safe*.  The index of each type is
+// held by a function-local static object, is allocated from the
+// 'bslma::NewDeleteAllocator' singleton the first time it is needed, and is
+// deallocated when that static object is destroyed at program exit; if
+// several threads race to build the index of the same type, all but one of
+// the indices built are discarded.  The functions of
+// 'bdlat_AttributeNameIndexUtil' must not be called during the destruction of
+// static objects.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Looking Up the Attribute Id of a Name
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a sequence type having several attributes, and we want to
+// find the id of an attribute given its name.
+//
+// First, we create an index and insert the name and id of each attribute:
+//..
+//  bdlat_AttributeNameIndex index;
+//
+//  int rc = index.insert("firstName", 9, 1);
+//  assert(0 == rc);
+//  rc = index.insert("lastName", 8, 2);
+//  assert(0 == rc);
+//  rc = index.insert("age", 3, 3);
+//  assert(0 == rc);
+//  assert(3 == index.numNames());
+//..
+// Then, we observe that inserting a name that is already in the index fails
+// and has no effect:
+//..
+//  rc = index.insert("age", 3, 4);
+//  assert(0 != rc);
+//  assert(3 == index.numNames());
+//..
+// Now, we look up a name, and obtain the id of the corresponding attribute:
+//..
+//  int id = 0;
+//  rc = index.find(&id, "lastName", 8);
+//  assert(0 == rc);
+//  assert(2 == id);
+//..
+// Finally, we observe that looking up a name that is not in the index fails
+// and does not modify 'id':
+//..
+//  rc = index.find(&id, "LastName", 8);
+//  assert(0 != rc);
+//  assert(2 == id);
+//..
+// Note that decoders do not use 'bdlat_AttributeNameIndex' directly; instead
+// they call 'bdlat_AttributeNameIndexUtil::hasAttribute' and
+// 'bdlat_AttributeNameIndexUtil::manipulateAttribute' wherever they would
+// otherwise call the name-based functions of 'bdlat_SequenceFunctions'.
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLAT_SEQUENCEFUNCTIONS
+#include <bdlat_sequencefunctions.h>
+#endif
+
+#ifndef INCLUDED_BDLAT_TYPETRAITS
+#include <bdlat_typetraits.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITS
+#include <bslalg_typetraits.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_NEWDELETEALLOCATOR
+#include <bslma_newdeleteallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_RAWDELETERPROCTOR
+#include <bslma_rawdeleterproctor.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTRING
+#include <bsl_cstring.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+namespace BloombergLP {
+
+                       // ==============================
+                       // class bdlat_AttributeNameIndex
+                       // ==============================
+
+class bdlat_AttributeNameIndex {
+    // This class provides an index that maps attribute names to attribute
+    // ids.  Names are compared exactly (i.e., case-sensitively).  The index is
+    // an open-addressing hash table with linear probing that is kept at most
+    // half full.  Each slot holds the hash value, location, length, and id of
+    // its name, so that a successful lookup typically reads a single slot and
+    // compares the supplied name against a single stored name.  The hash of a
+    // name is computed in constant time from its length and its first and
+    // last (up to) eight characters, which, for attribute names, is both
+    // faster than hashing every character and sufficient to distinguish them.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+
+    struct Slot {
+        // This 'struct' describes one slot of the hash table.
+
+        Uint64 d_hash;        // hash of the name
+        int    d_offset;      // offset of the name in 'd_names'
+        int    d_nameLength;  // length of the name, or -1 if this slot is
+                              // empty
+        int    d_id;          // attribute id
+    };
+
+    // DATA
+    bsl::vector<char> d_names;     // all names, concatenated
+    bsl::vector<Slot> d_slots;     // hash table; size is 0 or a power of 2
+    int               d_numNames;  // number of names in the index
+
+    // NOT IMPLEMENTED
+    bdlat_AttributeNameIndex(const bdlat_AttributeNameIndex&);
+    bdlat_AttributeNameIndex& operator=(const bdlat_AttributeNameIndex&);
+
+    // PRIVATE CLASS METHODS
+    static Uint64 hashName(const char *name, int nameLength);
+        // Return the hash value of the specified 'name' of the specified
+        // 'nameLength'.
+
+    // PRIVATE MANIPULATORS
+    void placeSlot(const Slot& slot);
+        // Copy the specified 'slot' to the first empty slot of its probe
+        // sequence.  The behavior is undefined unless the hash table has an
+        // empty slot.
+
+    // PRIVATE ACCESSORS
+    const Slot& findSlot(const char *name, int nameLength, Uint64 hash) const;
+        // Return a reference to the slot holding the specified 'name' of the
+        // specified 'nameLength', whose hash is the specified 'hash', or to
+        // the empty slot that terminates its probe sequence if 'name' is not
+        // in this index.  The behavior is undefined unless the hash table has
+        // an empty slot.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(bdlat_AttributeNameIndex,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit bdlat_AttributeNameIndex(bslma::Allocator *basicAllocator = 0);
+        // Create an empty index.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
+    //! ~bdlat_AttributeNameIndex() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    int insert(const char *name, int nameLength, int id);
+        // Insert into this index the specified 'name' of the specified
+        // 'nameLength', mapped to the specified 'id', if 'name' is not
+        // already in this index.  Return 0 on success, and a non-zero value,
+        // with no effect, if 'name' is already in this index.  The behavior
+        // is undefined unless '0 <= nameLength' and 'name' refers to at least
+        // 'nameLength' characters.
+
+    // ACCESSORS
+    int find(int *id, const char *name, int nameLength) const;
+        // Load into the specified 'id' the id mapped to the specified 'name'
+        // of the specified 'nameLength'.  Return 0 on success, and a non-zero
+        // value, with no effect on 'id', if 'name' is not in this index.  The
+        // behavior is undefined unless '0 <= nameLength' and 'name' refers to
+        // at least 'nameLength' characters.
+
+    int numNames() const;
+        // Return the number of names in this index.
+};
+
+                     // ==================================
+                     // struct bdlat_AttributeNameIndexUtil
+                     // ==================================
+
+struct bdlat_AttributeNameIndexUtil {
+    // This 'struct' provides a namespace for functions that look up the
+    // attributes of a sequence by name using a 'bdlat_AttributeNameIndex'
+    // built once per sequence type.  See the component-level documentation
+    // for more information.
+
+  private:
+    // PRIVATE CLASS METHODS
+    template <class TYPE>
+    static const bdlat_AttributeNameIndex *indexImp(const TYPE&   object,
+                                                    bsl::true_type);
+    template <class TYPE>
+    static const bdlat_AttributeNameIndex *indexImp(const TYPE&   object,
+                                                    bsl::false_type);
+        // Return the address of the index of the attributes of the
+        // (template parameter) 'TYPE', built from the specified 'object' if
+        // it has not been built yet, or 0 if 'TYPE' is not indexed.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_MIN_NUM_ATTRIBUTES = 16  // minimum number of attributes of an
+                                   // indexed type
+    };
+
+    // CLASS METHODS
+    template <class TYPE>
+    static bool hasAttribute(const TYPE&  object,
+                             const char  *attributeName,
+                             int          attributeNameLength);
+        // Return 'true' if the specified 'object' has an attribute with the
+        // specified 'attributeName' of the specified 'attributeNameLength',
+        // and 'false' otherwise.  The result is the same as that of
+        // 'bdlat_SequenceFunctions::hasAttribute'.
+
+    template <class TYPE>
+    static const bdlat_AttributeNameIndex *index(const TYPE& object);
+        // Return the address of the index of the attributes of the
+        // (template parameter) 'TYPE', building it from the specified
+        // 'object' if it has not been built yet, or 0 if 'TYPE' is not
+        // indexed (i.e., does not have the 'bdlat_TypeTraitBasicSequence'
+        // trait, or has fewer than 'k_MIN_NUM_ATTRIBUTES' attributes).
+
+    template <class TYPE, class MANIPULATOR>
+    static int manipulateAttribute(TYPE         *object,
+                                   MANIPULATOR&  manipulator,
+                                   const char   *attributeName,
+                                   int           attributeNameLength);
+        // Invoke the specified 'manipulator' on the address of the
+        // (modifiable) attribute indicated by the specified 'attributeName'
+        // and 'attributeNameLength' of the specified 'object', supplying
+        // 'manipulator' with the corresponding attribute information
+        // structure.  Return non-zero value if the attribute is not found, and
+        // the value returned from the invocation of 'manipulator' otherwise.
+        // The result is the same as that of
+        // 'bdlat_SequenceFunctions::manipulateAttribute'.
+};
+
+                  // ==========================================
+                  // struct bdlat_AttributeNameIndexUtil_Holder
+                  // ==========================================
+
+struct bdlat_AttributeNameIndexUtil_Holder {
+    // This component-private 'struct' holds the address of the index of a
+    // sequence type, allocated from the 'bslma::NewDeleteAllocator'
+    // singleton, and deallocates that index on destruction.  The address held
+    // is 0 if it has not been determined yet whether the type is indexed, and
+    // the address of this object if the type is not indexed.  This 'struct'
+    // is an aggregate so that a function-local static object of this type is
+    // initialized statically: only the registration of its destructor is
+    // performed on first use.
+
+    // DATA
+    bsls::AtomicOperations::AtomicTypes::Pointer d_index;
+                                    // address of the index, of this object,
+                                    // or 0
+
+    // CREATORS
+    ~bdlat_AttributeNameIndexUtil_Holder();
+        // Destroy this object, deallocating the index it holds, if any.
+};
+
+                 // ===========================================
+                 // struct bdlat_AttributeNameIndexUtil_Counter
+                 // ===========================================
+
+struct bdlat_AttributeNameIndexUtil_Counter {
+    // This component-private 'struct' provides an accessor that counts the
+    // attributes it is invoked on.
+
+    // DATA
+    int d_numAttributes;  // number of attributes visited
+
+    // MANIPULATORS
+    template <class MEMBER_TYPE, class INFO_TYPE>
+    int operator()(const MEMBER_TYPE&, const INFO_TYPE&)
+        // Increment the number of attributes visited and return 0.
+    {
+        ++d_numAttributes;
+        return 0;
+    }
+};
+
+                  // ==========================================
+                  // class bdlat_AttributeNameIndexUtil_Builder
+                  // ==========================================
+
+template <class TYPE>
+class bdlat_AttributeNameIndexUtil_Builder {
+    // This component-private class provides an accessor that inserts into an
+    // index the name of each attribute it is invoked on, provided that the
+    // name-based lookup of the (template parameter) 'TYPE' resolves that name
+    // to the same attribute.
+
+    // PRIVATE TYPES
+    struct IdProbe {
+        // This 'struct' provides an accessor that records the id of the
+        // attribute it is invoked on.
+
+        // DATA
+        int d_id;  // id of the last attribute visited
+
+        // MANIPULATORS
+        template <class MEMBER_TYPE, class INFO_TYPE>
+        int operator()(const MEMBER_TYPE&, const INFO_TYPE& info)
+            // Record the id of the specified 'info' and return 0.
+        {
+            d_id = info.id();
+            return 0;
+        }
+    };
+
+    // DATA
+    const TYPE               *d_object_p;  // object being indexed
+    bdlat_AttributeNameIndex *d_index_p;   // index being built (held)
+
+  public:
+    // CREATORS
+    bdlat_AttributeNameIndexUtil_Builder(const TYPE               *object,
+                                         bdlat_AttributeNameIndex *index);
+        // Create a builder that inserts the attributes of the specified
+        // 'object' into the specified 'index'.
+
+    // MANIPULATORS
+    template <class MEMBER_TYPE, class INFO_TYPE>
+    int operator()(const MEMBER_TYPE&, const INFO_TYPE& info);
+        // Insert the name and id of the specified 'info' into the index held
+        // by this object if the name-based lookup of the object held by this
+        // builder resolves that name to the attribute having that id.  Return
+        // 0.
+};
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                       // ------------------------------
+                       // class bdlat_AttributeNameIndex
+                       // ------------------------------
+
+// PRIVATE CLASS METHODS
+inline
+bdlat_AttributeNameIndex::Uint64
+bdlat_AttributeNameIndex::hashName(const char *name, int nameLength)
+{
+    static const Uint64 k_MULTIPLIER = 0x9e3779b97f4a7c15ULL;
+
+    Uint64 head = 0;
+    Uint64 tail = 0;
+    if (8 <= nameLength) {
+        bsl::memcpy(&head, name, 8);
+        bsl::memcpy(&tail, name + nameLength - 8, 8);
+    }
+    else if (4 <= nameLength) {
+        unsigned int word;
+        bsl::memcpy(&word, name, 4);
+        head = word;
+        bsl::memcpy(&word, name + nameLength - 4, 4);
+        tail = word;
+    }
+    else {
+        for (int i = 0; i < nameLength; ++i) {
+            head = (head << 8) | static_cast<unsigned char>(name[i]);
+        }
+    }
+
+    Uint64 hash = (head ^ (static_cast<Uint64>(nameLength) << 56))
+                                                                * k_MULTIPLIER;
+    hash ^= hash >> 32;
+    hash  = (hash ^ tail) * k_MULTIPLIER;
+    hash ^= hash >> 32;
+    hash *= k_MULTIPLIER;
+    return hash ^ (hash >> 32);
+}
+
+// PRIVATE ACCESSORS
+inline
+const bdlat_AttributeNameIndex::Slot&
+bdlat_AttributeNameIndex::findSlot(const char *name,
+                                   int         nameLength,
+                                   Uint64      hash) const
+{
+    const bsl::size_t mask = d_slots.size() - 1;
+
+    for (bsl::size_t i = static_cast<bsl::size_t>(hash) & mask;;
+                                                          i = (i + 1) & mask) {
+        const Slot& slot = d_slots[i];
+        if (slot.d_nameLength < 0
+         || (slot.d_hash == hash
+          && slot.d_nameLength == nameLength
+          && (0 == nameLength
+           || 0 == bsl::memcmp(d_names.data() + slot.d_offset,
+                               name,
+                               nameLength)))) {
+            return slot;                                              // RETURN
+        }
+    }
+}
+
+// ACCESSORS
+inline
+int bdlat_AttributeNameIndex::find(int        *id,
+                                   const char *name,
+                                   int         nameLength) const
+{
+    BSLS_ASSERT_SAFE(id);
+    BSLS_ASSERT_SAFE(0 <= nameLength);
+    BSLS_ASSERT_SAFE(name || 0 == nameLength);
+
+    if (d_slots.empty()) {
+        return -1;                                                    // RETURN
+    }
+
+    const Slot& slot = findSlot(name, nameLength, hashName(name, nameLength));
+    if (slot.d_nameLength < 0) {
+        return -1;                                                    // RETURN
+    }
+
+    *id = slot.d_id;
+    return 0;
+}
+
+inline
+int bdlat_AttributeNameIndex::numNames() const
+{
+    return d_numNames;
+}
+
+                     // ----------------------------------
+                     // struct bdlat_AttributeNameIndexUtil
+                     // ----------------------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+const bdlat_AttributeNameIndex *bdlat_AttributeNameIndexUtil::indexImp(
+                                                        const TYPE&   object,
+                                                        bsl::true_type)
+{
+    static bdlat_AttributeNameIndexUtil_Holder s_holder = { { 0 } };
+
+    void *const notIndexed = &s_holder;
+
+    void *current = bsls::AtomicOperations::getPtrAcquire(&s_holder.d_index);
+    if (current) {
+        return notIndexed == current
+               ? 0
+               : static_cast<const bdlat_AttributeNameIndex *>(current);
+                                                                      // RETURN
+    }
+
+    bdlat_AttributeNameIndexUtil_Counter counter = { 0 };
+    bdlat_SequenceFunctions::accessAttributes(object, counter);
+
+    if (counter.d_numAttributes < k_MIN_NUM_ATTRIBUTES) {
+        // Every thread racing to reach this point publishes the same value.
+
+        bsls::AtomicOperations::setPtrRelease(&s_holder.d_index, notIndexed);
+        return 0;                                                     // RETURN
+    }
+
+    bslma::Allocator         *allocator =
+                                       &bslma::NewDeleteAllocator::singleton();
+    bdlat_AttributeNameIndex *index     = new (*allocator)
+                                           bdlat_AttributeNameIndex(allocator);
+    bslma::RawDeleterProctor<bdlat_AttributeNameIndex, bslma::Allocator>
+                                                     proctor(index, allocator);
+
+    bdlat_AttributeNameIndexUtil_Builder<TYPE> builder(&object, index);
+    bdlat_SequenceFunctions::accessAttributes(object, builder);
+
+    proctor.release();
+
+    current = bsls::AtomicOperations::testAndSwapPtrAcqRel(&s_holder.d_index,
+                                                           0,
+                                                           index);
+    if (current) {
+        // Another thread published its index first.
+
+        allocator->deleteObject(index);
+        return static_cast<const bdlat_AttributeNameIndex *>(current);
+                                                                      // RETURN
+    }
+    return index;
+}
+
+template <class TYPE>
+inline
+const bdlat_AttributeNameIndex *bdlat_AttributeNameIndexUtil::indexImp(
+                                                        const TYPE&,
+                                                        bsl::false_type)
+{
+    return 0;
+}
+
+// CLASS METHODS
+template <class TYPE>
+inline
+bool bdlat_AttributeNameIndexUtil::hasAttribute(
+                                              const TYPE&  object,
+                                              const char  *attributeName,
+                                              int          attributeNameLength)
+{
+    const bdlat_AttributeNameIndex *nameIndex = index(object);
+
+    int id;
+    if (nameIndex
+     && 0 == nameIndex->find(&id, attributeName, attributeNameLength)) {
+        return true;                                                  // RETURN
+    }
+    return bdlat_SequenceFunctions::hasAttribute(object,
+                                                 attributeName,
+                                                 attributeNameLength);
+}
+
+template <class TYPE>
+inline
+const bdlat_AttributeNameIndex *bdlat_AttributeNameIndexUtil::index(
+                                                            const TYPE& object)
+{
+    typedef bsl::integral_constant<bool,
+            bslalg::HasTrait<TYPE, bdlat_TypeTraitBasicSequence>::VALUE>
+                                                                   IsIndexed;
+
+    return indexImp(object, IsIndexed());
+}
+
+template <class TYPE, class MANIPULATOR>
+inline
+int bdlat_AttributeNameIndexUtil::manipulateAttribute(
+                                             TYPE         *object,
+                                             MANIPULATOR&  manipulator,
+                                             const char   *attributeName,
+                                             int           attributeNameLength)
+{
+    const bdlat_AttributeNameIndex *nameIndex = index(*object);
+
+    int id;
+    if (nameIndex
+     && 0 == nameIndex->find(&id, attributeName, attributeNameLength)) {
+        return bdlat_SequenceFunctions::manipulateAttribute(object,
+                                                            manipulator,
+                                                            id);      // RETURN
+    }
+    return bdlat_SequenceFunctions::manipulateAttribute(object,
+                                                        manipulator,
+                                                        attributeName,
+                                                        attributeNameLength);
+}
+
+                   // ------------------------------------------
+                   // class bdlat_AttributeNameIndexUtil_Builder
+                   // ------------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+bdlat_AttributeNameIndexUtil_Builder<TYPE>::
+bdlat_AttributeNameIndexUtil_Builder(const TYPE               *object,
+                                     bdlat_AttributeNameIndex *index)
+: d_object_p(object)
+, d_index_p(index)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+template <class MEMBER_TYPE, class INFO_TYPE>
+int bdlat_AttributeNameIndexUtil_Builder<TYPE>::operator()(
+                                                       const MEMBER_TYPE&,
+                                                       const INFO_TYPE& info)
+{
+    IdProbe probe = { 0 };
+
+    if (0 == bdlat_SequenceFunctions::accessAttribute(*d_object_p,
+                                                      probe,
+                                                      info.name(),
+                                                      info.nameLength())
+     && info.id() == probe.d_id) {
+        d_index_p->insert(info.name(), info.nameLength(), info.id());
+    }
+    return 0;
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1023 @@
+// bdlat_attributenameindex.t.cpp                                     -*-C++-*-
+#include <bdlat_attributenameindex.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlat_attributeinfo.h>
+#include <bdlat_formattingmode.h>
+#include <bdlat_sequencefunctions.h>
+#include <bdlat_typetraits.h>
+
+#include <bslalg_typetraits.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test provides a hash index from names to ids, and a
+// utility that uses a per-type instance of that index to look up the
+// attributes of generated sequence types.  We first verify the index in
+// isolation: every inserted name is found with its id, names that are not
+// inserted (including prefixes, extensions, and case variants of inserted
+// names) are not found, duplicates are rejected, and the table grows
+// correctly.  We then verify, using a sequence type that counts the calls to
+// its own name-based lookup, that the utility dispatches indexed names by id,
+// that it forwards names that are not indexed to the type (so that aliases
+// accepted by the type continue to work and names rejected by the type
+// continue to be rejected), that the index of a type is built exactly once
+// and shared by all objects of that type, and that types having fewer than
+// 'k_MIN_NUM_ATTRIBUTES' attributes are not indexed.
+// ----------------------------------------------------------------------------
+// bdlat_AttributeNameIndex
+// [ 2] bdlat_AttributeNameIndex(bslma::Allocator *basicAllocator = 0);
+// [ 2] int insert(const char *name, int nameLength, int id);
+// [ 2] int find(int *id, const char *name, int nameLength) const;
+// [ 2] int numNames() const;
+//
+// bdlat_AttributeNameIndexUtil
+// [ 3] bool hasAttribute(const TYPE&, const char *, int);
+// [ 3] const bdlat_AttributeNameIndex *index(const TYPE& object);
+// [ 3] int manipulateAttribute(TYPE *, MANIPULATOR&, const char *, int);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: Results are identical to those of 'bdlat_SequenceFunctions'.
+// [ 3] CONCERN: The index of a type is built once.
+// [ 4] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'find' VS. LINEAR SEARCH
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlat_AttributeNameIndex     Obj;
+typedef bdlat_AttributeNameIndexUtil Util;
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace test {
+
+enum { k_MAX_NUM_ATTRIBUTES = 64 };
+
+const bdlat_AttributeInfo *attributeInfoArray()
+    // Return the address of an array of 'k_MAX_NUM_ATTRIBUTES' attribute
+    // information structures: the attributes "name", "age", and "hidden",
+    // having the ids 10, 20, and 30, followed by the attributes "field<I>",
+    // having the id '100 + I', for each index 'I' from 3.
+{
+    static bdlat_AttributeInfo s_info[k_MAX_NUM_ATTRIBUTES];
+    static char                s_names[k_MAX_NUM_ATTRIBUTES][16];
+    static bool                s_initialized = false;
+
+    if (!s_initialized) {
+        static const char *const NAMES[] = { "name", "age", "hidden" };
+        static const int         IDS[]   = { 10, 20, 30 };
+
+        for (int i = 0; i < k_MAX_NUM_ATTRIBUTES; ++i) {
+            if (i < 3) {
+                bsl::strcpy(s_names[i], NAMES[i]);
+                s_info[i].d_id = IDS[i];
+            }
+            else {
+                bsl::sprintf(s_names[i], "field%d", i);
+                s_info[i].d_id = 100 + i;
+            }
+            s_info[i].d_name_p         = s_names[i];
+            s_info[i].d_nameLength     =
+                                     static_cast<int>(bsl::strlen(s_names[i]));
+            s_info[i].d_annotation_p   = "";
+            s_info[i].d_formattingMode = bdlat_FormattingMode::e_DEFAULT;
+        }
+        s_initialized = true;
+    }
+    return s_info;
+}
+
+template <int NUM_ATTRIBUTES>
+class Record {
+    // This class is a sequence, in the style of a generated type, having the
+    // (template parameter) 'NUM_ATTRIBUTES' first 'int' attributes described
+    // by 'attributeInfoArray'.  Its name-based lookup, whose invocations are
+    // counted, accepts the name of each attribute and the alias "years" for
+    // "age", but rejects the name "hidden" of its third attribute (so that
+    // the third attribute can only be reached by id).
+
+    BSLMF_ASSERT(3 <= NUM_ATTRIBUTES);
+    BSLMF_ASSERT(NUM_ATTRIBUTES <= k_MAX_NUM_ATTRIBUTES);
+
+  public:
+    // TYPES
+    enum {
+        ATTRIBUTE_ID_NAME   = 10,
+        ATTRIBUTE_ID_AGE    = 20,
+        ATTRIBUTE_ID_HIDDEN = 30
+    };
+
+    enum {
+        ATTRIBUTE_INDEX_NAME   = 0,
+        ATTRIBUTE_INDEX_AGE    = 1,
+        ATTRIBUTE_INDEX_HIDDEN = 2
+    };
+
+    // CLASS DATA
+    static int s_numNameLookups;  // number of calls to the name-based
+                                  // 'lookupAttributeInfo'
+
+    // TRAITS
+    BSLALG_DECLARE_NESTED_TRAITS(Record, bdlat_TypeTraitBasicSequence);
+
+  private:
+    // DATA
+    int d_values[NUM_ATTRIBUTES];
+
+  public:
+    // CLASS METHODS
+    static const bdlat_AttributeInfo *lookupAttributeInfo(int id)
+        // Return attribute information for the attribute indicated by the
+        // specified 'id' if the attribute exists, and 0 otherwise.
+    {
+        const bdlat_AttributeInfo *info = attributeInfoArray();
+        for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+            if (id == info[i].d_id) {
+                return info + i;                                      // RETURN
+            }
+        }
+        return 0;
+    }
+
+    static const bdlat_AttributeInfo *lookupAttributeInfo(
+                                                        const char *name,
+                                                        int         nameLength)
+        // Return attribute information for the attribute indicated by the
+        // specified 'name' of the specified 'nameLength' if the attribute
+        // exists, and 0 otherwise.
+    {
+        ++s_numNameLookups;
+
+        const bdlat_AttributeInfo *info = attributeInfoArray();
+        const bsl::string          key(name, nameLength);
+        if ("years" == key) {
+            return &info[ATTRIBUTE_INDEX_AGE];                        // RETURN
+        }
+        for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+            if (ATTRIBUTE_INDEX_HIDDEN != i && info[i].d_name_p == key) {
+                return info + i;                                      // RETURN
+            }
+        }
+        return 0;
+    }
+
+    // CREATORS
+    Record()
+        // Create a 'Record' having all attributes equal to 0.
+    {
+        for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+            d_values[i] = 0;
+        }
+    }
+
+    // MANIPULATORS
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR& manipulator, int id)
+        // Invoke the specified 'manipulator' on the attribute having the
+        // specified 'id'.
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(id);
+        if (0 == info) {
+            return -1;                                                // RETURN
+        }
+        return manipulator(&d_values[info - attributeInfoArray()], *info);
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR&  manipulator,
+                            const char   *name,
+                            int           nameLength)
+        // Invoke the specified 'manipulator' on the attribute having the
+        // specified 'name' of the specified 'nameLength'.
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(name,
+                                                              nameLength);
+        if (0 == info) {
+            return -1;                                                // RETURN
+        }
+        return manipulateAttribute(manipulator, info->d_id);
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttributes(MANIPULATOR& manipulator)
+        // Invoke the specified 'manipulator' on each attribute.
+    {
+        const bdlat_AttributeInfo *info = attributeInfoArray();
+        for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+            const int rc = manipulator(&d_values[i], info[i]);
+            if (rc) {
+                return rc;                                            // RETURN
+            }
+        }
+        return 0;
+    }
+
+    // ACCESSORS
+    template <class ACCESSOR>
+    int accessAttribute(ACCESSOR& accessor, int id) const
+        // Invoke the specified 'accessor' on the attribute having the
+        // specified 'id'.
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(id);
+        if (0 == info) {
+            return -1;                                                // RETURN
+        }
+        return accessor(d_values[info - attributeInfoArray()], *info);
+    }
+
+    template <class ACCESSOR>
+    int accessAttribute(ACCESSOR&   accessor,
+                        const char *name,
+                        int         nameLength) const
+        // Invoke the specified 'accessor' on the attribute having the
+        // specified 'name' of the specified 'nameLength'.
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(name,
+                                                              nameLength);
+        if (0 == info) {
+            return -1;                                                // RETURN
+        }
+        return accessAttribute(accessor, info->d_id);
+    }
+
+    template <class ACCESSOR>
+    int accessAttributes(ACCESSOR& accessor) const
+        // Invoke the specified 'accessor' on each attribute.
+    {
+        const bdlat_AttributeInfo *info = attributeInfoArray();
+        for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+            const int rc = accessor(d_values[i], info[i]);
+            if (rc) {
+                return rc;                                            // RETURN
+            }
+        }
+        return 0;
+    }
+};
+
+template <int NUM_ATTRIBUTES>
+int Record<NUM_ATTRIBUTES>::s_numNameLookups = 0;
+
+typedef Record<3>                                          SmallRecord;
+typedef Record<bdlat_AttributeNameIndexUtil::k_MIN_NUM_ATTRIBUTES - 1>
+                                                           LargestSmallRecord;
+typedef Record<bdlat_AttributeNameIndexUtil::k_MIN_NUM_ATTRIBUTES>
+                                                           LargeRecord;
+
+struct NotGenerated {
+    // This 'struct' does not have the 'bdlat_TypeTraitBasicSequence' trait.
+};
+
+struct SetValue {
+    // This 'struct' provides a manipulator that sets an 'int' attribute to a
+    // value and records the id of the attribute.
+
+    // DATA
+    int d_value;  // value to set
+    int d_id;     // id of the last attribute manipulated
+
+    // MANIPULATORS
+    int operator()(int *value, const bdlat_AttributeInfo& info)
+        // Set the specified 'value' to 'd_value', record the id of the
+        // specified 'info', and return 0.
+    {
+        *value = d_value;
+        d_id   = info.id();
+        return 0;
+    }
+};
+
+struct GetValue {
+    // This 'struct' provides an accessor that records the value of an 'int'
+    // attribute.
+
+    // DATA
+    int d_value;  // value of the last attribute accessed
+
+    // MANIPULATORS
+    int operator()(const int& value, const bdlat_AttributeInfo&)
+        // Record the specified 'value' and return 0.
+    {
+        d_value = value;
+        return 0;
+    }
+};
+
+template <class RECORD>
+void testHasAttribute(int         line,
+                      const char *name,
+                      bool        expected,
+                      int         expectedNumLookups)
+    // Verify that 'bdlat_AttributeNameIndexUtil::hasAttribute' returns the
+    // specified 'expected' value for the specified 'name' and an object of
+    // the (template parameter) 'RECORD' type, as does
+    // 'bdlat_SequenceFunctions::hasAttribute', and that it calls the
+    // name-based lookup of 'RECORD' the specified 'expectedNumLookups' times.
+    // Use the specified 'line' to report errors.
+{
+    const int    LENGTH = static_cast<int>(bsl::strlen(name));
+    const RECORD X;
+
+    ASSERTV(line, expected == bdlat_SequenceFunctions::hasAttribute(X,
+                                                                    name,
+                                                                    LENGTH));
+
+    RECORD::s_numNameLookups = 0;
+
+    ASSERTV(line, expected == Util::hasAttribute(X, name, LENGTH));
+    ASSERTV(line, RECORD::s_numNameLookups,
+            expectedNumLookups == RECORD::s_numNameLookups);
+}
+
+template <class RECORD>
+void testManipulateAttribute(int         line,
+                             const char *name,
+                             int         expectedId,
+                             int         expectedNumLookups)
+    // Verify that 'bdlat_AttributeNameIndexUtil::manipulateAttribute'
+    // manipulates the attribute having the specified 'expectedId' when
+    // supplied the specified 'name' and an object of the (template parameter)
+    // 'RECORD' type, or fails if 'expectedId' is 0, and that it calls the
+    // name-based lookup of 'RECORD' the specified 'expectedNumLookups' times.
+    // Use the specified 'line' to report errors.
+{
+    const int LENGTH = static_cast<int>(bsl::strlen(name));
+
+    RECORD   mX;  const RECORD& X = mX;
+    SetValue setValue = { line, 0 };
+
+    RECORD::s_numNameLookups = 0;
+
+    const int rc = Util::manipulateAttribute(&mX, setValue, name, LENGTH);
+
+    ASSERTV(line, RECORD::s_numNameLookups,
+            expectedNumLookups == RECORD::s_numNameLookups);
+
+    if (0 == expectedId) {
+        ASSERTV(line, rc, 0 != rc);
+        ASSERTV(line, setValue.d_id, 0 == setValue.d_id);
+        return;                                                       // RETURN
+    }
+
+    ASSERTV(line, rc, 0 == rc);
+    ASSERTV(line, setValue.d_id, expectedId == setValue.d_id);
+
+    GetValue getValue = { 0 };
+    ASSERTV(line, 0 == bdlat_SequenceFunctions::accessAttribute(X,
+                                                                getValue,
+                                                                expectedId));
+    ASSERTV(line, getValue.d_value, line == getValue.d_value);
+}
+
+}  // close namespace test
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test            = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose         = argc > 2;
+    const bool veryVerbose     = argc > 3;
+    const bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Looking Up the Attribute Id of a Name
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a sequence type having several attributes, and we want to
+// find the id of an attribute given its name.
+//
+// First, we create an index and insert the name and id of each attribute:
+//..
+    bdlat_AttributeNameIndex index;
+
+    int rc = index.insert("firstName", 9, 1);
+    ASSERT(0 == rc);
+    rc = index.insert("lastName", 8, 2);
+    ASSERT(0 == rc);
+    rc = index.insert("age", 3, 3);
+    ASSERT(0 == rc);
+    ASSERT(3 == index.numNames());
+//..
+// Then, we observe that inserting a name that is already in the index fails
+// and has no effect:
+//..
+    rc = index.insert("age", 3, 4);
+    ASSERT(0 != rc);
+    ASSERT(3 == index.numNames());
+//..
+// Now, we look up a name, and obtain the id of the corresponding attribute:
+//..
+    int id = 0;
+    rc = index.find(&id, "lastName", 8);
+    ASSERT(0 == rc);
+    ASSERT(2 == id);
+//..
+// Finally, we observe that looking up a name that is not in the index fails
+// and does not modify 'id':
+//..
+    rc = index.find(&id, "LastName", 8);
+    ASSERT(0 != rc);
+    ASSERT(2 == id);
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'bdlat_AttributeNameIndexUtil'
+        //
+        // Concerns:
+        //: 1 For an indexed type, a name that the type's own lookup resolves
+        //:   to an attribute is dispatched by id, without calling the type's
+        //:   name-based lookup.
+        //:
+        //: 2 A name that is not in the index is forwarded to the type, so
+        //:   that aliases accepted by the type are still accepted, and names
+        //:   rejected by the type (including the name of an attribute that
+        //:   the type's own lookup does not accept) are still rejected.
+        //:
+        //: 3 The index of a type is built once, and is shared by all objects
+        //:   of that type.
+        //:
+        //: 4 Types having fewer than 'k_MIN_NUM_ATTRIBUTES' attributes, and
+        //:   types without the 'bdlat_TypeTraitBasicSequence' trait, are not
+        //:   indexed, and every lookup of such a type is forwarded to the
+        //:   type exactly once.
+        //:
+        //: 5 No memory is allocated from the default allocator.
+        //
+        // Plan:
+        //: 1 Using 'test::Record', which counts the calls to its name-based
+        //:   lookup, instantiated with 'k_MIN_NUM_ATTRIBUTES' attributes,
+        //:   look up and manipulate attributes by name through the utility,
+        //:   and verify the results and the number of calls to the type's
+        //:   name-based lookup.  (C-1..2)
+        //:
+        //: 2 Verify that 'index' returns the same address for distinct
+        //:   objects.  (C-3)
+        //:
+        //: 3 Verify that 'index' returns 0 for 'test::Record' instantiated
+        //:   with 3 and with 'k_MIN_NUM_ATTRIBUTES - 1' attributes, and for
+        //:   'test::NotGenerated', and repeat P-1 for the former, expecting
+        //:   one call to the type's name-based lookup per lookup.  (C-4)
+        //:
+        //: 4 Verify that the default allocator was not used.  (C-5)
+        //
+        // Testing:
+        //   bool hasAttribute(const TYPE&, const char *, int);
+        //   const bdlat_AttributeNameIndex *index(const TYPE& object);
+        //   int manipulateAttribute(TYPE *, MANIPULATOR&, const char *, int);
+        //   CONCERN: Results are identical to those of 'bdlat_SequenceFunct..
+        //   CONCERN: The index of a type is built once.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'bdlat_AttributeNameIndexUtil'" << endl
+                          << "==============================" << endl;
+
+        using test::LargeRecord;
+        using test::LargestSmallRecord;
+        using test::SmallRecord;
+
+        if (verbose) cout << "\nBuilding the index." << endl;
+        {
+            const LargeRecord               mX;
+            const bdlat_AttributeNameIndex *INDEX = Util::index(mX);
+
+            ASSERT(0 != INDEX);
+
+            // Only the names that the type's own lookup resolves to the same
+            // attribute are indexed.
+
+            ASSERTV(INDEX->numNames(),
+                    Util::k_MIN_NUM_ATTRIBUTES - 1 == INDEX->numNames());
+
+            int id = 0;
+            ASSERT(0 == INDEX->find(&id, "name", 4));
+            ASSERT(LargeRecord::ATTRIBUTE_ID_NAME == id);
+            ASSERT(0 == INDEX->find(&id, "age", 3));
+            ASSERT(LargeRecord::ATTRIBUTE_ID_AGE == id);
+            ASSERT(0 == INDEX->find(&id, "field3", 6));
+            ASSERT(103 == id);
+            ASSERT(0 != INDEX->find(&id, "hidden", 6));
+            ASSERT(0 != INDEX->find(&id, "years", 5));
+
+            const LargeRecord Y;
+            ASSERT(INDEX == Util::index(Y));
+            ASSERT(INDEX == Util::index(mX));
+
+            const SmallRecord        S;
+            const LargestSmallRecord T;
+            ASSERT(0 == Util::index(S));
+            ASSERT(0 == Util::index(S));
+            ASSERT(0 == Util::index(T));
+
+            ASSERT(0 == Util::index(test::NotGenerated()));
+        }
+
+        if (verbose) cout << "\nTesting 'hasAttribute'." << endl;
+        {
+            static const struct {
+                int         d_line;      // source line number
+                const char *d_name_p;    // attribute name
+                bool        d_expected;  // expected result
+                int         d_lookups;   // expected calls to lookup of an
+                                         // indexed type
+            } DATA[] = {
+                //LINE  NAME       EXP    LOOKUPS
+                //----  --------   -----  -------
+                { L_,   "name",    true,  0       },
+                { L_,   "age",     true,  0       },
+                { L_,   "years",   true,  1       },
+                { L_,   "hidden",  false, 1       },
+                { L_,   "Name",    false, 1       },
+                { L_,   "nam",     false, 1       },
+                { L_,   "names",   false, 1       },
+                { L_,   "",        false, 1       },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE     = DATA[ti].d_line;
+                const char *NAME     = DATA[ti].d_name_p;
+                const bool  EXPECTED = DATA[ti].d_expected;
+                const int   LOOKUPS  = DATA[ti].d_lookups;
+
+                if (veryVerbose) { T_ P_(LINE) P(NAME) }
+
+                test::testHasAttribute<LargeRecord>(LINE,
+                                                    NAME,
+                                                    EXPECTED,
+                                                    LOOKUPS);
+                test::testHasAttribute<SmallRecord>(LINE, NAME, EXPECTED, 1);
+                test::testHasAttribute<LargestSmallRecord>(LINE,
+                                                           NAME,
+                                                           EXPECTED,
+                                                           1);
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'manipulateAttribute'." << endl;
+        {
+            static const struct {
+                int         d_line;      // source line number
+                const char *d_name_p;    // attribute name
+                int         d_id;        // expected id, or 0 if not found
+                int         d_lookups;   // expected calls to lookup of an
+                                         // indexed type
+            } DATA[] = {
+                //LINE  NAME       ID                            LOOKUPS
+                //----  --------   ----------------------------  -------
+                { L_,   "name",    SmallRecord::ATTRIBUTE_ID_NAME,    0  },
+                { L_,   "age",     SmallRecord::ATTRIBUTE_ID_AGE,     0  },
+                { L_,   "years",   SmallRecord::ATTRIBUTE_ID_AGE,     1  },
+                { L_,   "hidden",  0,                                 1  },
+                { L_,   "AGE",     0,                                 1  },
+                { L_,   "",        0,                                 1  },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE    = DATA[ti].d_line;
+                const char *NAME    = DATA[ti].d_name_p;
+                const int   ID      = DATA[ti].d_id;
+                const int   LOOKUPS = DATA[ti].d_lookups;
+
+                if (veryVerbose) { T_ P_(LINE) P(NAME) }
+
+                test::testManipulateAttribute<LargeRecord>(LINE,
+                                                           NAME,
+                                                           ID,
+                                                           LOOKUPS);
+                test::testManipulateAttribute<SmallRecord>(LINE, NAME, ID, 1);
+                test::testManipulateAttribute<LargestSmallRecord>(LINE,
+                                                                  NAME,
+                                                                  ID,
+                                                                  1);
+            }
+
+            // The last attribute of an indexed type is indexed as well.
+
+            const int LAST = Util::k_MIN_NUM_ATTRIBUTES - 1;
+
+            char name[16];
+            bsl::sprintf(name, "field%d", LAST);
+
+            test::testManipulateAttribute<LargeRecord>(L_,
+                                                       name,
+                                                       100 + LAST,
+                                                       0);
+        }
+
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'bdlat_AttributeNameIndex'
+        //
+        // Concerns:
+        //: 1 Every inserted name is found, with the id it was inserted with,
+        //:   including after the hash table has grown.
+        //:
+        //: 2 A name that was not inserted is not found, even if it is a
+        //:   prefix, an extension, or a case variant of an inserted name, and
+        //:   'find' then does not modify 'id'.
+        //:
+        //: 3 Inserting a name that is already present fails and has no
+        //:   effect.
+        //:
+        //: 4 The empty name can be inserted and found.
+        //:
+        //: 5 Memory is allocated from the supplied allocator, or from the
+        //:   default allocator if none is supplied, and is released on
+        //:   destruction.
+        //
+        // Plan:
+        //: 1 Insert a series of distinct generated names of varying lengths,
+        //:   one at a time, and after each insertion verify that 'numNames'
+        //:   is correct, that every name inserted so far is found with its
+        //:   id, and that variants of those names are not found.  (C-1..2)
+        //:
+        //: 2 Insert each name a second time, with a different id, and verify
+        //:   that the insertion fails and the original id is kept.  (C-3)
+        //:
+        //: 3 Insert and find the empty name.  (C-4)
+        //:
+        //: 4 Use test allocators to verify memory use.  (C-5)
+        //
+        // Testing:
+        //   bdlat_AttributeNameIndex(bslma::Allocator *basicAllocator = 0);
+        //   int insert(const char *name, int nameLength, int id);
+        //   int find(int *id, const char *name, int nameLength) const;
+        //   int numNames() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'bdlat_AttributeNameIndex'" << endl
+                          << "==========================" << endl;
+
+        const int NUM_NAMES = 200;
+
+        bslma::TestAllocator     scratch("scratch", veryVeryVerbose);
+        bsl::vector<bsl::string> names(&scratch);
+        for (int i = 0; i < NUM_NAMES; ++i) {
+            char buffer[32];
+            bsl::sprintf(buffer, "%s%d", i % 2 ? "attribute" : "a", i);
+            names.push_back(buffer);
+        }
+
+        bslma::TestAllocator objectAllocator("object", veryVeryVerbose);
+        {
+            Obj mX(&objectAllocator);  const Obj& X = mX;
+
+            ASSERT(0 == X.numNames());
+
+            int id = -1;
+            ASSERT(0 != X.find(&id, "a0", 2));
+            ASSERT(-1 == id);
+
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                const bsl::string& NAME = names[i];
+
+                ASSERTV(i, 0 == mX.insert(NAME.data(),
+                                          static_cast<int>(NAME.length()),
+                                          1000 + i));
+                ASSERTV(i, X.numNames(), i + 1 == X.numNames());
+
+                for (int j = 0; j <= i; ++j) {
+                    const bsl::string& KEY    = names[j];
+                    const int          LENGTH =
+                                             static_cast<int>(KEY.length());
+
+                    id = -1;
+                    ASSERTV(i, j, 0 == X.find(&id, KEY.data(), LENGTH));
+                    ASSERTV(i, j, id, 1000 + j == id);
+
+                    bsl::string variant(KEY, &scratch);
+                    variant[0] = 'A';
+                    ASSERTV(i, j,
+                            0 != X.find(&id, variant.data(), LENGTH));
+
+                    variant.assign(KEY);
+                    variant.push_back('x');
+                    ASSERTV(i, j,
+                            0 != X.find(&id, variant.data(), LENGTH + 1));
+
+                    // A proper prefix of a name may itself be a name (e.g.,
+                    // "a10" and "a100"), in which case it must be found
+                    // with its own id.
+
+                    if (0 == X.find(&id, KEY.data(), LENGTH - 1)) {
+                        ASSERTV(i, j, id, 1000 <= id && id <= 1000 + i);
+                        const bsl::string& PREFIX = names[id - 1000];
+                        ASSERTV(i, j, id,
+                                LENGTH - 1 == static_cast<int>(PREFIX.length())
+                             && 0 == KEY.compare(0, LENGTH - 1, PREFIX));
+                    }
+                }
+            }
+
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                const bsl::string& NAME = names[i];
+
+                ASSERTV(i, 0 != mX.insert(NAME.data(),
+                                          static_cast<int>(NAME.length()),
+                                          i));
+                ASSERTV(i, NUM_NAMES == X.numNames());
+
+                id = -1;
+                ASSERTV(i, 0 == X.find(&id,
+                                       NAME.data(),
+                                       static_cast<int>(NAME.length())));
+                ASSERTV(i, id, 1000 + i == id);
+            }
+
+            ASSERT(0 != X.find(&id, "", 0));
+            ASSERT(0 == mX.insert("", 0, 7));
+            ASSERT(0 == X.find(&id, "", 0));
+            ASSERT(7 == id);
+            ASSERT(NUM_NAMES + 1 == X.numNames());
+
+            ASSERT(0 <  objectAllocator.numBytesInUse());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+        ASSERT(0 == objectAllocator.numBytesInUse());
+
+        {
+            Obj mX;
+
+            ASSERT(0 == mX.insert("a", 1, 1));
+            ASSERT(0 <  defaultAllocator.numBytesInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBytesInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert a few names into an index and look them up.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        ASSERT(0 == mX.insert("x", 1, 1));
+        ASSERT(0 == mX.insert("y", 1, 2));
+        ASSERT(0 != mX.insert("x", 1, 3));
+        ASSERT(2 == X.numNames());
+
+        int id = 0;
+        ASSERT(0 == X.find(&id, "y", 1));
+        ASSERT(2 == id);
+        ASSERT(0 == X.find(&id, "x", 1));
+        ASSERT(1 == id);
+        ASSERT(0 != X.find(&id, "z", 1));
+        ASSERT(1 == id);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'find' VS. LINEAR SEARCH
+        //
+        // Concerns:
+        //: 1 Looking up a name in an index is faster than comparing the name
+        //:   against each name in turn if there are at least
+        //:   'k_MIN_NUM_ATTRIBUTES' names, which justifies the value of that
+        //:   constant.
+        //
+        // Plan:
+        //: 1 For a series of numbers of names, build an index of that many
+        //:   typical attribute names (of varying lengths, some sharing a
+        //:   prefix with others), and look up each name repeatedly
+        //:   using 'find' and using a linear search comparing the length and
+        //:   then the characters of each name, and report the times per
+        //:   lookup.  Optionally specify the total number of lookups per
+        //:   series as the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE: 'find' VS. LINEAR SEARCH
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: 'find' VS. LINEAR SEARCH" << endl
+                          << "=====================================" << endl;
+
+        static const int NUM_NAMES_DATA[] = {
+            1, 2, 4, 8, 12, 16, 24, 32, 64, 160
+        };
+        const int NUM_DATA = sizeof NUM_NAMES_DATA / sizeof *NUM_NAMES_DATA;
+
+        const int NUM_LOOKUPS = argc > 2 ? atoi(argv[2]) : 10000000;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int NUM_NAMES = NUM_NAMES_DATA[ti];
+            const int NUM_ITERS = NUM_LOOKUPS / NUM_NAMES + 1;
+
+            static const char *const WORDS[] = {
+                "id", "name", "price", "quantity", "side", "account",
+                "trader", "timestamp", "currency", "venue", "status",
+                "orderType"
+            };
+            const int NUM_WORDS = sizeof WORDS / sizeof *WORDS;
+
+            bsl::vector<bsl::string> names;
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                char buffer[32];
+                if (i < NUM_WORDS) {
+                    bsl::sprintf(buffer, "%s", WORDS[i]);
+                }
+                else {
+                    bsl::sprintf(buffer,
+                                 "%s%d",
+                                 WORDS[i % NUM_WORDS],
+                                 i / NUM_WORDS);
+                }
+                names.push_back(buffer);
+            }
+
+            Obj mX;  const Obj& X = mX;
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                mX.insert(names[i].data(),
+                          static_cast<int>(names[i].length()),
+                          i);
+            }
+
+            bsls::Types::Int64 checksum = 0;
+            bsls::Stopwatch    timer;
+
+            timer.start();
+            for (int iter = 0; iter < NUM_ITERS; ++iter) {
+                for (int i = 0; i < NUM_NAMES; ++i) {
+                    int id = -1;
+                    X.find(&id,
+                           names[i].data(),
+                           static_cast<int>(names[i].length()));
+                    checksum += id;
+                }
+            }
+            timer.stop();
+            const double indexTime = timer.accumulatedWallTime();
+
+            timer.reset();
+            timer.start();
+            for (int iter = 0; iter < NUM_ITERS; ++iter) {
+                for (int i = 0; i < NUM_NAMES; ++i) {
+                    const char        *name   = names[i].data();
+                    const bsl::size_t  length = names[i].length();
+                    for (int j = 0; j < NUM_NAMES; ++j) {
+                        if (names[j].length() == length
+                         && 0 == bsl::memcmp(names[j].data(), name, length)) {
+                            checksum -= j;
+                            break;
+                        }
+                    }
+                }
+            }
+            timer.stop();
+            const double linearTime = timer.accumulatedWallTime();
+
+            ASSERTV(NUM_NAMES, 0 == checksum);
+
+            const double COUNT = static_cast<double>(NUM_NAMES) * NUM_ITERS;
+
+            cout << NUM_NAMES << " names: find: "
+                 << indexTime / COUNT * 1e9 << " ns, linear search: "
+                 << linearTime / COUNT * 1e9 << " ns" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,170 @@
+// bdlb_numericformatterutil.h                                        -*-C++-*-
+#ifndef INCLUDED_BDLB_NUMERICFORMATTERUTIL
+#define INCLUDED_BDLB_NUMERICFORMATTERUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide shortest round-trip text formatting of floating-point.
+//
+//@CLASSES:
+//  bdlb::NumericFormatterUtil: namespace for floating-point to text functions
+//
+//@SEE_ALSO: bdlb_float
+//
+//@DESCRIPTION: This component provides a utility 'struct',
+// 'bdlb::NumericFormatterUtil', that converts 'double' and 'float' values to
+// their *shortest* *round-trip* decimal text representation: the output has
+// the fewest significant digits such that reading it back (e.g., with
+// 'strtod' or 'strtof', using round-to-nearest) yields exactly the original
+// value.  When several representations with that number of digits exist, the
+// one closest to the exact binary value is produced.
+//
+// The conversion is performed by the Ryu algorithm (Ulf Adams, "Ryu: Fast
+// Float-to-String Conversion", PLDI 2018), which uses only fixed-width
+// integer arithmetic and a pair of precomputed tables of powers of 5.  The
+// 'toChars' functions neither allocate memory nor consult the global locale,
+// so they are safe to call from any thread and produce the same output on
+// every platform.  They are considerably faster than 'sprintf' or 'ostream'
+// insertion, which both must produce exactly rounded output for a caller
+// specified precision and, therefore, must resort to multi-precision
+// arithmetic.
+//
+///Output Format
+///-------------
+// The text is written in the notation 'printf' would use for the '%g'
+// conversion specifier with a precision of 17 (for 'double') or 9 (for
+// 'float') -- the 'max_digits10' of the respective type -- except that only
+// the significant digits required to round-trip are written:
+//
+//: o A leading '-' is written if the sign bit of the value is set (including
+//:   for negative zero).
+//:
+//: o If the decimal exponent 'X' of the value, in scientific notation, is in
+//:   the range '[-4, P)', where 'P' is 17 for 'double' and 9 for 'float', the
+//:   value is written in fixed notation (e.g., "0.001", "1.5", "1200");
+//:   otherwise it is written in scientific notation with an exponent of at
+//:   least two digits (e.g., "1.5e-07", "1e+20").
+//:
+//: o No trailing zeros are written after the decimal point, and the decimal
+//:   point is omitted when there is no fractional part.
+//:
+//: o Infinite values are written as "inf" or "-inf", and NaN values as "nan"
+//:   or "-nan".
+//
+// The resulting text is a valid JSON number and a valid XML Schema 'double'
+// literal for all finite values.  The 'k_DOUBLE_MAX_LENGTH' and
+// 'k_FLOAT_MAX_LENGTH' constants give the maximum number of characters that
+// a conversion can produce, so a buffer of that size is always sufficient.
+// Note that no null terminator is written.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing a 'double' to a Buffer
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we need to write a 'double' value into a character buffer in a
+// form that reads back as the same value.  A common approach is to call
+// 'sprintf' with a precision of 17, but that often writes more digits than
+// necessary, and a smaller precision may lose information.
+//
+// First, we define a buffer large enough for any 'double':
+//..
+//  char buffer[bdlb::NumericFormatterUtil::k_DOUBLE_MAX_LENGTH];
+//..
+// Then, we convert the value '0.1', which 'sprintf("%.17g")' would write as
+// "0.10000000000000001":
+//..
+//  char *end = bdlb::NumericFormatterUtil::toChars(buffer,
+//                                                  buffer + sizeof buffer,
+//                                                  0.1);
+//  assert(0 != end);
+//  assert("0.1" == bsl::string(buffer, end));
+//..
+// Next, we convert a value that needs all 17 significant digits:
+//..
+//  end = bdlb::NumericFormatterUtil::toChars(buffer,
+//                                            buffer + sizeof buffer,
+//                                            0.1 + 0.2);
+//  assert("0.30000000000000004" == bsl::string(buffer, end));
+//..
+// Then, we convert a large and a small value, which are written using
+// scientific notation:
+//..
+//  end = bdlb::NumericFormatterUtil::toChars(buffer,
+//                                            buffer + sizeof buffer,
+//                                            -1.5e300);
+//  assert("-1.5e+300" == bsl::string(buffer, end));
+//
+//  end = bdlb::NumericFormatterUtil::toChars(buffer,
+//                                            buffer + sizeof buffer,
+//                                            2.5e-7);
+//  assert("2.5e-07" == bsl::string(buffer, end));
+//..
+// Finally, we observe that a buffer that is too small is reported by a null
+// return value:
+//..
+//  end = bdlb::NumericFormatterUtil::toChars(buffer, buffer + 3, 1234.5);
+//  assert(0 == end);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlb {
+
+                         // ===========================
+                         // struct NumericFormatterUtil
+                         // ===========================
+
+struct NumericFormatterUtil {
+    // This 'struct' provides a namespace for functions that write the
+    // shortest round-trip decimal text representation of floating-point
+    // values into a caller-supplied buffer.
+
+    // CONSTANTS
+    enum {
+        k_DOUBLE_MAX_LENGTH = 24,  // e.g., "-2.2250738585072014e-308"
+
+        k_FLOAT_MAX_LENGTH  = 15   // e.g., "-1.17549435e-38"
+    };
+
+    // CLASS METHODS
+    static char *toChars(char *first, char *last, double value);
+    static char *toChars(char *first, char *last, float  value);
+        // Write the shortest decimal text representation of the specified
+        // 'value' that reads back as 'value', in the format described in
+        // {Output Format}, into the buffer '[first, last)'.  Return the
+        // address one past the last character written on success, and 0
+        // (leaving the contents of the buffer unspecified) if the buffer is
+        // too small to hold the representation.  No null terminator is
+        // written.  The behavior is undefined unless 'first <= last'.  Note
+        // that a buffer of at least 'k_DOUBLE_MAX_LENGTH' (for 'double') or
+        // 'k_FLOAT_MAX_LENGTH' (for 'float') characters is always sufficient.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,852 @@
+// bdlb_numericformatterutil.t.cpp                                    -*-C++-*-
+#include <bdlb_numericformatterutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cfloat.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test is a utility that converts 'double' and 'float'
+// values to their shortest round-trip decimal representation.  We verify the
+// produced text against a table of values chosen to exercise every notation
+// (fixed with and without a fractional part, fixed with leading zeros, and
+// scientific with two- and three-digit exponents), the boundaries between
+// them, and the extreme and special values of each type.  We verify that a
+// buffer that is too small is detected without writing past its end.
+// Finally, we verify on a large set of pseudo-random values that the output
+// reads back as the original value and that no representation with fewer
+// significant digits does.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] char *toChars(char *first, char *last, double value);
+// [ 3] char *toChars(char *first, char *last, float  value);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: A too-small buffer is reported and not overrun.
+// [ 5] CONCERN: Output round-trips and is the shortest that does.
+// [ 5] CONCERN: No memory is allocated.
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'toChars' VS. 'sprintf'
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlb::NumericFormatterUtil Util;
+typedef bsls::Types::Uint64        Uint64;
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+Uint64 nextRandom(Uint64 *state)
+    // Advance the specified xorshift 'state' and return its new value.
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+int numSignificantDigits(const char *first, const char *last)
+    // Return the number of significant decimal digits in the mantissa of the
+    // number in '[first, last)', ignoring leading and trailing zeros, or 1 if
+    // the mantissa is zero.
+{
+    int  count   = 0;
+    int  zeros   = 0;
+    bool started = false;
+    for (; first != last && 'e' != *first; ++first) {
+        if ('1' <= *first && *first <= '9') {
+            started  = true;
+            count   += zeros + 1;
+            zeros    = 0;
+        }
+        else if ('0' == *first && started) {
+            ++zeros;
+        }
+    }
+    return count ? count : 1;
+}
+
+bsl::string formatDouble(double value)
+    // Return the result of 'Util::toChars' for the specified 'value'.
+{
+    char        buffer[Util::k_DOUBLE_MAX_LENGTH];
+    char       *end = Util::toChars(buffer, buffer + sizeof buffer, value);
+    return end ? bsl::string(buffer, end) : bsl::string("<null>");
+}
+
+bsl::string formatFloat(float value)
+    // Return the result of 'Util::toChars' for the specified 'value'.
+{
+    char        buffer[Util::k_FLOAT_MAX_LENGTH];
+    char       *end = Util::toChars(buffer, buffer + sizeof buffer, value);
+    return end ? bsl::string(buffer, end) : bsl::string("<null>");
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test            = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose         = argc > 2;
+    const bool veryVerbose     = argc > 3;
+    const bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing a 'double' to a Buffer
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we need to write a 'double' value into a character buffer in a
+// form that reads back as the same value.  A common approach is to call
+// 'sprintf' with a precision of 17, but that often writes more digits than
+// necessary, and a smaller precision may lose information.
+//
+// First, we define a buffer large enough for any 'double':
+//..
+    char buffer[bdlb::NumericFormatterUtil::k_DOUBLE_MAX_LENGTH];
+//..
+// Then, we convert the value '0.1', which 'sprintf("%.17g")' would write as
+// "0.10000000000000001":
+//..
+    char *end = bdlb::NumericFormatterUtil::toChars(buffer,
+                                                    buffer + sizeof buffer,
+                                                    0.1);
+    ASSERT(0 != end);
+    ASSERT("0.1" == bsl::string(buffer, end));
+//..
+// Next, we convert a value that needs all 17 significant digits:
+//..
+    end = bdlb::NumericFormatterUtil::toChars(buffer,
+                                              buffer + sizeof buffer,
+                                              0.1 + 0.2);
+    ASSERT("0.30000000000000004" == bsl::string(buffer, end));
+//..
+// Then, we convert a large and a small value, which are written using
+// scientific notation:
+//..
+    end = bdlb::NumericFormatterUtil::toChars(buffer,
+                                              buffer + sizeof buffer,
+                                              -1.5e300);
+    ASSERT("-1.5e+300" == bsl::string(buffer, end));
+
+    end = bdlb::NumericFormatterUtil::toChars(buffer,
+                                              buffer + sizeof buffer,
+                                              2.5e-7);
+    ASSERT("2.5e-07" == bsl::string(buffer, end));
+//..
+// Finally, we observe that a buffer that is too small is reported by a null
+// return value:
+//..
+    end = bdlb::NumericFormatterUtil::toChars(buffer, buffer + 3, 1234.5);
+    ASSERT(0 == end);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ROUND TRIP
+        //
+        // Concerns:
+        //: 1 The text produced for any finite value reads back, using
+        //:   'strtod' or 'strtof', as exactly that value.
+        //:
+        //: 2 No decimal representation with fewer significant digits reads
+        //:   back as the value.
+        //:
+        //: 3 Values near the extremes of the exponent range, including
+        //:   subnormal values and powers of two (whose rounding interval is
+        //:   asymmetric), are handled correctly.
+        //:
+        //: 4 No memory is allocated.
+        //
+        // Plan:
+        //: 1 For a set of pseudo-random bit patterns, and for every binary
+        //:   exponent combined with mantissas at and near the ends of their
+        //:   range, format the value, and verify that 'strtod' ('strtof')
+        //:   recovers it.  Find the fewest digits 'N' for which 'sprintf' with
+        //:   '%.*e' produces text that reads back as the value, and verify
+        //:   that the output has no more than 'N' significant digits.
+        //:   (C-1..3)
+        //:
+        //: 2 Verify that the default allocator was not used.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: Output round-trips and is the shortest that does.
+        //   CONCERN: No memory is allocated.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ROUND TRIP" << endl
+                          << "==========" << endl;
+
+        const int NUM_RANDOM = verbose ? 1000000 : 50000;
+
+        const Uint64 MANTISSAS[] = {
+            0, 1, 2, 3, 0x5555555555555ULL, 0x8000000000000ULL,
+            0xffffffffffffeULL, 0xfffffffffffffULL
+        };
+        const int NUM_MANTISSAS = sizeof MANTISSAS / sizeof *MANTISSAS;
+
+        if (verbose) cout << "Testing 'double'." << endl;
+        {
+            Uint64 state = 0x123456789abcdefULL;
+
+            const int NUM_EDGES = 2047 * NUM_MANTISSAS;
+            for (int ti = 0; ti < NUM_EDGES + NUM_RANDOM; ++ti) {
+                Uint64 bits;
+                if (ti < NUM_EDGES) {
+                    bits = static_cast<Uint64>(ti / NUM_MANTISSAS) << 52
+                                               | MANTISSAS[ti % NUM_MANTISSAS];
+                }
+                else {
+                    bits = nextRandom(&state);
+                }
+
+                double value;
+                bsl::memcpy(&value, &bits, sizeof value);
+                if (value != value || value - value != 0) {
+                    continue;  // NaN or infinity
+                }
+
+                char  buffer[Util::k_DOUBLE_MAX_LENGTH + 1];
+                char *end = Util::toChars(buffer,
+                                          buffer + Util::k_DOUBLE_MAX_LENGTH,
+                                          value);
+                ASSERTV(value, 0 != end);
+                if (0 == end) {
+                    continue;
+                }
+                *end = '\0';
+
+                ASSERTV(buffer, value == bsl::strtod(buffer, 0));
+
+                char reference[32];
+                int  numDigits;
+                for (numDigits = 1; numDigits < 17; ++numDigits) {
+                    bsl::sprintf(reference, "%.*e", numDigits - 1, value);
+                    if (value == bsl::strtod(reference, 0)) {
+                        break;
+                    }
+                }
+                ASSERTV(buffer, numDigits,
+                        numSignificantDigits(buffer, end) <= numDigits);
+            }
+        }
+
+        if (verbose) cout << "Testing 'float'." << endl;
+        {
+            Uint64 state = 0xfedcba987654321ULL;
+
+            const int NUM_EDGES = 255 * NUM_MANTISSAS;
+            for (int ti = 0; ti < NUM_EDGES + NUM_RANDOM; ++ti) {
+                unsigned int bits;
+                if (ti < NUM_EDGES) {
+                    bits = static_cast<unsigned int>(ti / NUM_MANTISSAS) << 23
+                         | static_cast<unsigned int>(
+                                      MANTISSAS[ti % NUM_MANTISSAS] >> 29);
+                }
+                else {
+                    bits = static_cast<unsigned int>(nextRandom(&state));
+                }
+
+                float value;
+                bsl::memcpy(&value, &bits, sizeof value);
+                if (value != value || value - value != 0) {
+                    continue;  // NaN or infinity
+                }
+
+                char  buffer[Util::k_FLOAT_MAX_LENGTH + 1];
+                char *end = Util::toChars(buffer,
+                                          buffer + Util::k_FLOAT_MAX_LENGTH,
+                                          value);
+                ASSERTV(value, 0 != end);
+                if (0 == end) {
+                    continue;
+                }
+                *end = '\0';
+
+                ASSERTV(buffer, value == ::strtof(buffer, 0));
+
+                char reference[32];
+                int  numDigits;
+                for (numDigits = 1; numDigits < 9; ++numDigits) {
+                    bsl::sprintf(reference,
+                                 "%.*e",
+                                 numDigits - 1,
+                                 static_cast<double>(value));
+                    if (value == ::strtof(reference, 0)) {
+                        break;
+                    }
+                }
+                ASSERTV(buffer, numDigits,
+                        numSignificantDigits(buffer, end) <= numDigits);
+            }
+        }
+
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // BUFFER TOO SMALL
+        //
+        // Concerns:
+        //: 1 If the buffer is too small for the representation, 'toChars'
+        //:   returns 0.
+        //:
+        //: 2 'toChars' never writes past the end of the buffer.
+        //:
+        //: 3 A buffer of exactly the required size is sufficient.
+        //:
+        //: 4 The 'k_*_MAX_LENGTH' constants are attained.
+        //
+        // Plan:
+        //: 1 For a set of values of each type and of varied lengths, and for
+        //:   every buffer size from 0 to the required length, call 'toChars'
+        //:   with a buffer followed by a sentinel character, and verify the
+        //:   return value and that the sentinel is unchanged.  (C-1..3)
+        //:
+        //: 2 Verify that the longest values of each type have exactly the
+        //:   maximum length.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: A too-small buffer is reported and not overrun.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BUFFER TOO SMALL" << endl
+                          << "================" << endl;
+
+        const char SENTINEL = '#';
+
+        if (verbose) cout << "Testing 'double'." << endl;
+        {
+            const double DATA[] = {
+                0.0, -0.0, 7.0, -1.5, 1234.5, 0.00012345, -1e-300, 1e100,
+                -2.2250738585072014e-308, -0.00012345678901234567,
+                bsl::numeric_limits<double>::infinity(),
+               -bsl::numeric_limits<double>::infinity(),
+                bsl::numeric_limits<double>::quiet_NaN()
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const double      VALUE    = DATA[ti];
+                const bsl::string EXPECTED = formatDouble(VALUE);
+                const int         LENGTH   = static_cast<int>(
+                                                            EXPECTED.length());
+
+                if (veryVerbose) { T_ P_(VALUE) P(EXPECTED) }
+
+                ASSERTV(EXPECTED, LENGTH <= Util::k_DOUBLE_MAX_LENGTH);
+
+                for (int size = 0; size <= LENGTH; ++size) {
+                    char buffer[Util::k_DOUBLE_MAX_LENGTH + 1];
+                    bsl::memset(buffer, SENTINEL, sizeof buffer);
+
+                    char *end = Util::toChars(buffer, buffer + size, VALUE);
+
+                    ASSERTV(EXPECTED, size, SENTINEL == buffer[size]);
+                    if (size < LENGTH) {
+                        ASSERTV(EXPECTED, size, 0 == end);
+                    }
+                    else {
+                        ASSERTV(EXPECTED, size, buffer + size == end);
+                        ASSERTV(EXPECTED, size,
+                                EXPECTED == bsl::string(buffer, end));
+                    }
+                }
+            }
+
+            ASSERT(Util::k_DOUBLE_MAX_LENGTH ==
+                          formatDouble(-2.2250738585072014e-308).length());
+            ASSERT(Util::k_DOUBLE_MAX_LENGTH - 1 ==
+                           formatDouble(-0.00012345678901234567).length());
+        }
+
+        if (verbose) cout << "Testing 'float'." << endl;
+        {
+            const float DATA[] = {
+                0.0f, -0.0f, 7.0f, -1.5f, 1234.5f, 0.00012345f, -1e-30f,
+                1e30f, -1.17549435e-38f, -1.23456795e-20f,
+                -0.000123456791f,
+                bsl::numeric_limits<float>::infinity(),
+               -bsl::numeric_limits<float>::infinity(),
+                bsl::numeric_limits<float>::quiet_NaN()
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const float       VALUE    = DATA[ti];
+                const bsl::string EXPECTED = formatFloat(VALUE);
+                const int         LENGTH   = static_cast<int>(
+                                                            EXPECTED.length());
+
+                if (veryVerbose) { T_ P_(VALUE) P(EXPECTED) }
+
+                ASSERTV(EXPECTED, LENGTH <= Util::k_FLOAT_MAX_LENGTH);
+
+                for (int size = 0; size <= LENGTH; ++size) {
+                    char buffer[Util::k_FLOAT_MAX_LENGTH + 1];
+                    bsl::memset(buffer, SENTINEL, sizeof buffer);
+
+                    char *end = Util::toChars(buffer, buffer + size, VALUE);
+
+                    ASSERTV(EXPECTED, size, SENTINEL == buffer[size]);
+                    if (size < LENGTH) {
+                        ASSERTV(EXPECTED, size, 0 == end);
+                    }
+                    else {
+                        ASSERTV(EXPECTED, size, buffer + size == end);
+                        ASSERTV(EXPECTED, size,
+                                EXPECTED == bsl::string(buffer, end));
+                    }
+                }
+            }
+
+            ASSERT(Util::k_FLOAT_MAX_LENGTH ==
+                                  formatFloat(-1.23456795e-20f).length());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'toChars(float)'
+        //
+        // Concerns:
+        //: 1 Values whose scientific exponent is in '[-4, 9)' are written in
+        //:   fixed notation, and others in scientific notation with at least
+        //:   two exponent digits.
+        //:
+        //: 2 Only the significant digits needed to round-trip are written,
+        //:   with no trailing zeros after the decimal point and no decimal
+        //:   point for integral values.
+        //:
+        //: 3 The sign of negative values, including negative zero and NaN,
+        //:   is written.
+        //:
+        //: 4 The extreme finite values and the special values are written
+        //:   correctly.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, verify the output for a set of
+        //:   values chosen to cover each concern.  (C-1..4)
+        //
+        // Testing:
+        //   char *toChars(char *first, char *last, float  value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'toChars(float)'" << endl
+                          << "================" << endl;
+
+        const float INF = bsl::numeric_limits<float>::infinity();
+        const float QNAN = bsl::numeric_limits<float>::quiet_NaN();
+
+        static const struct {
+            int         d_line;
+            float       d_value;
+            const char *d_expected;
+        } DATA[] = {
+            //LINE  VALUE                 EXPECTED
+            //----  --------------------  --------------------
+            { L_,    0.0f,                "0"                  },
+            { L_,   -0.0f,                "-0"                 },
+            { L_,    1.0f,                "1"                  },
+            { L_,   -1.5f,                "-1.5"               },
+            { L_,    0.1f,                "0.1"                },
+            { L_,    0.3f,                "0.3"                },
+            { L_,    1.0f / 3.0f,         "0.33333334"         },
+            { L_,    123.456f,            "123.456"            },
+            { L_,    0.123456789f,        "0.12345679"         },
+            { L_,    16777216.0f,         "16777216"           },
+            { L_,    100000000.0f,        "100000000"          },
+            { L_,    123456789.0f,        "123456790"          },
+            { L_,    1.0e9f,              "1e+09"              },
+            { L_,    1.5e10f,             "1.5e+10"            },
+            { L_,    1.234567e35f,        "1.234567e+35"       },
+            { L_,   -1.234567e-35f,       "-1.234567e-35"      },
+            { L_,    0.0001f,             "0.0001"             },
+            { L_,    0.000123f,           "0.000123"           },
+            { L_,    0.00001f,            "1e-05"              },
+            { L_,    FLT_MAX,             "3.4028235e+38"      },
+            { L_,    FLT_MIN,             "1.1754944e-38"      },
+            { L_,    1.0e-45f,            "1e-45"              },
+            { L_,   -7.0e-45f,            "-7e-45"             },
+            { L_,    INF,                 "inf"                },
+            { L_,   -INF,                 "-inf"               },
+            { L_,    QNAN,                 "nan"                },
+            { L_,   -QNAN,                 "-nan"               },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const float       VALUE    = DATA[ti].d_value;
+            const char *const EXPECTED = DATA[ti].d_expected;
+
+            const bsl::string result = formatFloat(VALUE);
+
+            if (veryVerbose) { T_ P_(LINE) P(result) }
+
+            ASSERTV(LINE, result, EXPECTED, EXPECTED == result);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'toChars(double)'
+        //
+        // Concerns:
+        //: 1 Values whose scientific exponent is in '[-4, 17)' are written in
+        //:   fixed notation, and others in scientific notation with at least
+        //:   two exponent digits.
+        //:
+        //: 2 Only the significant digits needed to round-trip are written,
+        //:   with no trailing zeros after the decimal point and no decimal
+        //:   point for integral values.
+        //:
+        //: 3 Among the shortest representations, the one closest to the
+        //:   value is written.
+        //:
+        //: 4 The sign of negative values, including negative zero and NaN,
+        //:   is written.
+        //:
+        //: 5 The extreme finite values and the special values are written
+        //:   correctly.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, verify the output for a set of
+        //:   values chosen to cover each concern.  (C-1..5)
+        //
+        // Testing:
+        //   char *toChars(char *first, char *last, double value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'toChars(double)'" << endl
+                          << "=================" << endl;
+
+        const double INF = bsl::numeric_limits<double>::infinity();
+        const double QNAN = bsl::numeric_limits<double>::quiet_NaN();
+
+        static const struct {
+            int         d_line;
+            double      d_value;
+            const char *d_expected;
+        } DATA[] = {
+            //LINE  VALUE                    EXPECTED
+            //----  -----------------------  --------------------------
+            { L_,    0.0,                    "0"                         },
+            { L_,   -0.0,                    "-0"                        },
+            { L_,    1.0,                    "1"                         },
+            { L_,   -1.5,                    "-1.5"                      },
+            { L_,    10.0,                   "10"                        },
+            { L_,    0.1,                    "0.1"                       },
+            { L_,    0.1 + 0.2,              "0.30000000000000004"       },
+            { L_,    1.0 / 3.0,              "0.3333333333333333"        },
+            { L_,    2.0 / 3.0,              "0.6666666666666666"        },
+            { L_,    123.456,                "123.456"                   },
+            { L_,   -9.9e100,                "-9.9e+100"                 },
+            { L_,    3.14e300,               "3.14e+300"                 },
+            { L_,    1e23,                   "1e+23"                     },
+            { L_,    9223372036854775808.0,  "9.223372036854776e+18"     },
+            { L_,    9007199254740993.0,     "9007199254740992"          },
+            { L_,    1e16,                   "10000000000000000"         },
+            { L_,    12345678901234567.0,    "12345678901234568"         },
+            { L_,    1e17,                   "1e+17"                     },
+            { L_,    123456789012345678.0,   "1.2345678901234568e+17"    },
+            { L_,    0.0001,                 "0.0001"                    },
+            { L_,    0.00012345,             "0.00012345"                },
+            { L_,    0.00001,                "1e-05"                     },
+            { L_,   -1.2345678901234567e-20, "-1.2345678901234567e-20"   },
+            { L_,    DBL_MAX,                "1.7976931348623157e+308"   },
+            { L_,    DBL_MIN,                "2.2250738585072014e-308"   },
+            { L_,    2.23e-308,              "2.23e-308"                 },
+            { L_,    5e-324,                 "5e-324"                    },
+            { L_,    1.5e-323,               "1.5e-323"                  },
+            { L_,    INF,                    "inf"                       },
+            { L_,   -INF,                    "-inf"                      },
+            { L_,    QNAN,                    "nan"                       },
+            { L_,   -QNAN,                    "-nan"                      },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const double      VALUE    = DATA[ti].d_value;
+            const char *const EXPECTED = DATA[ti].d_expected;
+
+            const bsl::string result = formatDouble(VALUE);
+
+            if (veryVerbose) { T_ P_(LINE) P(result) }
+
+            ASSERTV(LINE, result, EXPECTED, EXPECTED == result);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Format a few values of each type and verify the result.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        char  buffer[Util::k_DOUBLE_MAX_LENGTH];
+        char *end;
+
+        end = Util::toChars(buffer, buffer + sizeof buffer, 2.5);
+        ASSERT(0 != end);
+        ASSERT("2.5" == bsl::string(buffer, end));
+
+        end = Util::toChars(buffer, buffer + sizeof buffer, 2.5f);
+        ASSERT(0 != end);
+        ASSERT("2.5" == bsl::string(buffer, end));
+
+        end = Util::toChars(buffer, buffer + sizeof buffer, 0.2f);
+        ASSERT(0 != end);
+        ASSERT("0.2" == bsl::string(buffer, end));
+
+        end = Util::toChars(buffer,
+                            buffer + sizeof buffer,
+                            static_cast<double>(0.2f));
+        ASSERT(0 != end);
+        ASSERT("0.20000000298023224" == bsl::string(buffer, end));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'toChars' VS. 'sprintf'
+        //
+        // Concerns:
+        //: 1 'toChars' is faster than 'sprintf' producing round-trip output.
+        //
+        // Plan:
+        //: 1 Format a set of pseudo-random values of mixed magnitude with
+        //:   'toChars' and with 'sprintf' using '%.17g' (for 'double') and
+        //:   '%.9g' (for 'float'), the shortest fixed precisions that always
+        //:   round-trip, and report the times.
+        //
+        // Testing:
+        //   PERFORMANCE: 'toChars' VS. 'sprintf'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: 'toChars' VS. 'sprintf'" << endl
+                          << "====================================" << endl;
+
+        const int NUM_VALUES = 1000;
+        const int NUM_ITERS  = argc > 2 ? atoi(argv[2]) : 1000;
+
+        double doubles[NUM_VALUES];
+        float  floats[NUM_VALUES];
+        Uint64 state = 0x2545f4914f6cdd1dULL;
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const double mantissa = static_cast<double>(
+                                       nextRandom(&state) % 1000000000) / 1e4;
+            const int    exponent = static_cast<int>(
+                                              nextRandom(&state) % 21) - 10;
+            double       value    = mantissa;
+            for (int e = 0; e < exponent; ++e) {
+                value *= 10;
+            }
+            for (int e = 0; e > exponent; --e) {
+                value /= 10;
+            }
+            doubles[i] = value;
+            floats[i]  = static_cast<float>(value);
+        }
+
+        char               buffer[64];
+        bsls::Types::Int64 checksum = 0;
+        bsls::Stopwatch    timer;
+
+        timer.start();
+        for (int iter = 0; iter < NUM_ITERS; ++iter) {
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                checksum += Util::toChars(buffer, buffer + 64, doubles[i])
+                                                                     - buffer;
+            }
+        }
+        timer.stop();
+        const double toCharsDouble = timer.accumulatedWallTime();
+
+        timer.reset();
+        timer.start();
+        for (int iter = 0; iter < NUM_ITERS; ++iter) {
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                checksum += bsl::sprintf(buffer, "%.17g", doubles[i]);
+            }
+        }
+        timer.stop();
+        const double sprintfDouble = timer.accumulatedWallTime();
+
+        timer.reset();
+        timer.start();
+        for (int iter = 0; iter < NUM_ITERS; ++iter) {
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                checksum += Util::toChars(buffer, buffer + 64, floats[i])
+                                                                     - buffer;
+            }
+        }
+        timer.stop();
+        const double toCharsFloat = timer.accumulatedWallTime();
+
+        timer.reset();
+        timer.start();
+        for (int iter = 0; iter < NUM_ITERS; ++iter) {
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                checksum += bsl::sprintf(buffer,
+                                         "%.9g",
+                                         static_cast<double>(floats[i]));
+            }
+        }
+        timer.stop();
+        const double sprintfFloat = timer.accumulatedWallTime();
+
+        const double COUNT = static_cast<double>(NUM_VALUES) * NUM_ITERS;
+
+        cout << "double: toChars " << toCharsDouble / COUNT * 1e9
+             << " ns, sprintf " << sprintfDouble / COUNT * 1e9 << " ns"
+             << endl
+             << "float:  toChars " << toCharsFloat / COUNT * 1e9
+             << " ns, sprintf " << sprintfFloat / COUNT * 1e9 << " ns"
+             << endl;
+
+        if (veryVerbose) {
+            P(checksum)
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
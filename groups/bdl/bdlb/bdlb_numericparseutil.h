@@ -0,0 +1,156 @@
+// bdlb_numericparseutil.h                                            -*-C++-*-
+#ifndef INCLUDED_BDLB_NUMERICPARSEUTIL
+#define INCLUDED_BDLB_NUMERICPARSEUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide correctly rounded conversion of text to floating-point.
+//
+//@CLASSES:
+//  bdlb::NumericParseUtil: namespace for text to floating-point functions
+//
+//@SEE_ALSO: bdlb_numericformatterutil
+//
+//@DESCRIPTION: This component provides a utility 'struct',
+// 'bdlb::NumericParseUtil', that converts the decimal text representation of
+// a number, supplied as a 'bslstl::StringRef', to the nearest 'double' value
+// (ties are resolved to the value with an even significand, as required by
+// IEEE 754 round-to-nearest).  The result is exactly the value 'strtod'
+// produces for the same text in the "C" locale, but 'parseDouble' does not
+// require a null-terminated copy of the input, never allocates memory, and
+// does not consult the global locale.
+//
+// Most inputs are converted by the Eisel-Lemire algorithm (Daniel Lemire,
+// "Number Parsing at a Gigabyte per Second", Software: Practice and
+// Experience 51(8), 2021), which multiplies the (up to 19) leading decimal
+// digits by a 128-bit approximation of the required power of 10 taken from a
+// precomputed table.  The rare inputs for which that product cannot decide
+// the rounding (only possible when more than 19 significant digits are
+// supplied) are converted by a slower, exact, fixed-capacity big-decimal
+// algorithm, so the result is always correctly rounded.
+//
+///Input Format
+///------------
+// 'parseDouble' accepts the following grammar, and requires the *entire*
+// input to match it:
+//..
+//  NUMBER   ::= [SIGN] MANTISSA [EXPONENT]
+//  SIGN     ::= '+' | '-'
+//  MANTISSA ::= DIGITS ['.' [DIGITS]] | '.' DIGITS
+//  EXPONENT ::= ('e' | 'E') [SIGN] DIGITS
+//  DIGITS   ::= ('0' | '1' | ... | '9')+
+//..
+// Note that, unlike 'strtod', leading whitespace, hexadecimal floating-point
+// notation, and the names of special values (e.g., "inf" and "nan") are *not*
+// accepted; callers that support special values must recognize their
+// spelling before calling 'parseDouble'.  Also note that this grammar is a
+// superset of both the JSON 'number' grammar and the XML Schema 'xs:double'
+// lexical space (excluding special values), so callers may need to apply
+// additional restrictions.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Parsing a Number Embedded in a Larger Buffer
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are decoding a message in which numeric fields are delimited
+// by commas, and we want to convert a field to a 'double' without copying
+// it to a null-terminated buffer.
+//
+// First, we create a reference to the field of interest:
+//..
+//  const char              *message = "12.5,0.1,6.02214076e23,abc";
+//  const bslstl::StringRef  field(message + 5, 3);
+//  assert("0.1" == field);
+//..
+// Then, we parse the field and observe that the result is the same value the
+// compiler produces for the literal '0.1':
+//..
+//  double value = 0.0;
+//  int    rc    = bdlb::NumericParseUtil::parseDouble(&value, field);
+//  assert(0   == rc);
+//  assert(0.1 == value);
+//..
+// Next, we parse a field that uses scientific notation:
+//..
+//  rc = bdlb::NumericParseUtil::parseDouble(
+//                                    &value,
+//                                    bslstl::StringRef(message + 9, 13));
+//  assert(0              == rc);
+//  assert(6.02214076e23  == value);
+//..
+// Then, we observe that a field that is not a number is rejected, and that
+// the output is left unmodified:
+//..
+//  rc = bdlb::NumericParseUtil::parseDouble(
+//                                    &value,
+//                                    bslstl::StringRef(message + 23, 3));
+//  assert(0              >  rc);
+//  assert(6.02214076e23  == value);
+//..
+// Finally, we observe that a number too large to be represented by a
+// 'double' is reported by a positive return value, and that the output is
+// set to infinity:
+//..
+//  rc = bdlb::NumericParseUtil::parseDouble(&value, "-1e400");
+//  assert(0 < rc);
+//  assert(-bsl::numeric_limits<double>::infinity() == value);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STRINGREF
+#include <bslstl_stringref.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlb {
+
+                           // =======================
+                           // struct NumericParseUtil
+                           // =======================
+
+struct NumericParseUtil {
+    // This 'struct' provides a namespace for functions that convert decimal
+    // text to the nearest floating-point value.
+
+    // CLASS METHODS
+    static int parseDouble(double *result, const bslstl::StringRef& input);
+        // Load into the specified 'result' the 'double' value nearest to the
+        // number represented by the specified 'input', which must match the
+        // grammar described in {Input Format} in its entirety.  Return 0 on
+        // success, a positive value if 'input' represents a non-zero number
+        // whose magnitude is either too large or too small to be represented
+        // by a 'double' (in which case 'result' is loaded with infinity or
+        // zero, respectively, having the sign of the number), and a negative
+        // value, with no effect on 'result', if 'input' does not match the
+        // grammar.  Note that a number whose nearest 'double' value is
+        // subnormal is *not* reported as out of range.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,752 @@
+// bdlb_numericparseutil.t.cpp                                        -*-C++-*-
+#include <bdlb_numericparseutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cfloat.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test is a utility that converts decimal text to the
+// nearest 'double'.  We first verify that exactly the inputs described by
+// the documented grammar are accepted, and that rejected inputs leave the
+// output unmodified.  We then verify the converted value against a table of
+// inputs chosen to exercise each of the three conversion strategies (exact
+// fast path, Eisel-Lemire, and big-decimal fallback), exact ties between two
+// 'double' values, subnormal results, and overflow and underflow.  Finally,
+// we verify on a large set of pseudo-random inputs that the result is
+// identical to that of 'strtod', which is correctly rounded on the platforms
+// we support.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int parseDouble(double *result, const bslstl::StringRef& input);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: The result is correctly rounded.
+// [ 3] CONCERN: Out-of-range values are reported.
+// [ 4] CONCERN: The result matches 'strtod'.
+// [ 4] CONCERN: No memory is allocated.
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'parseDouble' VS. 'strtod'
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlb::NumericParseUtil Util;
+typedef bsls::Types::Uint64    Uint64;
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+Uint64 nextRandom(Uint64 *state)
+    // Advance the specified xorshift 'state' and return its new value.
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+bool isSameDouble(double lhs, double rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same bit
+    // pattern, and 'false' otherwise.
+{
+    return 0 == bsl::memcmp(&lhs, &rhs, sizeof lhs);
+}
+
+bsl::string multiplyDecimal(const bsl::string& digits, int factor, int times)
+    // Return the decimal digits of the integer whose decimal digits are the
+    // specified 'digits', multiplied by the specified 'factor' raised to the
+    // specified 'times'.  The behavior is undefined unless '0 < factor < 10'.
+{
+    bsl::string result(digits);
+    for (int t = 0; t < times; ++t) {
+        int carry = 0;
+        for (int i = static_cast<int>(result.size()) - 1; i >= 0; --i) {
+            const int product = (result[i] - '0') * factor + carry;
+            result[i] = static_cast<char>('0' + product % 10);
+            carry     = product / 10;
+        }
+        if (carry) {
+            result.insert(result.begin(), static_cast<char>('0' + carry));
+        }
+    }
+    return result;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test            = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose         = argc > 2;
+    const bool veryVerbose     = argc > 3;
+    const bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Parsing a Number Embedded in a Larger Buffer
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are decoding a message in which numeric fields are delimited
+// by commas, and we want to convert a field to a 'double' without copying
+// it to a null-terminated buffer.
+//
+// First, we create a reference to the field of interest:
+//..
+    const char              *message = "12.5,0.1,6.02214076e23,abc";
+    const bslstl::StringRef  field(message + 5, 3);
+    ASSERT("0.1" == field);
+//..
+// Then, we parse the field and observe that the result is the same value the
+// compiler produces for the literal '0.1':
+//..
+    double value = 0.0;
+    int    rc    = bdlb::NumericParseUtil::parseDouble(&value, field);
+    ASSERT(0   == rc);
+    ASSERT(0.1 == value);
+//..
+// Next, we parse a field that uses scientific notation:
+//..
+    rc = bdlb::NumericParseUtil::parseDouble(
+                                      &value,
+                                      bslstl::StringRef(message + 9, 13));
+    ASSERT(0              == rc);
+    ASSERT(6.02214076e23  == value);
+//..
+// Then, we observe that a field that is not a number is rejected, and that
+// the output is left unmodified:
+//..
+    rc = bdlb::NumericParseUtil::parseDouble(
+                                      &value,
+                                      bslstl::StringRef(message + 23, 3));
+    ASSERT(0              >  rc);
+    ASSERT(6.02214076e23  == value);
+//..
+// Finally, we observe that a number too large to be represented by a
+// 'double' is reported by a positive return value, and that the output is
+// set to infinity:
+//..
+    rc = bdlb::NumericParseUtil::parseDouble(&value, "-1e400");
+    ASSERT(0 < rc);
+    ASSERT(-bsl::numeric_limits<double>::infinity() == value);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COMPARISON WITH 'strtod'
+        //
+        // Concerns:
+        //: 1 For any input, the result is identical to that of 'strtod'.
+        //:
+        //: 2 A positive value is returned exactly when 'strtod' reports an
+        //:   infinite result, or a zero result for a non-zero input.
+        //:
+        //: 3 No memory is allocated.
+        //
+        // Plan:
+        //: 1 For a set of pseudo-random bit patterns, format the value with
+        //:   'sprintf' using a random precision between 1 and 25 significant
+        //:   digits, and verify that 'parseDouble' and 'strtod' produce the
+        //:   same bit pattern.  (C-1..2)
+        //:
+        //: 2 For a set of pseudo-random digit strings of up to 40 (and
+        //:   occasionally up to 800) digits, with a randomly placed decimal
+        //:   point and a random exponent in '[-350, 350)', repeat P-1.
+        //:   (C-1..2)
+        //:
+        //: 3 Verify that the default allocator was not used.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: The result matches 'strtod'.
+        //   CONCERN: No memory is allocated.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COMPARISON WITH 'strtod'" << endl
+                          << "========================" << endl;
+
+        const int NUM_RANDOM = verbose ? 1000000 : 50000;
+
+        const double INF = bsl::numeric_limits<double>::infinity();
+
+        bsl::string input(bslma::Default::globalAllocator());
+        input.reserve(1024);
+
+        Uint64 state = 0x123456789abcdefULL;
+
+        for (int ti = 0; ti < 2 * NUM_RANDOM; ++ti) {
+            if (ti < NUM_RANDOM) {
+                Uint64 bits = nextRandom(&state);
+                double value;
+                bsl::memcpy(&value, &bits, sizeof value);
+                if (value != value || value - value != 0) {
+                    continue;  // NaN or infinity
+                }
+
+                char      buffer[64];
+                const int precision = static_cast<int>(
+                                                nextRandom(&state) % 25) + 1;
+                bsl::sprintf(buffer, "%.*g", precision, value);
+                input.assign(buffer);
+            }
+            else {
+                const int maxDigits = 0 == ti % 100 ? 800 : 40;
+                const int numDigits = static_cast<int>(
+                                        nextRandom(&state) % maxDigits) + 1;
+                input.clear();
+                for (int i = 0; i < numDigits; ++i) {
+                    input.push_back(static_cast<char>(
+                                             '0' + nextRandom(&state) % 10));
+                }
+                if (nextRandom(&state) % 2) {
+                    input.insert(nextRandom(&state) % (numDigits + 1), 1, '.');
+                }
+
+                char exponent[16];
+                bsl::sprintf(exponent,
+                             "e%d",
+                             static_cast<int>(nextRandom(&state) % 700) - 350);
+                input.append(exponent);
+            }
+
+            const double EXPECTED = bsl::strtod(input.c_str(), 0);
+
+            double    result = 0.0;
+            const int rc     = Util::parseDouble(&result, input);
+
+            if (veryVeryVerbose) { T_ P_(input) P(result) }
+
+            const bool isZero    = 0 == EXPECTED;
+            const bool isNonZero = bsl::string::npos
+                                != input.find_first_of("123456789");
+            const bool isOutOfRange = INF == EXPECTED || -INF == EXPECTED
+                                   || (isZero && isNonZero
+                                    && input.find_first_of("123456789")
+                                                        < input.find('e'));
+
+            ASSERTV(input, rc, 0 <= rc);
+            ASSERTV(input, rc, isOutOfRange, isOutOfRange == (0 < rc));
+            ASSERTV(input, result, EXPECTED, isSameDouble(EXPECTED, result));
+        }
+
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CORRECT ROUNDING
+        //
+        // Concerns:
+        //: 1 Inputs converted by each strategy (exact fast path,
+        //:   Eisel-Lemire, and the big-decimal fallback) produce the nearest
+        //:   'double'.
+        //:
+        //: 2 Exact ties between two 'double' values are rounded to the value
+        //:   with an even significand, and any non-zero digit after a tie,
+        //:   however far from the leading digits, breaks the tie.
+        //:
+        //: 3 Subnormal results, and results at the boundary between
+        //:   subnormal and normal values, are correct.
+        //:
+        //: 4 A non-zero number that rounds to infinity or to zero produces
+        //:   that value, with the sign of the number, and a positive return
+        //:   value; zero itself is not out of range.
+        //:
+        //: 5 Exponents too large to be represented by an 'int' are handled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, verify the result and return
+        //:   value for a set of inputs chosen to cover each concern, with
+        //:   expected values given as literals (which the compiler converts
+        //:   with correct rounding).  (C-1..5)
+        //:
+        //: 2 Construct the exact decimal expansions of the ties between 0 and
+        //:   the smallest subnormal value, and between 'DBL_MAX' and '2^1024',
+        //:   and verify that they round to even, and that appending a
+        //:   non-zero digit (or reducing the last digit) moves the result
+        //:   accordingly.  (C-2..4)
+        //
+        // Testing:
+        //   CONCERN: The result is correctly rounded.
+        //   CONCERN: Out-of-range values are reported.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CORRECT ROUNDING" << endl
+                          << "================" << endl;
+
+        const double INF = bsl::numeric_limits<double>::infinity();
+
+        if (verbose) cout << "\nTable-driven inputs." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_input;
+                int         d_rc;     // 0 or 1 (out of range)
+                double      d_expected;
+            } DATA[] = {
+                //LINE INPUT                                    RC  EXPECTED
+                //---- ---------------------------------------- --  ---------
+
+                // exact fast path
+                { L_,  "0",                                      0,  0.0     },
+                { L_,  "-0",                                     0, -0.0     },
+                { L_,  "0e999999999999999999999",                0,  0.0     },
+                { L_,  "123.456",                                0,  123.456 },
+                { L_,  "9007199254740992",                       0,
+                                                         9007199254740992.0 },
+                { L_,  "1e22",                                   0,  1e22    },
+                { L_,  "1e-22",                                  0,  1e-22   },
+                { L_,  "-4.5e-3",                                0, -4.5e-3  },
+
+                // Eisel-Lemire
+                { L_,  "1e23",                                   0,  1e23    },
+                { L_,  "9007199254740993",                       0,
+                                                         9007199254740992.0 },
+                { L_,  "9007199254740995",                       0,
+                                                         9007199254740996.0 },
+                { L_,  "9007199254740993.0000000000000000001",   0,
+                                                         9007199254740994.0 },
+                { L_,  "0.1",                                    0,  0.1     },
+                { L_,  "3.14159265358979323846",                 0,
+                                                    3.14159265358979323846 },
+                { L_,  "1.7976931348623157e308",                 0,  DBL_MAX },
+                { L_,  "1.7976931348623158e308",                 0,  DBL_MAX },
+                { L_,  "2.2250738585072014e-308",                0,  DBL_MIN },
+                { L_,  "2.2250738585072011e-308",                0,
+                                                   2.2250738585072011e-308 },
+                { L_,  "4.9406564584124654e-324",                0,  5e-324  },
+                { L_,  "7.4e-324",                               0,  5e-324  },
+                { L_,  "7.5e-324",                               0,  1e-323  },
+                { L_,  "123456789012345678901234567890e-29",     0,
+                                             1.2345678901234567890123456789 },
+                { L_,  "0.00000000000000000000000000000000000000000000000000"
+                       "000000000000000000000000000000000000000000000000001"
+                       "e101",                                   0,  1.0     },
+                { L_,  "10000000000000000000000000000000000000000000000000"
+                       "000000000000000000000000000000000000000000000000000"
+                       "e-100",                                  0,  1.0     },
+
+                // out of range
+                { L_,  "1.7976931348623159e308",                 1,  INF     },
+                { L_,  "-1e309",                                 1, -INF     },
+                { L_,  "1e999999999999999999999",                1,  INF     },
+                { L_,  "2e-324",                                 1,  0.0     },
+                { L_,  "-1e-400",                                1, -0.0     },
+                { L_,  "1e-999999999999999999999",               1,  0.0     },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE     = DATA[ti].d_line;
+                const char *const INPUT    = DATA[ti].d_input;
+                const int         RC       = DATA[ti].d_rc;
+                const double      EXPECTED = DATA[ti].d_expected;
+
+                double    result = 99.0;
+                const int rc     = Util::parseDouble(&result, INPUT);
+
+                if (veryVerbose) { T_ P_(LINE) P_(rc) P(result) }
+
+                ASSERTV(LINE, rc, RC, RC == rc);
+                ASSERTV(LINE, result, EXPECTED,
+                        isSameDouble(EXPECTED, result));
+            }
+        }
+
+        if (verbose) cout << "\nExact ties with long expansions." << endl;
+        {
+            // 2^-1075, half of the smallest subnormal value, is
+            // '5^1075 * 10^-1075'.
+
+            const bsl::string HALF_MIN = multiplyDecimal("1", 5, 1075)
+                                                                   + "e-1075";
+
+            double result = 99.0;
+            ASSERT(1 == Util::parseDouble(&result, HALF_MIN));
+            ASSERT(isSameDouble(0.0, result));
+
+            bsl::string input = multiplyDecimal("1", 5, 1075) + "1e-1076";
+            ASSERT(0 == Util::parseDouble(&result, input));
+            ASSERT(isSameDouble(5e-324, result));
+
+            input = "-" + HALF_MIN;
+            ASSERT(1 == Util::parseDouble(&result, input));
+            ASSERT(isSameDouble(-0.0, result));
+
+            // 'DBL_MAX + ulp / 2' is '(2^54 - 1) * 2^970'.  'DBL_MAX' has an
+            // odd significand, so the tie rounds up to infinity.
+
+            const bsl::string HALF_MAX =
+                                  multiplyDecimal("18014398509481983", 2, 970);
+
+            ASSERT(1 == Util::parseDouble(&result, HALF_MAX));
+            ASSERT(isSameDouble(INF, result));
+
+            input = HALF_MAX;
+            --input[input.size() - 1];
+            ASSERT(0 == Util::parseDouble(&result, input));
+            ASSERT(isSameDouble(DBL_MAX, result));
+
+            input = HALF_MAX;
+            --input[input.size() - 1];
+            input.insert(input.size() - 1, ".");
+            input += "9999999999999999999999999e1";
+            ASSERT(0 == Util::parseDouble(&result, input));
+            ASSERT(isSameDouble(DBL_MAX, result));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'parseDouble' SYNTAX
+        //
+        // Concerns:
+        //: 1 Inputs matching the documented grammar are accepted, with or
+        //:   without a sign, integral digits, fractional digits, a decimal
+        //:   point, or an exponent (as the grammar permits).
+        //:
+        //: 2 The entire input must match: leading or trailing characters,
+        //:   including whitespace and null characters, cause failure.
+        //:
+        //: 3 Special value names and hexadecimal notation are rejected.
+        //:
+        //: 4 On failure, a negative value is returned and the output is not
+        //:   modified.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, verify the return value and
+        //:   result for a set of valid and invalid inputs.  (C-1..4)
+        //
+        // Testing:
+        //   int parseDouble(double *result, const bslstl::StringRef& input);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'parseDouble' SYNTAX" << endl
+                          << "====================" << endl;
+
+        const double UNSET = -99.0;  // marks an invalid input
+
+        static const struct {
+            int         d_line;
+            const char *d_input;
+            int         d_length;    // -1 means 'strlen(d_input)'
+            double      d_expected;
+        } DATA[] = {
+            //LINE  INPUT                 LENGTH  EXPECTED
+            //----  --------------------  ------  --------
+            { L_,   "0",                  -1,       0.0   },
+            { L_,   "+0",                 -1,       0.0   },
+            { L_,   "7",                  -1,       7.0   },
+            { L_,   "+7",                 -1,       7.0   },
+            { L_,   "-7",                 -1,      -7.0   },
+            { L_,   "007",                -1,       7.0   },
+            { L_,   "7.",                 -1,       7.0   },
+            { L_,   ".5",                 -1,       0.5   },
+            { L_,   "-.5",                -1,      -0.5   },
+            { L_,   "0.000",              -1,       0.0   },
+            { L_,   "1.25e2",             -1,     125.0   },
+            { L_,   "1.25E2",             -1,     125.0   },
+            { L_,   "1.25e+2",            -1,     125.0   },
+            { L_,   "125e-2",             -1,       1.25  },
+            { L_,   "125.e-2",            -1,       1.25  },
+            { L_,   ".125e1",             -1,       1.25  },
+            { L_,   "1e00000000000000002",-1,     100.0   },
+
+            { L_,   "",                   -1,     UNSET   },
+            { L_,   "+",                  -1,     UNSET   },
+            { L_,   "-",                  -1,     UNSET   },
+            { L_,   ".",                  -1,     UNSET   },
+            { L_,   "-.",                 -1,     UNSET   },
+            { L_,   "e5",                 -1,     UNSET   },
+            { L_,   ".e5",                -1,     UNSET   },
+            { L_,   "1e",                 -1,     UNSET   },
+            { L_,   "1e+",                -1,     UNSET   },
+            { L_,   "1e-",                -1,     UNSET   },
+            { L_,   "1e+-1",              -1,     UNSET   },
+            { L_,   "--1",                -1,     UNSET   },
+            { L_,   "+-1",                -1,     UNSET   },
+            { L_,   "1..2",               -1,     UNSET   },
+            { L_,   "1.2.3",              -1,     UNSET   },
+            { L_,   "1.5e3.0",            -1,     UNSET   },
+            { L_,   "1,5",                -1,     UNSET   },
+            { L_,   " 1",                 -1,     UNSET   },
+            { L_,   "1 ",                 -1,     UNSET   },
+            { L_,   "1x",                 -1,     UNSET   },
+            { L_,   "1\0",                 2,     UNSET   },
+            { L_,   "inf",                -1,     UNSET   },
+            { L_,   "INF",                -1,     UNSET   },
+            { L_,   "-infinity",          -1,     UNSET   },
+            { L_,   "nan",                -1,     UNSET   },
+            { L_,   "NaN",                -1,     UNSET   },
+            { L_,   "0x10",               -1,     UNSET   },
+            { L_,   "0x1p3",              -1,     UNSET   },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const char *const INPUT    = DATA[ti].d_input;
+            const int         LENGTH   = -1 == DATA[ti].d_length
+                                       ? static_cast<int>(bsl::strlen(INPUT))
+                                       : DATA[ti].d_length;
+            const double      EXPECTED = DATA[ti].d_expected;
+
+            double    result = UNSET;
+            const int rc     = Util::parseDouble(
+                                           &result,
+                                           bslstl::StringRef(INPUT, LENGTH));
+
+            if (veryVerbose) { T_ P_(LINE) P_(INPUT) P_(rc) P(result) }
+
+            if (UNSET == EXPECTED) {
+                ASSERTV(LINE, rc, 0 > rc);
+            }
+            else {
+                ASSERTV(LINE, rc, 0 == rc);
+            }
+            ASSERTV(LINE, result, EXPECTED, EXPECTED == result);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Parse a few valid and invalid inputs and verify the result.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        double result = 0.0;
+
+        ASSERT(0    == Util::parseDouble(&result, "2.5"));
+        ASSERT(2.5  == result);
+
+        ASSERT(0    == Util::parseDouble(&result, "-1e-3"));
+        ASSERT(-1e-3 == result);
+
+        ASSERT(0    == Util::parseDouble(&result, "0.30000000000000004"));
+        ASSERT(0.1 + 0.2 == result);
+
+        ASSERT(0    >  Util::parseDouble(&result, "2.5x"));
+        ASSERT(0.1 + 0.2 == result);
+
+        ASSERT(0    <  Util::parseDouble(&result, "1e1000"));
+        ASSERT(bsl::numeric_limits<double>::infinity() == result);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'parseDouble' VS. 'strtod'
+        //
+        // Concerns:
+        //: 1 'parseDouble' is faster than 'strtod'.
+        //
+        // Plan:
+        //: 1 Format a set of pseudo-random values of mixed magnitude with
+        //:   '%.17g' and with '%.6g', and parse each set with 'parseDouble'
+        //:   and with 'strtod' (on null-terminated copies, which favors
+        //:   'strtod'), and report the times.
+        //
+        // Testing:
+        //   PERFORMANCE: 'parseDouble' VS. 'strtod'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: 'parseDouble' VS. 'strtod'" << endl
+                          << "=======================================" << endl;
+
+        const int NUM_VALUES = 1000;
+        const int NUM_ITERS  = argc > 2 ? atoi(argv[2]) : 1000;
+
+        static char inputs[2][NUM_VALUES][32];
+        Uint64      state = 0x2545f4914f6cdd1dULL;
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const double mantissa = static_cast<double>(
+                                       nextRandom(&state) % 1000000000) / 1e4;
+            const int    exponent = static_cast<int>(
+                                              nextRandom(&state) % 21) - 10;
+            double       value    = mantissa;
+            for (int e = 0; e < exponent; ++e) {
+                value *= 10;
+            }
+            for (int e = 0; e > exponent; --e) {
+                value /= 10;
+            }
+            bsl::sprintf(inputs[0][i], "%.17g", value);
+            bsl::sprintf(inputs[1][i], "%.6g", value);
+        }
+
+        const char *const LABELS[] = { "%.17g", "%.6g" };
+
+        for (int set = 0; set < 2; ++set) {
+            double          checksum = 0.0;
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (int iter = 0; iter < NUM_ITERS; ++iter) {
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    double value;
+                    Util::parseDouble(&value, inputs[set][i]);
+                    checksum += value;
+                }
+            }
+            timer.stop();
+            const double parseTime = timer.accumulatedWallTime();
+
+            timer.reset();
+            timer.start();
+            for (int iter = 0; iter < NUM_ITERS; ++iter) {
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    checksum -= bsl::strtod(inputs[set][i], 0);
+                }
+            }
+            timer.stop();
+            const double strtodTime = timer.accumulatedWallTime();
+
+            const double COUNT = static_cast<double>(NUM_VALUES) * NUM_ITERS;
+
+            cout << LABELS[set] << ": parseDouble "
+                 << parseTime / COUNT * 1e9 << " ns, strtod "
+                 << strtodTime / COUNT * 1e9 << " ns" << endl;
+
+            if (veryVerbose) {
+                P(checksum)
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
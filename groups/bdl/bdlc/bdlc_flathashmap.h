@@ -0,0 +1,792 @@
+// bdlc_flathashmap.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHMAP
+#define INCLUDED_BDLC_FLATHASHMAP
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressing unordered map container.
+//
+//@CLASSES:
+//  bdlc::FlatHashMap: open-addressing unordered map container
+//
+//@SEE_ALSO: bdlc_flathashset, bdlc_flathashtable, bslstl_unorderedmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::FlatHashMap', implementing an unordered map of unique keys to
+// values.  The interface of 'bdlc::FlatHashMap' is a subset of that of
+// 'bsl::unordered_map'; its implementation, a "flat" open-addressing hash
+// table described in 'bdlc_flathashtable', differs.
+//
+// A 'bsl::unordered_map' allocates a node for each element, and a lookup
+// follows pointers from a bucket array through a linked list of nodes.  A
+// 'bdlc::FlatHashMap' stores its elements in a single contiguous array, along
+// with a parallel array of control bytes, each holding 7 bits of the hash of
+// the key of an element.  A lookup inspects the control bytes of a group of
+// 16 elements at once (using SSE2 instructions where available) and compares
+// the keys of only those elements whose control bytes match.  As a result,
+// insertions perform no per-element allocation, and lookups, whether or not
+// the key is present, typically touch one or two cache lines.
+//
+// The price paid for this performance is that the guarantees of
+// 'bsl::unordered_map' regarding the stability of references are not
+// provided: any insertion that grows the map invalidates all iterators,
+// pointers, and references to its elements, and the map requires its
+// 'KEY' and 'VALUE' types to be copy-constructible.  Furthermore, the
+// bucket interface of 'bsl::unordered_map' is not provided, and the maximum
+// load factor is fixed at 7/8.
+//
+// The hash functor, 'HASH', defaults to 'bsl::hash<KEY>'; the value it
+// returns is mixed before use, so that functors (such as 'bsl::hash' for
+// integral types) that do not distribute their values evenly are adequate.
+// Functors of the 'bslh' framework, such as 'bslh::Hash<>', may be supplied
+// to hash types that provide 'hashAppend'.
+//
+///Memory Allocation
+///-----------------
+// A 'bdlc::FlatHashMap' uses the allocator supplied at construction (or the
+// currently installed default allocator) to supply memory for its arrays, and
+// passes it to the elements it creates if they use 'bslma' allocators.  A
+// map allocates no memory until its first insertion, or a call to 'reserve'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting Words
+///- - - - - - - - - - - - -
+// Suppose we wish to count the occurrences of each word of a text.
+//
+// First, we define the words of the text:
+//..
+//  const char *WORDS[] = { "the", "quick", "brown", "fox", "jumps",
+//                          "over", "the", "lazy", "dog", "the", "end" };
+//  const int NUM_WORDS = sizeof WORDS / sizeof *WORDS;
+//..
+// Then, we create a map from words to their counts, and count the words,
+// relying on 'operator[]' to insert a word with a count of 0 the first time
+// it is seen:
+//..
+//  bdlc::FlatHashMap<bsl::string, int> counts;
+//
+//  for (int i = 0; i < NUM_WORDS; ++i) {
+//      ++counts[WORDS[i]];
+//  }
+//..
+// Finally, we verify the counts:
+//..
+//  assert(9 == counts.size());
+//  assert(3 == counts["the"]);
+//  assert(1 == counts["fox"]);
+//  assert(false == counts.contains("cat"));
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLC_FLATHASHTABLE
+#include <bdlc_flathashtable.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARDESTRUCTIONPRIMITIVES
+#include <bslalg_scalardestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_CONSTRUCTIONUTIL
+#include <bslma_constructionutil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DESTRUCTORGUARD
+#include <bslma_destructorguard.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_OBJECTBUFFER
+#include <bsls_objectbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_FUNCTIONAL
+#include <bsl_functional.h>
+#endif
+
+#ifndef INCLUDED_BSL_UTILITY
+#include <bsl_utility.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                       // ============================
+                       // struct FlatHashMap_EntryUtil
+                       // ============================
+
+template <class KEY, class VALUE>
+struct FlatHashMap_EntryUtil {
+    // This component-private utility 'struct' provides the entry operations
+    // required by 'FlatHashTable' for the entries of a 'FlatHashMap'.
+
+    // TYPES
+    typedef bsl::pair<const KEY, VALUE> Entry;
+
+    // CLASS METHODS
+    static void constructFromKey(Entry            *address,
+                                 bslma::Allocator *allocator,
+                                 const KEY&        key);
+        // Construct at the specified 'address' an entry having the specified
+        // 'key' and a default-constructed value, using the specified
+        // 'allocator' to supply memory.
+
+    static const KEY& key(const Entry& entry);
+        // Return the key of the specified 'entry'.
+};
+
+                            // =================
+                            // class FlatHashMap
+                            // =================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class FlatHashMap {
+    // This class template implements a value-semantic unordered map of unique
+    // keys of type 'KEY' to values of type 'VALUE', stored in an
+    // open-addressing hash table.
+
+    // PRIVATE TYPES
+    typedef FlatHashTable<KEY,
+                          bsl::pair<const KEY, VALUE>,
+                          FlatHashMap_EntryUtil<KEY, VALUE>,
+                          HASH,
+                          EQUAL> ImplType;
+
+    // DATA
+    ImplType d_impl;  // underlying hash table
+
+    // FRIENDS
+    template <class K, class V, class H, class E>
+    friend bool operator==(const FlatHashMap<K, V, H, E>&,
+                           const FlatHashMap<K, V, H, E>&);
+
+  public:
+    // TYPES
+    typedef KEY                                  key_type;
+    typedef VALUE                                mapped_type;
+    typedef bsl::pair<const KEY, VALUE>          value_type;
+    typedef bsl::size_t                          size_type;
+    typedef HASH                                 hasher;
+    typedef EQUAL                                key_equal;
+    typedef value_type&                          reference;
+    typedef const value_type&                    const_reference;
+    typedef typename ImplType::iterator          iterator;
+    typedef typename ImplType::const_iterator    const_iterator;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashMap, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit FlatHashMap(bslma::Allocator *basicAllocator = 0);
+    explicit FlatHashMap(bsl::size_t       capacity,
+                         bslma::Allocator *basicAllocator = 0);
+    FlatHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    FlatHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create an empty map.  Optionally specify a 'capacity' indicating
+        // the number of elements the map can hold without growing; if
+        // 'capacity' is not supplied or is 0, no memory is allocated.
+        // Optionally specify a 'hash' functor used to hash keys.  If 'hash'
+        // is not supplied, a default-constructed 'HASH' is used.  Optionally
+        // specify an 'equal' functor used to compare keys.  If 'equal' is not
+        // supplied, a default-constructed 'EQUAL' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    template <class INPUT_ITERATOR>
+    FlatHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+        // Create a map holding the elements in the range '[first .. last)',
+        // ignoring elements whose keys duplicate that of a previous element.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    FlatHashMap(const FlatHashMap&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a map having the same value, hash functor, and equality
+        // functor as the specified 'original'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    //! ~FlatHashMap() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! FlatHashMap& operator=(const FlatHashMap& rhs) = default;
+        // Assign to this map the value, hash functor, and equality functor of
+        // the specified 'rhs', and return a reference providing modifiable
+        // access to this map.
+
+    VALUE& operator[](const KEY& key);
+        // Return a reference providing modifiable access to the value mapped
+        // to the specified 'key', first inserting an element having 'key' and
+        // a default-constructed value if this map has no such element.
+
+    VALUE& at(const KEY& key);
+        // Return a reference providing modifiable access to the value mapped
+        // to the specified 'key'.  Throw 'bsl::out_of_range' if this map has
+        // no element having 'key'.
+
+    iterator begin();
+        // Return an iterator to the first element of this map, or the
+        // past-the-end iterator if this map is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this map.
+
+    void clear();
+        // Remove all elements from this map.  Note that the capacity of the
+        // map is unchanged.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove the element having the specified 'key' from this map, if
+        // any.  Return the number of elements removed (0 or 1).
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Remove the element at the specified 'position' from this map, and
+        // return an iterator to the element following it.  The behavior is
+        // undefined unless 'position' refers to an element of this map.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove the elements in the range '[first .. last)' from this map,
+        // and return an iterator to the element following the last one
+        // removed.  The behavior is undefined unless '[first .. last)' is a
+        // valid range of elements of this map.
+
+    iterator find(const KEY& key);
+        // Return an iterator to the element having the specified 'key', or the
+        // past-the-end iterator if this map has no such element.
+
+    bsl::pair<iterator, bool> insert(const value_type& value);
+        // Insert a copy of the specified 'value' into this map if it has no
+        // element having the key of 'value'.  Return a pair whose 'first'
+        // member refers to the element having that key, and whose 'second'
+        // member is 'true' if 'value' was inserted, and 'false' otherwise.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert copies of the elements in the range '[first .. last)' whose
+        // keys are not already in this map.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this map to the smallest valid capacity that
+        // is at least the specified 'minimumCapacity' and can hold the
+        // elements of this map.  Note that 'rehash(0)' on an empty map
+        // releases its memory.
+
+    void reserve(bsl::size_t numElements);
+        // Increase the capacity of this map, if needed, so that it can hold
+        // the specified 'numElements' without growing.
+
+    void swap(FlatHashMap& other);
+        // Exchange the value, hash functor, and equality functor of this map
+        // with those of the specified 'other'.  The behavior is undefined
+        // unless this map and 'other' use the same allocator.
+
+    // ACCESSORS
+    const VALUE& at(const KEY& key) const;
+        // Return a reference providing non-modifiable access to the value
+        // mapped to the specified 'key'.  Throw 'bsl::out_of_range' if this
+        // map has no element having 'key'.
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator to the first element of this map, or the
+        // past-the-end iterator if this map is empty.
+
+    bsl::size_t capacity() const;
+        // Return the number of elements for which this map has space.  Note
+        // that the map grows before its size exceeds
+        // 'capacity() * max_load_factor()'.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this map has an element having the specified 'key',
+        // and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements having the specified 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this map has no elements, and 'false' otherwise.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator of this map.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator to the element having the specified 'key', or the
+        // past-the-end iterator if this map has no such element.
+
+    HASH hash_function() const;
+        // Return (a copy of) the hash functor of this map.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the key-equality functor of this map.
+
+    float load_factor() const;
+        // Return the ratio of the size to the capacity of this map, or 0 if
+        // the capacity is 0.
+
+    float max_load_factor() const;
+        // Return the maximum load factor of this map.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this map.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this map to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator==(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' maps have the same value,
+    // and 'false' otherwise.  Two maps have the same value if they have the
+    // same number of elements, and for each element of 'lhs' there is an
+    // element of 'rhs' having an equal key and an equal value.
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator!=(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' maps do not have the same
+    // value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void swap(FlatHashMap<KEY, VALUE, HASH, EQUAL>& a,
+          FlatHashMap<KEY, VALUE, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' maps.  The behavior is
+    // undefined unless 'a' and 'b' use the same allocator.
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                       // ----------------------------
+                       // struct FlatHashMap_EntryUtil
+                       // ----------------------------
+
+// CLASS METHODS
+template <class KEY, class VALUE>
+inline
+void FlatHashMap_EntryUtil<KEY, VALUE>::constructFromKey(
+                                                   Entry            *address,
+                                                   bslma::Allocator *allocator,
+                                                   const KEY&        key)
+{
+    bsls::ObjectBuffer<VALUE> value;
+    bslma::ConstructionUtil::construct(value.address(), allocator);
+    bslma::DestructorGuard<VALUE> guard(value.address());
+
+    bslma::ConstructionUtil::construct(address,
+                                       allocator,
+                                       key,
+                                       value.object());
+}
+
+template <class KEY, class VALUE>
+inline
+const KEY& FlatHashMap_EntryUtil<KEY, VALUE>::key(const Entry& entry)
+{
+    return entry.first;
+}
+
+                            // -----------------
+                            // class FlatHashMap
+                            // -----------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              const EQUAL&      equal,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    d_impl.insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                          const FlatHashMap&  original,
+                                          bslma::Allocator   *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator[](const KEY& key)
+{
+    return d_impl.tryEmplace(key).first->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::at(const KEY& key)
+{
+    iterator it = d_impl.find(key);
+
+    if (it == d_impl.end()) {
+        bslstl::StdExceptUtil::throwOutOfRange(
+                                     "FlatHashMap<...>::at(key): invalid key");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::end()
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator position)
+{
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(iterator position)
+{
+    return d_impl.erase(const_iterator(position));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator first,
+                                            const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(const value_type& value)
+{
+    return d_impl.insert(value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    d_impl.insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::rehash(bsl::size_t minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::reserve(bsl::size_t numElements)
+{
+    d_impl.reserve(numElements);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::swap(FlatHashMap& other)
+{
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+const VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::at(const KEY& key) const
+{
+    const_iterator it = d_impl.find(key);
+
+    if (it == d_impl.end()) {
+        bslstl::StdExceptUtil::throwOutOfRange(
+                                     "FlatHashMap<...>::at(key): invalid key");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::count(const KEY& key) const
+{
+    return d_impl.count(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::cend() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH FlatHashMap<KEY, VALUE, HASH, EQUAL>::hash_function() const
+{
+    return d_impl.hash_function();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL FlatHashMap<KEY, VALUE, HASH, EQUAL>::key_eq() const
+{
+    return d_impl.key_eq();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float FlatHashMap<KEY, VALUE, HASH, EQUAL>::load_factor() const
+{
+    return d_impl.load_factor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float FlatHashMap<KEY, VALUE, HASH, EQUAL>::max_load_factor() const
+{
+    return d_impl.max_load_factor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    return d_impl.size();
+}
+
+                                  // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *FlatHashMap<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator==(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                      const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                      const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void bdlc::swap(FlatHashMap<KEY, VALUE, HASH, EQUAL>& a,
+                FlatHashMap<KEY, VALUE, HASH, EQUAL>& b)
+{
+    a.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1054 @@
+// bdlc_flathashmap.t.cpp                                             -*-C++-*-
+#include <bdlc_flathashmap.h>
+
+#include <bslim_testutil.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>      // 'sprintf', 'printf' (needed by exception
+                             // macros)
+#include <bsl_cstdlib.h>     // 'atoi', 'rand'
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_stdexcept.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlc::FlatHashMap' is a thin adapter of 'bdlc::FlatHashTable', which is
+// tested thoroughly in its own component.  We must verify that each method
+// forwards to the appropriate method of the table, that entries are
+// constructed with the map's allocator (in particular, the default value
+// inserted by 'operator[]'), that 'at' reports missing keys, and that
+// 'bslh::Hash<>' may be used as the hash functor.  We also compare the map
+// with a 'bsl::map' oracle over random operations.  A negative test case
+// benchmarks the map against 'bsl::unordered_map'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit FlatHashMap(bslma::Allocator *basicAllocator = 0);
+// [ 2] explicit FlatHashMap(size_t capacity, bslma::Allocator *ba = 0);
+// [ 2] FlatHashMap(size_t capacity, const HASH& hash, ba = 0);
+// [ 2] FlatHashMap(capacity, const HASH&, const EQUAL&, ba = 0);
+// [ 2] FlatHashMap(INPUT_ITERATOR first, INPUT_ITERATOR last, ba = 0);
+// [ 5] FlatHashMap(const FlatHashMap& original, ba = 0);
+//
+// MANIPULATORS
+// [ 5] FlatHashMap& operator=(const FlatHashMap& rhs);
+// [ 3] VALUE& operator[](const KEY& key);
+// [ 3] VALUE& at(const KEY& key);
+// [ 4] iterator begin();
+// [ 4] iterator end();
+// [ 4] void clear();
+// [ 4] size_t erase(const KEY& key);
+// [ 4] iterator erase(const_iterator position);
+// [ 4] iterator erase(iterator position);
+// [ 4] iterator erase(const_iterator first, const_iterator last);
+// [ 4] iterator find(const KEY& key);
+// [ 4] pair<iterator, bool> insert(const value_type& value);
+// [ 4] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 4] void rehash(size_t minimumCapacity);
+// [ 4] void reserve(size_t numElements);
+// [ 5] void swap(FlatHashMap& other);
+//
+// ACCESSORS
+// [ 3] const VALUE& at(const KEY& key) const;
+// [ 4] const_iterator begin() const;
+// [ 4] const_iterator cbegin() const;
+// [ 2] size_t capacity() const;
+// [ 4] bool contains(const KEY& key) const;
+// [ 4] size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 4] const_iterator end() const;
+// [ 4] const_iterator cend() const;
+// [ 4] const_iterator find(const KEY& key) const;
+// [ 2] HASH hash_function() const;
+// [ 2] EQUAL key_eq() const;
+// [ 2] float load_factor() const;
+// [ 2] float max_load_factor() const;
+// [ 2] size_t size() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const FlatHashMap& lhs, const FlatHashMap& rhs);
+// [ 5] bool operator!=(const FlatHashMap& lhs, const FlatHashMap& rhs);
+//
+// FREE FUNCTIONS
+// [ 5] void swap(FlatHashMap& a, FlatHashMap& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: Elements use the map's allocator.
+// [ 6] CONCERN: 'bslh::Hash<>' can be used as the hash functor.
+// [ 6] CONCERN: Random operations agree with 'bsl::map'.
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: COMPARISON WITH 'bsl::unordered_map'
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashMap<int, int>                 Obj;
+typedef bdlc::FlatHashMap<bsl::string, bsl::string> StringObj;
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct ModuloHash {
+    // This hash functor returns its argument modulo a divisor supplied at
+    // construction, and is used to verify that functors are retained.
+
+    int d_divisor;
+
+    explicit ModuloHash(int divisor = 1000003)
+        // Create a hash functor having the optionally specified 'divisor'.
+    : d_divisor(divisor)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+        // Return the specified 'key' modulo the divisor of this functor.
+    {
+        return static_cast<bsl::size_t>(key % d_divisor);
+    }
+};
+
+struct AbsEqual {
+    // This equality functor compares the absolute values of its arguments,
+    // and is used to verify that functors are retained.
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' and 'rhs' have the same
+        // absolute value, and 'false' otherwise.
+    {
+        return (lhs < 0 ? -lhs : lhs) == (rhs < 0 ? -rhs : rhs);
+    }
+};
+
+struct Point {
+    // This 'struct' is a key type that is hashable only by the 'bslh'
+    // framework.
+
+    int d_x;
+    int d_y;
+};
+
+bool operator==(const Point& lhs, const Point& rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same
+    // coordinates, and 'false' otherwise.
+{
+    return lhs.d_x == rhs.d_x && lhs.d_y == rhs.d_y;
+}
+
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& hashAlg, const Point& point)
+    // Append the coordinates of the specified 'point' to the specified
+    // 'hashAlg'.
+{
+    using bslh::hashAppend;
+    hashAppend(hashAlg, point.d_x);
+    hashAppend(hashAlg, point.d_y);
+}
+
+bslma::Allocator *ndAllocator()
+    // Return the address of the new/delete allocator, which is used by the
+    // performance test to avoid measuring a test allocator.
+{
+    return &bslma::NewDeleteAllocator::singleton();
+}
+
+bsl::string makeKey(int i)
+    // Return a string key, too long for the short-string buffer, formed from
+    // the specified 'i'.
+{
+    char buffer[64];
+    sprintf(buffer, "key-%d-padding-to-avoid-short-strings", i);
+    return bsl::string(buffer, ndAllocator());
+}
+
+template <class MAP, class KEY>
+void benchmark(const char              *name,
+               const bsl::vector<KEY>&  keys,
+               const bsl::vector<KEY>&  missingKeys)
+    // Print the time taken by the specified 'MAP' type, identified by the
+    // specified 'name', to insert the specified 'keys', to look each of them
+    // up, to look up each of the specified 'missingKeys', and to erase the
+    // 'keys'.
+{
+    MAP map(ndAllocator());
+
+    const bsl::size_t N = keys.size();
+
+    bsls::Stopwatch timer;
+
+    timer.start();
+    for (bsl::size_t i = 0; i < N; ++i) {
+        map[keys[i]] = static_cast<int>(i);
+    }
+    timer.stop();
+    const double insertTime = timer.elapsedTime();
+
+    bsls::Types::Int64 sum = 0;
+
+    timer.reset();
+    timer.start();
+    for (int pass = 0; pass < 4; ++pass) {
+        for (bsl::size_t i = 0; i < N; ++i) {
+            sum += map.find(keys[i])->second;
+        }
+    }
+    timer.stop();
+    const double hitTime = timer.elapsedTime() / 4;
+
+    timer.reset();
+    timer.start();
+    for (int pass = 0; pass < 4; ++pass) {
+        for (bsl::size_t i = 0; i < N; ++i) {
+            sum += map.find(missingKeys[i]) == map.end();
+        }
+    }
+    timer.stop();
+    const double missTime = timer.elapsedTime() / 4;
+
+    timer.reset();
+    timer.start();
+    for (bsl::size_t i = 0; i < N; ++i) {
+        sum += map.erase(keys[i]);
+    }
+    timer.stop();
+    const double eraseTime = timer.elapsedTime();
+
+    ASSERT(map.empty());
+    ASSERT(0 < sum);
+
+    const double NS = 1e9 / static_cast<double>(N);
+
+    printf("%-28s %9d %9.1f %9.1f %9.1f %9.1f\n",
+           name,
+           static_cast<int>(N),
+           insertTime * NS,
+           hitTime * NS,
+           missTime * NS,
+           eraseTime * NS);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test            = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose         = argc > 2;
+    const bool veryVerbose     = argc > 3;
+    const bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting Words
+///- - - - - - - - - - - - -
+// Suppose we wish to count the occurrences of each word of a text.
+//
+// First, we define the words of the text:
+//..
+    const char *WORDS[] = { "the", "quick", "brown", "fox", "jumps",
+                            "over", "the", "lazy", "dog", "the", "end" };
+    const int NUM_WORDS = sizeof WORDS / sizeof *WORDS;
+//..
+// Then, we create a map from words to their counts, and count the words,
+// relying on 'operator[]' to insert a word with a count of 0 the first time
+// it is seen:
+//..
+    bdlc::FlatHashMap<bsl::string, int> counts;
+
+    for (int i = 0; i < NUM_WORDS; ++i) {
+        ++counts[WORDS[i]];
+    }
+//..
+// Finally, we verify the counts:
+//..
+    ASSERT(9 == counts.size());
+    ASSERT(3 == counts["the"]);
+    ASSERT(1 == counts["fox"]);
+    ASSERT(false == counts.contains("cat"));
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'bslh::Hash' AND RANDOM OPERATIONS
+        //
+        // Concerns:
+        //: 1 A map can use 'bslh::Hash<>' to hash a key type providing
+        //:   'hashAppend'.
+        //:
+        //: 2 Random sequences of operations agree with 'bsl::map'.
+        //
+        // Plan:
+        //: 1 Insert and look up 'Point' keys in a map using 'bslh::Hash<>'.
+        //:   (C-1)
+        //:
+        //: 2 Apply random insertions, assignments, lookups, and erasures to a
+        //:   map of strings and to a 'bsl::map', and compare them.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: 'bslh::Hash<>' can be used as the hash functor.
+        //   CONCERN: Random operations agree with 'bsl::map'.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'bslh::Hash' AND RANDOM OPERATIONS" << endl
+                          << "==================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\nUsing 'bslh::Hash<>'." << endl;
+        {
+            bdlc::FlatHashMap<Point, int, bslh::Hash<> > mX(&ta);
+
+            for (int x = 0; x < 50; ++x) {
+                for (int y = 0; y < 50; ++y) {
+                    const Point POINT = { x, y };
+                    mX[POINT] = x * 100 + y;
+                }
+            }
+            ASSERT(2500 == mX.size());
+
+            for (int x = 0; x < 50; ++x) {
+                for (int y = 0; y < 50; ++y) {
+                    const Point POINT = { x, y };
+                    ASSERTV(x, y, x * 100 + y == mX.at(POINT));
+
+                    const Point MISSING = { y, x + 50 };
+                    ASSERTV(x, y, !mX.contains(MISSING));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nRandom operations." << endl;
+        {
+            StringObj                          mX(&ta);
+            bsl::map<bsl::string, bsl::string> oracle(&ta);
+
+            srand(5);
+
+            for (int i = 0; i < 20000; ++i) {
+                char buffer[64];
+                sprintf(buffer, "a long key to defeat the short buffer %d",
+                        rand() % 500);
+                const bsl::string KEY(buffer, &ta);
+
+                switch (rand() % 4) {
+                  case 0: {
+                    const StringObj::value_type VALUE(KEY, KEY, &ta);
+
+                    const bool inserted = mX.insert(VALUE).second;
+                    ASSERTV(i, inserted == oracle.insert(VALUE).second);
+                  } break;
+                  case 1: {
+                    const bsl::string NEW_VALUE(buffer + 3, &ta);
+
+                    mX[KEY] = NEW_VALUE;
+
+                    // Avoid 'bsl::map::operator[]', which creates a temporary
+                    // value using the default allocator.
+
+                    oracle.erase(KEY);
+                    oracle.insert(StringObj::value_type(KEY, NEW_VALUE, &ta));
+                  } break;
+                  case 2: {
+                    ASSERTV(i, (0 != oracle.count(KEY)) == mX.contains(KEY));
+                  } break;
+                  default: {
+                    ASSERTV(i, oracle.erase(KEY) == mX.erase(KEY));
+                  } break;
+                }
+            }
+
+            ASSERT(oracle.size() == mX.size());
+            for (bsl::map<bsl::string, bsl::string>::const_iterator it =
+                                                               oracle.begin();
+                 it != oracle.end();
+                 ++it) {
+                ASSERTV(it->first, it->second == mX.at(it->first));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 A copy has the value and functors of the original, and uses the
+        //:   supplied allocator.
+        //:
+        //: 2 Assignment gives the target the value and functors of the
+        //:   source, and retains the target's allocator.
+        //:
+        //: 3 The member and free 'swap' exchange the values and functors of
+        //:   two maps.
+        //:
+        //: 4 Maps compare equal if they have the same keys mapped to the same
+        //:   values.
+        //
+        // Plan:
+        //: 1 Copy, assign, swap, and compare maps of various values using
+        //:   hash functors having state.  (C-1..4)
+        //
+        // Testing:
+        //   FlatHashMap(const FlatHashMap& original, ba = 0);
+        //   FlatHashMap& operator=(const FlatHashMap& rhs);
+        //   void swap(FlatHashMap& other);
+        //   bool operator==(const FlatHashMap& lhs, const FlatHashMap& rhs);
+        //   bool operator!=(const FlatHashMap& lhs, const FlatHashMap& rhs);
+        //   void swap(FlatHashMap& a, FlatHashMap& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, ASSIGNMENT, SWAP, AND EQUALITY" << endl
+                          << "====================================" << endl;
+
+        typedef bdlc::FlatHashMap<int, int, ModuloHash> ModuloObj;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVerbose);
+
+        const int SIZES[]   = { 0, 1, 20, 500 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            ModuloObj mX(0, ModuloHash(31), &ta);  const ModuloObj& X = mX;
+            for (int i = 0; i < SIZE; ++i) {
+                mX[i] = i * i;
+            }
+
+            {
+                const ModuloObj Y(X, &sa);
+                ASSERTV(SIZE, X == Y);
+                ASSERTV(SIZE, !(X != Y));
+                ASSERTV(SIZE, 31  == Y.hash_function().d_divisor);
+                ASSERTV(SIZE, &sa == Y.allocator());
+            }
+
+            {
+                ModuloObj mY(&sa);
+                mY[-1] = 1;
+                ASSERTV(SIZE, X != mY);
+
+                mY = X;
+                ASSERTV(SIZE, X == mY);
+                ASSERTV(SIZE, 31  == mY.hash_function().d_divisor);
+                ASSERTV(SIZE, &sa == mY.allocator());
+
+                if (SIZE) {
+                    mY[0] = -1;
+                    ASSERTV(SIZE, X != mY);
+                }
+            }
+            ASSERTV(SIZE, 0 == sa.numBlocksInUse());
+
+            {
+                ModuloObj mY(&ta);
+                mY[-1] = 1;
+
+                mX.swap(mY);
+                ASSERTV(SIZE, 1 == X.size());
+                ASSERTV(SIZE, 1 == X.at(-1));
+                ASSERTV(SIZE, static_cast<bsl::size_t>(SIZE) == mY.size());
+                ASSERTV(SIZE, 31 == mY.hash_function().d_divisor);
+
+                swap(mX, mY);
+                ASSERTV(SIZE, static_cast<bsl::size_t>(SIZE) == X.size());
+                ASSERTV(SIZE, 31 == X.hash_function().d_divisor);
+                for (int i = 0; i < SIZE; ++i) {
+                    ASSERTV(SIZE, i, i * i == X.at(i));
+                }
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // INSERT, FIND, ERASE, AND ITERATION
+        //
+        // Concerns:
+        //: 1 'insert' inserts only absent keys, and reports the element having
+        //:   the key.
+        //:
+        //: 2 'find', 'contains', and 'count' locate exactly the inserted keys,
+        //:   and values can be modified through iterators.
+        //:
+        //: 3 Each form of 'erase' removes the specified elements.
+        //:
+        //: 4 Iteration, through both iterator types, visits each element once.
+        //:
+        //: 5 'clear', 'rehash', and 'reserve' forward to the table.
+        //
+        // Plan:
+        //: 1 Perform each operation on maps of integers, and verify the
+        //:   results.  (C-1..5)
+        //
+        // Testing:
+        //   iterator begin();
+        //   iterator end();
+        //   void clear();
+        //   size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   iterator find(const KEY& key);
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void rehash(size_t minimumCapacity);
+        //   void reserve(size_t numElements);
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   bool contains(const KEY& key) const;
+        //   size_t count(const KEY& key) const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_iterator find(const KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INSERT, FIND, ERASE, AND ITERATION" << endl
+                          << "==================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 200; ++i) {
+                bsl::pair<Obj::iterator, bool> result =
+                                        mX.insert(Obj::value_type(i, i + 1));
+                ASSERTV(i, result.second);
+                ASSERTV(i, i     == result.first->first);
+                ASSERTV(i, i + 1 == result.first->second);
+
+                result = mX.insert(Obj::value_type(i, -1));
+                ASSERTV(i, !result.second);
+                ASSERTV(i, i + 1 == result.first->second);
+            }
+            ASSERT(200 == X.size());
+
+            for (int i = 0; i < 200; ++i) {
+                ASSERTV(i, X.contains(i));
+                ASSERTV(i, 1 == X.count(i));
+                ASSERTV(i, i + 1 == X.find(i)->second);
+
+                mX.find(i)->second = 2 * i;
+            }
+            ASSERT(!X.contains(200));
+            ASSERT(0 == X.count(-1));
+            ASSERT(X.end() == X.find(200));
+            ASSERT(mX.end() == mX.find(200));
+
+            int numVisited = 0;
+            for (Obj::const_iterator it = X.cbegin(); it != X.cend(); ++it) {
+                ASSERTV(it->first, 2 * it->first == it->second);
+                ++numVisited;
+            }
+            ASSERT(200 == numVisited);
+
+            for (Obj::iterator it = mX.begin(); it != mX.end(); ++it) {
+                ++it->second;
+            }
+            for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(it->first, 2 * it->first + 1 == it->second);
+            }
+
+            ASSERT(1 == mX.erase(0));
+            ASSERT(0 == mX.erase(0));
+
+            Obj::iterator next = mX.find(1);
+            ++next;
+            ASSERT(next == mX.erase(mX.find(1)));
+
+            next = mX.find(2);
+            ++next;
+            ASSERT(next == mX.erase(Obj::const_iterator(mX.find(2))));
+            ASSERT(197 == X.size());
+
+            mX.erase(X.begin(), X.end());
+            ASSERT(X.empty());
+
+            const Obj::value_type VALUES[] = {
+                Obj::value_type(1, 10),
+                Obj::value_type(2, 20),
+                Obj::value_type(1, 30)
+            };
+            mX.insert(VALUES, VALUES + 3);
+            ASSERT(2  == X.size());
+            ASSERT(10 == X.at(1));
+            ASSERT(20 == X.at(2));
+
+            mX.reserve(1000);
+            ASSERT(1000 <= X.capacity() * X.max_load_factor());
+            ASSERT(10   == X.at(1));
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(0 < X.capacity());
+
+            mX.rehash(0);
+            ASSERT(0 == X.capacity());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'operator[]' AND 'at'
+        //
+        // Concerns:
+        //: 1 'operator[]' inserts an element having a default value if the key
+        //:   is absent, and returns a reference to the value.
+        //:
+        //: 2 'at' returns a reference to the value of a present key, and
+        //:   throws 'bsl::out_of_range' for an absent key.
+        //:
+        //: 3 The keys and values of the elements, including the default value
+        //:   inserted by 'operator[]', use the map's allocator, and the
+        //:   default allocator is not used.
+        //:
+        //: 4 'operator[]' is exception neutral.
+        //
+        // Plan:
+        //: 1 Access keys of a map of strings with 'operator[]' and 'at', and
+        //:   verify the values and their allocators.  (C-1..3)
+        //:
+        //: 2 Insert with 'operator[]' under the
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST' macros.  (C-4)
+        //
+        // Testing:
+        //   VALUE& operator[](const KEY& key);
+        //   VALUE& at(const KEY& key);
+        //   const VALUE& at(const KEY& key) const;
+        //   CONCERN: Elements use the map's allocator.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'operator[]' AND 'at'" << endl
+                          << "=====================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            StringObj mX(&ta);  const StringObj& X = mX;
+
+            const int NUM_KEYS = 50;
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                char buffer[64];
+                sprintf(buffer, "a long key to defeat the short buffer %d", i);
+                const bsl::string KEY(buffer, &ta);
+
+                bsl::string& value = mX[KEY];
+                ASSERTV(i, value.empty());
+                ASSERTV(i, &ta == value.get_allocator().mechanism());
+                ASSERTV(i, &value == &mX[KEY]);
+
+                value = KEY;
+                ASSERTV(i, KEY == X.at(KEY));
+                ASSERTV(i, &value == &mX.at(KEY));
+            }
+            ASSERT(NUM_KEYS == X.size());
+
+            for (StringObj::const_iterator it = X.begin();
+                 it != X.end();
+                 ++it) {
+                ASSERT(&ta == it->first.get_allocator().mechanism());
+                ASSERT(&ta == it->second.get_allocator().mechanism());
+            }
+
+#ifdef BDE_BUILD_TARGET_EXC
+            const bsl::string MISSING("missing", &ta);
+
+            bool caught = false;
+            try {
+                mX.at(MISSING);
+            }
+            catch (const bsl::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                X.at(MISSING);
+            }
+            catch (const bsl::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(NUM_KEYS == X.size());
+#endif
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nException neutrality." << endl;
+        {
+            StringObj mX(&ta);  const StringObj& X = mX;
+
+            for (int i = 0; i < 40; ++i) {
+                char buffer[64];
+                sprintf(buffer, "a long key to defeat the short buffer %d", i);
+                const bsl::string KEY(buffer, &ta);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                    ASSERTV(i, i == static_cast<int>(X.size()));
+                    ASSERTV(i, mX[KEY].empty());
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(i, i + 1 == static_cast<int>(X.size()));
+                ASSERTV(i, X.contains(KEY));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a map having the specified capacity,
+        //:   functors, allocator, and (for the range constructor) elements.
+        //:
+        //: 2 The default allocator is used if no allocator is supplied.
+        //:
+        //: 3 No memory is allocated for a map created without a capacity.
+        //
+        // Plan:
+        //: 1 Create maps with each constructor, and verify the accessors.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   explicit FlatHashMap(bslma::Allocator *basicAllocator = 0);
+        //   explicit FlatHashMap(size_t capacity, bslma::Allocator *ba = 0);
+        //   FlatHashMap(size_t capacity, const HASH& hash, ba = 0);
+        //   FlatHashMap(capacity, const HASH&, const EQUAL&, ba = 0);
+        //   FlatHashMap(INPUT_ITERATOR first, INPUT_ITERATOR last, ba = 0);
+        //   size_t capacity() const;
+        //   bool empty() const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTORS AND BASIC ACCESSORS" << endl
+                          << "================================" << endl;
+
+        typedef bdlc::FlatHashMap<int, int, ModuloHash, AbsEqual> FunctorObj;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        {
+            const Obj X;
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(0 == X.size());
+            ASSERT(X.empty());
+            ASSERT(0 == X.capacity());
+            ASSERT(0.0f == X.load_factor());
+            ASSERT(0.875f == X.max_load_factor());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+        {
+            const Obj X(&ta);
+            ASSERT(&ta == X.allocator());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == ta.numBlocksTotal());
+        }
+        {
+            const Obj X(100, &ta);
+            ASSERT(&ta == X.allocator());
+            ASSERT(0 == X.size());
+            ASSERT(100 <= X.capacity() * X.max_load_factor());
+        }
+        {
+            const FunctorObj X(0, ModuloHash(7), &ta);
+            ASSERT(7 == X.hash_function().d_divisor);
+            ASSERT(0 == X.capacity());
+
+            const FunctorObj Y(20, ModuloHash(9), AbsEqual(), &ta);
+            ASSERT(9 == Y.hash_function().d_divisor);
+            ASSERT(true == Y.key_eq()(-3, 3));
+            ASSERT(20 <= Y.capacity() * Y.max_load_factor());
+
+            FunctorObj mZ(0, ModuloHash(9), AbsEqual(), &ta);
+            mZ[9]  = 1;
+            mZ[-9] = 2;
+            ASSERT(1 == mZ.size());
+            ASSERT(2 == mZ.at(9));
+        }
+        {
+            const Obj::value_type VALUES[] = {
+                Obj::value_type(1, 10),
+                Obj::value_type(2, 20),
+                Obj::value_type(1, 30),
+                Obj::value_type(3, 40)
+            };
+
+            const Obj X(VALUES, VALUES + 4, &ta);
+            ASSERT(&ta == X.allocator());
+            ASSERT(3   == X.size());
+            ASSERT(10  == X.at(1));
+            ASSERT(20  == X.at(2));
+            ASSERT(40  == X.at(3));
+            ASSERT(X.load_factor() ==
+                   3.0f / static_cast<float>(X.capacity()));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, modify, and erase elements of a map.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 1000; ++i) {
+                mX[i] = -i;
+            }
+            ASSERT(1000 == X.size());
+
+            for (int i = 0; i < 1000; ++i) {
+                ASSERTV(i, -i == X.at(i));
+            }
+
+            Obj mY(X, &ta);  const Obj& Y = mY;
+            ASSERT(X == Y);
+
+            for (int i = 0; i < 1000; i += 2) {
+                ASSERTV(i, 1 == mX.erase(i));
+            }
+            ASSERT(500 == X.size());
+            ASSERT(X != Y);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: COMPARISON WITH 'bsl::unordered_map'
+        //
+        // Concerns:
+        //: 1 Insertion, successful and unsuccessful lookup, and erasure are
+        //:   faster with 'bdlc::FlatHashMap' than with 'bsl::unordered_map'.
+        //
+        // Plan:
+        //: 1 For maps of 'int' keys and of 'bsl::string' keys, of sizes from
+        //:   1K to (optionally) 1M elements, time each operation for both
+        //:   containers using the new/delete allocator, and print the time
+        //:   per operation in nanoseconds.  The largest size is the optional
+        //:   second argument, in thousands of elements.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: COMPARISON WITH 'bsl::unordered_map'
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST: COMPARISON WITH 'bsl::unordered_map'"
+             << endl
+             << "======================================================"
+             << endl;
+
+        const int MAX_SIZE = 1000 * (argc > 2 ? atoi(argv[2]) : 1000);
+
+        printf("%-28s %9s %9s %9s %9s %9s\n",
+               "(ns per operation)",
+               "size",
+               "insert",
+               "hit",
+               "miss",
+               "erase");
+
+        for (int size = 1000; size <= MAX_SIZE; size *= 10) {
+            bsl::vector<int> keys(ndAllocator());
+            bsl::vector<int> missingKeys(ndAllocator());
+
+            srand(size);
+            for (int i = 0; i < size; ++i) {
+                // Interleave present and missing keys, and shuffle their
+                // order.
+
+                keys.push_back(2 * i);
+                missingKeys.push_back(2 * i + 1);
+            }
+            for (int i = size - 1; i > 0; --i) {
+                const int j = rand() % (i + 1);
+                bsl::swap(keys[i], keys[j]);
+                bsl::swap(missingKeys[i], missingKeys[j]);
+            }
+
+            benchmark<bdlc::FlatHashMap<int, int> >(
+                                     "int: bdlc::FlatHashMap",
+                                     keys,
+                                     missingKeys);
+            benchmark<bsl::unordered_map<int, int> >(
+                                     "int: bsl::unordered_map",
+                                     keys,
+                                     missingKeys);
+            benchmark<bdlc::FlatHashMap<int, int, bslh::Hash<> > >(
+                                     "int: bdlc::FlatHashMap/bslh",
+                                     keys,
+                                     missingKeys);
+
+            bsl::vector<bsl::string> stringKeys(ndAllocator());
+            bsl::vector<bsl::string> missingStringKeys(ndAllocator());
+            for (int i = 0; i < size; ++i) {
+                stringKeys.push_back(makeKey(keys[i]));
+                missingStringKeys.push_back(makeKey(missingKeys[i]));
+            }
+
+            benchmark<bdlc::FlatHashMap<bsl::string, int> >(
+                                     "string: bdlc::FlatHashMap",
+                                     stringKeys,
+                                     missingStringKeys);
+            benchmark<bsl::unordered_map<bsl::string, int> >(
+                                     "string: bsl::unordered_map",
+                                     stringKeys,
+                                     missingStringKeys);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
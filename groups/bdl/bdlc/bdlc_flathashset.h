@@ -0,0 +1,637 @@
+// bdlc_flathashset.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHSET
+#define INCLUDED_BDLC_FLATHASHSET
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressing unordered set container.
+//
+//@CLASSES:
+//  bdlc::FlatHashSet: open-addressing unordered set container
+//
+//@SEE_ALSO: bdlc_flathashmap, bdlc_flathashtable, bslstl_unorderedset
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::FlatHashSet', implementing an unordered set of unique keys.  The
+// interface of 'bdlc::FlatHashSet' is a subset of that of
+// 'bsl::unordered_set'; its implementation is the "flat" open-addressing hash
+// table described in 'bdlc_flathashtable', which stores the keys in a single
+// contiguous array and probes groups of 16 keys at once.  See
+// 'bdlc_flathashmap' for a discussion of the performance characteristics of
+// the flat hash containers, and of the guarantees of 'bsl::unordered_set' that
+// they do not provide; in particular, any insertion that grows the set
+// invalidates all iterators, pointers, and references to its elements.
+//
+///Memory Allocation
+///-----------------
+// A 'bdlc::FlatHashSet' uses the allocator supplied at construction (or the
+// currently installed default allocator) to supply memory for its arrays, and
+// passes it to the elements it creates if they use 'bslma' allocators.  A
+// set allocates no memory until its first insertion, or a call to 'reserve'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Removing Duplicates
+///- - - - - - - - - - - - - - -
+// Suppose we wish to determine the distinct values in a sequence of integers.
+//
+// First, we define the sequence:
+//..
+//  const int VALUES[]   = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+//  const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+//..
+// Then, we insert the values into a set:
+//..
+//  bdlc::FlatHashSet<int> distinct(VALUES, VALUES + NUM_VALUES);
+//..
+// Finally, we verify the distinct values:
+//..
+//  assert(7 == distinct.size());
+//  assert(true  == distinct.contains(9));
+//  assert(false == distinct.contains(7));
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLC_FLATHASHTABLE
+#include <bdlc_flathashtable.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_CONSTRUCTIONUTIL
+#include <bslma_constructionutil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_FUNCTIONAL
+#include <bsl_functional.h>
+#endif
+
+#ifndef INCLUDED_BSL_UTILITY
+#include <bsl_utility.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                       // ============================
+                       // struct FlatHashSet_EntryUtil
+                       // ============================
+
+template <class KEY>
+struct FlatHashSet_EntryUtil {
+    // This component-private utility 'struct' provides the entry operations
+    // required by 'FlatHashTable' for the entries of a 'FlatHashSet'.
+
+    // CLASS METHODS
+    static void constructFromKey(KEY              *address,
+                                 bslma::Allocator *allocator,
+                                 const KEY&        key);
+        // Construct at the specified 'address' a copy of the specified 'key',
+        // using the specified 'allocator' to supply memory.
+
+    static const KEY& key(const KEY& entry);
+        // Return the specified 'entry'.
+};
+
+                            // =================
+                            // class FlatHashSet
+                            // =================
+
+template <class KEY,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class FlatHashSet {
+    // This class template implements a value-semantic unordered set of unique
+    // keys of type 'KEY', stored in an open-addressing hash table.
+
+    // PRIVATE TYPES
+    typedef FlatHashTable<KEY,
+                          KEY,
+                          FlatHashSet_EntryUtil<KEY>,
+                          HASH,
+                          EQUAL> ImplType;
+
+    // DATA
+    ImplType d_impl;  // underlying hash table
+
+    // FRIENDS
+    template <class K, class H, class E>
+    friend bool operator==(const FlatHashSet<K, H, E>&,
+                           const FlatHashSet<K, H, E>&);
+
+  public:
+    // TYPES
+    typedef KEY                                  key_type;
+    typedef KEY                                  value_type;
+    typedef bsl::size_t                          size_type;
+    typedef HASH                                 hasher;
+    typedef EQUAL                                key_equal;
+    typedef const value_type&                    reference;
+    typedef const value_type&                    const_reference;
+    typedef typename ImplType::const_iterator    iterator;
+    typedef typename ImplType::const_iterator    const_iterator;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashSet, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit FlatHashSet(bslma::Allocator *basicAllocator = 0);
+    explicit FlatHashSet(bsl::size_t       capacity,
+                         bslma::Allocator *basicAllocator = 0);
+    FlatHashSet(bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    FlatHashSet(bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create an empty set.  Optionally specify a 'capacity' indicating
+        // the number of elements the set can hold without growing; if
+        // 'capacity' is not supplied or is 0, no memory is allocated.
+        // Optionally specify a 'hash' functor used to hash keys.  If 'hash'
+        // is not supplied, a default-constructed 'HASH' is used.  Optionally
+        // specify an 'equal' functor used to compare keys.  If 'equal' is not
+        // supplied, a default-constructed 'EQUAL' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    template <class INPUT_ITERATOR>
+    FlatHashSet(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+        // Create a set holding the keys in the range '[first .. last)',
+        // ignoring duplicate keys.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    FlatHashSet(const FlatHashSet&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a set having the same value, hash functor, and equality
+        // functor as the specified 'original'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    //! ~FlatHashSet() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! FlatHashSet& operator=(const FlatHashSet& rhs) = default;
+        // Assign to this set the value, hash functor, and equality functor of
+        // the specified 'rhs', and return a reference providing modifiable
+        // access to this set.
+
+    void clear();
+        // Remove all elements from this set.  Note that the capacity of the
+        // set is unchanged.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove the specified 'key' from this set, if present.  Return the
+        // number of elements removed (0 or 1).
+
+    const_iterator erase(const_iterator position);
+        // Remove the element at the specified 'position' from this set, and
+        // return an iterator to the element following it.  The behavior is
+        // undefined unless 'position' refers to an element of this set.
+
+    const_iterator erase(const_iterator first, const_iterator last);
+        // Remove the elements in the range '[first .. last)' from this set,
+        // and return an iterator to the element following the last one
+        // removed.  The behavior is undefined unless '[first .. last)' is a
+        // valid range of elements of this set.
+
+    bsl::pair<const_iterator, bool> insert(const KEY& key);
+        // Insert a copy of the specified 'key' into this set if it is not
+        // already present.  Return a pair whose 'first' member refers to the
+        // element equal to 'key', and whose 'second' member is 'true' if 'key'
+        // was inserted, and 'false' otherwise.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert copies of the keys in the range '[first .. last)' that are
+        // not already in this set.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this set to the smallest valid capacity that
+        // is at least the specified 'minimumCapacity' and can hold the
+        // elements of this set.  Note that 'rehash(0)' on an empty set
+        // releases its memory.
+
+    void reserve(bsl::size_t numElements);
+        // Increase the capacity of this set, if needed, so that it can hold
+        // the specified 'numElements' without growing.
+
+    void swap(FlatHashSet& other);
+        // Exchange the value, hash functor, and equality functor of this set
+        // with those of the specified 'other'.  The behavior is undefined
+        // unless this set and 'other' use the same allocator.
+
+    // ACCESSORS
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator to the first element of this set, or the
+        // past-the-end iterator if this set is empty.
+
+    bsl::size_t capacity() const;
+        // Return the number of elements for which this set has space.  Note
+        // that the set grows before its size exceeds
+        // 'capacity() * max_load_factor()'.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this set contains the specified 'key', and 'false'
+        // otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements equal to the specified 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this set has no elements, and 'false' otherwise.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator of this set.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator to the element equal to the specified 'key', or
+        // the past-the-end iterator if this set has no such element.
+
+    HASH hash_function() const;
+        // Return (a copy of) the hash functor of this set.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the key-equality functor of this set.
+
+    float load_factor() const;
+        // Return the ratio of the size to the capacity of this set, or 0 if
+        // the capacity is 0.
+
+    float max_load_factor() const;
+        // Return the maximum load factor of this set.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this set.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this set to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL>
+bool operator==(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                const FlatHashSet<KEY, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' sets have the same value,
+    // and 'false' otherwise.  Two sets have the same value if they have the
+    // same number of elements, and each element of 'lhs' is contained in
+    // 'rhs'.
+
+template <class KEY, class HASH, class EQUAL>
+bool operator!=(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                const FlatHashSet<KEY, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' sets do not have the same
+    // value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL>
+void swap(FlatHashSet<KEY, HASH, EQUAL>& a, FlatHashSet<KEY, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' sets.  The behavior is
+    // undefined unless 'a' and 'b' use the same allocator.
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                       // ----------------------------
+                       // struct FlatHashSet_EntryUtil
+                       // ----------------------------
+
+// CLASS METHODS
+template <class KEY>
+inline
+void FlatHashSet_EntryUtil<KEY>::constructFromKey(KEY              *address,
+                                                  bslma::Allocator *allocator,
+                                                  const KEY&        key)
+{
+    bslma::ConstructionUtil::construct(address, allocator, key);
+}
+
+template <class KEY>
+inline
+const KEY& FlatHashSet_EntryUtil<KEY>::key(const KEY& entry)
+{
+    return entry;
+}
+
+                            // -----------------
+                            // class FlatHashSet
+                            // -----------------
+
+// CREATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           const HASH&       hash,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           const HASH&       hash,
+                                           const EQUAL&      equal,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(INPUT_ITERATOR    first,
+                                           INPUT_ITERATOR    last,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    d_impl.insert(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(
+                                          const FlatHashSet&  original,
+                                          bslma::Allocator   *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::erase(const_iterator position)
+{
+    return d_impl.erase(position);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::erase(const_iterator first,
+                                     const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator, bool>
+FlatHashSet<KEY, HASH, EQUAL>::insert(const KEY& key)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.insert(key);
+
+    return bsl::pair<const_iterator, bool>(result.first, result.second);
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::insert(INPUT_ITERATOR first,
+                                           INPUT_ITERATOR last)
+{
+    d_impl.insert(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::rehash(bsl::size_t minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::reserve(bsl::size_t numElements)
+{
+    d_impl.reserve(numElements);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::swap(FlatHashSet& other)
+{
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool FlatHashSet<KEY, HASH, EQUAL>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::count(const KEY& key) const
+{
+    return d_impl.count(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool FlatHashSet<KEY, HASH, EQUAL>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::cend() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+HASH FlatHashSet<KEY, HASH, EQUAL>::hash_function() const
+{
+    return d_impl.hash_function();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+EQUAL FlatHashSet<KEY, HASH, EQUAL>::key_eq() const
+{
+    return d_impl.key_eq();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+float FlatHashSet<KEY, HASH, EQUAL>::load_factor() const
+{
+    return d_impl.load_factor();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+float FlatHashSet<KEY, HASH, EQUAL>::max_load_factor() const
+{
+    return d_impl.max_load_factor();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::size() const
+{
+    return d_impl.size();
+}
+
+                                  // Aspects
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bslma::Allocator *FlatHashSet<KEY, HASH, EQUAL>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+bool bdlc::operator==(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                      const FlatHashSet<KEY, HASH, EQUAL>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                      const FlatHashSet<KEY, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL>
+inline
+void bdlc::swap(FlatHashSet<KEY, HASH, EQUAL>& a,
+                FlatHashSet<KEY, HASH, EQUAL>& b)
+{
+    a.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
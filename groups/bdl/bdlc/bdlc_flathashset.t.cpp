@@ -0,0 +1,614 @@
+// bdlc_flathashset.t.cpp                                             -*-C++-*-
+#include <bdlc_flathashset.h>
+
+#include <bslim_testutil.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsl_cstdio.h>      // 'sprintf'
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlc::FlatHashSet' is a thin adapter of 'bdlc::FlatHashTable', which is
+// tested thoroughly in its own component.  We must verify that each method
+// forwards to the appropriate method of the table, and that elements are
+// constructed with the set's allocator.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit FlatHashSet(bslma::Allocator *basicAllocator = 0);
+// [ 2] explicit FlatHashSet(size_t capacity, bslma::Allocator *ba = 0);
+// [ 2] FlatHashSet(size_t capacity, const HASH& hash, ba = 0);
+// [ 2] FlatHashSet(capacity, const HASH&, const EQUAL&, ba = 0);
+// [ 2] FlatHashSet(INPUT_ITERATOR first, INPUT_ITERATOR last, ba = 0);
+// [ 4] FlatHashSet(const FlatHashSet& original, ba = 0);
+//
+// MANIPULATORS
+// [ 4] FlatHashSet& operator=(const FlatHashSet& rhs);
+// [ 3] void clear();
+// [ 3] size_t erase(const KEY& key);
+// [ 3] const_iterator erase(const_iterator position);
+// [ 3] const_iterator erase(const_iterator first, const_iterator last);
+// [ 3] pair<const_iterator, bool> insert(const KEY& key);
+// [ 3] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 3] void rehash(size_t minimumCapacity);
+// [ 3] void reserve(size_t numElements);
+// [ 4] void swap(FlatHashSet& other);
+//
+// ACCESSORS
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator cbegin() const;
+// [ 2] size_t capacity() const;
+// [ 3] bool contains(const KEY& key) const;
+// [ 3] size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 3] const_iterator end() const;
+// [ 3] const_iterator cend() const;
+// [ 3] const_iterator find(const KEY& key) const;
+// [ 2] HASH hash_function() const;
+// [ 2] EQUAL key_eq() const;
+// [ 2] float load_factor() const;
+// [ 2] float max_load_factor() const;
+// [ 2] size_t size() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const FlatHashSet& lhs, const FlatHashSet& rhs);
+// [ 4] bool operator!=(const FlatHashSet& lhs, const FlatHashSet& rhs);
+//
+// FREE FUNCTIONS
+// [ 4] void swap(FlatHashSet& a, FlatHashSet& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: Elements use the set's allocator.
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashSet<int>         Obj;
+typedef bdlc::FlatHashSet<bsl::string> StringObj;
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct ModuloHash {
+    // This hash functor returns its argument modulo a divisor supplied at
+    // construction, and is used to verify that functors are retained.
+
+    int d_divisor;
+
+    explicit ModuloHash(int divisor = 1000003)
+        // Create a hash functor having the optionally specified 'divisor'.
+    : d_divisor(divisor)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+        // Return the specified 'key' modulo the divisor of this functor.
+    {
+        return static_cast<bsl::size_t>(key % d_divisor);
+    }
+};
+
+struct AbsEqual {
+    // This equality functor compares the absolute values of its arguments,
+    // and is used to verify that functors are retained.
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' and 'rhs' have the same
+        // absolute value, and 'false' otherwise.
+    {
+        return (lhs < 0 ? -lhs : lhs) == (rhs < 0 ? -rhs : rhs);
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test            = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose         = argc > 2;
+    const bool veryVerbose     = argc > 3;
+    const bool veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Removing Duplicates
+///- - - - - - - - - - - - - - -
+// Suppose we wish to determine the distinct values in a sequence of integers.
+//
+// First, we define the sequence:
+//..
+    const int VALUES[]   = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+    const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+//..
+// Then, we insert the values into a set:
+//..
+    bdlc::FlatHashSet<int> distinct(VALUES, VALUES + NUM_VALUES);
+//..
+// Finally, we verify the distinct values:
+//..
+    ASSERT(7 == distinct.size());
+    ASSERT(true  == distinct.contains(9));
+    ASSERT(false == distinct.contains(7));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 A copy has the value and functors of the original, and uses the
+        //:   supplied allocator.
+        //:
+        //: 2 Assignment gives the target the value and functors of the
+        //:   source, and retains the target's allocator.
+        //:
+        //: 3 The member and free 'swap' exchange the values and functors of
+        //:   two sets.
+        //:
+        //: 4 Sets compare equal if they have the same elements.
+        //
+        // Plan:
+        //: 1 Copy, assign, swap, and compare sets of various values using
+        //:   hash functors having state.  (C-1..4)
+        //
+        // Testing:
+        //   FlatHashSet(const FlatHashSet& original, ba = 0);
+        //   FlatHashSet& operator=(const FlatHashSet& rhs);
+        //   void swap(FlatHashSet& other);
+        //   bool operator==(const FlatHashSet& lhs, const FlatHashSet& rhs);
+        //   bool operator!=(const FlatHashSet& lhs, const FlatHashSet& rhs);
+        //   void swap(FlatHashSet& a, FlatHashSet& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, ASSIGNMENT, SWAP, AND EQUALITY" << endl
+                          << "====================================" << endl;
+
+        typedef bdlc::FlatHashSet<int, ModuloHash> ModuloObj;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVerbose);
+
+        const int SIZES[]   = { 0, 1, 20, 500 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            ModuloObj mX(0, ModuloHash(31), &ta);  const ModuloObj& X = mX;
+            for (int i = 0; i < SIZE; ++i) {
+                mX.insert(i * 3);
+            }
+
+            {
+                const ModuloObj Y(X, &sa);
+                ASSERTV(SIZE, X == Y);
+                ASSERTV(SIZE, !(X != Y));
+                ASSERTV(SIZE, 31  == Y.hash_function().d_divisor);
+                ASSERTV(SIZE, &sa == Y.allocator());
+            }
+
+            {
+                ModuloObj mY(&sa);
+                mY.insert(-1);
+                ASSERTV(SIZE, X != mY);
+
+                mY = X;
+                ASSERTV(SIZE, X == mY);
+                ASSERTV(SIZE, 31  == mY.hash_function().d_divisor);
+                ASSERTV(SIZE, &sa == mY.allocator());
+
+                if (SIZE) {
+                    mY.erase(0);
+                    mY.insert(1);
+                    ASSERTV(SIZE, X != mY);
+                }
+            }
+            ASSERTV(SIZE, 0 == sa.numBlocksInUse());
+
+            {
+                ModuloObj mY(&ta);
+                mY.insert(-1);
+
+                mX.swap(mY);
+                ASSERTV(SIZE, 1 == X.size());
+                ASSERTV(SIZE, X.contains(-1));
+                ASSERTV(SIZE, static_cast<bsl::size_t>(SIZE) == mY.size());
+                ASSERTV(SIZE, 31 == mY.hash_function().d_divisor);
+
+                swap(mX, mY);
+                ASSERTV(SIZE, static_cast<bsl::size_t>(SIZE) == X.size());
+                ASSERTV(SIZE, 31 == X.hash_function().d_divisor);
+                for (int i = 0; i < SIZE; ++i) {
+                    ASSERTV(SIZE, i, X.contains(i * 3));
+                }
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INSERT, FIND, ERASE, AND ITERATION
+        //
+        // Concerns:
+        //: 1 'insert' inserts only absent keys, and reports the element equal
+        //:   to the key.
+        //:
+        //: 2 'find', 'contains', and 'count' locate exactly the inserted keys.
+        //:
+        //: 3 Each form of 'erase' removes the specified elements.
+        //:
+        //: 4 Iteration visits each element once.
+        //:
+        //: 5 'clear', 'rehash', and 'reserve' forward to the table.
+        //:
+        //: 6 Elements use the set's allocator, and the default allocator is
+        //:   not used.
+        //
+        // Plan:
+        //: 1 Perform each operation on sets of strings, comparing the results
+        //:   to a 'bsl::set', and verify the allocators of the elements.
+        //:   (C-1..6)
+        //
+        // Testing:
+        //   void clear();
+        //   size_t erase(const KEY& key);
+        //   const_iterator erase(const_iterator position);
+        //   const_iterator erase(const_iterator first, const_iterator last);
+        //   pair<const_iterator, bool> insert(const KEY& key);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void rehash(size_t minimumCapacity);
+        //   void reserve(size_t numElements);
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   bool contains(const KEY& key) const;
+        //   size_t count(const KEY& key) const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_iterator find(const KEY& key) const;
+        //   CONCERN: Elements use the set's allocator.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INSERT, FIND, ERASE, AND ITERATION" << endl
+                          << "==================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            StringObj mX(&ta);  const StringObj& X = mX;
+
+            bsl::set<bsl::string> oracle(&ta);
+
+            for (int i = 0; i < 200; ++i) {
+                char buffer[64];
+                sprintf(buffer, "a long key to defeat the short buffer %d", i);
+                const bsl::string KEY(buffer, &ta);
+
+                bsl::pair<StringObj::const_iterator, bool> result =
+                                                                mX.insert(KEY);
+                ASSERTV(i, result.second);
+                ASSERTV(i, KEY == *result.first);
+                ASSERTV(i, &ta == result.first->get_allocator().mechanism());
+
+                result = mX.insert(KEY);
+                ASSERTV(i, !result.second);
+                ASSERTV(i, KEY == *result.first);
+
+                oracle.insert(KEY);
+            }
+            ASSERT(200 == X.size());
+
+            int numVisited = 0;
+            for (StringObj::const_iterator it = X.cbegin();
+                 it != X.cend();
+                 ++it) {
+                ASSERTV(*it, 1 == oracle.count(*it));
+                ++numVisited;
+            }
+            ASSERT(200 == numVisited);
+
+            for (bsl::set<bsl::string>::const_iterator it = oracle.begin();
+                 it != oracle.end();
+                 ++it) {
+                ASSERTV(*it, X.contains(*it));
+                ASSERTV(*it, 1 == X.count(*it));
+                ASSERTV(*it, *it == *X.find(*it));
+            }
+
+            const bsl::string MISSING("missing", &ta);
+            ASSERT(!X.contains(MISSING));
+            ASSERT(0 == X.count(MISSING));
+            ASSERT(X.end() == X.find(MISSING));
+
+            ASSERT(1 == mX.erase(*oracle.begin()));
+            ASSERT(0 == mX.erase(*oracle.begin()));
+
+            StringObj::const_iterator next = X.begin();
+            ++next;
+            ASSERT(next == mX.erase(X.begin()));
+            ASSERT(198 == X.size());
+
+            mX.erase(X.begin(), X.end());
+            ASSERT(X.empty());
+
+            mX.insert(oracle.begin(), oracle.end());
+            ASSERT(200 == X.size());
+
+            mX.reserve(1000);
+            ASSERT(1000 <= X.capacity() * X.max_load_factor());
+            ASSERT(200 == X.size());
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(0 < X.capacity());
+
+            mX.rehash(0);
+            ASSERT(0 == X.capacity());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a set having the specified capacity,
+        //:   functors, allocator, and (for the range constructor) elements.
+        //:
+        //: 2 The default allocator is used if no allocator is supplied.
+        //:
+        //: 3 No memory is allocated for a set created without a capacity.
+        //
+        // Plan:
+        //: 1 Create sets with each constructor, and verify the accessors.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   explicit FlatHashSet(bslma::Allocator *basicAllocator = 0);
+        //   explicit FlatHashSet(size_t capacity, bslma::Allocator *ba = 0);
+        //   FlatHashSet(size_t capacity, const HASH& hash, ba = 0);
+        //   FlatHashSet(capacity, const HASH&, const EQUAL&, ba = 0);
+        //   FlatHashSet(INPUT_ITERATOR first, INPUT_ITERATOR last, ba = 0);
+        //   size_t capacity() const;
+        //   bool empty() const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTORS AND BASIC ACCESSORS" << endl
+                          << "================================" << endl;
+
+        typedef bdlc::FlatHashSet<int, ModuloHash, AbsEqual> FunctorObj;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        {
+            const Obj X;
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(0 == X.size());
+            ASSERT(X.empty());
+            ASSERT(0 == X.capacity());
+            ASSERT(0.0f == X.load_factor());
+            ASSERT(0.875f == X.max_load_factor());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+        {
+            const Obj X(&ta);
+            ASSERT(&ta == X.allocator());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == ta.numBlocksTotal());
+        }
+        {
+            const Obj X(100, &ta);
+            ASSERT(&ta == X.allocator());
+            ASSERT(0 == X.size());
+            ASSERT(100 <= X.capacity() * X.max_load_factor());
+        }
+        {
+            const FunctorObj X(0, ModuloHash(7), &ta);
+            ASSERT(7 == X.hash_function().d_divisor);
+            ASSERT(0 == X.capacity());
+
+            const FunctorObj Y(20, ModuloHash(9), AbsEqual(), &ta);
+            ASSERT(9 == Y.hash_function().d_divisor);
+            ASSERT(true == Y.key_eq()(-3, 3));
+            ASSERT(20 <= Y.capacity() * Y.max_load_factor());
+
+            FunctorObj mZ(0, ModuloHash(9), AbsEqual(), &ta);
+            ASSERT(true  == mZ.insert(9).second);
+            ASSERT(false == mZ.insert(-9).second);
+            ASSERT(1 == mZ.size());
+        }
+        {
+            const int VALUES[] = { 1, 2, 1, 3 };
+
+            const Obj X(VALUES, VALUES + 4, &ta);
+            ASSERT(&ta == X.allocator());
+            ASSERT(3   == X.size());
+            ASSERT(X.contains(1));
+            ASSERT(X.contains(2));
+            ASSERT(X.contains(3));
+            ASSERT(X.load_factor() ==
+                   3.0f / static_cast<float>(X.capacity()));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase elements of a set, using both the default
+        //:   hash functor and 'bslh::Hash<>'.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            Obj                                 mX(&ta);
+            bdlc::FlatHashSet<int, bslh::Hash<> > mY(&ta);
+
+            for (int i = 0; i < 1000; ++i) {
+                ASSERTV(i, mX.insert(i * 5).second);
+                ASSERTV(i, mY.insert(i * 5).second);
+            }
+            ASSERT(1000 == mX.size());
+            ASSERT(1000 == mY.size());
+
+            for (int i = 0; i < 5000; ++i) {
+                ASSERTV(i, (0 == i % 5) == mX.contains(i));
+                ASSERTV(i, (0 == i % 5) == mY.contains(i));
+            }
+
+            Obj mZ(mX, &ta);
+            ASSERT(mX == mZ);
+
+            for (int i = 0; i < 5000; i += 10) {
+                ASSERTV(i, 1 == mX.erase(i));
+            }
+            ASSERT(500 == mX.size());
+            ASSERT(mX != mZ);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1579 @@
+// bdlc_flathashtable.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHTABLE
+#define INCLUDED_BDLC_FLATHASHTABLE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressing hash table with group probing.
+//
+//@CLASSES:
+//  bdlc::FlatHashTable: open-addressing hash table of entries
+//  bdlc::FlatHashTable_GroupControl: inquiries on a group of control bytes
+//  bdlc::FlatHashTable_IteratorImp: iterator implementation for the table
+//
+//@SEE_ALSO: bdlc_flathashmap, bdlc_flathashset
+//
+//@DESCRIPTION: This component provides a value-semantic class template,
+// 'bdlc::FlatHashTable', implementing an open-addressing hash table of unique
+// keys, on which the 'bdlc::FlatHashMap' and 'bdlc::FlatHashSet' containers
+// are built.  Clients should use those containers rather than this component
+// directly.
+//
+// Unlike 'bsl::unordered_map', which allocates each element in a separate node
+// and chains the nodes of a bucket, a 'bdlc::FlatHashTable' stores its entries
+// in a single contiguous array.  A parallel array holds one control byte per
+// entry, recording whether the entry is empty, erased, or in use, and, for an
+// entry in use, 7 bits of the hash of its key.  The arrays are divided into
+// groups of 16 entries.  A lookup hashes the key once, selects a group from
+// the hash, and compares the 7 hash bits to all 16 control bytes of the group
+// at once (using SSE2 instructions where available), so that the keys of
+// (almost) only the matching entries are compared.  If the key is not found
+// in a group having an empty entry, the lookup stops; otherwise the next group
+// in a triangular probe sequence is examined.
+//
+// The capacity of the table (the number of entries) is always 0 or a power of
+// two no less than 16, and the table is grown (doubling its capacity) when an
+// insertion would increase the load factor beyond 7/8.  An erased entry whose
+// group has an empty entry is marked empty; otherwise it is marked erased, so
+// that lookups of keys beyond it in the probe sequence continue to succeed.
+//
+// The table is parameterized by the 'KEY' type, the 'ENTRY' type stored in the
+// table (e.g., 'KEY' for a set, or a 'bsl::pair' of a 'KEY' and a value for a
+// map), an 'ENTRY_UTIL' type providing the key of an entry and the means to
+// construct an entry from a key, and the 'HASH' and 'EQUAL' functors.  The
+// 'ENTRY_UTIL' type must provide the following static member functions:
+//..
+//  static const KEY& key(const ENTRY& entry);
+//      // Return the key of the specified 'entry'.
+//
+//  static void constructFromKey(ENTRY            *address,
+//                               bslma::Allocator *allocator,
+//                               const KEY&        key);
+//      // Construct at the specified 'address' an entry having the specified
+//      // 'key' (and a default value, if any), using the specified
+//      // 'allocator' to supply memory.
+//..
+// The value returned by 'HASH' is mixed by a multiplicative (Fibonacci) hash
+// before use, so that hash functors with poor distribution in their low
+// order bits (e.g., 'bsl::hash' of an integral type, which is the identity
+// function) perform well.  Hash functors of the 'bslh' framework (e.g.,
+// 'bslh::Hash<>') may be supplied to hash types that provide 'hashAppend'.
+//
+///Iterator, Pointer, and Reference Invalidation
+///---------------------------------------------
+// Any insertion that increases the capacity of the table invalidates all
+// iterators, pointers, and references to entries.  Erasing an entry
+// invalidates only iterators, pointers, and references to that entry.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Implementing a Set of Integers
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we wish to implement a simple set of 'int' values on a
+// 'bdlc::FlatHashTable'.
+//
+// First, we define the entry utility for an entry that is its own key:
+//..
+//  struct IntEntryUtil {
+//      static const int& key(const int& entry)
+//      {
+//          return entry;
+//      }
+//
+//      static void constructFromKey(int              *address,
+//                                   bslma::Allocator *,
+//                                   const int&        key)
+//      {
+//          *address = key;
+//      }
+//  };
+//..
+// Then, we create a table of 'int' entries:
+//..
+//  typedef bdlc::FlatHashTable<int,
+//                              int,
+//                              IntEntryUtil,
+//                              bsl::hash<int>,
+//                              bsl::equal_to<int> > IntTable;
+//
+//  IntTable table(0, bsl::hash<int>(), bsl::equal_to<int>());
+//  assert(0 == table.capacity());
+//..
+// Next, we insert a few values; the second insertion of a value has no
+// effect:
+//..
+//  assert(true  == table.insert(3).second);
+//  assert(true  == table.insert(7).second);
+//  assert(false == table.insert(3).second);
+//
+//  assert(2  == table.size());
+//  assert(16 == table.capacity());
+//..
+// Finally, we find and erase values:
+//..
+//  assert(table.end() != table.find(7));
+//  assert(table.end() == table.find(5));
+//
+//  assert(1 == table.erase(7));
+//  assert(0 == table.erase(7));
+//  assert(1 == table.size());
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLB_BITUTIL
+#include <bdlb_bitutil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARDESTRUCTIONPRIMITIVES
+#include <bslalg_scalardestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_CONSTRUCTIONUTIL
+#include <bslma_constructionutil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_EXCEPTIONUTIL
+#include <bsls_exceptionutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_FORWARDITERATOR
+#include <bslstl_forwarditerator.h>
+#endif
+
+#ifndef INCLUDED_BSL_ALGORITHM
+#include <bsl_algorithm.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDINT
+#include <bsl_cstdint.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTRING
+#include <bsl_cstring.h>
+#endif
+
+#ifndef INCLUDED_BSL_UTILITY
+#include <bsl_utility.h>
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                        \
+ || (defined(BSLS_PLATFORM_CPU_X86) && defined(__SSE2__))
+#define BDLC_FLATHASHTABLE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                     // ================================
+                     // class FlatHashTable_GroupControl
+                     // ================================
+
+class FlatHashTable_GroupControl {
+    // This component-private class provides inquiries on a group of 16
+    // control bytes of a 'FlatHashTable'.  A control byte is 'k_EMPTY' for an
+    // empty entry, 'k_ERASED' for an erased entry, and has its high-order bit
+    // clear for an entry in use.  Each inquiry returns a bit mask in which bit
+    // 'i' corresponds to control byte 'i' of the group.
+
+  public:
+    // TYPES
+    typedef bsl::uint32_t BitMask;
+
+    enum {
+        k_EMPTY  = 0x80,  // control byte of an empty entry
+        k_ERASED = 0xFE,  // control byte of an erased entry
+        k_SIZE   = 16     // number of control bytes in a group
+    };
+
+  private:
+    // DATA
+#ifdef BDLC_FLATHASHTABLE_SSE2
+    __m128i             d_value;   // the control bytes of the group
+#else
+    const bsl::uint8_t *d_data_p;  // the control bytes of the group
+#endif
+
+  public:
+    // CREATORS
+    explicit FlatHashTable_GroupControl(const bsl::uint8_t *data);
+        // Create a group control object for the 'k_SIZE' control bytes at the
+        // specified 'data' address.  The behavior is undefined unless 'data'
+        // is aligned on a 16-byte boundary.
+
+    // ACCESSORS
+    BitMask available() const;
+        // Return a bit mask of the empty and erased entries of this group.
+
+    BitMask inUse() const;
+        // Return a bit mask of the entries in use of this group.
+
+    BitMask match(bsl::uint8_t value) const;
+        // Return a bit mask of the entries of this group having the specified
+        // 'value' as their control byte.
+
+    bool neverFull() const;
+        // Return 'true' if this group has an empty entry, and 'false'
+        // otherwise.  Note that a group having an empty entry has never been
+        // full, so that no probe sequence continues past it.
+};
+
+                      // ===============================
+                      // class FlatHashTable_IteratorImp
+                      // ===============================
+
+template <class ENTRY>
+class FlatHashTable_IteratorImp {
+    // This component-private class template provides the implementation of
+    // the iterators of a 'FlatHashTable', for use with
+    // 'bslstl::ForwardIterator'.
+
+    // DATA
+    ENTRY              *d_entries_p;   // entries of the table
+    const bsl::uint8_t *d_controls_p;  // control bytes of the table
+    bsl::size_t         d_index;       // index of the current entry
+    bsl::size_t         d_capacity;    // capacity of the table
+
+  public:
+    // CREATORS
+    FlatHashTable_IteratorImp();
+        // Create an iterator implementation not referring to any table.
+
+    FlatHashTable_IteratorImp(ENTRY              *entries,
+                              const bsl::uint8_t *controls,
+                              bsl::size_t         index,
+                              bsl::size_t         capacity);
+        // Create an iterator implementation referring to the entry at the
+        // specified 'index' of the table having the specified 'entries',
+        // 'controls', and 'capacity'.  The behavior is undefined unless the
+        // entry at 'index' is in use, or 'index == capacity'.
+
+    // MANIPULATORS
+    void operator++();
+        // Advance to the next entry in use, or to the past-the-end position.
+
+    // ACCESSORS
+    ENTRY& operator*() const;
+        // Return a reference to the current entry.
+
+    bsl::size_t index() const;
+        // Return the index of the current entry in the table.
+
+    template <class OTHER_ENTRY>
+    friend bool operator==(const FlatHashTable_IteratorImp<OTHER_ENTRY>& lhs,
+                           const FlatHashTable_IteratorImp<OTHER_ENTRY>& rhs);
+};
+
+// FREE OPERATORS
+template <class ENTRY>
+bool operator==(const FlatHashTable_IteratorImp<ENTRY>& lhs,
+                const FlatHashTable_IteratorImp<ENTRY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' refer to the same entry
+    // of the same table, and 'false' otherwise.
+
+                            // ===================
+                            // class FlatHashTable
+                            // ===================
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+class FlatHashTable {
+    // This class template implements an open-addressing hash table of 'ENTRY'
+    // objects having unique keys of type 'KEY'.  See the component-level
+    // documentation for the requirements on the template parameters.
+
+    // PRIVATE TYPES
+    typedef FlatHashTable_GroupControl GroupControl;
+
+    enum {
+        k_MIN_CAPACITY = GroupControl::k_SIZE  // smallest nonzero capacity
+    };
+
+  public:
+    // TYPES
+    typedef KEY                                           key_type;
+    typedef ENTRY                                         value_type;
+    typedef HASH                                          hasher;
+    typedef EQUAL                                         key_equal;
+    typedef bsl::size_t                                   size_type;
+    typedef bslstl::ForwardIterator<ENTRY,
+                                    FlatHashTable_IteratorImp<ENTRY> >
+                                                          iterator;
+    typedef bslstl::ForwardIterator<const ENTRY,
+                                    FlatHashTable_IteratorImp<ENTRY> >
+                                                          const_iterator;
+
+  private:
+    // DATA
+    ENTRY            *d_entries_p;    // array of 'd_capacity' entries
+    bsl::uint8_t     *d_controls_p;   // array of 'd_capacity' control bytes
+    bsl::size_t       d_size;         // number of entries in use
+    bsl::size_t       d_numErased;    // number of entries marked erased
+    bsl::size_t       d_capacity;     // 0, or a power of 2 no less than 16
+    int               d_groupShift;   // shift of the mixed hash selecting the
+                                      // first group of the probe sequence
+    HASH              d_hasher;       // hash functor
+    EQUAL             d_equal;        // key-equality functor
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+    // PRIVATE CLASS METHODS
+    static bsl::size_t capacityForNumEntries(bsl::size_t numEntries);
+        // Return the smallest valid capacity of a table that can hold the
+        // specified 'numEntries' without exceeding the maximum load factor.
+
+    static void moveEntries(ENTRY             *target,
+                            ENTRY             *source,
+                            bslma::Allocator  *allocator,
+                            bsl::true_type);
+    static void moveEntries(ENTRY             *target,
+                            ENTRY             *source,
+                            bslma::Allocator  *allocator,
+                            bsl::false_type);
+        // Move the specified 'source' entry to the specified 'target' address,
+        // using the specified 'allocator' to supply memory.  The first
+        // overload, for bitwise-moveable entries, leaves 'source' destroyed;
+        // the second copies 'source', and leaves it intact.
+
+    // PRIVATE MANIPULATORS
+    void allocateArrays(ENTRY        **entries,
+                        bsl::uint8_t **controls,
+                        bsl::size_t    capacity);
+        // Load into the specified 'entries' and 'controls' newly allocated
+        // arrays of the specified 'capacity' entries and control bytes, the
+        // control bytes marking every entry empty.  The behavior is undefined
+        // unless 'capacity' is a valid capacity.
+
+    void destroyEntries();
+        // Destroy the entries in use of this table, without changing their
+        // control bytes.
+
+    void eraseAt(bsl::size_t index);
+        // Destroy the entry at the specified 'index', and mark it empty or
+        // erased.  The behavior is undefined unless the entry at 'index' is in
+        // use.
+
+    bsl::size_t insertPosition(bsl::uint64_t hashValue) const;
+        // Return the index of the first available entry in the probe sequence
+        // of the specified (mixed) 'hashValue'.  The behavior is undefined
+        // unless this table has an available entry.
+
+    bsl::size_t prepareInsertion(bsl::uint64_t hashValue);
+        // Return the index of the entry at which a key having the specified
+        // (mixed) 'hashValue' is to be inserted, first growing this table, or
+        // rehashing it to purge its erased entries, if the insertion would
+        // exceed the maximum load factor.  The entry at the returned index is
+        // no longer counted as erased.  The behavior is undefined unless this
+        // table has no entry having the key.
+
+    void rehashImp(bsl::size_t newCapacity);
+        // Move the entries of this table to newly allocated arrays of the
+        // specified 'newCapacity'.  If an exception is thrown, this table is
+        // unchanged.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t findIndex(const KEY& key, bsl::uint64_t hashValue) const;
+        // Return the index of the entry having the specified 'key' with the
+        // specified (mixed) 'hashValue', or the capacity of this table if
+        // there is no such entry.
+
+    bsl::size_t firstIndex() const;
+        // Return the index of the first entry in use, or the capacity of this
+        // table if it is empty.
+
+    static bsl::uint8_t hashControl(bsl::uint64_t hashValue);
+        // Return the control byte of an entry whose key has the specified
+        // (mixed) 'hashValue'.
+
+    bsl::uint64_t mixedHash(const KEY& key) const;
+        // Return the hash of the specified 'key', mixed so that all of its
+        // bits depend on all of the bits of the value returned by the hash
+        // functor.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashTable, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FlatHashTable(bsl::size_t       capacity,
+                  const HASH&       hash,
+                  const EQUAL&      equal,
+                  bslma::Allocator *basicAllocator = 0);
+        // Create an empty table able to hold at least the specified 'capacity'
+        // entries without growing, using the specified 'hash' and 'equal'
+        // functors.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  If 'capacity' is 0, no memory is allocated.
+
+    FlatHashTable(const FlatHashTable&  original,
+                  bslma::Allocator     *basicAllocator = 0);
+        // Create a table having the same value, capacity, and functors as the
+        // specified 'original'.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    ~FlatHashTable();
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatHashTable& operator=(const FlatHashTable& rhs);
+        // Assign to this table the value and functors of the specified 'rhs',
+        // and return a reference to this table.
+
+    iterator begin();
+        // Return an iterator to the first entry of this table, or the
+        // past-the-end iterator if this table is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this table.
+
+    void clear();
+        // Remove all entries from this table.  Note that the capacity is
+        // unchanged.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove the entry having the specified 'key' from this table, if
+        // any.  Return the number of entries removed (0 or 1).
+
+    iterator erase(const_iterator position);
+        // Remove the entry at the specified 'position' from this table, and
+        // return an iterator to the entry following it.  The behavior is
+        // undefined unless 'position' refers to an entry of this table.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove the entries in the range '[first .. last)' from this table,
+        // and return 'last'.  The behavior is undefined unless 'first' and
+        // 'last' refer to entries of this table (or its past-the-end position)
+        // and 'first' does not follow 'last'.
+
+    iterator find(const KEY& key);
+        // Return an iterator to the entry having the specified 'key', or the
+        // past-the-end iterator if there is no such entry.
+
+    bsl::pair<iterator, bool> insert(const ENTRY& entry);
+        // Insert a copy of the specified 'entry' into this table if it has no
+        // entry with the same key.  Return a pair whose first member refers to
+        // the entry with that key, and whose second member is 'true' if the
+        // entry was inserted, and 'false' otherwise.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert copies of the entries in the range '[first .. last)' whose
+        // keys are not already in this table.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this table to the smallest valid capacity
+        // that is no less than the specified 'minimumCapacity' and that can
+        // hold the current entries without exceeding the maximum load factor.
+
+    void reserve(bsl::size_t numEntries);
+        // Increase the capacity of this table, if needed, so that it can hold
+        // the specified 'numEntries' without growing.
+
+    void swap(FlatHashTable& other);
+        // Exchange the value, capacity, and functors of this table with those
+        // of the specified 'other'.  The behavior is undefined unless this
+        // table and 'other' use the same allocator.
+
+    bsl::pair<iterator, bool> tryEmplace(const KEY& key);
+        // Insert into this table, if it has no entry with the specified 'key',
+        // an entry constructed from 'key' by 'ENTRY_UTIL::constructFromKey'.
+        // Return a pair whose first member refers to the entry with 'key', and
+        // whose second member is 'true' if the entry was inserted, and 'false'
+        // otherwise.
+
+    // ACCESSORS
+    const_iterator begin() const;
+        // Return an iterator to the first entry of this table, or the
+        // past-the-end iterator if this table is empty.
+
+    bsl::size_t capacity() const;
+        // Return the number of entries this table can store.  Note that the
+        // table grows before the number of entries exceeds
+        // 'capacity() * max_load_factor()'.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this table has an entry having the specified 'key',
+        // and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of entries having the specified 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this table has no entries, and 'false' otherwise.
+
+    const_iterator end() const;
+        // Return the past-the-end iterator of this table.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator to the entry having the specified 'key', or the
+        // past-the-end iterator if there is no such entry.
+
+    const HASH& hash_function() const;
+        // Return the hash functor of this table.
+
+    const EQUAL& key_eq() const;
+        // Return the key-equality functor of this table.
+
+    float load_factor() const;
+        // Return the ratio of the number of entries to the capacity of this
+        // table, or 0 if the capacity is 0.
+
+    float max_load_factor() const;
+        // Return the maximum load factor of this table (7/8).
+
+    bsl::size_t size() const;
+        // Return the number of entries of this table.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this table to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator==(
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' tables have the same
+    // value, and 'false' otherwise.  Two tables have the same value if they
+    // have the same number of entries, and for each entry of 'lhs' there is
+    // an entry of 'rhs' having the same key that compares equal to it.  Note
+    // that the capacities and functors of the tables are not compared.
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator!=(
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' tables do not have the
+    // same value, and 'false' otherwise.
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                     // --------------------------------
+                     // class FlatHashTable_GroupControl
+                     // --------------------------------
+
+// CREATORS
+inline
+FlatHashTable_GroupControl::FlatHashTable_GroupControl(
+                                                     const bsl::uint8_t *data)
+#ifdef BDLC_FLATHASHTABLE_SSE2
+: d_value(_mm_load_si128(reinterpret_cast<const __m128i *>(data)))
+#else
+: d_data_p(data)
+#endif
+{
+    BSLS_ASSERT_SAFE(0 == reinterpret_cast<bsls::Types::UintPtr>(data) % 16);
+}
+
+// ACCESSORS
+inline
+FlatHashTable_GroupControl::BitMask
+FlatHashTable_GroupControl::available() const
+{
+#ifdef BDLC_FLATHASHTABLE_SSE2
+    return static_cast<BitMask>(_mm_movemask_epi8(d_value));
+#else
+    BitMask result = 0;
+    for (int i = 0; i < k_SIZE; ++i) {
+        result |= static_cast<BitMask>(d_data_p[i] >> 7) << i;
+    }
+    return result;
+#endif
+}
+
+inline
+FlatHashTable_GroupControl::BitMask
+FlatHashTable_GroupControl::inUse() const
+{
+    return ~available() & 0xFFFFu;
+}
+
+inline
+FlatHashTable_GroupControl::BitMask
+FlatHashTable_GroupControl::match(bsl::uint8_t value) const
+{
+#ifdef BDLC_FLATHASHTABLE_SSE2
+    return static_cast<BitMask>(_mm_movemask_epi8(
+                   _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(value)),
+                                  d_value)));
+#else
+    BitMask result = 0;
+    for (int i = 0; i < k_SIZE; ++i) {
+        result |= static_cast<BitMask>(value == d_data_p[i]) << i;
+    }
+    return result;
+#endif
+}
+
+inline
+bool FlatHashTable_GroupControl::neverFull() const
+{
+    return 0 != match(static_cast<bsl::uint8_t>(k_EMPTY));
+}
+
+                      // -------------------------------
+                      // class FlatHashTable_IteratorImp
+                      // -------------------------------
+
+// CREATORS
+template <class ENTRY>
+inline
+FlatHashTable_IteratorImp<ENTRY>::FlatHashTable_IteratorImp()
+: d_entries_p(0)
+, d_controls_p(0)
+, d_index(0)
+, d_capacity(0)
+{
+}
+
+template <class ENTRY>
+inline
+FlatHashTable_IteratorImp<ENTRY>::FlatHashTable_IteratorImp(
+                                          ENTRY              *entries,
+                                          const bsl::uint8_t *controls,
+                                          bsl::size_t         index,
+                                          bsl::size_t         capacity)
+: d_entries_p(entries)
+, d_controls_p(controls)
+, d_index(index)
+, d_capacity(capacity)
+{
+}
+
+// MANIPULATORS
+template <class ENTRY>
+inline
+void FlatHashTable_IteratorImp<ENTRY>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_index < d_capacity);
+
+    ++d_index;
+    while (d_index < d_capacity && (d_controls_p[d_index] & 0x80)) {
+        ++d_index;
+    }
+}
+
+// ACCESSORS
+template <class ENTRY>
+inline
+ENTRY& FlatHashTable_IteratorImp<ENTRY>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_index < d_capacity);
+
+    return d_entries_p[d_index];
+}
+
+template <class ENTRY>
+inline
+bsl::size_t FlatHashTable_IteratorImp<ENTRY>::index() const
+{
+    return d_index;
+}
+
+// FREE OPERATORS
+template <class ENTRY>
+inline
+bool operator==(const FlatHashTable_IteratorImp<ENTRY>& lhs,
+                const FlatHashTable_IteratorImp<ENTRY>& rhs)
+{
+    return lhs.d_entries_p == rhs.d_entries_p && lhs.d_index == rhs.d_index;
+}
+
+                            // -------------------
+                            // class FlatHashTable
+                            // -------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::capacityForNumEntries(
+                                                        bsl::size_t numEntries)
+{
+    if (0 == numEntries) {
+        return 0;                                                     // RETURN
+    }
+
+    bsl::size_t capacity = k_MIN_CAPACITY;
+    while (capacity - capacity / 8 < numEntries) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::moveEntries(
+                                                  ENTRY             *target,
+                                                  ENTRY             *source,
+                                                  bslma::Allocator  *,
+                                                  bsl::true_type)
+{
+    bsl::memcpy(static_cast<void *>(target), source, sizeof(ENTRY));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::moveEntries(
+                                                  ENTRY             *target,
+                                                  ENTRY             *source,
+                                                  bslma::Allocator  *allocator,
+                                                  bsl::false_type)
+{
+    bslma::ConstructionUtil::construct(target, allocator, *source);
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::allocateArrays(
+                                                 ENTRY        **entries,
+                                                 bsl::uint8_t **controls,
+                                                 bsl::size_t    capacity)
+{
+    BSLS_ASSERT(capacity >= k_MIN_CAPACITY);
+    BSLS_ASSERT(0 == (capacity & (capacity - 1)));
+
+    // Each group of control bytes must be aligned on a 16-byte boundary,
+    // which the allocator does not guarantee.  The control bytes are
+    // therefore placed at the first 16-byte boundary past the start of an
+    // over-sized block, and the offset from the start of the block is
+    // recorded in the byte preceding them, for use on deallocation.
+
+    *controls = static_cast<bsl::uint8_t *>(
+                                      d_allocator_p->allocate(capacity + 16));
+    bsl::uint8_t *aligned = *controls
+                   + (16 - reinterpret_cast<bsls::Types::UintPtr>(*controls)
+                                                                    % 16) % 16;
+    if (aligned == *controls) {
+        aligned += 16;
+    }
+    aligned[-1] = static_cast<bsl::uint8_t>(aligned - *controls);
+
+    BSLS_TRY {
+        *entries = static_cast<ENTRY *>(
+                            d_allocator_p->allocate(capacity * sizeof(ENTRY)));
+    }
+    BSLS_CATCH(...) {
+        d_allocator_p->deallocate(*controls);
+        BSLS_RETHROW;
+    }
+
+    *controls = aligned;
+    bsl::memset(*controls, GroupControl::k_EMPTY, capacity);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::destroyEntries()
+{
+    for (bsl::size_t i = 0; i < d_capacity; ++i) {
+        if (!(d_controls_p[i] & 0x80)) {
+            bslalg::ScalarDestructionPrimitives::destroy(d_entries_p + i);
+        }
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::eraseAt(
+                                                             bsl::size_t index)
+{
+    bslalg::ScalarDestructionPrimitives::destroy(d_entries_p + index);
+    --d_size;
+
+    // If the group of the entry has an empty entry, the group has never been
+    // full since the table was last rehashed, so no probe sequence continues
+    // past it, and the entry can be marked empty.
+
+    const bsl::size_t offset = index - index % GroupControl::k_SIZE;
+
+    if (GroupControl(d_controls_p + offset).neverFull()) {
+        d_controls_p[index] = GroupControl::k_EMPTY;
+    }
+    else {
+        d_controls_p[index] = GroupControl::k_ERASED;
+        ++d_numErased;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insertPosition(
+                                                bsl::uint64_t hashValue) const
+{
+    BSLS_ASSERT_SAFE(d_size < d_capacity);
+
+    const bsl::size_t numGroups = d_capacity / GroupControl::k_SIZE;
+    bsl::size_t       group     = static_cast<bsl::size_t>(
+                                  hashValue >> d_groupShift) & (numGroups - 1);
+
+    for (bsl::size_t i = 1; ; ++i) {
+        const bsl::size_t offset = group * GroupControl::k_SIZE;
+
+        const GroupControl::BitMask available =
+                         GroupControl(d_controls_p + offset).available();
+        if (available) {
+            return offset + bdlb::BitUtil::numTrailingUnsetBits(
+                                                                 available);
+                                                                      // RETURN
+        }
+        group = (group + i) & (numGroups - 1);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::prepareInsertion(
+                                                       bsl::uint64_t hashValue)
+{
+    // Erased entries lengthen probe sequences as much as entries in use do,
+    // so both count towards the load factor.  If erased entries account for
+    // the excess, the table is rehashed at the same capacity to purge them.
+
+    const bsl::size_t maxSize = d_capacity - d_capacity / 8;
+
+    if (d_size + d_numErased + 1 > maxSize) {
+        if (0 == d_capacity) {
+            rehashImp(k_MIN_CAPACITY);
+        }
+        else if (d_size + 1 > maxSize / 2) {
+            rehashImp(2 * d_capacity);
+        }
+        else {
+            rehashImp(d_capacity);
+        }
+    }
+
+    const bsl::size_t index = insertPosition(hashValue);
+    if (GroupControl::k_ERASED == d_controls_p[index]) {
+        --d_numErased;
+    }
+    return index;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehashImp(
+                                                       bsl::size_t newCapacity)
+{
+    ENTRY        *entries;
+    bsl::uint8_t *controls;
+
+    allocateArrays(&entries, &controls, newCapacity);
+
+    const int groupShift = 57 - bdlb::BitUtil::log2(
+             static_cast<bsl::uint64_t>(newCapacity / GroupControl::k_SIZE));
+
+    const bsl::size_t numGroups = newCapacity / GroupControl::k_SIZE;
+
+    typedef typename bslmf::IsBitwiseMoveable<ENTRY>::type IsBitwise;
+
+    bsl::size_t i = 0;
+    BSLS_TRY {
+        for (; i < d_capacity; ++i) {
+            if (d_controls_p[i] & 0x80) {
+                continue;
+            }
+
+            const bsl::uint64_t hashValue = mixedHash(
+                                           ENTRY_UTIL::key(d_entries_p[i]));
+
+            bsl::size_t group = static_cast<bsl::size_t>(
+                                    hashValue >> groupShift) & (numGroups - 1);
+            bsl::size_t index;
+            for (bsl::size_t j = 1; ; ++j) {
+                const bsl::size_t offset = group * GroupControl::k_SIZE;
+
+                const GroupControl::BitMask available =
+                                 GroupControl(controls + offset).available();
+                if (available) {
+                    index = offset
+                          + bdlb::BitUtil::numTrailingUnsetBits(available);
+                    break;
+                }
+                group = (group + j) & (numGroups - 1);
+            }
+
+            moveEntries(entries + index,
+                        d_entries_p + i,
+                        d_allocator_p,
+                        IsBitwise());
+            controls[index] = hashControl(hashValue);
+        }
+    }
+    BSLS_CATCH(...) {
+        // Only entries that are not bitwise moveable, and therefore copied,
+        // can throw.  Destroy the copies, leaving this table unchanged.
+
+        for (bsl::size_t j = 0; j < newCapacity; ++j) {
+            if (!(controls[j] & 0x80)) {
+                bslalg::ScalarDestructionPrimitives::destroy(entries + j);
+            }
+        }
+        d_allocator_p->deallocate(controls - controls[-1]);
+        d_allocator_p->deallocate(entries);
+        BSLS_RETHROW;
+    }
+
+    if (d_capacity) {
+        if (!IsBitwise::value) {
+            destroyEntries();
+        }
+        d_allocator_p->deallocate(d_controls_p - d_controls_p[-1]);
+        d_allocator_p->deallocate(d_entries_p);
+    }
+
+    d_entries_p  = entries;
+    d_controls_p = controls;
+    d_numErased  = 0;
+    d_capacity   = newCapacity;
+    d_groupShift = groupShift;
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findIndex(
+                                             const KEY&    key,
+                                             bsl::uint64_t hashValue) const
+{
+    if (0 == d_size) {
+        return d_capacity;                                            // RETURN
+    }
+
+    const bsl::uint8_t control   = hashControl(hashValue);
+    const bsl::size_t  numGroups = d_capacity / GroupControl::k_SIZE;
+    bsl::size_t        group     = static_cast<bsl::size_t>(
+                                  hashValue >> d_groupShift) & (numGroups - 1);
+
+    for (bsl::size_t i = 1; i <= numGroups; ++i) {
+        const bsl::size_t  offset = group * GroupControl::k_SIZE;
+        const GroupControl groupControl(d_controls_p + offset);
+
+        GroupControl::BitMask candidates = groupControl.match(control);
+        while (candidates) {
+            const bsl::size_t index =
+                 offset + bdlb::BitUtil::numTrailingUnsetBits(candidates);
+
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                          d_equal(ENTRY_UTIL::key(d_entries_p[index]), key))) {
+                return index;                                         // RETURN
+            }
+            candidates &= candidates - 1;
+        }
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(groupControl.neverFull())) {
+            return d_capacity;                                        // RETURN
+        }
+        group = (group + i) & (numGroups - 1);
+    }
+
+    return d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::firstIndex()
+                                                                         const
+{
+    if (0 == d_size) {
+        return d_capacity;                                            // RETURN
+    }
+
+    for (bsl::size_t offset = 0;
+         offset < d_capacity;
+         offset += GroupControl::k_SIZE) {
+        const GroupControl::BitMask inUse =
+                                   GroupControl(d_controls_p + offset).inUse();
+        if (inUse) {
+            return offset + bdlb::BitUtil::numTrailingUnsetBits(inUse);
+                                                                      // RETURN
+        }
+    }
+    return d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::uint8_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hashControl(
+                                                       bsl::uint64_t hashValue)
+{
+    return static_cast<bsl::uint8_t>(hashValue >> 57);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::uint64_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::mixedHash(
+                                                         const KEY& key) const
+{
+    // Multiply by 2^64 divided by the golden ratio.  The high-order bits of
+    // the product depend on all of the bits of the hash: the top 7 bits are
+    // used as the control byte, and the following bits select the group.
+
+    return static_cast<bsl::uint64_t>(d_hasher(key)) * 0x9E3779B97F4A7C15ULL;
+}
+
+// CREATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                            bsl::size_t       capacity,
+                                            const HASH&       hash,
+                                            const EQUAL&      equal,
+                                            bslma::Allocator *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_groupShift(0)
+, d_hasher(hash)
+, d_equal(equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (capacity) {
+        rehashImp(capacityForNumEntries(capacity));
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                        const FlatHashTable&  original,
+                                        bslma::Allocator     *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_groupShift(original.d_groupShift)
+, d_hasher(original.d_hasher)
+, d_equal(original.d_equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (0 == original.d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    ENTRY        *entries;
+    bsl::uint8_t *controls;
+
+    allocateArrays(&entries, &controls, original.d_capacity);
+
+    // The entries are copied to the same positions, so that no hashing is
+    // required.
+
+    bsl::size_t i = 0;
+    BSLS_TRY {
+        for (; i < original.d_capacity; ++i) {
+            if (!(original.d_controls_p[i] & 0x80)) {
+                bslma::ConstructionUtil::construct(entries + i,
+                                                   d_allocator_p,
+                                                   original.d_entries_p[i]);
+                controls[i] = original.d_controls_p[i];
+            }
+        }
+    }
+    BSLS_CATCH(...) {
+        for (bsl::size_t j = 0; j < i; ++j) {
+            if (!(controls[j] & 0x80)) {
+                bslalg::ScalarDestructionPrimitives::destroy(entries + j);
+            }
+        }
+        d_allocator_p->deallocate(controls - controls[-1]);
+        d_allocator_p->deallocate(entries);
+        BSLS_RETHROW;
+    }
+
+    // Erased control bytes are copied as well, so that the probe sequences
+    // of the copied entries are preserved.
+
+    for (i = 0; i < original.d_capacity; ++i) {
+        if (GroupControl::k_ERASED == original.d_controls_p[i]) {
+            controls[i] = GroupControl::k_ERASED;
+        }
+    }
+
+    d_entries_p  = entries;
+    d_controls_p = controls;
+    d_size       = original.d_size;
+    d_numErased  = original.d_numErased;
+    d_capacity   = original.d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::~FlatHashTable()
+{
+    if (d_capacity) {
+        destroyEntries();
+        d_allocator_p->deallocate(d_controls_p - d_controls_p[-1]);
+        d_allocator_p->deallocate(d_entries_p);
+    }
+}
+
+// MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+                                                      const FlatHashTable& rhs)
+{
+    if (this != &rhs) {
+        FlatHashTable copy(rhs, d_allocator_p);
+        swap(copy);
+    }
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin()
+{
+    return iterator(FlatHashTable_IteratorImp<ENTRY>(d_entries_p,
+                                                     d_controls_p,
+                                                     firstIndex(),
+                                                     d_capacity));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end()
+{
+    return iterator(FlatHashTable_IteratorImp<ENTRY>(d_entries_p,
+                                                     d_controls_p,
+                                                     d_capacity,
+                                                     d_capacity));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::clear()
+{
+    if (d_capacity) {
+        destroyEntries();
+        bsl::memset(d_controls_p, GroupControl::k_EMPTY, d_capacity);
+        d_size      = 0;
+        d_numErased = 0;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                                const KEY& key)
+{
+    const bsl::size_t index = findIndex(key, mixedHash(key));
+    if (index == d_capacity) {
+        return 0;                                                     // RETURN
+    }
+
+    eraseAt(index);
+    return 1;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                       const_iterator position)
+{
+    const bsl::size_t index = position.imp().index();
+
+    BSLS_ASSERT(index < d_capacity);
+    BSLS_ASSERT(!(d_controls_p[index] & 0x80));
+
+    eraseAt(index);
+
+    FlatHashTable_IteratorImp<ENTRY> next(d_entries_p,
+                                          d_controls_p,
+                                          index,
+                                          d_capacity);
+    ++next;
+    return iterator(next);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(const_iterator first,
+                                                          const_iterator last)
+{
+    while (first != last) {
+        first = erase(first);
+    }
+    return iterator(FlatHashTable_IteratorImp<ENTRY>(d_entries_p,
+                                                     d_controls_p,
+                                                     last.imp().index(),
+                                                     d_capacity));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key)
+{
+    return iterator(FlatHashTable_IteratorImp<ENTRY>(
+                                              d_entries_p,
+                                              d_controls_p,
+                                              findIndex(key, mixedHash(key)),
+                                              d_capacity));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+        typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+        bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(const ENTRY& entry)
+{
+    const KEY&          key       = ENTRY_UTIL::key(entry);
+    const bsl::uint64_t hashValue = mixedHash(key);
+
+    bsl::size_t index = findIndex(key, hashValue);
+    if (index != d_capacity) {
+        return bsl::pair<iterator, bool>(
+                      iterator(FlatHashTable_IteratorImp<ENTRY>(d_entries_p,
+                                                                d_controls_p,
+                                                                index,
+                                                                d_capacity)),
+                      false);                                         // RETURN
+    }
+
+    index = prepareInsertion(hashValue);
+    bslma::ConstructionUtil::construct(d_entries_p + index,
+                                       d_allocator_p,
+                                       entry);
+    d_controls_p[index] = hashControl(hashValue);
+    ++d_size;
+
+    return bsl::pair<iterator, bool>(
+                      iterator(FlatHashTable_IteratorImp<ENTRY>(d_entries_p,
+                                                                d_controls_p,
+                                                                index,
+                                                                d_capacity)),
+                      true);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(
+                                                          INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        insert(*first);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehash(
+                                                   bsl::size_t minimumCapacity)
+{
+    bsl::size_t newCapacity = capacityForNumEntries(d_size);
+
+    if (minimumCapacity > newCapacity) {
+        newCapacity = k_MIN_CAPACITY;
+        while (newCapacity < minimumCapacity) {
+            newCapacity *= 2;
+        }
+    }
+
+    if (newCapacity == d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    if (0 == newCapacity) {
+        // The table is empty: release the arrays.
+
+        if (d_capacity) {
+            d_allocator_p->deallocate(d_controls_p - d_controls_p[-1]);
+            d_allocator_p->deallocate(d_entries_p);
+        }
+        d_entries_p  = 0;
+        d_controls_p = 0;
+        d_numErased  = 0;
+        d_capacity   = 0;
+        d_groupShift = 0;
+        return;                                                       // RETURN
+    }
+
+    rehashImp(newCapacity);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reserve(
+                                                        bsl::size_t numEntries)
+{
+    const bsl::size_t newCapacity = capacityForNumEntries(numEntries);
+
+    if (newCapacity > d_capacity) {
+        rehashImp(newCapacity);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::swap(
+                                                          FlatHashTable& other)
+{
+    BSLS_ASSERT(d_allocator_p == other.d_allocator_p);
+
+    using bsl::swap;
+
+    swap(d_entries_p,  other.d_entries_p);
+    swap(d_controls_p, other.d_controls_p);
+    swap(d_size,       other.d_size);
+    swap(d_numErased,  other.d_numErased);
+    swap(d_capacity,   other.d_capacity);
+    swap(d_groupShift, other.d_groupShift);
+    swap(d_hasher,     other.d_hasher);
+    swap(d_equal,      other.d_equal);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+        typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+        bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::tryEmplace(const KEY& key)
+{
+    const bsl::uint64_t hashValue = mixedHash(key);
+
+    bsl::size_t index = findIndex(key, hashValue);
+    if (index != d_capacity) {
+        return bsl::pair<iterator, bool>(
+                      iterator(FlatHashTable_IteratorImp<ENTRY>(d_entries_p,
+                                                                d_controls_p,
+                                                                index,
+                                                                d_capacity)),
+                      false);                                         // RETURN
+    }
+
+    index = prepareInsertion(hashValue);
+    ENTRY_UTIL::constructFromKey(d_entries_p + index, d_allocator_p, key);
+    d_controls_p[index] = hashControl(hashValue);
+    ++d_size;
+
+    return bsl::pair<iterator, bool>(
+                      iterator(FlatHashTable_IteratorImp<ENTRY>(d_entries_p,
+                                                                d_controls_p,
+                                                                index,
+                                                                d_capacity)),
+                      true);
+}
+
+// ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin() const
+{
+    return const_iterator(FlatHashTable_IteratorImp<ENTRY>(d_entries_p,
+                                                           d_controls_p,
+                                                           firstIndex(),
+                                                           d_capacity));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::capacity()
+                                                                         const
+{
+    return d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::contains(
+                                                          const KEY& key) const
+{
+    return d_capacity != findIndex(key, mixedHash(key));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::count(
+                                                          const KEY& key) const
+{
+    return contains(key) ? 1 : 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::empty() const
+{
+    return 0 == d_size;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end() const
+{
+    return const_iterator(FlatHashTable_IteratorImp<ENTRY>(d_entries_p,
+                                                           d_controls_p,
+                                                           d_capacity,
+                                                           d_capacity));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key) const
+{
+    return const_iterator(FlatHashTable_IteratorImp<ENTRY>(
+                                              d_entries_p,
+                                              d_controls_p,
+                                              findIndex(key, mixedHash(key)),
+                                              d_capacity));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+const HASH&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hash_function() const
+{
+    return d_hasher;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+const EQUAL& FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::key_eq() const
+{
+    return d_equal;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+float FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::load_factor() const
+{
+    return d_capacity ? static_cast<float>(d_size)
+                                           / static_cast<float>(d_capacity)
+                      : 0.0f;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+float
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::max_load_factor() const
+{
+    return 0.875f;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::size() const
+{
+    return d_size;
+}
+
+                                  // Aspects
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bslma::Allocator *
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool bdlc::operator==(
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs)
+{
+    typedef typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                                                 const_iterator ConstIterator;
+
+    if (lhs.size() != rhs.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (ConstIterator it = lhs.begin(); it != lhs.end(); ++it) {
+        ConstIterator match = rhs.find(ENTRY_UTIL::key(*it));
+        if (match == rhs.end() || !(*match == *it)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1409 @@
+// bdlc_flathashtable.t.cpp                                           -*-C++-*-
+#include <bdlc_flathashtable.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>      // 'sprintf', 'printf' (needed by exception
+                             // macros)
+#include <bsl_cstdlib.h>     // 'atoi', 'rand'
+#include <bsl_cstring.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlc::FlatHashTable' is an open-addressing hash table whose entries are
+// located by probing groups of control bytes.  We first verify the group
+// control inquiries and the iterator implementation in isolation.  We then
+// verify the table's manipulators and accessors against a 'bsl::set' oracle,
+// with particular attention to the interplay of erased entries and probe
+// sequences (which we exercise with a degenerate hash functor, so that all
+// keys share a probe sequence), to growth and rehashing, and to the handling
+// of memory, including exception neutrality, with entries that allocate.
+// ----------------------------------------------------------------------------
+// FlatHashTable_GroupControl
+// [ 2] FlatHashTable_GroupControl(const uint8_t *data);
+// [ 2] BitMask available() const;
+// [ 2] BitMask inUse() const;
+// [ 2] BitMask match(uint8_t value) const;
+// [ 2] bool neverFull() const;
+//
+// FlatHashTable_IteratorImp
+// [ 3] FlatHashTable_IteratorImp();
+// [ 3] FlatHashTable_IteratorImp(entries, controls, index, capacity);
+// [ 3] void operator++();
+// [ 3] ENTRY& operator*() const;
+// [ 3] size_t index() const;
+// [ 3] bool operator==(const IteratorImp& lhs, const IteratorImp& rhs);
+//
+// FlatHashTable
+// [ 4] FlatHashTable(capacity, hash, equal, basicAllocator = 0);
+// [ 6] FlatHashTable(const FlatHashTable& original, basicAllocator = 0);
+// [ 4] ~FlatHashTable();
+// [ 6] FlatHashTable& operator=(const FlatHashTable& rhs);
+// [ 4] iterator begin();
+// [ 4] iterator end();
+// [ 7] void clear();
+// [ 5] size_t erase(const KEY& key);
+// [ 5] iterator erase(const_iterator position);
+// [ 5] iterator erase(const_iterator first, const_iterator last);
+// [ 4] iterator find(const KEY& key);
+// [ 4] pair<iterator, bool> insert(const ENTRY& entry);
+// [ 7] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 7] void rehash(size_t minimumCapacity);
+// [ 7] void reserve(size_t numEntries);
+// [ 6] void swap(FlatHashTable& other);
+// [ 4] pair<iterator, bool> tryEmplace(const KEY& key);
+// [ 4] const_iterator begin() const;
+// [ 4] size_t capacity() const;
+// [ 4] bool contains(const KEY& key) const;
+// [ 4] size_t count(const KEY& key) const;
+// [ 4] bool empty() const;
+// [ 4] const_iterator end() const;
+// [ 4] const_iterator find(const KEY& key) const;
+// [ 4] const HASH& hash_function() const;
+// [ 4] const EQUAL& key_eq() const;
+// [ 4] float load_factor() const;
+// [ 4] float max_load_factor() const;
+// [ 4] size_t size() const;
+// [ 4] bslma::Allocator *allocator() const;
+// [ 6] bool operator==(const FlatHashTable&, const FlatHashTable&);
+// [ 6] bool operator!=(const FlatHashTable&, const FlatHashTable&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCERN: Erased entries do not break probe sequences.
+// [ 5] CONCERN: Repeated insertion and erasure does not grow the table.
+// [ 8] CONCERN: Entries are passed the table's allocator.
+// [ 8] CONCERN: Methods are exception neutral.
+// [ 9] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct IntEntryUtil {
+    // This utility 'struct' provides the entry operations for a table of
+    // 'int' entries that are their own keys.
+
+    static const int& key(const int& entry)
+        // Return the specified 'entry'.
+    {
+        return entry;
+    }
+
+    static void constructFromKey(int              *address,
+                                 bslma::Allocator *,
+                                 const int&        key)
+        // Construct at the specified 'address' a copy of the specified 'key'.
+    {
+        *address = key;
+    }
+};
+
+struct StringEntryUtil {
+    // This utility 'struct' provides the entry operations for a table of
+    // 'bsl::string' entries that are their own keys.
+
+    static const bsl::string& key(const bsl::string& entry)
+        // Return the specified 'entry'.
+    {
+        return entry;
+    }
+
+    static void constructFromKey(bsl::string       *address,
+                                 bslma::Allocator  *allocator,
+                                 const bsl::string& key)
+        // Construct at the specified 'address' a copy of the specified 'key'
+        // using the specified 'allocator' to supply memory.
+    {
+        bslma::ConstructionUtil::construct(address, allocator, key);
+    }
+};
+
+struct ConstantHash {
+    // This degenerate hash functor hashes every key to the same value, so
+    // that all keys share the same probe sequence.
+
+    bsl::size_t operator()(int) const
+        // Return 0.
+    {
+        return 0;
+    }
+};
+
+struct ModuloHash {
+    // This hash functor returns its argument modulo a divisor supplied at
+    // construction, and is used to verify that functors are retained.
+
+    int d_divisor;
+
+    explicit ModuloHash(int divisor = 1000003)
+        // Create a hash functor having the optionally specified 'divisor'.
+    : d_divisor(divisor)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+        // Return the specified 'key' modulo the divisor of this functor.
+    {
+        return static_cast<bsl::size_t>(key % d_divisor);
+    }
+};
+
+typedef bdlc::FlatHashTable_GroupControl                   GroupControl;
+typedef bdlc::FlatHashTable_IteratorImp<int>               IteratorImp;
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            IntEntryUtil,
+                            bsl::hash<int>,
+                            bsl::equal_to<int> >           Obj;
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            IntEntryUtil,
+                            ConstantHash,
+                            bsl::equal_to<int> >           CollidingObj;
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            IntEntryUtil,
+                            ModuloHash,
+                            bsl::equal_to<int> >           ModuloObj;
+
+typedef bdlc::FlatHashTable<bsl::string,
+                            bsl::string,
+                            StringEntryUtil,
+                            bsl::hash<bsl::string>,
+                            bsl::equal_to<bsl::string> >   StringObj;
+
+template <class TABLE>
+bool isEqualToOracle(const TABLE& table, const bsl::set<int>& oracle)
+    // Return 'true' if the specified 'table' holds exactly the keys of the
+    // specified 'oracle', and 'false' otherwise.
+{
+    if (table.size() != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+
+    bsl::size_t numIterated = 0;
+    for (typename TABLE::const_iterator it = table.begin();
+         it != table.end();
+         ++it) {
+        if (0 == oracle.count(*it)) {
+            return false;                                             // RETURN
+        }
+        ++numIterated;
+    }
+    if (numIterated != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (bsl::set<int>::const_iterator it = oracle.begin();
+         it != oracle.end();
+         ++it) {
+        if (!table.contains(*it) || *table.find(*it) != *it) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class TABLE>
+void randomOperations(TABLE *table, int numOperations, int keyRange)
+    // Apply the specified 'numOperations' random insertions, lookups, and
+    // erasures of keys in the range '[0 .. keyRange)' to the specified
+    // 'table', verifying each result against an oracle.
+{
+    bsl::set<int> oracle;
+
+    for (int i = 0; i < numOperations; ++i) {
+        const int key = rand() % keyRange;
+
+        switch (rand() % 3) {
+          case 0: {
+            const bool inserted = table->insert(key).second;
+            LOOP2_ASSERT(i, key, inserted == oracle.insert(key).second);
+          } break;
+          case 1: {
+            LOOP2_ASSERT(i, key,
+                         table->contains(key) == (0 != oracle.count(key)));
+          } break;
+          default: {
+            LOOP2_ASSERT(i, key, table->erase(key) == oracle.erase(key));
+          } break;
+        }
+    }
+    ASSERT(isEqualToOracle(*table, oracle));
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Implementing a Set of Integers
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we wish to implement a simple set of 'int' values on a
+// 'bdlc::FlatHashTable'.
+//
+// First, we define the entry utility for an entry that is its own key:
+//..
+    struct UsageIntEntryUtil {
+        static const int& key(const int& entry)
+        {
+            return entry;
+        }
+
+        static void constructFromKey(int              *address,
+                                     bslma::Allocator *,
+                                     const int&        key)
+        {
+            *address = key;
+        }
+    };
+//..
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test            = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose         = argc > 2;
+    const bool veryVerbose     = argc > 3;
+    const bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create a table of 'int' entries:
+//..
+    typedef bdlc::FlatHashTable<int,
+                                int,
+                                UsageIntEntryUtil,
+                                bsl::hash<int>,
+                                bsl::equal_to<int> > IntTable;
+
+    IntTable table(0, bsl::hash<int>(), bsl::equal_to<int>());
+    ASSERT(0 == table.capacity());
+//..
+// Next, we insert a few values; the second insertion of a value has no
+// effect:
+//..
+    ASSERT(true  == table.insert(3).second);
+    ASSERT(true  == table.insert(7).second);
+    ASSERT(false == table.insert(3).second);
+
+    ASSERT(2  == table.size());
+    ASSERT(16 == table.capacity());
+//..
+// Finally, we find and erase values:
+//..
+    ASSERT(table.end() != table.find(7));
+    ASSERT(table.end() == table.find(5));
+
+    ASSERT(1 == table.erase(7));
+    ASSERT(0 == table.erase(7));
+    ASSERT(1 == table.size());
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // ALLOCATION AND EXCEPTION NEUTRALITY
+        //
+        // Concerns:
+        //: 1 Entries are constructed using the table's allocator.
+        //:
+        //: 2 If an allocation fails during an insertion (whether allocating
+        //:   the new entry or growing the table) or a copy, the exception
+        //:   propagates, the table is unchanged, and no memory is leaked.
+        //:
+        //: 3 No memory is allocated by the default allocator.
+        //
+        // Plan:
+        //: 1 Insert strings too long for the short-string buffer into a table
+        //:   of 'bsl::string' entries, and verify that the strings use the
+        //:   table's allocator.  (C-1)
+        //:
+        //: 2 Insert strings, copy-construct, and rehash, under the
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST' macros, and verify the
+        //:   value of the table and the memory in use after each attempt.
+        //:   (C-2)
+        //:
+        //: 3 Verify that the default allocator was not used.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: Entries are passed the table's allocator.
+        //   CONCERN: Methods are exception neutral.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ALLOCATION AND EXCEPTION NEUTRALITY" << endl
+                          << "===================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        const int NUM_STRINGS = 40;
+
+        bsl::vector<bsl::string> strings(&ta);
+        for (int i = 0; i < NUM_STRINGS; ++i) {
+            char buffer[64];
+            sprintf(buffer, "a string too long for the short buffer %d", i);
+            strings.push_back(bsl::string(buffer, &ta));
+        }
+
+        if (verbose) cout << "\nEntries use the table's allocator." << endl;
+        {
+            StringObj mX(0,
+                         bsl::hash<bsl::string>(),
+                         bsl::equal_to<bsl::string>(),
+                         &ta);
+            const StringObj& X = mX;
+
+            for (int i = 0; i < NUM_STRINGS; ++i) {
+                mX.insert(strings[i]);
+                mX.tryEmplace(strings[i]);
+            }
+            ASSERT(NUM_STRINGS == X.size());
+
+            for (StringObj::const_iterator it = X.begin();
+                 it != X.end();
+                 ++it) {
+                ASSERT(&ta == it->get_allocator().mechanism());
+            }
+        }
+
+        if (verbose) cout << "\nInsertion is exception neutral." << endl;
+        {
+            StringObj mX(0,
+                         bsl::hash<bsl::string>(),
+                         bsl::equal_to<bsl::string>(),
+                         &ta);
+            const StringObj& X = mX;
+
+            for (int i = 0; i < NUM_STRINGS; ++i) {
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                    ASSERTV(i, X.size(), i == static_cast<int>(X.size()));
+                    ASSERTV(i, false == X.contains(strings[i]));
+
+                    if (i % 2) {
+                        mX.insert(strings[i]);
+                    }
+                    else {
+                        mX.tryEmplace(strings[i]);
+                    }
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(i, i + 1 == static_cast<int>(X.size()));
+                for (int j = 0; j <= i; ++j) {
+                    ASSERTV(i, j, X.contains(strings[j]));
+                }
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse() - 1 - NUM_STRINGS);
+
+        if (verbose) cout << "\nCopying is exception neutral." << endl;
+        {
+            StringObj mX(0,
+                         bsl::hash<bsl::string>(),
+                         bsl::equal_to<bsl::string>(),
+                         &ta);
+            const StringObj& X = mX;
+
+            mX.insert(strings.begin(), strings.end());
+
+            bslma::TestAllocator sa("supplied", veryVeryVerbose);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                const StringObj Y(X, &sa);
+                ASSERT(X == Y);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERT(0 == sa.numBlocksInUse());
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                StringObj mY(0,
+                             bsl::hash<bsl::string>(),
+                             bsl::equal_to<bsl::string>(),
+                             &sa);
+                mY.tryEmplace(strings[0]);
+                mY = X;
+                ASSERT(X == mY);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERT(0 == sa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nRehashing is exception neutral." << endl;
+        {
+            StringObj mX(0,
+                         bsl::hash<bsl::string>(),
+                         bsl::equal_to<bsl::string>(),
+                         &ta);
+            const StringObj& X = mX;
+
+            mX.insert(strings.begin(), strings.end());
+
+            const StringObj    Y(X, &ta);
+            const bsl::size_t  CAPACITY = X.capacity();
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                ASSERT(Y        == X);
+                ASSERT(CAPACITY == X.capacity());
+
+                mX.rehash(4 * CAPACITY);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(Y            == X);
+            ASSERT(4 * CAPACITY == X.capacity());
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CLEAR, RANGE INSERTION, REHASH, AND RESERVE
+        //
+        // Concerns:
+        //: 1 'clear' removes all entries and retains the capacity.
+        //:
+        //: 2 Range insertion inserts the entries whose keys are not present.
+        //:
+        //: 3 'reserve' grows the table, if needed, so that the specified
+        //:   number of entries can be inserted without growing.
+        //:
+        //: 4 'rehash' sets the capacity to the smallest valid capacity no
+        //:   less than requested that can hold the entries, and releases the
+        //:   memory of an empty table given 0.
+        //
+        // Plan:
+        //: 1 Perform the operations on tables of various sizes, and verify
+        //:   their value, capacity, and memory usage.  (C-1..4)
+        //
+        // Testing:
+        //   void clear();
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void rehash(size_t minimumCapacity);
+        //   void reserve(size_t numEntries);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLEAR, RANGE INSERTION, REHASH, AND RESERVE"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\nTesting 'reserve'." << endl;
+        {
+            for (int n = 0; n < 300; n += 7) {
+                Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+                const Obj& X = mX;
+
+                mX.reserve(n);
+                const bsl::size_t CAPACITY = X.capacity();
+                ASSERTV(n, CAPACITY, 0 == n || CAPACITY >= 16);
+                ASSERTV(n, CAPACITY, 0 == (CAPACITY & (CAPACITY - 1)));
+                ASSERTV(n, CAPACITY,
+                        static_cast<bsl::size_t>(n)
+                                               <= CAPACITY - CAPACITY / 8);
+                ASSERTV(n, CAPACITY,
+                        CAPACITY <= 16
+                     || static_cast<bsl::size_t>(n)
+                                        > CAPACITY / 2 - CAPACITY / 16);
+
+                const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+                for (int i = 0; i < n; ++i) {
+                    mX.insert(i);
+                }
+                ASSERTV(n, CAPACITY == X.capacity());
+                ASSERTV(n, NUM_ALLOCATIONS == ta.numAllocations());
+
+                mX.reserve(n / 2);
+                ASSERTV(n, CAPACITY == X.capacity());
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'rehash'." << endl;
+        {
+            Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+            const Obj& X = mX;
+
+            mX.rehash(0);
+            ASSERT(0 == X.capacity());
+
+            mX.rehash(1);
+            ASSERT(16 == X.capacity());
+
+            mX.rehash(100);
+            ASSERT(128 == X.capacity());
+
+            bsl::set<int> oracle;
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(i * 3);
+                oracle.insert(i * 3);
+            }
+            ASSERT(128 == X.capacity());
+
+            mX.rehash(1000);
+            ASSERT(1024 == X.capacity());
+            ASSERT(isEqualToOracle(X, oracle));
+
+            mX.rehash(0);
+            ASSERT(128 == X.capacity());
+            ASSERT(isEqualToOracle(X, oracle));
+
+            mX.clear();
+            ASSERT(0   == X.size());
+            ASSERT(128 == X.capacity());
+            ASSERT(X.begin() == X.end());
+            ASSERT(0   <  ta.numBlocksInUse());
+
+            mX.rehash(0);
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting range insertion." << endl;
+        {
+            const int VALUES[]   = { 5, 3, 5, 1, 3, 9, 7, 9, 5 };
+            const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+            const Obj& X = mX;
+
+            mX.insert(7);
+            mX.insert(VALUES, VALUES + NUM_VALUES);
+
+            bsl::set<int> oracle(VALUES, VALUES + NUM_VALUES);
+            ASSERT(isEqualToOracle(X, oracle));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 A copy has the value, capacity, and functors of the original, and
+        //:   uses the supplied allocator.
+        //:
+        //: 2 A copy of a table having erased entries finds all of its keys.
+        //:
+        //: 3 Assignment (including self-assignment) gives the target the value
+        //:   and functors of the source.
+        //:
+        //: 4 'swap' exchanges the values and functors of two tables.
+        //:
+        //: 5 Equality compares the keys and entries, regardless of the
+        //:   capacities and the order of insertion.
+        //
+        // Plan:
+        //: 1 Create tables of various values, with erased entries, using a
+        //:   hash functor having state, and copy, assign, swap, and compare
+        //:   them.  (C-1..5)
+        //
+        // Testing:
+        //   FlatHashTable(const FlatHashTable& original, basicAllocator = 0);
+        //   FlatHashTable& operator=(const FlatHashTable& rhs);
+        //   void swap(FlatHashTable& other);
+        //   bool operator==(const FlatHashTable&, const FlatHashTable&);
+        //   bool operator!=(const FlatHashTable&, const FlatHashTable&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, ASSIGNMENT, SWAP, AND EQUALITY" << endl
+                          << "====================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVerbose);
+
+        const int SIZES[]   = { 0, 1, 13, 14, 15, 100, 1000 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            ModuloObj mX(0, ModuloHash(97), bsl::equal_to<int>(), &ta);
+            const ModuloObj& X = mX;
+
+            bsl::set<int> oracle;
+            for (int i = 0; i < 2 * SIZE; ++i) {
+                mX.insert(i);
+                oracle.insert(i);
+            }
+            for (int i = 0; i < 2 * SIZE; i += 2) {
+                mX.erase(i);
+                oracle.erase(i);
+            }
+
+            {
+                const ModuloObj Y(X, &sa);
+                ASSERTV(SIZE, isEqualToOracle(Y, oracle));
+                ASSERTV(SIZE, X.capacity() == Y.capacity());
+                ASSERTV(SIZE, 97 == Y.hash_function().d_divisor);
+                ASSERTV(SIZE, &sa == Y.allocator());
+                ASSERTV(SIZE, X == Y);
+                ASSERTV(SIZE, !(X != Y));
+            }
+            ASSERTV(SIZE, 0 == sa.numBlocksInUse());
+
+            {
+                ModuloObj mY(0, ModuloHash(13), bsl::equal_to<int>(), &sa);
+                mY.insert(-1);
+                ASSERTV(SIZE, X != mY);
+
+                mY = X;
+                ASSERTV(SIZE, isEqualToOracle(mY, oracle));
+                ASSERTV(SIZE, 97 == mY.hash_function().d_divisor);
+                ASSERTV(SIZE, &sa == mY.allocator());
+
+                mY = mY;
+                ASSERTV(SIZE, isEqualToOracle(mY, oracle));
+            }
+            ASSERTV(SIZE, 0 == sa.numBlocksInUse());
+
+            {
+                ModuloObj mY(0, ModuloHash(13), bsl::equal_to<int>(), &ta);
+                mY.insert(-1);
+
+                mX.swap(mY);
+                ASSERTV(SIZE, 1  == X.size());
+                ASSERTV(SIZE, 13 == X.hash_function().d_divisor);
+                ASSERTV(SIZE, isEqualToOracle(mY, oracle));
+                ASSERTV(SIZE, 97 == mY.hash_function().d_divisor);
+
+                mX.swap(mY);
+                ASSERTV(SIZE, isEqualToOracle(X, oracle));
+            }
+
+            {
+                // Insert the same keys in reverse order into a table of a
+                // different capacity.
+
+                ModuloObj mY(4 * SIZE + 100,
+                             ModuloHash(97),
+                             bsl::equal_to<int>(),
+                             &ta);
+                for (bsl::set<int>::const_reverse_iterator it =
+                                                            oracle.rbegin();
+                     it != oracle.rend();
+                     ++it) {
+                    mY.insert(*it);
+                }
+                ASSERTV(SIZE, X == mY);
+
+                if (SIZE) {
+                    mY.erase(*oracle.begin());
+                    ASSERTV(SIZE, X != mY);
+
+                    mY.insert(-1);
+                    ASSERTV(SIZE, X != mY);
+                }
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ERASE
+        //
+        // Concerns:
+        //: 1 Erasing by key removes the entry having the key, if any, and
+        //:   returns the number of entries removed.
+        //:
+        //: 2 Erasing by iterator returns an iterator to the next entry, and
+        //:   erasing a range removes exactly the entries of the range.
+        //:
+        //: 3 Erased entries do not break the probe sequences of other keys,
+        //:   even when all keys share a probe sequence spanning many groups.
+        //:
+        //: 4 Erased entries are reused, and repeated insertion and erasure
+        //:   of a bounded number of keys does not grow the table.
+        //:
+        //: 5 Random sequences of operations agree with an oracle.
+        //
+        // Plan:
+        //: 1 Erase keys by key, iterator, and range, and verify the value of
+        //:   the table.  (C-1..2)
+        //:
+        //: 2 Using a hash functor mapping every key to the same value, insert
+        //:   keys filling several groups, erase keys at various positions of
+        //:   the shared probe sequence, and verify that the remaining keys are
+        //:   found.  (C-3)
+        //:
+        //: 3 Repeatedly insert and erase distinct keys, keeping the size of
+        //:   the table bounded, and verify that its capacity stays bounded.
+        //:   (C-4)
+        //:
+        //: 4 Apply random operations, with both hash functors, and compare the
+        //:   table to a 'bsl::set'.  (C-5)
+        //
+        // Testing:
+        //   size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   CONCERN: Erased entries do not break probe sequences.
+        //   CONCERN: Repeated insertion and erasure does not grow the table.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ERASE" << endl
+                          << "=====" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\nErasing by key, iterator, and range." << endl;
+        {
+            Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+            const Obj& X = mX;
+
+            bsl::set<int> oracle;
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(i);
+                oracle.insert(i);
+            }
+
+            ASSERT(1 == mX.erase(50));
+            ASSERT(0 == mX.erase(50));
+            ASSERT(0 == mX.erase(1000));
+            oracle.erase(50);
+            ASSERT(isEqualToOracle(X, oracle));
+
+            // Erase every other entry by iterator.
+
+            Obj::iterator it = mX.begin();
+            while (it != mX.end()) {
+                const int KEY = *it;
+                Obj::iterator next = it;
+                ++next;
+
+                if (KEY % 2) {
+                    Obj::iterator result = mX.erase(it);
+                    ASSERTV(KEY, next == result);
+                    oracle.erase(KEY);
+                }
+                it = next;
+            }
+            ASSERT(isEqualToOracle(X, oracle));
+
+            // Erase a range starting at the third entry.
+
+            Obj::const_iterator first = X.begin();
+            ++first;
+            ++first;
+            Obj::const_iterator last = first;
+            for (int i = 0; i < 10; ++i) {
+                oracle.erase(*last);
+                ++last;
+            }
+            const int LAST_KEY = *last;
+
+            Obj::iterator result = mX.erase(first, last);
+            ASSERT(LAST_KEY == *result);
+            ASSERT(isEqualToOracle(X, oracle));
+
+            mX.erase(X.begin(), X.end());
+            ASSERT(0 == X.size());
+            ASSERT(X.begin() == X.end());
+        }
+
+        if (verbose) cout << "\nErasing in a shared probe sequence." << endl;
+        {
+            const int NUM_KEYS = 100;  // spans 7 groups
+
+            for (int erased = 0; erased < NUM_KEYS; erased += 3) {
+                CollidingObj mX(0,
+                                ConstantHash(),
+                                bsl::equal_to<int>(),
+                                &ta);
+                const CollidingObj& X = mX;
+
+                bsl::set<int> oracle;
+                for (int i = 0; i < NUM_KEYS; ++i) {
+                    mX.insert(i);
+                    oracle.insert(i);
+                }
+
+                for (int i = erased; i < erased + 5 && i < NUM_KEYS; ++i) {
+                    ASSERTV(erased, i, 1 == mX.erase(i));
+                    oracle.erase(i);
+                }
+                ASSERTV(erased, isEqualToOracle(X, oracle));
+
+                // Reinsert an erased key, which must not be duplicated.
+
+                ASSERTV(erased, mX.insert(erased).second);
+                ASSERTV(erased, !mX.insert(erased).second);
+                oracle.insert(erased);
+                ASSERTV(erased, isEqualToOracle(X, oracle));
+            }
+        }
+
+        if (verbose) cout << "\nRepeated insertion and erasure." << endl;
+        {
+            Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+            const Obj& X = mX;
+
+            CollidingObj mY(0, ConstantHash(), bsl::equal_to<int>(), &ta);
+            const CollidingObj& Y = mY;
+
+            const int WINDOW = 20;
+
+            for (int i = 0; i < 10000; ++i) {
+                mX.insert(i);
+                if (i >= WINDOW) {
+                    ASSERTV(i, 1 == mX.erase(i - WINDOW));
+                }
+                if (i < 1000) {
+                    mY.insert(i);
+                    if (i >= WINDOW) {
+                        ASSERTV(i, 1 == mY.erase(i - WINDOW));
+                    }
+                }
+            }
+            ASSERTV(X.capacity(), 64 >= X.capacity());
+            ASSERTV(Y.capacity(), 64 >= Y.capacity());
+
+            bsl::set<int> oracle;
+            for (int i = 10000 - WINDOW; i < 10000; ++i) {
+                oracle.insert(i);
+            }
+            ASSERT(isEqualToOracle(X, oracle));
+        }
+
+        if (verbose) cout << "\nRandom operations." << endl;
+        {
+            srand(17);
+
+            Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+            randomOperations(&mX, 50000, 1000);
+
+            CollidingObj mY(0, ConstantHash(), bsl::equal_to<int>(), &ta);
+            randomOperations(&mY, 5000, 100);
+
+            ModuloObj mZ(0, ModuloHash(16), bsl::equal_to<int>(), &ta);
+            randomOperations(&mZ, 50000, 5000);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default table is empty, has no capacity, and allocates no
+        //:   memory; a table created with a capacity can hold that many
+        //:   entries without growing.
+        //:
+        //: 2 'insert' and 'tryEmplace' insert a key only if it is absent, and
+        //:   return an iterator to the entry having the key.
+        //:
+        //: 3 The table grows, doubling its capacity, exactly when an insertion
+        //:   would exceed the maximum load factor of 7/8.
+        //:
+        //: 4 'find', 'contains', and 'count' locate exactly the inserted keys.
+        //:
+        //: 5 Iteration visits each entry exactly once.
+        //:
+        //: 6 The accessors report the size, capacity, load factor, functors,
+        //:   and allocator of the table.
+        //
+        // Plan:
+        //: 1 Insert keys into tables, alternating between 'insert' and
+        //:   'tryEmplace', and verify the results, size, capacity, and
+        //:   contents of the table after each insertion.  (C-1..6)
+        //
+        // Testing:
+        //   FlatHashTable(capacity, hash, equal, basicAllocator = 0);
+        //   ~FlatHashTable();
+        //   iterator begin();
+        //   iterator end();
+        //   iterator find(const KEY& key);
+        //   pair<iterator, bool> insert(const ENTRY& entry);
+        //   pair<iterator, bool> tryEmplace(const KEY& key);
+        //   const_iterator begin() const;
+        //   size_t capacity() const;
+        //   bool contains(const KEY& key) const;
+        //   size_t count(const KEY& key) const;
+        //   bool empty() const;
+        //   const_iterator end() const;
+        //   const_iterator find(const KEY& key) const;
+        //   const HASH& hash_function() const;
+        //   const EQUAL& key_eq() const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+                          << "========================================"
+                          << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\nDefault construction." << endl;
+        {
+            Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>());
+            const Obj& X = mX;
+
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(0     == X.size());
+            ASSERT(true  == X.empty());
+            ASSERT(0     == X.capacity());
+            ASSERT(0.0f  == X.load_factor());
+            ASSERT(0.875f == X.max_load_factor());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.end()   == X.find(0));
+            ASSERT(false == X.contains(0));
+            ASSERT(0     == X.count(0));
+            ASSERT(0     == mX.erase(0));
+            ASSERT(0     == defaultAllocator.numBlocksTotal());
+
+            ModuloObj mY(0, ModuloHash(5), bsl::equal_to<int>(), &ta);
+            ASSERT(&ta == mY.allocator());
+            ASSERT(5   == mY.hash_function().d_divisor);
+            ASSERT(true == mY.key_eq()(3, 3));
+            ASSERT(0   == ta.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nConstruction with a capacity." << endl;
+        {
+            const int CAPACITIES[] = { 1, 14, 15, 28, 29, 100, 1000 };
+            const int NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES;
+
+            for (int ti = 0; ti < NUM_CAPACITIES; ++ti) {
+                const int CAPACITY = CAPACITIES[ti];
+
+                Obj mX(CAPACITY, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+                const Obj& X = mX;
+
+                const bsl::size_t INITIAL = X.capacity();
+                ASSERTV(CAPACITY, INITIAL,
+                        static_cast<bsl::size_t>(CAPACITY)
+                                                 <= INITIAL - INITIAL / 8);
+
+                const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+                for (int i = 0; i < CAPACITY; ++i) {
+                    mX.insert(i);
+                }
+                ASSERTV(CAPACITY, INITIAL == X.capacity());
+                ASSERTV(CAPACITY, NUM_ALLOCATIONS == ta.numAllocations());
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nInsertion and lookup." << endl;
+        {
+            Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+            const Obj& X = mX;
+
+            const int NUM_KEYS = 1000;
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const int         KEY      = i * 7919;
+                const bsl::size_t CAPACITY = X.capacity();
+
+                bsl::pair<Obj::iterator, bool> result = i % 2
+                                                      ? mX.insert(KEY)
+                                                      : mX.tryEmplace(KEY);
+                ASSERTV(i, result.second);
+                ASSERTV(i, KEY == *result.first);
+
+                // Growth occurs exactly when the size would exceed 7/8 of
+                // the capacity.
+
+                const bsl::size_t SIZE = i + 1;
+                if (SIZE > CAPACITY - CAPACITY / 8) {
+                    ASSERTV(i, CAPACITY, X.capacity(),
+                            (CAPACITY ? 2 * CAPACITY : 16) == X.capacity());
+                }
+                else {
+                    ASSERTV(i, CAPACITY == X.capacity());
+                }
+
+                result = i % 2 ? mX.tryEmplace(KEY) : mX.insert(KEY);
+                ASSERTV(i, !result.second);
+                ASSERTV(i, KEY == *result.first);
+
+                ASSERTV(i, SIZE  == X.size());
+                ASSERTV(i, false == X.empty());
+                ASSERTV(i, X.load_factor() ==
+                           static_cast<float>(SIZE)
+                                        / static_cast<float>(X.capacity()));
+            }
+
+            bsl::set<int> oracle;
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const int KEY = i * 7919;
+
+                oracle.insert(KEY);
+                ASSERTV(i, X.contains(KEY));
+                ASSERTV(i, 1 == X.count(KEY));
+                ASSERTV(i, KEY == *X.find(KEY));
+                ASSERTV(i, KEY == *mX.find(KEY));
+                ASSERTV(i, !X.contains(KEY + 1));
+                ASSERTV(i, 0 == X.count(KEY + 1));
+                ASSERTV(i, X.end() == X.find(KEY + 1));
+                ASSERTV(i, mX.end() == mX.find(KEY + 1));
+            }
+            ASSERT(isEqualToOracle(X, oracle));
+
+            bsl::size_t numIterated = 0;
+            for (Obj::iterator it = mX.begin(); it != mX.end(); ++it) {
+                ++numIterated;
+            }
+            ASSERT(NUM_KEYS == numIterated);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ITERATOR IMPLEMENTATION
+        //
+        // Concerns:
+        //: 1 A default iterator compares equal to another default iterator.
+        //:
+        //: 2 Incrementing skips empty and erased entries, and stops at the
+        //:   past-the-end position.
+        //:
+        //: 3 Dereferencing returns the current entry, and 'index' its index.
+        //:
+        //: 4 Iterators are equal only if they refer to the same entry of the
+        //:   same table.
+        //
+        // Plan:
+        //: 1 Create arrays of entries and control bytes, marking various
+        //:   subsets of the entries in use, and iterate over them.  (C-1..4)
+        //
+        // Testing:
+        //   FlatHashTable_IteratorImp();
+        //   FlatHashTable_IteratorImp(entries, controls, index, capacity);
+        //   void operator++();
+        //   ENTRY& operator*() const;
+        //   size_t index() const;
+        //   bool operator==(const IteratorImp& lhs, const IteratorImp& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ITERATOR IMPLEMENTATION" << endl
+                          << "=======================" << endl;
+
+        ASSERT(IteratorImp() == IteratorImp());
+
+        enum { k_CAPACITY = 32 };
+
+        int          entries[k_CAPACITY];
+        int          otherEntries[k_CAPACITY];
+        bsl::uint8_t controls[k_CAPACITY];
+
+        for (int i = 0; i < k_CAPACITY; ++i) {
+            entries[i] = otherEntries[i] = i * 10;
+        }
+
+        for (int mask = 0; mask < 64; ++mask) {
+            // Bit 'j' of 'mask' selects whether the entries congruent to 'j'
+            // modulo 6 are in use; others are alternately empty and erased.
+
+            bsl::vector<int> expected;
+            for (int i = 0; i < k_CAPACITY; ++i) {
+                if (mask & (1 << (i % 6))) {
+                    controls[i] = static_cast<bsl::uint8_t>(i & 0x7F);
+                    expected.push_back(i);
+                }
+                else {
+                    controls[i] = static_cast<bsl::uint8_t>(
+                                                  i % 2
+                                                  ? GroupControl::k_EMPTY
+                                                  : GroupControl::k_ERASED);
+                }
+            }
+            expected.push_back(k_CAPACITY);
+
+            IteratorImp it(entries, controls, expected[0], k_CAPACITY);
+            IteratorImp end(entries, controls, k_CAPACITY, k_CAPACITY);
+
+            for (bsl::size_t j = 0; j + 1 < expected.size(); ++j) {
+                ASSERTV(mask, j, !(it == end));
+                ASSERTV(mask, j, expected[j] == static_cast<int>(it.index()));
+                ASSERTV(mask, j, expected[j] * 10 == *it);
+                ASSERTV(mask, j, &entries[expected[j]] == &*it);
+
+                IteratorImp other(otherEntries,
+                                  controls,
+                                  it.index(),
+                                  k_CAPACITY);
+                ASSERTV(mask, j, !(it == other));
+
+                IteratorImp same(entries, controls, it.index(), k_CAPACITY);
+                ASSERTV(mask, j, it == same);
+
+                ++it;
+            }
+            ASSERTV(mask, it == end);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // GROUP CONTROL
+        //
+        // Concerns:
+        //: 1 'available' reports exactly the empty and erased entries, and
+        //:   'inUse' exactly the others.
+        //:
+        //: 2 'match' reports exactly the entries having the specified control
+        //:   byte, including the empty and erased control bytes.
+        //:
+        //: 3 'neverFull' reports whether any entry is empty.
+        //
+        // Plan:
+        //: 1 For a set of patterns of control bytes in an aligned buffer,
+        //:   compute the expected masks by brute force and compare them to
+        //:   the results of the inquiries.  (C-1..3)
+        //
+        // Testing:
+        //   FlatHashTable_GroupControl(const uint8_t *data);
+        //   BitMask available() const;
+        //   BitMask inUse() const;
+        //   BitMask match(uint8_t value) const;
+        //   bool neverFull() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "GROUP CONTROL" << endl
+                          << "=============" << endl;
+
+        bsls::AlignedBuffer<GroupControl::k_SIZE, 16> buffer;
+        bsl::uint8_t *data = reinterpret_cast<bsl::uint8_t *>(
+                                                             buffer.buffer());
+
+        srand(1);
+
+        for (int ti = 0; ti < 2000; ++ti) {
+            // Generate patterns of control bytes, drawing the bytes in use
+            // from a small range so that values repeat.
+
+            for (int i = 0; i < GroupControl::k_SIZE; ++i) {
+                const int r = rand() % 10;
+                data[i] = static_cast<bsl::uint8_t>(
+                                  0 == r ? GroupControl::k_EMPTY
+                                : 1 == r ? GroupControl::k_ERASED
+                                :          (ti % 2 ? rand() % 4
+                                                   : rand() % 128));
+            }
+            if (ti % 100 == 3) {
+                bsl::memset(data, GroupControl::k_EMPTY, GroupControl::k_SIZE);
+            }
+            if (ti % 100 == 5) {
+                bsl::memset(data, 0x7F, GroupControl::k_SIZE);
+            }
+
+            GroupControl::BitMask expAvailable = 0;
+            bool                  expNeverFull = false;
+            for (int i = 0; i < GroupControl::k_SIZE; ++i) {
+                if (data[i] & 0x80) {
+                    expAvailable |= 1u << i;
+                }
+                if (GroupControl::k_EMPTY == data[i]) {
+                    expNeverFull = true;
+                }
+            }
+
+            const GroupControl X(data);
+
+            ASSERTV(ti, expAvailable == X.available());
+            ASSERTV(ti, (~expAvailable & 0xFFFFu) == X.inUse());
+            ASSERTV(ti, expNeverFull == X.neverFull());
+
+            const int VALUES[] = { 0, 1, 2, 3, 0x55, 0x7F,
+                                   GroupControl::k_EMPTY,
+                                   GroupControl::k_ERASED };
+            const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            for (int tj = 0; tj < NUM_VALUES; ++tj) {
+                const bsl::uint8_t VALUE =
+                                         static_cast<bsl::uint8_t>(VALUES[tj]);
+
+                GroupControl::BitMask expMatch = 0;
+                for (int i = 0; i < GroupControl::k_SIZE; ++i) {
+                    if (VALUE == data[i]) {
+                        expMatch |= 1u << i;
+                    }
+                }
+                ASSERTV(ti, tj, expMatch == X.match(VALUE));
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase a few keys, and copy a table.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+            const Obj& X = mX;
+
+            ASSERT(0 == X.size());
+
+            for (int i = 0; i < 100; ++i) {
+                ASSERTV(i, mX.insert(i).second);
+            }
+            ASSERT(100 == X.size());
+            ASSERT(128 == X.capacity());
+
+            for (int i = 0; i < 100; ++i) {
+                ASSERTV(i, X.contains(i));
+            }
+            ASSERT(!X.contains(100));
+
+            Obj mY(X, &ta);  const Obj& Y = mY;
+            ASSERT(X == Y);
+
+            for (int i = 0; i < 100; i += 2) {
+                ASSERTV(i, 1 == mX.erase(i));
+            }
+            ASSERT(50 == X.size());
+            ASSERT(X != Y);
+
+            for (int i = 0; i < 100; ++i) {
+                ASSERTV(i, (i % 2 == 1) == X.contains(i));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
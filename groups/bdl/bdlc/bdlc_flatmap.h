@@ -0,0 +1,787 @@
+// bdlc_flatmap.h                                                     -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATMAP
+#define INCLUDED_BDLC_FLATMAP
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered map container stored in a sorted vector.
+//
+//@CLASSES:
+//  bdlc::FlatMap: ordered map container stored in a sorted vector
+//
+//@SEE_ALSO: bdlc_flatset, bdlc_flatsortedtable, bslstl_map
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::FlatMap', implementing an ordered map of unique keys to values.  The
+// interface of 'bdlc::FlatMap' is a subset of that of 'bsl::map'; its
+// implementation, a vector of elements sorted by key described in
+// 'bdlc_flatsortedtable', differs.
+//
+// A 'bsl::map' allocates a node for each element, and a lookup follows
+// pointers from the root of a red-black tree to a leaf.  A 'bdlc::FlatMap'
+// stores its elements in a single contiguous array, sorted by key, and a
+// lookup is a branch-free binary search of that array.  As a result, a map
+// holds no per-element pointers, iteration visits consecutive memory, and
+// lookups incur neither cache misses on scattered nodes nor branch
+// mispredictions.  A map constructed from (or extended by) a range of
+// elements sorts the range once, which is considerably faster than inserting
+// the elements one by one into a tree.
+//
+// The price paid for this performance is that inserting or erasing a single
+// element takes time linear in the number of elements that follow it, and
+// invalidates all iterators, pointers, and references to the elements
+// following it (any insertion invalidates all of them).  A 'bdlc::FlatMap' is
+// therefore best suited to maps that are built once, or rarely modified, and
+// searched often: configuration data, symbol tables, calendars, and the like.
+//
+// Note that, since elements are moved by assignment within the array, the
+// 'value_type' of a 'bdlc::FlatMap' is 'bsl::pair<KEY, VALUE>' rather than
+// 'bsl::pair<const KEY, VALUE>'; the behavior is undefined if the key of an
+// element is modified through an iterator.
+//
+///Memory Allocation
+///-----------------
+// A 'bdlc::FlatMap' uses the allocator supplied at construction (or the
+// currently installed default allocator) to supply memory for its array, and
+// passes it to the elements it creates if they use 'bslma' allocators.  The
+// unused capacity of the array, which may remain after a map is built, is
+// released by 'shrink_to_fit'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Table of Holidays
+///- - - - - - - - - - - - - - -
+// Suppose we wish to look up the names of holidays by their dates, each
+// represented as an 'int' of the form 'YYYYMMDD'.  The table is loaded once,
+// from data in no particular order, and then searched often.
+//
+// First, we define the data:
+//..
+//  typedef bsl::pair<int, bsl::string> Holiday;
+//
+//  const Holiday HOLIDAYS[] = {
+//      Holiday(20161225, "Christmas"),
+//      Holiday(20160101, "New Year's Day"),
+//      Holiday(20160704, "Independence Day"),
+//      Holiday(20161124, "Thanksgiving"),
+//  };
+//  const int NUM_HOLIDAYS = sizeof HOLIDAYS / sizeof *HOLIDAYS;
+//..
+// Then, we create the map, which sorts the data once:
+//..
+//  bdlc::FlatMap<int, bsl::string> holidays(HOLIDAYS,
+//                                           HOLIDAYS + NUM_HOLIDAYS);
+//  holidays.shrink_to_fit();
+//..
+// Next, we look up a holiday by its date:
+//..
+//  assert("Independence Day" == holidays.at(20160704));
+//  assert(false == holidays.contains(20160705));
+//..
+// Finally, we find the first holiday after a date, and observe that the
+// elements are ordered by date:
+//..
+//  bdlc::FlatMap<int, bsl::string>::const_iterator it =
+//                                             holidays.upper_bound(20160704);
+//
+//  assert("Thanksgiving" == it->second);
+//  ++it;
+//  assert("Christmas"    == it->second);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLC_FLATSORTEDTABLE
+#include <bdlc_flatsortedtable.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_CONSTRUCTIONUTIL
+#include <bslma_constructionutil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DESTRUCTORGUARD
+#include <bslma_destructorguard.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_OBJECTBUFFER
+#include <bsls_objectbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_FUNCTIONAL
+#include <bsl_functional.h>
+#endif
+
+#ifndef INCLUDED_BSL_UTILITY
+#include <bsl_utility.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                         // ========================
+                         // struct FlatMap_EntryUtil
+                         // ========================
+
+template <class KEY, class VALUE>
+struct FlatMap_EntryUtil {
+    // This component-private utility 'struct' provides the entry operations
+    // required by 'FlatSortedTable' for the entries of a 'FlatMap'.
+
+    // TYPES
+    typedef bsl::pair<KEY, VALUE> Entry;
+
+    // CLASS METHODS
+    static void constructFromKey(Entry            *address,
+                                 bslma::Allocator *allocator,
+                                 const KEY&        key);
+        // Construct at the specified 'address' an entry having the specified
+        // 'key' and a default-constructed value, using the specified
+        // 'allocator' to supply memory.
+
+    static const KEY& key(const Entry& entry);
+        // Return the key of the specified 'entry'.
+};
+
+                               // =============
+                               // class FlatMap
+                               // =============
+
+template <class KEY, class VALUE, class COMPARATOR = bsl::less<KEY> >
+class FlatMap {
+    // This class template implements a value-semantic ordered map of unique
+    // keys of type 'KEY' to values of type 'VALUE', stored in a vector sorted
+    // by key.
+
+    // PRIVATE TYPES
+    typedef FlatSortedTable<KEY,
+                            bsl::pair<KEY, VALUE>,
+                            FlatMap_EntryUtil<KEY, VALUE>,
+                            COMPARATOR> ImplType;
+
+    // DATA
+    ImplType d_impl;  // underlying sorted table
+
+    // FRIENDS
+    template <class K, class V, class C>
+    friend bool operator==(const FlatMap<K, V, C>&, const FlatMap<K, V, C>&);
+
+  public:
+    // TYPES
+    typedef KEY                                  key_type;
+    typedef VALUE                                mapped_type;
+    typedef bsl::pair<KEY, VALUE>                value_type;
+    typedef COMPARATOR                           key_compare;
+    typedef bsl::size_t                          size_type;
+    typedef value_type&                          reference;
+    typedef const value_type&                    const_reference;
+    typedef typename ImplType::iterator          iterator;
+    typedef typename ImplType::const_iterator    const_iterator;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatMap, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit FlatMap(bslma::Allocator *basicAllocator = 0);
+    explicit FlatMap(const COMPARATOR&  comparator,
+                     bslma::Allocator  *basicAllocator = 0);
+        // Create an empty map.  Optionally specify a 'comparator' used to
+        // order keys.  If 'comparator' is not supplied, a default-constructed
+        // 'COMPARATOR' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  No memory is allocated.
+
+    template <class INPUT_ITERATOR>
+    FlatMap(INPUT_ITERATOR    first,
+            INPUT_ITERATOR    last,
+            bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatMap(INPUT_ITERATOR     first,
+            INPUT_ITERATOR     last,
+            const COMPARATOR&  comparator,
+            bslma::Allocator  *basicAllocator = 0);
+        // Create a map holding the elements in the range '[first .. last)',
+        // in any order, ignoring elements whose keys duplicate that of a
+        // previous element.  Optionally specify a 'comparator' used to order
+        // keys.  If 'comparator' is not supplied, a default-constructed
+        // 'COMPARATOR' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The range is sorted once, so that this
+        // operation takes 'O(N * log(N))' time for 'N' elements, or 'O(N)'
+        // time if the range is already sorted.
+
+    FlatMap(const FlatMap& original, bslma::Allocator *basicAllocator = 0);
+        // Create a map having the same value and comparator as the specified
+        // 'original'.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    //! ~FlatMap() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! FlatMap& operator=(const FlatMap& rhs) = default;
+        // Assign to this map the value and comparator of the specified 'rhs',
+        // and return a reference providing modifiable access to this map.
+
+    VALUE& operator[](const KEY& key);
+        // Return a reference providing modifiable access to the value mapped
+        // to the specified 'key', first inserting an element having 'key' and
+        // a default-constructed value if this map has no such element.
+
+    VALUE& at(const KEY& key);
+        // Return a reference providing modifiable access to the value mapped
+        // to the specified 'key'.  Throw 'bsl::out_of_range' if this map has
+        // no element having 'key'.
+
+    iterator begin();
+        // Return an iterator to the first element of this map, or the
+        // past-the-end iterator if this map is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this map.
+
+    void clear();
+        // Remove all elements from this map.  Note that the capacity of the
+        // map is unchanged.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove the element having the specified 'key' from this map, if
+        // any.  Return the number of elements removed (0 or 1).
+
+    iterator erase(const_iterator position);
+        // Remove the element at the specified 'position' from this map, and
+        // return an iterator to the element following it.  The behavior is
+        // undefined unless 'position' refers to an element of this map.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove the elements in the range '[first .. last)' from this map,
+        // and return an iterator to the element following the last one
+        // removed.  The behavior is undefined unless '[first .. last)' is a
+        // valid range of elements of this map.
+
+    iterator find(const KEY& key);
+        // Return an iterator to the element having the specified 'key', or the
+        // past-the-end iterator if this map has no such element.
+
+    bsl::pair<iterator, bool> insert(const value_type& value);
+        // Insert a copy of the specified 'value' into this map if it has no
+        // element having the key of 'value'.  Return a pair whose 'first'
+        // member refers to the element having that key, and whose 'second'
+        // member is 'true' if 'value' was inserted, and 'false' otherwise.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert copies of the elements in the range '[first .. last)', in any
+        // order, whose keys are not already in this map, ignoring elements
+        // whose keys duplicate that of a previous element.  This operation
+        // takes 'O(M * log(M) + N)' time for 'M' elements in the range and 'N'
+        // elements in this map.
+
+    iterator lower_bound(const KEY& key);
+        // Return an iterator to the first element whose key is not ordered
+        // before the specified 'key', or the past-the-end iterator if there is
+        // no such element.
+
+    void reserve(bsl::size_t numElements);
+        // Increase the capacity of this map, if needed, so that it can hold
+        // the specified 'numElements' without reallocating.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this map, if possible, to its size.
+
+    void swap(FlatMap& other);
+        // Exchange the value and comparator of this map with those of the
+        // specified 'other'.  The behavior is undefined unless this map and
+        // 'other' use the same allocator.
+
+    iterator upper_bound(const KEY& key);
+        // Return an iterator to the first element whose key is ordered after
+        // the specified 'key', or the past-the-end iterator if there is no
+        // such element.
+
+    // ACCESSORS
+    const VALUE& at(const KEY& key) const;
+        // Return a reference providing non-modifiable access to the value
+        // mapped to the specified 'key'.  Throw 'bsl::out_of_range' if this
+        // map has no element having 'key'.
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator to the first element of this map, or the
+        // past-the-end iterator if this map is empty.
+
+    bsl::size_t capacity() const;
+        // Return the number of elements this map can hold without
+        // reallocating.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this map has an element having the specified 'key',
+        // and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements having the specified 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this map has no elements, and 'false' otherwise.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator of this map.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator to the element having the specified 'key', or the
+        // past-the-end iterator if this map has no such element.
+
+    COMPARATOR key_comp() const;
+        // Return (a copy of) the key comparator of this map.
+
+    const_iterator lower_bound(const KEY& key) const;
+        // Return an iterator to the first element whose key is not ordered
+        // before the specified 'key', or the past-the-end iterator if there is
+        // no such element.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this map.
+
+    const_iterator upper_bound(const KEY& key) const;
+        // Return an iterator to the first element whose key is ordered after
+        // the specified 'key', or the past-the-end iterator if there is no
+        // such element.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this map to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator==(const FlatMap<KEY, VALUE, COMPARATOR>& lhs,
+                const FlatMap<KEY, VALUE, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' maps have the same value,
+    // and 'false' otherwise.  Two maps have the same value if they have the
+    // same number of elements, and each element of 'lhs' has a key and value
+    // equal to those of the element at the same position in 'rhs'.
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator!=(const FlatMap<KEY, VALUE, COMPARATOR>& lhs,
+                const FlatMap<KEY, VALUE, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' maps do not have the same
+    // value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR>
+void swap(FlatMap<KEY, VALUE, COMPARATOR>& a,
+          FlatMap<KEY, VALUE, COMPARATOR>& b);
+    // Exchange the values of the specified 'a' and 'b' maps.  The behavior is
+    // undefined unless 'a' and 'b' use the same allocator.
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                         // ------------------------
+                         // struct FlatMap_EntryUtil
+                         // ------------------------
+
+// CLASS METHODS
+template <class KEY, class VALUE>
+inline
+void FlatMap_EntryUtil<KEY, VALUE>::constructFromKey(
+                                                   Entry            *address,
+                                                   bslma::Allocator *allocator,
+                                                   const KEY&        key)
+{
+    bsls::ObjectBuffer<VALUE> value;
+    bslma::ConstructionUtil::construct(value.address(), allocator);
+    bslma::DestructorGuard<VALUE> guard(value.address());
+
+    bslma::ConstructionUtil::construct(address,
+                                       allocator,
+                                       key,
+                                       value.object());
+}
+
+template <class KEY, class VALUE>
+inline
+const KEY& FlatMap_EntryUtil<KEY, VALUE>::key(const Entry& entry)
+{
+    return entry.first;
+}
+
+                               // -------------
+                               // class FlatMap
+                               // -------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(bslma::Allocator *basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(const COMPARATOR&  comparator,
+                                         bslma::Allocator  *basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(INPUT_ITERATOR    first,
+                                         INPUT_ITERATOR    last,
+                                         bslma::Allocator *basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+    d_impl.insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(INPUT_ITERATOR     first,
+                                         INPUT_ITERATOR     last,
+                                         const COMPARATOR&  comparator,
+                                         bslma::Allocator  *basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+    d_impl.insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(const FlatMap&    original,
+                                         bslma::Allocator *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+VALUE& FlatMap<KEY, VALUE, COMPARATOR>::operator[](const KEY& key)
+{
+    return d_impl.tryEmplace(key).first->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+VALUE& FlatMap<KEY, VALUE, COMPARATOR>::at(const KEY& key)
+{
+    iterator it = d_impl.find(key);
+
+    if (it == d_impl.end()) {
+        bslstl::StdExceptUtil::throwOutOfRange(
+                                         "FlatMap<...>::at(key): invalid key");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::end()
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void FlatMap<KEY, VALUE, COMPARATOR>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t FlatMap<KEY, VALUE, COMPARATOR>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::erase(const_iterator position)
+{
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::erase(const_iterator first,
+                                       const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::find(const KEY& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::pair<typename FlatMap<KEY, VALUE, COMPARATOR>::iterator, bool>
+FlatMap<KEY, VALUE, COMPARATOR>::insert(const value_type& value)
+{
+    return d_impl.insert(value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+void FlatMap<KEY, VALUE, COMPARATOR>::insert(INPUT_ITERATOR first,
+                                             INPUT_ITERATOR last)
+{
+    d_impl.insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::lower_bound(const KEY& key)
+{
+    return d_impl.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void FlatMap<KEY, VALUE, COMPARATOR>::reserve(bsl::size_t numElements)
+{
+    d_impl.reserve(numElements);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void FlatMap<KEY, VALUE, COMPARATOR>::shrink_to_fit()
+{
+    d_impl.shrinkToFit();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void FlatMap<KEY, VALUE, COMPARATOR>::swap(FlatMap& other)
+{
+    d_impl.swap(other.d_impl);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::upper_bound(const KEY& key)
+{
+    return d_impl.upperBound(key);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+const VALUE& FlatMap<KEY, VALUE, COMPARATOR>::at(const KEY& key) const
+{
+    const_iterator it = d_impl.find(key);
+
+    if (it == d_impl.end()) {
+        bslstl::StdExceptUtil::throwOutOfRange(
+                                         "FlatMap<...>::at(key): invalid key");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t FlatMap<KEY, VALUE, COMPARATOR>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool FlatMap<KEY, VALUE, COMPARATOR>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t FlatMap<KEY, VALUE, COMPARATOR>::count(const KEY& key) const
+{
+    return d_impl.count(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool FlatMap<KEY, VALUE, COMPARATOR>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::cend() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+COMPARATOR FlatMap<KEY, VALUE, COMPARATOR>::key_comp() const
+{
+    return d_impl.key_comp();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::lower_bound(const KEY& key) const
+{
+    return d_impl.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t FlatMap<KEY, VALUE, COMPARATOR>::size() const
+{
+    return d_impl.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::upper_bound(const KEY& key) const
+{
+    return d_impl.upperBound(key);
+}
+
+                                  // Aspects
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bslma::Allocator *FlatMap<KEY, VALUE, COMPARATOR>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool bdlc::operator==(const FlatMap<KEY, VALUE, COMPARATOR>& lhs,
+                      const FlatMap<KEY, VALUE, COMPARATOR>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool bdlc::operator!=(const FlatMap<KEY, VALUE, COMPARATOR>& lhs,
+                      const FlatMap<KEY, VALUE, COMPARATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void bdlc::swap(FlatMap<KEY, VALUE, COMPARATOR>& a,
+                FlatMap<KEY, VALUE, COMPARATOR>& b)
+{
+    a.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
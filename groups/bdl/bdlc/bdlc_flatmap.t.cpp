@@ -0,0 +1,1114 @@
+// bdlc_flatmap.t.cpp                                                 -*-C++-*-
+#include <bdlc_flatmap.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>      // 'sprintf', 'printf' (needed by exception
+                             // macros)
+#include <bsl_cstdlib.h>     // 'atoi', 'rand'
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_stdexcept.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlc::FlatMap' is a thin adapter of 'bdlc::FlatSortedTable', which is
+// tested thoroughly in its own component.  We must verify that each method
+// forwards to the appropriate method of the table, that the comparator is
+// retained, that entries are constructed with the map's allocator (in
+// particular, the default value inserted by 'operator[]'), and that 'at'
+// reports missing keys.  We also compare the map with a 'bsl::map' oracle
+// over random operations.  A negative test case benchmarks the map against
+// 'bsl::map'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit FlatMap(bslma::Allocator *basicAllocator = 0);
+// [ 2] explicit FlatMap(const COMPARATOR& comparator, ba = 0);
+// [ 2] FlatMap(INPUT_ITERATOR first, INPUT_ITERATOR last, ba = 0);
+// [ 2] FlatMap(first, last, const COMPARATOR& comparator, ba = 0);
+// [ 5] FlatMap(const FlatMap& original, ba = 0);
+//
+// MANIPULATORS
+// [ 5] FlatMap& operator=(const FlatMap& rhs);
+// [ 3] VALUE& operator[](const KEY& key);
+// [ 3] VALUE& at(const KEY& key);
+// [ 4] iterator begin();
+// [ 4] iterator end();
+// [ 4] void clear();
+// [ 4] size_t erase(const KEY& key);
+// [ 4] iterator erase(const_iterator position);
+// [ 4] iterator erase(const_iterator first, const_iterator last);
+// [ 4] iterator find(const KEY& key);
+// [ 4] pair<iterator, bool> insert(const value_type& value);
+// [ 4] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 4] iterator lower_bound(const KEY& key);
+// [ 5] void reserve(size_t numElements);
+// [ 5] void shrink_to_fit();
+// [ 5] void swap(FlatMap& other);
+// [ 4] iterator upper_bound(const KEY& key);
+//
+// ACCESSORS
+// [ 3] const VALUE& at(const KEY& key) const;
+// [ 4] const_iterator begin() const;
+// [ 4] const_iterator cbegin() const;
+// [ 5] size_t capacity() const;
+// [ 4] bool contains(const KEY& key) const;
+// [ 4] size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 4] const_iterator end() const;
+// [ 4] const_iterator cend() const;
+// [ 4] const_iterator find(const KEY& key) const;
+// [ 2] COMPARATOR key_comp() const;
+// [ 4] const_iterator lower_bound(const KEY& key) const;
+// [ 2] size_t size() const;
+// [ 4] const_iterator upper_bound(const KEY& key) const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const FlatMap& lhs, const FlatMap& rhs);
+// [ 5] bool operator!=(const FlatMap& lhs, const FlatMap& rhs);
+//
+// FREE FUNCTIONS
+// [ 5] void swap(FlatMap& a, FlatMap& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: Elements use the map's allocator.
+// [ 4] CONCERN: Random operations agree with 'bsl::map'.
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: COMPARISON WITH 'bsl::map'
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatMap<int, int>                 Obj;
+typedef bdlc::FlatMap<bsl::string, bsl::string> StringObj;
+typedef bsl::pair<int, int>                     Pair;
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct ModuloLess {
+    // This comparator orders its arguments by their values modulo a divisor
+    // supplied at construction, and is used to verify that comparators are
+    // retained.
+
+    int d_divisor;
+
+    explicit ModuloLess(int divisor = 1000003)
+        // Create a comparator having the optionally specified 'divisor'.
+    : d_divisor(divisor)
+    {
+    }
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' modulo the divisor of this
+        // comparator is less than the specified 'rhs' modulo the divisor, and
+        // 'false' otherwise.
+    {
+        return lhs % d_divisor < rhs % d_divisor;
+    }
+};
+
+typedef bdlc::FlatMap<int, int, ModuloLess> ModuloObj;
+
+bool isEqualToOracle(const Obj& map, const bsl::map<int, int>& oracle)
+    // Return 'true' if the specified 'map' has the same elements, in the same
+    // order, as the specified 'oracle', and 'false' otherwise.
+{
+    if (map.size() != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+
+    bsl::map<int, int>::const_iterator jt = oracle.begin();
+    for (Obj::const_iterator it = map.begin(); it != map.end(); ++it, ++jt) {
+        if (it->first != jt->first || it->second != jt->second) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+bslma::Allocator *ndAllocator()
+    // Return the address of the new/delete allocator, which is used by the
+    // performance test to avoid measuring a test allocator.
+{
+    return &bslma::NewDeleteAllocator::singleton();
+}
+
+bsl::string makeKey(int i)
+    // Return a string key, too long for the short-string buffer, formed from
+    // the specified 'i'.  Keys formed from increasing values of 'i' are in
+    // increasing order.
+{
+    char buffer[64];
+    sprintf(buffer, "key-%09d-padding-to-avoid-short-strings", i);
+    return bsl::string(buffer, ndAllocator());
+}
+
+template <class MAP, class KEY>
+void benchmark(const char              *name,
+               const bsl::vector<KEY>&  sortedKeys,
+               const bsl::vector<KEY>&  keys,
+               const bsl::vector<KEY>&  missingKeys)
+    // Print the time taken by the specified 'MAP' type, identified by the
+    // specified 'name', to be loaded with the specified 'sortedKeys', to look
+    // up each of the specified 'keys' (a permutation of 'sortedKeys'), to
+    // look up each of the specified 'missingKeys', and to iterate over its
+    // elements.
+{
+    const bsl::size_t N = keys.size();
+
+    bsl::vector<bsl::pair<KEY, int> > values(ndAllocator());
+    for (bsl::size_t i = 0; i < N; ++i) {
+        values.push_back(bsl::pair<KEY, int>(sortedKeys[i],
+                                             static_cast<int>(i)));
+    }
+
+    bsls::Stopwatch timer;
+
+    timer.start();
+    MAP map(values.begin(), values.end(), ndAllocator());
+    timer.stop();
+    const double loadTime = timer.elapsedTime();
+
+    bsls::Types::Int64 sum = 0;
+
+    timer.reset();
+    timer.start();
+    for (int pass = 0; pass < 4; ++pass) {
+        for (bsl::size_t i = 0; i < N; ++i) {
+            sum += map.find(keys[i])->second;
+        }
+    }
+    timer.stop();
+    const double hitTime = timer.elapsedTime() / 4;
+
+    timer.reset();
+    timer.start();
+    for (int pass = 0; pass < 4; ++pass) {
+        for (bsl::size_t i = 0; i < N; ++i) {
+            sum += map.find(missingKeys[i]) == map.end();
+        }
+    }
+    timer.stop();
+    const double missTime = timer.elapsedTime() / 4;
+
+    timer.reset();
+    timer.start();
+    for (int pass = 0; pass < 4; ++pass) {
+        for (typename MAP::const_iterator it = map.begin();
+             it != map.end();
+             ++it) {
+            sum += it->second;
+        }
+    }
+    timer.stop();
+    const double iterateTime = timer.elapsedTime() / 4;
+
+    ASSERT(N == map.size());
+    ASSERT(0 < sum);
+
+    const double NS = 1e9 / static_cast<double>(N);
+
+    printf("%-24s %9d %9.1f %9.1f %9.1f %9.1f\n",
+           name,
+           static_cast<int>(N),
+           loadTime * NS,
+           hitTime * NS,
+           missTime * NS,
+           iterateTime * NS);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test            = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose         = argc > 2;
+    const bool veryVerbose     = argc > 3;
+    const bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Table of Holidays
+///- - - - - - - - - - - - - - -
+// Suppose we wish to look up the names of holidays by their dates, each
+// represented as an 'int' of the form 'YYYYMMDD'.  The table is loaded once,
+// from data in no particular order, and then searched often.
+//
+// First, we define the data:
+//..
+    typedef bsl::pair<int, bsl::string> Holiday;
+
+    const Holiday HOLIDAYS[] = {
+        Holiday(20161225, "Christmas"),
+        Holiday(20160101, "New Year's Day"),
+        Holiday(20160704, "Independence Day"),
+        Holiday(20161124, "Thanksgiving"),
+    };
+    const int NUM_HOLIDAYS = sizeof HOLIDAYS / sizeof *HOLIDAYS;
+//..
+// Then, we create the map, which sorts the data once:
+//..
+    bdlc::FlatMap<int, bsl::string> holidays(HOLIDAYS,
+                                             HOLIDAYS + NUM_HOLIDAYS);
+    holidays.shrink_to_fit();
+//..
+// Next, we look up a holiday by its date:
+//..
+    ASSERT("Independence Day" == holidays.at(20160704));
+    ASSERT(false == holidays.contains(20160705));
+//..
+// Finally, we find the first holiday after a date, and observe that the
+// elements are ordered by date:
+//..
+    bdlc::FlatMap<int, bsl::string>::const_iterator it =
+                                               holidays.upper_bound(20160704);
+
+    ASSERT("Thanksgiving" == it->second);
+    ++it;
+    ASSERT("Christmas"    == it->second);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, EQUALITY, AND CAPACITY
+        //
+        // Concerns:
+        //: 1 The copy constructor creates an equal map using the supplied
+        //:   allocator, and retains the comparator.
+        //:
+        //: 2 Assignment makes the target equal to the source.
+        //:
+        //: 3 The member and free 'swap' functions exchange the values and
+        //:   comparators of two maps without allocating.
+        //:
+        //: 4 'operator==' and 'operator!=' compare the elements of the maps.
+        //:
+        //: 5 'reserve' ensures the capacity, and 'shrink_to_fit' reduces the
+        //:   capacity to the size, without changing the value.
+        //
+        // Plan:
+        //: 1 Copy, assign, swap, and compare maps of various values, and
+        //:   verify the results.  (C-1..4)
+        //:
+        //: 2 Reserve and shrink a map, and verify its capacity.  (C-5)
+        //
+        // Testing:
+        //   FlatMap(const FlatMap& original, ba = 0);
+        //   FlatMap& operator=(const FlatMap& rhs);
+        //   void reserve(size_t numElements);
+        //   void shrink_to_fit();
+        //   void swap(FlatMap& other);
+        //   size_t capacity() const;
+        //   bool operator==(const FlatMap& lhs, const FlatMap& rhs);
+        //   bool operator!=(const FlatMap& lhs, const FlatMap& rhs);
+        //   void swap(FlatMap& a, FlatMap& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "COPY, ASSIGNMENT, SWAP, EQUALITY, AND CAPACITY"
+                      << endl
+                      << "=============================================="
+                      << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        bslma::TestAllocator tb("other", veryVeryVerbose);
+
+        if (verbose) cout << "\nCopy construction and assignment." << endl;
+        {
+            for (int n = 0; n < 20; ++n) {
+                Obj mX(&ta);  const Obj& X = mX;
+                for (int i = 0; i < n; ++i) {
+                    mX[(i * 7) % 20] = i;
+                }
+
+                const Obj Y(X, &tb);
+                ASSERTV(n, X == Y);
+                ASSERTV(n, !(X != Y));
+                ASSERTV(n, &tb == Y.allocator());
+
+                Obj mZ(&tb);  const Obj& Z = mZ;
+                mZ[100] = 1;
+                ASSERTV(n, X != Z);
+
+                mZ = X;
+                ASSERTV(n, X == Z);
+                ASSERTV(n, &tb == Z.allocator());
+
+                if (n) {
+                    mZ.begin()->second += 1;
+                    ASSERTV(n, X != Z);
+                }
+            }
+
+            ModuloObj mX(ModuloLess(10), &ta);  const ModuloObj& X = mX;
+            mX[13] = 1;
+
+            const ModuloObj Y(X, &tb);
+            ASSERT(10 == Y.key_comp().d_divisor);
+            ASSERT(Y.contains(3));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == tb.numBlocksInUse());
+
+        if (verbose) cout << "\nSwap." << endl;
+        {
+            ModuloObj mX(ModuloLess(10), &ta);  const ModuloObj& X = mX;
+            ModuloObj mY(ModuloLess(7),  &ta);  const ModuloObj& Y = mY;
+
+            mX[1] = 1;
+            mX[2] = 2;
+            mY[3] = 3;
+
+            const ModuloObj XX(X, &ta);
+            const ModuloObj YY(Y, &ta);
+
+            bslma::TestAllocatorMonitor tam(&ta);
+
+            mX.swap(mY);
+            ASSERT(YY == X);
+            ASSERT(XX == Y);
+            ASSERT(7  == X.key_comp().d_divisor);
+            ASSERT(10 == Y.key_comp().d_divisor);
+
+            swap(mX, mY);
+            ASSERT(XX == X);
+            ASSERT(YY == Y);
+            ASSERT(10 == X.key_comp().d_divisor);
+            ASSERT(7  == Y.key_comp().d_divisor);
+
+            ASSERT(tam.isTotalSame());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nCapacity." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(0 == X.capacity());
+
+            mX.reserve(100);
+            ASSERT(100 <= X.capacity());
+            ASSERT(X.empty());
+
+            for (int i = 0; i < 10; ++i) {
+                mX[i] = i;
+            }
+            const Obj Y(X, &ta);
+
+            mX.shrink_to_fit();
+            ASSERT(10 == X.capacity());
+            ASSERT(Y  == X);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // INSERT, FIND, ERASE, BOUNDS, AND ITERATION
+        //
+        // Concerns:
+        //: 1 'insert' inserts only absent keys, and reports the element having
+        //:   the key.
+        //:
+        //: 2 'find', 'contains', and 'count' locate exactly the inserted keys,
+        //:   and values can be modified through iterators.
+        //:
+        //: 3 Each form of 'erase' removes the specified elements, and returns
+        //:   an iterator to the element that followed them.
+        //:
+        //: 4 'lower_bound' and 'upper_bound' return the first element whose
+        //:   key is not less than, and greater than, the key, respectively.
+        //:
+        //: 5 Iteration, through both iterator types, visits the elements in
+        //:   increasing order of their keys.
+        //:
+        //: 6 Random sequences of operations agree with 'bsl::map'.
+        //
+        // Plan:
+        //: 1 Perform each operation on maps of integers, and verify the
+        //:   results.  (C-1..5)
+        //:
+        //: 2 Apply random insertions, range insertions, assignments, and
+        //:   erasures to a map and to a 'bsl::map', and compare them.  (C-6)
+        //
+        // Testing:
+        //   iterator begin();
+        //   iterator end();
+        //   void clear();
+        //   size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   iterator find(const KEY& key);
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   iterator lower_bound(const KEY& key);
+        //   iterator upper_bound(const KEY& key);
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   bool contains(const KEY& key) const;
+        //   size_t count(const KEY& key) const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_iterator find(const KEY& key) const;
+        //   const_iterator lower_bound(const KEY& key) const;
+        //   const_iterator upper_bound(const KEY& key) const;
+        //   CONCERN: Random operations agree with 'bsl::map'.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INSERT, FIND, ERASE, BOUNDS, AND ITERATION"
+                          << endl
+                          << "=========================================="
+                          << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\nInsert and find." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 30; ++i) {
+                const int KEY = (i * 11) % 30;
+
+                bsl::pair<Obj::iterator, bool> result =
+                                                    mX.insert(Pair(KEY, i));
+                ASSERTV(i, result.second);
+                ASSERTV(i, KEY == result.first->first);
+                ASSERTV(i, i   == result.first->second);
+
+                result = mX.insert(Pair(KEY, -1));
+                ASSERTV(i, !result.second);
+                ASSERTV(i, i == result.first->second);
+                ASSERTV(i, i + 1 == static_cast<int>(X.size()));
+            }
+
+            for (int key = -5; key < 35; ++key) {
+                const bool PRESENT = 0 <= key && key < 30;
+
+                ASSERTV(key, PRESENT == X.contains(key));
+                ASSERTV(key, PRESENT == static_cast<int>(X.count(key)));
+                ASSERTV(key, PRESENT == (X.find(key) != X.end()));
+                ASSERTV(key, PRESENT == (mX.find(key) != mX.end()));
+                if (PRESENT) {
+                    ASSERTV(key, key == X.find(key)->first);
+                    ASSERTV(key, X.find(key) == mX.find(key));
+                }
+            }
+
+            mX.find(7)->second = 700;
+            ASSERT(700 == X.at(7));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nBounds and iteration." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 20; ++i) {
+                mX[2 * i] = i;
+            }
+
+            for (int key = -1; key < 42; ++key) {
+                const int LOWER = key < 0  ? 0
+                                : key > 38 ? 20
+                                :            (key + 1) / 2;
+                const int UPPER = key < 0  ? 0
+                                : key > 38 ? 20
+                                :            key / 2 + 1;
+
+                ASSERTV(key, X.begin() + LOWER == X.lower_bound(key));
+                ASSERTV(key, X.begin() + UPPER == X.upper_bound(key));
+                ASSERTV(key, mX.begin() + LOWER == mX.lower_bound(key));
+                ASSERTV(key, mX.begin() + UPPER == mX.upper_bound(key));
+            }
+
+            int expected = 0;
+            for (Obj::iterator it = mX.begin(); it != mX.end(); ++it) {
+                ASSERTV(expected, 2 * expected == it->first);
+                ASSERTV(expected, expected     == it->second);
+                ++expected;
+            }
+            ASSERT(20 == expected);
+
+            expected = 0;
+            for (Obj::const_iterator it = X.cbegin(); it != X.cend(); ++it) {
+                ASSERTV(expected, 2 * expected == it->first);
+                ++expected;
+            }
+            ASSERT(20 == expected);
+            ASSERT(X.begin() == X.cbegin());
+            ASSERT(X.end()   == X.cend());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nErase." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 20; ++i) {
+                mX[i] = i;
+            }
+
+            ASSERT(1 == mX.erase(5));
+            ASSERT(0 == mX.erase(5));
+            ASSERT(19 == X.size());
+            ASSERT(!X.contains(5));
+
+            Obj::iterator it = mX.erase(X.find(6));
+            ASSERT(7 == it->first);
+            ASSERT(18 == X.size());
+
+            it = mX.erase(X.find(10), X.find(15));
+            ASSERT(15 == it->first);
+            ASSERT(13 == X.size());
+            for (int key = 10; key < 15; ++key) {
+                ASSERTV(key, !X.contains(key));
+            }
+
+            it = mX.erase(X.find(19));
+            ASSERT(X.end() == it);
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(X.begin() == X.end());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nRange insertion." << endl;
+        {
+            const Pair VALUES[] = { Pair(8, 0), Pair(3, 1), Pair(5, 2),
+                                    Pair(3, 3), Pair(1, 4), Pair(9, 5) };
+            const int  NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            Obj mX(&ta);  const Obj& X = mX;
+            mX[5] = 100;
+
+            mX.insert(VALUES, VALUES + NUM_VALUES);
+            ASSERT(5 == X.size());
+            ASSERT(1 == X.at(3));
+            ASSERT(100 == X.at(5));
+
+            int previous = -1;
+            for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(previous, it->first, previous < it->first);
+                previous = it->first;
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nRandom operations." << endl;
+        {
+            Obj                mX(&ta);  const Obj& X = mX;
+            bsl::map<int, int> oracle(&ta);
+
+            srand(4);
+            for (int i = 0; i < 2000; ++i) {
+                const int KEY = rand() % 200;
+
+                switch (rand() % 4) {
+                  case 0: {
+                    mX.insert(Pair(KEY, i));
+                    oracle.insert(Pair(KEY, i));
+                  } break;
+                  case 1: {
+                    mX[KEY] = i;
+                    oracle[KEY] = i;
+                  } break;
+                  case 2: {
+                    ASSERTV(i, oracle.erase(KEY) == mX.erase(KEY));
+                  } break;
+                  case 3: {
+                    Pair values[8];
+                    for (int j = 0; j < 8; ++j) {
+                        values[j] = Pair(rand() % 200, i);
+                    }
+                    mX.insert(values, values + 8);
+                    oracle.insert(values, values + 8);
+                  } break;
+                }
+
+                ASSERTV(i, isEqualToOracle(X, oracle));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'operator[]' AND 'at'
+        //
+        // Concerns:
+        //: 1 'operator[]' inserts an element having a default value if the key
+        //:   is absent, and returns a reference to the value.
+        //:
+        //: 2 'at' returns a reference to the value of a present key, and
+        //:   throws 'bsl::out_of_range' for an absent key.
+        //:
+        //: 3 The keys and values of the elements, including the default value
+        //:   inserted by 'operator[]', use the map's allocator, and the
+        //:   default allocator is not used.
+        //:
+        //: 4 'operator[]' is exception neutral.
+        //
+        // Plan:
+        //: 1 Access keys of a map of strings with 'operator[]' and 'at', and
+        //:   verify the values and their allocators.  (C-1..3)
+        //:
+        //: 2 Insert with 'operator[]' under the
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST' macros.  (C-4)
+        //
+        // Testing:
+        //   VALUE& operator[](const KEY& key);
+        //   VALUE& at(const KEY& key);
+        //   const VALUE& at(const KEY& key) const;
+        //   CONCERN: Elements use the map's allocator.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'operator[]' AND 'at'" << endl
+                          << "=====================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            StringObj mX(&ta);  const StringObj& X = mX;
+
+            const int NUM_KEYS = 50;
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                char buffer[64];
+                sprintf(buffer,
+                        "a long key to defeat the short buffer %d",
+                        (i * 17) % NUM_KEYS);
+                const bsl::string KEY(buffer, &ta);
+
+                bsl::string& value = mX[KEY];
+                ASSERTV(i, value.empty());
+                ASSERTV(i, &ta == value.get_allocator().mechanism());
+
+                value = KEY;
+                ASSERTV(i, KEY == X.at(KEY));
+                ASSERTV(i, &mX[KEY] == &mX.at(KEY));
+                ASSERTV(i, &mX[KEY] == &X.at(KEY));
+            }
+            ASSERT(NUM_KEYS == X.size());
+
+            for (StringObj::const_iterator it = X.begin();
+                 it != X.end();
+                 ++it) {
+                ASSERT(&ta == it->first.get_allocator().mechanism());
+                ASSERT(&ta == it->second.get_allocator().mechanism());
+                ASSERT(it->first == it->second);
+            }
+
+#ifdef BDE_BUILD_TARGET_EXC
+            const bsl::string MISSING("missing", &ta);
+
+            bool caught = false;
+            try {
+                mX.at(MISSING);
+            }
+            catch (const bsl::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                X.at(MISSING);
+            }
+            catch (const bsl::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(NUM_KEYS == X.size());
+#endif
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nException neutrality." << endl;
+        {
+            StringObj mX(&ta);  const StringObj& X = mX;
+
+            for (int i = 0; i < 40; ++i) {
+                char buffer[64];
+                sprintf(buffer,
+                        "a long key to defeat the short buffer %d",
+                        (i * 7) % 40);
+                const bsl::string KEY(buffer, &ta);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                    ASSERTV(i, i == static_cast<int>(X.size()));
+                    ASSERTV(i, mX[KEY].empty());
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(i, i + 1 == static_cast<int>(X.size()));
+                ASSERTV(i, X.contains(KEY));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a map using the supplied allocator, or
+        //:   the default allocator if none is supplied.
+        //:
+        //: 2 The supplied comparator, or a default-constructed one, is
+        //:   retained and used to order the keys.
+        //:
+        //: 3 The range constructors accept unsorted ranges, and retain only
+        //:   the first element having each key.
+        //:
+        //: 4 The default and comparator constructors do not allocate.
+        //
+        // Plan:
+        //: 1 Create maps using each constructor, and verify their
+        //:   allocators, comparators, and elements.  (C-1..4)
+        //
+        // Testing:
+        //   explicit FlatMap(bslma::Allocator *basicAllocator = 0);
+        //   explicit FlatMap(const COMPARATOR& comparator, ba = 0);
+        //   FlatMap(INPUT_ITERATOR first, INPUT_ITERATOR last, ba = 0);
+        //   FlatMap(first, last, const COMPARATOR& comparator, ba = 0);
+        //   bool empty() const;
+        //   COMPARATOR key_comp() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTORS AND BASIC ACCESSORS" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        const Pair VALUES[] = { Pair(13, 0), Pair(4, 1), Pair(21, 2),
+                                Pair(4, 3),  Pair(0, 4), Pair(13, 5) };
+        const int  NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        if (verbose) cout << "\nDefault and comparator constructors." << endl;
+        {
+            const Obj X;
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+
+            const Obj Y(&ta);
+            ASSERT(&ta == Y.allocator());
+            ASSERT(Y.empty());
+
+            const ModuloObj Z(ModuloLess(10));
+            ASSERT(&defaultAllocator == Z.allocator());
+            ASSERT(10 == Z.key_comp().d_divisor);
+
+            const ModuloObj W(ModuloLess(7), &ta);
+            ASSERT(&ta == W.allocator());
+            ASSERT(7 == W.key_comp().d_divisor);
+            ASSERT(W.empty());
+
+            const ModuloObj V(&ta);
+            ASSERT(1000003 == V.key_comp().d_divisor);
+
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+            ASSERT(0 == ta.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nRange constructors." << endl;
+        {
+            const Obj X(VALUES, VALUES + NUM_VALUES, &ta);
+            ASSERT(&ta == X.allocator());
+            ASSERT(4 == X.size());
+            ASSERT(!X.empty());
+
+            const int EXP_KEYS[]   = { 0, 4, 13, 21 };
+            const int EXP_VALUES[] = { 4, 1,  0,  2 };
+            int       i            = 0;
+            for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(i, EXP_KEYS[i]   == it->first);
+                ASSERTV(i, EXP_VALUES[i] == it->second);
+                ++i;
+            }
+            ASSERT(4 == i);
+
+            const ModuloObj Y(VALUES,
+                              VALUES + NUM_VALUES,
+                              ModuloLess(10),
+                              &ta);
+            ASSERT(&ta == Y.allocator());
+            ASSERT(10 == Y.key_comp().d_divisor);
+            ASSERT(4 == Y.size());
+
+            const int EXP_MODULO_KEYS[] = { 0, 21, 13, 4 };
+            i = 0;
+            for (ModuloObj::const_iterator it = Y.begin();
+                 it != Y.end();
+                 ++it) {
+                ASSERTV(i, EXP_MODULO_KEYS[i] == it->first);
+                ++i;
+            }
+            ASSERT(4 == i);
+            ASSERT(Y.contains(31));  // 31 is equivalent to 21 modulo 10.
+
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+        {
+            const Obj X(VALUES, VALUES + NUM_VALUES);
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(4 == X.size());
+
+            const ModuloObj Y(VALUES, VALUES + NUM_VALUES, ModuloLess(10));
+            ASSERT(&defaultAllocator == Y.allocator());
+            ASSERT(4 == Y.size());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(X.empty());
+
+            mX[3] = 30;
+            mX[1] = 10;
+            mX[2] = 20;
+            ASSERT(3 == X.size());
+            ASSERT(1 == X.begin()->first);
+            ASSERT(20 == X.at(2));
+
+            ASSERT(1 == mX.erase(1));
+            ASSERT(2 == X.size());
+            ASSERT(2 == X.begin()->first);
+            ASSERT(X.end() == X.find(1));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: COMPARISON WITH 'bsl::map'
+        //
+        // Concerns:
+        //: 1 Loading a map from sorted data, lookups of present and absent
+        //:   keys, and iteration are faster than those of 'bsl::map'.
+        //
+        // Plan:
+        //: 1 Time each operation for maps of integers and of strings of
+        //:   several sizes, and print the time per operation.  The maximum
+        //:   size, in thousands, may be supplied as the second argument.
+        //:   (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: COMPARISON WITH 'bsl::map'
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST: COMPARISON WITH 'bsl::map'" << endl
+             << "============================================" << endl;
+
+        const int MAX_SIZE = 1000 * (argc > 2 ? atoi(argv[2]) : 1000);
+
+        printf("%-24s %9s %9s %9s %9s %9s\n",
+               "(ns per element)",
+               "size",
+               "load",
+               "hit",
+               "miss",
+               "iterate");
+
+        for (int size = 1000; size <= MAX_SIZE; size *= 10) {
+            bsl::vector<int> sortedKeys(ndAllocator());
+            bsl::vector<int> keys(ndAllocator());
+            bsl::vector<int> missingKeys(ndAllocator());
+
+            srand(size);
+            for (int i = 0; i < size; ++i) {
+                // Interleave present and missing keys, and shuffle the order
+                // of the lookups.
+
+                sortedKeys.push_back(2 * i);
+                keys.push_back(2 * i);
+                missingKeys.push_back(2 * i + 1);
+            }
+            for (int i = size - 1; i > 0; --i) {
+                const int j = rand() % (i + 1);
+                bsl::swap(keys[i], keys[j]);
+                bsl::swap(missingKeys[i], missingKeys[j]);
+            }
+
+            benchmark<bdlc::FlatMap<int, int> >("int: bdlc::FlatMap",
+                                                sortedKeys,
+                                                keys,
+                                                missingKeys);
+            benchmark<bsl::map<int, int> >("int: bsl::map",
+                                           sortedKeys,
+                                           keys,
+                                           missingKeys);
+
+            bsl::vector<bsl::string> sortedStringKeys(ndAllocator());
+            bsl::vector<bsl::string> stringKeys(ndAllocator());
+            bsl::vector<bsl::string> missingStringKeys(ndAllocator());
+            for (int i = 0; i < size; ++i) {
+                sortedStringKeys.push_back(makeKey(sortedKeys[i]));
+                stringKeys.push_back(makeKey(keys[i]));
+                missingStringKeys.push_back(makeKey(missingKeys[i]));
+            }
+
+            benchmark<bdlc::FlatMap<bsl::string, int> >(
+                                                  "string: bdlc::FlatMap",
+                                                  sortedStringKeys,
+                                                  stringKeys,
+                                                  missingStringKeys);
+            benchmark<bsl::map<bsl::string, int> >("string: bsl::map",
+                                                   sortedStringKeys,
+                                                   stringKeys,
+                                                   missingStringKeys);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,614 @@
+// bdlc_flatset.h                                                     -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATSET
+#define INCLUDED_BDLC_FLATSET
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered set container stored in a sorted vector.
+//
+//@CLASSES:
+//  bdlc::FlatSet: ordered set container stored in a sorted vector
+//
+//@SEE_ALSO: bdlc_flatmap, bdlc_flatsortedtable, bslstl_set
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::FlatSet', implementing an ordered set of unique keys.  The interface
+// of 'bdlc::FlatSet' is a subset of that of 'bsl::set'; its implementation is
+// the sorted vector described in 'bdlc_flatsortedtable', which stores the keys
+// in a single contiguous array and searches it with a branch-free binary
+// search.  See 'bdlc_flatmap' for a discussion of the performance
+// characteristics of the flat sorted containers; in particular, inserting or
+// erasing a single element takes linear time, and any insertion invalidates
+// all iterators, pointers, and references to its elements, so that these
+// containers are best suited to data that is built once and searched often.
+//
+///Memory Allocation
+///-----------------
+// A 'bdlc::FlatSet' uses the allocator supplied at construction (or the
+// currently installed default allocator) to supply memory for its array, and
+// passes it to the elements it creates if they use 'bslma' allocators.  The
+// unused capacity of the array, which may remain after a set is built, is
+// released by 'shrink_to_fit'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Dictionary of Reserved Words
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we wish to determine whether identifiers are reserved words.
+//
+// First, we create a set of the reserved words from an unsorted list:
+//..
+//  const char *WORDS[] = { "while", "if", "for", "return", "else", "do" };
+//  const int   NUM_WORDS = sizeof WORDS / sizeof *WORDS;
+//
+//  const bdlc::FlatSet<bsl::string> reserved(WORDS, WORDS + NUM_WORDS);
+//..
+// Then, we check some identifiers:
+//..
+//  assert(true  == reserved.contains("return"));
+//  assert(false == reserved.contains("count"));
+//..
+// Finally, we observe that the words are kept in order:
+//..
+//  assert("do"    == *reserved.begin());
+//  assert("while" == reserved.begin()[NUM_WORDS - 1]);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLC_FLATSORTEDTABLE
+#include <bdlc_flatsortedtable.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_CONSTRUCTIONUTIL
+#include <bslma_constructionutil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_FUNCTIONAL
+#include <bsl_functional.h>
+#endif
+
+#ifndef INCLUDED_BSL_UTILITY
+#include <bsl_utility.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                         // ========================
+                         // struct FlatSet_EntryUtil
+                         // ========================
+
+template <class KEY>
+struct FlatSet_EntryUtil {
+    // This component-private utility 'struct' provides the entry operations
+    // required by 'FlatSortedTable' for the entries of a 'FlatSet'.
+
+    // CLASS METHODS
+    static void constructFromKey(KEY              *address,
+                                 bslma::Allocator *allocator,
+                                 const KEY&        key);
+        // Construct at the specified 'address' a copy of the specified 'key',
+        // using the specified 'allocator' to supply memory.
+
+    static const KEY& key(const KEY& entry);
+        // Return the specified 'entry'.
+};
+
+                               // =============
+                               // class FlatSet
+                               // =============
+
+template <class KEY, class COMPARATOR = bsl::less<KEY> >
+class FlatSet {
+    // This class template implements a value-semantic ordered set of unique
+    // keys of type 'KEY', stored in a sorted vector.
+
+    // PRIVATE TYPES
+    typedef FlatSortedTable<KEY,
+                            KEY,
+                            FlatSet_EntryUtil<KEY>,
+                            COMPARATOR> ImplType;
+
+    // DATA
+    ImplType d_impl;  // underlying sorted table
+
+    // FRIENDS
+    template <class K, class C>
+    friend bool operator==(const FlatSet<K, C>&, const FlatSet<K, C>&);
+
+  public:
+    // TYPES
+    typedef KEY                                  key_type;
+    typedef KEY                                  value_type;
+    typedef COMPARATOR                           key_compare;
+    typedef bsl::size_t                          size_type;
+    typedef const value_type&                    reference;
+    typedef const value_type&                    const_reference;
+    typedef typename ImplType::const_iterator    iterator;
+    typedef typename ImplType::const_iterator    const_iterator;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatSet, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit FlatSet(bslma::Allocator *basicAllocator = 0);
+    explicit FlatSet(const COMPARATOR&  comparator,
+                     bslma::Allocator  *basicAllocator = 0);
+        // Create an empty set.  Optionally specify a 'comparator' used to
+        // order keys.  If 'comparator' is not supplied, a default-constructed
+        // 'COMPARATOR' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  No memory is allocated.
+
+    template <class INPUT_ITERATOR>
+    FlatSet(INPUT_ITERATOR    first,
+            INPUT_ITERATOR    last,
+            bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatSet(INPUT_ITERATOR     first,
+            INPUT_ITERATOR     last,
+            const COMPARATOR&  comparator,
+            bslma::Allocator  *basicAllocator = 0);
+        // Create a set holding the keys in the range '[first .. last)', in any
+        // order, ignoring duplicate keys.  Optionally specify a 'comparator'
+        // used to order keys.  If 'comparator' is not supplied, a
+        // default-constructed 'COMPARATOR' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The range is
+        // sorted once, so that this operation takes 'O(N * log(N))' time for
+        // 'N' keys, or 'O(N)' time if the range is already sorted.
+
+    FlatSet(const FlatSet& original, bslma::Allocator *basicAllocator = 0);
+        // Create a set having the same value and comparator as the specified
+        // 'original'.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    //! ~FlatSet() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! FlatSet& operator=(const FlatSet& rhs) = default;
+        // Assign to this set the value and comparator of the specified 'rhs',
+        // and return a reference providing modifiable access to this set.
+
+    void clear();
+        // Remove all elements from this set.  Note that the capacity of the
+        // set is unchanged.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove the specified 'key' from this set, if present.  Return the
+        // number of elements removed (0 or 1).
+
+    const_iterator erase(const_iterator position);
+        // Remove the element at the specified 'position' from this set, and
+        // return an iterator to the element following it.  The behavior is
+        // undefined unless 'position' refers to an element of this set.
+
+    const_iterator erase(const_iterator first, const_iterator last);
+        // Remove the elements in the range '[first .. last)' from this set,
+        // and return an iterator to the element following the last one
+        // removed.  The behavior is undefined unless '[first .. last)' is a
+        // valid range of elements of this set.
+
+    bsl::pair<const_iterator, bool> insert(const KEY& key);
+        // Insert a copy of the specified 'key' into this set if it is not
+        // already present.  Return a pair whose 'first' member refers to the
+        // element equivalent to 'key', and whose 'second' member is 'true' if
+        // 'key' was inserted, and 'false' otherwise.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert copies of the keys in the range '[first .. last)', in any
+        // order, that are not already in this set.  This operation takes
+        // 'O(M * log(M) + N)' time for 'M' keys in the range and 'N' elements
+        // in this set.
+
+    void reserve(bsl::size_t numElements);
+        // Increase the capacity of this set, if needed, so that it can hold
+        // the specified 'numElements' without reallocating.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this set, if possible, to its size.
+
+    void swap(FlatSet& other);
+        // Exchange the value and comparator of this set with those of the
+        // specified 'other'.  The behavior is undefined unless this set and
+        // 'other' use the same allocator.
+
+    // ACCESSORS
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator to the first element of this set, or the
+        // past-the-end iterator if this set is empty.
+
+    bsl::size_t capacity() const;
+        // Return the number of elements this set can hold without
+        // reallocating.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this set contains the specified 'key', and 'false'
+        // otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements equivalent to the specified 'key' (0
+        // or 1).
+
+    bool empty() const;
+        // Return 'true' if this set has no elements, and 'false' otherwise.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator of this set.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator to the element equivalent to the specified 'key',
+        // or the past-the-end iterator if this set has no such element.
+
+    COMPARATOR key_comp() const;
+        // Return (a copy of) the key comparator of this set.
+
+    const_iterator lower_bound(const KEY& key) const;
+        // Return an iterator to the first element not ordered before the
+        // specified 'key', or the past-the-end iterator if there is no such
+        // element.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this set.
+
+    const_iterator upper_bound(const KEY& key) const;
+        // Return an iterator to the first element ordered after the specified
+        // 'key', or the past-the-end iterator if there is no such element.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this set to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR>
+bool operator==(const FlatSet<KEY, COMPARATOR>& lhs,
+                const FlatSet<KEY, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' sets have the same value,
+    // and 'false' otherwise.  Two sets have the same value if they have the
+    // same number of elements, and each element of 'lhs' is equal to the
+    // element at the same position in 'rhs'.
+
+template <class KEY, class COMPARATOR>
+bool operator!=(const FlatSet<KEY, COMPARATOR>& lhs,
+                const FlatSet<KEY, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' sets do not have the same
+    // value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR>
+void swap(FlatSet<KEY, COMPARATOR>& a, FlatSet<KEY, COMPARATOR>& b);
+    // Exchange the values of the specified 'a' and 'b' sets.  The behavior is
+    // undefined unless 'a' and 'b' use the same allocator.
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                         // ------------------------
+                         // struct FlatSet_EntryUtil
+                         // ------------------------
+
+// CLASS METHODS
+template <class KEY>
+inline
+void FlatSet_EntryUtil<KEY>::constructFromKey(KEY              *address,
+                                              bslma::Allocator *allocator,
+                                              const KEY&        key)
+{
+    bslma::ConstructionUtil::construct(address, allocator, key);
+}
+
+template <class KEY>
+inline
+const KEY& FlatSet_EntryUtil<KEY>::key(const KEY& entry)
+{
+    return entry;
+}
+
+                               // -------------
+                               // class FlatSet
+                               // -------------
+
+// CREATORS
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(bslma::Allocator *basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(const COMPARATOR&  comparator,
+                                  bslma::Allocator  *basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(INPUT_ITERATOR    first,
+                                  INPUT_ITERATOR    last,
+                                  bslma::Allocator *basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+    d_impl.insert(first, last);
+}
+
+template <class KEY, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(INPUT_ITERATOR     first,
+                                  INPUT_ITERATOR     last,
+                                  const COMPARATOR&  comparator,
+                                  bslma::Allocator  *basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+    d_impl.insert(first, last);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(const FlatSet&    original,
+                                  bslma::Allocator *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR>
+inline
+void FlatSet<KEY, COMPARATOR>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t FlatSet<KEY, COMPARATOR>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::erase(const_iterator position)
+{
+    return d_impl.erase(position);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::erase(const_iterator first, const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::pair<typename FlatSet<KEY, COMPARATOR>::const_iterator, bool>
+FlatSet<KEY, COMPARATOR>::insert(const KEY& key)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.insert(key);
+
+    return bsl::pair<const_iterator, bool>(result.first, result.second);
+}
+
+template <class KEY, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+void FlatSet<KEY, COMPARATOR>::insert(INPUT_ITERATOR first,
+                                      INPUT_ITERATOR last)
+{
+    d_impl.insert(first, last);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+void FlatSet<KEY, COMPARATOR>::reserve(bsl::size_t numElements)
+{
+    d_impl.reserve(numElements);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+void FlatSet<KEY, COMPARATOR>::shrink_to_fit()
+{
+    d_impl.shrinkToFit();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+void FlatSet<KEY, COMPARATOR>::swap(FlatSet& other)
+{
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t FlatSet<KEY, COMPARATOR>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool FlatSet<KEY, COMPARATOR>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t FlatSet<KEY, COMPARATOR>::count(const KEY& key) const
+{
+    return d_impl.count(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool FlatSet<KEY, COMPARATOR>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::cend() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+COMPARATOR FlatSet<KEY, COMPARATOR>::key_comp() const
+{
+    return d_impl.key_comp();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::lower_bound(const KEY& key) const
+{
+    return d_impl.lowerBound(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t FlatSet<KEY, COMPARATOR>::size() const
+{
+    return d_impl.size();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::upper_bound(const KEY& key) const
+{
+    return d_impl.upperBound(key);
+}
+
+                                  // Aspects
+
+template <class KEY, class COMPARATOR>
+inline
+bslma::Allocator *FlatSet<KEY, COMPARATOR>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR>
+inline
+bool bdlc::operator==(const FlatSet<KEY, COMPARATOR>& lhs,
+                      const FlatSet<KEY, COMPARATOR>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool bdlc::operator!=(const FlatSet<KEY, COMPARATOR>& lhs,
+                      const FlatSet<KEY, COMPARATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR>
+inline
+void bdlc::swap(FlatSet<KEY, COMPARATOR>& a, FlatSet<KEY, COMPARATOR>& b)
+{
+    a.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
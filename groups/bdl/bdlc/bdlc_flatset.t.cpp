@@ -0,0 +1,771 @@
+// bdlc_flatset.t.cpp                                                 -*-C++-*-
+#include <bdlc_flatset.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsl_cstdio.h>      // 'sprintf', 'printf' (needed by exception
+                             // macros)
+#include <bsl_cstdlib.h>     // 'atoi', 'rand'
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlc::FlatSet' is a thin adapter of 'bdlc::FlatSortedTable', which is
+// tested thoroughly in its own component.  We must verify that each method
+// forwards to the appropriate method of the table, that the comparator is
+// retained, and that elements are constructed with the set's allocator.  We
+// also compare the set with a 'bsl::set' oracle over random operations.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit FlatSet(bslma::Allocator *basicAllocator = 0);
+// [ 2] explicit FlatSet(const COMPARATOR& comparator, ba = 0);
+// [ 2] FlatSet(INPUT_ITERATOR first, INPUT_ITERATOR last, ba = 0);
+// [ 2] FlatSet(first, last, const COMPARATOR& comparator, ba = 0);
+// [ 4] FlatSet(const FlatSet& original, ba = 0);
+//
+// MANIPULATORS
+// [ 4] FlatSet& operator=(const FlatSet& rhs);
+// [ 3] void clear();
+// [ 3] size_t erase(const KEY& key);
+// [ 3] const_iterator erase(const_iterator position);
+// [ 3] const_iterator erase(const_iterator first, const_iterator last);
+// [ 3] pair<const_iterator, bool> insert(const KEY& key);
+// [ 3] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 4] void reserve(size_t numElements);
+// [ 4] void shrink_to_fit();
+// [ 4] void swap(FlatSet& other);
+//
+// ACCESSORS
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator cbegin() const;
+// [ 4] size_t capacity() const;
+// [ 3] bool contains(const KEY& key) const;
+// [ 3] size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 3] const_iterator end() const;
+// [ 3] const_iterator cend() const;
+// [ 3] const_iterator find(const KEY& key) const;
+// [ 2] COMPARATOR key_comp() const;
+// [ 3] const_iterator lower_bound(const KEY& key) const;
+// [ 2] size_t size() const;
+// [ 3] const_iterator upper_bound(const KEY& key) const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const FlatSet& lhs, const FlatSet& rhs);
+// [ 4] bool operator!=(const FlatSet& lhs, const FlatSet& rhs);
+//
+// FREE FUNCTIONS
+// [ 4] void swap(FlatSet& a, FlatSet& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: Elements use the set's allocator.
+// [ 3] CONCERN: Random operations agree with 'bsl::set'.
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatSet<int>         Obj;
+typedef bdlc::FlatSet<bsl::string> StringObj;
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct ModuloLess {
+    // This comparator orders its arguments by their values modulo a divisor
+    // supplied at construction, and is used to verify that comparators are
+    // retained.
+
+    int d_divisor;
+
+    explicit ModuloLess(int divisor = 1000003)
+        // Create a comparator having the optionally specified 'divisor'.
+    : d_divisor(divisor)
+    {
+    }
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' modulo the divisor of this
+        // comparator is less than the specified 'rhs' modulo the divisor, and
+        // 'false' otherwise.
+    {
+        return lhs % d_divisor < rhs % d_divisor;
+    }
+};
+
+typedef bdlc::FlatSet<int, ModuloLess> ModuloObj;
+
+bool isEqualToOracle(const Obj& set, const bsl::set<int>& oracle)
+    // Return 'true' if the specified 'set' has the same elements, in the same
+    // order, as the specified 'oracle', and 'false' otherwise.
+{
+    if (set.size() != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+
+    bsl::set<int>::const_iterator jt = oracle.begin();
+    for (Obj::const_iterator it = set.begin(); it != set.end(); ++it, ++jt) {
+        if (*it != *jt) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test            = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose         = argc > 2;
+    const bool veryVerbose     = argc > 3;
+    const bool veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Dictionary of Reserved Words
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we wish to determine whether identifiers are reserved words.
+//
+// First, we create a set of the reserved words from an unsorted list:
+//..
+    const char *WORDS[] = { "while", "if", "for", "return", "else", "do" };
+    const int   NUM_WORDS = sizeof WORDS / sizeof *WORDS;
+
+    const bdlc::FlatSet<bsl::string> reserved(WORDS, WORDS + NUM_WORDS);
+//..
+// Then, we check some identifiers:
+//..
+    ASSERT(true  == reserved.contains("return"));
+    ASSERT(false == reserved.contains("count"));
+//..
+// Finally, we observe that the words are kept in order:
+//..
+    ASSERT("do"    == *reserved.begin());
+    ASSERT("while" == reserved.begin()[NUM_WORDS - 1]);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, EQUALITY, AND CAPACITY
+        //
+        // Concerns:
+        //: 1 The copy constructor creates an equal set using the supplied
+        //:   allocator, and retains the comparator.
+        //:
+        //: 2 Assignment makes the target equal to the source.
+        //:
+        //: 3 The member and free 'swap' functions exchange the values and
+        //:   comparators of two sets without allocating.
+        //:
+        //: 4 'operator==' and 'operator!=' compare the elements of the sets.
+        //:
+        //: 5 'reserve' ensures the capacity, and 'shrink_to_fit' reduces the
+        //:   capacity to the size, without changing the value.
+        //
+        // Plan:
+        //: 1 Copy, assign, swap, and compare sets of various values, and
+        //:   verify the results.  (C-1..4)
+        //:
+        //: 2 Reserve and shrink a set, and verify its capacity.  (C-5)
+        //
+        // Testing:
+        //   FlatSet(const FlatSet& original, ba = 0);
+        //   FlatSet& operator=(const FlatSet& rhs);
+        //   void reserve(size_t numElements);
+        //   void shrink_to_fit();
+        //   void swap(FlatSet& other);
+        //   size_t capacity() const;
+        //   bool operator==(const FlatSet& lhs, const FlatSet& rhs);
+        //   bool operator!=(const FlatSet& lhs, const FlatSet& rhs);
+        //   void swap(FlatSet& a, FlatSet& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "COPY, ASSIGNMENT, SWAP, EQUALITY, AND CAPACITY"
+                      << endl
+                      << "=============================================="
+                      << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        bslma::TestAllocator tb("other", veryVeryVerbose);
+
+        if (verbose) cout << "\nCopy construction and assignment." << endl;
+        {
+            for (int n = 0; n < 20; ++n) {
+                Obj mX(&ta);  const Obj& X = mX;
+                for (int i = 0; i < n; ++i) {
+                    mX.insert((i * 7) % 20);
+                }
+
+                const Obj Y(X, &tb);
+                ASSERTV(n, X == Y);
+                ASSERTV(n, !(X != Y));
+                ASSERTV(n, &tb == Y.allocator());
+
+                Obj mZ(&tb);  const Obj& Z = mZ;
+                mZ.insert(100);
+                ASSERTV(n, X != Z);
+
+                mZ = X;
+                ASSERTV(n, X == Z);
+                ASSERTV(n, &tb == Z.allocator());
+
+                mZ.insert(n + 20);
+                ASSERTV(n, X != Z);
+            }
+
+            ModuloObj mX(ModuloLess(10), &ta);  const ModuloObj& X = mX;
+            mX.insert(13);
+
+            const ModuloObj Y(X, &tb);
+            ASSERT(10 == Y.key_comp().d_divisor);
+            ASSERT(Y.contains(3));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == tb.numBlocksInUse());
+
+        if (verbose) cout << "\nSwap." << endl;
+        {
+            ModuloObj mX(ModuloLess(10), &ta);  const ModuloObj& X = mX;
+            ModuloObj mY(ModuloLess(7),  &ta);  const ModuloObj& Y = mY;
+
+            mX.insert(1);
+            mX.insert(2);
+            mY.insert(3);
+
+            const ModuloObj XX(X, &ta);
+            const ModuloObj YY(Y, &ta);
+
+            bslma::TestAllocatorMonitor tam(&ta);
+
+            mX.swap(mY);
+            ASSERT(YY == X);
+            ASSERT(XX == Y);
+            ASSERT(7  == X.key_comp().d_divisor);
+            ASSERT(10 == Y.key_comp().d_divisor);
+
+            swap(mX, mY);
+            ASSERT(XX == X);
+            ASSERT(YY == Y);
+            ASSERT(10 == X.key_comp().d_divisor);
+            ASSERT(7  == Y.key_comp().d_divisor);
+
+            ASSERT(tam.isTotalSame());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nCapacity." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(0 == X.capacity());
+
+            mX.reserve(100);
+            ASSERT(100 <= X.capacity());
+            ASSERT(X.empty());
+
+            for (int i = 0; i < 10; ++i) {
+                mX.insert(i);
+            }
+            const Obj Y(X, &ta);
+
+            mX.shrink_to_fit();
+            ASSERT(10 == X.capacity());
+            ASSERT(Y  == X);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INSERT, FIND, ERASE, BOUNDS, AND ITERATION
+        //
+        // Concerns:
+        //: 1 'insert' inserts only absent keys, and reports the element equal
+        //:   to the key.
+        //:
+        //: 2 'find', 'contains', and 'count' locate exactly the inserted keys.
+        //:
+        //: 3 Each form of 'erase' removes the specified elements, and returns
+        //:   an iterator to the element that followed them.
+        //:
+        //: 4 'lower_bound' and 'upper_bound' return the first element not
+        //:   less than, and greater than, the key, respectively.
+        //:
+        //: 5 Iteration visits the elements in increasing order.
+        //:
+        //: 6 Elements use the set's allocator, and the default allocator is
+        //:   not used.
+        //:
+        //: 7 Random sequences of operations agree with 'bsl::set'.
+        //
+        // Plan:
+        //: 1 Perform each operation on sets of integers and strings, and
+        //:   verify the results.  (C-1..6)
+        //:
+        //: 2 Apply random insertions, range insertions, and erasures to a set
+        //:   and to a 'bsl::set', and compare them.  (C-7)
+        //
+        // Testing:
+        //   void clear();
+        //   size_t erase(const KEY& key);
+        //   const_iterator erase(const_iterator position);
+        //   const_iterator erase(const_iterator first, const_iterator last);
+        //   pair<const_iterator, bool> insert(const KEY& key);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   bool contains(const KEY& key) const;
+        //   size_t count(const KEY& key) const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_iterator find(const KEY& key) const;
+        //   const_iterator lower_bound(const KEY& key) const;
+        //   const_iterator upper_bound(const KEY& key) const;
+        //   CONCERN: Elements use the set's allocator.
+        //   CONCERN: Random operations agree with 'bsl::set'.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INSERT, FIND, ERASE, BOUNDS, AND ITERATION"
+                          << endl
+                          << "=========================================="
+                          << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\nInsert and find." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 30; ++i) {
+                const int KEY = (i * 11) % 30;
+
+                bsl::pair<Obj::const_iterator, bool> result = mX.insert(KEY);
+                ASSERTV(i, result.second);
+                ASSERTV(i, KEY == *result.first);
+
+                result = mX.insert(KEY);
+                ASSERTV(i, !result.second);
+                ASSERTV(i, KEY == *result.first);
+                ASSERTV(i, i + 1 == static_cast<int>(X.size()));
+            }
+
+            for (int key = -5; key < 35; ++key) {
+                const bool PRESENT = 0 <= key && key < 30;
+
+                ASSERTV(key, PRESENT == X.contains(key));
+                ASSERTV(key, PRESENT == static_cast<int>(X.count(key)));
+                ASSERTV(key, PRESENT == (X.find(key) != X.end()));
+                if (PRESENT) {
+                    ASSERTV(key, key == *X.find(key));
+                }
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nBounds and iteration." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            for (int i = 19; i >= 0; --i) {
+                mX.insert(2 * i);
+            }
+
+            for (int key = -1; key < 42; ++key) {
+                const int LOWER = key < 0  ? 0
+                                : key > 38 ? 20
+                                :            (key + 1) / 2;
+                const int UPPER = key < 0  ? 0
+                                : key > 38 ? 20
+                                :            key / 2 + 1;
+
+                ASSERTV(key, X.begin() + LOWER == X.lower_bound(key));
+                ASSERTV(key, X.begin() + UPPER == X.upper_bound(key));
+            }
+
+            int expected = 0;
+            for (Obj::const_iterator it = X.cbegin(); it != X.cend(); ++it) {
+                ASSERTV(expected, 2 * expected == *it);
+                ++expected;
+            }
+            ASSERT(20 == expected);
+            ASSERT(X.begin() == X.cbegin());
+            ASSERT(X.end()   == X.cend());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nErase." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 20; ++i) {
+                mX.insert(i);
+            }
+
+            ASSERT(1 == mX.erase(5));
+            ASSERT(0 == mX.erase(5));
+            ASSERT(19 == X.size());
+            ASSERT(!X.contains(5));
+
+            Obj::const_iterator it = mX.erase(X.find(6));
+            ASSERT(7 == *it);
+            ASSERT(18 == X.size());
+
+            it = mX.erase(X.find(10), X.find(15));
+            ASSERT(15 == *it);
+            ASSERT(13 == X.size());
+            for (int key = 10; key < 15; ++key) {
+                ASSERTV(key, !X.contains(key));
+            }
+
+            it = mX.erase(X.find(19));
+            ASSERT(X.end() == it);
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(X.begin() == X.end());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nAllocator of elements." << endl;
+        {
+            StringObj mX(&ta);  const StringObj& X = mX;
+
+            for (int i = 0; i < 20; ++i) {
+                char buffer[64];
+                sprintf(buffer,
+                        "a long key to defeat the short buffer %d",
+                        (i * 7) % 20);
+                const bsl::string KEY(buffer, &ta);
+
+                mX.insert(KEY);
+            }
+
+            const bsl::string KEYS[] = {
+                bsl::string("a long key to defeat the short buffer x", &ta),
+                bsl::string("a long key to defeat the short buffer 3", &ta),
+                bsl::string("a long key to defeat the short buffer y", &ta),
+            };
+            mX.insert(KEYS, KEYS + 3);
+            ASSERT(22 == X.size());
+
+            for (StringObj::const_iterator it = X.begin();
+                 it != X.end();
+                 ++it) {
+                ASSERT(&ta == it->get_allocator().mechanism());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nRandom operations." << endl;
+        {
+            Obj           mX(&ta);  const Obj& X = mX;
+            bsl::set<int> oracle(&ta);
+
+            srand(4);
+            for (int i = 0; i < 2000; ++i) {
+                const int KEY = rand() % 200;
+
+                switch (rand() % 3) {
+                  case 0: {
+                    ASSERTV(i, oracle.insert(KEY).second ==
+                                                       mX.insert(KEY).second);
+                  } break;
+                  case 1: {
+                    ASSERTV(i, oracle.erase(KEY) == mX.erase(KEY));
+                  } break;
+                  case 2: {
+                    int values[8];
+                    for (int j = 0; j < 8; ++j) {
+                        values[j] = rand() % 200;
+                    }
+                    mX.insert(values, values + 8);
+                    oracle.insert(values, values + 8);
+                  } break;
+                }
+
+                ASSERTV(i, isEqualToOracle(X, oracle));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a set using the supplied allocator, or
+        //:   the default allocator if none is supplied.
+        //:
+        //: 2 The supplied comparator, or a default-constructed one, is
+        //:   retained and used to order the keys.
+        //:
+        //: 3 The range constructors accept unsorted ranges having duplicates.
+        //:
+        //: 4 The default and comparator constructors do not allocate.
+        //
+        // Plan:
+        //: 1 Create sets using each constructor, and verify their
+        //:   allocators, comparators, and elements.  (C-1..4)
+        //
+        // Testing:
+        //   explicit FlatSet(bslma::Allocator *basicAllocator = 0);
+        //   explicit FlatSet(const COMPARATOR& comparator, ba = 0);
+        //   FlatSet(INPUT_ITERATOR first, INPUT_ITERATOR last, ba = 0);
+        //   FlatSet(first, last, const COMPARATOR& comparator, ba = 0);
+        //   bool empty() const;
+        //   COMPARATOR key_comp() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTORS AND BASIC ACCESSORS" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        const int VALUES[]   = { 13, 4, 21, 4, 0, 13 };
+        const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        if (verbose) cout << "\nDefault and comparator constructors." << endl;
+        {
+            const Obj X;
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+
+            const Obj Y(&ta);
+            ASSERT(&ta == Y.allocator());
+            ASSERT(Y.empty());
+
+            const ModuloObj Z(ModuloLess(10));
+            ASSERT(&defaultAllocator == Z.allocator());
+            ASSERT(10 == Z.key_comp().d_divisor);
+
+            const ModuloObj W(ModuloLess(7), &ta);
+            ASSERT(&ta == W.allocator());
+            ASSERT(7 == W.key_comp().d_divisor);
+            ASSERT(W.empty());
+
+            const ModuloObj V(&ta);
+            ASSERT(1000003 == V.key_comp().d_divisor);
+
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+            ASSERT(0 == ta.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nRange constructors." << endl;
+        {
+            const Obj X(VALUES, VALUES + NUM_VALUES, &ta);
+            ASSERT(&ta == X.allocator());
+            ASSERT(4 == X.size());
+            ASSERT(!X.empty());
+
+            const int EXP[] = { 0, 4, 13, 21 };
+            int       i     = 0;
+            for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(i, EXP[i] == *it);
+                ++i;
+            }
+            ASSERT(4 == i);
+
+            const ModuloObj Y(VALUES,
+                              VALUES + NUM_VALUES,
+                              ModuloLess(10),
+                              &ta);
+            ASSERT(&ta == Y.allocator());
+            ASSERT(10 == Y.key_comp().d_divisor);
+            ASSERT(4 == Y.size());
+
+            const int EXP_MODULO[] = { 0, 21, 13, 4 };
+            i = 0;
+            for (ModuloObj::const_iterator it = Y.begin();
+                 it != Y.end();
+                 ++it) {
+                ASSERTV(i, EXP_MODULO[i] == *it);
+                ++i;
+            }
+            ASSERT(4 == i);
+            ASSERT(Y.contains(31));  // 31 is equivalent to 21 modulo 10.
+
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+        {
+            const Obj X(VALUES, VALUES + NUM_VALUES);
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(4 == X.size());
+
+            const ModuloObj Y(VALUES, VALUES + NUM_VALUES, ModuloLess(10));
+            ASSERT(&defaultAllocator == Y.allocator());
+            ASSERT(4 == Y.size());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(X.empty());
+
+            ASSERT(mX.insert(3).second);
+            ASSERT(mX.insert(1).second);
+            ASSERT(mX.insert(2).second);
+            ASSERT(!mX.insert(2).second);
+            ASSERT(3 == X.size());
+            ASSERT(1 == *X.begin());
+            ASSERT(X.contains(2));
+
+            ASSERT(1 == mX.erase(1));
+            ASSERT(2 == X.size());
+            ASSERT(2 == *X.begin());
+            ASSERT(X.end() == X.find(1));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1034 @@
+// bdlc_flatsortedtable.h                                             -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATSORTEDTABLE
+#define INCLUDED_BDLC_FLATSORTEDTABLE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a sorted table of unique keys stored in a vector.
+//
+//@CLASSES:
+//  bdlc::FlatSortedTable: sorted, contiguous table of entries
+//  bdlc::FlatSortedTable_EntryComparator: orders entries by their keys
+//
+//@SEE_ALSO: bdlc_flatmap, bdlc_flatset
+//
+//@DESCRIPTION: This component provides a value-semantic class template,
+// 'bdlc::FlatSortedTable', implementing a table of entries having unique keys,
+// kept sorted by key in a 'bsl::vector', on which the 'bdlc::FlatMap' and
+// 'bdlc::FlatSet' containers are built.  Clients should use those containers
+// rather than this component directly.
+//
+// Unlike 'bsl::map', which allocates each element in a separate node of a
+// red-black tree, a 'bdlc::FlatSortedTable' stores its entries in a single
+// contiguous array, ordered by key.  A lookup is a binary search of the array;
+// the search is written so that each step selects the half of the remaining
+// range with a conditional move rather than a branch, which avoids the branch
+// mispredictions that dominate the cost of a conventional binary search over
+// a table that fits in cache.  Iteration visits consecutive memory.  The
+// memory overhead of the table is that of a single 'bsl::vector', plus any
+// unused capacity, which 'shrinkToFit' releases.
+//
+// The price paid for this performance is that inserting or erasing a single
+// entry moves all of the entries that follow it, which is linear in the size
+// of the table.  The table is therefore intended for data that is built once
+// (or rarely) and then searched many times.  A range of entries is inserted
+// efficiently, regardless of its order: the new entries are appended, sorted
+// once (unless they are already sorted), and merged with the existing entries,
+// with a complexity of 'O(M * log(M) + N)' for 'M' new and 'N' existing
+// entries.
+//
+// The table is parameterized by the 'KEY' type, the 'ENTRY' type stored in the
+// table (e.g., 'KEY' for a set, or a 'bsl::pair' of a 'KEY' and a value for a
+// map), an 'ENTRY_UTIL' type providing the key of an entry and the means to
+// construct an entry from a key, and the 'COMPARATOR' functor defining a
+// strict weak ordering of keys.  The 'ENTRY_UTIL' type must provide the
+// following static member functions:
+//..
+//  static const KEY& key(const ENTRY& entry);
+//      // Return the key of the specified 'entry'.
+//
+//  static void constructFromKey(ENTRY            *address,
+//                               bslma::Allocator *allocator,
+//                               const KEY&        key);
+//      // Construct at the specified 'address' an entry having the specified
+//      // 'key' (and a default value, if any), using the specified
+//      // 'allocator' to supply memory.
+//..
+//
+///Iterator, Pointer, and Reference Invalidation
+///---------------------------------------------
+// Any insertion invalidates all iterators, pointers, and references to
+// entries.  Erasing an entry invalidates iterators, pointers, and references
+// to that entry and to the entries that follow it.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Implementing a Sorted Set of Integers
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we wish to implement a simple sorted set of 'int' values on a
+// 'bdlc::FlatSortedTable'.
+//
+// First, we define the entry utility for an entry that is its own key:
+//..
+//  struct IntEntryUtil {
+//      static const int& key(const int& entry)
+//      {
+//          return entry;
+//      }
+//
+//      static void constructFromKey(int              *address,
+//                                   bslma::Allocator *,
+//                                   const int&        key)
+//      {
+//          *address = key;
+//      }
+//  };
+//..
+// Then, we create a table of 'int' entries, inserting a range of unsorted
+// values having a duplicate:
+//..
+//  typedef bdlc::FlatSortedTable<int,
+//                                int,
+//                                IntEntryUtil,
+//                                bsl::less<int> > IntTable;
+//
+//  const int VALUES[] = { 8, 3, 5, 3, 1 };
+//
+//  IntTable table((bsl::less<int>()));
+//  table.insert(VALUES, VALUES + 5);
+//
+//  assert(4 == table.size());
+//..
+// Next, we observe that the entries are sorted:
+//..
+//  assert(1 == table.begin()[0]);
+//  assert(3 == table.begin()[1]);
+//  assert(5 == table.begin()[2]);
+//  assert(8 == table.begin()[3]);
+//..
+// Finally, we search the table:
+//..
+//  assert(table.end() != table.find(5));
+//  assert(table.end() == table.find(4));
+//  assert(5 == *table.lowerBound(4));
+//  assert(8 == *table.upperBound(5));
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DESTRUCTORGUARD
+#include <bslma_destructorguard.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_EXCEPTIONUTIL
+#include <bsls_exceptionutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_OBJECTBUFFER
+#include <bsls_objectbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSL_ALGORITHM
+#include <bsl_algorithm.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTRING
+#include <bsl_cstring.h>
+#endif
+
+#ifndef INCLUDED_BSL_UTILITY
+#include <bsl_utility.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                   // =====================================
+                   // class FlatSortedTable_EntryComparator
+                   // =====================================
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+class FlatSortedTable_EntryComparator {
+    // This component-private class provides a functor ordering entries by
+    // their keys, using a comparator held by reference.
+
+    // DATA
+    const COMPARATOR *d_comparator_p;  // key comparator (held, not owned)
+
+  public:
+    // CREATORS
+    explicit FlatSortedTable_EntryComparator(const COMPARATOR& comparator);
+        // Create a functor ordering entries using the specified 'comparator'.
+        // The behavior is undefined unless 'comparator' outlives this object.
+
+    // ACCESSORS
+    bool operator()(const ENTRY& lhs, const ENTRY& rhs) const;
+        // Return 'true' if the key of the specified 'lhs' is ordered before
+        // the key of the specified 'rhs', and 'false' otherwise.
+
+    bool operator()(const ENTRY *lhs, const ENTRY *rhs) const;
+        // Return 'true' if the key of the entry at the specified 'lhs' address
+        // is ordered before the key of the entry at the specified 'rhs'
+        // address, or if the keys are equivalent and 'lhs < rhs', and 'false'
+        // otherwise.
+};
+
+                           // =====================
+                           // class FlatSortedTable
+                           // =====================
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+class FlatSortedTable {
+    // This class template implements a table of 'ENTRY' objects having unique
+    // keys of type 'KEY', sorted by key in a contiguous array.  See the
+    // component-level documentation for the requirements on the template
+    // parameters.
+
+    // PRIVATE TYPES
+    typedef bsl::vector<ENTRY>                            Vector;
+    typedef FlatSortedTable_EntryComparator<KEY,
+                                            ENTRY,
+                                            ENTRY_UTIL,
+                                            COMPARATOR>   EntryComparator;
+
+  public:
+    // TYPES
+    typedef KEY                                           key_type;
+    typedef ENTRY                                         value_type;
+    typedef COMPARATOR                                    key_compare;
+    typedef bsl::size_t                                   size_type;
+    typedef typename Vector::iterator                     iterator;
+    typedef typename Vector::const_iterator               const_iterator;
+
+  private:
+    // DATA
+    Vector     d_entries;     // entries, sorted by key
+    COMPARATOR d_comparator;  // key comparator
+
+    // FRIENDS
+    template <class K, class E, class U, class C>
+    friend bool operator==(const FlatSortedTable<K, E, U, C>&,
+                           const FlatSortedTable<K, E, U, C>&);
+
+    // PRIVATE CLASS METHODS
+    static void moveLastTo(ENTRY *position, ENTRY *last, bsl::true_type);
+    static void moveLastTo(ENTRY *position, ENTRY *last, bsl::false_type);
+        // Move the entry at the specified 'last' address to the specified
+        // 'position', shifting the entries in '[position .. last)' up by one
+        // position.  The first overload, for bitwise-moveable entries, moves
+        // their bytes; the second swaps adjacent entries.
+
+    // PRIVATE MANIPULATORS
+    iterator appendAndMoveTo(bsl::size_t index, const ENTRY& entry);
+        // Insert a copy of the specified 'entry' at the specified 'index' of
+        // the array, and return an iterator to it.  If an exception is
+        // thrown, the array is unchanged.  The behavior is undefined unless
+        // 'index <= size()'.
+
+    void mergeAppended(bsl::size_t numSorted);
+        // Sort the entries at and after the specified 'numSorted' position of
+        // the array, and merge them into the entries preceding it, discarding
+        // each appended entry whose key is already present or is equivalent
+        // to that of an earlier appended entry.  The behavior is undefined
+        // unless the entries in '[0 .. numSorted)' are sorted and have unique
+        // keys.
+
+    // PRIVATE ACCESSORS
+    bool isKeyAt(bsl::size_t index, const KEY& key) const;
+        // Return 'true' if the entry at the specified 'index' has a key
+        // equivalent to the specified 'key', and 'false' otherwise (including
+        // if 'size() <= index').
+
+    bsl::size_t lowerBoundIndex(const KEY& key) const;
+        // Return the index of the first entry whose key is not ordered before
+        // the specified 'key', or 'size()' if there is no such entry.
+
+    bsl::size_t upperBoundIndex(const KEY& key) const;
+        // Return the index of the first entry whose key is ordered after the
+        // specified 'key', or 'size()' if there is no such entry.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatSortedTable,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit FlatSortedTable(const COMPARATOR&  comparator,
+                             bslma::Allocator  *basicAllocator = 0);
+        // Create an empty table that orders keys using the specified
+        // 'comparator'.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  No memory is allocated.
+
+    FlatSortedTable(const FlatSortedTable&  original,
+                    bslma::Allocator       *basicAllocator = 0);
+        // Create a table having the same value and comparator as the specified
+        // 'original'.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    //! ~FlatSortedTable() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! FlatSortedTable& operator=(const FlatSortedTable& rhs) = default;
+        // Assign to this table the value and comparator of the specified
+        // 'rhs', and return a reference providing modifiable access to this
+        // table.
+
+    iterator begin();
+        // Return an iterator to the first entry of this table, or the
+        // past-the-end iterator if this table is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this table.
+
+    void clear();
+        // Remove all entries from this table.  Note that the capacity of the
+        // table is unchanged.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove the entry having the specified 'key' from this table, if any.
+        // Return the number of entries removed (0 or 1).
+
+    iterator erase(const_iterator position);
+        // Remove the entry at the specified 'position' from this table, and
+        // return an iterator to the entry following it.  The behavior is
+        // undefined unless 'position' refers to an entry of this table.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove the entries in the range '[first .. last)' from this table,
+        // and return an iterator to the entry following the last one
+        // removed.  The behavior is undefined unless '[first .. last)' is a
+        // valid range of entries of this table.
+
+    iterator find(const KEY& key);
+        // Return an iterator to the entry having the specified 'key', or the
+        // past-the-end iterator if this table has no such entry.
+
+    bsl::pair<iterator, bool> insert(const ENTRY& entry);
+        // Insert a copy of the specified 'entry' into this table if it has no
+        // entry having the key of 'entry'.  Return a pair whose 'first' member
+        // refers to the entry having that key, and whose 'second' member is
+        // 'true' if 'entry' was inserted, and 'false' otherwise.  If an
+        // exception is thrown, this table is unchanged.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert copies of the entries in the range '[first .. last)', in any
+        // order, whose keys are not already in this table; of the entries in
+        // the range having equivalent keys, only the first is inserted.  If an
+        // exception is thrown, this table is left with its original value.
+
+    iterator lowerBound(const KEY& key);
+        // Return an iterator to the first entry whose key is not ordered
+        // before the specified 'key', or the past-the-end iterator if there is
+        // no such entry.
+
+    void reserve(bsl::size_t numEntries);
+        // Increase the capacity of this table, if needed, so that it can hold
+        // the specified 'numEntries' without reallocating.
+
+    void shrinkToFit();
+        // Reduce the capacity of this table, if possible, to its size.
+
+    void swap(FlatSortedTable& other);
+        // Exchange the value and comparator of this table with those of the
+        // specified 'other'.  The behavior is undefined unless this table and
+        // 'other' use the same allocator.
+
+    bsl::pair<iterator, bool> tryEmplace(const KEY& key);
+        // Insert an entry constructed from the specified 'key' into this table
+        // if it has no entry having 'key'.  Return a pair whose 'first' member
+        // refers to the entry having 'key', and whose 'second' member is
+        // 'true' if an entry was inserted, and 'false' otherwise.
+
+    iterator upperBound(const KEY& key);
+        // Return an iterator to the first entry whose key is ordered after the
+        // specified 'key', or the past-the-end iterator if there is no such
+        // entry.
+
+    // ACCESSORS
+    const_iterator begin() const;
+        // Return an iterator to the first entry of this table, or the
+        // past-the-end iterator if this table is empty.
+
+    bsl::size_t capacity() const;
+        // Return the number of entries this table can hold without
+        // reallocating.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this table has an entry having the specified 'key',
+        // and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of entries having the specified 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this table has no entries, and 'false' otherwise.
+
+    const_iterator end() const;
+        // Return the past-the-end iterator of this table.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator to the entry having the specified 'key', or the
+        // past-the-end iterator if this table has no such entry.
+
+    COMPARATOR key_comp() const;
+        // Return (a copy of) the key comparator of this table.
+
+    const_iterator lowerBound(const KEY& key) const;
+        // Return an iterator to the first entry whose key is not ordered
+        // before the specified 'key', or the past-the-end iterator if there is
+        // no such entry.
+
+    bsl::size_t size() const;
+        // Return the number of entries in this table.
+
+    const_iterator upperBound(const KEY& key) const;
+        // Return an iterator to the first entry whose key is ordered after the
+        // specified 'key', or the past-the-end iterator if there is no such
+        // entry.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this table to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+bool operator==(
+               const FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& lhs,
+               const FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' tables have the same
+    // value, and 'false' otherwise.  Two tables have the same value if they
+    // have the same number of entries, and each entry of 'lhs' compares equal
+    // to the entry at the same position in 'rhs'.
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+bool operator!=(
+               const FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& lhs,
+               const FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' tables do not have the
+    // same value, and 'false' otherwise.
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                   // -------------------------------------
+                   // class FlatSortedTable_EntryComparator
+                   // -------------------------------------
+
+// CREATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+FlatSortedTable_EntryComparator<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::
+                  FlatSortedTable_EntryComparator(const COMPARATOR& comparator)
+: d_comparator_p(&comparator)
+{
+}
+
+// ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bool FlatSortedTable_EntryComparator<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::
+                       operator()(const ENTRY& lhs, const ENTRY& rhs) const
+{
+    return (*d_comparator_p)(ENTRY_UTIL::key(lhs), ENTRY_UTIL::key(rhs));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bool FlatSortedTable_EntryComparator<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::
+                       operator()(const ENTRY *lhs, const ENTRY *rhs) const
+{
+    if ((*this)(*lhs, *rhs)) {
+        return true;                                                  // RETURN
+    }
+    return !(*this)(*rhs, *lhs) && lhs < rhs;
+}
+
+                           // ---------------------
+                           // class FlatSortedTable
+                           // ---------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+void FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::moveLastTo(
+                                                       ENTRY *position,
+                                                       ENTRY *last,
+                                                       bsl::true_type)
+{
+    // 'ENTRY' may have non-trivial copy operations, so the addresses are
+    // passed as 'void *' to indicate that the objects are relocated bitwise.
+
+    bsls::ObjectBuffer<ENTRY> temp;
+
+    bsl::memcpy(static_cast<void *>(temp.buffer()),
+                static_cast<const void *>(last),
+                sizeof(ENTRY));
+    bsl::memmove(static_cast<void *>(position + 1),
+                 static_cast<const void *>(position),
+                 (last - position) * sizeof(ENTRY));
+    bsl::memcpy(static_cast<void *>(position),
+                static_cast<const void *>(temp.buffer()),
+                sizeof(ENTRY));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::moveLastTo(
+                                                       ENTRY *position,
+                                                       ENTRY *last,
+                                                       bsl::false_type)
+{
+    for (; last != position; --last) {
+        bslalg::SwapUtil::swap(last - 1, last);
+    }
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+typename FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::appendAndMoveTo(
+                                                       bsl::size_t  index,
+                                                       const ENTRY& entry)
+{
+    // Inserting at the end of a 'bsl::vector' leaves it unchanged if the copy
+    // of 'entry' throws, which inserting in the middle does not guarantee.
+    // The new entry is then moved into place, which does not throw.
+
+    typedef typename bslmf::IsBitwiseMoveable<ENTRY>::type IsBitwise;
+
+    d_entries.push_back(entry);
+
+    ENTRY *entries = d_entries.begin();
+    moveLastTo(entries + index, entries + d_entries.size() - 1, IsBitwise());
+
+    return entries + index;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::mergeAppended(
+                                                         bsl::size_t numSorted)
+{
+    // The appended entries are ordered by sorting pointers to them, rather
+    // than the entries themselves, so that no temporary entries (which would
+    // not use the table's allocator) are created, and so that the first of
+    // the entries having equivalent keys is readily identified.
+
+    typedef bsl::vector<const ENTRY *> Order;
+
+    const EntryComparator comparator(d_comparator);
+
+    const ENTRY *lhs      = d_entries.begin();
+    const ENTRY *lhsEnd   = lhs + numSorted;
+    const ENTRY *appended = lhsEnd;
+    const ENTRY *end      = d_entries.end();
+
+    Order order(allocator());
+    order.reserve(end - appended);
+
+    bool isSorted = true;
+    for (const ENTRY *it = appended; it != end; ++it) {
+        if (it != appended && comparator(*it, it[-1])) {
+            isSorted = false;
+        }
+        order.push_back(it);
+    }
+    if (!isSorted) {
+        bsl::sort(order.begin(), order.end(), comparator);
+    }
+
+    Vector merged(d_entries.get_allocator());
+    merged.reserve(d_entries.size());
+
+    const ENTRY *previous = 0;
+    for (typename Order::const_iterator rhs = order.begin();
+         rhs != order.end();
+         ++rhs) {
+        const ENTRY *entry = *rhs;
+
+        if (previous && !comparator(*previous, *entry)) {
+            continue;  // An earlier appended entry has an equivalent key.
+        }
+        previous = entry;
+
+        while (lhs != lhsEnd && comparator(*lhs, *entry)) {
+            merged.push_back(*lhs);
+            ++lhs;
+        }
+        if (lhs != lhsEnd && !comparator(*entry, *lhs)) {
+            continue;  // The existing entry takes precedence.
+        }
+        merged.push_back(*entry);
+    }
+    merged.insert(merged.end(), lhs, lhsEnd);
+
+    d_entries.swap(merged);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bool FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::isKeyAt(
+                                                       bsl::size_t index,
+                                                       const KEY&  key) const
+{
+    return index < d_entries.size()
+        && !d_comparator(key, ENTRY_UTIL::key(d_entries[index]));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::size_t FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::
+                                         lowerBoundIndex(const KEY& key) const
+{
+    // Each iteration halves the range '[base .. base + length]' known to hold
+    // the result.  The selection of the half is expressed as a conditional
+    // expression so that compilers emit a conditional move rather than a
+    // (frequently mispredicted) branch.
+
+    const ENTRY *entries = d_entries.begin();
+    const ENTRY *base    = entries;
+    bsl::size_t  length  = d_entries.size();
+
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    while (length > 1) {
+        const bsl::size_t half = length / 2;
+
+        base    = d_comparator(ENTRY_UTIL::key(base[half]), key)
+                ? base + half
+                : base;
+        length -= half;
+    }
+
+    return (base - entries) + d_comparator(ENTRY_UTIL::key(*base), key);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::size_t FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::
+                                         upperBoundIndex(const KEY& key) const
+{
+    const ENTRY *entries = d_entries.begin();
+    const ENTRY *base    = entries;
+    bsl::size_t  length  = d_entries.size();
+
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    while (length > 1) {
+        const bsl::size_t half = length / 2;
+
+        base    = !d_comparator(key, ENTRY_UTIL::key(base[half]))
+                ? base + half
+                : base;
+        length -= half;
+    }
+
+    return (base - entries) + !d_comparator(key, ENTRY_UTIL::key(*base));
+}
+
+// CREATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::FlatSortedTable(
+                                           const COMPARATOR&  comparator,
+                                           bslma::Allocator  *basicAllocator)
+: d_entries(basicAllocator)
+, d_comparator(comparator)
+{
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::FlatSortedTable(
+                                      const FlatSortedTable&  original,
+                                      bslma::Allocator       *basicAllocator)
+: d_entries(original.d_entries, basicAllocator)
+, d_comparator(original.d_comparator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::begin()
+{
+    return d_entries.begin();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::end()
+{
+    return d_entries.end();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+void FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::clear()
+{
+    d_entries.clear();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::size_t FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::erase(
+                                                                const KEY& key)
+{
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    if (!isKeyAt(index, key)) {
+        return 0;                                                     // RETURN
+    }
+    d_entries.erase(d_entries.begin() + index);
+    return 1;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::erase(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position >= d_entries.begin());
+    BSLS_ASSERT_SAFE(position <  d_entries.end());
+
+    return d_entries.erase(position);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::erase(
+                                                          const_iterator first,
+                                                          const_iterator last)
+{
+    return d_entries.erase(first, last);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::find(const KEY& key)
+{
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    return isKeyAt(index, key) ? d_entries.begin() + index : d_entries.end();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+bsl::pair<typename FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::
+                                                                      iterator,
+          bool>
+FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::insert(const ENTRY& entry)
+{
+    const KEY&        key   = ENTRY_UTIL::key(entry);
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    if (isKeyAt(index, key)) {
+        return bsl::pair<iterator, bool>(d_entries.begin() + index, false);
+                                                                      // RETURN
+    }
+    return bsl::pair<iterator, bool>(appendAndMoveTo(index, entry), true);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class INPUT_ITERATOR>
+void FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::insert(
+                                                          INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    const bsl::size_t     numSorted = d_entries.size();
+    const EntryComparator comparator(d_comparator);
+
+    BSLS_TRY {
+        d_entries.insert(d_entries.end(), first, last);
+
+        // Appended entries that are strictly increasing, and ordered after
+        // the existing entries, are already in place; this is the common
+        // case of a table loaded from sorted data.
+
+        const ENTRY *begin = d_entries.begin();
+        const ENTRY *end   = d_entries.end();
+        const ENTRY *it    = begin + numSorted;
+
+        if (it == end) {
+            return;                                                   // RETURN
+        }
+        if (0 == numSorted) {
+            ++it;
+        }
+        while (it != end && comparator(it[-1], *it)) {
+            ++it;
+        }
+        if (it != end) {
+            mergeAppended(numSorted);
+        }
+    }
+    BSLS_CATCH(...) {
+        d_entries.erase(d_entries.begin() + numSorted, d_entries.end());
+        BSLS_RETHROW;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::lowerBound(const KEY& key)
+{
+    return d_entries.begin() + lowerBoundIndex(key);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+void FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::reserve(
+                                                        bsl::size_t numEntries)
+{
+    d_entries.reserve(numEntries);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+void FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::shrinkToFit()
+{
+    d_entries.shrink_to_fit();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+void FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::swap(
+                                                        FlatSortedTable& other)
+{
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    using bsl::swap;
+
+    d_entries.swap(other.d_entries);
+    swap(d_comparator, other.d_comparator);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+bsl::pair<typename FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::
+                                                                      iterator,
+          bool>
+FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::tryEmplace(
+                                                                const KEY& key)
+{
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    if (isKeyAt(index, key)) {
+        return bsl::pair<iterator, bool>(d_entries.begin() + index, false);
+                                                                      // RETURN
+    }
+
+    bsls::ObjectBuffer<ENTRY> entry;
+    ENTRY_UTIL::constructFromKey(entry.address(), allocator(), key);
+    bslma::DestructorGuard<ENTRY> guard(entry.address());
+
+    return bsl::pair<iterator, bool>(appendAndMoveTo(index, entry.object()),
+                                     true);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::upperBound(const KEY& key)
+{
+    return d_entries.begin() + upperBoundIndex(key);
+}
+
+// ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::begin() const
+{
+    return d_entries.begin();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::size_t FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::capacity()
+                                                                          const
+{
+    return d_entries.capacity();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bool FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::contains(
+                                                          const KEY& key) const
+{
+    return isKeyAt(lowerBoundIndex(key), key);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::size_t FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::count(
+                                                          const KEY& key) const
+{
+    return contains(key) ? 1 : 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bool FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::empty() const
+{
+    return d_entries.empty();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::end() const
+{
+    return d_entries.end();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::find(const KEY& key) const
+{
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    return isKeyAt(index, key) ? d_entries.begin() + index : d_entries.end();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+COMPARATOR FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::key_comp()
+                                                                          const
+{
+    return d_comparator;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::lowerBound(
+                                                          const KEY& key) const
+{
+    return d_entries.begin() + lowerBoundIndex(key);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::size_t FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::size() const
+{
+    return d_entries.size();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::upperBound(
+                                                          const KEY& key) const
+{
+    return d_entries.begin() + upperBoundIndex(key);
+}
+
+                                  // Aspects
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bslma::Allocator *FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::
+                                                              allocator() const
+{
+    return d_entries.get_allocator().mechanism();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bool bdlc::operator==(
+               const FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& lhs,
+               const FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& rhs)
+{
+    return lhs.d_entries == rhs.d_entries;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bool bdlc::operator!=(
+               const FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& lhs,
+               const FlatSortedTable<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1161 @@
+// bdlc_flatsortedtable.t.cpp                                         -*-C++-*-
+#include <bdlc_flatsortedtable.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_isbitwisemoveable.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>      // 'sprintf', 'printf' (needed by exception
+                             // macros)
+#include <bsl_cstdlib.h>     // 'atoi', 'rand'
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlc::FlatSortedTable' is a table of entries having unique keys, kept
+// sorted in a 'bsl::vector'.  We first verify the branch-free binary searches
+// exhaustively for small tables against 'bsl::lower_bound' and
+// 'bsl::upper_bound'.  We then verify the manipulators and accessors, with
+// particular attention to the insertion of ranges (unsorted, sorted, having
+// duplicates, and overlapping the existing entries), comparing against a
+// 'bsl::map' oracle, and to the handling of memory, including exception
+// neutrality, with entries that allocate.
+// ----------------------------------------------------------------------------
+// FlatSortedTable_EntryComparator
+// [ 2] FlatSortedTable_EntryComparator(const COMPARATOR& comparator);
+// [ 2] bool operator()(const ENTRY& lhs, const ENTRY& rhs) const;
+// [ 2] bool operator()(const ENTRY *lhs, const ENTRY *rhs) const;
+//
+// FlatSortedTable
+// [ 3] FlatSortedTable(const COMPARATOR& comparator, basicAllocator = 0);
+// [ 5] FlatSortedTable(const FlatSortedTable& original, ba = 0);
+// [ 5] FlatSortedTable& operator=(const FlatSortedTable& rhs);
+// [ 3] iterator begin();
+// [ 3] iterator end();
+// [ 5] void clear();
+// [ 3] size_t erase(const KEY& key);
+// [ 3] iterator erase(const_iterator position);
+// [ 3] iterator erase(const_iterator first, const_iterator last);
+// [ 3] iterator find(const KEY& key);
+// [ 3] pair<iterator, bool> insert(const ENTRY& entry);
+// [ 4] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 2] iterator lowerBound(const KEY& key);
+// [ 5] void reserve(size_t numEntries);
+// [ 5] void shrinkToFit();
+// [ 5] void swap(FlatSortedTable& other);
+// [ 3] pair<iterator, bool> tryEmplace(const KEY& key);
+// [ 2] iterator upperBound(const KEY& key);
+// [ 3] const_iterator begin() const;
+// [ 5] size_t capacity() const;
+// [ 3] bool contains(const KEY& key) const;
+// [ 3] size_t count(const KEY& key) const;
+// [ 3] bool empty() const;
+// [ 3] const_iterator end() const;
+// [ 3] const_iterator find(const KEY& key) const;
+// [ 3] COMPARATOR key_comp() const;
+// [ 2] const_iterator lowerBound(const KEY& key) const;
+// [ 3] size_t size() const;
+// [ 2] const_iterator upperBound(const KEY& key) const;
+// [ 3] bslma::Allocator *allocator() const;
+// [ 5] bool operator==(const FlatSortedTable&, const FlatSortedTable&);
+// [ 5] bool operator!=(const FlatSortedTable&, const FlatSortedTable&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: The first of the entries having equivalent keys is kept.
+// [ 4] CONCERN: Existing entries take precedence over inserted ranges.
+// [ 6] CONCERN: Entries are passed the table's allocator.
+// [ 6] CONCERN: Methods are exception neutral.
+// [ 7] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct IntEntryUtil {
+    // This utility 'struct' provides the entry operations for a table of
+    // 'int' entries that are their own keys.
+
+    static const int& key(const int& entry)
+        // Return the specified 'entry'.
+    {
+        return entry;
+    }
+
+    static void constructFromKey(int              *address,
+                                 bslma::Allocator *,
+                                 const int&        key)
+        // Construct at the specified 'address' a copy of the specified 'key'.
+    {
+        *address = key;
+    }
+};
+
+struct PairEntryUtil {
+    // This utility 'struct' provides the entry operations for a table of
+    // 'bsl::pair<int, int>' entries keyed by their 'first' member.
+
+    static const int& key(const bsl::pair<int, int>& entry)
+        // Return the 'first' member of the specified 'entry'.
+    {
+        return entry.first;
+    }
+
+    static void constructFromKey(bsl::pair<int, int> *address,
+                                 bslma::Allocator    *,
+                                 const int&           key)
+        // Construct at the specified 'address' a pair having the specified
+        // 'key' and a 'second' member of -1.
+    {
+        new (address) bsl::pair<int, int>(key, -1);
+    }
+};
+
+struct StringEntryUtil {
+    // This utility 'struct' provides the entry operations for a table of
+    // 'bsl::string' entries that are their own keys.
+
+    static const bsl::string& key(const bsl::string& entry)
+        // Return the specified 'entry'.
+    {
+        return entry;
+    }
+
+    static void constructFromKey(bsl::string       *address,
+                                 bslma::Allocator  *allocator,
+                                 const bsl::string& key)
+        // Construct at the specified 'address' a copy of the specified 'key'
+        // using the specified 'allocator' to supply memory.
+    {
+        bslma::ConstructionUtil::construct(address, allocator, key);
+    }
+};
+
+class CountedInt {
+    // This class holds an 'int' and, having a user-defined copy constructor,
+    // is neither trivially copyable nor bitwise moveable.
+
+    // DATA
+    int d_value;
+
+  public:
+    // CREATORS
+    explicit CountedInt(int value)
+        // Create an object holding the specified 'value'.
+    : d_value(value)
+    {
+    }
+
+    CountedInt(const CountedInt& original)
+        // Create an object holding the value of the specified 'original'.
+    : d_value(original.d_value)
+    {
+    }
+
+    // ACCESSORS
+    const int& value() const
+        // Return a reference to the value held by this object.
+    {
+        return d_value;
+    }
+};
+
+BSLMF_ASSERT(!bslmf::IsBitwiseMoveable<CountedInt>::value);
+
+struct CountedIntEntryUtil {
+    // This utility 'struct' provides the entry operations for a table of
+    // 'CountedInt' entries keyed by their values.
+
+    static const int& key(const CountedInt& entry)
+        // Return the value of the specified 'entry'.
+    {
+        return entry.value();
+    }
+
+    static void constructFromKey(CountedInt       *address,
+                                 bslma::Allocator *,
+                                 const int&        key)
+        // Construct at the specified 'address' an object holding the
+        // specified 'key'.
+    {
+        new (address) CountedInt(key);
+    }
+};
+
+struct ModuloLess {
+    // This comparator orders integers by their residues modulo a divisor
+    // supplied at construction, and is used to verify that comparators are
+    // retained, and that equivalent (but unequal) keys are treated as
+    // duplicates.
+
+    int d_divisor;
+
+    explicit ModuloLess(int divisor = 1000003)
+        // Create a comparator having the optionally specified 'divisor'.
+    : d_divisor(divisor)
+    {
+    }
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the residue of the specified 'lhs' is less than
+        // that of the specified 'rhs', and 'false' otherwise.
+    {
+        return lhs % d_divisor < rhs % d_divisor;
+    }
+};
+
+typedef bdlc::FlatSortedTable<int,
+                              int,
+                              IntEntryUtil,
+                              bsl::less<int> >             Obj;
+
+typedef bdlc::FlatSortedTable<int,
+                              bsl::pair<int, int>,
+                              PairEntryUtil,
+                              bsl::less<int> >             PairObj;
+
+typedef bdlc::FlatSortedTable<int,
+                              int,
+                              IntEntryUtil,
+                              ModuloLess>                  ModuloObj;
+
+typedef bdlc::FlatSortedTable<int,
+                              CountedInt,
+                              CountedIntEntryUtil,
+                              bsl::less<int> >             CountedObj;
+
+typedef bdlc::FlatSortedTable<bsl::string,
+                              bsl::string,
+                              StringEntryUtil,
+                              bsl::less<bsl::string> >     StringObj;
+
+template <class TABLE>
+bool isEqualToOracle(const TABLE& table, const bsl::map<int, int>& oracle)
+    // Return 'true' if the specified 'table' holds exactly the entries of the
+    // specified 'oracle', in order, and 'false' otherwise.
+{
+    if (table.size() != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+
+    typename TABLE::const_iterator          it = table.begin();
+    bsl::map<int, int>::const_iterator      jt = oracle.begin();
+    for (; it != table.end(); ++it, ++jt) {
+        if (it->first != jt->first || it->second != jt->second) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test            = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose         = argc > 2;
+    const bool veryVerbose     = argc > 3;
+    const bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Implementing a Sorted Set of Integers
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we wish to implement a simple sorted set of 'int' values on a
+// 'bdlc::FlatSortedTable'.
+//
+// First, we define the entry utility for an entry that is its own key (see
+// 'IntEntryUtil' above).
+//
+// Then, we create a table of 'int' entries, inserting a range of unsorted
+// values having a duplicate:
+//..
+    typedef bdlc::FlatSortedTable<int,
+                                  int,
+                                  IntEntryUtil,
+                                  bsl::less<int> > IntTable;
+
+    const int VALUES[] = { 8, 3, 5, 3, 1 };
+
+    IntTable table((bsl::less<int>()));
+    table.insert(VALUES, VALUES + 5);
+
+    ASSERT(4 == table.size());
+//..
+// Next, we observe that the entries are sorted:
+//..
+    ASSERT(1 == table.begin()[0]);
+    ASSERT(3 == table.begin()[1]);
+    ASSERT(5 == table.begin()[2]);
+    ASSERT(8 == table.begin()[3]);
+//..
+// Finally, we search the table:
+//..
+    ASSERT(table.end() != table.find(5));
+    ASSERT(table.end() == table.find(4));
+    ASSERT(5 == *table.lowerBound(4));
+    ASSERT(8 == *table.upperBound(5));
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // ALLOCATION AND EXCEPTION NEUTRALITY
+        //
+        // Concerns:
+        //: 1 Entries are constructed using the table's allocator.
+        //:
+        //: 2 If an allocation fails during an insertion (of an entry or of a
+        //:   range), or a copy, the exception propagates, the table is
+        //:   unchanged, and no memory is leaked.
+        //:
+        //: 3 No memory is allocated by the default allocator.
+        //
+        // Plan:
+        //: 1 Insert strings too long for the short-string buffer into a table
+        //:   of 'bsl::string' entries, and verify that the strings use the
+        //:   table's allocator.  (C-1)
+        //:
+        //: 2 Insert strings and ranges of strings, and copy tables, under the
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST' macros, and verify the
+        //:   value of the table after each attempt.  (C-2)
+        //:
+        //: 3 Verify that the default allocator was not used.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: Entries are passed the table's allocator.
+        //   CONCERN: Methods are exception neutral.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ALLOCATION AND EXCEPTION NEUTRALITY" << endl
+                          << "===================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        const int NUM_STRINGS = 40;
+
+        bsl::vector<bsl::string> strings(&ta);
+        for (int i = 0; i < NUM_STRINGS; ++i) {
+            char buffer[64];
+            sprintf(buffer,
+                    "a string too long for the short buffer %d",
+                    (i * 17) % NUM_STRINGS);
+            strings.push_back(bsl::string(buffer, &ta));
+        }
+
+        if (verbose) cout << "\nEntries use the table's allocator." << endl;
+        {
+            StringObj mX(bsl::less<bsl::string>(), &ta);
+            const StringObj& X = mX;
+
+            for (int i = 0; i < NUM_STRINGS; ++i) {
+                mX.insert(strings[i]);
+                mX.tryEmplace(strings[i]);
+            }
+            ASSERT(NUM_STRINGS == static_cast<int>(X.size()));
+
+            for (StringObj::const_iterator it = X.begin();
+                 it != X.end();
+                 ++it) {
+                ASSERT(&ta == it->get_allocator().mechanism());
+            }
+        }
+
+        if (verbose) cout << "\nInsertion is exception neutral." << endl;
+        {
+            StringObj mX(bsl::less<bsl::string>(), &ta);
+            const StringObj& X = mX;
+
+            for (int i = 0; i < NUM_STRINGS; ++i) {
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                    ASSERTV(i, X.size(), i == static_cast<int>(X.size()));
+                    ASSERTV(i, false == X.contains(strings[i]));
+
+                    if (i % 2) {
+                        mX.insert(strings[i]);
+                    }
+                    else {
+                        mX.tryEmplace(strings[i]);
+                    }
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(i, i + 1 == static_cast<int>(X.size()));
+                for (int j = 0; j <= i; ++j) {
+                    ASSERTV(i, j, X.contains(strings[j]));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nRange insertion is exception neutral."
+                          << endl;
+        {
+            const int HALF = NUM_STRINGS / 2;
+
+            StringObj mX(bsl::less<bsl::string>(), &ta);
+            const StringObj& X = mX;
+
+            mX.insert(strings.begin(), strings.begin() + HALF);
+            ASSERT(HALF == static_cast<int>(X.size()));
+
+            const StringObj W(X, &ta);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                ASSERT(W == X);
+
+                mX.insert(strings.begin() + HALF / 2, strings.end());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(NUM_STRINGS == static_cast<int>(X.size()));
+            for (int j = 0; j < NUM_STRINGS; ++j) {
+                ASSERTV(j, X.contains(strings[j]));
+            }
+        }
+
+        if (verbose) cout << "\nCopying is exception neutral." << endl;
+        {
+            StringObj mX(bsl::less<bsl::string>(), &ta);
+            const StringObj& X = mX;
+
+            mX.insert(strings.begin(), strings.end());
+
+            bslma::TestAllocator sa("supplied", veryVeryVerbose);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                const StringObj Y(X, &sa);
+                ASSERT(X == Y);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERT(0 == sa.numBlocksInUse());
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                StringObj mY(bsl::less<bsl::string>(), &sa);
+                mY.tryEmplace(strings[0]);
+                mY = X;
+                ASSERT(X == mY);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERT(0 == sa.numBlocksInUse());
+        }
+
+        ASSERT(0 == ta.numBlocksInUse() - 1 - NUM_STRINGS);
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, EQUALITY, AND CAPACITY
+        //
+        // Concerns:
+        //: 1 A copy has the value and comparator of the original, and uses
+        //:   the supplied allocator.
+        //:
+        //: 2 Assignment gives the target the value and comparator of the
+        //:   source, and retains the target's allocator.
+        //:
+        //: 3 'swap' exchanges the values and comparators of two tables.
+        //:
+        //: 4 Tables compare equal if and only if they have equal entries.
+        //:
+        //: 5 'reserve' and 'shrinkToFit' change the capacity, and 'clear'
+        //:   does not, and none change the value unexpectedly.
+        //
+        // Plan:
+        //: 1 Exercise each operation on tables of various sizes, using a
+        //:   comparator having state.  (C-1..5)
+        //
+        // Testing:
+        //   FlatSortedTable(const FlatSortedTable& original, ba = 0);
+        //   FlatSortedTable& operator=(const FlatSortedTable& rhs);
+        //   void clear();
+        //   void reserve(size_t numEntries);
+        //   void shrinkToFit();
+        //   void swap(FlatSortedTable& other);
+        //   size_t capacity() const;
+        //   bool operator==(const FlatSortedTable&, const FlatSortedTable&);
+        //   bool operator!=(const FlatSortedTable&, const FlatSortedTable&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "COPY, ASSIGNMENT, SWAP, EQUALITY, AND CAPACITY"
+                      << endl
+                      << "=============================================="
+                      << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVerbose);
+
+        const int SIZES[]   = { 0, 1, 2, 15, 100 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            ModuloObj mX(ModuloLess(1009), &ta);  const ModuloObj& X = mX;
+            for (int i = 0; i < SIZE; ++i) {
+                mX.insert(i * 7);
+            }
+            ASSERTV(SIZE, SIZE == static_cast<int>(X.size()));
+
+            {
+                const ModuloObj Y(X, &sa);
+                ASSERTV(SIZE, X == Y);
+                ASSERTV(SIZE, !(X != Y));
+                ASSERTV(SIZE, 1009 == Y.key_comp().d_divisor);
+                ASSERTV(SIZE, &sa  == Y.allocator());
+            }
+            ASSERTV(SIZE, 0 == sa.numBlocksInUse());
+
+            {
+                ModuloObj mY(ModuloLess(), &sa);
+                mY.insert(-1);
+                ASSERTV(SIZE, X != mY);
+
+                mY = X;
+                ASSERTV(SIZE, X == mY);
+                ASSERTV(SIZE, 1009 == mY.key_comp().d_divisor);
+                ASSERTV(SIZE, &sa  == mY.allocator());
+
+                if (SIZE) {
+                    mY.erase(0);
+                    mY.insert(1);
+                    ASSERTV(SIZE, X.size() == mY.size());
+                    ASSERTV(SIZE, X != mY);
+                }
+            }
+            ASSERTV(SIZE, 0 == sa.numBlocksInUse());
+
+            {
+                ModuloObj mY(ModuloLess(), &ta);
+                mY.insert(-1);
+
+                mX.swap(mY);
+                ASSERTV(SIZE, 1 == X.size());
+                ASSERTV(SIZE, X.contains(-1));
+                ASSERTV(SIZE, 1000003 == X.key_comp().d_divisor);
+                ASSERTV(SIZE, SIZE == static_cast<int>(mY.size()));
+                ASSERTV(SIZE, 1009 == mY.key_comp().d_divisor);
+
+                mX.swap(mY);
+                ASSERTV(SIZE, SIZE == static_cast<int>(X.size()));
+                ASSERTV(SIZE, 1009 == X.key_comp().d_divisor);
+            }
+
+            {
+                const ModuloObj W(X, &ta);
+
+                mX.reserve(SIZE + 50);
+                ASSERTV(SIZE, SIZE + 50 <= static_cast<int>(X.capacity()));
+                ASSERTV(SIZE, W == X);
+
+                mX.shrinkToFit();
+                ASSERTV(SIZE, SIZE == static_cast<int>(X.capacity()));
+                ASSERTV(SIZE, W == X);
+
+                mX.reserve(SIZE + 50);
+                const bsl::size_t CAPACITY = X.capacity();
+
+                mX.clear();
+                ASSERTV(SIZE, X.empty());
+                ASSERTV(SIZE, CAPACITY == X.capacity());
+                ASSERTV(SIZE, (0 == SIZE) == (W == X));
+
+                mX.shrinkToFit();
+                ASSERTV(SIZE, 0 == X.capacity());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // RANGE INSERTION
+        //
+        // Concerns:
+        //: 1 A range is inserted correctly whether it is sorted, reverse
+        //:   sorted, or in random order.
+        //:
+        //: 2 Of the entries of a range having equivalent keys, the first is
+        //:   kept.
+        //:
+        //: 3 Entries of a range whose keys are already in the table are not
+        //:   inserted, and the existing entries are unchanged.
+        //:
+        //: 4 A range ordered entirely after the existing entries is appended,
+        //:   and a range interleaved with them is merged.
+        //:
+        //: 5 Inserting an empty range has no effect.
+        //
+        // Plan:
+        //: 1 Insert ranges of 'bsl::pair<int, int>' entries, keyed by their
+        //:   'first' member and tagged with their position in the range by
+        //:   their 'second' member, into tables, and compare the result to a
+        //:   'bsl::map' into which the same entries are inserted one by one.
+        //:   (C-1..5)
+        //
+        // Testing:
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   CONCERN: The first of the entries having equivalent keys is kept.
+        //   CONCERN: Existing entries take precedence over inserted ranges.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "RANGE INSERTION" << endl
+                          << "===============" << endl;
+
+        typedef bsl::pair<int, int> Entry;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\nRanges in specific orders." << endl;
+        {
+            const int N = 50;
+
+            bsl::vector<Entry> sorted(&ta);
+            bsl::vector<Entry> reversed(&ta);
+            bsl::vector<Entry> repeated(&ta);
+            for (int i = 0; i < N; ++i) {
+                sorted.push_back(Entry(i, i));
+                reversed.push_back(Entry(N - 1 - i, i));
+                repeated.push_back(Entry(i % 7, i));
+            }
+
+            const bsl::vector<Entry> *RANGES[] = {
+                &sorted, &reversed, &repeated
+            };
+
+            for (int ri = 0; ri < 3; ++ri) {
+                const bsl::vector<Entry>& RANGE = *RANGES[ri];
+
+                PairObj mX(bsl::less<int>(), &ta);
+                mX.insert(RANGE.begin(), RANGE.end());
+
+                bsl::map<int, int> oracle(&ta);
+                for (int i = 0; i < N; ++i) {
+                    oracle.insert(RANGE[i]);
+                }
+                ASSERTV(ri, isEqualToOracle(mX, oracle));
+
+                mX.insert(RANGE.begin(), RANGE.begin());
+                ASSERTV(ri, isEqualToOracle(mX, oracle));
+
+                // Reinserting the range has no effect.
+
+                mX.insert(RANGE.rbegin(), RANGE.rend());
+                ASSERTV(ri, isEqualToOracle(mX, oracle));
+            }
+        }
+
+        if (verbose) cout << "\nRanges after and within the table." << endl;
+        {
+            PairObj mX(bsl::less<int>(), &ta);
+            mX.insert(Entry(10, 100));
+            mX.insert(Entry(20, 200));
+
+            const Entry AFTER[] = { Entry(40, 1), Entry(30, 2) };
+            mX.insert(AFTER, AFTER + 2);
+
+            const Entry WITHIN[] = { Entry(25, 3),
+                                     Entry(20, 4),
+                                     Entry( 5, 5),
+                                     Entry(25, 6) };
+            mX.insert(WITHIN, WITHIN + 4);
+
+            const Entry EXPECTED[] = { Entry( 5,   5),
+                                       Entry(10, 100),
+                                       Entry(20, 200),
+                                       Entry(25,   3),
+                                       Entry(30,   2),
+                                       Entry(40,   1) };
+            const int NUM_EXPECTED = sizeof EXPECTED / sizeof *EXPECTED;
+
+            ASSERT(NUM_EXPECTED == static_cast<int>(mX.size()));
+            ASSERT(bsl::equal(EXPECTED, EXPECTED + NUM_EXPECTED, mX.begin()));
+        }
+
+        if (verbose) cout << "\nRandom ranges." << endl;
+        {
+            for (int trial = 0; trial < 200; ++trial) {
+                PairObj            mX(bsl::less<int>(), &ta);
+                bsl::map<int, int> oracle(&ta);
+
+                const int NUM_RANGES = 1 + trial % 4;
+                for (int r = 0; r < NUM_RANGES; ++r) {
+                    const int LENGTH = rand() % 60;
+                    const int SPREAD = 1 + rand() % 100;
+
+                    bsl::vector<Entry> range(&ta);
+                    for (int i = 0; i < LENGTH; ++i) {
+                        range.push_back(Entry(rand() % SPREAD, r * 100 + i));
+                    }
+                    if (rand() % 2) {
+                        bsl::sort(range.begin(), range.end());
+                    }
+
+                    mX.insert(range.begin(), range.end());
+                    for (int i = 0; i < LENGTH; ++i) {
+                        oracle.insert(range[i]);
+                    }
+                    ASSERTV(trial, r, isEqualToOracle(mX, oracle));
+                }
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A table is created empty, with the specified comparator and
+        //:   allocator (or the default allocator), allocating no memory.
+        //:
+        //: 2 'insert' and 'tryEmplace' insert only absent keys, keep the
+        //:   entries sorted, and return an iterator to the entry having the
+        //:   key.
+        //:
+        //: 3 'find', 'contains', and 'count' locate exactly the keys present.
+        //:
+        //: 4 Each form of 'erase' removes the specified entries and returns
+        //:   the expected result.
+        //:
+        //: 5 Keys that are equivalent under the comparator, but not equal,
+        //:   are treated as duplicates.
+        //:
+        //: 6 Entries that are not bitwise moveable are inserted correctly.
+        //
+        // Plan:
+        //: 1 Perform random insertions and erasures on a table, comparing it
+        //:   to a 'bsl::map' oracle after each operation.  (C-1..4)
+        //:
+        //: 2 Insert keys equivalent under a modulo comparator.  (C-5)
+        //:
+        //: 3 Perform random insertions on a table of entries that are not
+        //:   bitwise moveable, comparing it to a 'bsl::map' oracle.  (C-6)
+        //
+        // Testing:
+        //   FlatSortedTable(const COMPARATOR& comparator, basicAllocator = 0);
+        //   iterator begin();
+        //   iterator end();
+        //   size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   iterator find(const KEY& key);
+        //   pair<iterator, bool> insert(const ENTRY& entry);
+        //   pair<iterator, bool> tryEmplace(const KEY& key);
+        //   const_iterator begin() const;
+        //   bool contains(const KEY& key) const;
+        //   size_t count(const KEY& key) const;
+        //   bool empty() const;
+        //   const_iterator end() const;
+        //   const_iterator find(const KEY& key) const;
+        //   COMPARATOR key_comp() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        typedef bsl::pair<int, int> Entry;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\nCreation." << endl;
+        {
+            const Obj X((bsl::less<int>()));
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(X.begin() == X.end());
+
+            const ModuloObj Y(ModuloLess(5), &ta);
+            ASSERT(&ta == Y.allocator());
+            ASSERT(5 == Y.key_comp().d_divisor);
+            ASSERT(0 == ta.numBlocksTotal());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nRandom operations." << endl;
+        {
+            PairObj mX(bsl::less<int>(), &ta);  const PairObj& X = mX;
+
+            bsl::map<int, int> oracle(&ta);
+
+            for (int i = 0; i < 4000; ++i) {
+                const int KEY = rand() % 200;
+                const int OP  = rand() % 6;
+
+                switch (OP) {
+                  case 0:
+                  case 1: {
+                    const bool INSERTED = 0 == oracle.count(KEY);
+
+                    bsl::pair<PairObj::iterator, bool> result =
+                                                      mX.insert(Entry(KEY, i));
+                    oracle.insert(Entry(KEY, i));
+
+                    ASSERTV(i, INSERTED == result.second);
+                    ASSERTV(i, KEY == result.first->first);
+                    ASSERTV(i, oracle[KEY] == result.first->second);
+                  } break;
+                  case 2: {
+                    const bool INSERTED = 0 == oracle.count(KEY);
+
+                    bsl::pair<PairObj::iterator, bool> result =
+                                                           mX.tryEmplace(KEY);
+                    if (INSERTED) {
+                        oracle.insert(Entry(KEY, -1));
+                    }
+
+                    ASSERTV(i, INSERTED == result.second);
+                    ASSERTV(i, KEY == result.first->first);
+                    ASSERTV(i, oracle[KEY] == result.first->second);
+                  } break;
+                  case 3: {
+                    ASSERTV(i, oracle.erase(KEY) == mX.erase(KEY));
+                  } break;
+                  case 4: {
+                    PairObj::iterator it = mX.find(KEY);
+                    if (it != mX.end()) {
+                        PairObj::iterator next = it + 1;
+                        const int NEXT_KEY = next == mX.end()
+                                           ? -1
+                                           : next->first;
+
+                        it = mX.erase(it);
+                        oracle.erase(KEY);
+                        ASSERTV(i, NEXT_KEY == (it == mX.end() ? -1
+                                                              : it->first));
+                    }
+                  } break;
+                  case 5: {
+                    // Erase a short range of keys.
+
+                    PairObj::const_iterator first = X.lowerBound(KEY);
+                    PairObj::const_iterator last  = X.upperBound(KEY + 3);
+
+                    PairObj::iterator it = mX.erase(first, last);
+                    oracle.erase(oracle.lower_bound(KEY),
+                                 oracle.upper_bound(KEY + 3));
+                    ASSERTV(i, it == mX.upperBound(KEY + 3));
+                  } break;
+                }
+
+                ASSERTV(i, isEqualToOracle(X, oracle));
+                ASSERTV(i, oracle.empty() == X.empty());
+
+                const int PROBE = rand() % 210;
+                const bool PRESENT = 0 != oracle.count(PROBE);
+                ASSERTV(i, PRESENT == X.contains(PROBE));
+                ASSERTV(i, oracle.count(PROBE) == X.count(PROBE));
+                ASSERTV(i, PRESENT == (X.end() != X.find(PROBE)));
+                ASSERTV(i, PRESENT == (mX.end() != mX.find(PROBE)));
+                if (PRESENT) {
+                    ASSERTV(i, PROBE == X.find(PROBE)->first);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nEntries that are not bitwise moveable."
+                          << endl;
+        {
+            CountedObj mX(bsl::less<int>(), &ta);  const CountedObj& X = mX;
+
+            bsl::map<int, int> oracle(&ta);
+
+            for (int i = 0; i < 500; ++i) {
+                const int KEY = rand() % 100;
+
+                if (i % 3) {
+                    mX.insert(CountedInt(KEY));
+                }
+                else {
+                    mX.tryEmplace(KEY);
+                }
+                oracle.insert(bsl::pair<int, int>(KEY, 0));
+
+                ASSERTV(i, oracle.size() == X.size());
+
+                bsl::map<int, int>::const_iterator jt = oracle.begin();
+                for (CountedObj::const_iterator it = X.begin();
+                     it != X.end();
+                     ++it, ++jt) {
+                    ASSERTV(i, jt->first == it->value());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nEquivalent keys." << endl;
+        {
+            ModuloObj mX(ModuloLess(10), &ta);  const ModuloObj& X = mX;
+
+            ASSERT(true  == mX.insert(13).second);
+            ASSERT(false == mX.insert(23).second);
+            ASSERT(false == mX.tryEmplace(3).second);
+            ASSERT(13 == *X.find(33));
+            ASSERT(1  == mX.erase(43));
+            ASSERT(X.empty());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // BINARY SEARCHES
+        //
+        // Concerns:
+        //: 1 'lowerBound' and 'upperBound' return the same positions as
+        //:   'bsl::lower_bound' and 'bsl::upper_bound', for keys before,
+        //:   between, equal to, and after the entries, for tables of every
+        //:   small size (including 0 and 1).
+        //:
+        //: 2 The entry comparator orders entries by their keys, and pointers
+        //:   to entries by the keys of the entries, then by address.
+        //
+        // Plan:
+        //: 1 For tables holding the even integers '[0 .. 2 * N)' for each 'N'
+        //:   in '[0 .. 70)', search for each key in '[-1 .. 2 * N]', and
+        //:   compare the results with those of the standard algorithms.
+        //:   (C-1)
+        //:
+        //: 2 Compare entries with an entry comparator.  (C-2)
+        //
+        // Testing:
+        //   FlatSortedTable_EntryComparator(const COMPARATOR& comparator);
+        //   bool operator()(const ENTRY& lhs, const ENTRY& rhs) const;
+        //   bool operator()(const ENTRY *lhs, const ENTRY *rhs) const;
+        //   iterator lowerBound(const KEY& key);
+        //   iterator upperBound(const KEY& key);
+        //   const_iterator lowerBound(const KEY& key) const;
+        //   const_iterator upperBound(const KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BINARY SEARCHES" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\nSearches." << endl;
+
+        for (int n = 0; n < 70; ++n) {
+            Obj mX(bsl::less<int>(), &ta);  const Obj& X = mX;
+
+            bsl::vector<int> values(&ta);
+            for (int i = 0; i < n; ++i) {
+                values.push_back(2 * i);
+                mX.insert(2 * i);
+            }
+
+            for (int key = -1; key <= 2 * n; ++key) {
+                const int EXP_LOWER = static_cast<int>(
+                        bsl::lower_bound(values.begin(), values.end(), key)
+                                                            - values.begin());
+                const int EXP_UPPER = static_cast<int>(
+                        bsl::upper_bound(values.begin(), values.end(), key)
+                                                            - values.begin());
+
+                ASSERTV(n, key, EXP_LOWER == X.lowerBound(key) - X.begin());
+                ASSERTV(n, key, EXP_UPPER == X.upperBound(key) - X.begin());
+                ASSERTV(n, key, EXP_LOWER == mX.lowerBound(key) - mX.begin());
+                ASSERTV(n, key, EXP_UPPER == mX.upperBound(key) - mX.begin());
+            }
+        }
+
+        if (verbose) cout << "\nEntry comparator." << endl;
+        {
+            typedef bsl::pair<int, int> Entry;
+            typedef bdlc::FlatSortedTable_EntryComparator<int,
+                                                          Entry,
+                                                          PairEntryUtil,
+                                                          bsl::less<int> >
+                                                               EntryComparator;
+
+            const bsl::less<int>  LESS = bsl::less<int>();
+            const EntryComparator X(LESS);
+
+            ASSERT(true  == X(Entry(1, 9), Entry(2, 0)));
+            ASSERT(false == X(Entry(2, 0), Entry(1, 9)));
+            ASSERT(false == X(Entry(1, 0), Entry(1, 9)));
+
+            const Entry ENTRIES[] = { Entry(1, 0), Entry(1, 9), Entry(0, 0) };
+
+            ASSERT(true  == X(ENTRIES + 0, ENTRIES + 1));
+            ASSERT(false == X(ENTRIES + 1, ENTRIES + 0));
+            ASSERT(false == X(ENTRIES + 0, ENTRIES + 0));
+            ASSERT(true  == X(ENTRIES + 2, ENTRIES + 0));
+            ASSERT(false == X(ENTRIES + 1, ENTRIES + 2));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase entries of a table.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            Obj mX(bsl::less<int>(), &ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 1000; ++i) {
+                const int KEY = (i * 7919) % 1000;
+                ASSERTV(i, true  == mX.insert(KEY).second);
+                ASSERTV(i, false == mX.insert(KEY).second);
+            }
+            ASSERT(1000 == X.size());
+
+            for (int i = 0; i < 1000; ++i) {
+                ASSERTV(i, i == X.begin()[i]);
+                ASSERTV(i, X.contains(i));
+            }
+            ASSERT(!X.contains(-1));
+            ASSERT(!X.contains(1000));
+
+            const Obj Y(X, &ta);
+            ASSERT(X == Y);
+
+            for (int i = 0; i < 1000; i += 2) {
+                ASSERTV(i, 1 == mX.erase(i));
+            }
+            ASSERT(500 == X.size());
+            ASSERT(X != Y);
+            ASSERT(1 == *X.begin());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
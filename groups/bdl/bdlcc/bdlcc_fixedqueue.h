@@ -20,6 +20,8 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bdlcc::FixedQueue: thread-enabled fixed-size queue of 'TYPE' values
 //
+//@SEE_ALSO: bdlcc_queue, bdlcc_fixedqueueindexmanager
+//
 //@DESCRIPTION: This component defines a type, 'bdlcc::FixedQueue', that
 // provides an efficient, thread-enabled fixed-size queue of values.  This
 // class is ideal for synchronization and communication between threads in a
@@ -30,19 +32,39 @@ BSLS_IDENT("$Id: $")
 // when pushing), or underflow (queue empty when popping), the methods block
 // until data or free space in the queue appears.  Non-blocking methods
 // 'tryPushBack' and 'tryPushFront' are also provided, which fail immediately
-// returning a non-zero value in case of overflow or underflow.
+// returning a non-zero value in case of overflow or underflow.  Finally, the
+// 'timedPushBack' and 'timedPopFront' methods block until either the
+// operation can be performed or the specified timeout (expressed as an
+// absolute time from 00:00:00 UTC, January 1, 1970, as for 'bdlcc::Queue')
+// expires.
 //
 // The queue may be placed into a "disabled" state using the 'disable' method.
 // When disabled, 'pushBack' and 'tryPushBack' fail immediately (they do not
 // block and any blocked invocations will fail immediately).  The queue may be
 // restored to normal operation with the 'enable' method.
 //
-// Unlike 'bdlcc::Queue', a fixed queue is not double-ended, there is no timed
-// API like 'timedPushBack' and 'timedPopFront', and no 'forcePush' methods, as
-// the queue capacity is fixed.  Also, this component is not based on
-// 'bdlc::Queue', so there is no API for direct access to the underlying queue.
-// These limitations are a trade-off for significant gain in performance
-// compared to 'bdlcc::Queue'.
+// Unlike 'bdlcc::Queue', a fixed queue is not double-ended, and there are no
+// 'forcePush' methods, as the queue capacity is fixed.  Also, this component
+// is not based on 'bdlc::Queue', so there is no API for direct access to the
+// underlying queue.  These limitations are a trade-off for significant gain in
+// performance compared to 'bdlcc::Queue'.
+//
+///Comparison with 'bdlcc::Queue'
+///------------------------------
+// 'bdlcc::Queue' serializes every push and pop on a single mutex, and signals
+// a condition variable on every transition between empty and non-empty (or
+// full and non-full).  By contrast, 'bdlcc::FixedQueue' is lock-free: the
+// state of each cell of the underlying ring buffer is tracked by a per-cell
+// generation count and state maintained by 'bdlcc::FixedQueueIndexManager',
+// so that concurrent pushers and poppers each claim a distinct cell with a
+// single compare-and-swap operation.  Threads blocked in 'popFront',
+// 'timedPopFront', 'pushBack', or 'timedPushBack' wait on a semaphore that is
+// posted only when the number of waiting threads (maintained separately from
+// the ring buffer) is non-zero, so that in the common, non-blocking case a
+// push or pop performs no system call.  Clients of 'bdlcc::Queue' that use
+// only 'pushBack', 'popFront', 'tryPopFront', and 'timedPopFront' (and can
+// tolerate a bounded capacity) can therefore use a 'bdlcc::FixedQueue' as a
+// drop-in replacement.
 //
 ///Template Requirements
 ///---------------------
@@ -178,8 +200,8 @@ BSLS_IDENT("$Id: $")
 #include <bdlcc_fixedqueueindexmanager.h>
 #endif
 
-#ifndef INCLUDED_BSLMT_SEMAPHORE
-#include <bslmt_semaphore.h>
+#ifndef INCLUDED_BSLMT_TIMEDSEMAPHORE
+#include <bslmt_timedsemaphore.h>
 #endif
 
 #ifndef INCLUDED_BSLMT_THREADUTIL
@@ -218,6 +240,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_performancehint.h>
 #endif
 
+#ifndef INCLUDED_BSLS_TIMEINTERVAL
+#include <bsls_timeinterval.h>
+#endif
+
 #ifndef INCLUDED_BSLS_TYPES
 #include <bsls_types.h>
 #endif
@@ -248,7 +274,11 @@ class FixedQueue {
     enum {
         k_TYPE_PADDING = bslmt::Platform::e_CACHE_LINE_SIZE - sizeof(TYPE *),
         k_SEMA_PADDING = bslmt::Platform::e_CACHE_LINE_SIZE -
-                                                       sizeof(bslmt::Semaphore)
+                         sizeof(bslmt::TimedSemaphore) %
+                                            bslmt::Platform::e_CACHE_LINE_SIZE
+            // Note that 'bslmt::TimedSemaphore' may be larger than a cache
+            // line (e.g., where it is implemented with a mutex and a condition
+            // variable), so pad it to the next cache line boundary.
     };
 
     // DATA
@@ -268,7 +298,8 @@ class FixedQueue {
                                            // 'd_popControlSema' to pop an
                                            // element
 
-    bslmt::Semaphore  d_popControlSema;    // semaphore on which threads
+    bslmt::TimedSemaphore
+                      d_popControlSema;    // semaphore on which threads
                                            // waiting to pop 'wait'
 
     const char        d_popControlSemaPad[k_SEMA_PADDING];
@@ -278,7 +309,8 @@ class FixedQueue {
                                            // 'd_pushControlSema' to push an
                                            // element
 
-    bslmt::Semaphore  d_pushControlSema;   // semaphore on which threads
+    bslmt::TimedSemaphore
+                      d_pushControlSema;   // semaphore on which threads
                                            // waiting to push 'wait'
 
     const char        d_pushControlSemaPad[k_SEMA_PADDING];
@@ -317,6 +349,15 @@ class FixedQueue {
         // disabled.  Return 0 on success, and a nonzero value if the queue is
         // disabled.
 
+    int timedPushBack(const TYPE&               value,
+                      const bsls::TimeInterval& timeout);
+        // Append the specified 'value' to the back of this queue, blocking
+        // until either space is available - if necessary -, the queue is
+        // disabled, or the specified 'timeout' (expressed as the !ABSOLUTE!
+        // time from 00:00:00 UTC, January 1, 1970) expires.  Return 0 on
+        // success, a negative value if the queue is disabled, and a positive
+        // value if the call timed out before space was available.
+
     int tryPushBack(const TYPE& value);
         // Attempt to append the specified 'value' to the back of this queue
         // without blocking.  Return 0 on success, and a non-zero value if the
@@ -331,6 +372,15 @@ class FixedQueue {
         // Remove the element from the front of this queue and return it's
         // value.  If the queue is empty, block until it is not empty.
 
+    int timedPopFront(TYPE *value, const bsls::TimeInterval& timeout);
+        // Remove the element from the front of this queue and load that
+        // element into the specified 'value'.  If the queue is empty, block
+        // until it is not empty or until the specified 'timeout' (expressed
+        // as the !ABSOLUTE! time from 00:00:00 UTC, January 1, 1970) expires.
+        // Return 0 on success, and a non-zero value if the call timed out
+        // before an element was available.  On failure, 'value' is not
+        // changed.
+
     int tryPopFront(TYPE *value);
         // Attempt to remove the element from the front of this queue without
         // blocking, and, if successful, load the specified 'value' with the
@@ -639,6 +689,63 @@ void FixedQueue<TYPE>::popFront(TYPE *value)
     }
 }
 
+template <class TYPE>
+int FixedQueue<TYPE>::timedPushBack(const TYPE&               value,
+                                    const bsls::TimeInterval& timeout)
+{
+    int retval;
+    while (0 != (retval = tryPushBack(value))) {
+        if (retval < 0) {
+            // The queue is disabled.
+
+            return retval;                                            // RETURN
+        }
+
+        d_numWaitingPushers.addRelaxed(1);
+
+        // SYNCHRONIZATION POINT 1-Prime (see 'pushBack')
+
+        if (isFull() && isEnabled()) {
+            if (0 != d_pushControlSema.timedWait(timeout)) {
+                d_numWaitingPushers.addRelaxed(-1);
+                return 1;                                             // RETURN
+            }
+        }
+
+        d_numWaitingPushers.addRelaxed(-1);
+    }
+
+    return 0;
+}
+
+template <class TYPE>
+int FixedQueue<TYPE>::timedPopFront(TYPE                      *value,
+                                    const bsls::TimeInterval&  timeout)
+{
+    while (0 != tryPopFront(value)) {
+        d_numWaitingPoppers.addRelaxed(1);
+
+        // SYNCHRONIZATION POINT 2-Prime (see 'popFront')
+
+        if (isEmpty()) {
+            if (0 != d_popControlSema.timedWait(timeout)) {
+                d_numWaitingPoppers.addRelaxed(-1);
+
+                // A wake-up posted concurrently with the expiration of the
+                // timeout is left on the semaphore; at worst it causes a
+                // spurious wake-up of another waiting thread, which simply
+                // retries.
+
+                return 1;                                             // RETURN
+            }
+        }
+
+        d_numWaitingPoppers.addRelaxed(-1);
+    }
+
+    return 0;
+}
+
 template <class TYPE>
 TYPE FixedQueue<TYPE>::popFront()
 {
@@ -1081,6 +1081,32 @@ void runtest(int numIterations, int numPushers, int numPoppers)
     }
 //..
 
+// ============================================================================
+//                      HELPER FUNCTIONS FOR TEST CASE 18
+// ----------------------------------------------------------------------------
+
+void timedPopFrontJob(bdlcc::FixedQueue<int>    *queue,
+                      int                       *value,
+                      const bsls::TimeInterval&  timeout,
+                      int                       *result)
+    // Invoke 'timedPopFront' on the specified 'queue' with the specified
+    // 'value' and 'timeout', and load the return value into the specified
+    // 'result'.
+{
+    *result = queue->timedPopFront(value, timeout);
+}
+
+void timedPushBackJob(bdlcc::FixedQueue<int>    *queue,
+                      int                        value,
+                      const bsls::TimeInterval&  timeout,
+                      int                       *result)
+    // Invoke 'timedPushBack' on the specified 'queue' with the specified
+    // 'value' and 'timeout', and load the return value into the specified
+    // 'result'.
+{
+    *result = queue->timedPushBack(value, timeout);
+}
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1098,7 +1124,7 @@ int main(int argc, char *argv[])
                     bslmt::Configuration::recommendedDefaultThreadStackSize());
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 18: {
+      case 19: {
         // ---------------------------------------------------------
         // Usage example test
         //
@@ -1114,6 +1140,115 @@ int main(int argc, char *argv[])
         break;
       }
 
+      case 18: {
+        // ---------------------------------------------------------
+        // 'timedPushBack' and 'timedPopFront' test
+        //
+        // Concerns:
+        //: 1 'timedPopFront' on an empty queue fails no sooner than the
+        //:   specified absolute timeout, leaving 'value' unchanged.
+        //:
+        //: 2 'timedPushBack' on a full queue fails with a positive value no
+        //:   sooner than the specified timeout, and with a negative value if
+        //:   the queue is disabled.
+        //:
+        //: 3 A thread blocked in 'timedPopFront' ('timedPushBack') is woken
+        //:   up as soon as an element (free cell) becomes available.
+        //
+        // Plan:
+        //: 1 Call the timed methods on empty and full queues with a short
+        //:   timeout and verify the return values and elapsed time.  (C-1..2)
+        //:
+        //: 2 Block a thread in a timed method with a long timeout, make the
+        //:   operation possible from the main thread, and verify the blocked
+        //:   call succeeds well before its timeout.  (C-3)
+        // ---------------------------------------------------------
+
+        if (verbose) cout << endl
+                         << "'timedPushBack' and 'timedPopFront' test" << endl
+                         << "========================================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            enum { k_CAPACITY = 2 };
+
+            bdlcc::FixedQueue<int> mX(k_CAPACITY, &ta);
+
+            const bsls::TimeInterval SHORT(0, 100 * 1000 * 1000);  // 100ms
+
+            int value = -1;
+
+            bsls::TimeInterval start = bdlt::CurrentTime::now();
+            ASSERT(0 != mX.timedPopFront(&value, start + SHORT));
+            ASSERT(bdlt::CurrentTime::now() >= start + SHORT);
+            ASSERT(-1 == value);
+
+            ASSERT(0 == mX.timedPushBack(1, start + SHORT));
+            ASSERT(0 == mX.timedPushBack(2, start + SHORT));
+            ASSERT(mX.isFull());
+
+            start = bdlt::CurrentTime::now();
+            ASSERT(0 <  mX.timedPushBack(3, start + SHORT));
+            ASSERT(bdlt::CurrentTime::now() >= start + SHORT);
+            ASSERT(2 == mX.numElements());
+
+            mX.disable();
+            ASSERT(0 >  mX.timedPushBack(3, start + SHORT));
+            mX.enable();
+
+            ASSERT(0 == mX.timedPopFront(&value, start + SHORT));
+            ASSERT(1 == value);
+            ASSERT(0 == mX.timedPopFront(&value, start + SHORT));
+            ASSERT(2 == value);
+            ASSERT(mX.isEmpty());
+
+            if (verbose) cout << "\tWake-up of a blocked popper." << endl;
+
+            const bsls::TimeInterval LONG(30, 0);
+
+            bslmt::ThreadUtil::Handle handle;
+            int                       rc;
+            value = -1;
+
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                        &handle,
+                        bdlf::BindUtil::bind(&timedPopFrontJob,
+                                             &mX,
+                                             &value,
+                                             bdlt::CurrentTime::now() + LONG,
+                                             &rc)));
+            bslmt::ThreadUtil::microSleep(50 * 1000);
+
+            start = bdlt::CurrentTime::now();
+            ASSERT(0 == mX.pushBack(42));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+            ASSERT(0  == rc);
+            ASSERT(42 == value);
+            ASSERT(bdlt::CurrentTime::now() < start + LONG);
+
+            if (verbose) cout << "\tWake-up of a blocked pusher." << endl;
+
+            ASSERT(0 == mX.pushBack(1));
+            ASSERT(0 == mX.pushBack(2));
+
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                        &handle,
+                        bdlf::BindUtil::bind(&timedPushBackJob,
+                                             &mX,
+                                             3,
+                                             bdlt::CurrentTime::now() + LONG,
+                                             &rc)));
+            bslmt::ThreadUtil::microSleep(50 * 1000);
+
+            ASSERT(1 == mX.popFront());
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+            ASSERT(0 == rc);
+            ASSERT(2 == mX.popFront());
+            ASSERT(3 == mX.popFront());
+            ASSERT(mX.isEmpty());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
       case 17: {
 #ifdef BDE_BUILD_TARGET_EXC
         // ---------------------------------------------------------
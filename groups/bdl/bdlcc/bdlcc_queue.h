@@ -20,7 +20,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //   bdlcc::Queue: thread-enabled 'bdlc::Queue' wrapper
 //
-//@SEE_ALSO: bdlc_queue
+//@SEE_ALSO: bdlc_queue, bdlcc_fixedqueue
 //
 //@DEPRECATED: use 'bdlcc::Deque' instead.
 //
@@ -0,0 +1,996 @@
+// bdlcc_spscqueue.h                                                  -*-C++-*-
+#ifndef INCLUDED_BDLCC_SPSCQUEUE
+#define INCLUDED_BDLCC_SPSCQUEUE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a wait-free single-producer/single-consumer queue.
+//
+//@CLASSES:
+//  bdlcc::SpscQueue: fixed-size, single-producer/single-consumer queue
+//
+//@SEE_ALSO: bdlcc_fixedqueue
+//
+//@DESCRIPTION: This component defines a class template, 'bdlcc::SpscQueue',
+// that provides a fixed-size queue of values for the case where exactly one
+// thread pushes values into the queue (the *producer*) and exactly one thread
+// pops values from the queue (the *consumer*).  Within that restriction the
+// non-blocking operations of a 'bdlcc::SpscQueue' are wait-free: each
+// completes in a bounded number of steps, with no compare-and-swap loops and
+// no locks.
+//
+// 'bdlcc::FixedQueue' is the appropriate choice when several threads push or
+// pop concurrently.  When a queue connects a single producer to a single
+// consumer (e.g., a thread reading from a socket feeding a thread that parses
+// the data read), the per-cell state transitions that 'bdlcc::FixedQueue'
+// performs to arbitrate between competing threads are pure overhead, and
+// 'bdlcc::SpscQueue' should be preferred.
+//
+///Thread Safety
+///-------------
+// At any one time, at most one thread may invoke the "push" manipulators
+// ('pushBack' and 'tryPushBack') and at most one (other) thread may invoke the
+// "pop" manipulators ('popFront' and 'tryPopFront').  The accessors may be
+// invoked from any thread, but note that the values they return may be stale
+// by the time they are examined.  The behavior is undefined if two threads
+// concurrently push, or two threads concurrently pop.  Note that the producer
+// and consumer roles are not bound to a particular thread; a role may move
+// from one thread to another provided that the hand-off is itself properly
+// synchronized (e.g., by 'bslmt::ThreadUtil::join').
+//
+///Implementation
+///--------------
+// The queue is a ring buffer indexed by two monotonically increasing 64-bit
+// counters: the *push* *index*, which is modified only by the producer, and
+// the *pop* *index*, which is modified only by the consumer.  The producer
+// publishes newly pushed elements by storing the push index; the consumer
+// publishes free cells by storing the pop index (see {Blocking Operations} for
+// why these stores are sequentially consistent).  Each index resides on its
+// own cache line, alongside a private cached copy of the other party's index,
+// so that the producer and the consumer touch a shared cache line only when
+// the cached copy indicates that there is not enough room (respectively, not
+// enough elements) for the requested operation.
+//
+// The number of cells in the ring buffer is the requested capacity rounded up
+// to a power of two, so that an index can be mapped to a cell with a mask
+// rather than a division; the capacity reported by 'capacity' (and enforced
+// by the push manipulators) is exactly the one supplied at construction.
+//
+///Batch Operations
+///----------------
+// The range overloads of 'pushBack' and 'tryPushBack' construct a sequence of
+// elements and then publish them with a single store to the push index, and
+// the overloads of 'popFront' and 'tryPopFront' taking a maximum number of
+// elements consume up to that number of elements and then release their cells
+// with a single store to the pop index.  Batching therefore amortizes the
+// cost of the cross-core cache-line transfers over many elements, which is
+// where most of the time of a queue operation is spent when the producer and
+// consumer run on different cores.
+//
+///Blocking Operations
+///-------------------
+// 'pushBack' and 'popFront' block until they can complete.  A producer
+// finding the queue full (or a consumer finding it empty) first yields the
+// processor (see 'bslmt::ThreadUtil::yield') a bounded number of times,
+// re-examining the queue after each yield, so that short waits incur no
+// synchronization.  If the queue is still full (empty), the party raises a
+// *waiting* *flag* and then waits on a semaphore, which the other party posts
+// after it next publishes free cells (elements) and observes the flag.  The
+// waiting flags reside on a cache line of their own that is written only by
+// a party about to block, so that, as long as neither party blocks, each
+// publication costs a single additional (uncontended) load, and no system
+// call.  Note that the publication of an index and the inspection of the flag
+// are sequentially consistent, so that a wake-up cannot be lost.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Producer/Consumer Pipeline
+///- - - - - - - - - - - - - - - - - - - -
+// In this example, a producer thread passes a sequence of integers to a
+// consumer thread, which sums them, using a 'bdlcc::SpscQueue'.
+//
+// First, we define the function run by the producer, which pushes the
+// integers '[1 .. 1000]' into the queue, followed by a terminating '0':
+//..
+//  void producer(bdlcc::SpscQueue<int> *queue)
+//  {
+//      for (int i = 1; i <= 1000; ++i) {
+//          queue->pushBack(i);
+//      }
+//      queue->pushBack(0);
+//  }
+//..
+// Then, we define the function run by the consumer, which drains the queue in
+// batches of up to 64 elements into a local buffer, and accumulates the
+// elements until it encounters the terminating '0':
+//..
+//  void consumer(bdlcc::SpscQueue<int> *queue, int *sum)
+//  {
+//      int buffer[64];
+//      *sum = 0;
+//      while (true) {
+//          bsl::size_t n = queue->popFront(buffer, 64);
+//          for (bsl::size_t i = 0; i < n; ++i) {
+//              if (0 == buffer[i]) {
+//                  return;                                           // RETURN
+//              }
+//              *sum += buffer[i];
+//          }
+//      }
+//  }
+//..
+// Finally, we create a queue having a capacity of 256 elements, and run the
+// producer and the consumer in two separate threads:
+//..
+//  bdlcc::SpscQueue<int> queue(256);
+//  int                   sum = 0;
+//
+//  bslmt::ThreadUtil::Handle producerHandle, consumerHandle;
+//  bslmt::ThreadUtil::create(&producerHandle,
+//                            bdlf::BindUtil::bind(&producer, &queue));
+//  bslmt::ThreadUtil::create(&consumerHandle,
+//                            bdlf::BindUtil::bind(&consumer, &queue, &sum));
+//
+//  bslmt::ThreadUtil::join(producerHandle);
+//  bslmt::ThreadUtil::join(consumerHandle);
+//
+//  assert(500500 == sum);
+//  assert(queue.isEmpty());
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARDESTRUCTIONPRIMITIVES
+#include <bslalg_scalardestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_PLATFORM
+#include <bslmt_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_SEMAPHORE
+#include <bslmt_semaphore.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_THREADUTIL
+#include <bslmt_threadutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlcc {
+
+template <class TYPE> class SpscQueue_PopGuard;
+template <class TYPE> class SpscQueue_PushGuard;
+
+                              // ===============
+                              // class SpscQueue
+                              // ===============
+
+template <class TYPE>
+class SpscQueue {
+    // This class provides a wait-free, fixed-size queue of values for use by a
+    // single producer thread and a single consumer thread.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsls::Types::Int64 Int64;
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_CACHE_LINE_SIZE = bslmt::Platform::e_CACHE_LINE_SIZE,
+
+        k_SHARED_PADDING  = k_CACHE_LINE_SIZE
+                          - sizeof(TYPE *)
+                          - 2 * sizeof(Int64)
+                          - sizeof(bslma::Allocator *),
+
+        k_INDEX_PADDING   = k_CACHE_LINE_SIZE
+                          - sizeof(bsls::AtomicInt64)
+                          - sizeof(Int64),
+
+        k_WAITING_PADDING = k_CACHE_LINE_SIZE
+                          - 2 * sizeof(bsls::AtomicInt),
+
+        k_NUM_SPINS       = 64  // number of times a blocking operation
+                                // yields before waiting on a semaphore
+    };
+
+    // DATA
+
+    // Read-only state, shared by both parties.
+
+    TYPE              *d_elements;         // ring buffer of 'd_mask + 1'
+                                           // (uninitialized) cells
+
+    Int64              d_capacity;         // maximum number of elements
+
+    Int64              d_mask;             // number of cells minus one
+
+    bslma::Allocator  *d_allocator_p;      // allocator (held, not owned)
+
+    const char         d_sharedPad[k_SHARED_PADDING];
+
+    // Producer state.
+
+    bsls::AtomicInt64  d_pushIndex;        // number of elements ever pushed;
+                                           // written only by the producer
+
+    Int64              d_cachedPopIndex;   // producer's copy of 'd_popIndex',
+                                           // possibly stale (low)
+
+    const char         d_pushIndexPad[k_INDEX_PADDING];
+
+    // Consumer state.
+
+    bsls::AtomicInt64  d_popIndex;         // number of elements ever popped;
+                                           // written only by the consumer
+
+    Int64              d_cachedPushIndex;  // consumer's copy of
+                                           // 'd_pushIndex', possibly stale
+                                           // (low)
+
+    const char         d_popIndexPad[k_INDEX_PADDING];
+
+    // Blocking state, written only by a party about to block (or by the
+    // other party, to wake it up).
+
+    bsls::AtomicInt    d_producerWaiting;  // 1 if the producer is (about to
+                                           // be) waiting on 'd_pushSemaphore',
+                                           // and 0 otherwise
+
+    bsls::AtomicInt    d_consumerWaiting;  // 1 if the consumer is (about to
+                                           // be) waiting on 'd_popSemaphore',
+                                           // and 0 otherwise
+
+    const char         d_waitingPad[k_WAITING_PADDING];
+
+    bslmt::Semaphore   d_pushSemaphore;    // posted by the consumer to wake
+                                           // up the waiting producer
+
+    bslmt::Semaphore   d_popSemaphore;     // posted by the producer to wake
+                                           // up the waiting consumer
+
+    // FRIENDS
+    friend class SpscQueue_PopGuard<TYPE>;
+    friend class SpscQueue_PushGuard<TYPE>;
+
+    // NOT IMPLEMENTED
+    SpscQueue(const SpscQueue&);
+    SpscQueue& operator=(const SpscQueue&);
+
+    // PRIVATE MANIPULATORS
+    Int64 availableToPop(Int64 numWanted);
+        // Return the number of elements that the consumer may pop without
+        // blocking, refreshing the cached copy of the push index only if the
+        // cached copy indicates that fewer than the specified 'numWanted'
+        // elements are available.  The behavior is undefined unless invoked
+        // by the consumer.
+
+    Int64 availableToPush(Int64 numWanted);
+        // Return the number of cells into which the producer may push without
+        // blocking, refreshing the cached copy of the pop index only if the
+        // cached copy indicates that fewer than the specified 'numWanted'
+        // cells are free.  The behavior is undefined unless invoked by the
+        // producer.
+
+    void publishPopIndex(Int64 popIndex);
+        // Make the cells of the elements preceding the specified 'popIndex'
+        // available to the producer, and wake up the producer if it is
+        // waiting.  The behavior is undefined unless invoked by the consumer.
+
+    void publishPushIndex(Int64 pushIndex);
+        // Make the elements preceding the specified 'pushIndex' available to
+        // the consumer, and wake up the consumer if it is waiting.  The
+        // behavior is undefined unless invoked by the producer.
+
+    template <class INPUT_ITERATOR>
+    bsl::size_t pushAvailable(INPUT_ITERATOR *begin, INPUT_ITERATOR end);
+        // Append as many elements of the range '[*begin .. end)' as this
+        // queue has room for, in order, without blocking, advance the
+        // specified '*begin' past the appended elements, and make them
+        // visible to the consumer with a single store.  Return the number of
+        // elements appended.  The behavior is undefined unless invoked by the
+        // producer and '[*begin .. end)' is a valid range.
+
+    void waitToPop();
+        // Block until at least one element is available to the consumer.
+        // The behavior is undefined unless invoked by the consumer.
+
+    void waitToPush();
+        // Block until at least one cell is available to the producer.  The
+        // behavior is undefined unless invoked by the producer.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(SpscQueue, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit
+    SpscQueue(bsl::size_t capacity, bslma::Allocator *basicAllocator = 0);
+        // Create an empty queue having the specified 'capacity'.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '0 < capacity'.
+
+    ~SpscQueue();
+        // Destroy this queue and all the elements it contains.  The behavior
+        // is undefined unless neither the producer nor the consumer is
+        // accessing this queue.
+
+    // MANIPULATORS
+    void pushBack(const TYPE& value);
+        // Append the specified 'value' to the back of this queue, blocking
+        // until space is available if this queue is full.  The behavior is
+        // undefined unless invoked by the producer.
+
+    template <class INPUT_ITERATOR>
+    void pushBack(INPUT_ITERATOR begin, INPUT_ITERATOR end);
+        // Append the elements in the specified range '[begin .. end)' to the
+        // back of this queue, in order, blocking as needed until space is
+        // available for all of them.  Elements are made visible to the
+        // consumer in batches as space permits, each batch with a single
+        // store.  The behavior is undefined unless invoked by the producer
+        // and '[begin .. end)' is a valid range.
+
+    int tryPushBack(const TYPE& value);
+        // Attempt to append the specified 'value' to the back of this queue
+        // without blocking.  Return 0 on success, and a non-zero value if
+        // this queue is full.  The behavior is undefined unless invoked by the
+        // producer.
+
+    template <class INPUT_ITERATOR>
+    bsl::size_t tryPushBack(INPUT_ITERATOR begin, INPUT_ITERATOR end);
+        // Append as many elements of the specified range '[begin .. end)' as
+        // this queue has room for, in order, without blocking, and make them
+        // visible to the consumer with a single store.  Return the number of
+        // elements appended, which is the length of a prefix of the range.
+        // The behavior is undefined unless invoked by the producer and
+        // '[begin .. end)' is a valid range.
+
+    void popFront(TYPE *value);
+        // Remove the element from the front of this queue and load that
+        // element into the specified 'value', blocking until an element is
+        // available if this queue is empty.  The behavior is undefined unless
+        // invoked by the consumer.
+
+    template <class OUTPUT_ITERATOR>
+    bsl::size_t popFront(OUTPUT_ITERATOR result, bsl::size_t maxNumElements);
+        // Remove up to the specified 'maxNumElements' elements from the front
+        // of this queue, assigning them in order to the sequence beginning at
+        // the specified 'result', blocking until at least one element is
+        // available if this queue is empty.  Return the number of elements
+        // removed.  The cells of the removed elements are released to the
+        // producer with a single store.  The behavior is undefined unless
+        // invoked by the consumer, '0 < maxNumElements', and 'result' refers
+        // to a sequence that can be assigned 'maxNumElements' elements.
+
+    int tryPopFront(TYPE *value);
+        // Attempt to remove the element from the front of this queue without
+        // blocking, and, if successful, load that element into the specified
+        // 'value'.  Return 0 on success, and a non-zero value if this queue is
+        // empty.  The behavior is undefined unless invoked by the consumer.
+
+    template <class OUTPUT_ITERATOR>
+    bsl::size_t tryPopFront(OUTPUT_ITERATOR result,
+                            bsl::size_t     maxNumElements);
+        // Remove up to the specified 'maxNumElements' elements from the front
+        // of this queue without blocking, assigning them in order to the
+        // sequence beginning at the specified 'result'.  Return the number of
+        // elements removed, which is 0 if this queue is empty.  The cells of
+        // the removed elements are released to the producer with a single
+        // store.  The behavior is undefined unless invoked by the consumer and
+        // 'result' refers to a sequence that can be assigned 'maxNumElements'
+        // elements.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the maximum number of elements that may be held by this
+        // queue.
+
+    bool isEmpty() const;
+        // Return 'true' if this queue is empty (has no elements), and 'false'
+        // otherwise.
+
+    bool isFull() const;
+        // Return 'true' if this queue is full (has no available capacity), and
+        // 'false' otherwise.
+
+    bsl::size_t numElements() const;
+        // Return the number of elements held by this queue.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this queue to supply memory.
+};
+
+                         // ========================
+                         // class SpscQueue_PopGuard
+                         // ========================
+
+template <class TYPE>
+class SpscQueue_PopGuard {
+    // This class provides a guard that, upon its destruction, releases to the
+    // producer the cells of the elements that the consumer has popped from
+    // the 'SpscQueue' object supplied at construction.  Note that this guard
+    // is used to provide exception safety when popping elements from an
+    // 'SpscQueue' object: if assigning a popped element throws, the elements
+    // successfully popped before it are still removed from the queue.
+
+    // DATA
+    SpscQueue<TYPE>    *d_parent_p;  // queue from which elements are popped
+    bsls::Types::Int64  d_popIndex;  // index of the next element to pop
+
+  private:
+    // NOT IMPLEMENTED
+    SpscQueue_PopGuard(const SpscQueue_PopGuard&);
+    SpscQueue_PopGuard& operator=(const SpscQueue_PopGuard&);
+
+  public:
+    // CREATORS
+    explicit SpscQueue_PopGuard(SpscQueue<TYPE> *queue);
+        // Create a guard for popping elements from the front of the specified
+        // 'queue'.
+
+    ~SpscQueue_PopGuard();
+        // Publish the cells of all the elements popped through this guard as
+        // free, and destroy this guard.
+
+    // MANIPULATORS
+    template <class OUTPUT_ITERATOR>
+    void pop(OUTPUT_ITERATOR *result);
+        // Assign the element at the front of the queue supplied at
+        // construction to '**result', destroy that element, and increment
+        // '*result'.  The popped cell is not made available to the producer
+        // until this guard is destroyed.  The behavior is undefined unless
+        // the queue holds an element that has not yet been popped through
+        // this guard.
+};
+
+                         // =========================
+                         // class SpscQueue_PushGuard
+                         // =========================
+
+template <class TYPE>
+class SpscQueue_PushGuard {
+    // This class provides a guard that, upon its destruction, publishes to
+    // the consumer the elements that the producer has pushed into the
+    // 'SpscQueue' object supplied at construction.  Note that this guard is
+    // used to provide exception safety when pushing elements into an
+    // 'SpscQueue' object: if copying an element throws, the elements
+    // successfully pushed before it are still added to the queue.
+
+    // DATA
+    SpscQueue<TYPE>    *d_parent_p;   // queue into which elements are pushed
+    bsls::Types::Int64  d_pushIndex;  // index of the next element to push
+
+  private:
+    // NOT IMPLEMENTED
+    SpscQueue_PushGuard(const SpscQueue_PushGuard&);
+    SpscQueue_PushGuard& operator=(const SpscQueue_PushGuard&);
+
+  public:
+    // CREATORS
+    explicit SpscQueue_PushGuard(SpscQueue<TYPE> *queue);
+        // Create a guard for pushing elements onto the back of the specified
+        // 'queue'.
+
+    ~SpscQueue_PushGuard();
+        // Publish all the elements pushed through this guard to the consumer,
+        // and destroy this guard.
+
+    // MANIPULATORS
+    void push(const TYPE& value);
+        // Copy-construct the specified 'value' into the cell at the back of
+        // the queue supplied at construction.  The element is not made
+        // available to the consumer until this guard is destroyed.  The
+        // behavior is undefined unless the queue has a free cell that has not
+        // yet been filled through this guard.
+
+    // ACCESSORS
+    bsls::Types::Int64 numPushed() const;
+        // Return the number of elements pushed through this guard.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                              // ---------------
+                              // class SpscQueue
+                              // ---------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+inline
+typename SpscQueue<TYPE>::Int64
+SpscQueue<TYPE>::availableToPop(Int64 numWanted)
+{
+    const Int64 popIndex = d_popIndex.loadRelaxed();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                d_cachedPushIndex - popIndex < numWanted)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        d_cachedPushIndex = d_pushIndex.loadAcquire();
+    }
+    return d_cachedPushIndex - popIndex;
+}
+
+template <class TYPE>
+inline
+typename SpscQueue<TYPE>::Int64
+SpscQueue<TYPE>::availableToPush(Int64 numWanted)
+{
+    const Int64 pushIndex = d_pushIndex.loadRelaxed();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                 d_capacity - (pushIndex - d_cachedPopIndex) < numWanted)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        d_cachedPopIndex = d_popIndex.loadAcquire();
+    }
+    return d_capacity - (pushIndex - d_cachedPopIndex);
+}
+
+template <class TYPE>
+inline
+void SpscQueue<TYPE>::publishPopIndex(Int64 popIndex)
+{
+    // The store to 'd_popIndex' and the load of 'd_producerWaiting' must not
+    // be reordered (see 'waitToPush'), hence sequential consistency.
+
+    d_popIndex = popIndex;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_producerWaiting.load())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        if (d_producerWaiting.swap(0)) {
+            d_pushSemaphore.post();
+        }
+    }
+}
+
+template <class TYPE>
+inline
+void SpscQueue<TYPE>::publishPushIndex(Int64 pushIndex)
+{
+    // The store to 'd_pushIndex' and the load of 'd_consumerWaiting' must not
+    // be reordered (see 'waitToPop'), hence sequential consistency.
+
+    d_pushIndex = pushIndex;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_consumerWaiting.load())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        if (d_consumerWaiting.swap(0)) {
+            d_popSemaphore.post();
+        }
+    }
+}
+
+template <class TYPE>
+template <class INPUT_ITERATOR>
+bsl::size_t SpscQueue<TYPE>::pushAvailable(INPUT_ITERATOR *begin,
+                                           INPUT_ITERATOR  end)
+{
+    Int64 available = availableToPush(1);
+
+    SpscQueue_PushGuard<TYPE> guard(this);
+    while (*begin != end) {
+        if (guard.numPushed() == available) {
+            available = availableToPush(available + 1);
+            if (guard.numPushed() == available) {
+                break;
+            }
+        }
+        guard.push(**begin);
+        ++*begin;
+    }
+    return static_cast<bsl::size_t>(guard.numPushed());
+}
+
+template <class TYPE>
+void SpscQueue<TYPE>::waitToPop()
+{
+    for (int i = 0; i < k_NUM_SPINS; ++i) {
+        if (0 != availableToPop(1)) {
+            return;                                                   // RETURN
+        }
+        bslmt::ThreadUtil::yield();
+    }
+
+    while (true) {
+        // Raise the flag, then check the push index again, so that either
+        // the producer observes the flag after publishing an element, or the
+        // element is observed here.
+
+        d_consumerWaiting = 1;
+        d_cachedPushIndex = d_pushIndex.load();
+
+        if (d_cachedPushIndex != d_popIndex.loadRelaxed()) {
+            if (0 == d_consumerWaiting.swap(0)) {
+                // The producer has cleared the flag, and posts (or has
+                // posted) the semaphore; absorb that post.
+
+                d_popSemaphore.wait();
+            }
+            return;                                                   // RETURN
+        }
+
+        d_popSemaphore.wait();
+
+        if (0 != availableToPop(1)) {
+            return;                                                   // RETURN
+        }
+    }
+}
+
+template <class TYPE>
+void SpscQueue<TYPE>::waitToPush()
+{
+    for (int i = 0; i < k_NUM_SPINS; ++i) {
+        if (0 != availableToPush(1)) {
+            return;                                                   // RETURN
+        }
+        bslmt::ThreadUtil::yield();
+    }
+
+    while (true) {
+        // Raise the flag, then check the pop index again, so that either the
+        // consumer observes the flag after publishing a free cell, or the
+        // free cell is observed here.
+
+        d_producerWaiting = 1;
+        d_cachedPopIndex = d_popIndex.load();
+
+        if (d_pushIndex.loadRelaxed() - d_cachedPopIndex < d_capacity) {
+            if (0 == d_producerWaiting.swap(0)) {
+                // The consumer has cleared the flag, and posts (or has
+                // posted) the semaphore; absorb that post.
+
+                d_pushSemaphore.wait();
+            }
+            return;                                                   // RETURN
+        }
+
+        d_pushSemaphore.wait();
+
+        if (0 != availableToPush(1)) {
+            return;                                                   // RETURN
+        }
+    }
+}
+
+// CREATORS
+template <class TYPE>
+SpscQueue<TYPE>::SpscQueue(bsl::size_t       capacity,
+                           bslma::Allocator *basicAllocator)
+: d_elements(0)
+, d_capacity(static_cast<Int64>(capacity))
+, d_mask(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_sharedPad()
+, d_pushIndex(0)
+, d_cachedPopIndex(0)
+, d_pushIndexPad()
+, d_popIndex(0)
+, d_cachedPushIndex(0)
+, d_popIndexPad()
+, d_producerWaiting(0)
+, d_consumerWaiting(0)
+, d_waitingPad()
+{
+    BSLS_ASSERT(0 < capacity);
+
+    Int64 numCells = 1;
+    while (numCells < d_capacity) {
+        numCells <<= 1;
+    }
+    d_mask     = numCells - 1;
+    d_elements = static_cast<TYPE *>(d_allocator_p->allocate(
+                                 static_cast<bsl::size_t>(numCells) *
+                                                                sizeof(TYPE)));
+}
+
+template <class TYPE>
+SpscQueue<TYPE>::~SpscQueue()
+{
+    const Int64 pushIndex = d_pushIndex.loadAcquire();
+    for (Int64 i = d_popIndex.loadRelaxed(); i != pushIndex; ++i) {
+        bslalg::ScalarDestructionPrimitives::destroy(
+                                                 d_elements + (i & d_mask));
+    }
+    d_allocator_p->deallocate(d_elements);
+}
+
+// MANIPULATORS
+template <class TYPE>
+void SpscQueue<TYPE>::pushBack(const TYPE& value)
+{
+    while (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 != tryPushBack(value))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        waitToPush();
+    }
+}
+
+template <class TYPE>
+template <class INPUT_ITERATOR>
+void SpscQueue<TYPE>::pushBack(INPUT_ITERATOR begin, INPUT_ITERATOR end)
+{
+    while (begin != end) {
+        if (0 == pushAvailable(&begin, end)) {
+            waitToPush();
+        }
+    }
+}
+
+template <class TYPE>
+int SpscQueue<TYPE>::tryPushBack(const TYPE& value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == availableToPush(1))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 1;                                                     // RETURN
+    }
+
+    SpscQueue_PushGuard<TYPE> guard(this);
+    guard.push(value);
+    return 0;
+}
+
+template <class TYPE>
+template <class INPUT_ITERATOR>
+inline
+bsl::size_t SpscQueue<TYPE>::tryPushBack(INPUT_ITERATOR begin,
+                                         INPUT_ITERATOR end)
+{
+    return pushAvailable(&begin, end);
+}
+
+template <class TYPE>
+void SpscQueue<TYPE>::popFront(TYPE *value)
+{
+    BSLS_ASSERT(value);
+
+    while (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 != tryPopFront(value))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        waitToPop();
+    }
+}
+
+template <class TYPE>
+template <class OUTPUT_ITERATOR>
+bsl::size_t SpscQueue<TYPE>::popFront(OUTPUT_ITERATOR result,
+                                      bsl::size_t     maxNumElements)
+{
+    BSLS_ASSERT(0 < maxNumElements);
+
+    bsl::size_t numPopped;
+    while (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                    0 == (numPopped = tryPopFront(result, maxNumElements)))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        waitToPop();
+    }
+    return numPopped;
+}
+
+template <class TYPE>
+int SpscQueue<TYPE>::tryPopFront(TYPE *value)
+{
+    BSLS_ASSERT(value);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == availableToPop(1))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 1;                                                     // RETURN
+    }
+
+    SpscQueue_PopGuard<TYPE> guard(this);
+    guard.pop(&value);
+    return 0;
+}
+
+template <class TYPE>
+template <class OUTPUT_ITERATOR>
+bsl::size_t SpscQueue<TYPE>::tryPopFront(OUTPUT_ITERATOR result,
+                                         bsl::size_t     maxNumElements)
+{
+    const Int64 numWanted = static_cast<Int64>(maxNumElements);
+
+    Int64 numToPop = availableToPop(numWanted);
+    if (numToPop > numWanted) {
+        numToPop = numWanted;
+    }
+
+    SpscQueue_PopGuard<TYPE> guard(this);
+    for (Int64 i = 0; i < numToPop; ++i) {
+        guard.pop(&result);
+    }
+    return static_cast<bsl::size_t>(numToPop);
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+bsl::size_t SpscQueue<TYPE>::capacity() const
+{
+    return static_cast<bsl::size_t>(d_capacity);
+}
+
+template <class TYPE>
+inline
+bool SpscQueue<TYPE>::isEmpty() const
+{
+    return 0 == numElements();
+}
+
+template <class TYPE>
+inline
+bool SpscQueue<TYPE>::isFull() const
+{
+    return capacity() == numElements();
+}
+
+template <class TYPE>
+inline
+bsl::size_t SpscQueue<TYPE>::numElements() const
+{
+    // Load the pop index first: both indices only increase, so the pop index
+    // loaded can never exceed the push index loaded afterwards.
+
+    const Int64 popIndex  = d_popIndex.loadAcquire();
+    const Int64 pushIndex = d_pushIndex.loadAcquire();
+    const Int64 length    = pushIndex - popIndex;
+
+    return static_cast<bsl::size_t>(length < d_capacity ? length
+                                                        : d_capacity);
+}
+
+                                  // Aspects
+
+template <class TYPE>
+inline
+bslma::Allocator *SpscQueue<TYPE>::allocator() const
+{
+    return d_allocator_p;
+}
+
+                         // ------------------------
+                         // class SpscQueue_PopGuard
+                         // ------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+SpscQueue_PopGuard<TYPE>::SpscQueue_PopGuard(SpscQueue<TYPE> *queue)
+: d_parent_p(queue)
+, d_popIndex(queue->d_popIndex.loadRelaxed())
+{
+}
+
+template <class TYPE>
+inline
+SpscQueue_PopGuard<TYPE>::~SpscQueue_PopGuard()
+{
+    if (d_popIndex != d_parent_p->d_popIndex.loadRelaxed()) {
+        d_parent_p->publishPopIndex(d_popIndex);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+template <class OUTPUT_ITERATOR>
+inline
+void SpscQueue_PopGuard<TYPE>::pop(OUTPUT_ITERATOR *result)
+{
+    TYPE *element = d_parent_p->d_elements + (d_popIndex & d_parent_p->d_mask);
+
+    **result = *element;
+    ++*result;
+
+    bslalg::ScalarDestructionPrimitives::destroy(element);
+    ++d_popIndex;
+}
+
+                         // -------------------------
+                         // class SpscQueue_PushGuard
+                         // -------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+SpscQueue_PushGuard<TYPE>::SpscQueue_PushGuard(SpscQueue<TYPE> *queue)
+: d_parent_p(queue)
+, d_pushIndex(queue->d_pushIndex.loadRelaxed())
+{
+}
+
+template <class TYPE>
+inline
+SpscQueue_PushGuard<TYPE>::~SpscQueue_PushGuard()
+{
+    if (d_pushIndex != d_parent_p->d_pushIndex.loadRelaxed()) {
+        d_parent_p->publishPushIndex(d_pushIndex);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void SpscQueue_PushGuard<TYPE>::push(const TYPE& value)
+{
+    bslalg::ScalarPrimitives::copyConstruct(
+                   d_parent_p->d_elements + (d_pushIndex & d_parent_p->d_mask),
+                   value,
+                   d_parent_p->d_allocator_p);
+    ++d_pushIndex;
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+bsls::Types::Int64 SpscQueue_PushGuard<TYPE>::numPushed() const
+{
+    return d_pushIndex - d_parent_p->d_pushIndex.loadRelaxed();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
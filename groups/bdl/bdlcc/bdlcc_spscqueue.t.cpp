@@ -0,0 +1,975 @@
+// bdlcc_spscqueue.t.cpp                                              -*-C++-*-
+#include <bdlcc_spscqueue.h>
+
+#include <bdlcc_fixedqueue.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bdlf_bind.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              OVERVIEW
+// A 'bdlcc::SpscQueue' is a ring buffer shared by one producer and one
+// consumer.  We need to test that elements are popped in the order in which
+// they were pushed, including across the wrap-around of the ring buffer, that
+// the capacity supplied at construction is honored exactly even though the
+// number of cells is rounded up, that the batch operations move as many
+// elements as are available (and no more), that allocator-aware elements are
+// created using the queue's allocator and destroyed on pop and on destruction
+// of the queue, and that the queue behaves correctly when the producer and
+// consumer run concurrently.
+//
+// In addition to positive test cases (run in the nightly builds), a negative
+// test case -1 can be run manually to compare the throughput of this queue
+// against 'bdlcc::FixedQueue'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit SpscQueue(bsl::size_t capacity, Allocator *ba = 0);
+// [ 2] ~SpscQueue();
+//
+// MANIPULATORS
+// [ 5] void pushBack(const TYPE& value);
+// [ 5] void pushBack(INPUT_ITERATOR begin, INPUT_ITERATOR end);
+// [ 3] int tryPushBack(const TYPE& value);
+// [ 4] bsl::size_t tryPushBack(INPUT_ITERATOR begin, INPUT_ITERATOR end);
+// [ 5] void popFront(TYPE *value);
+// [ 5] bsl::size_t popFront(OUTPUT_ITERATOR result, bsl::size_t max);
+// [ 3] int tryPopFront(TYPE *value);
+// [ 4] bsl::size_t tryPopFront(OUTPUT_ITERATOR result, bsl::size_t max);
+//
+// ACCESSORS
+// [ 2] bsl::size_t capacity() const;
+// [ 3] bool isEmpty() const;
+// [ 3] bool isFull() const;
+// [ 3] bsl::size_t numElements() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE COMPARISON WITH 'bdlcc::FixedQueue'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::SpscQueue<int>         Obj;
+typedef bdlcc::SpscQueue<bsl::string> StringObj;
+
+typedef bsls::Types::Int64            Int64;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS  FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+const char *const LONG_STRING = "This string is too long to fit in the small "
+                                "string buffer of 'bsl::string'.";
+
+void pushSequence(Obj *queue, int numElements, int batchSize)
+    // Push the integers '[1 .. numElements]' into the specified 'queue' in
+    // order, using single-element pushes if the specified 'batchSize' is 1,
+    // and range pushes of 'batchSize' elements otherwise.
+{
+    if (1 == batchSize) {
+        for (int i = 1; i <= numElements; ++i) {
+            queue->pushBack(i);
+        }
+        return;                                                       // RETURN
+    }
+
+    bsl::vector<int> batch(batchSize);
+    for (int i = 1; i <= numElements; i += batchSize) {
+        int n = 0;
+        for (; n < batchSize && i + n <= numElements; ++n) {
+            batch[n] = i + n;
+        }
+        queue->pushBack(batch.begin(), batch.begin() + n);
+    }
+}
+
+void popSequence(Obj *queue, int numElements, int batchSize, int *numErrors)
+    // Pop 'numElements' elements from the specified 'queue', using
+    // single-element pops if the specified 'batchSize' is 1, and batch pops
+    // of at most 'batchSize' elements otherwise, and load into the specified
+    // 'numErrors' the number of elements that were not popped in the order
+    // '[1 .. numElements]'.
+{
+    *numErrors = 0;
+
+    if (1 == batchSize) {
+        for (int i = 1; i <= numElements; ++i) {
+            int value;
+            queue->popFront(&value);
+            if (value != i) {
+                ++*numErrors;
+            }
+        }
+        return;                                                       // RETURN
+    }
+
+    bsl::vector<int> batch(batchSize);
+    int              expected = 1;
+    while (expected <= numElements) {
+        bsl::size_t n = queue->popFront(batch.begin(), batchSize);
+        for (bsl::size_t j = 0; j < n; ++j, ++expected) {
+            if (batch[j] != expected) {
+                ++*numErrors;
+            }
+        }
+    }
+}
+
+void pushSlowly(Obj *queue, int numElements, int delayMicroseconds)
+    // Push the integers '[1 .. numElements]' into the specified 'queue' in
+    // order, sleeping for the specified 'delayMicroseconds' before each push.
+{
+    for (int i = 1; i <= numElements; ++i) {
+        bslmt::ThreadUtil::microSleep(delayMicroseconds);
+        queue->pushBack(i);
+    }
+}
+
+void popSlowly(Obj *queue,
+               int  numElements,
+               int  delayMicroseconds,
+               int *numErrors)
+    // Pop 'numElements' elements from the specified 'queue', sleeping for the
+    // specified 'delayMicroseconds' before each pop, and load into the
+    // specified 'numErrors' the number of elements that were not popped in
+    // the order '[1 .. numElements]'.
+{
+    *numErrors = 0;
+
+    for (int i = 1; i <= numElements; ++i) {
+        bslmt::ThreadUtil::microSleep(delayMicroseconds);
+        int value;
+        queue->popFront(&value);
+        if (value != i) {
+            ++*numErrors;
+        }
+    }
+}
+
+                            // ======================
+                            // performance test cases
+                            // ======================
+
+template <class QUEUE>
+void singleProducer(QUEUE *queue, int numElements)
+    // Push the integers '[1 .. numElements]' into the specified 'queue'.
+{
+    for (int i = 1; i <= numElements; ++i) {
+        queue->pushBack(i);
+    }
+}
+
+template <class QUEUE>
+void singleConsumer(QUEUE *queue, int numElements, Int64 *sum)
+    // Pop 'numElements' integers from the specified 'queue', and load their
+    // sum into the specified 'sum'.
+{
+    Int64 total = 0;
+    for (int i = 0; i < numElements; ++i) {
+        int value;
+        queue->popFront(&value);
+        total += value;
+    }
+    *sum = total;
+}
+
+void spscBatchConsumer(Obj *queue, int numElements, Int64 *sum)
+    // Pop 'numElements' integers from the specified 'queue' in batches, and
+    // load their sum into the specified 'sum'.
+{
+    enum { k_BATCH_SIZE = 256 };
+
+    int         buffer[k_BATCH_SIZE];
+    Int64       total = 0;
+    int         numPopped = 0;
+    while (numPopped < numElements) {
+        bsl::size_t n = queue->popFront(buffer, k_BATCH_SIZE);
+        for (bsl::size_t i = 0; i < n; ++i) {
+            total += buffer[i];
+        }
+        numPopped += static_cast<int>(n);
+    }
+    *sum = total;
+}
+
+template <class QUEUE, class PRODUCER, class CONSUMER>
+double runPipeline(QUEUE    *queue,
+                   PRODUCER  producerFunction,
+                   CONSUMER  consumerFunction,
+                   int       numElements)
+    // Run the specified 'producerFunction' and 'consumerFunction' in two
+    // threads connected by the specified 'queue', transferring the specified
+    // 'numElements' integers, and return the elapsed wall time in seconds.
+{
+    Int64 sum = 0;
+
+    bsls::Stopwatch timer;
+    timer.start(true);
+
+    bslmt::ThreadUtil::Handle producerHandle, consumerHandle;
+    bslmt::ThreadUtil::create(&consumerHandle,
+                              bdlf::BindUtil::bind(consumerFunction,
+                                                   queue,
+                                                   numElements,
+                                                   &sum));
+    bslmt::ThreadUtil::create(&producerHandle,
+                              bdlf::BindUtil::bind(producerFunction,
+                                                   queue,
+                                                   numElements));
+    bslmt::ThreadUtil::join(producerHandle);
+    bslmt::ThreadUtil::join(consumerHandle);
+
+    timer.stop();
+
+    const Int64 n = numElements;
+    ASSERTV(sum, n * (n + 1) / 2 == sum);
+
+    return timer.elapsedTime();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Producer/Consumer Pipeline
+///- - - - - - - - - - - - - - - - - - - -
+// In this example, a producer thread passes a sequence of integers to a
+// consumer thread, which sums them, using a 'bdlcc::SpscQueue'.
+//
+// First, we define the function run by the producer, which pushes the
+// integers '[1 .. 1000]' into the queue, followed by a terminating '0':
+//..
+    void producer(bdlcc::SpscQueue<int> *queue)
+    {
+        for (int i = 1; i <= 1000; ++i) {
+            queue->pushBack(i);
+        }
+        queue->pushBack(0);
+    }
+//..
+// Then, we define the function run by the consumer, which drains the queue in
+// batches of up to 64 elements into a local buffer, and accumulates the
+// elements until it encounters the terminating '0':
+//..
+    void consumer(bdlcc::SpscQueue<int> *queue, int *sum)
+    {
+        int buffer[64];
+        *sum = 0;
+        while (true) {
+            bsl::size_t n = queue->popFront(buffer, 64);
+            for (bsl::size_t i = 0; i < n; ++i) {
+                if (0 == buffer[i]) {
+                    return;                                           // RETURN
+                }
+                *sum += buffer[i];
+            }
+        }
+    }
+//..
+
+}  // close namespace USAGE_EXAMPLE
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVerbose);
+
+    switch (test) { case 0:  // case 0 is always the first case
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace USAGE_EXAMPLE;
+
+// Finally, we create a queue having a capacity of 256 elements, and run the
+// producer and the consumer in two separate threads:
+//..
+    bdlcc::SpscQueue<int> queue(256);
+    int                   sum = 0;
+
+    bslmt::ThreadUtil::Handle producerHandle, consumerHandle;
+    bslmt::ThreadUtil::create(&producerHandle,
+                              bdlf::BindUtil::bind(&producer, &queue));
+    bslmt::ThreadUtil::create(&consumerHandle,
+                              bdlf::BindUtil::bind(&consumer, &queue, &sum));
+
+    bslmt::ThreadUtil::join(producerHandle);
+    bslmt::ThreadUtil::join(consumerHandle);
+
+    ASSERT(500500 == sum);
+    ASSERT(queue.isEmpty());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING CONCURRENT PRODUCER AND CONSUMER
+        //
+        // Concerns:
+        //: 1 Elements pushed by a producer thread are popped by a consumer
+        //:   thread exactly once, and in order, whether single-element or
+        //:   batch operations are used on either side.
+        //:
+        //: 2 The blocking operations block when the queue is full (for the
+        //:   producer) or empty (for the consumer), and resume once the other
+        //:   party makes progress.
+        //:
+        //: 3 A party that remains blocked for an extended period waits
+        //:   without occupying a processor, and is woken up (no wake-up is
+        //:   lost) once the other party makes progress.
+        //
+        // Plan:
+        //: 1 For a set of small capacities (so that both parties frequently
+        //:   block), and for each combination of producer and consumer batch
+        //:   sizes, run a producer thread pushing a sequence of integers and a
+        //:   consumer thread popping and verifying them.  (C-1..2)
+        //:
+        //: 2 Run a producer that sleeps before each push against a consumer
+        //:   that pops without delay, and then a consumer that sleeps before
+        //:   each pop against a producer that pushes without delay into a
+        //:   queue of capacity 1.  Verify that the elements are popped in
+        //:   order, and that the CPU time consumed by the process is a small
+        //:   fraction of the elapsed time.  (C-3)
+        //
+        // Testing:
+        //   void pushBack(const TYPE& value);
+        //   void pushBack(INPUT_ITERATOR begin, INPUT_ITERATOR end);
+        //   void popFront(TYPE *value);
+        //   bsl::size_t popFront(OUTPUT_ITERATOR result, bsl::size_t max);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CONCURRENT PRODUCER AND CONSUMER"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        const int NUM_ELEMENTS  = 100000;
+        const int CAPACITIES[]  = { 1, 3, 16, 1000 };
+        const int BATCH_SIZES[] = { 1, 7, 64 };
+
+        const int NUM_CAPACITIES  = sizeof CAPACITIES / sizeof *CAPACITIES;
+        const int NUM_BATCH_SIZES = sizeof BATCH_SIZES / sizeof *BATCH_SIZES;
+
+        for (int ti = 0; ti < NUM_CAPACITIES * NUM_BATCH_SIZES
+                                                    * NUM_BATCH_SIZES; ++ti) {
+            const int CAPACITY = CAPACITIES[ti / (NUM_BATCH_SIZES
+                                                        * NUM_BATCH_SIZES)];
+            const int PBATCH   = BATCH_SIZES[ti / NUM_BATCH_SIZES
+                                                           % NUM_BATCH_SIZES];
+            const int CBATCH   = BATCH_SIZES[ti % NUM_BATCH_SIZES];
+
+            if (veryVerbose) { P_(CAPACITY) P_(PBATCH) P(CBATCH) }
+
+            Obj mX(CAPACITY, &ta);
+            int numErrors = -1;
+
+            bslmt::ThreadUtil::Handle producerHandle, consumerHandle;
+            bslmt::ThreadUtil::create(&consumerHandle,
+                                      bdlf::BindUtil::bind(&popSequence,
+                                                           &mX,
+                                                           NUM_ELEMENTS,
+                                                           CBATCH,
+                                                           &numErrors));
+            bslmt::ThreadUtil::create(&producerHandle,
+                                      bdlf::BindUtil::bind(&pushSequence,
+                                                           &mX,
+                                                           NUM_ELEMENTS,
+                                                           PBATCH));
+            bslmt::ThreadUtil::join(producerHandle);
+            bslmt::ThreadUtil::join(consumerHandle);
+
+            ASSERTV(CAPACITY, PBATCH, CBATCH, numErrors, 0 == numErrors);
+            ASSERTV(CAPACITY, PBATCH, CBATCH, mX.isEmpty());
+        }
+
+        if (verbose) cout << "\nTesting extended blocking." << endl;
+        {
+            const int NUM_SLOW_ELEMENTS = 20;
+            const int DELAY             = 10000;  // microseconds
+
+            for (int slowConsumer = 0; slowConsumer < 2; ++slowConsumer) {
+                if (veryVerbose) { P(slowConsumer) }
+
+                Obj mX(1, &ta);
+                int numErrors = -1;
+
+                bsls::Stopwatch timer;
+                timer.start(true);
+
+                bslmt::ThreadUtil::Handle producerHandle, consumerHandle;
+                if (slowConsumer) {
+                    bslmt::ThreadUtil::create(
+                                     &consumerHandle,
+                                     bdlf::BindUtil::bind(&popSlowly,
+                                                          &mX,
+                                                          NUM_SLOW_ELEMENTS,
+                                                          DELAY,
+                                                          &numErrors));
+                    bslmt::ThreadUtil::create(
+                                     &producerHandle,
+                                     bdlf::BindUtil::bind(&pushSequence,
+                                                          &mX,
+                                                          NUM_SLOW_ELEMENTS,
+                                                          1));
+                }
+                else {
+                    bslmt::ThreadUtil::create(
+                                     &consumerHandle,
+                                     bdlf::BindUtil::bind(&popSequence,
+                                                          &mX,
+                                                          NUM_SLOW_ELEMENTS,
+                                                          1,
+                                                          &numErrors));
+                    bslmt::ThreadUtil::create(
+                                     &producerHandle,
+                                     bdlf::BindUtil::bind(&pushSlowly,
+                                                          &mX,
+                                                          NUM_SLOW_ELEMENTS,
+                                                          DELAY));
+                }
+                bslmt::ThreadUtil::join(producerHandle);
+                bslmt::ThreadUtil::join(consumerHandle);
+
+                timer.stop();
+
+                double systemTime, userTime, wallTime;
+                timer.accumulatedTimes(&systemTime, &userTime, &wallTime);
+
+                if (veryVerbose) { P_(systemTime) P_(userTime) P(wallTime) }
+
+                ASSERTV(slowConsumer, numErrors, 0 == numErrors);
+                ASSERTV(slowConsumer, mX.isEmpty());
+                ASSERTV(slowConsumer, systemTime, userTime, wallTime,
+                        systemTime + userTime < wallTime / 2);
+            }
+        }
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH OPERATIONS
+        //
+        // Concerns:
+        //: 1 'tryPushBack' on a range pushes the longest prefix of the range
+        //:   that fits in the queue, and returns its length.
+        //:
+        //: 2 'tryPopFront' with a maximum pops the lesser of that maximum and
+        //:   the number of elements held, in order, and returns that number.
+        //:
+        //: 3 Batch operations are correct across the wrap-around of the ring
+        //:   buffer.
+        //:
+        //: 4 Batch operations accept input and output iterators that are not
+        //:   pointers.
+        //
+        // Plan:
+        //: 1 Push ranges of various lengths into a queue of a capacity that
+        //:   is not a power of two, verifying the number of elements pushed,
+        //:   then pop them in batches of various sizes into a vector through
+        //:   a 'bsl::back_insert_iterator', and verify the order.  Repeat
+        //:   enough times for the indices to wrap around the ring buffer
+        //:   several times.  (C-1..4)
+        //
+        // Testing:
+        //   bsl::size_t tryPushBack(INPUT_ITERATOR begin, INPUT_ITERATOR end);
+        //   bsl::size_t tryPopFront(OUTPUT_ITERATOR result, bsl::size_t max);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BATCH OPERATIONS" << endl
+                          << "========================" << endl;
+
+        const int CAPACITY = 13;
+
+        Obj mX(CAPACITY, &ta);  const Obj& X = mX;
+
+        bsl::vector<int> input;
+        for (int i = 0; i < 3 * CAPACITY; ++i) {
+            input.push_back(i);
+        }
+
+        ASSERT(0 == mX.tryPushBack(input.begin(), input.begin()));
+
+        for (int round = 0; round < 10; ++round) {
+            for (int length = 0; length <= 2 * CAPACITY; ++length) {
+                ASSERT(X.isEmpty());
+
+                const int BASE = (round + length) % 3;
+
+                bsl::size_t n = mX.tryPushBack(input.begin() + BASE,
+                                               input.begin() + BASE + length);
+                const int EXP = length < CAPACITY ? length : CAPACITY;
+                ASSERTV(length, n, EXP == static_cast<int>(n));
+                ASSERTV(length, EXP == static_cast<int>(X.numElements()));
+
+                bsl::vector<int> output;
+                bsl::size_t      total = 0;
+                for (bsl::size_t batch = 1; total < n; ++batch) {
+                    const bsl::size_t EXP_POPPED = bsl::min(batch, n - total);
+
+                    bsl::size_t m = mX.tryPopFront(bsl::back_inserter(output),
+                                                   batch);
+                    ASSERTV(length, batch, m, EXP_POPPED == m);
+                    total += m;
+                }
+                ASSERTV(length, n == output.size());
+                for (bsl::size_t i = 0; i < output.size(); ++i) {
+                    ASSERTV(length, i, BASE + static_cast<int>(i)
+                                                               == output[i]);
+                }
+
+                ASSERT(0 == mX.tryPopFront(bsl::back_inserter(output), 5));
+            }
+        }
+
+        if (verbose) cout << "\tTesting allocator-aware elements." << endl;
+        {
+            bslma::TestAllocator sa("strings", veryVeryVerbose);
+
+            bsl::vector<bsl::string> strings(&sa);
+            for (int i = 0; i < 5; ++i) {
+                strings.push_back(bsl::string(LONG_STRING, &sa));
+                strings.back().push_back(static_cast<char>('a' + i));
+            }
+
+            const Int64 NUM_BLOCKS = ta.numBlocksInUse();
+            {
+                StringObj mY(4, &ta);
+
+                ASSERT(4 == mY.tryPushBack(strings.begin(), strings.end()));
+
+                bsl::string buffer[2];
+                ASSERT(2 == mY.tryPopFront(buffer, 2));
+                ASSERT(strings[0] == buffer[0]);
+                ASSERT(strings[1] == buffer[1]);
+
+                // Two elements remain, and are destroyed by the destructor.
+            }
+            ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING SINGLE-ELEMENT 'tryPushBack' AND 'tryPopFront'
+        //
+        // Concerns:
+        //: 1 Elements are popped in the order in which they were pushed.
+        //:
+        //: 2 'tryPushBack' fails, without modifying the queue, when exactly
+        //:   'capacity()' elements are held, even if 'capacity()' is not a
+        //:   power of two.
+        //:
+        //: 3 'tryPopFront' fails, without modifying its argument, when the
+        //:   queue is empty.
+        //:
+        //: 4 The accessors reflect the number of elements held.
+        //:
+        //: 5 Elements are created using the queue's allocator, and are
+        //:   destroyed when popped and when the queue is destroyed.
+        //
+        // Plan:
+        //: 1 For a set of capacities, repeatedly fill the queue until
+        //:   'tryPushBack' fails, then drain it until 'tryPopFront' fails,
+        //:   verifying the accessors and the values popped at each step.
+        //:   (C-1..4)
+        //:
+        //: 2 Using a queue of 'bsl::string' whose values do not fit in the
+        //:   small-string buffer, verify that the queue's allocator supplies
+        //:   the memory of the elements held, and that it is all returned.
+        //:   (C-5)
+        //
+        // Testing:
+        //   int tryPushBack(const TYPE& value);
+        //   int tryPopFront(TYPE *value);
+        //   bool isEmpty() const;
+        //   bool isFull() const;
+        //   bsl::size_t numElements() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING SINGLE-ELEMENT 'tryPushBack' AND "
+                             "'tryPopFront'" << endl
+                          << "========================================"
+                             "=============" << endl;
+
+        const int CAPACITIES[]   = { 1, 2, 3, 5, 8, 100 };
+        const int NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES;
+
+        for (int ci = 0; ci < NUM_CAPACITIES; ++ci) {
+            const int CAPACITY = CAPACITIES[ci];
+
+            Obj mX(CAPACITY, &ta);  const Obj& X = mX;
+
+            int nextPush = 0;
+            int nextPop  = 0;
+            for (int round = 0; round < 5; ++round) {
+                for (int i = 0; i < CAPACITY; ++i) {
+                    ASSERTV(CAPACITY, i, i == static_cast<int>(
+                                                           X.numElements()));
+                    ASSERTV(CAPACITY, i, (0 == i) == X.isEmpty());
+                    ASSERTV(CAPACITY, i, !X.isFull());
+                    ASSERTV(CAPACITY, i, 0 == mX.tryPushBack(nextPush++));
+                }
+                ASSERTV(CAPACITY, X.isFull());
+                ASSERTV(CAPACITY, 0 != mX.tryPushBack(-1));
+                ASSERTV(CAPACITY, CAPACITY == static_cast<int>(
+                                                           X.numElements()));
+
+                for (int i = 0; i < CAPACITY; ++i) {
+                    int value = -1;
+                    ASSERTV(CAPACITY, i, 0 == mX.tryPopFront(&value));
+                    ASSERTV(CAPACITY, i, value, nextPop == value);
+                    ++nextPop;
+                }
+                ASSERTV(CAPACITY, X.isEmpty());
+
+                int value = -1;
+                ASSERTV(CAPACITY, 0 != mX.tryPopFront(&value));
+                ASSERTV(CAPACITY, -1 == value);
+
+                // Interleave single pushes and pops, so that the indices
+                // are not aligned with the start of the ring buffer at the
+                // next round.
+
+                ASSERTV(CAPACITY, 0 == mX.tryPushBack(nextPush++));
+                ASSERTV(CAPACITY, 0 == mX.tryPopFront(&value));
+                ASSERTV(CAPACITY, nextPop++ == value);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting allocator-aware elements." << endl;
+        {
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            const bsl::string VALUE(LONG_STRING, &ta);
+            {
+                StringObj mY(3, &ta);
+
+                const Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+                ASSERT(0 == mY.tryPushBack(VALUE));
+                ASSERT(0 == mY.tryPushBack(VALUE));
+                ASSERT(NUM_BLOCKS + 2 == ta.numBlocksInUse());
+
+                bsl::string result(&ta);
+                ASSERT(0 == mY.tryPopFront(&result));
+                ASSERT(VALUE == result);
+
+                ASSERT(0 == mY.tryPushBack(VALUE));
+            }
+            ASSERT(1 == ta.numBlocksInUse());  // 'VALUE'
+
+            ASSERT(dam.isTotalSame());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 'capacity' returns the value supplied at construction.
+        //:
+        //: 2 The queue uses the supplied allocator, or the default allocator
+        //:   if none is supplied, and releases all its memory on destruction.
+        //:
+        //: 3 A newly created queue is empty.
+        //
+        // Plan:
+        //: 1 Create queues of various capacities, with and without an
+        //:   allocator, and verify the accessors and the allocators' usage.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   explicit SpscQueue(bsl::size_t capacity, Allocator *ba = 0);
+        //   ~SpscQueue();
+        //   bsl::size_t capacity() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CREATORS AND BASIC ACCESSORS" << endl
+                          << "====================================" << endl;
+
+        const int CAPACITIES[]   = { 1, 2, 3, 7, 64, 1000 };
+        const int NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES;
+
+        for (int ci = 0; ci < NUM_CAPACITIES; ++ci) {
+            const int CAPACITY = CAPACITIES[ci];
+
+            {
+                Obj mX(CAPACITY, &ta);  const Obj& X = mX;
+
+                ASSERTV(CAPACITY, CAPACITY == static_cast<int>(X.capacity()));
+                ASSERTV(CAPACITY, &ta == X.allocator());
+                ASSERTV(CAPACITY, X.isEmpty());
+                ASSERTV(CAPACITY, !X.isFull());
+                ASSERTV(CAPACITY, 0 == X.numElements());
+                ASSERTV(CAPACITY, 1 == ta.numBlocksInUse());
+                ASSERTV(CAPACITY, 0 == defaultAllocator.numBlocksInUse());
+            }
+            ASSERTV(CAPACITY, 0 == ta.numBlocksInUse());
+
+            {
+                Obj mX(CAPACITY);  const Obj& X = mX;
+
+                ASSERTV(CAPACITY, &defaultAllocator == X.allocator());
+                ASSERTV(CAPACITY, 1 == defaultAllocator.numBlocksInUse());
+            }
+            ASSERTV(CAPACITY, 0 == defaultAllocator.numBlocksInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a queue, push and pop a few elements, singly and in
+        //:   batches, and verify the values popped.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(4, &ta);  const Obj& X = mX;
+
+        ASSERT(4 == X.capacity());
+        ASSERT(X.isEmpty());
+
+        ASSERT(0 == mX.tryPushBack(1));
+        ASSERT(0 == mX.tryPushBack(2));
+        ASSERT(2 == X.numElements());
+
+        int value = 0;
+        ASSERT(0 == mX.tryPopFront(&value));
+        ASSERT(1 == value);
+
+        const int DATA[] = { 3, 4, 5, 6 };
+        ASSERT(3 == mX.tryPushBack(DATA, DATA + 4));
+        ASSERT(X.isFull());
+
+        int buffer[8];
+        ASSERT(4 == mX.tryPopFront(buffer, 8));
+        ASSERT(2 == buffer[0]);
+        ASSERT(3 == buffer[1]);
+        ASSERT(4 == buffer[2]);
+        ASSERT(5 == buffer[3]);
+        ASSERT(X.isEmpty());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE COMPARISON WITH 'bdlcc::FixedQueue'
+        //
+        // Concerns:
+        //: 1 Transferring elements from one producer thread to one consumer
+        //:   thread is faster through a 'bdlcc::SpscQueue' than through a
+        //:   'bdlcc::FixedQueue'.
+        //
+        // Plan:
+        //: 1 Transfer a large number of integers through a queue of each
+        //:   kind, for several capacities, and report the elapsed time and
+        //:   throughput; for 'bdlcc::SpscQueue', also report the time taken
+        //:   when the consumer pops in batches.
+        //:
+        //: 2 The number of elements (in millions) may be supplied as the
+        //:   second argument.
+        //
+        // Testing:
+        //   PERFORMANCE COMPARISON WITH 'bdlcc::FixedQueue'
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE COMPARISON WITH 'bdlcc::FixedQueue'" << endl
+             << "===============================================" << endl;
+
+        const int NUM_ELEMENTS = (argc > 2 ? atoi(argv[2]) : 10) * 1000000;
+        const int CAPACITIES[] = { 64, 1024, 16384 };
+
+        const int NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES;
+
+        cout << "elements: " << NUM_ELEMENTS << "\n"
+             << "capacity\tFixedQueue\tSpscQueue\tSpscQueue (batch)"
+             << " (Melements/s)" << endl;
+
+        for (int ci = 0; ci < NUM_CAPACITIES; ++ci) {
+            const int CAPACITY = CAPACITIES[ci];
+
+            double fixed, spsc, batch;
+            {
+                bdlcc::FixedQueue<int> queue(CAPACITY, &ta);
+                fixed = runPipeline(&queue,
+                                    &singleProducer<
+                                                     bdlcc::FixedQueue<int> >,
+                                    &singleConsumer<
+                                                     bdlcc::FixedQueue<int> >,
+                                    NUM_ELEMENTS);
+            }
+            {
+                Obj queue(CAPACITY, &ta);
+                spsc = runPipeline(&queue,
+                                   &singleProducer<Obj>,
+                                   &singleConsumer<Obj>,
+                                   NUM_ELEMENTS);
+            }
+            {
+                Obj queue(CAPACITY, &ta);
+                batch = runPipeline(&queue,
+                                    &singleProducer<Obj>,
+                                    &spscBatchConsumer,
+                                    NUM_ELEMENTS);
+            }
+
+            const double M = NUM_ELEMENTS / 1.0e6;
+            cout << CAPACITY
+                 << "\t\t" << M / fixed
+                 << "\t\t" << M / spsc
+                 << "\t\t" << M / batch << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
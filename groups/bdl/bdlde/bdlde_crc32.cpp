@@ -91,10 +91,37 @@ BSLS_IDENT_RCSID(bdlde_crc32_cpp,"$Id$ $CSID$")
 //..
 //  http://ravenphpscripts.com/modules.php?name=Forums&file=viewtopic&t=614
 //..
+//
+// Where the CPU supports the 'PCLMULQDQ' instruction, buffers of at least 64
+// bytes are instead processed by "folding", as described in Gopal, V., et
+// al., "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ
+// Instruction", Intel Corporation, 2009.  Four 128-bit accumulators are
+// folded forward by 512 bits per iteration (each fold being two carry-less
+// multiplications by precomputed constants 'x^(512+32) mod P' and
+// 'x^(512-32) mod P', in the bit-reflected domain), then folded into a single
+// accumulator, which is reduced to 64 and then 32 bits, the last step being a
+// Barrett reduction.  The constants are those given at the end of the paper
+// for the CRC-32 polynomial.  The bytes that do not fill a final 16-byte block
+// are processed with the table.  The availability of the instruction is
+// determined once, using 'cpuid', and cached.  The functions using the
+// instructions are compiled with the 'target' attribute so that the rest of
+// the component does not require them.
 
 #include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_platform.h>
+
 #include <bsl_ostream.h>
 
+#if (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))    \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BDLDE_CRC32_CLMUL 1
+#include <cpuid.h>
+#include <emmintrin.h>
+#include <smmintrin.h>
+#include <wmmintrin.h>
+#endif
+
 namespace BloombergLP {
 
 BSLMF_ASSERT(4 == sizeof(unsigned int));
@@ -156,6 +183,115 @@ static const unsigned int CRC_TABLE[256] = {
     0x2d02ef8d
 };
 
+namespace {
+
+enum {
+    k_MIN_CLMUL_LENGTH = 64  // minimum length processed by folding
+};
+
+#ifdef BDLDE_CRC32_CLMUL
+
+bsls::AtomicOperations::AtomicTypes::Int s_clmulState = { 0 };
+    // 0 if not yet determined, 1 if the CPU does not support 'PCLMULQDQ' and
+    // SSE4.1, and 2 if it does
+
+__attribute__((target("pclmul,sse4.1")))
+unsigned int foldClmul(unsigned int         crc,
+                       const unsigned char *data,
+                       int                  length)
+    // Return the specified 'crc' state updated with the specified 'data'
+    // having the specified 'length', using carry-less multiplication.  The
+    // behavior is undefined unless '64 <= length' and 'length' is a multiple
+    // of 16.
+{
+    const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596LL, 0x0154442bd4LL);
+    const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009eLL, 0x01751997d0LL);
+    const __m128i k5k0 = _mm_set_epi64x(0,              0x0163cd6124LL);
+    const __m128i poly = _mm_set_epi64x(0x01f7011641LL, 0x01db710641LL);
+    const __m128i mask = _mm_setr_epi32(~0, 0, ~0, 0);
+
+    const __m128i *p = reinterpret_cast<const __m128i *>(data);
+
+    __m128i x1 = _mm_loadu_si128(p);
+    __m128i x2 = _mm_loadu_si128(p + 1);
+    __m128i x3 = _mm_loadu_si128(p + 2);
+    __m128i x4 = _mm_loadu_si128(p + 3);
+    __m128i x5, x6, x7, x8;
+
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+
+    p      += 4;
+    length -= 64;
+
+    // Fold 64 bytes at a time.
+
+    while (length >= 64) {
+        x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(p));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128(p + 1));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128(p + 2));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128(p + 3));
+
+        p      += 4;
+        length -= 64;
+    }
+
+    // Fold the four accumulators into one.
+
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    // Fold 16 bytes at a time.
+
+    while (length >= 16) {
+        x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128(p)), x5);
+
+        ++p;
+        length -= 16;
+    }
+
+    // Reduce 128 bits to 64 bits.
+
+    x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), k5k0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits.
+
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), poly, 0x10);
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask), poly, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return static_cast<unsigned int>(_mm_extract_epi32(x1, 1));
+}
+
+#endif
+
+}  // close unnamed namespace
+
 namespace bdlde {
                                 // -----------
                                 // class Crc32
@@ -167,29 +303,12 @@ void Crc32::update(const void *data, int length)
     BSLS_ASSERT(0 <= length);
     BSLS_ASSERT(data || !length);
 
-    // The following is a Duff's Device-based implementation of a common
-    // algorithm (see end of RFC 1952).
-
-    register const unsigned char *d = (const unsigned char *)data;
-    register unsigned int tmp = d_crc;
-
-    switch (length % 4) {
-      case 3: tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-      case 2: tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-      case 1: tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-      default: ;
+    if (length >= k_MIN_CLMUL_LENGTH && Crc32_Impl::isHardwareAccelerated()) {
+        d_crc = Crc32_Impl::updateHardware(d_crc, data, length);
     }
-
-    int n = length / 4;
-    while (n) {
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        --n;
+    else {
+        d_crc = Crc32_Impl::updateSoftware(d_crc, data, length);
     }
-
-    d_crc = tmp;
 }
 
 // ACCESSORS
@@ -219,6 +338,82 @@ bsl::ostream& Crc32::print(bsl::ostream& stream) const
     return stream << array;
 }
 
+                              // -----------------
+                              // struct Crc32_Impl
+                              // -----------------
+
+// CLASS METHODS
+bool Crc32_Impl::isHardwareAccelerated()
+{
+#ifdef BDLDE_CRC32_CLMUL
+    int state = bsls::AtomicOperations::getIntRelaxed(&s_clmulState);
+    if (0 == state) {
+        unsigned int eax, ebx, ecx, edx;
+        state = __get_cpuid(1, &eax, &ebx, &ecx, &edx)
+             && (ecx & bit_PCLMUL)
+             && (ecx & bit_SSE4_1) ? 2 : 1;
+        bsls::AtomicOperations::setIntRelaxed(&s_clmulState, state);
+    }
+    return 2 == state;
+#else
+    return false;
+#endif
+}
+
+unsigned int Crc32_Impl::updateHardware(unsigned int  crc,
+                                        const void   *data,
+                                        int           length)
+{
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(data || !length);
+    BSLS_ASSERT(isHardwareAccelerated());
+
+#ifdef BDLDE_CRC32_CLMUL
+    if (length >= k_MIN_CLMUL_LENGTH) {
+        const int folded = length & ~15;
+
+        crc = foldClmul(crc, static_cast<const unsigned char *>(data), folded);
+
+        data    = static_cast<const unsigned char *>(data) + folded;
+        length -= folded;
+    }
+#endif
+
+    return updateSoftware(crc, data, length);
+}
+
+unsigned int Crc32_Impl::updateSoftware(unsigned int  crc,
+                                        const void   *data,
+                                        int           length)
+{
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(data || !length);
+
+    // The following is a Duff's Device-based implementation of a common
+    // algorithm (see end of RFC 1952).
+
+    register const unsigned char *d = (const unsigned char *)data;
+    register unsigned int tmp = crc;
+
+    switch (length % 4) {
+      case 3: tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
+      case 2: tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
+      case 1: tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
+      default: ;
+    }
+
+    int n = length / 4;
+    while (n) {
+        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
+        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
+        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
+        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
+        --n;
+    }
+
+    return tmp;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
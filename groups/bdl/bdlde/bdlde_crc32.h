@@ -20,7 +20,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bdlde::Crc32: stores and updates a CRC-32 checksum
 //
-//@SEE_ALSO:
+//@SEE_ALSO: bdlde_crc32c
 //
 //@DESCRIPTION: This component implements a mechanism for computing, updating,
 // and streaming a CRC-32 checksum (a cyclic redundancy check comprised of 32
@@ -31,6 +31,16 @@ BSLS_IDENT("$Id: $")
 // SHA-256, it is relatively easy to find alternate texts with identical
 // checksum.
 //
+///Performance
+///-----------
+// On x86 and x86-64 platforms, when built with a compiler that supports it,
+// 'update' determines at run time whether the CPU provides the carry-less
+// multiplication ('PCLMULQDQ') instruction, and, if so, checksums buffers of
+// at least 64 bytes by folding 64 bytes per iteration, which is typically an
+// order of magnitude faster than the table-driven implementation used
+// otherwise (and for the final 15 bytes, or less, of each buffer).  Both
+// implementations produce identical checksums.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate a typical use of the
@@ -222,6 +232,38 @@ class Crc32 {
         // not valid on entry, this operation has no effect.
 
 
+};
+
+                              // =================
+                              // struct Crc32_Impl
+                              // =================
+
+struct Crc32_Impl {
+    // This 'struct' is an implementation detail of 'Crc32' and should not be
+    // used by clients of this component.  It provides a namespace for the
+    // alternative implementations of the CRC-32 update so that they can be
+    // tested and benchmarked against each other.
+
+    // CLASS METHODS
+    static bool isHardwareAccelerated();
+        // Return 'true' if the CPU on which this process runs supports the
+        // carry-less multiplication instructions used by 'updateHardware',
+        // and 'false' otherwise.
+
+    static unsigned int updateHardware(unsigned int  crc,
+                                       const void   *data,
+                                       int           length);
+        // Return the specified internal 'crc' state updated with the
+        // specified 'data' having the specified 'length' (in bytes), using
+        // carry-less multiplication.  The behavior is undefined unless
+        // 'isHardwareAccelerated()' is 'true' and '0 <= length'.
+
+    static unsigned int updateSoftware(unsigned int  crc,
+                                       const void   *data,
+                                       int           length);
+        // Return the specified internal 'crc' state updated with the
+        // specified 'data' having the specified 'length' (in bytes), using a
+        // lookup table.  The behavior is undefined unless '0 <= length'.
 };
 
 // FREE OPERATORS
@@ -14,6 +14,7 @@
 #include <bslx_testinstream.h>                  // for testing only
 #include <bslx_testinstreamexception.h>         // for testing only
 #include <bsls_stopwatch.h>                     // for testing only
+#include <bsls_types.h>                         // for testing only
 
 #include <bsl_algorithm.h>   // sort()
 #include <bsl_cstdlib.h>     // atoi()
@@ -98,10 +99,12 @@ using namespace bsl;  // automatically added by script
 // [ 5] bsl::ostream& operator<<(bsl::ostream& stream, const bdlde::Crc32&);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [16] USAGE EXAMPLE
 // [ 2] BOOTSTRAP: void update(const void *data, int length);
 // [14] CRC_TABLE TEST
+// [15] CONCERN: hardware and software implementations agree
 // [-1] PERFORMANCE TEST
+// [-2] THROUGHPUT TEST
 //
 // [ 3] int ggg(bdlde::Crc32 *object, const char *spec, int vF = 1);
 // [ 3] bdlde::Crc32& gg(bdlde::Crc32 *object, const char *spec);
@@ -515,7 +518,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -546,6 +549,94 @@ int main(int argc, char *argv[])
         receiverExample(in);
 
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // HARDWARE AND SOFTWARE IMPLEMENTATIONS AGREE
+        //
+        // Concerns:
+        //: 1 The carry-less multiplication implementation and the table
+        //:   implementation compute the same checksum for any length and
+        //:   alignment of the data, including lengths that are not
+        //:   multiples of the folding block sizes.
+        //:
+        //: 2 'update' computes the same checksum whether the data is
+        //:   supplied in one or several calls.
+        //
+        // Plan:
+        //: 1 For every length up to 1100 bytes and every alignment up to 16,
+        //:   compute the checksum of pseudo-random data with a bitwise
+        //:   reference implementation, with 'updateSoftware', and, if the
+        //:   CPU supports it, with 'updateHardware', and verify that they
+        //:   agree.  (C-1)
+        //:
+        //: 2 Split the data at several points, supply the parts to 'update',
+        //:   and verify the resulting checksum.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: hardware and software implementations agree
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nHARDWARE AND SOFTWARE IMPLEMENTATIONS AGREE"
+                          << "\n==========================================="
+                          << endl;
+
+        typedef bdlde::Crc32_Impl Impl;
+
+        const bool HW = Impl::isHardwareAccelerated();
+        if (verbose) { P(HW); }
+
+        enum { k_MAX_LENGTH = 1100, k_MAX_OFFSET = 16 };
+
+        bsl::vector<unsigned char> buffer(k_MAX_LENGTH + k_MAX_OFFSET);
+        unsigned int seed = 12345;
+        for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+            seed = seed * 1103515245 + 12345;
+            buffer[i] = static_cast<unsigned char>(seed >> 16);
+        }
+
+        for (int offset = 0; offset < k_MAX_OFFSET; ++offset) {
+            const unsigned char *DATA = &buffer[offset];
+
+            for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+                unsigned int expected = 0xffffffff;
+                for (int i = 0; i < length; ++i) {
+                    expected ^= DATA[i];
+                    for (int k = 0; k < 8; ++k) {
+                        expected = (expected >> 1)
+                                 ^ (0xedb88320 & (0 - (expected & 1)));
+                    }
+                }
+
+                LOOP2_ASSERT(offset, length,
+                             expected ==
+                               Impl::updateSoftware(0xffffffff, DATA, length));
+                if (HW) {
+                    LOOP2_ASSERT(offset, length,
+                                 expected ==
+                               Impl::updateHardware(0xffffffff, DATA, length));
+                }
+
+                Obj mX(DATA, length);  const Obj& X = mX;
+                LOOP2_ASSERT(offset, length,
+                             (expected ^ 0xffffffff) == X.checksum());
+
+                const int SPLITS[] = { 1, 15, 16, 17, 63, 64, 65, 200 };
+                const int NUM_SPLITS = sizeof SPLITS / sizeof *SPLITS;
+
+                for (int j = 0; j < NUM_SPLITS; ++j) {
+                    const int SPLIT = SPLITS[j];
+                    if (SPLIT > length) {
+                        continue;
+                    }
+
+                    Obj mY;  const Obj& Y = mY;
+                    mY.update(DATA, SPLIT);
+                    mY.update(DATA + SPLIT, length - SPLIT);
+                    LOOP3_ASSERT(offset, length, SPLIT, X == Y);
+                }
+            }
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TESTING CRC_TABLE
@@ -2674,6 +2765,70 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // THROUGHPUT TEST
+        //
+        // Concerns:
+        //: 1 Report the throughput of 'update', and of the table
+        //:   implementation, across a range of buffer sizes.
+        //
+        // Plan:
+        //: 1 For each buffer size, checksum about 256MB of data in buffers of
+        //:   that size with 'update' and with 'Crc32_Impl::updateSoftware',
+        //:   and report the throughput of each in MB/s.  (C-1)
+        //
+        // Testing:
+        //   THROUGHPUT TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTHROUGHPUT TEST"
+                          << "\n===============" << endl;
+
+        typedef bdlde::Crc32_Impl Impl;
+
+        cout << "Hardware accelerated: "
+             << (Impl::isHardwareAccelerated() ? "yes" : "no") << endl;
+
+        const int SIZES[] = { 16, 64, 256, 1024, 4096, 65536, 1048576 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+        const bsls::Types::Int64 TOTAL = 256 * 1024 * 1024;
+
+        bsl::vector<char> buffer(SIZES[NUM_SIZES - 1], 'x');
+        for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+            buffer[i] = static_cast<char>(i * 7);
+        }
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            const int SIZE       = SIZES[i];
+            const int ITERATIONS = static_cast<int>(TOTAL / SIZE);
+
+            Obj             mX;
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int j = 0; j < ITERATIONS; ++j) {
+                mX.update(&buffer[0], SIZE);
+            }
+            timer.stop();
+            const double updateTime = timer.elapsedTime();
+
+            unsigned int crc = 0xffffffff;
+            timer.reset();
+            timer.start();
+            for (int j = 0; j < ITERATIONS; ++j) {
+                crc = Impl::updateSoftware(crc, &buffer[0], SIZE);
+            }
+            timer.stop();
+            const double softwareTime = timer.elapsedTime();
+
+            ASSERT((crc ^ 0xffffffff) == mX.checksum());
+
+            const double MB = static_cast<double>(TOTAL) / (1024 * 1024);
+            cout << "size " << SIZE
+                 << ":\tupdate " << MB / updateTime << " MB/s"
+                 << "\tsoftware " << MB / softwareTime << " MB/s" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
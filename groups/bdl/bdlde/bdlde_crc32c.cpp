@@ -0,0 +1,388 @@
+// bdlde_crc32c.cpp                                                   -*-C++-*-
+#include <bdlde_crc32c.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlde_crc32c_cpp,"$Id$ $CSID$")
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The software implementation is the classic table-driven algorithm (see
+// Sarwate, D.V., "Computation of Cyclic Redundancy Checks via Table Look-Up",
+// Communications of the ACM, 31(8), pp. 1008-1013), using the bit-reflected
+// Castagnoli polynomial 0x82F63B78.  'CRC_TABLE' was generated by:
+//..
+//  for (unsigned int n = 0; n < 256; ++n) {
+//      unsigned int c = n;
+//      for (int k = 0; k < 8; ++k) {
+//          c = c & 1 ? 0x82f63b78 ^ (c >> 1) : c >> 1;
+//      }
+//      CRC_TABLE[n] = c;
+//  }
+//..
+// The hardware implementation uses the SSE4.2 'crc32' instruction, which
+// computes exactly this (reflected, non-inverted) update for 1, 4, or 8 bytes
+// at a time.  The bytes preceding the first 8-byte aligned address are
+// processed one at a time so that the main loop performs aligned loads.
+//
+// The 'crc32' instruction has a latency of 3 cycles but a throughput of one
+// per cycle, so a single dependency chain uses only a third of its capacity.
+// On x86-64, when the CPU also supports 'PCLMULQDQ', large buffers are
+// therefore processed as consecutive triples of equal blocks, whose checksums
+// are computed by three independent chains (the last two starting from 0) and
+// then combined: by linearity, the state after the triple is
+// 'shift(shift(crc0, n) ^ crc1, n) ^ crc2', where 'shift(crc, n)' is the state
+// obtained by appending 'n' zero bytes, i.e., 'crc * x^(8n) mod P'.  'shift'
+// is one carry-less multiplication by the constant 'x^(8n-33) mod P' (in the
+// bit-reflected domain), reduced modulo 'P' by a 'crc32' of the 64-bit
+// product.  Blocks of 4096 bytes are used first, then blocks of 256 bytes.
+//
+// The availability of the instructions is determined once, using 'cpuid',
+// and cached; the functions using them are compiled with the 'target'
+// attribute so that the rest of the component does not require them.
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+#include <bsl_ostream.h>
+
+#if (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))    \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BDLDE_CRC32C_SSE42 1
+#include <cpuid.h>
+#include <nmmintrin.h>
+#include <wmmintrin.h>
+#endif
+
+namespace BloombergLP {
+namespace {
+
+// STATIC DATA
+
+const unsigned int CRC_TABLE[256] = {
+    0x00000000, 0xf26b8303, 0xe13b70f7, 0x1350f3f4, 0xc79a971f,
+    0x35f1141c, 0x26a1e7e8, 0xd4ca64eb, 0x8ad958cf, 0x78b2dbcc,
+    0x6be22838, 0x9989ab3b, 0x4d43cfd0, 0xbf284cd3, 0xac78bf27,
+    0x5e133c24, 0x105ec76f, 0xe235446c, 0xf165b798, 0x030e349b,
+    0xd7c45070, 0x25afd373, 0x36ff2087, 0xc494a384, 0x9a879fa0,
+    0x68ec1ca3, 0x7bbcef57, 0x89d76c54, 0x5d1d08bf, 0xaf768bbc,
+    0xbc267848, 0x4e4dfb4b, 0x20bd8ede, 0xd2d60ddd, 0xc186fe29,
+    0x33ed7d2a, 0xe72719c1, 0x154c9ac2, 0x061c6936, 0xf477ea35,
+    0xaa64d611, 0x580f5512, 0x4b5fa6e6, 0xb93425e5, 0x6dfe410e,
+    0x9f95c20d, 0x8cc531f9, 0x7eaeb2fa, 0x30e349b1, 0xc288cab2,
+    0xd1d83946, 0x23b3ba45, 0xf779deae, 0x05125dad, 0x1642ae59,
+    0xe4292d5a, 0xba3a117e, 0x4851927d, 0x5b016189, 0xa96ae28a,
+    0x7da08661, 0x8fcb0562, 0x9c9bf696, 0x6ef07595, 0x417b1dbc,
+    0xb3109ebf, 0xa0406d4b, 0x522bee48, 0x86e18aa3, 0x748a09a0,
+    0x67dafa54, 0x95b17957, 0xcba24573, 0x39c9c670, 0x2a993584,
+    0xd8f2b687, 0x0c38d26c, 0xfe53516f, 0xed03a29b, 0x1f682198,
+    0x5125dad3, 0xa34e59d0, 0xb01eaa24, 0x42752927, 0x96bf4dcc,
+    0x64d4cecf, 0x77843d3b, 0x85efbe38, 0xdbfc821c, 0x2997011f,
+    0x3ac7f2eb, 0xc8ac71e8, 0x1c661503, 0xee0d9600, 0xfd5d65f4,
+    0x0f36e6f7, 0x61c69362, 0x93ad1061, 0x80fde395, 0x72966096,
+    0xa65c047d, 0x5437877e, 0x4767748a, 0xb50cf789, 0xeb1fcbad,
+    0x197448ae, 0x0a24bb5a, 0xf84f3859, 0x2c855cb2, 0xdeeedfb1,
+    0xcdbe2c45, 0x3fd5af46, 0x7198540d, 0x83f3d70e, 0x90a324fa,
+    0x62c8a7f9, 0xb602c312, 0x44694011, 0x5739b3e5, 0xa55230e6,
+    0xfb410cc2, 0x092a8fc1, 0x1a7a7c35, 0xe811ff36, 0x3cdb9bdd,
+    0xceb018de, 0xdde0eb2a, 0x2f8b6829, 0x82f63b78, 0x709db87b,
+    0x63cd4b8f, 0x91a6c88c, 0x456cac67, 0xb7072f64, 0xa457dc90,
+    0x563c5f93, 0x082f63b7, 0xfa44e0b4, 0xe9141340, 0x1b7f9043,
+    0xcfb5f4a8, 0x3dde77ab, 0x2e8e845f, 0xdce5075c, 0x92a8fc17,
+    0x60c37f14, 0x73938ce0, 0x81f80fe3, 0x55326b08, 0xa759e80b,
+    0xb4091bff, 0x466298fc, 0x1871a4d8, 0xea1a27db, 0xf94ad42f,
+    0x0b21572c, 0xdfeb33c7, 0x2d80b0c4, 0x3ed04330, 0xccbbc033,
+    0xa24bb5a6, 0x502036a5, 0x4370c551, 0xb11b4652, 0x65d122b9,
+    0x97baa1ba, 0x84ea524e, 0x7681d14d, 0x2892ed69, 0xdaf96e6a,
+    0xc9a99d9e, 0x3bc21e9d, 0xef087a76, 0x1d63f975, 0x0e330a81,
+    0xfc588982, 0xb21572c9, 0x407ef1ca, 0x532e023e, 0xa145813d,
+    0x758fe5d6, 0x87e466d5, 0x94b49521, 0x66df1622, 0x38cc2a06,
+    0xcaa7a905, 0xd9f75af1, 0x2b9cd9f2, 0xff56bd19, 0x0d3d3e1a,
+    0x1e6dcdee, 0xec064eed, 0xc38d26c4, 0x31e6a5c7, 0x22b65633,
+    0xd0ddd530, 0x0417b1db, 0xf67c32d8, 0xe52cc12c, 0x1747422f,
+    0x49547e0b, 0xbb3ffd08, 0xa86f0efc, 0x5a048dff, 0x8ecee914,
+    0x7ca56a17, 0x6ff599e3, 0x9d9e1ae0, 0xd3d3e1ab, 0x21b862a8,
+    0x32e8915c, 0xc083125f, 0x144976b4, 0xe622f5b7, 0xf5720643,
+    0x07198540, 0x590ab964, 0xab613a67, 0xb831c993, 0x4a5a4a90,
+    0x9e902e7b, 0x6cfbad78, 0x7fab5e8c, 0x8dc0dd8f, 0xe330a81a,
+    0x115b2b19, 0x020bd8ed, 0xf0605bee, 0x24aa3f05, 0xd6c1bc06,
+    0xc5914ff2, 0x37faccf1, 0x69e9f0d5, 0x9b8273d6, 0x88d28022,
+    0x7ab90321, 0xae7367ca, 0x5c18e4c9, 0x4f48173d, 0xbd23943e,
+    0xf36e6f75, 0x0105ec76, 0x12551f82, 0xe03e9c81, 0x34f4f86a,
+    0xc69f7b69, 0xd5cf889d, 0x27a40b9e, 0x79b737ba, 0x8bdcb4b9,
+    0x988c474d, 0x6ae7c44e, 0xbe2da0a5, 0x4c4623a6, 0x5f16d052,
+    0xad7d5351
+};
+
+#ifdef BDLDE_CRC32C_SSE42
+
+enum {
+    e_UNKNOWN      = 0,  // CPU support not yet determined
+    e_SOFTWARE     = 1,  // no SSE4.2
+    e_SSE42        = 2,  // SSE4.2 but no 'PCLMULQDQ'
+    e_SSE42_CLMUL  = 3   // SSE4.2 and 'PCLMULQDQ'
+};
+
+enum {
+    k_LONG_BLOCK  = 4096,  // size of the blocks of the long triples
+    k_SHORT_BLOCK = 256    // size of the blocks of the short triples
+};
+
+bsls::AtomicOperations::AtomicTypes::Int s_cpuState = { e_UNKNOWN };
+    // support of the CPU for the instructions used by this component
+
+#ifdef BSLS_PLATFORM_CPU_X86_64
+
+const long long k_LONG_SHIFT  = 0x82f89c77;  // x^(8 * 4096 - 33) mod P
+const long long k_SHORT_SHIFT = 0xb9e02b86;  // x^(8 * 256 - 33) mod P
+
+__attribute__((target("sse4.2,pclmul")))
+inline
+bsls::Types::Uint64 shift(bsls::Types::Uint64 crc, long long constant)
+    // Return the specified 'crc' state updated with a number of zero bytes
+    // corresponding to the specified 'constant' (see the implementation
+    // notes).
+{
+    const __m128i product = _mm_clmulepi64_si128(
+                                _mm_cvtsi64_si128(static_cast<long long>(crc)),
+                                _mm_cvtsi64_si128(constant),
+                                0x00);
+    return _mm_crc32_u64(0, _mm_cvtsi128_si64(product));
+}
+
+__attribute__((target("sse4.2,pclmul")))
+bsls::Types::Uint64 updateTriples(bsls::Types::Uint64   crc,
+                                  const unsigned char **data,
+                                  int                  *length,
+                                  int                   blockSize,
+                                  long long             shiftConstant)
+    // Return the specified 'crc' state updated with the longest prefix of the
+    // specified '*data' having the specified '*length' that is a multiple of
+    // three times the specified 'blockSize', using three independent chains
+    // of 'crc32' instructions combined by the specified 'shiftConstant', and
+    // advance '*data' and decrease '*length' accordingly.  The behavior is
+    // undefined unless 'shiftConstant' corresponds to 'blockSize', and
+    // 'blockSize' is a multiple of 8.
+{
+    const unsigned char *p = *data;
+    int                  n = *length;
+
+    while (n >= 3 * blockSize) {
+        bsls::Types::Uint64 crc1 = 0;
+        bsls::Types::Uint64 crc2 = 0;
+
+        for (const unsigned char *end = p + blockSize; p < end; p += 8) {
+            bsls::Types::Uint64 word0, word1, word2;
+            bsl::memcpy(&word0, p,                 8);
+            bsl::memcpy(&word1, p + blockSize,     8);
+            bsl::memcpy(&word2, p + 2 * blockSize, 8);
+            crc  = _mm_crc32_u64(crc,  word0);
+            crc1 = _mm_crc32_u64(crc1, word1);
+            crc2 = _mm_crc32_u64(crc2, word2);
+        }
+
+        crc = shift(crc, shiftConstant) ^ crc1;
+        crc = shift(crc, shiftConstant) ^ crc2;
+
+        p += 2 * blockSize;
+        n -= 3 * blockSize;
+    }
+
+    *data   = p;
+    *length = n;
+    return crc;
+}
+
+#endif
+
+__attribute__((target("sse4.2")))
+unsigned int updateSse42(unsigned int         crc,
+                         const unsigned char *data,
+                         int                  length,
+                         bool                 useTriples)
+    // Return the specified 'crc' state updated with the specified 'data'
+    // having the specified 'length', using the SSE4.2 'crc32' instruction,
+    // and, if the specified 'useTriples' is 'true', 'PCLMULQDQ'.
+{
+    while (length > 0 && reinterpret_cast<bsls::Types::UintPtr>(data) & 7) {
+        crc = _mm_crc32_u8(crc, *data);
+        ++data;
+        --length;
+    }
+
+#ifdef BSLS_PLATFORM_CPU_X86_64
+    bsls::Types::Uint64 crc64 = crc;
+    if (useTriples) {
+        crc64 = updateTriples(crc64,
+                              &data,
+                              &length,
+                              k_LONG_BLOCK,
+                              k_LONG_SHIFT);
+        crc64 = updateTriples(crc64,
+                              &data,
+                              &length,
+                              k_SHORT_BLOCK,
+                              k_SHORT_SHIFT);
+    }
+    while (length >= 8) {
+        bsls::Types::Uint64 word;
+        bsl::memcpy(&word, data, 8);
+        crc64 = _mm_crc32_u64(crc64, word);
+        data   += 8;
+        length -= 8;
+    }
+    crc = static_cast<unsigned int>(crc64);
+#endif
+
+    while (length >= 4) {
+        unsigned int word;
+        bsl::memcpy(&word, data, 4);
+        crc = _mm_crc32_u32(crc, word);
+        data   += 4;
+        length -= 4;
+    }
+
+    while (length > 0) {
+        crc = _mm_crc32_u8(crc, *data);
+        ++data;
+        --length;
+    }
+
+    return crc;
+}
+
+#endif
+
+}  // close unnamed namespace
+
+namespace bdlde {
+
+                                // ------------
+                                // class Crc32c
+                                // ------------
+
+// MANIPULATORS
+void Crc32c::update(const void *data, int length)
+{
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(data || !length);
+
+    if (Crc32c_Impl::isHardwareAccelerated()) {
+        d_crc = Crc32c_Impl::updateHardware(d_crc, data, length);
+    }
+    else {
+        d_crc = Crc32c_Impl::updateSoftware(d_crc, data, length);
+    }
+}
+
+// ACCESSORS
+bsl::ostream& Crc32c::print(bsl::ostream& stream) const
+{
+    const char         *hex = "0123456789abcdef";
+    const unsigned int  crc = checksum();
+
+    char array[2 + 8 + 1];  // 2 for "0x"; 8 for the CRC; 1 for '\0'
+
+    array[0] = '0';
+    array[1] = 'x';
+    for (int i = 0; i < 8; ++i) {
+        array[2 + i] = hex[(crc >> (28 - 4 * i)) & 0xf];
+    }
+    array[10] = '\0';
+
+    return stream << array;
+}
+
+                              // ------------------
+                              // struct Crc32c_Impl
+                              // ------------------
+
+// CLASS METHODS
+bool Crc32c_Impl::isHardwareAccelerated()
+{
+#ifdef BDLDE_CRC32C_SSE42
+    int state = bsls::AtomicOperations::getIntRelaxed(&s_cpuState);
+    if (e_UNKNOWN == state) {
+        unsigned int eax, ebx, ecx, edx;
+        if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !(ecx & bit_SSE4_2)) {
+            state = e_SOFTWARE;
+        }
+        else {
+            state = ecx & bit_PCLMUL ? e_SSE42_CLMUL : e_SSE42;
+        }
+        bsls::AtomicOperations::setIntRelaxed(&s_cpuState, state);
+    }
+    return e_SOFTWARE != state;
+#else
+    return false;
+#endif
+}
+
+unsigned int Crc32c_Impl::updateHardware(unsigned int  crc,
+                                         const void   *data,
+                                         int           length)
+{
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(data || !length);
+    BSLS_ASSERT(isHardwareAccelerated());
+
+#ifdef BDLDE_CRC32C_SSE42
+    const bool useTriples =
+          e_SSE42_CLMUL == bsls::AtomicOperations::getIntRelaxed(&s_cpuState);
+
+    return updateSse42(crc,
+                       static_cast<const unsigned char *>(data),
+                       length,
+                       useTriples);
+#else
+    return updateSoftware(crc, data, length);
+#endif
+}
+
+unsigned int Crc32c_Impl::updateSoftware(unsigned int  crc,
+                                         const void   *data,
+                                         int           length)
+{
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(data || !length);
+
+    const unsigned char *d = static_cast<const unsigned char *>(data);
+
+    while (length >= 4) {
+        crc = CRC_TABLE[(crc ^ d[0]) & 0xff] ^ (crc >> 8);
+        crc = CRC_TABLE[(crc ^ d[1]) & 0xff] ^ (crc >> 8);
+        crc = CRC_TABLE[(crc ^ d[2]) & 0xff] ^ (crc >> 8);
+        crc = CRC_TABLE[(crc ^ d[3]) & 0xff] ^ (crc >> 8);
+        d      += 4;
+        length -= 4;
+    }
+
+    while (length > 0) {
+        crc = CRC_TABLE[(crc ^ *d) & 0xff] ^ (crc >> 8);
+        ++d;
+        --length;
+    }
+
+    return crc;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,711 @@
+// bdlde_crc32c.t.cpp                                                 -*-C++-*-
+#include <bdlde_crc32c.h>
+
+#include <bdlde_crc32.h>
+
+#include <bslim_testutil.h>
+
+#include <bslx_testinstream.h>
+#include <bslx_testoutstream.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              OVERVIEW
+// The component under test is a value-semantic scalar whose state is a single
+// unsigned integer.  We need to verify that 'update' computes the CRC-32C
+// checksum correctly (using published check values), that the hardware and
+// software implementations agree for all lengths and alignments, that
+// incremental updates are equivalent to a single update, and that the value
+// semantic operations and 'bdex' streaming work as expected.
+//
+// In addition to positive test cases (run in the nightly builds), a negative
+// test case -1 can be run manually to report the throughput of 'update' for a
+// range of buffer sizes, compared with the software implementation and with
+// 'bdlde::Crc32'.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 6] static int maxSupportedBdexVersion(int);
+//
+// CREATORS
+// [ 1] Crc32c();
+// [ 2] Crc32c(const void *data, int length);
+// [ 4] Crc32c(const Crc32c& original);
+//
+// MANIPULATORS
+// [ 4] Crc32c& operator=(const Crc32c& rhs);
+// [ 6] STREAM& bdexStreamIn(STREAM& stream, int version);
+// [ 4] unsigned int checksumAndReset();
+// [ 4] void reset();
+// [ 3] void update(const void *data, int length);
+//
+// ACCESSORS
+// [ 6] STREAM& bdexStreamOut(STREAM& stream, int version) const;
+// [ 2] unsigned int checksum() const;
+// [ 5] bsl::ostream& print(bsl::ostream& stream) const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const Crc32c& lhs, const Crc32c& rhs);
+// [ 4] bool operator!=(const Crc32c& lhs, const Crc32c& rhs);
+// [ 5] bsl::ostream& operator<<(bsl::ostream& stream, const Crc32c&);
+//
+// IMPLEMENTATION
+// [ 3] bool Crc32c_Impl::isHardwareAccelerated();
+// [ 3] unsigned int Crc32c_Impl::updateHardware(unsigned int, ...);
+// [ 3] unsigned int Crc32c_Impl::updateSoftware(unsigned int, ...);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [-1] THROUGHPUT TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlde::Crc32c      Obj;
+typedef bdlde::Crc32c_Impl Impl;
+
+typedef bslx::TestInStream  In;
+typedef bslx::TestOutStream Out;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS  FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+unsigned int referenceCrc32c(const unsigned char *data, int length)
+    // Return the CRC-32C checksum of the specified 'data' having the specified
+    // 'length', computed one bit at a time.
+{
+    unsigned int crc = 0xffffffff;
+    for (int i = 0; i < length; ++i) {
+        crc ^= data[i];
+        for (int k = 0; k < 8; ++k) {
+            crc = (crc >> 1) ^ (0x82f63b78 & (0 - (crc & 1)));
+        }
+    }
+    return crc ^ 0xffffffff;
+}
+
+void fillPseudoRandom(bsl::vector<unsigned char> *buffer, unsigned int seed)
+    // Fill the specified 'buffer' with pseudo-random bytes generated from the
+    // specified 'seed'.
+{
+    for (bsl::size_t i = 0; i < buffer->size(); ++i) {
+        seed = seed * 1103515245 + 12345;
+        (*buffer)[i] = static_cast<unsigned char>(seed >> 16);
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Verifying a Journal Record
+///- - - - - - - - - - - - - - - - - - -
+// Suppose that records appended to a journal file are prefixed by the CRC-32C
+// checksum of their payload, so that corruption can be detected when the
+// journal is replayed.
+//
+// First, we compute the checksum of a record being written:
+//..
+    const char   payload[] = "account=1234;amount=100.00";
+    const int    length    = sizeof payload - 1;
+
+    bdlde::Crc32c crc(payload, length);
+    unsigned int  storedChecksum = crc.checksum();
+//..
+// Then, when the record is replayed, we compute the checksum again, this time
+// incrementally, as the payload may be read in several pieces, and verify
+// that it matches:
+//..
+    bdlde::Crc32c replayed;
+    replayed.update(payload, 10);
+    replayed.update(payload + 10, length - 10);
+
+    ASSERT(storedChecksum == replayed.checksum());
+//..
+// Finally, we observe that the checksum of the standard check input
+// "123456789" is the well-known value for CRC-32C:
+//..
+    ASSERT(0xe3069283 == bdlde::Crc32c("123456789", 9).checksum());
+//..
+
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // BDEX STREAMING
+        //
+        // Concerns:
+        //: 1 A checksum streamed out and back in has the same value, and
+        //:   continues to be updated as the original would be.
+        //:
+        //: 2 An unsupported version invalidates the stream and leaves the
+        //:   object unchanged.
+        //:
+        //: 3 An invalid or truncated input stream leaves the object
+        //:   unchanged.
+        //
+        // Plan:
+        //: 1 Stream out checksums of several values, stream them into
+        //:   default-constructed objects, and verify that the values and
+        //:   subsequent updates match.  (C-1)
+        //:
+        //: 2 Stream using versions 0 and 2 and verify the stream state.
+        //:   (C-2)
+        //:
+        //: 3 Stream in from an empty and from an invalidated stream.  (C-3)
+        //
+        // Testing:
+        //   static int maxSupportedBdexVersion(int);
+        //   STREAM& bdexStreamIn(STREAM& stream, int version);
+        //   STREAM& bdexStreamOut(STREAM& stream, int version) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBDEX STREAMING"
+                          << "\n==============" << endl;
+
+        const int VERSION = Obj::maxSupportedBdexVersion(20160101);
+        ASSERT(1 == VERSION);
+
+        const char *DATA[] = { "", "a", "abc", "123456789",
+                               "The quick brown fox jumps over the lazy dog" };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const int LENGTH = static_cast<int>(bsl::strlen(DATA[i]));
+            const Obj X(DATA[i], LENGTH);
+
+            Out out(20160101);
+            X.bdexStreamOut(out, VERSION);
+            ASSERT(out);
+
+            In  in(out.data(), out.length());
+            Obj mY;  const Obj& Y = mY;
+            mY.bdexStreamIn(in, VERSION);
+            ASSERT(in);
+            ASSERT(in.isEmpty());
+            LOOP_ASSERT(i, X == Y);
+
+            Obj mX(X);
+            mX.update("xyz", 3);
+            mY.update("xyz", 3);
+            LOOP_ASSERT(i, X != Y);
+            LOOP_ASSERT(i, mX == Y);
+        }
+
+        if (verbose) cout << "\tUnsupported versions." << endl;
+        {
+            const Obj X("abc", 3);
+
+            Out out(20160101);
+            X.bdexStreamOut(out, 0);
+            ASSERT(!out);
+
+            Out out2(20160101);
+            X.bdexStreamOut(out2, VERSION);
+
+            In  in(out2.data(), out2.length());
+            Obj mY;  const Obj& Y = mY;
+            mY.bdexStreamIn(in, 2);
+            ASSERT(!in);
+            ASSERT(Obj() == Y);
+        }
+
+        if (verbose) cout << "\tInvalid input streams." << endl;
+        {
+            In  in("", 0);
+            Obj mY("abc", 3);  const Obj& Y = mY;
+            mY.bdexStreamIn(in, VERSION);
+            ASSERT(!in);
+            ASSERT(Obj("abc", 3) == Y);
+
+            Out out(20160101);
+            Obj("def", 3).bdexStreamOut(out, VERSION);
+
+            In in2(out.data(), out.length());
+            in2.invalidate();
+            mY.bdexStreamIn(in2, VERSION);
+            ASSERT(Obj("abc", 3) == Y);
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // PRINT AND OUTPUT OPERATOR
+        //
+        // Concerns:
+        //: 1 The checksum is printed as "0x" followed by exactly 8 lower-case
+        //:   hexadecimal digits, including leading zeros.
+        //:
+        //: 2 'operator<<' produces the same output as 'print' and returns the
+        //:   stream.
+        //
+        // Plan:
+        //: 1 Print checksums with known values and compare with the expected
+        //:   strings.  (C-1..2)
+        //
+        // Testing:
+        //   bsl::ostream& print(bsl::ostream& stream) const;
+        //   bsl::ostream& operator<<(bsl::ostream& stream, const Crc32c&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPRINT AND OUTPUT OPERATOR"
+                          << "\n=========================" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_data;
+            const char *d_expected;
+        } DATA[] = {
+            //LINE  DATA         EXPECTED
+            //----  -----------  ------------
+            { L_,   "",          "0x00000000" },
+            { L_,   "a",         "0xc1d04330" },
+            { L_,   "123456789", "0xe3069283" },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const int   LINE     = DATA[i].d_line;
+            const Obj   X(DATA[i].d_data,
+                          static_cast<int>(bsl::strlen(DATA[i].d_data)));
+
+            bsl::ostringstream os1;
+            bsl::ostringstream os2;
+
+            ASSERTV(LINE, &os1 == &X.print(os1));
+            ASSERTV(LINE, &os2 == &(os2 << X));
+
+            if (veryVerbose) { P_(LINE) P(os1.str()) }
+
+            ASSERTV(LINE, os1.str(), DATA[i].d_expected == os1.str());
+            ASSERTV(LINE, os2.str(), DATA[i].d_expected == os2.str());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // VALUE SEMANTICS
+        //
+        // Concerns:
+        //: 1 Copies have the value of the original, and are independent of
+        //:   it.
+        //:
+        //: 2 Assignment, including self-assignment, assigns the value and
+        //:   returns a reference to the object.
+        //:
+        //: 3 Equality compares checksums.
+        //:
+        //: 4 'reset' and 'checksumAndReset' restore the default value, the
+        //:   latter returning the previous checksum.
+        //
+        // Plan:
+        //: 1 Exercise each operation on checksums of distinct data and verify
+        //:   the results.  (C-1..4)
+        //
+        // Testing:
+        //   Crc32c(const Crc32c& original);
+        //   Crc32c& operator=(const Crc32c& rhs);
+        //   unsigned int checksumAndReset();
+        //   void reset();
+        //   bool operator==(const Crc32c& lhs, const Crc32c& rhs);
+        //   bool operator!=(const Crc32c& lhs, const Crc32c& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nVALUE SEMANTICS"
+                          << "\n===============" << endl;
+
+        const Obj A;
+        const Obj B("abc", 3);
+        const Obj C("abd", 3);
+
+        ASSERT(A == A);  ASSERT(!(A != A));
+        ASSERT(B == B);  ASSERT(!(B != B));
+        ASSERT(A != B);  ASSERT(!(A == B));
+        ASSERT(B != C);  ASSERT(!(B == C));
+
+        Obj mX(B);  const Obj& X = mX;
+        ASSERT(B == X);
+        mX.update("x", 1);
+        ASSERT(B != X);
+        ASSERT(Obj("abc", 3) == B);
+
+        Obj mY;  const Obj& Y = mY;
+        ASSERT(&mY == &(mY = C));
+        ASSERT(C == Y);
+        ASSERT(&mY == &(mY = Y));
+        ASSERT(C == Y);
+
+        const unsigned int CHECKSUM = Y.checksum();
+        ASSERT(CHECKSUM == mY.checksumAndReset());
+        ASSERT(A == Y);
+        ASSERT(0 == Y.checksum());
+
+        mY = C;
+        mY.reset();
+        ASSERT(A == Y);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // HARDWARE AND SOFTWARE IMPLEMENTATIONS AGREE
+        //
+        // Concerns:
+        //: 1 The software implementation, and the hardware implementation
+        //:   (if supported), compute the CRC-32C checksum for any length and
+        //:   alignment of the data.
+        //:
+        //: 2 'update' computes the same checksum whether the data is supplied
+        //:   in one or several calls.
+        //
+        // Plan:
+        //: 1 For every length up to 300 bytes, for lengths around the
+        //:   thresholds of the interleaved hardware implementation, and for
+        //:   every alignment up to 16, compare the results of
+        //:   'updateSoftware', 'updateHardware' (if 'isHardwareAccelerated'),
+        //:   and 'update' with a bitwise reference implementation.  (C-1)
+        //:
+        //: 2 Split the data at regular intervals, supply the parts to
+        //:   'update', and verify the resulting checksum.  (C-2)
+        //
+        // Testing:
+        //   void update(const void *data, int length);
+        //   bool Crc32c_Impl::isHardwareAccelerated();
+        //   unsigned int Crc32c_Impl::updateHardware(unsigned int, ...);
+        //   unsigned int Crc32c_Impl::updateSoftware(unsigned int, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nHARDWARE AND SOFTWARE IMPLEMENTATIONS AGREE"
+                          << "\n==========================================="
+                          << endl;
+
+        const bool HW = Impl::isHardwareAccelerated();
+        if (verbose) { P(HW) }
+
+        ASSERT(HW == Impl::isHardwareAccelerated());
+
+        enum { k_MAX_SHORT_LENGTH = 300, k_MAX_OFFSET = 16 };
+
+        const int LONG_LENGTHS[] = { 767, 768, 769, 1543, 2304, 12287,
+                                     12288, 12288 + 768 + 13, 40000 };
+        const int NUM_LONG_LENGTHS = sizeof LONG_LENGTHS
+                                   / sizeof *LONG_LENGTHS;
+        const int MAX_LENGTH       = LONG_LENGTHS[NUM_LONG_LENGTHS - 1];
+
+        bsl::vector<int> lengths;
+        for (int length = 0; length <= k_MAX_SHORT_LENGTH; ++length) {
+            lengths.push_back(length);
+        }
+        lengths.insert(lengths.end(),
+                       LONG_LENGTHS,
+                       LONG_LENGTHS + NUM_LONG_LENGTHS);
+
+        bsl::vector<unsigned char> buffer(MAX_LENGTH + k_MAX_OFFSET);
+        fillPseudoRandom(&buffer, 54321);
+
+        for (int offset = 0; offset < k_MAX_OFFSET; ++offset) {
+            const unsigned char *DATA = &buffer[offset];
+
+            for (bsl::size_t i = 0; i < lengths.size(); ++i) {
+                const int length = lengths[i];
+                const unsigned int EXPECTED = referenceCrc32c(DATA, length);
+
+                const unsigned int SOFTWARE = 0xffffffff
+                             ^ Impl::updateSoftware(0xffffffff, DATA, length);
+                ASSERTV(offset, length, EXPECTED == SOFTWARE);
+
+                if (HW) {
+                    const unsigned int HARDWARE = 0xffffffff
+                             ^ Impl::updateHardware(0xffffffff, DATA, length);
+                    ASSERTV(offset, length, EXPECTED == HARDWARE);
+                }
+
+                const Obj X(DATA, length);
+                ASSERTV(offset, length, EXPECTED == X.checksum());
+
+                const int STEP = length > k_MAX_SHORT_LENGTH ? 997 : 7;
+                for (int split = 0; split <= length; split += STEP) {
+                    Obj mY;  const Obj& Y = mY;
+                    mY.update(DATA, split);
+                    mY.update(DATA + split, length - split);
+                    ASSERTV(offset, length, split, X == Y);
+                }
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // KNOWN CHECK VALUES
+        //
+        // Concerns:
+        //: 1 The checksum of well-known inputs matches the published CRC-32C
+        //:   values.
+        //
+        // Plan:
+        //: 1 Verify the checksum of "123456789" and of the test patterns
+        //:   given in RFC 3720, appendix B.4.  (C-1)
+        //
+        // Testing:
+        //   Crc32c(const void *data, int length);
+        //   unsigned int checksum() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nKNOWN CHECK VALUES"
+                          << "\n==================" << endl;
+
+        ASSERT(0xe3069283 == Obj("123456789", 9).checksum());
+
+        unsigned char zeros[32], ones[32], incrementing[32], decrementing[32];
+        for (int i = 0; i < 32; ++i) {
+            zeros[i]        = 0;
+            ones[i]         = 0xff;
+            incrementing[i] = static_cast<unsigned char>(i);
+            decrementing[i] = static_cast<unsigned char>(31 - i);
+        }
+
+        ASSERT(0x8a9136aa == Obj(zeros,        32).checksum());
+        ASSERT(0x62a8ab43 == Obj(ones,         32).checksum());
+        ASSERT(0x46dd794e == Obj(incrementing, 32).checksum());
+        ASSERT(0x113fdb5c == Obj(decrementing, 32).checksum());
+
+        if (verbose) cout << "\tComparing software implementation." << endl;
+
+        ASSERT(0xe3069283 ==
+                         (0xffffffff ^ Impl::updateSoftware(0xffffffff,
+                                                            "123456789",
+                                                            9)));
+        ASSERT(0x46dd794e ==
+                         (0xffffffff ^ Impl::updateSoftware(0xffffffff,
+                                                            incrementing,
+                                                            32)));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create checksums, update them, and compare them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0 == X.checksum());
+
+        mX.update("1234", 4);
+        mX.update("56789", 5);
+        ASSERT(0xe3069283 == X.checksum());
+
+        Obj mY(X);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        mY.update(0, 0);
+        ASSERT(X == Y);
+
+        mY.update("0", 1);
+        ASSERT(X != Y);
+
+        // CRC-32 and CRC-32C differ.
+
+        ASSERT(bdlde::Crc32("123456789", 9).checksum() != X.checksum());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // THROUGHPUT TEST
+        //
+        // Concerns:
+        //: 1 Report the throughput of 'update' across a range of buffer
+        //:   sizes, compared with the software implementation and with
+        //:   'bdlde::Crc32'.
+        //
+        // Plan:
+        //: 1 For each buffer size, checksum about 256MB of data in buffers of
+        //:   that size and report the throughput in MB/s.  (C-1)
+        //
+        // Testing:
+        //   THROUGHPUT TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTHROUGHPUT TEST"
+                          << "\n===============" << endl;
+
+        cout << "Hardware accelerated: "
+             << (Impl::isHardwareAccelerated() ? "yes" : "no") << endl;
+
+        const int SIZES[] = { 16, 64, 256, 1024, 4096, 65536, 1048576 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+        const bsls::Types::Int64 TOTAL = 256 * 1024 * 1024;
+        const double             MB    = static_cast<double>(TOTAL)
+                                       / (1024 * 1024);
+
+        bsl::vector<unsigned char> buffer(SIZES[NUM_SIZES - 1]);
+        fillPseudoRandom(&buffer, 1);
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            const int SIZE       = SIZES[i];
+            const int ITERATIONS = static_cast<int>(TOTAL / SIZE);
+
+            bsls::Stopwatch timer;
+
+            Obj mX;
+            timer.start();
+            for (int j = 0; j < ITERATIONS; ++j) {
+                mX.update(&buffer[0], SIZE);
+            }
+            timer.stop();
+            const double crc32cTime = timer.elapsedTime();
+
+            unsigned int crc = 0xffffffff;
+            timer.reset();
+            timer.start();
+            for (int j = 0; j < ITERATIONS; ++j) {
+                crc = Impl::updateSoftware(crc, &buffer[0], SIZE);
+            }
+            timer.stop();
+            const double softwareTime = timer.elapsedTime();
+
+            ASSERT((crc ^ 0xffffffff) == mX.checksum());
+
+            bdlde::Crc32 crc32;
+            timer.reset();
+            timer.start();
+            for (int j = 0; j < ITERATIONS; ++j) {
+                crc32.update(&buffer[0], SIZE);
+            }
+            timer.stop();
+            const double crc32Time = timer.elapsedTime();
+
+            cout << "size " << SIZE
+                 << ":\tCrc32c " << MB / crc32cTime    << " MB/s"
+                 << "\tsoftware " << MB / softwareTime << " MB/s"
+                 << "\tCrc32 "    << MB / crc32Time    << " MB/s" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,364 @@
+// bdlma_hugepageallocator.cpp                                        -*-C++-*-
+#include <bdlma_hugepageallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_hugepageallocator_cpp,"$Id$ $CSID$")
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>      // 'BSLS_THROW'
+#include <bsls_platform.h>
+
+#include <bsl_new.h>                 // 'bsl::bad_alloc'
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+#include <windows.h>   // 'VirtualAlloc', 'VirtualFree', 'VirtualLock'
+
+#else
+
+#include <sys/mman.h>  // 'mmap', 'munmap', 'madvise', 'mlock'
+
+#endif
+
+///Implementation Notes
+///--------------------
+// Each region begins with a 'Region' header linking it into the list of
+// regions of the allocator and recording its size.  The header is padded to
+// the maximum alignment, so that the memory following it is maximally
+// aligned, and dispensed blocks are rounded up to the maximum alignment.
+//
+// Transparent huge pages can back only the huge-page-aligned portions of a
+// mapping, and 'mmap' aligns mappings only to the (small) page size.  A
+// region is therefore mapped with one extra huge page, and the unaligned head
+// and the tail of the mapping are unmapped.  The 'MADV_HUGEPAGE' advice must
+// precede the first access to the region, so prefaulting is performed by
+// touching the pages after the advice is given, rather than by 'MAP_POPULATE'.
+
+namespace BloombergLP {
+namespace {
+
+enum {
+    k_HUGE_PAGE_SIZE  = 2 * 1024 * 1024,  // size of a huge page
+
+    k_PREFAULT_STRIDE = 4096              // distance between the bytes that
+                                          // are written to prefault a region
+};
+
+void *systemMap(bsls::Types::size_type size, bool useExplicitHugePages)
+    // Map a region of the specified 'size' (in bytes) of read/write memory,
+    // aligned on a huge-page boundary, and return its address, or 0 if the
+    // region cannot be mapped.  If the specified 'useExplicitHugePages' is
+    // 'true', map the region from the pool of reserved huge pages, and return
+    // 0 if the pool cannot satisfy the request.  The behavior is undefined
+    // unless 'size' is a multiple of the huge page size.
+{
+    BSLS_ASSERT(0 == size % k_HUGE_PAGE_SIZE);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    // Large pages require the 'SeLockMemoryPrivilege' privilege on Windows,
+    // and are not supported by this component.
+
+    if (useExplicitHugePages) {
+        return 0;                                                     // RETURN
+    }
+
+    return VirtualAlloc(0, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+
+#else
+
+    if (useExplicitHugePages) {
+#ifdef MAP_HUGETLB
+        void *address = mmap(0,
+                             size,
+                             PROT_READ | PROT_WRITE,
+                             MAP_ANON | MAP_PRIVATE | MAP_HUGETLB,
+                             -1,
+                             0);
+
+        return MAP_FAILED == address ? 0 : address;                   // RETURN
+#else
+        return 0;                                                     // RETURN
+#endif
+    }
+
+    const bsls::Types::size_type mappedSize = size + k_HUGE_PAGE_SIZE;
+
+    void *address = mmap(0,
+                         mappedSize,
+                         PROT_READ | PROT_WRITE,
+                         MAP_ANON | MAP_PRIVATE,
+                         -1,
+                         0);
+
+    if (MAP_FAILED == address) {
+        return 0;                                                     // RETURN
+    }
+
+    // Trim the mapping to the huge-page-aligned region.  On some of our
+    // platforms, 'munmap' takes a 'char *' argument, while on others it takes
+    // a 'void *'.
+
+    char *mapped  = static_cast<char *>(address);
+    char *aligned = mapped + bsls::AlignmentUtil::calculateAlignmentOffset(
+                                                             mapped,
+                                                             k_HUGE_PAGE_SIZE);
+
+    const bsls::Types::size_type headSize = aligned - mapped;
+    const bsls::Types::size_type tailSize = k_HUGE_PAGE_SIZE - headSize;
+
+    if (headSize) {
+        munmap(mapped, headSize);
+    }
+    if (tailSize) {
+        munmap(aligned + size, tailSize);
+    }
+
+#ifdef MADV_HUGEPAGE
+    // The advice is only a hint; the region is usable whether or not it is
+    // honored.
+
+    madvise(aligned, size, MADV_HUGEPAGE);
+#endif
+
+    return aligned;
+
+#endif
+}
+
+void systemUnmap(void *address, bsls::Types::size_type size)
+    // Return the region of the specified 'size' (in bytes) at the specified
+    // 'address' to the operating system.  The behavior is undefined unless
+    // 'address' and 'size' describe a region returned by 'systemMap'.
+{
+    BSLS_ASSERT(address);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    VirtualFree(address, 0, MEM_RELEASE);
+    (void)size;
+
+#else
+
+    munmap(static_cast<char *>(address), size);
+
+#endif
+}
+
+bool systemLock(void *address, bsls::Types::size_type size)
+    // Lock the region of the specified 'size' (in bytes) at the specified
+    // 'address' in physical memory.  Return 'true' on success, and 'false'
+    // otherwise.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    return VirtualLock(address, size);
+
+#else
+
+    return 0 == mlock(static_cast<char *>(address), size);
+
+#endif
+}
+
+void prefault(void *address, bsls::Types::size_type size)
+    // Write to every page of the region of the specified 'size' (in bytes) at
+    // the specified 'address', so that the pages are faulted in.
+{
+    volatile char *region = static_cast<char *>(address);
+
+    for (bsls::Types::size_type offset = 0;
+         offset < size;
+         offset += k_PREFAULT_STRIDE) {
+        region[offset] = 0;
+    }
+}
+
+bsls::Types::size_type roundUp(bsls::Types::size_type size,
+                               bsls::Types::size_type alignment)
+    // Return the specified 'size' rounded up to a multiple of the specified
+    // 'alignment'.  The behavior is undefined unless 'alignment' is a power of
+    // two.
+{
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+bsls::Types::size_type roundUpToHugePage(bsls::Types::size_type size)
+    // Return the specified 'size' rounded up to a multiple of the huge page
+    // size.
+{
+    return roundUp(size, k_HUGE_PAGE_SIZE);
+}
+
+bsls::Types::size_type roundUpToMaxAlignment(bsls::Types::size_type size)
+    // Return the specified 'size' rounded up to a multiple of the maximum
+    // alignment.
+{
+    return roundUp(size, bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+}
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                      // ================================
+                      // struct HugePageAllocator::Region
+                      // ================================
+
+struct HugePageAllocator::Region {
+    // This struct describes a region mapped by a 'HugePageAllocator'; it is
+    // located at the beginning of the region it describes.
+
+    Region                 *d_next_p;      // next region in the list
+    bsls::Types::size_type  d_size;        // size (in bytes) of this region
+    bool                    d_isExplicit;  // mapped from reserved huge pages
+    bool                    d_isLocked;    // locked in physical memory
+};
+
+                          // -----------------------
+                          // class HugePageAllocator
+                          // -----------------------
+
+// PRIVATE MANIPULATORS
+void *HugePageAllocator::allocateRegion(bsls::Types::size_type size)
+{
+    const bsls::Types::size_type regionSize = roundUpToHugePage(size);
+
+    bool  isExplicit = false;
+    void *address    = 0;
+
+    if (d_options & e_EXPLICIT_HUGE_PAGES) {
+        address    = systemMap(regionSize, true);
+        isExplicit = 0 != address;
+    }
+    if (!address) {
+        address = systemMap(regionSize, false);
+    }
+    if (!address) {
+        BSLS_THROW(bsl::bad_alloc());
+    }
+
+    if (d_options & e_PREFAULT) {
+        prefault(address, regionSize);
+    }
+
+    const bool isLocked = (d_options & e_LOCK)
+                       && systemLock(address, regionSize);
+
+    Region *region       = static_cast<Region *>(address);
+    region->d_next_p     = d_regions_p;
+    region->d_size       = regionSize;
+    region->d_isExplicit = isExplicit;
+    region->d_isLocked   = isLocked;
+    d_regions_p          = region;
+
+    d_numBytesMapped += regionSize;
+    if (isExplicit) {
+        d_numBytesExplicit += regionSize;
+    }
+    if (isLocked) {
+        d_numBytesLocked += regionSize;
+    }
+
+    return static_cast<char *>(address) + roundUpToMaxAlignment(
+                                                              sizeof(Region));
+}
+
+// CLASS METHODS
+bsls::Types::size_type HugePageAllocator::hugePageSize()
+{
+    return k_HUGE_PAGE_SIZE;
+}
+
+// CREATORS
+HugePageAllocator::HugePageAllocator(int                    options,
+                                     bsls::Types::size_type regionSize)
+: d_options(options)
+, d_regionSize(roundUpToHugePage(regionSize ? regionSize : hugePageSize()))
+, d_regions_p(0)
+, d_cursor_p(0)
+, d_end_p(0)
+, d_numBytesMapped(0)
+, d_numBytesExplicit(0)
+, d_numBytesLocked(0)
+{
+    BSLS_ASSERT(0 == (options & ~(e_EXPLICIT_HUGE_PAGES
+                                | e_PREFAULT
+                                | e_LOCK)));
+}
+
+HugePageAllocator::~HugePageAllocator()
+{
+    release();
+}
+
+// MANIPULATORS
+void *HugePageAllocator::allocate(bsls::Types::size_type size)
+{
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsls::Types::size_type alignedSize = roundUpToMaxAlignment(size);
+
+    if (static_cast<bsls::Types::size_type>(d_end_p - d_cursor_p)
+                                                             >= alignedSize) {
+        void *address = d_cursor_p;
+        d_cursor_p += alignedSize;
+        return address;                                               // RETURN
+    }
+
+    const bsls::Types::size_type headerSize =
+                                         roundUpToMaxAlignment(sizeof(Region));
+
+    if (alignedSize > d_regionSize - headerSize) {
+        // The request does not fit in a shared region: give it a dedicated
+        // region, and continue to dispense memory from the current region.
+
+        return allocateRegion(alignedSize + headerSize);              // RETURN
+    }
+
+    char *address = static_cast<char *>(allocateRegion(d_regionSize));
+
+    d_cursor_p = address + alignedSize;
+    d_end_p    = address + (d_regionSize - headerSize);
+
+    return address;
+}
+
+void HugePageAllocator::release()
+{
+    Region *region = d_regions_p;
+    while (region) {
+        Region *next = region->d_next_p;
+        systemUnmap(region, region->d_size);
+        region = next;
+    }
+
+    d_regions_p        = 0;
+    d_cursor_p         = 0;
+    d_end_p            = 0;
+    d_numBytesMapped   = 0;
+    d_numBytesExplicit = 0;
+    d_numBytesLocked   = 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
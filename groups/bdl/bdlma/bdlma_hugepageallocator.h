@@ -0,0 +1,363 @@
+// bdlma_hugepageallocator.h                                          -*-C++-*-
+#ifndef INCLUDED_BDLMA_HUGEPAGEALLOCATOR
+#define INCLUDED_BDLMA_HUGEPAGEALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a managed allocator of memory backed by huge pages.
+//
+//@CLASSES:
+//  bdlma::HugePageAllocator: arena allocator of huge-page-backed regions
+//
+//@SEE_ALSO: bdlma_heapbypassallocator, bdlma_bufferedsequentialallocator,
+//           bdlma_multipool
+//
+//@DESCRIPTION: This component provides a concrete allocation mechanism,
+// 'bdlma::HugePageAllocator', that implements the 'bdlma::ManagedAllocator'
+// protocol and dispenses memory from large regions mapped directly from
+// virtual memory, with a request to the operating system that the regions be
+// backed by huge pages (2MB pages on Linux):
+//..
+//   ,------------------------.
+//  ( bdlma::HugePageAllocator )
+//   `------------------------'
+//               |         ctor/dtor
+//               |         options
+//               |         regionSize
+//               |         numBytesMapped
+//               |         numBytesInExplicitHugePages
+//               |         numBytesLocked
+//               |         hugePageSize
+//               V
+//   ,-----------------------.
+//  ( bdlma::ManagedAllocator )
+//   `-----------------------'
+//               |         release
+//               V
+//      ,----------------.
+//     ( bslma::Allocator )
+//      `----------------'
+//                         allocate
+//                         deallocate      // no-op
+//..
+// Programs that randomly access large data structures (e.g., hash tables or
+// order books) spend a significant fraction of their time servicing TLB
+// misses when the structures are backed by ordinary (4KB) pages.  Backing
+// such structures by huge pages reduces the number of TLB entries they need by
+// a factor of 512.
+//
+// Like 'bdlma::HeapBypassAllocator', a 'bdlma::HugePageAllocator' is an arena:
+// memory is dispensed sequentially from the current region, individual
+// deallocations have no effect, and all memory is returned to the operating
+// system by 'release' or on destruction.  A request too large to fit in a
+// region is satisfied from a dedicated region of its own.  The allocator is
+// intended to be supplied as the backing (upstream) allocator of an allocator
+// or pool that requests large chunks of memory and manages the reuse of
+// memory itself, such as 'bdlma::BufferedSequentialAllocator',
+// 'bdlma::SequentialAllocator', or 'bdlma::Multipool'.
+//
+// Note that, unlike many other BDE allocators, a 'bslma::Allocator *' cannot
+// be (optionally) supplied upon construction of a 'HugePageAllocator'; the
+// allocator has no memory requirements of its own beyond the regions that it
+// maps.
+//
+///Options
+///-------
+// The behavior of the allocator is configured at construction by a bitwise OR
+// of the 'HugePageAllocator::Option' enumerators:
+//
+//: 'e_EXPLICIT_HUGE_PAGES':
+//:   Request that regions be mapped from the pool of explicitly reserved huge
+//:   pages (e.g., using 'MAP_HUGETLB' on Linux).  If the request fails (e.g.,
+//:   because too few huge pages are reserved), the region is mapped as though
+//:   this option had not been specified.  By default, regions are mapped from
+//:   ordinary memory, aligned on a huge-page boundary, and the operating
+//:   system is advised to back them by transparent huge pages (e.g., using
+//:   'madvise(MADV_HUGEPAGE)' on Linux).
+//:
+//: 'e_PREFAULT':
+//:   Write to every page of a region when it is mapped, so that no page
+//:   faults occur when the memory is first used.
+//:
+//: 'e_LOCK':
+//:   Lock regions in physical memory (e.g., using 'mlock'), so that they are
+//:   never paged out.  Locking is subject to operating-system limits, and
+//:   regions that cannot be locked are used unlocked.
+//
+// The 'numBytesInExplicitHugePages' and 'numBytesLocked' accessors report how
+// much of the mapped memory was obtained with each request honored.  On
+// platforms that do not support huge pages, regions are mapped from ordinary
+// memory.
+//
+///Thread Safety
+///-------------
+// 'bdlma::HugePageAllocator' is *not* thread-safe.  Clients requiring a
+// thread-safe huge-page allocator may wrap it in a
+// 'bdlma::ConcurrentAllocatorAdapter'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Backing a Multipool with Huge Pages
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we maintain a large number of small order records, allocated
+// from a 'bdlma::Multipool', and accessed at random.  To reduce the TLB misses
+// incurred by the random accesses, we back the multipool by huge pages.
+//
+// First, we create a huge-page allocator that prefaults the regions it maps,
+// so that no page fault occurs when the orders are first accessed, and that
+// maps regions of 8MB:
+//..
+//  bdlma::HugePageAllocator hugePageAllocator(
+//                                  bdlma::HugePageAllocator::e_PREFAULT,
+//                                  8 * 1024 * 1024);
+//..
+// Then, we create a multipool that obtains its memory from
+// 'hugePageAllocator':
+//..
+//  bdlma::Multipool multipool(&hugePageAllocator);
+//..
+// Next, we allocate a number of orders from the multipool:
+//..
+//  struct Order {
+//      bsls::Types::Int64 d_id;
+//      double             d_price;
+//      int                d_quantity;
+//  };
+//
+//  for (int i = 0; i < 100000; ++i) {
+//      Order *order = static_cast<Order *>(multipool.allocate(sizeof(Order)));
+//      order->d_id       = i;
+//      order->d_price    = 100.0;
+//      order->d_quantity = 10;
+//  }
+//..
+// Then, we observe that the memory of the multipool was mapped by
+// 'hugePageAllocator' in regions that are multiples of the huge page size:
+//..
+//  const bsls::Types::size_type hugePageSize =
+//                                  bdlma::HugePageAllocator::hugePageSize();
+//
+//  assert(0 <  hugePageAllocator.numBytesMapped());
+//  assert(0 == hugePageAllocator.numBytesMapped() % hugePageSize);
+//..
+// Finally, we release the memory of the multipool; the regions are returned to
+// the operating system when 'hugePageAllocator' is destroyed (or released):
+//..
+//  multipool.release();
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_MANAGEDALLOCATOR
+#include <bdlma_managedallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                          // =======================
+                          // class HugePageAllocator
+                          // =======================
+
+class HugePageAllocator : public ManagedAllocator {
+    // This class provides a concrete managed allocator that dispenses
+    // maximally-aligned memory sequentially from regions mapped from virtual
+    // memory and backed, where supported, by huge pages.  Memory is returned
+    // to the operating system only by 'release' or on destruction.
+
+  public:
+    // TYPES
+    enum Option {
+        // Enumerate the options that may be combined (using bitwise OR) to
+        // configure a 'HugePageAllocator' at construction.
+
+        e_DEFAULT              = 0,       // transparent huge pages, mapped on
+                                          // demand, not locked
+
+        e_EXPLICIT_HUGE_PAGES  = 1 << 0,  // map from reserved huge pages if
+                                          // possible
+
+        e_PREFAULT             = 1 << 1,  // touch every page when mapped
+
+        e_LOCK                 = 1 << 2   // lock regions in physical memory
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct Region;                                // implementation detail
+
+    // DATA
+    int                     d_options;            // bitwise OR of 'Option'
+
+    bsls::Types::size_type  d_regionSize;         // size of regions shared
+                                                  // by several allocations
+
+    Region                 *d_regions_p;          // list of mapped regions
+
+    char                   *d_cursor_p;           // next free byte of the
+                                                  // current region
+
+    char                   *d_end_p;              // end of the current
+                                                  // region
+
+    bsls::Types::size_type  d_numBytesMapped;     // total size of regions
+
+    bsls::Types::size_type  d_numBytesExplicit;   // size of regions mapped
+                                                  // from reserved huge pages
+
+    bsls::Types::size_type  d_numBytesLocked;     // size of locked regions
+
+  private:
+    // NOT IMPLEMENTED
+    HugePageAllocator(const HugePageAllocator&);
+    HugePageAllocator& operator=(const HugePageAllocator&);
+
+  private:
+    // PRIVATE MANIPULATORS
+    void *allocateRegion(bsls::Types::size_type size);
+        // Map a region of at least the specified 'size' (in bytes), a multiple
+        // of the huge page size, according to the options of this allocator,
+        // add it to the list of regions, and return the address of its first
+        // byte available for allocation.  The end of the available memory is
+        // loaded into 'd_end_p' if the region is to be shared.  Throw
+        // 'bsl::bad_alloc' if the region cannot be mapped.
+
+  public:
+    // CLASS METHODS
+    static bsls::Types::size_type hugePageSize();
+        // Return the size (in bytes) of a huge page, to a multiple of which
+        // the size of every region is rounded up.
+
+    // CREATORS
+    explicit
+    HugePageAllocator(int                    options    = e_DEFAULT,
+                      bsls::Types::size_type regionSize = 0);
+        // Create a huge-page allocator.  Optionally specify 'options', a
+        // bitwise OR of 'Option' enumerators, configuring how regions are
+        // mapped.  If 'options' is not specified, 'e_DEFAULT' is used.
+        // Optionally specify 'regionSize', the minimum size (in bytes) of the
+        // regions from which several allocations are dispensed.  If
+        // 'regionSize' is 0 or not specified, the huge page size is used.
+        // 'regionSize' is rounded up to a multiple of the huge page size.
+
+    virtual ~HugePageAllocator();
+        // Destroy this allocator, returning all memory it has mapped to the
+        // operating system.
+
+    // MANIPULATORS
+    virtual void *allocate(bsls::Types::size_type size);
+        // Return a newly-allocated maximally-aligned block of memory of
+        // (at least) the specified 'size' (in bytes).  If 'size' is 0, a null
+        // pointer is returned with no other effect.  If this allocator cannot
+        // return the requested number of bytes, then it will throw a
+        // 'bsl::bad_alloc' exception in an exception-enabled build, or else
+        // will abort the program in a non-exception build.
+
+    virtual void deallocate(void *address);
+        // This method has no effect; the memory block at the specified
+        // 'address' is returned to the operating system only when 'release'
+        // is called or this allocator is destroyed.
+
+    virtual void release();
+        // Return all memory mapped by this allocator to the operating system.
+        // The effect of using a pointer obtained from this allocator before
+        // this call is undefined.
+
+    // ACCESSORS
+    bsls::Types::size_type numBytesInExplicitHugePages() const;
+        // Return the total size (in bytes) of the regions currently mapped by
+        // this allocator from the pool of explicitly reserved huge pages.
+
+    bsls::Types::size_type numBytesLocked() const;
+        // Return the total size (in bytes) of the regions currently mapped by
+        // this allocator that are locked in physical memory.
+
+    bsls::Types::size_type numBytesMapped() const;
+        // Return the total size (in bytes) of the regions currently mapped by
+        // this allocator.
+
+    int options() const;
+        // Return the options of this allocator, a bitwise OR of 'Option'
+        // enumerators.
+
+    bsls::Types::size_type regionSize() const;
+        // Return the minimum size (in bytes) of the regions mapped by this
+        // allocator.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class HugePageAllocator
+                          // -----------------------
+
+// MANIPULATORS
+inline
+void HugePageAllocator::deallocate(void *)
+{
+}
+
+// ACCESSORS
+inline
+bsls::Types::size_type HugePageAllocator::numBytesInExplicitHugePages() const
+{
+    return d_numBytesExplicit;
+}
+
+inline
+bsls::Types::size_type HugePageAllocator::numBytesLocked() const
+{
+    return d_numBytesLocked;
+}
+
+inline
+bsls::Types::size_type HugePageAllocator::numBytesMapped() const
+{
+    return d_numBytesMapped;
+}
+
+inline
+int HugePageAllocator::options() const
+{
+    return d_options;
+}
+
+inline
+bsls::Types::size_type HugePageAllocator::regionSize() const
+{
+    return d_regionSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,770 @@
+// bdlma_hugepageallocator.t.cpp                                      -*-C++-*-
+#include <bdlma_hugepageallocator.h>
+
+#include <bdlma_bufferedsequentialallocator.h>  // for testing only
+#include <bdlma_multipool.h>                    // for testing only
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::HugePageAllocator' is an arena allocator: blocks are dispensed
+// sequentially from regions mapped from virtual memory, and are returned to
+// the operating system only by 'release' or on destruction.  We must verify
+// that the blocks are maximally aligned, disjoint, and writable, that regions
+// are sized (and aligned) in multiples of the huge page size, that large
+// requests obtain dedicated regions without discarding the current region,
+// and that the accounting accessors track the mapped regions.  Whether the
+// operating system honors the requests for huge pages, prefaulting, and
+// locking is not observable in a portable way; we verify only that each
+// option is accepted, and that the allocator falls back to ordinary memory.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] size_type hugePageSize();
+//
+// CREATORS
+// [ 2] explicit HugePageAllocator(int options, size_type regionSize);
+// [ 4] ~HugePageAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+// [ 4] void release();
+//
+// ACCESSORS
+// [ 5] size_type numBytesInExplicitHugePages() const;
+// [ 5] size_type numBytesLocked() const;
+// [ 3] size_type numBytesMapped() const;
+// [ 2] int options() const;
+// [ 2] size_type regionSize() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] CONCERN: The allocator can back sequential allocators and multipools.
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: RANDOM ACCESS
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::HugePageAllocator Obj;
+typedef bsls::Types::size_type   size_type;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+
+enum { k_MAX_ALIGNMENT = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT };
+
+const size_type HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bsls::Types::UintPtr toInt(const void *address)
+    // Return the specified 'address' as an integer.
+{
+    return reinterpret_cast<bsls::Types::UintPtr>(address);
+}
+
+bool isMaximallyAligned(const void *address)
+    // Return 'true' if the specified 'address' is maximally aligned, and
+    // 'false' otherwise.
+{
+    return 0 == toInt(address) % k_MAX_ALIGNMENT;
+}
+
+bsls::Types::UintPtr offsetInHugePage(const void *address)
+    // Return the offset of the specified 'address' from the start of the huge
+    // page containing it.
+{
+    return toInt(address) % HUGE_PAGE_SIZE;
+}
+
+double timeRandomAccess(char      *buffer,
+                        size_type  size,
+                        int        numAccesses)
+    // Return the time (in seconds) taken to perform the specified
+    // 'numAccesses' read-modify-write accesses at pseudo-random offsets of
+    // the specified 'buffer' of the specified 'size'.
+{
+    bsls::Types::Uint64 state = 0x9E3779B97F4A7C15ULL;
+
+    bsls::Stopwatch timer;
+    timer.start();
+
+    for (int i = 0; i < numAccesses; ++i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        ++buffer[(state >> 16) % size];
+    }
+
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Backing a Multipool with Huge Pages
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we maintain a large number of small order records, allocated
+// from a 'bdlma::Multipool', and accessed at random.  To reduce the TLB misses
+// incurred by the random accesses, we back the multipool by huge pages.
+//
+// First, we create a huge-page allocator that prefaults the regions it maps,
+// so that no page fault occurs when the orders are first accessed, and that
+// maps regions of 8MB:
+//..
+    bdlma::HugePageAllocator hugePageAllocator(
+                                    bdlma::HugePageAllocator::e_PREFAULT,
+                                    8 * 1024 * 1024);
+//..
+// Then, we create a multipool that obtains its memory from
+// 'hugePageAllocator':
+//..
+    bdlma::Multipool multipool(&hugePageAllocator);
+//..
+// Next, we allocate a number of orders from the multipool:
+//..
+    struct Order {
+        bsls::Types::Int64 d_id;
+        double             d_price;
+        int                d_quantity;
+    };
+
+    for (int i = 0; i < 100000; ++i) {
+        Order *order = static_cast<Order *>(multipool.allocate(sizeof(Order)));
+        order->d_id       = i;
+        order->d_price    = 100.0;
+        order->d_quantity = 10;
+    }
+//..
+// Then, we observe that the memory of the multipool was mapped by
+// 'hugePageAllocator' in regions that are multiples of the huge page size:
+//..
+    const bsls::Types::size_type hugePageSize =
+                                    bdlma::HugePageAllocator::hugePageSize();
+
+    ASSERT(0 <  hugePageAllocator.numBytesMapped());
+    ASSERT(0 == hugePageAllocator.numBytesMapped() % hugePageSize);
+//..
+// Finally, we release the memory of the multipool; the regions are returned to
+// the operating system when 'hugePageAllocator' is destroyed (or released):
+//..
+    multipool.release();
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // BACKING OTHER ALLOCATORS
+        //
+        // Concerns:
+        //: 1 A 'HugePageAllocator' can serve as the backing allocator of a
+        //:   'bdlma::BufferedSequentialAllocator' and a 'bdlma::Multipool'.
+        //:
+        //: 2 The memory of those allocators comes from the regions of the
+        //:   huge-page allocator, and not from the default allocator.
+        //
+        // Plan:
+        //: 1 Create a buffered sequential allocator and a multipool supplied
+        //:   with a huge-page allocator, allocate and fill many blocks from
+        //:   each, verify that the huge-page allocator mapped memory and that
+        //:   the default allocator was not used, and release.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: The allocator can back sequential allocators and
+        //            multipools.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BACKING OTHER ALLOCATORS" << endl
+                          << "========================" << endl;
+
+        if (verbose) cout << "\t'bdlma::BufferedSequentialAllocator'" << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            char                              buffer[256];
+            bdlma::BufferedSequentialAllocator bsa(buffer,
+                                                   sizeof buffer,
+                                                   &mX);
+
+            for (int i = 0; i < 10000; ++i) {
+                char *block = static_cast<char *>(bsa.allocate(100));
+                bsl::memset(block, 'a', 100);
+            }
+
+            ASSERT(0 < X.numBytesMapped());
+
+            bsa.release();
+        }
+        ASSERT(0 == defaultAllocator.numAllocations());
+
+        if (verbose) cout << "\t'bdlma::Multipool'" << endl;
+        {
+            Obj mX(Obj::e_PREFAULT);  const Obj& X = mX;
+
+            bdlma::Multipool multipool(&mX);
+
+            bsl::vector<void *> blocks(
+                                      &bslma::NewDeleteAllocator::singleton());
+
+            for (int i = 0; i < 10000; ++i) {
+                const int size = 1 + i % 500;
+
+                void *block = multipool.allocate(size);
+                ASSERT(isMaximallyAligned(block) || size < k_MAX_ALIGNMENT);
+                bsl::memset(block, 'b', size);
+                blocks.push_back(block);
+            }
+
+            ASSERT(0 <  X.numBytesMapped());
+            ASSERT(0 == X.numBytesMapped() % HUGE_PAGE_SIZE);
+
+            for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                multipool.deallocate(blocks[i]);
+            }
+        }
+        ASSERT(0 == defaultAllocator.numAllocations());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // OPTIONS
+        //
+        // Concerns:
+        //: 1 Each combination of options is accepted, and the allocator
+        //:   dispenses usable memory whether or not the operating system
+        //:   honors the requests for explicit huge pages and locking.
+        //:
+        //: 2 'numBytesInExplicitHugePages' and 'numBytesLocked' are 0 unless
+        //:   the corresponding option is specified, and never exceed
+        //:   'numBytesMapped'.
+        //:
+        //: 3 Prefaulted memory is zero-initialized.
+        //
+        // Plan:
+        //: 1 For each combination of options, allocate and fill blocks in two
+        //:   regions, and verify the accessors.  (C-1..3)
+        //
+        // Testing:
+        //   size_type numBytesInExplicitHugePages() const;
+        //   size_type numBytesLocked() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "OPTIONS" << endl
+                          << "=======" << endl;
+
+        for (int options = 0; options < 8; ++options) {
+            Obj mX(options);  const Obj& X = mX;
+
+            ASSERTV(options, options == X.options());
+
+            for (int i = 0; i < 2; ++i) {
+                char *block = static_cast<char *>(
+                                                mX.allocate(HUGE_PAGE_SIZE));
+                ASSERTV(options, i, block);
+
+                if (options & Obj::e_PREFAULT) {
+                    ASSERTV(options, i, 0 == block[0]);
+                    ASSERTV(options, i, 0 == block[HUGE_PAGE_SIZE - 1]);
+                }
+
+                bsl::memset(block, 'c', HUGE_PAGE_SIZE);
+            }
+
+            if (veryVerbose) {
+                T_ P_(options) P_(X.numBytesMapped())
+                P_(X.numBytesInExplicitHugePages()) P(X.numBytesLocked())
+            }
+
+            ASSERTV(options, 0 < X.numBytesMapped());
+            ASSERTV(options,
+                    X.numBytesInExplicitHugePages() <= X.numBytesMapped());
+            ASSERTV(options, X.numBytesLocked() <= X.numBytesMapped());
+
+            if (!(options & Obj::e_EXPLICIT_HUGE_PAGES)) {
+                ASSERTV(options, 0 == X.numBytesInExplicitHugePages());
+            }
+            if (!(options & Obj::e_LOCK)) {
+                ASSERTV(options, 0 == X.numBytesLocked());
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'release' AND DESTRUCTOR
+        //
+        // Concerns:
+        //: 1 'release' unmaps all regions, and resets the accounting.
+        //:
+        //: 2 The allocator is usable after 'release'.
+        //:
+        //: 3 The destructor unmaps all regions.
+        //
+        // Plan:
+        //: 1 Allocate blocks from several regions, 'release', and verify that
+        //:   'numBytesMapped' is 0; allocate again, and verify that a new
+        //:   region is mapped.  (C-1..2)
+        //:
+        //: 2 Repeatedly create an allocator, allocate a large amount of memory
+        //:   from it, and destroy it; the test would exhaust the address space
+        //:   of a 32-bit process if regions leaked.  (C-3)
+        //
+        // Testing:
+        //   ~HugePageAllocator();
+        //   void release();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'release' AND DESTRUCTOR" << endl
+                          << "========================" << endl;
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            for (int i = 0; i < 10; ++i) {
+                mX.allocate(HUGE_PAGE_SIZE / 2);
+            }
+            ASSERT(5 * HUGE_PAGE_SIZE <= X.numBytesMapped());
+
+            mX.release();
+
+            ASSERT(0 == X.numBytesMapped());
+            ASSERT(0 == X.numBytesInExplicitHugePages());
+            ASSERT(0 == X.numBytesLocked());
+
+            char *block = static_cast<char *>(mX.allocate(100));
+            bsl::memset(block, 'd', 100);
+
+            ASSERT(HUGE_PAGE_SIZE == X.numBytesMapped());
+        }
+
+        for (int i = 0; i < 64; ++i) {
+            Obj mX;
+
+            void *block = mX.allocate(64 * 1024 * 1024);
+            ASSERTV(i, block);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 'allocate(0)' returns 0 and maps nothing.
+        //:
+        //: 2 Blocks are maximally aligned, disjoint, and writable.
+        //:
+        //: 3 Blocks are dispensed sequentially from a shared region until it
+        //:   is exhausted, and the regions are aligned on a huge-page
+        //:   boundary.
+        //:
+        //: 4 A request larger than a region is satisfied from a dedicated
+        //:   region, sized to a multiple of the huge page size, and the
+        //:   remainder of the current region continues to be used.
+        //:
+        //: 5 'deallocate' has no effect.
+        //:
+        //: 6 'numBytesMapped' is the total size of the mapped regions.
+        //
+        // Plan:
+        //: 1 Call 'allocate(0)'.  (C-1)
+        //:
+        //: 2 Allocate blocks of increasing sizes, verify their alignment, and
+        //:   verify that each block starts at or after the end of the
+        //:   previous block in the same region.  (C-2..3, 6)
+        //:
+        //: 3 Allocate a block larger than the region size, verify the mapped
+        //:   size, and verify that the next small block follows the previous
+        //:   small block.  (C-4, 6)
+        //:
+        //: 4 Deallocate blocks, and verify that 'numBytesMapped' is
+        //:   unchanged.  (C-5)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   size_type numBytesMapped() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'allocate' AND 'deallocate'" << endl
+                          << "===========================" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        ASSERT(0 == mX.allocate(0));
+        ASSERT(0 == X.numBytesMapped());
+
+        if (verbose) cout << "\tSequential allocation." << endl;
+
+        char *first = static_cast<char *>(mX.allocate(1));
+
+        ASSERT(isMaximallyAligned(first));
+        ASSERT(HUGE_PAGE_SIZE == X.numBytesMapped());
+        ASSERTV(offsetInHugePage(first),
+                offsetInHugePage(first) <= 4 * k_MAX_ALIGNMENT);
+
+        char      *previous     = first;
+        size_type  previousSize = 1;
+        size_type  total        = 1;
+
+        for (size_type size = 1; total < HUGE_PAGE_SIZE / 2; size += 13) {
+            char *block = static_cast<char *>(mX.allocate(size));
+
+            LOOP_ASSERT(size, isMaximallyAligned(block));
+            LOOP_ASSERT(size, previous + previousSize <= block);
+            LOOP_ASSERT(size, block - previous
+                                       < static_cast<bsls::Types::IntPtr>(
+                                              previousSize + k_MAX_ALIGNMENT));
+
+            bsl::memset(block, 'e', size);
+
+            previous     = block;
+            previousSize = size;
+            total       += size;
+        }
+        ASSERT(HUGE_PAGE_SIZE == X.numBytesMapped());
+
+        if (verbose) cout << "\tDedicated regions." << endl;
+
+        const size_type LARGE = 3 * HUGE_PAGE_SIZE + 1;
+
+        char *large = static_cast<char *>(mX.allocate(LARGE));
+
+        ASSERT(isMaximallyAligned(large));
+        ASSERTV(X.numBytesMapped(), 5 * HUGE_PAGE_SIZE == X.numBytesMapped());
+
+        bsl::memset(large, 'f', LARGE);
+
+        char *next = static_cast<char *>(mX.allocate(8));
+
+        ASSERT(previous + previousSize <= next);
+        ASSERT(next - previous < static_cast<bsls::Types::IntPtr>(
+                                              previousSize + k_MAX_ALIGNMENT));
+        ASSERT(5 * HUGE_PAGE_SIZE == X.numBytesMapped());
+
+        if (verbose) cout << "\tExhausting a region." << endl;
+
+        char *block = static_cast<char *>(mX.allocate(HUGE_PAGE_SIZE / 2));
+
+        ASSERT(6 * HUGE_PAGE_SIZE == X.numBytesMapped());
+        ASSERTV(offsetInHugePage(block),
+                offsetInHugePage(block) <= 4 * k_MAX_ALIGNMENT);
+
+        bsl::memset(block, 'g', HUGE_PAGE_SIZE / 2);
+
+        if (verbose) cout << "\t'deallocate'." << endl;
+
+        mX.deallocate(block);
+        mX.deallocate(large);
+        mX.deallocate(first);
+
+        ASSERT(6 * HUGE_PAGE_SIZE == X.numBytesMapped());
+        ASSERT('e' == previous[0]);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The options and region size supplied at construction are
+        //:   reported by the accessors, with the region size rounded up to a
+        //:   multiple of the huge page size.
+        //:
+        //: 2 The default options are 'e_DEFAULT' and the default region size
+        //:   is the huge page size.
+        //:
+        //: 3 No memory is mapped at construction.
+        //
+        // Plan:
+        //: 1 Create objects using a table of options and region sizes, and
+        //:   verify the accessors.  (C-1..3)
+        //
+        // Testing:
+        //   size_type hugePageSize();
+        //   explicit HugePageAllocator(int options, size_type regionSize);
+        //   int options() const;
+        //   size_type regionSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        ASSERT(HUGE_PAGE_SIZE == Obj::hugePageSize());
+
+        {
+            const Obj X;
+
+            ASSERT(Obj::e_DEFAULT  == X.options());
+            ASSERT(HUGE_PAGE_SIZE  == X.regionSize());
+            ASSERT(0               == X.numBytesMapped());
+        }
+
+        static const struct {
+            int       d_line;
+            int       d_options;
+            size_type d_regionSize;
+            size_type d_expRegionSize;
+        } DATA[] = {
+            //LINE  OPTIONS                      REGION SIZE             EXP
+            //----  ---------------------------  ----------------------  ---
+            { L_,   Obj::e_DEFAULT,              0                     , 1 },
+            { L_,   Obj::e_PREFAULT,             1                     , 1 },
+            { L_,   Obj::e_LOCK,                 HUGE_PAGE_SIZE        , 1 },
+            { L_,   Obj::e_EXPLICIT_HUGE_PAGES,  HUGE_PAGE_SIZE + 1    , 2 },
+            { L_,   Obj::e_PREFAULT|Obj::e_LOCK, 5 * HUGE_PAGE_SIZE    , 5 },
+            { L_,   7,                           8 * HUGE_PAGE_SIZE - 1, 8 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int       LINE        = DATA[ti].d_line;
+            const int       OPTIONS     = DATA[ti].d_options;
+            const size_type REGION_SIZE = DATA[ti].d_regionSize;
+            const size_type EXP         = DATA[ti].d_expRegionSize
+                                                             * HUGE_PAGE_SIZE;
+
+            const Obj X(OPTIONS, REGION_SIZE);
+
+            ASSERTV(LINE, OPTIONS == X.options());
+            ASSERTV(LINE, EXP     == X.regionSize());
+            ASSERTV(LINE, 0       == X.numBytesMapped());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate, write to, and release memory.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        char *a = static_cast<char *>(mX.allocate(10));
+        char *b = static_cast<char *>(mX.allocate(10 * 1024 * 1024));
+
+        ASSERT(a && b && a != b);
+
+        bsl::memset(a, 'a', 10);
+        bsl::memset(b, 'b', 10 * 1024 * 1024);
+
+        ASSERT(0 < X.numBytesMapped());
+
+        mX.release();
+
+        ASSERT(0 == X.numBytesMapped());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: RANDOM ACCESS
+        //
+        // Concerns:
+        //: 1 Random accesses to a large buffer backed by huge pages are faster
+        //:   than to one obtained from the new/delete allocator, and
+        //:   prefaulting removes the page faults from the first pass.
+        //
+        // Plan:
+        //: 1 Time two passes of random accesses to a buffer (of 256MB by
+        //:   default, or of the size in MB given as an optional argument)
+        //:   obtained from the new/delete allocator, a 'HugePageAllocator',
+        //:   and a 'HugePageAllocator' with the 'e_PREFAULT' option.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: RANDOM ACCESS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: RANDOM ACCESS" << endl
+                          << "===============================" << endl;
+
+        const size_type SIZE = (argc > 2 ? atoi(argv[2]) : 256)
+                                                             * 1024 * 1024;
+        const int NUM_ACCESSES = 20 * 1000 * 1000;
+
+        cout << "Buffer of " << SIZE / (1024 * 1024) << "MB, "
+             << NUM_ACCESSES << " accesses per pass:" << endl;
+        {
+            bslma::Allocator *nda = &bslma::NewDeleteAllocator::singleton();
+
+            char *buffer = static_cast<char *>(nda->allocate(SIZE));
+
+            const double first  = timeRandomAccess(buffer, SIZE, NUM_ACCESSES);
+            const double second = timeRandomAccess(buffer, SIZE, NUM_ACCESSES);
+
+            cout << "\tnew/delete:                     " << first << "s, "
+                 << second << "s" << endl;
+
+            nda->deallocate(buffer);
+        }
+        {
+            Obj mX;
+
+            char *buffer = static_cast<char *>(mX.allocate(SIZE));
+
+            const double first  = timeRandomAccess(buffer, SIZE, NUM_ACCESSES);
+            const double second = timeRandomAccess(buffer, SIZE, NUM_ACCESSES);
+
+            cout << "\tHugePageAllocator:              " << first << "s, "
+                 << second << "s" << endl;
+        }
+        {
+            Obj mX(Obj::e_PREFAULT);
+
+            char *buffer = static_cast<char *>(mX.allocate(SIZE));
+
+            const double first  = timeRandomAccess(buffer, SIZE, NUM_ACCESSES);
+            const double second = timeRandomAccess(buffer, SIZE, NUM_ACCESSES);
+
+            cout << "\tHugePageAllocator (prefaulted): " << first << "s, "
+                 << second << "s" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
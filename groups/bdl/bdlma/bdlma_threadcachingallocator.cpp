@@ -0,0 +1,628 @@
+// bdlma_threadcachingallocator.cpp                                   -*-C++-*-
+#include <bdlma_threadcachingallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_threadcachingallocator_cpp,"$Id$ $CSID$")
+
+///Implementation Notes
+///--------------------
+// Each block handed out by the allocator is preceded by a 'Header' that
+// records its size class, which is the index of the pool of the multipool
+// that supplied it, or 'k_UNCACHED'.  A free block cached by a thread is
+// linked into the magazine for its size class through its first word (a
+// 'FreeBlock').  A batch is a null-terminated list of exactly
+// 'CentralList::d_batchSize' free blocks; batches held by a central list are
+// linked through the 'd_nextBatch_p' member of the header of their first
+// block, the size class of a free block being implied by the list that holds
+// it.
+//
+// Blocks are requested from the multipool with a size equal to the block size
+// of the pool that corresponds to their size class, so that the multipool
+// dispenses them from that pool, and so that a block returned by a thread
+// cache to the multipool is returned to that same pool.
+//
+// The caches of a thread (one per allocator it uses) form a list held in
+// thread-specific storage under a single key shared by all allocators, which
+// is never deleted.  The lists of caches of all allocators are guarded by a
+// single lock, which is acquired only when a cache is created or destroyed,
+// and by the destructor of an allocator.  Each cache is owned, and destroyed,
+// by its thread only (when it exits, when it next creates a cache, or when it
+// destroys an allocator).  The destructor of an allocator merely *orphans* the
+// caches of other threads, under the lock, by unlinking them and resetting
+// their allocator to 0; the blocks in their magazines are released with the
+// multipool.  Thus, a thread exiting while an allocator is destroyed finds its
+// cache either still attached to the allocator (which cannot be destroyed
+// until the exiting thread releases the lock) or already orphaned, and never
+// a dangling one.  Since orphaned caches outlive their allocator, caches are
+// allocated from the 'bslma::NewDeleteAllocator' singleton.
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_default.h>
+#include <bslma_newdeleteallocator.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_once.h>
+#include <bslmt_qlock.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_bslexceptionutil.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_cstdint.h>
+
+#include <new>  // placement 'new'
+
+namespace BloombergLP {
+namespace {
+
+enum {
+    k_DEFAULT_MAX_BLOCKS_PER_BATCH = 32,        // default maximum number of
+                                                // blocks in a batch
+
+    k_MAX_BYTES_PER_BATCH          = 64 * 1024, // maximum total size of the
+                                                // blocks in a batch
+
+    k_MIN_BLOCKS_PER_BATCH         = 4,         // minimum number of blocks in
+                                                // a batch (unless limited by
+                                                // 'maxBlocksPerBatch')
+
+    k_UNCACHED                     = -1         // size class of blocks that
+                                                // are not cached
+};
+
+struct FreeBlock {
+    // This 'struct' overlays the first word of a free block.
+
+    FreeBlock *d_next_p;  // next free block in the same magazine or batch
+};
+
+union Header {
+    // This 'union' precedes each block dispensed by the allocator.
+
+    int                                 d_sizeClass;    // size class of an
+                                                        // allocated block
+
+    FreeBlock                          *d_nextBatch_p;  // first block of the
+                                                        // next batch in a
+                                                        // central list
+
+    bsls::AlignmentUtil::MaxAlignedType d_dummy;        // force maximum
+                                                        // alignment
+};
+
+struct Magazine {
+    // This 'struct' holds the free blocks of one size class cached by one
+    // thread.
+
+    FreeBlock *d_head_p;     // first free block (or 0)
+    int        d_numBlocks;  // number of free blocks
+};
+
+inline
+Header *headerOf(void *block)
+    // Return the address of the header of the specified 'block'.
+{
+    return static_cast<Header *>(block) - 1;
+}
+
+inline
+int findSizeClass(bsls::Types::size_type size)
+    // Return the index of the pool of a 'bdlma::ConcurrentMultipool' that
+    // dispenses blocks of the specified 'size' (in bytes).  The behavior is
+    // undefined unless '0 < size'.
+{
+    return 31 - bdlb::BitUtil::numLeadingUnsetBits(
+                   static_cast<bsl::uint32_t>(((size + 7) >> 3) * 2 - 1));
+}
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                 // =========================================
+                 // struct ThreadCachingAllocator::CentralList
+                 // =========================================
+
+struct ThreadCachingAllocator::CentralList {
+    // This 'struct' holds the batches of free blocks of one size class that
+    // are not cached by any thread.
+
+    bslmt::Mutex  d_mutex;      // guard for 'd_batches_p'
+    FreeBlock    *d_batches_p;  // first block of the first batch (or 0)
+    int           d_batchSize;  // number of blocks in each batch
+};
+
+                 // =========================================
+                 // struct ThreadCachingAllocator::ThreadCache
+                 // =========================================
+
+struct ThreadCachingAllocator::ThreadCache {
+    // This 'struct' holds the magazines of free blocks cached by one thread
+    // for one allocator.  The array of magazines immediately follows this
+    // 'struct' in memory.
+
+    // DATA
+    bsls::AtomicPointer<ThreadCachingAllocator>
+                 d_allocator_p;      // owner of this cache, or 0 if this
+                                     // cache is orphaned
+
+    ThreadCache *d_next_p;           // next cache of the owner
+
+    ThreadCache *d_prev_p;           // previous cache of the owner
+
+    ThreadCache *d_nextInThread_p;   // next cache of the owning thread
+
+    Magazine    *d_magazines_p;      // array of magazines
+
+    // CLASS DATA
+    static bslmt::QLock           s_lock;    // guard for the lists of caches
+                                             // of all allocators, and for the
+                                             // owner of each cache
+
+    static bslmt::ThreadUtil::Key s_key;     // key of the list of caches of
+                                             // each thread (never deleted)
+
+    static bool                   s_hasKey;  // 'true' if 's_key' was created
+
+    // CLASS METHODS
+    static bool initialize();
+        // Create, if not already done, the thread-specific storage key of the
+        // lists of caches.  Return 'true' if the key is available, and
+        // 'false' otherwise.
+
+    static ThreadCache *head();
+        // Return the first cache of the calling thread, or 0 if the calling
+        // thread has no cache.
+
+    static void removeOrphans();
+        // Destroy the orphaned caches of the calling thread.  The behavior is
+        // undefined unless the calling thread holds 's_lock'.
+
+    // MANIPULATORS
+    void orphan();
+        // Unlink this cache from the list of caches of its owner, and reset
+        // its owner to 0.  The behavior is undefined unless this cache is
+        // not orphaned, and the calling thread holds 's_lock'.  Note that the
+        // blocks held by this cache are *not* returned to the multipool of
+        // the owner.
+};
+
+// CLASS DATA
+bslmt::QLock ThreadCachingAllocator::ThreadCache::s_lock =
+                                                       BSLMT_QLOCK_INITIALIZER;
+
+bslmt::ThreadUtil::Key ThreadCachingAllocator::ThreadCache::s_key;
+
+bool ThreadCachingAllocator::ThreadCache::s_hasKey = false;
+
+// CLASS METHODS
+bool ThreadCachingAllocator::ThreadCache::initialize()
+{
+    BSLMT_ONCE_DO {
+        s_hasKey = 0 == bslmt::ThreadUtil::createKey(
+                              &s_key,
+                              (bslmt::ThreadUtil::Destructor)
+                                 &ThreadCachingAllocator::destroyThreadCaches);
+    }
+    return s_hasKey;
+}
+
+inline
+ThreadCachingAllocator::ThreadCache *
+ThreadCachingAllocator::ThreadCache::head()
+{
+    return static_cast<ThreadCache *>(bslmt::ThreadUtil::getSpecific(s_key));
+}
+
+void ThreadCachingAllocator::ThreadCache::removeOrphans()
+{
+    bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+    ThreadCache *first = head();
+
+    // Remove the orphans following the first cache first, so that the first
+    // cache is replaced, below, only if the list has no other orphan.
+
+    ThreadCache *cache = first;
+    while (cache && cache->d_nextInThread_p) {
+        ThreadCache *next = cache->d_nextInThread_p;
+        if (next->d_allocator_p.loadRelaxed()) {
+            cache = next;
+        }
+        else {
+            cache->d_nextInThread_p = next->d_nextInThread_p;
+            allocator->deallocate(next);
+        }
+    }
+
+    if (first
+     && !first->d_allocator_p.loadRelaxed()
+     && 0 == bslmt::ThreadUtil::setSpecific(s_key, first->d_nextInThread_p)) {
+        allocator->deallocate(first);
+    }
+}
+
+// MANIPULATORS
+void ThreadCachingAllocator::ThreadCache::orphan()
+{
+    ThreadCachingAllocator *owner = d_allocator_p.loadRelaxed();
+
+    BSLS_ASSERT(owner);
+
+    if (d_prev_p) {
+        d_prev_p->d_next_p = d_next_p;
+    }
+    else {
+        owner->d_caches_p = d_next_p;
+    }
+    if (d_next_p) {
+        d_next_p->d_prev_p = d_prev_p;
+    }
+    d_next_p = 0;
+    d_prev_p = 0;
+
+    d_allocator_p.storeRelaxed(0);
+}
+
+                       // ----------------------------
+                       // class ThreadCachingAllocator
+                       // ----------------------------
+
+// PRIVATE CLASS METHODS
+void ThreadCachingAllocator::destroyThreadCaches(void *head)
+{
+    BSLS_ASSERT(head);
+
+    bslmt::QLockGuard guard(&ThreadCache::s_lock);
+
+    ThreadCache *cache = static_cast<ThreadCache *>(head);
+    while (cache) {
+        ThreadCache            *next      = cache->d_nextInThread_p;
+        ThreadCachingAllocator *allocator = cache->d_allocator_p.loadRelaxed();
+
+        if (allocator) {
+            // 'allocator' cannot be destroyed while 's_lock' is held.
+
+            const int numPools = allocator->numPools();
+            for (int i = 0; i < numPools; ++i) {
+                FreeBlock *block = cache->d_magazines_p[i].d_head_p;
+                while (block) {
+                    FreeBlock *nextBlock = block->d_next_p;
+                    allocator->d_multipool.deallocate(headerOf(block));
+                    block = nextBlock;
+                }
+            }
+            cache->orphan();
+        }
+
+        bslma::NewDeleteAllocator::singleton().deallocate(cache);
+        cache = next;
+    }
+}
+
+// PRIVATE MANIPULATORS
+void ThreadCachingAllocator::initialize()
+{
+    BSLS_ASSERT(1 <= d_maxBlocksPerBatch);
+
+    const int numPools = d_multipool.numPools();
+
+    d_centralLists_p = static_cast<CentralList *>(
+                     d_allocator_p->allocate(numPools * sizeof(CentralList)));
+
+    for (int i = 0; i < numPools; ++i) {
+        CentralList *central = new (d_centralLists_p + i) CentralList;
+
+        const int maxBlocks = static_cast<int>(
+                 k_MAX_BYTES_PER_BATCH / (d_multipool.maxPooledBlockSize()
+                                                   >> (numPools - 1 - i)));
+
+        central->d_batches_p = 0;
+        central->d_batchSize = maxBlocks < k_MIN_BLOCKS_PER_BATCH
+                               ? k_MIN_BLOCKS_PER_BATCH
+                               : maxBlocks;
+        if (central->d_batchSize > d_maxBlocksPerBatch) {
+            central->d_batchSize = d_maxBlocksPerBatch;
+        }
+    }
+
+    const bool hasKey = ThreadCache::initialize();
+    BSLS_ASSERT_OPT(hasKey);
+    (void)hasKey;
+}
+
+ThreadCachingAllocator::ThreadCache *
+ThreadCachingAllocator::createThreadCache()
+{
+    const int numPools = d_multipool.numPools();
+
+    bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+    ThreadCache *cache = static_cast<ThreadCache *>(
+                     allocator->allocate(sizeof(ThreadCache)
+                                         + numPools * sizeof(Magazine)));
+
+    new (&cache->d_allocator_p) bsls::AtomicPointer<ThreadCachingAllocator>(
+                                                                         this);
+    cache->d_next_p       = 0;
+    cache->d_prev_p       = 0;
+    cache->d_magazines_p  = reinterpret_cast<Magazine *>(cache + 1);
+
+    for (int i = 0; i < numPools; ++i) {
+        cache->d_magazines_p[i].d_head_p    = 0;
+        cache->d_magazines_p[i].d_numBlocks = 0;
+    }
+
+    bslmt::QLockGuard guard(&ThreadCache::s_lock);
+
+    ThreadCache::removeOrphans();
+
+    cache->d_nextInThread_p = ThreadCache::head();
+    if (0 != bslmt::ThreadUtil::setSpecific(ThreadCache::s_key, cache)) {
+        allocator->deallocate(cache);
+        bsls::BslExceptionUtil::throwBadAlloc();
+    }
+
+    cache->d_next_p = d_caches_p;
+    if (d_caches_p) {
+        d_caches_p->d_prev_p = cache;
+    }
+    d_caches_p = cache;
+
+    return cache;
+}
+
+ThreadCachingAllocator::ThreadCache *
+ThreadCachingAllocator::lookupThreadCache()
+{
+    ThreadCache *cache = ThreadCache::head();
+    while (cache && this != cache->d_allocator_p.loadRelaxed()) {
+        cache = cache->d_nextInThread_p;
+    }
+    return cache;
+}
+
+void ThreadCachingAllocator::refill(ThreadCache *threadCache, int sizeClass)
+{
+    BSLS_ASSERT(threadCache);
+
+    Magazine&    magazine = threadCache->d_magazines_p[sizeClass];
+    CentralList& central  = d_centralLists_p[sizeClass];
+
+    BSLS_ASSERT(0 == magazine.d_head_p);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&central.d_mutex);
+
+        FreeBlock *batch = central.d_batches_p;
+        if (batch) {
+            central.d_batches_p = headerOf(batch)->d_nextBatch_p;
+
+            magazine.d_head_p    = batch;
+            magazine.d_numBlocks = central.d_batchSize;
+            return;                                                   // RETURN
+        }
+    }
+
+    // There is no free batch; allocate a new one from the multipool.  Note
+    // that, should an allocation fail, the blocks already allocated remain in
+    // the magazine.
+
+    const bsls::Types::size_type blockSize =
+             d_multipool.maxPooledBlockSize() >> (numPools() - 1 - sizeClass);
+
+    for (int i = 0; i < central.d_batchSize; ++i) {
+        FreeBlock *block = reinterpret_cast<FreeBlock *>(
+                         static_cast<Header *>(d_multipool.allocate(blockSize))
+                                                                         + 1);
+
+        block->d_next_p   = magazine.d_head_p;
+        magazine.d_head_p = block;
+        ++magazine.d_numBlocks;
+    }
+}
+
+void ThreadCachingAllocator::spill(ThreadCache *threadCache, int sizeClass)
+{
+    BSLS_ASSERT(threadCache);
+
+    Magazine&    magazine = threadCache->d_magazines_p[sizeClass];
+    CentralList& central  = d_centralLists_p[sizeClass];
+
+    BSLS_ASSERT(central.d_batchSize <= magazine.d_numBlocks);
+
+    FreeBlock *first = magazine.d_head_p;
+    FreeBlock *last  = first;
+    for (int i = 1; i < central.d_batchSize; ++i) {
+        last = last->d_next_p;
+    }
+
+    magazine.d_head_p     = last->d_next_p;
+    magazine.d_numBlocks -= central.d_batchSize;
+    last->d_next_p        = 0;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&central.d_mutex);
+
+    headerOf(first)->d_nextBatch_p = central.d_batches_p;
+    central.d_batches_p            = first;
+}
+
+// CREATORS
+ThreadCachingAllocator::ThreadCachingAllocator(
+                                              bslma::Allocator *basicAllocator)
+: d_multipool(basicAllocator)
+, d_maxBlocksPerBatch(k_DEFAULT_MAX_BLOCKS_PER_BATCH)
+, d_maxCachedBlockSize(d_multipool.maxPooledBlockSize() > sizeof(Header)
+                       ? d_multipool.maxPooledBlockSize() - sizeof(Header)
+                       : 0)
+, d_centralLists_p(0)
+, d_caches_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize();
+}
+
+ThreadCachingAllocator::ThreadCachingAllocator(
+                                              int               numPools,
+                                              bslma::Allocator *basicAllocator)
+: d_multipool(numPools, basicAllocator)
+, d_maxBlocksPerBatch(k_DEFAULT_MAX_BLOCKS_PER_BATCH)
+, d_maxCachedBlockSize(d_multipool.maxPooledBlockSize() > sizeof(Header)
+                       ? d_multipool.maxPooledBlockSize() - sizeof(Header)
+                       : 0)
+, d_centralLists_p(0)
+, d_caches_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize();
+}
+
+ThreadCachingAllocator::ThreadCachingAllocator(
+                                           int               numPools,
+                                           int               maxBlocksPerBatch,
+                                           bslma::Allocator *basicAllocator)
+: d_multipool(numPools, basicAllocator)
+, d_maxBlocksPerBatch(maxBlocksPerBatch)
+, d_maxCachedBlockSize(d_multipool.maxPooledBlockSize() > sizeof(Header)
+                       ? d_multipool.maxPooledBlockSize() - sizeof(Header)
+                       : 0)
+, d_centralLists_p(0)
+, d_caches_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize();
+}
+
+ThreadCachingAllocator::~ThreadCachingAllocator()
+{
+    // The caches of other threads are orphaned, rather than destroyed, as
+    // their threads may be exiting concurrently (see the implementation
+    // notes).  The blocks held by all caches, and by the central lists, are
+    // released by the multipool.
+
+    {
+        bslmt::QLockGuard guard(&ThreadCache::s_lock);
+
+        while (d_caches_p) {
+            d_caches_p->orphan();
+        }
+
+        // The calling thread may never exit (e.g., the main thread), so
+        // destroy its orphaned caches now.
+
+        ThreadCache::removeOrphans();
+    }
+
+    const int numPools = d_multipool.numPools();
+    for (int i = 0; i < numPools; ++i) {
+        d_centralLists_p[i].~CentralList();
+    }
+    d_allocator_p->deallocate(d_centralLists_p);
+}
+
+// MANIPULATORS
+void *ThreadCachingAllocator::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        return 0;                                                     // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(size > d_maxCachedBlockSize)) {
+        Header *header = static_cast<Header *>(
+                                  d_multipool.allocate(size + sizeof(Header)));
+
+        header->d_sizeClass = k_UNCACHED;
+
+        return header + 1;                                            // RETURN
+    }
+
+    const int sizeClass = findSizeClass(size + sizeof(Header));
+
+    ThreadCache *cache = lookupThreadCache();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == cache)) {
+        cache = createThreadCache();
+    }
+
+    Magazine& magazine = cache->d_magazines_p[sizeClass];
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == magazine.d_head_p)) {
+        refill(cache, sizeClass);
+    }
+
+    FreeBlock *block = magazine.d_head_p;
+
+    magazine.d_head_p = block->d_next_p;
+    --magazine.d_numBlocks;
+
+    headerOf(block)->d_sizeClass = sizeClass;
+
+    return block;
+}
+
+void ThreadCachingAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        return;                                                       // RETURN
+    }
+
+    Header *header = headerOf(address);
+
+    const int sizeClass = header->d_sizeClass;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(k_UNCACHED == sizeClass)) {
+        d_multipool.deallocate(header);
+        return;                                                       // RETURN
+    }
+
+    ThreadCache *cache = lookupThreadCache();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == cache)) {
+        // A deallocation must not fail, so if a cache cannot be created for
+        // the calling thread, the block is returned to the multipool.
+
+        BSLS_TRY {
+            cache = createThreadCache();
+        }
+        BSLS_CATCH(...) {
+            d_multipool.deallocate(header);
+            return;                                                   // RETURN
+        }
+    }
+
+    Magazine&  magazine = cache->d_magazines_p[sizeClass];
+    FreeBlock *block    = static_cast<FreeBlock *>(address);
+
+    block->d_next_p   = magazine.d_head_p;
+    magazine.d_head_p = block;
+    ++magazine.d_numBlocks;
+
+    const int batchSize = d_centralLists_p[sizeClass].d_batchSize;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                    magazine.d_numBlocks > 2 * batchSize)) {
+        spill(cache, sizeClass);
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
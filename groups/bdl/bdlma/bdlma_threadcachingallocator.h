@@ -0,0 +1,357 @@
+// bdlma_threadcachingallocator.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLMA_THREADCACHINGALLOCATOR
+#define INCLUDED_BDLMA_THREADCACHINGALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a multipool allocator with per-thread block caches.
+//
+//@CLASSES:
+//  bdlma::ThreadCachingAllocator: multipool allocator with thread caches
+//
+//@SEE_ALSO: bdlma_concurrentmultipool, bdlma_concurrentmultipoolallocator
+//
+//@DESCRIPTION: This component provides a thread-safe allocator,
+// 'bdlma::ThreadCachingAllocator', that implements the 'bslma::Allocator'
+// protocol and supplies memory from a 'bdlma::ConcurrentMultipool', but that
+// keeps a small cache ("magazine") of free memory blocks of each pooled size
+// for each thread that uses it, in the spirit of the per-thread caches of
+// 'tcmalloc'.
+//..
+//   ,----------------------------.
+//  ( bdlma::ThreadCachingAllocator )
+//   `----------------------------'
+//                 |         ctor/dtor
+//                 |         maxBlocksPerBatch
+//                 |         maxCachedBlockSize
+//                 |         numPools
+//                 V
+//       ,-----------------.
+//      (  bslma::Allocator )
+//       `-----------------'
+//                        allocate
+//                        deallocate
+//..
+// A 'bdlma::ConcurrentMultipool' (and hence a
+// 'bdlma::ConcurrentMultipoolAllocator') satisfies every allocation and
+// deallocation of a pooled block with an atomic operation on the free list of
+// the pool shared by all threads, and serializes the replenishment of each
+// pool with a mutex.  When many threads allocate and deallocate concurrently,
+// the cache line holding the head of each free list is contended by all of
+// them.  A 'bdlma::ThreadCachingAllocator' satisfies most allocation and
+// deallocation requests from the magazine of the calling thread without any
+// synchronization:
+//
+//: o An allocation request takes a block from the magazine of the calling
+//:   thread for the appropriate block size.  If that magazine is empty, it is
+//:   refilled with a *batch* of blocks, taken in a single operation from a
+//:   central list of batches shared by all threads, or, if there is none,
+//:   allocated from the multipool.
+//:
+//: o A deallocation request returns the block to the magazine of the calling
+//:   thread (which need not be the thread that allocated it).  If that
+//:   magazine holds more than two batches of blocks, one batch is moved, in a
+//:   single operation, to the central list, from which any thread may take it.
+//
+// Thus, blocks allocated by one thread and deallocated by another (as in a
+// producer/consumer workload) travel between the threads in batches.  The
+// number of blocks in a batch is 'maxBlocksPerBatch' (optionally supplied at
+// construction) for small blocks, and smaller for larger blocks, so that a
+// batch holds at most 64 kilobytes.  When a thread exits, the blocks cached
+// for that thread are returned to the multipool.
+//
+// Requests for blocks larger than 'maxCachedBlockSize' are passed directly to
+// the multipool.  Each block dispensed by a 'bdlma::ThreadCachingAllocator'
+// is preceded by a header of 'bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT' bytes
+// (in addition to that of the multipool) that records its size class.  Memory
+// cached by a thread, or held in a central list, is not available to other
+// size classes, and, as with the multipool, memory is returned to the
+// underlying allocator only when the 'bdlma::ThreadCachingAllocator' is
+// destroyed.
+//
+///Thread Safety
+///-------------
+// 'bdlma::ThreadCachingAllocator' is fully thread-safe, meaning any operation
+// on the same object can be safely invoked from any thread.  All
+// 'bdlma::ThreadCachingAllocator' objects share a single thread-specific
+// storage key (see 'bslmt_threadutil'), under which each thread keeps the
+// list of its caches, and each cache is destroyed only by its thread, when
+// that thread exits.  An allocator may therefore be destroyed while threads
+// that have used it are still running, or are exiting: the destructor
+// releases the blocks cached for those threads, and their (small) caches are
+// reclaimed when they exit.  The behavior is undefined if a
+// 'bdlma::ThreadCachingAllocator' is destroyed while another thread is
+// allocating from, or deallocating to, it.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Passing Messages Between Threads
+///- - - - - - - - - - - - - - - - - - - - - -
+// In a producer/consumer system, messages are allocated by producer threads,
+// and deallocated by consumer threads once they have been processed.  A
+// 'bdlma::ThreadCachingAllocator' moves the memory of such messages back to
+// the producers in batches.
+//
+// First, we define a simple message class that allocates its payload:
+//..
+//  class my_Message {
+//      // This class holds a copy of a string supplied at construction.
+//
+//      // DATA
+//      char             *d_data_p;       // copy of the payload (owned)
+//      bslma::Allocator *d_allocator_p;  // memory allocator (held)
+//
+//    private:
+//      // NOT IMPLEMENTED
+//      my_Message(const my_Message&);
+//      my_Message& operator=(const my_Message&);
+//
+//    public:
+//      // CREATORS
+//      my_Message(const char *payload, bslma::Allocator *basicAllocator)
+//      : d_allocator_p(basicAllocator)
+//      {
+//          const bsl::size_t length = bsl::strlen(payload);
+//
+//          d_data_p = static_cast<char *>(
+//                                     d_allocator_p->allocate(length + 1));
+//          bsl::memcpy(d_data_p, payload, length + 1);
+//      }
+//
+//      ~my_Message()
+//      {
+//          d_allocator_p->deallocate(d_data_p);
+//      }
+//
+//      // ACCESSORS
+//      const char *payload() const
+//      {
+//          return d_data_p;
+//      }
+//  };
+//..
+// Then, we create a thread-caching allocator, which would typically be shared
+// by the producer and consumer threads:
+//..
+//  bdlma::ThreadCachingAllocator allocator;
+//..
+// Next, a producer thread creates a message using 'allocator':
+//..
+//  my_Message *message = new (allocator) my_Message("hello", &allocator);
+//..
+// Finally, after the message is passed to a consumer thread (not shown) and
+// processed, the consumer destroys the message, returning its memory to the
+// cache of the consumer thread:
+//..
+//  assert(0 == bsl::strcmp("hello", message->payload()));
+//
+//  allocator.deleteObject(message);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_CONCURRENTMULTIPOOL
+#include <bdlma_concurrentmultipool.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                       // ============================
+                       // class ThreadCachingAllocator
+                       // ============================
+
+class ThreadCachingAllocator : public bslma::Allocator {
+    // This class implements the 'bslma::Allocator' protocol to provide a
+    // thread-safe allocator that supplies memory blocks from a
+    // 'ConcurrentMultipool', caching free blocks of each pooled size for each
+    // thread that uses it, and exchanging batches of free blocks between
+    // threads through a central list for each pooled size.
+
+    // PRIVATE TYPES
+    struct CentralList;  // batches of free blocks of one size (defined in the
+                         // '.cpp' file)
+
+    struct ThreadCache;  // magazines of free blocks for one thread (defined
+                         // in the '.cpp' file)
+
+    // DATA
+    ConcurrentMultipool    d_multipool;      // supplies all memory blocks
+
+    int                    d_maxBlocksPerBatch;
+                                             // maximum number of blocks in a
+                                             // batch
+
+    bsls::Types::size_type d_maxCachedBlockSize;
+                                             // largest requested size that is
+                                             // cached
+
+    CentralList           *d_centralLists_p; // array of 'numPools()' central
+                                             // lists (owned)
+
+    ThreadCache           *d_caches_p;       // list of all thread caches
+                                             // (held, owned by their threads)
+
+    bslma::Allocator      *d_allocator_p;    // allocator of the central lists
+                                             // (held)
+
+  private:
+    // NOT IMPLEMENTED
+    ThreadCachingAllocator(const ThreadCachingAllocator&);
+    ThreadCachingAllocator& operator=(const ThreadCachingAllocator&);
+
+    // PRIVATE CLASS METHODS
+    static void destroyThreadCaches(void *head);
+        // Return the blocks held by each cache in the list having the
+        // specified 'head' to the multipool of the allocator that owns it, if
+        // any, and destroy the caches.  This function is installed as the
+        // destructor of the thread-specific storage key shared by all
+        // 'ThreadCachingAllocator' objects, and is invoked when a thread
+        // having a cache exits.
+
+    // PRIVATE MANIPULATORS
+    void initialize();
+        // Create the central lists of this allocator, and, if not already
+        // done, the thread-specific storage key of the thread caches.
+
+    ThreadCache *createThreadCache();
+        // Create, register, and return the cache of the calling thread for
+        // this allocator.
+
+    ThreadCache *lookupThreadCache();
+        // Return the cache of the calling thread for this allocator, or 0 if
+        // the calling thread has no such cache.
+
+    void refill(ThreadCache *threadCache, int sizeClass);
+        // Load a batch of free blocks of the specified 'sizeClass' into the
+        // corresponding (empty) magazine of the specified 'threadCache'.
+
+    void spill(ThreadCache *threadCache, int sizeClass);
+        // Move a batch of free blocks of the specified 'sizeClass' from the
+        // corresponding magazine of the specified 'threadCache' to the central
+        // list for 'sizeClass'.
+
+  public:
+    // CREATORS
+    explicit ThreadCachingAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit ThreadCachingAllocator(int               numPools,
+                                    bslma::Allocator *basicAllocator = 0);
+    ThreadCachingAllocator(int               numPools,
+                           int               maxBlocksPerBatch,
+                           bslma::Allocator *basicAllocator = 0);
+        // Create a thread-caching allocator.  Optionally specify 'numPools',
+        // indicating the number of internal pools of the underlying
+        // 'ConcurrentMultipool', the block sizes of which range from 8 to
+        // '2^(numPools + 2)' bytes.  If 'numPools' is not specified, the
+        // default number of pools of 'ConcurrentMultipool' is used.
+        // Optionally specify 'maxBlocksPerBatch', indicating the maximum
+        // number of blocks moved at once between the cache of a thread and
+        // the central list of free blocks of each size.  If
+        // 'maxBlocksPerBatch' is not specified, an implementation-defined
+        // value is used.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '1 <= numPools' and '1 <= maxBlocksPerBatch'.  Note that the
+        // creation of a 'ThreadCachingAllocator' fails (by invoking
+        // 'BSLS_ASSERT_OPT') if no thread-specific storage key is available.
+
+    virtual ~ThreadCachingAllocator();
+        // Destroy this allocator.  All memory allocated from this allocator
+        // is released.  The behavior is undefined unless no other thread is
+        // using this allocator.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return the address of a contiguous block of maximally-aligned memory
+        // of (at least) the specified 'size' (in bytes).  If 'size' is 0, no
+        // memory is allocated and 0 is returned.  If 'size' does not exceed
+        // 'maxCachedBlockSize()', the block is taken from the cache of the
+        // calling thread.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to this
+        // allocator.  If 'address' is 0, this function has no effect.  If the
+        // block was taken from a thread cache, it is returned to the cache of
+        // the calling thread.  The behavior is undefined unless 'address' was
+        // allocated using this allocator object and has not already been
+        // deallocated.
+
+    // ACCESSORS
+    int maxBlocksPerBatch() const;
+        // Return the maximum number of blocks moved at once between the cache
+        // of a thread and the central list of free blocks of each size.
+
+    size_type maxCachedBlockSize() const;
+        // Return the largest size (in bytes) of an allocation request that is
+        // satisfied from the cache of the calling thread.  Note that this
+        // size is the maximum pooled block size of the underlying multipool
+        // less the size of the header of each block.
+
+    int numPools() const;
+        // Return the number of pools of the multipool underlying this
+        // allocator.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                       // ----------------------------
+                       // class ThreadCachingAllocator
+                       // ----------------------------
+
+// ACCESSORS
+inline
+int ThreadCachingAllocator::maxBlocksPerBatch() const
+{
+    return d_maxBlocksPerBatch;
+}
+
+inline
+ThreadCachingAllocator::size_type
+ThreadCachingAllocator::maxCachedBlockSize() const
+{
+    return d_maxCachedBlockSize;
+}
+
+inline
+int ThreadCachingAllocator::numPools() const
+{
+    return d_multipool.numPools();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1229 @@
+// bdlma_threadcachingallocator.t.cpp                                 -*-C++-*-
+#include <bdlma_threadcachingallocator.h>
+
+#include <bdlma_concurrentmultipoolallocator.h>  // for testing only
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::ThreadCachingAllocator' is a thread-safe allocator whose observable
+// behavior is that of any 'bslma::Allocator': the blocks it dispenses must be
+// maximally aligned, disjoint, and usable until deallocated, and all memory
+// must be returned to the underlying allocator on destruction.  The caching
+// is observable through the reuse of blocks deallocated by the same thread,
+// and must not lose blocks (or cache structures) when threads exit, or when
+// blocks migrate between threads in batches.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ThreadCachingAllocator(bslma::Allocator *ba = 0);
+// [ 2] ThreadCachingAllocator(int numPools, bslma::Allocator *ba = 0);
+// [ 2] ThreadCachingAllocator(int, int, bslma::Allocator *ba = 0);
+// [ 2] ~ThreadCachingAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+//
+// ACCESSORS
+// [ 2] int maxBlocksPerBatch() const;
+// [ 2] size_type maxCachedBlockSize() const;
+// [ 2] int numPools() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: Blocks cached by exiting threads are reclaimed.
+// [ 5] CONCERN: Blocks can be exchanged between threads.
+// [ 6] CONCERN: 'allocate' is exception neutral.
+// [ 7] CONCERN: The allocator can be destroyed while threads exit.
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: PRODUCER/CONSUMER
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::ThreadCachingAllocator Obj;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+
+enum { k_MAX_ALIGNMENT = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT };
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bslma::Allocator *ndAllocator()
+    // Return the address of the new/delete allocator, used for the containers
+    // of the test driver itself.
+{
+    return &bslma::NewDeleteAllocator::singleton();
+}
+
+bool isMaximallyAligned(const void *address)
+    // Return 'true' if the specified 'address' is maximally aligned, and
+    // 'false' otherwise.
+{
+    return 0 == reinterpret_cast<bsls::Types::UintPtr>(address)
+                                                        % k_MAX_ALIGNMENT;
+}
+
+                            // =================
+                            // class BatchQueue
+                            // =================
+
+class BatchQueue {
+    // This class implements a simple thread-safe queue of memory block
+    // addresses, used to pass blocks from producer threads to consumer
+    // threads.  The number of blocks in the queue is bounded, so that
+    // producers are throttled by the consumers.
+
+    // DATA
+    bsl::vector<void *> d_blocks;        // blocks in the queue
+    bsl::size_t         d_capacity;      // maximum number of blocks
+    int                 d_numProducers;  // number of producers not done
+    bslmt::Mutex        d_mutex;         // guard for the above
+    bslmt::Condition    d_notEmpty;      // signaled when blocks are pushed
+    bslmt::Condition    d_notFull;       // signaled when blocks are popped
+
+  public:
+    // CREATORS
+    BatchQueue(bsl::size_t capacity, int numProducers)
+        // Create a queue holding at most (approximately) the specified
+        // 'capacity' blocks, that is filled by the specified 'numProducers'.
+    : d_blocks(ndAllocator())
+    , d_capacity(capacity)
+    , d_numProducers(numProducers)
+    {
+    }
+
+    // MANIPULATORS
+    void push(void *const *blocks, bsl::size_t numBlocks)
+        // Append the specified 'numBlocks' 'blocks' to this queue, blocking
+        // while the queue is full.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        while (d_blocks.size() >= d_capacity) {
+            d_notFull.wait(&d_mutex);
+        }
+        d_blocks.insert(d_blocks.end(), blocks, blocks + numBlocks);
+        d_notEmpty.signal();
+    }
+
+    void producerDone()
+        // Indicate that one producer will push no more blocks.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        --d_numProducers;
+        d_notEmpty.broadcast();
+    }
+
+    bool popAll(bsl::vector<void *> *result)
+        // Load into the specified 'result' all blocks in this queue, blocking
+        // while the queue is empty.  Return 'false' if the queue is empty and
+        // all producers are done, and 'true' otherwise.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        while (d_blocks.empty() && d_numProducers) {
+            d_notEmpty.wait(&d_mutex);
+        }
+        if (d_blocks.empty()) {
+            return false;                                             // RETURN
+        }
+        result->swap(d_blocks);
+        d_blocks.clear();
+        d_notFull.broadcast();
+        return true;
+    }
+};
+
+                              // ==============
+                              // class Producer
+                              // ==============
+
+class Producer {
+    // This class provides a functor that allocates blocks of varying sizes
+    // from an allocator, fills them with a pattern, and pushes them onto a
+    // 'BatchQueue'.
+
+    // DATA
+    bslma::Allocator *d_allocator_p;
+    BatchQueue       *d_queue_p;
+    int               d_numBlocks;
+    int               d_maxSize;
+
+  public:
+    // CREATORS
+    Producer(bslma::Allocator *allocator,
+             BatchQueue       *queue,
+             int               numBlocks,
+             int               maxSize)
+        // Create a producer of the specified 'numBlocks' blocks, having sizes
+        // in the range '[1 .. maxSize]', allocated from the specified
+        // 'allocator' and pushed onto the specified 'queue'.
+    : d_allocator_p(allocator)
+    , d_queue_p(queue)
+    , d_numBlocks(numBlocks)
+    , d_maxSize(maxSize)
+    {
+    }
+
+    // MANIPULATORS
+    void operator()()
+        // Produce the blocks.
+    {
+        enum { k_BATCH = 64 };
+
+        void *batch[k_BATCH];
+        int   n = 0;
+
+        for (int i = 0; i < d_numBlocks; ++i) {
+            const int size = 1 + (i * 37) % d_maxSize;
+
+            char *block = static_cast<char *>(d_allocator_p->allocate(size));
+            block[0]        = static_cast<char>(size);
+            block[size - 1] = static_cast<char>(size);
+
+            batch[n++] = block;
+            if (k_BATCH == n) {
+                d_queue_p->push(batch, n);
+                n = 0;
+            }
+        }
+        d_queue_p->push(batch, n);
+        d_queue_p->producerDone();
+    }
+};
+
+                              // ==============
+                              // class Consumer
+                              // ==============
+
+class Consumer {
+    // This class provides a functor that pops blocks from a 'BatchQueue' and
+    // deallocates them, verifying that they were not corrupted.
+
+    // DATA
+    bslma::Allocator *d_allocator_p;
+    BatchQueue       *d_queue_p;
+    bool              d_verify;
+
+  public:
+    // CREATORS
+    Consumer(bslma::Allocator *allocator, BatchQueue *queue, bool verify)
+        // Create a consumer of blocks popped from the specified 'queue' and
+        // deallocated to the specified 'allocator', and verify the contents
+        // of each block if the specified 'verify' is 'true'.
+    : d_allocator_p(allocator)
+    , d_queue_p(queue)
+    , d_verify(verify)
+    {
+    }
+
+    // MANIPULATORS
+    void operator()()
+        // Consume the blocks.
+    {
+        bsl::vector<void *> blocks(ndAllocator());
+
+        while (d_queue_p->popAll(&blocks)) {
+            for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                if (d_verify) {
+                    const char *block = static_cast<char *>(blocks[i]);
+                    const char  size  = block[0];
+                    const int   n     = static_cast<unsigned char>(size);
+
+                    ASSERT(0 == n || block[n - 1] == size);
+                }
+                d_allocator_p->deallocate(blocks[i]);
+            }
+            blocks.clear();
+        }
+    }
+};
+
+                              // ===============
+                              // class AllocLoop
+                              // ===============
+
+class AllocLoop {
+    // This class provides a functor that repeatedly allocates and deallocates
+    // a set of blocks from an allocator.
+
+    // DATA
+    bslma::Allocator *d_allocator_p;
+    int               d_numIterations;
+
+  public:
+    // CREATORS
+    AllocLoop(bslma::Allocator *allocator, int numIterations)
+        // Create a functor that allocates from the specified 'allocator' for
+        // the specified 'numIterations'.
+    : d_allocator_p(allocator)
+    , d_numIterations(numIterations)
+    {
+    }
+
+    // MANIPULATORS
+    void operator()()
+        // Allocate and deallocate.
+    {
+        enum { k_NUM_BLOCKS = 100 };
+
+        void *blocks[k_NUM_BLOCKS];
+
+        for (int i = 0; i < d_numIterations; ++i) {
+            for (int j = 0; j < k_NUM_BLOCKS; ++j) {
+                blocks[j] = d_allocator_p->allocate(1 + (i + j * 13) % 300);
+                bsl::memset(blocks[j], 0xA5, 1);
+            }
+            for (int j = 0; j < k_NUM_BLOCKS; ++j) {
+                d_allocator_p->deallocate(blocks[j]);
+            }
+        }
+    }
+};
+
+                            // ==================
+                            // class AllocAndExit
+                            // ==================
+
+class AllocAndExit {
+    // This class provides a functor that allocates and deallocates a few
+    // blocks from an allocator, so that the calling thread has a cache for
+    // it, then waits on a barrier before returning (and its thread exiting).
+
+    // DATA
+    bslma::Allocator *d_allocator_p;  // allocator to use (held)
+    bslmt::Barrier   *d_barrier_p;    // barrier to wait on (held)
+
+  public:
+    // CREATORS
+    AllocAndExit(bslma::Allocator *allocator, bslmt::Barrier *barrier)
+        // Create a functor that allocates from the specified 'allocator',
+        // then waits on the specified 'barrier'.
+    : d_allocator_p(allocator)
+    , d_barrier_p(barrier)
+    {
+    }
+
+    // MANIPULATORS
+    void operator()()
+        // Allocate and deallocate, then wait on the barrier.
+    {
+        enum { k_NUM_BLOCKS = 10 };
+
+        void *blocks[k_NUM_BLOCKS];
+
+        for (int j = 0; j < k_NUM_BLOCKS; ++j) {
+            blocks[j] = d_allocator_p->allocate(1 + j * 13);
+        }
+        for (int j = 0; j < k_NUM_BLOCKS; ++j) {
+            d_allocator_p->deallocate(blocks[j]);
+        }
+
+        d_barrier_p->wait();
+    }
+};
+
+double runProducerConsumer(bslma::Allocator *allocator,
+                           int               numPairs,
+                           int               numBlocks,
+                           int               maxSize,
+                           bool              verify)
+    // Run the specified 'numPairs' producer threads and 'numPairs' consumer
+    // threads, each producer allocating the specified 'numBlocks' blocks of
+    // size at most the specified 'maxSize' from the specified 'allocator', and
+    // return the elapsed wall time in seconds.  If the specified 'verify' is
+    // 'true', consumers verify the contents of each block.
+{
+    BatchQueue queue(4096, numPairs);
+
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(ndAllocator());
+
+    bsls::Stopwatch timer;
+    timer.start(true);
+
+    for (int i = 0; i < numPairs; ++i) {
+        bslmt::ThreadUtil::Handle handle;
+
+        int rc = bslmt::ThreadUtil::create(
+                                       &handle,
+                                       Consumer(allocator, &queue, verify));
+        ASSERT(0 == rc);
+        handles.push_back(handle);
+
+        rc = bslmt::ThreadUtil::create(
+                              &handle,
+                              Producer(allocator, &queue, numBlocks, maxSize));
+        ASSERT(0 == rc);
+        handles.push_back(handle);
+    }
+
+    for (bsl::size_t i = 0; i < handles.size(); ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+
+    timer.stop();
+
+    return timer.elapsedTime();
+}
+
+double runAllocLoop(bslma::Allocator *allocator,
+                    int               numThreads,
+                    int               numIterations)
+    // Run the specified 'numThreads' threads, each allocating and deallocating
+    // blocks from the specified 'allocator' for the specified
+    // 'numIterations', and return the elapsed wall time in seconds.
+{
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(ndAllocator());
+
+    bsls::Stopwatch timer;
+    timer.start(true);
+
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::Handle handle;
+
+        int rc = bslmt::ThreadUtil::create(
+                                        &handle,
+                                        AllocLoop(allocator, numIterations));
+        ASSERT(0 == rc);
+        handles.push_back(handle);
+    }
+
+    for (bsl::size_t i = 0; i < handles.size(); ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+
+    timer.stop();
+
+    return timer.elapsedTime();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Passing Messages Between Threads
+///- - - - - - - - - - - - - - - - - - - - - -
+// In a producer/consumer system, messages are allocated by producer threads,
+// and deallocated by consumer threads once they have been processed.  A
+// 'bdlma::ThreadCachingAllocator' moves the memory of such messages back to
+// the producers in batches.
+//
+// First, we define a simple message class that allocates its payload:
+//..
+    class my_Message {
+        // This class holds a copy of a string supplied at construction.
+
+        // DATA
+        char             *d_data_p;       // copy of the payload (owned)
+        bslma::Allocator *d_allocator_p;  // memory allocator (held)
+
+      private:
+        // NOT IMPLEMENTED
+        my_Message(const my_Message&);
+        my_Message& operator=(const my_Message&);
+
+      public:
+        // CREATORS
+        my_Message(const char *payload, bslma::Allocator *basicAllocator)
+        : d_allocator_p(basicAllocator)
+        {
+            const bsl::size_t length = bsl::strlen(payload);
+
+            d_data_p = static_cast<char *>(
+                                       d_allocator_p->allocate(length + 1));
+            bsl::memcpy(d_data_p, payload, length + 1);
+        }
+
+        ~my_Message()
+        {
+            d_allocator_p->deallocate(d_data_p);
+        }
+
+        // ACCESSORS
+        const char *payload() const
+        {
+            return d_data_p;
+        }
+    };
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create a thread-caching allocator, which would typically be shared
+// by the producer and consumer threads:
+//..
+    bdlma::ThreadCachingAllocator allocator;
+//..
+// Next, a producer thread creates a message using 'allocator':
+//..
+    my_Message *message = new (allocator) my_Message("hello", &allocator);
+//..
+// Finally, after the message is passed to a consumer thread (not shown) and
+// processed, the consumer destroys the message, returning its memory to the
+// cache of the consumer thread:
+//..
+    ASSERT(0 == bsl::strcmp("hello", message->payload()));
+
+    allocator.deleteObject(message);
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // DESTRUCTION WHILE THREADS EXIT
+        //
+        // Concerns:
+        //: 1 An allocator can be destroyed while threads having a cache for it
+        //:   are exiting, and the caches of those threads are destroyed once.
+        //:
+        //: 2 All memory obtained from the underlying allocator is released on
+        //:   destruction, even if threads having a cache are still running.
+        //:
+        //: 3 A thread that outlives an allocator can use another allocator
+        //:   (possibly created at the same address).
+        //
+        // Plan:
+        //: 1 Repeatedly create an allocator, have several threads allocate
+        //:   from it and wait on a barrier, then destroy the allocator as
+        //:   soon as the threads pass the barrier (and exit), and verify that
+        //:   the test allocator has no memory in use.  (C-1..2)
+        //:
+        //: 2 Create and destroy allocators in turn at the same address, each
+        //:   time allocating from the main thread (which outlives each of
+        //:   them) and from another thread, and verify that the blocks are
+        //:   usable, and that the test allocator has no memory in use.
+        //:   (C-2..3)
+        //
+        // Testing:
+        //   CONCERN: The allocator can be destroyed while threads exit.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DESTRUCTION WHILE THREADS EXIT" << endl
+                          << "==============================" << endl;
+
+        enum { k_NUM_THREADS = 4, k_NUM_ITERATIONS = 200 };
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        if (verbose) cout << "\tDestroying while threads exit." << endl;
+
+        for (int iteration = 0; iteration < k_NUM_ITERATIONS; ++iteration) {
+            bslmt::Barrier barrier(k_NUM_THREADS + 1);
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+            Obj *mX = new (ta) Obj(&ta);
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                int rc = bslmt::ThreadUtil::create(&handles[i],
+                                                   AllocAndExit(mX, &barrier));
+                ASSERTV(iteration, i, 0 == rc);
+            }
+
+            barrier.wait();
+            ta.deleteObject(mX);
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+            }
+
+            ASSERTV(iteration, ta.numBytesInUse(), 0 == ta.numBytesInUse());
+        }
+
+        if (verbose) cout << "\tReusing the same address." << endl;
+        {
+            bsls::ObjectBuffer<Obj> buffer;
+
+            for (int iteration = 0; iteration < 10; ++iteration) {
+                Obj *mX = new (buffer.buffer()) Obj(&ta);
+
+                void *block = mX->allocate(24);
+                bsl::memset(block, 0xA5, 24);
+
+                runAllocLoop(mX, 1, 2);
+
+                mX->deallocate(block);
+                mX->~Obj();
+
+                ASSERTV(iteration, ta.numBytesInUse(),
+                        0 == ta.numBytesInUse());
+            }
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // EXCEPTION NEUTRALITY
+        //
+        // Concerns:
+        //: 1 If the underlying allocator throws, 'allocate' propagates the
+        //:   exception and no memory is leaked.
+        //:
+        //: 2 A thread cache that could not be created (or a magazine that
+        //:   could not be refilled) is created (refilled) by a subsequent
+        //:   allocation.
+        //
+        // Plan:
+        //: 1 Using the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros, allocate
+        //:   and deallocate blocks of every cached size, and verify that the
+        //:   test allocator has no memory in use after the allocator is
+        //:   destroyed.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: 'allocate' is exception neutral.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EXCEPTION NEUTRALITY" << endl
+                          << "====================" << endl;
+
+#ifdef BDE_BUILD_TARGET_EXC
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+            Obj mX(6, 8, &ta);
+
+            bsl::vector<void *> blocks(ndAllocator());
+            blocks.reserve(1024);
+
+            for (Obj::size_type size = 1;
+                 size <= mX.maxCachedBlockSize() + 64;
+                 size += 7) {
+                for (int i = 0; i < 20; ++i) {
+                    void *block = mX.allocate(size);
+                    bsl::memset(block, 0xCC, size);
+                    blocks.push_back(block);
+                }
+            }
+
+            for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                mX.deallocate(blocks[i]);
+            }
+        } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+        ASSERT(0 == ta.numBytesInUse());
+#else
+        if (verbose) cout << "\tExceptions are disabled; skipping." << endl;
+#endif
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // EXCHANGING BLOCKS BETWEEN THREADS
+        //
+        // Concerns:
+        //: 1 Blocks allocated by one thread can be deallocated by another, and
+        //:   are then reused (in batches) by the allocating thread.
+        //:
+        //: 2 Blocks are not corrupted or dispensed twice.
+        //:
+        //: 3 The memory obtained from the underlying allocator does not grow
+        //:   without bound when blocks migrate between threads.
+        //:
+        //: 4 All memory is released on destruction.
+        //
+        // Plan:
+        //: 1 Run pairs of producer and consumer threads passing blocks of
+        //:   varying sizes through a bounded queue, where the consumer
+        //:   verifies the contents of each block before deallocating it.
+        //:   (C-1..2)
+        //:
+        //: 2 Run the producers and consumers a second time, and verify that
+        //:   the memory obtained from the underlying allocator is not
+        //:   substantially greater than after the first run.  (C-3)
+        //:
+        //: 3 Verify that the test allocator has no memory in use after the
+        //:   allocator is destroyed.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: Blocks can be exchanged between threads.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EXCHANGING BLOCKS BETWEEN THREADS" << endl
+                          << "=================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(&ta);
+
+            runProducerConsumer(&mX, 2, 50000, 200, true);
+
+            const bsls::Types::Int64 numBytesAfterFirstRun =
+                                                            ta.numBytesInUse();
+
+            runProducerConsumer(&mX, 2, 50000, 200, true);
+
+            if (veryVerbose) {
+                P_(numBytesAfterFirstRun) P(ta.numBytesInUse())
+            }
+
+            ASSERTV(numBytesAfterFirstRun, ta.numBytesInUse(),
+                    ta.numBytesInUse() <= 2 * numBytesAfterFirstRun);
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // THREAD EXIT
+        //
+        // Concerns:
+        //: 1 The cache of a thread is destroyed when the thread exits, and its
+        //:   blocks are returned to the multipool (so that the memory is
+        //:   reused by other threads).
+        //:
+        //: 2 The caches of threads that are still running when the allocator
+        //:   is destroyed are released.
+        //
+        // Plan:
+        //: 1 Repeatedly create a thread that allocates and deallocates blocks
+        //:   and exits, and verify that the memory obtained from the
+        //:   underlying allocator does not grow after the first iteration.
+        //:   (C-1)
+        //:
+        //: 2 Allocate from the main thread, destroy the allocator, and verify
+        //:   that the test allocator has no memory in use.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: Blocks cached by exiting threads are reclaimed.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "THREAD EXIT" << endl
+                          << "===========" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(&ta);
+
+            void *block = mX.allocate(10);
+
+            runAllocLoop(&mX, 1, 10);
+
+            const bsls::Types::Int64 numBytesAfterFirstRun =
+                                                            ta.numBytesInUse();
+
+            for (int i = 0; i < 10; ++i) {
+                runAllocLoop(&mX, 1, 10);
+
+                ASSERTV(i, numBytesAfterFirstRun, ta.numBytesInUse(),
+                        numBytesAfterFirstRun == ta.numBytesInUse());
+            }
+
+            mX.deallocate(block);
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 'allocate(0)' returns 0, and 'deallocate(0)' has no effect.
+        //:
+        //: 2 Blocks of every size, cached or not, are maximally aligned,
+        //:   disjoint, and writable.
+        //:
+        //: 3 A block deallocated by a thread is reused by the next allocation
+        //:   of the same size class by that thread.
+        //:
+        //: 4 A thread can allocate and deallocate many more blocks than fit in
+        //:   its cache.
+        //:
+        //: 5 No memory is obtained from the default allocator.
+        //
+        // Plan:
+        //: 1 Call 'allocate(0)' and 'deallocate(0)'.  (C-1)
+        //:
+        //: 2 Allocate blocks of each size up to beyond 'maxCachedBlockSize',
+        //:   verify their alignment, fill them, and verify (using a set of
+        //:   address ranges) that they are disjoint.  (C-2)
+        //:
+        //: 3 Deallocate a block and allocate a block of the same size, and
+        //:   verify that the addresses are the same.  (C-3)
+        //:
+        //: 4 Allocate and then deallocate 10000 blocks.  (C-4)
+        //:
+        //: 5 Verify that the default allocator was not used.  (C-5)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'allocate' AND 'deallocate'" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(5, 4, &ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+
+            if (verbose) cout << "\tAlignment and disjointness." << endl;
+
+            bsl::vector<char *> blocks(ndAllocator());
+            bsl::set<bsl::pair<char *, char *> > ranges(ndAllocator());
+
+            const int MAX_SIZE = static_cast<int>(X.maxCachedBlockSize()) + 40;
+
+            for (int size = 1; size <= MAX_SIZE; ++size) {
+                for (int i = 0; i < 3; ++i) {
+                    char *block = static_cast<char *>(mX.allocate(size));
+
+                    LOOP2_ASSERT(size, i, isMaximallyAligned(block));
+
+                    bsl::memset(block, size & 0xFF, size);
+                    blocks.push_back(block);
+
+                    // Verify that the range does not overlap that of the
+                    // preceding and following blocks.
+
+                    bsl::pair<char *, char *> range(block, block + size);
+                    bsl::set<bsl::pair<char *, char *> >::iterator it =
+                                                     ranges.lower_bound(range);
+                    if (it != ranges.end()) {
+                        LOOP2_ASSERT(size, i, range.second <= it->first);
+                    }
+                    if (it != ranges.begin()) {
+                        --it;
+                        LOOP2_ASSERT(size, i, it->second <= range.first);
+                    }
+                    ranges.insert(range);
+                }
+            }
+
+            int index = 0;
+            for (int size = 1; size <= MAX_SIZE; ++size) {
+                for (int i = 0; i < 3; ++i, ++index) {
+                    const char *block = blocks[index];
+                    for (int j = 0; j < size; ++j) {
+                        if (static_cast<char>(size & 0xFF) != block[j]) {
+                            LOOP3_ASSERT(size, i, j, 0 && "corrupted");
+                            break;
+                        }
+                    }
+                }
+            }
+
+            for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                mX.deallocate(blocks[i]);
+            }
+
+            if (verbose) cout << "\tReuse of cached blocks." << endl;
+
+            for (int size = 1;
+                 size <= static_cast<int>(X.maxCachedBlockSize());
+                 ++size) {
+                void *block = mX.allocate(size);
+                mX.deallocate(block);
+                LOOP_ASSERT(size, block == mX.allocate(size));
+                mX.deallocate(block);
+            }
+
+            if (verbose) cout << "\tMany blocks." << endl;
+
+            blocks.clear();
+            for (int i = 0; i < 10000; ++i) {
+                blocks.push_back(static_cast<char *>(mX.allocate(24)));
+                *blocks.back() = 'x';
+            }
+            for (int i = 0; i < 10000; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+        ASSERT(0 == defaultAllocator.numAllocations());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor configures the number of pools and the maximum
+        //:   number of blocks per batch as specified, or with the default
+        //:   values.
+        //:
+        //: 2 'maxCachedBlockSize' is the largest pooled block size less the
+        //:   size of the block header.
+        //:
+        //: 3 The allocator supplied at construction (or the default allocator)
+        //:   is used, and all of its memory is released on destruction.
+        //
+        // Plan:
+        //: 1 Create objects with each constructor and verify the accessors,
+        //:   allocating a block from each.  (C-1..3)
+        //
+        // Testing:
+        //   ThreadCachingAllocator(bslma::Allocator *ba = 0);
+        //   ThreadCachingAllocator(int numPools, bslma::Allocator *ba = 0);
+        //   ThreadCachingAllocator(int, int, bslma::Allocator *ba = 0);
+        //   ~ThreadCachingAllocator();
+        //   int maxBlocksPerBatch() const;
+        //   size_type maxCachedBlockSize() const;
+        //   int numPools() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND ACCESSORS" << endl
+                          << "======================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        for (char cfg = 'a'; cfg <= 'e'; ++cfg) {
+            const char CONFIG = cfg;
+
+            Obj *objPtr = 0;
+            bslma::TestAllocator *objAllocatorPtr = &ta;
+
+            switch (CONFIG) {
+              case 'a': {
+                objPtr = new (ta) Obj(&ta);
+              } break;
+              case 'b': {
+                objPtr = new (ta) Obj(3, &ta);
+              } break;
+              case 'c': {
+                objPtr = new (ta) Obj(8, 10, &ta);
+              } break;
+              case 'd': {
+                objPtr = new (ta) Obj(1, 1, &ta);
+              } break;
+              case 'e': {
+                objPtr = new (ta) Obj();
+                objAllocatorPtr = &defaultAllocator;
+              } break;
+            }
+
+            Obj& mX = *objPtr;  const Obj& X = mX;
+
+            const int NUM_POOLS = 'b' == CONFIG ? 3
+                                : 'c' == CONFIG ? 8
+                                : 'd' == CONFIG ? 1
+                                : X.numPools();
+
+            LOOP_ASSERT(CONFIG, NUM_POOLS == X.numPools());
+
+            if ('c' == CONFIG) {
+                LOOP_ASSERT(CONFIG, 10 == X.maxBlocksPerBatch());
+            }
+            else if ('d' == CONFIG) {
+                LOOP_ASSERT(CONFIG, 1 == X.maxBlocksPerBatch());
+            }
+            else {
+                LOOP_ASSERT(CONFIG, 1 <= X.maxBlocksPerBatch());
+            }
+
+            const Obj::size_type MAX_POOLED = 8 << (NUM_POOLS - 1);
+            const Obj::size_type HEADER     = k_MAX_ALIGNMENT;
+
+            LOOP_ASSERT(CONFIG,
+                        (MAX_POOLED > HEADER ? MAX_POOLED - HEADER : 0) ==
+                                                     X.maxCachedBlockSize());
+
+            const bsls::Types::Int64 numAllocations =
+                                          objAllocatorPtr->numAllocations();
+
+            void *block = mX.allocate(X.maxCachedBlockSize() + 1);
+            ASSERT(block);
+            LOOP_ASSERT(CONFIG,
+                        numAllocations < objAllocatorPtr->numAllocations());
+            mX.deallocate(block);
+
+            if (X.maxCachedBlockSize()) {
+                block = mX.allocate(X.maxCachedBlockSize());
+                ASSERT(block);
+                mX.deallocate(block);
+            }
+
+            ta.deleteObject(objPtr);
+
+            LOOP_ASSERT(CONFIG, 0 == ta.numBytesInUse());
+            LOOP_ASSERT(CONFIG, 0 == defaultAllocator.numBytesInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate blocks of a few sizes from one thread
+        //:   and from several.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(&ta);
+
+            void *a = mX.allocate(1);
+            void *b = mX.allocate(100);
+            void *c = mX.allocate(100000);
+
+            ASSERT(a && b && c);
+            ASSERT(a != b);
+
+            bsl::memset(a, 1, 1);
+            bsl::memset(b, 2, 100);
+            bsl::memset(c, 3, 100000);
+
+            mX.deallocate(b);
+            mX.deallocate(a);
+            mX.deallocate(c);
+
+            runAllocLoop(&mX, 2, 100);
+            runProducerConsumer(&mX, 1, 1000, 100, true);
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: PRODUCER/CONSUMER
+        //
+        // Concerns:
+        //: 1 The thread-caching allocator outperforms the concurrent multipool
+        //:   allocator when blocks are allocated by producer threads and
+        //:   deallocated by consumer threads, and when many threads allocate
+        //:   and deallocate concurrently.
+        //
+        // Plan:
+        //: 1 Time a producer/consumer workload and a concurrent
+        //:   allocate/deallocate workload with the new/delete allocator, a
+        //:   'bdlma::ConcurrentMultipoolAllocator', and a
+        //:   'bdlma::ThreadCachingAllocator'.  Optional arguments specify the
+        //:   number of producer/consumer pairs and the number of blocks each
+        //:   producer allocates.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: PRODUCER/CONSUMER
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: PRODUCER/CONSUMER" << endl
+                          << "===================================" << endl;
+
+        const int NUM_PAIRS  = argc > 2 ? atoi(argv[2]) : 2;
+        const int NUM_BLOCKS = argc > 3 ? atoi(argv[3]) : 2000000;
+        const int MAX_SIZE   = 256;
+
+        bslma::Allocator *nda = ndAllocator();
+
+        cout << "Producer/consumer (" << NUM_PAIRS << " pairs, "
+             << NUM_BLOCKS << " blocks per producer):" << endl;
+        {
+            cout << "\tnew/delete:                   "
+                 << runProducerConsumer(nda,
+                                        NUM_PAIRS,
+                                        NUM_BLOCKS,
+                                        MAX_SIZE,
+                                        false)
+                 << "s" << endl;
+        }
+        {
+            bdlma::ConcurrentMultipoolAllocator multipool(nda);
+            cout << "\tConcurrentMultipoolAllocator: "
+                 << runProducerConsumer(&multipool,
+                                        NUM_PAIRS,
+                                        NUM_BLOCKS,
+                                        MAX_SIZE,
+                                        false)
+                 << "s" << endl;
+        }
+        {
+            Obj threadCaching(nda);
+            cout << "\tThreadCachingAllocator:       "
+                 << runProducerConsumer(&threadCaching,
+                                        NUM_PAIRS,
+                                        NUM_BLOCKS,
+                                        MAX_SIZE,
+                                        false)
+                 << "s" << endl;
+        }
+
+        const int NUM_THREADS    = 2 * NUM_PAIRS;
+        const int NUM_ITERATIONS = NUM_BLOCKS / 100;
+
+        cout << "Allocate/deallocate (" << NUM_THREADS << " threads, "
+             << NUM_ITERATIONS << " iterations of 100 blocks):" << endl;
+        {
+            cout << "\tnew/delete:                   "
+                 << runAllocLoop(nda, NUM_THREADS, NUM_ITERATIONS)
+                 << "s" << endl;
+        }
+        {
+            bdlma::ConcurrentMultipoolAllocator multipool(nda);
+            cout << "\tConcurrentMultipoolAllocator: "
+                 << runAllocLoop(&multipool, NUM_THREADS, NUM_ITERATIONS)
+                 << "s" << endl;
+        }
+        {
+            Obj threadCaching(nda);
+            cout << "\tThreadCachingAllocator:       "
+                 << runAllocLoop(&threadCaching, NUM_THREADS, NUM_ITERATIONS)
+                 << "s" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -185,7 +185,19 @@ int FixedThreadPool::startNewThread()
     bsl::function<void()> workerThreadFunc =
                   bdlf::MemFnUtil::memFn(&FixedThreadPool::workerThread, this);
 
-    int rc = d_threadGroup.addThread(workerThreadFunc, d_threadAttributes);
+    int rc;
+    if (d_workerCpuSets.empty()) {
+        rc = d_threadGroup.addThread(workerThreadFunc, d_threadAttributes);
+    }
+    else {
+        // Threads are started in order, so the number of threads already in
+        // the group is the index of the new thread.
+
+        bslmt::ThreadAttributes attributes(d_threadAttributes);
+        attributes.setCpuSet(d_workerCpuSets[d_threadGroup.numThreads()]);
+
+        rc = d_threadGroup.addThread(workerThreadFunc, attributes);
+    }
 
 #if defined(BSLS_PLATFORM_OS_UNIX)
     // Restore the mask.
@@ -210,6 +222,30 @@ FixedThreadPool::FixedThreadPool(
 , d_threadGroup(basicAllocator)
 , d_threadAttributes(threadAttributes)
 , d_numThreads(numThreads)
+, d_workerCpuSets(basicAllocator)
+{
+    BSLS_ASSERT_OPT(0 != d_numThreads);
+
+    disable();
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    initBlockSet(&d_blockSet);
+#endif
+}
+
+FixedThreadPool::FixedThreadPool(
+                 const bslmt::ThreadAttributes&         threadAttributes,
+                 const bsl::vector<bsl::vector<int> >&  workerCpuSets,
+                 int                                    maxNumPendingJobs,
+                 bslma::Allocator                      *basicAllocator)
+: d_queue(maxNumPendingJobs, basicAllocator)
+, d_control(e_STOP)
+, d_gateCount(0)
+, d_numThreadsReady(0)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(threadAttributes)
+, d_numThreads(static_cast<int>(workerCpuSets.size()))
+, d_workerCpuSets(workerCpuSets, basicAllocator)
 {
     BSLS_ASSERT_OPT(0 != d_numThreads);
 
@@ -229,6 +265,7 @@ FixedThreadPool::FixedThreadPool(int               numThreads,
 , d_numThreadsReady(0)
 , d_threadGroup(basicAllocator)
 , d_numThreads(numThreads)
+, d_workerCpuSets(basicAllocator)
 {
     BSLS_ASSERT_OPT(0 != d_numThreads);
 
@@ -91,6 +91,31 @@ BSLS_IDENT("$Id: $")
 // SIGIOT
 //..
 //
+///Pinning Worker Threads to CPUs
+///------------------------------
+// The threads of a pool can be restricted to a set of CPUs by setting the
+// 'cpuSet' attribute of the 'bslmt::ThreadAttributes' supplied at
+// construction (see 'bslmt_threadattributes').  Alternatively, a pool can be
+// constructed with one CPU set per worker thread, in which case the number of
+// threads in the pool is the number of CPU sets supplied, and the 'i'th
+// worker thread is restricted to the 'i'th CPU set, e.g., to pin each worker
+// to a distinct CPU:
+//..
+//  bsl::vector<bsl::vector<int> > workerCpuSets;
+//  for (int cpu = 0; cpu < 4; ++cpu) {
+//      workerCpuSets.push_back(bsl::vector<int>(1, cpu));
+//  }
+//  bdlmt::FixedThreadPool pool(bslmt::ThreadAttributes(),
+//                              workerCpuSets,
+//                              100);
+//..
+// Pinning each worker to its own CPU prevents the operating system from
+// migrating workers between CPUs (which discards the contents of the CPU
+// caches), and pinning the workers of a pool to the CPUs of one NUMA node
+// keeps them close to the memory they use.  Note that CPU affinity is
+// supported only on some platforms (see 'bslmt_threadutil'); the CPU sets are
+// ignored on other platforms.
+//
 ///Usage
 ///-----
 // This example demonstrates the use of a 'bdlmt::FixedThreadPool' to
@@ -348,6 +373,10 @@ BSLS_IDENT("$Id: $")
 #include <bsl_functional.h>
 #endif
 
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
 namespace BloombergLP {
 
 
@@ -426,6 +455,12 @@ class FixedThreadPool {
     const int               d_numThreads;         // number of configured
                                                   // processing threads.
 
+    bsl::vector<bsl::vector<int> >
+                            d_workerCpuSets;      // CPU set of each
+                                                  // processing thread, or
+                                                  // empty to use the 'cpuSet'
+                                                  // of 'd_threadAttributes'
+
 #if defined(BSLS_PLATFORM_OS_UNIX)
     sigset_t                d_blockSet;           // set of signals to be
                                                   // blocked in managed threads
@@ -487,6 +522,24 @@ class FixedThreadPool {
         // allocator is used.  The behavior is undefined unless
         // '1 <= numThreads' and '1 <= maxPendingJobs <= 0x01FFFFFF'.
 
+    FixedThreadPool(
+                const bslmt::ThreadAttributes&         threadAttributes,
+                const bsl::vector<bsl::vector<int> >&  workerCpuSets,
+                int                                    maxNumPendingJobs,
+                bslma::Allocator                      *basicAllocator = 0);
+        // Construct a thread pool with the specified 'threadAttributes',
+        // 'workerCpuSets.size()' threads, and a job queue with capacity
+        // sufficient to enqueue the specified 'maxNumPendingJobs' without
+        // blocking, in which the 'i'th thread started is restricted to run on
+        // the CPUs in 'workerCpuSets[i]' (which overrides the 'cpuSet'
+        // attribute of 'threadAttributes').  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '1 <= workerCpuSets.size()' and
+        // '1 <= maxPendingJobs <= 0x01FFFFFF'.  Note that a pool that fails to
+        // start a thread on its CPU set fails to 'start'.  See {Pinning Worker
+        // Threads to CPUs}.
+
     ~FixedThreadPool();
         // Remove all pending jobs from the queue without executing them, block
         // until all currently running jobs complete, and then destroy this
@@ -15,14 +15,17 @@
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 
+#include <bdlf_bind.h>
 #include <bdlt_currenttime.h>
 #include <bslmt_barrier.h>
 #include <bslmt_lockguard.h>
+#include <bslmt_threadutil.h>
 
 #include <bsls_platform.h>
 #include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdio.h>             // For FILE in usage example
 #include <bsl_cstdlib.h>            // for atoi
@@ -74,6 +77,7 @@ using namespace bsl;  // automatically added by script
 // [ 4] int queueCapacity() const;
 // [ 4] int numThreadsStarted() const;
 // [ 5] int tryenqueueJob(FixedThreadPoolJobFunc, void *);
+// [15] FixedThreadPool(const Attributes&, const vector<CpuSet>&, int);
 // ----------------------------------------------------------------------------
 // [ 2] TESTING HELPER FUNCTIONS
 // [ 2] Breathing test
@@ -435,6 +439,32 @@ static void myFastFunctorSearch(const string&         word,
     delete[] jobInfoArray;
 }
 
+// ============================================================================
+//                         CASE 15 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace FIXEDTHREADPOOL_CASE_15 {
+
+void recordCpuSet(bslmt::Mutex                     *mutex,
+                  bsl::vector<bsl::vector<int> >   *cpuSets,
+                  bslmt::Barrier                   *barrier)
+    // Append the CPU set of the current thread to the specified 'cpuSets'
+    // while holding the specified 'mutex', and then wait on the specified
+    // 'barrier'.
+{
+    bsl::vector<int> cpuSet;
+    int rc = bslmt::ThreadUtil::getThreadCpuSet(&cpuSet,
+                                                bslmt::ThreadUtil::self());
+    ASSERT(0 == rc);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(mutex);
+        cpuSets->push_back(cpuSet);
+    }
+    barrier->wait();
+}
+
+}  // close namespace FIXEDTHREADPOOL_CASE_15
+
 // ============================================================================
 //                         CASE 14 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -671,6 +701,81 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // case 0 is always the first case
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING PER-WORKER CPU SETS
+        //
+        // Concerns:
+        //: 1 A pool constructed with one CPU set per worker has as many
+        //:   threads as CPU sets.
+        //:
+        //: 2 Each worker runs only on its own CPU set, also after the pool is
+        //:   stopped and restarted.
+        //
+        // Plan:
+        //: 1 Create a pool having one worker per CPU available to this
+        //:   process (at most 4), each pinned to a distinct CPU.  Enqueue one
+        //:   job per worker that records the CPU set of the thread running it
+        //:   and waits on a barrier (so that every worker runs exactly one
+        //:   job).  Verify the recorded CPU sets.  Repeat after restarting the
+        //:   pool.  (C-1..2)
+        //
+        // Testing:
+        //   FixedThreadPool(const Attributes&, const vector<CpuSet>&, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING PER-WORKER CPU SETS\n"
+                          << "===========================" << endl;
+
+        using namespace FIXEDTHREADPOOL_CASE_15;
+
+        bsl::vector<int> available;
+        if (0 != bslmt::ThreadUtil::getThreadCpuSet(
+                                                &available,
+                                                bslmt::ThreadUtil::self())) {
+            if (verbose) cout << "CPU affinity is not supported." << endl;
+            break;
+        }
+        ASSERT(!available.empty());
+
+        bsl::vector<bsl::vector<int> > workerCpuSets(&testAllocator);
+        for (int i = 0; i < 4 && i < static_cast<int>(available.size()); ++i) {
+            workerCpuSets.push_back(bsl::vector<int>(1, available[i]));
+        }
+        const int NUM_THREADS = static_cast<int>(workerCpuSets.size());
+
+        bdlmt::FixedThreadPool mX(bslmt::ThreadAttributes(),
+                                  workerCpuSets,
+                                  NUM_THREADS,
+                                  &testAllocator);
+        const bdlmt::FixedThreadPool& X = mX;
+
+        ASSERT(NUM_THREADS == X.numThreads());
+
+        for (int iteration = 0; iteration < 2; ++iteration) {
+            ASSERT(0 == mX.start());
+            ASSERT(NUM_THREADS == X.numThreadsStarted());
+
+            bslmt::Mutex                   mutex;
+            bsl::vector<bsl::vector<int> > cpuSets;
+            bslmt::Barrier                 barrier(NUM_THREADS);
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&recordCpuSet,
+                                                               &mutex,
+                                                               &cpuSets,
+                                                               &barrier)));
+            }
+            mX.drain();
+
+            ASSERT(NUM_THREADS == static_cast<int>(cpuSets.size()));
+
+            bsl::sort(cpuSets.begin(), cpuSets.end());
+            ASSERTV(iteration, workerCpuSets == cpuSets);
+
+            mX.stop();
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TEST CASE FOR WINDOWS TEST FAILURE
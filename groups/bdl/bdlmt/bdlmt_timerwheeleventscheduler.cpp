@@ -0,0 +1,902 @@
+// bdlmt_timerwheeleventscheduler.cpp                                 -*-C++-*-
+#include <bdlmt_timerwheeleventscheduler.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_timerwheeleventscheduler_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_systemtime.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdint.h>
+#include <bsl_limits.h>
+
+// IMPLEMENTATION NOTES:
+// The wheel keeps, in 'd_currentTick', the next tick to be processed: every
+// event filed into the wheel expires in that tick or later (the tick of an
+// event scheduled in the past is clamped to 'd_currentTick').  An event
+// expiring 'delta' ticks after 'd_currentTick' is filed into level 'N', where
+// 'N' is the smallest level such that 'delta < 256^(N + 1)', in the slot
+// selected by bits '[8N, 8N + 8)' of its (absolute) tick.  A slot of level
+// 'N > 0' is cascaded when the current tick reaches the first multiple of
+// '256^N' selecting that slot, which is never later than the tick of any of
+// the events filed into it; cascading simply re-files the events relative to
+// the new current tick.  Level 0 slots hold exactly the events of one tick.
+//
+// Ticks need not be processed one at a time: 'nextProcessingTime' locates,
+// using the occupancy bitmaps, the next tick at which a non-empty slot is
+// either cascaded or expired, and the ticks before it are skipped.
+
+namespace BloombergLP {
+namespace {
+
+typedef bsls::Types::Int64  Int64;
+typedef bsls::Types::Uint64 Uint64;
+
+const Int64 k_MAX_DELTA = (static_cast<Int64>(1) << 32) - 1;
+    // Maximum number of ticks between the current tick and the tick in which
+    // an event is filed; events further in the future are filed at this
+    // distance and re-filed when cascaded.
+
+const Int64 k_DEFAULT_TICK_RESOLUTION = 1000;
+    // Default tick resolution, in microseconds.
+
+Int64 divideRoundingUp(Int64 dividend, Int64 divisor)
+    // Return the smallest integer not less than the specified 'dividend'
+    // divided by the specified 'divisor'.  The behavior is undefined unless
+    // '0 < divisor'.
+{
+    Int64 quotient = dividend / divisor;
+    if (dividend % divisor > 0) {
+        ++quotient;
+    }
+    return quotient;
+}
+
+Int64 divideRoundingDown(Int64 dividend, Int64 divisor)
+    // Return the largest integer not greater than the specified 'dividend'
+    // divided by the specified 'divisor'.  The behavior is undefined unless
+    // '0 < divisor'.
+{
+    Int64 quotient = dividend / divisor;
+    if (dividend % divisor < 0) {
+        --quotient;
+    }
+    return quotient;
+}
+
+Int64 nowInMicroseconds(bsls::SystemClockType::Enum clockType)
+    // Return the current time, in microseconds, of the clock indicated by the
+    // specified 'clockType'.
+{
+    return bsls::SystemTime::now(clockType).totalMicroseconds();
+}
+
+bsls::TimeInterval toTimeInterval(Int64 microseconds)
+    // Return the time interval of the specified 'microseconds'.
+{
+    bsls::TimeInterval result;
+    result.setTotalMicroseconds(microseconds);
+    return result;
+}
+
+void defaultDispatcherFunction(const bsl::function<void()>& callback)
+    // Invoke the specified 'callback'.
+{
+    callback();
+}
+
+}  // close unnamed namespace
+
+namespace bdlmt {
+
+                   // ------------------------------------
+                   // class TimerWheelEventScheduler_Wheel
+                   // ------------------------------------
+
+// PRIVATE CLASS METHODS
+int TimerWheelEventScheduler_Wheel::findNextOccupied(const Uint64 *bitmap,
+                                                     int           start)
+{
+    BSLS_ASSERT_SAFE(bitmap);
+    BSLS_ASSERT_SAFE(0 <= start);
+    BSLS_ASSERT_SAFE(start < k_SLOTS_PER_LEVEL);
+
+    int word = start / 64;
+
+    // Search the first word, ignoring the bits before 'start'.
+
+    Uint64 bits = bitmap[word] & (~static_cast<Uint64>(0) << (start % 64));
+    if (bits) {
+        return word * 64 + bdlb::BitUtil::numTrailingUnsetBits(
+                                             static_cast<bsl::uint64_t>(bits));
+                                                                      // RETURN
+    }
+
+    // Search the following words, wrapping around to the first word again.
+
+    for (int i = 1; i <= k_WORDS_PER_LEVEL; ++i) {
+        word = (word + 1) % k_WORDS_PER_LEVEL;
+        if (bitmap[word]) {
+            return word * 64 + bdlb::BitUtil::numTrailingUnsetBits(
+                                     static_cast<bsl::uint64_t>(bitmap[word]));
+                                                                      // RETURN
+        }
+    }
+    return -1;
+}
+
+// PRIVATE MANIPULATORS
+int TimerWheelEventScheduler_Wheel::allocateNode()
+{
+    if (-1 != d_freeList) {
+        const int index = d_freeList;
+        d_freeList = d_nodes[index].d_next;
+        return index;                                                 // RETURN
+    }
+
+    BSLS_ASSERT(d_nodes.size() < static_cast<bsl::size_t>(
+                                            bsl::numeric_limits<int>::max()));
+
+    const int index = static_cast<int>(d_nodes.size());
+
+    Node node;
+    node.d_slot       = -1;
+    node.d_generation = 0;
+    d_nodes.push_back(node);
+    d_callbacks.push_back(Callback());
+    return index;
+}
+
+void TimerWheelEventScheduler_Wheel::cascade(int level, int slot)
+{
+    int index = takeSlot(level * k_SLOTS_PER_LEVEL + slot);
+    while (-1 != index) {
+        const int next = d_nodes[index].d_next;
+        insert(index);
+        index = next;
+    }
+}
+
+void TimerWheelEventScheduler_Wheel::expire(bsl::vector<Callback> *callbacks)
+{
+    int index = takeSlot(static_cast<int>(d_currentTick &
+                                                     (k_SLOTS_PER_LEVEL - 1)));
+    ++d_currentTick;
+
+    while (-1 != index) {
+        Node& node = d_nodes[index];
+
+        const int next = node.d_next;
+
+        callbacks->resize(callbacks->size() + 1);
+        if (0 == node.d_interval) {
+            callbacks->back().swap(d_callbacks[index]);
+            freeNode(index);
+            --d_numEvents;
+        }
+        else {
+            callbacks->back() = d_callbacks[index];
+            node.d_time += node.d_interval;
+            node.d_tick  = timeToTick(node.d_time);
+            insert(index);
+        }
+        index = next;
+    }
+}
+
+void TimerWheelEventScheduler_Wheel::freeNode(int index)
+{
+    Node& node = d_nodes[index];
+
+    node.d_slot = -1;
+    ++node.d_generation;
+    node.d_next = d_freeList;
+    d_freeList  = index;
+}
+
+void TimerWheelEventScheduler_Wheel::insert(int index)
+{
+    const Int64 tick  = bsl::max(d_nodes[index].d_tick, d_currentTick);
+    const Int64 delta = bsl::min(tick - d_currentTick, k_MAX_DELTA);
+    const Int64 slotTick = d_currentTick + delta;
+
+    int level = 0;
+    while (delta >> ((level + 1) * k_BITS_PER_LEVEL)) {
+        ++level;
+    }
+    BSLS_ASSERT_SAFE(level < k_NUM_LEVELS);
+
+    const int slot = static_cast<int>(
+                        (slotTick >> (level * k_BITS_PER_LEVEL)) &
+                                                     (k_SLOTS_PER_LEVEL - 1));
+    link(index, level * k_SLOTS_PER_LEVEL + slot);
+}
+
+void TimerWheelEventScheduler_Wheel::link(int index, int slot)
+{
+    Node& node = d_nodes[index];
+
+    node.d_slot = slot;
+
+    const int head = d_slots[slot];
+    if (-1 == head) {
+        node.d_prev   = index;
+        node.d_next   = index;
+        d_slots[slot] = index;
+
+        const int level = slot / k_SLOTS_PER_LEVEL;
+        const int bit   = slot % k_SLOTS_PER_LEVEL;
+        d_occupied[level][bit / 64] |= static_cast<Uint64>(1) << (bit % 64);
+    }
+    else {
+        const int tail = d_nodes[head].d_prev;
+        node.d_prev           = tail;
+        node.d_next           = head;
+        d_nodes[tail].d_next  = index;
+        d_nodes[head].d_prev  = index;
+    }
+}
+
+int TimerWheelEventScheduler_Wheel::takeSlot(int slot)
+{
+    const int head = d_slots[slot];
+    if (-1 == head) {
+        return -1;                                                    // RETURN
+    }
+
+    d_slots[slot] = -1;
+
+    const int level = slot / k_SLOTS_PER_LEVEL;
+    const int bit   = slot % k_SLOTS_PER_LEVEL;
+    d_occupied[level][bit / 64] &= ~(static_cast<Uint64>(1) << (bit % 64));
+
+    // Break the circular list after its tail.
+
+    d_nodes[d_nodes[head].d_prev].d_next = -1;
+    return head;
+}
+
+void TimerWheelEventScheduler_Wheel::unlink(int index)
+{
+    Node& node = d_nodes[index];
+
+    const int slot = node.d_slot;
+
+    if (node.d_next == index) {
+        d_slots[slot] = -1;
+
+        const int level = slot / k_SLOTS_PER_LEVEL;
+        const int bit   = slot % k_SLOTS_PER_LEVEL;
+        d_occupied[level][bit / 64] &=
+                                     ~(static_cast<Uint64>(1) << (bit % 64));
+    }
+    else {
+        d_nodes[node.d_prev].d_next = node.d_next;
+        d_nodes[node.d_next].d_prev = node.d_prev;
+        if (d_slots[slot] == index) {
+            d_slots[slot] = node.d_next;
+        }
+    }
+    node.d_slot = -1;
+}
+
+// PRIVATE ACCESSORS
+int TimerWheelEventScheduler_Wheel::validIndex(Handle handle) const
+{
+    if (handle < 0) {
+        return -1;                                                    // RETURN
+    }
+
+    const Uint64 index      = static_cast<Uint64>(handle) & 0xFFFFFFFFu;
+    const Uint64 generation = static_cast<Uint64>(handle) >> 32;
+
+    if (index >= d_nodes.size()) {
+        return -1;                                                    // RETURN
+    }
+
+    const Node& node = d_nodes[static_cast<bsl::size_t>(index)];
+    if (-1 == node.d_slot || (node.d_generation & 0x7FFFFFFFu) != generation) {
+        return -1;                                                    // RETURN
+    }
+    return static_cast<int>(index);
+}
+
+inline
+Int64 TimerWheelEventScheduler_Wheel::timeToTick(Int64 time) const
+{
+    return divideRoundingUp(time, d_tickResolution);
+}
+
+// CREATORS
+TimerWheelEventScheduler_Wheel::TimerWheelEventScheduler_Wheel(
+                                              Int64             tickResolution,
+                                              Int64             currentTime,
+                                              bslma::Allocator *basicAllocator)
+: d_tickResolution(tickResolution)
+, d_currentTick(0)
+, d_nodes(basicAllocator)
+, d_callbacks(basicAllocator)
+, d_freeList(-1)
+, d_numEvents(0)
+, d_numRecurringEvents(0)
+{
+    BSLS_ASSERT(0 < tickResolution);
+
+    d_currentTick = timeToTick(currentTime);
+
+    bsl::fill(d_slots, d_slots + k_NUM_SLOTS, -1);
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        bsl::fill(d_occupied[level],
+                  d_occupied[level] + k_WORDS_PER_LEVEL,
+                  static_cast<Uint64>(0));
+    }
+}
+
+// MANIPULATORS
+TimerWheelEventScheduler_Wheel::Handle
+TimerWheelEventScheduler_Wheel::add(Int64           time,
+                                    Int64           interval,
+                                    const Callback& callback)
+{
+    BSLS_ASSERT(0 <= interval);
+
+    const int index = allocateNode();
+
+    d_callbacks[index] = callback;
+
+    Node& node = d_nodes[index];
+    node.d_time     = time;
+    node.d_interval = interval;
+    node.d_tick     = timeToTick(time);
+    insert(index);
+
+    ++d_numEvents;
+    if (interval) {
+        ++d_numRecurringEvents;
+    }
+
+    return static_cast<Handle>(
+                 (static_cast<Uint64>(node.d_generation & 0x7FFFFFFFu) << 32) |
+                                                   static_cast<Uint64>(index));
+}
+
+int TimerWheelEventScheduler_Wheel::advance(Int64                  now,
+                                            bsl::vector<Callback> *callbacks)
+{
+    BSLS_ASSERT(callbacks);
+
+    const bsl::size_t initialSize = callbacks->size();
+    const Int64       lastTick    = divideRoundingDown(now, d_tickResolution);
+
+    Int64 time;
+    while (0 == nextProcessingTime(&time) && time <= now) {
+        d_currentTick = time / d_tickResolution;
+
+        // Cascade the slots selected by the current tick, from the top level
+        // down, so that the events cascaded from a level are cascaded again,
+        // if needed, from the level below.
+
+        for (int level = k_NUM_LEVELS - 1; 0 < level; --level) {
+            const int shift = level * k_BITS_PER_LEVEL;
+            if (0 == (d_currentTick & ((static_cast<Int64>(1) << shift) - 1)))
+            {
+                cascade(level,
+                        static_cast<int>((d_currentTick >> shift) &
+                                                    (k_SLOTS_PER_LEVEL - 1)));
+            }
+        }
+
+        expire(callbacks);
+    }
+
+    // No event expires in the remaining ticks up to 'lastTick'.
+
+    if (d_currentTick <= lastTick) {
+        d_currentTick = lastTick + 1;
+    }
+
+    return static_cast<int>(callbacks->size() - initialSize);
+}
+
+int TimerWheelEventScheduler_Wheel::remove(Handle handle)
+{
+    const int index = validIndex(handle);
+    if (-1 == index) {
+        return -1;                                                    // RETURN
+    }
+
+    unlink(index);
+
+    --d_numEvents;
+    if (d_nodes[index].d_interval) {
+        --d_numRecurringEvents;
+    }
+
+    d_callbacks[index] = Callback();
+    freeNode(index);
+    return 0;
+}
+
+void TimerWheelEventScheduler_Wheel::removeAll()
+{
+    for (int slot = 0; slot < k_NUM_SLOTS; ++slot) {
+        int index = takeSlot(slot);
+        while (-1 != index) {
+            const int next = d_nodes[index].d_next;
+            d_callbacks[index] = Callback();
+            freeNode(index);
+            index = next;
+        }
+    }
+    d_numEvents          = 0;
+    d_numRecurringEvents = 0;
+}
+
+int TimerWheelEventScheduler_Wheel::update(Handle handle, Int64 newTime)
+{
+    const int index = validIndex(handle);
+    if (-1 == index) {
+        return -1;                                                    // RETURN
+    }
+
+    unlink(index);
+
+    Node& node = d_nodes[index];
+    node.d_time = newTime;
+    node.d_tick = timeToTick(newTime);
+    insert(index);
+    return 0;
+}
+
+// ACCESSORS
+int TimerWheelEventScheduler_Wheel::nextProcessingTime(Int64 *time) const
+{
+    BSLS_ASSERT(time);
+
+    if (0 == d_numEvents) {
+        return -1;                                                    // RETURN
+    }
+
+    // For each level, find the first tick, at or after the current tick, that
+    // is a multiple of the span of a slot of that level and selects a
+    // non-empty slot.
+
+    Int64 result = bsl::numeric_limits<Int64>::max();
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        const int   shift = level * k_BITS_PER_LEVEL;
+        const Int64 span  = static_cast<Int64>(1) << shift;
+        const Int64 base  = (d_currentTick + span - 1) >> shift;
+        const int   start = static_cast<int>(base & (k_SLOTS_PER_LEVEL - 1));
+        const int   slot  = findNextOccupied(d_occupied[level], start);
+        if (-1 == slot) {
+            continue;                                               // CONTINUE
+        }
+
+        Int64 tick = base - start + slot;
+        if (slot < start) {
+            tick += k_SLOTS_PER_LEVEL;
+        }
+        result = bsl::min(result, tick << shift);
+    }
+
+    BSLS_ASSERT(bsl::numeric_limits<Int64>::max() != result);
+
+    *time = result * d_tickResolution;
+    return 0;
+}
+
+                   // ----------------------------------------
+                   // struct TimerWheelEventSchedulerDispatcher
+                   // ----------------------------------------
+
+struct TimerWheelEventSchedulerDispatcher {
+    // This 'struct' contains the method run by the dispatcher thread.  Once
+    // started, it loops, either waiting for or dispatching events, until the
+    // scheduler is stopped.
+
+    // CLASS METHODS
+    static void dispatchEvents(TimerWheelEventScheduler *scheduler);
+        // Dispatch the events of the specified 'scheduler' until it is
+        // stopped.
+};
+
+extern "C" void *TimerWheelEventSchedulerDispatcherThread(void *scheduler)
+{
+    TimerWheelEventSchedulerDispatcher::dispatchEvents(
+                               static_cast<TimerWheelEventScheduler *>(
+                                                                  scheduler));
+    return scheduler;
+}
+
+void TimerWheelEventSchedulerDispatcher::dispatchEvents(
+                                           TimerWheelEventScheduler *scheduler)
+{
+    BSLS_ASSERT(scheduler);
+
+    bsl::vector<TimerWheelEventScheduler::Callback>& pending =
+                                                 scheduler->d_pendingCallbacks;
+
+    while (1) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> lock(&scheduler->d_mutex);
+
+            if (!scheduler->d_running.loadRelaxed()) {
+                scheduler->d_wakeTime = bsl::numeric_limits<Int64>::min();
+                return;                                               // RETURN
+            }
+            ++scheduler->d_iterations;
+
+            scheduler->d_wheel.advance(
+                                  nowInMicroseconds(scheduler->d_clockType),
+                                  &pending);
+
+            if (pending.empty()) {
+                Int64 wakeTime;
+                if (0 == scheduler->d_wheel.nextProcessingTime(&wakeTime)) {
+                    scheduler->d_wakeTime = wakeTime;
+                    scheduler->d_condition.timedWait(
+                                                  &scheduler->d_mutex,
+                                                  toTimeInterval(wakeTime));
+                }
+                else {
+                    scheduler->d_wakeTime =
+                                         bsl::numeric_limits<Int64>::max();
+                    scheduler->d_condition.wait(&scheduler->d_mutex);
+                }
+                continue;
+            }
+
+            // The dispatcher thread re-examines the wheel after dispatching,
+            // so that it need not be woken up until then.
+
+            scheduler->d_wakeTime = bsl::numeric_limits<Int64>::min();
+        }
+
+        for (bsl::size_t i = 0; i < pending.size(); ++i) {
+            scheduler->d_dispatcherFunctor(pending[i]);
+        }
+        pending.clear();
+    }
+}
+
+                      // ------------------------------
+                      // class TimerWheelEventScheduler
+                      // ------------------------------
+
+// PRIVATE MANIPULATORS
+void TimerWheelEventScheduler::wakeDispatcher(Int64 time)
+{
+    if (time < d_wakeTime) {
+        d_wakeTime = time;
+        d_condition.signal();
+    }
+}
+
+void TimerWheelEventScheduler::yieldToDispatcher()
+{
+    if (d_running.loadRelaxed()) {
+        const bsls::Types::Uint64 dispatcherId =
+                                          static_cast<bsls::Types::Uint64>(
+                                                 d_dispatcherId.loadRelaxed());
+
+        if (bslmt::ThreadUtil::selfIdAsUint64() != dispatcherId) {
+            const int iteration = d_iterations.loadRelaxed();
+            while (iteration == d_iterations.loadRelaxed() &&
+                   d_running.loadRelaxed()) {
+                {
+                    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+                    d_condition.signal();
+                }
+                bslmt::ThreadUtil::yield();
+            }
+        }
+    }
+}
+
+// CREATORS
+TimerWheelEventScheduler::TimerWheelEventScheduler(
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_wheel(k_DEFAULT_TICK_RESOLUTION,
+          nowInMicroseconds(bsls::SystemClockType::e_REALTIME),
+          basicAllocator)
+, d_pendingCallbacks(basicAllocator)
+, d_wakeTime(bsl::numeric_limits<Int64>::min())
+, d_condition(bsls::SystemClockType::e_REALTIME)
+, d_dispatcherFunctor(bsl::allocator_arg_t(),
+                      basicAllocator,
+                      &defaultDispatcherFunction)
+, d_dispatcherId(0)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_running(0)
+, d_iterations(0)
+, d_clockType(bsls::SystemClockType::e_REALTIME)
+{
+}
+
+TimerWheelEventScheduler::TimerWheelEventScheduler(
+                                   bsls::SystemClockType::Enum  clockType,
+                                   bslma::Allocator            *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_wheel(k_DEFAULT_TICK_RESOLUTION,
+          nowInMicroseconds(clockType),
+          basicAllocator)
+, d_pendingCallbacks(basicAllocator)
+, d_wakeTime(bsl::numeric_limits<Int64>::min())
+, d_condition(clockType)
+, d_dispatcherFunctor(bsl::allocator_arg_t(),
+                      basicAllocator,
+                      &defaultDispatcherFunction)
+, d_dispatcherId(0)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_running(0)
+, d_iterations(0)
+, d_clockType(clockType)
+{
+}
+
+TimerWheelEventScheduler::TimerWheelEventScheduler(
+                                  const Dispatcher&  dispatcherFunctor,
+                                  bslma::Allocator  *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_wheel(k_DEFAULT_TICK_RESOLUTION,
+          nowInMicroseconds(bsls::SystemClockType::e_REALTIME),
+          basicAllocator)
+, d_pendingCallbacks(basicAllocator)
+, d_wakeTime(bsl::numeric_limits<Int64>::min())
+, d_condition(bsls::SystemClockType::e_REALTIME)
+, d_dispatcherFunctor(bsl::allocator_arg_t(),
+                      basicAllocator,
+                      dispatcherFunctor)
+, d_dispatcherId(0)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_running(0)
+, d_iterations(0)
+, d_clockType(bsls::SystemClockType::e_REALTIME)
+{
+}
+
+TimerWheelEventScheduler::TimerWheelEventScheduler(
+                                const Dispatcher&            dispatcherFunctor,
+                                bsls::SystemClockType::Enum  clockType,
+                                bslma::Allocator            *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_wheel(k_DEFAULT_TICK_RESOLUTION,
+          nowInMicroseconds(clockType),
+          basicAllocator)
+, d_pendingCallbacks(basicAllocator)
+, d_wakeTime(bsl::numeric_limits<Int64>::min())
+, d_condition(clockType)
+, d_dispatcherFunctor(bsl::allocator_arg_t(),
+                      basicAllocator,
+                      dispatcherFunctor)
+, d_dispatcherId(0)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_running(0)
+, d_iterations(0)
+, d_clockType(clockType)
+{
+}
+
+TimerWheelEventScheduler::TimerWheelEventScheduler(
+                                const bsls::TimeInterval&    tickResolution,
+                                const Dispatcher&            dispatcherFunctor,
+                                bsls::SystemClockType::Enum  clockType,
+                                bslma::Allocator            *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_wheel(tickResolution.totalMicroseconds(),
+          nowInMicroseconds(clockType),
+          basicAllocator)
+, d_pendingCallbacks(basicAllocator)
+, d_wakeTime(bsl::numeric_limits<Int64>::min())
+, d_condition(clockType)
+, d_dispatcherFunctor(bsl::allocator_arg_t(),
+                      basicAllocator,
+                      dispatcherFunctor)
+, d_dispatcherId(0)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_running(0)
+, d_iterations(0)
+, d_clockType(clockType)
+{
+}
+
+TimerWheelEventScheduler::~TimerWheelEventScheduler()
+{
+    stop();
+}
+
+// MANIPULATORS
+int TimerWheelEventScheduler::start()
+{
+    bslmt::ThreadAttributes attr;
+
+    return start(attr);
+}
+
+int TimerWheelEventScheduler::start(
+                               const bslmt::ThreadAttributes& threadAttributes)
+{
+    // Implementation note: 'd_dispatcherMutex' is in a lock hierarchy with
+    // 'd_mutex' and must always be locked first.
+
+    bslmt::LockGuard<bslmt::Mutex> dispatcherLock(&d_dispatcherMutex);
+
+    BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
+                                            d_dispatcherThread));
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    if (d_running.loadRelaxed()) {
+        return 0;                                                     // RETURN
+    }
+
+    bslmt::ThreadAttributes modAttr(threadAttributes);
+    modAttr.setDetachedState(bslmt::ThreadAttributes::e_CREATE_JOINABLE);
+
+    if (bslmt::ThreadUtil::create(&d_dispatcherThread,
+                                  modAttr,
+                                  &TimerWheelEventSchedulerDispatcherThread,
+                                  this)) {
+        return -1;                                                    // RETURN
+    }
+    d_dispatcherId = bslmt::ThreadUtil::idAsUint64(
+                            bslmt::ThreadUtil::handleToId(d_dispatcherThread));
+    d_running = 1;
+
+    return 0;
+}
+
+void TimerWheelEventScheduler::stop()
+{
+    // Implementation note: 'd_dispatcherMutex' is in a lock hierarchy with
+    // 'd_mutex' and must always be locked first.
+
+    bslmt::LockGuard<bslmt::Mutex> dispatcherLock(&d_dispatcherMutex);
+
+    BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
+                                            d_dispatcherThread));
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        if (!d_running.loadRelaxed()) {
+            return;                                                   // RETURN
+        }
+
+        d_running = 0;
+        d_condition.signal();
+    }
+
+    bslmt::ThreadUtil::join(d_dispatcherThread);
+}
+
+TimerWheelEventScheduler::Handle
+TimerWheelEventScheduler::scheduleEvent(const bsls::TimeInterval&    time,
+                                        const bsl::function<void()>& callback)
+{
+    const Int64 timeUs = time.totalMicroseconds();
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    const Handle handle = d_wheel.add(timeUs, 0, callback);
+    wakeDispatcher(timeUs);
+    return handle;
+}
+
+TimerWheelEventScheduler::Handle
+TimerWheelEventScheduler::scheduleRecurringEvent(
+                                       const bsls::TimeInterval&    interval,
+                                       const bsl::function<void()>& callback,
+                                       const bsls::TimeInterval&    startTime)
+{
+    BSLS_ASSERT(0 < interval);
+
+    const Int64 intervalUs = interval.totalMicroseconds();
+    const Int64 startUs    = 0 == startTime
+                             ? nowInMicroseconds(d_clockType) + intervalUs
+                             : startTime.totalMicroseconds();
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    const Handle handle = d_wheel.add(startUs, intervalUs, callback);
+    wakeDispatcher(startUs);
+    return handle;
+}
+
+int TimerWheelEventScheduler::rescheduleEvent(
+                                         Handle                    handle,
+                                         const bsls::TimeInterval& newTime,
+                                         bool                      wait)
+{
+    const Int64 timeUs = newTime.totalMicroseconds();
+
+    int status;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        status = d_wheel.update(handle, timeUs);
+        if (0 == status) {
+            wakeDispatcher(timeUs);
+        }
+    }
+
+    if (status && wait) {
+        yieldToDispatcher();
+    }
+
+    return status;
+}
+
+int TimerWheelEventScheduler::cancelEvent(Handle handle, bool wait)
+{
+    int status;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        status = d_wheel.remove(handle);
+    }
+
+    if (wait) {
+        yieldToDispatcher();
+    }
+
+    return status;
+}
+
+void TimerWheelEventScheduler::cancelAllEvents(bool wait)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        d_wheel.removeAll();
+    }
+
+    if (wait) {
+        yieldToDispatcher();
+    }
+}
+
+// ACCESSORS
+int TimerWheelEventScheduler::numEvents() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    return d_wheel.numEvents();
+}
+
+int TimerWheelEventScheduler::numRecurringEvents() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    return d_wheel.numRecurringEvents();
+}
+
+bsls::TimeInterval TimerWheelEventScheduler::tickResolution() const
+{
+    return toTimeInterval(d_wheel.tickResolution());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,762 @@
+// bdlmt_timerwheeleventscheduler.h                                   -*-C++-*-
+#ifndef INCLUDED_BDLMT_TIMERWHEELEVENTSCHEDULER
+#define INCLUDED_BDLMT_TIMERWHEELEVENTSCHEDULER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an event scheduler backed by a hierarchical timing wheel.
+//
+//@CLASSES:
+//  bdlmt::TimerWheelEventScheduler: thread-safe timing-wheel event scheduler
+//
+//@SEE_ALSO: bdlmt_eventscheduler, bdlmt_timereventscheduler
+//
+//@DESCRIPTION: This component provides a thread-safe event scheduler,
+// 'bdlmt::TimerWheelEventScheduler', whose events are stored in a
+// hierarchical timing wheel.  It provides methods to schedule, reschedule,
+// and cancel recurring and non-recurring events, each of which executes in
+// constant time regardless of the number of events managed by the scheduler.
+// As with the other event schedulers of this package, the callbacks are
+// processed by a separate thread (called the dispatcher thread), and may be
+// handed off to a user-supplied dispatcher functor.
+//
+///Comparison to 'bdlmt::EventScheduler'
+///- - - - - - - - - - - - - - - - - - -
+// 'bdlmt::EventScheduler' keeps its events in skip lists ordered by time, so
+// that scheduling, rescheduling, and cancelling an event costs (expected)
+// logarithmic time, and events are dispatched at precisely the time they were
+// scheduled for.  A 'bdlmt::TimerWheelEventScheduler' instead rounds the time
+// of each event up to a multiple of a *tick* *resolution*, supplied at
+// construction (one millisecond by default), and files the event in a slot of
+// a timing wheel in constant time.  This trade-off favors applications that
+// manage a large number of timers that are frequently rescheduled or
+// cancelled before they expire (e.g., connection or request timeouts), and
+// that can tolerate events being dispatched up to one tick late.
+//
+// The handles of a 'bdlmt::TimerWheelEventScheduler' are light-weight
+// integral values (as are those of 'bdlmt::TimerEventScheduler'): they need
+// not be released, and a handle that refers to an event that has been
+// dispatched or cancelled is detected as invalid, even if the storage for
+// that event has since been reused for another event.
+//
+///Timing Wheel
+///------------
+// The timing wheel consists of four levels of 256 slots each.  Time is
+// divided into ticks of the resolution supplied at construction; level 0
+// holds the events that expire within the next 256 ticks, one slot per tick,
+// and each slot of level 'N' covers 256 times as many ticks as a slot of level
+// 'N - 1'.  When the current tick reaches a slot of a level above 0, the
+// events in that slot are redistributed ("cascaded") into the lower levels.
+// An event is therefore moved at most three times before it expires, which
+// makes the amortized cost of dispatching an event constant as well.  Events
+// that are more than 2^32 ticks in the future are parked in the top level and
+// re-filed when the wheel comes around to them.  The dispatcher thread
+// sleeps until the next tick at which an event expires or a slot needs to be
+// cascaded, which it locates using a bitmap of the occupied slots of each
+// level.
+//
+///Order of Execution of Events
+///----------------------------
+// An event is never dispatched before its scheduled time, and is dispatched as
+// soon as possible after the end of the tick in which that time falls.
+// Events are dispatched in order of the ticks in which they expire; events
+// that expire within the same tick are dispatched in the order in which they
+// were (most recently) filed into the wheel.  An event scheduled for a time
+// that has already passed is dispatched as soon as possible.  A recurring
+// event whose interval is smaller than the tick resolution is dispatched at
+// most once per tick.
+//
+// Note that, as with the other schedulers of this package, it is possible to
+// schedule events in a scheduler that has not been started yet.
+//
+///Thread Safety
+///-------------
+// The 'bdlmt::TimerWheelEventScheduler' class is both *fully thread-safe*
+// (i.e., all non-creator methods can correctly execute concurrently), and is
+// *thread-enabled* (i.e., the class does not function correctly in a
+// non-multi-threading environment).  See 'bsldoc_glossary' for complete
+// definitions of *fully thread-safe* and *thread-enabled*.
+//
+///Supported Clock-Types
+///---------------------
+// The component 'bsls::SystemClockType' supplies the enumeration indicating
+// the system clock on which times supplied to other methods should be based.
+// If the clock type indicated at construction is
+// 'bsls::SystemClockType::e_REALTIME', time should be expressed as an absolute
+// offset since 00:00:00 UTC, January 1, 1970.  If the clock type indicated at
+// construction is 'bsls::SystemClockType::e_MONOTONIC', time should be
+// expressed as an absolute offset since the epoch of this clock.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Connection Timeouts
+/// - - - - - - - - - - - - - - -
+// A server closes a connection if no data arrive on it within a timeout.
+// Every arriving message pushes the timeout of its connection back, so the
+// timers are rescheduled far more often than they expire.
+//
+// First, we define a class that closes a connection:
+//..
+//  class my_Server {
+//      // This class closes connections on which no data arrive within a
+//      // timeout.
+//
+//      // DATA
+//      bdlmt::TimerWheelEventScheduler d_scheduler;  // timeout scheduler
+//      bsls::TimeInterval              d_ioTimeout;  // timeout
+//      bsls::AtomicInt                 d_numClosed;  // number of timed-out
+//                                                    // connections
+//
+//      // PRIVATE MANIPULATORS
+//      void closeConnection(int connectionId)
+//          // Close the connection having the specified 'connectionId'.
+//      {
+//          (void)connectionId;
+//          ++d_numClosed;
+//      }
+//
+//    public:
+//      // CREATORS
+//      explicit my_Server(const bsls::TimeInterval& ioTimeout)
+//          // Create a server that closes connections on which no data
+//          // arrive within the specified 'ioTimeout'.
+//      : d_scheduler(bsls::SystemClockType::e_MONOTONIC)
+//      , d_ioTimeout(ioTimeout)
+//      , d_numClosed(0)
+//      {
+//          d_scheduler.start();
+//      }
+//
+//      ~my_Server()
+//          // Destroy this server.
+//      {
+//          d_scheduler.stop();
+//      }
+//
+//      // MANIPULATORS
+//      bdlmt::TimerWheelEventScheduler::Handle newConnection(
+//                                                           int connectionId)
+//          // Schedule the timeout of the connection having the specified
+//          // 'connectionId', and return the handle of the timeout event.
+//      {
+//          return d_scheduler.scheduleEvent(
+//                   bsls::SystemTime::nowMonotonicClock() + d_ioTimeout,
+//                   bdlf::BindUtil::bind(&my_Server::closeConnection,
+//                                        this,
+//                                        connectionId));
+//      }
+//
+//      int dataAvailable(bdlmt::TimerWheelEventScheduler::Handle timer)
+//          // Push back the timeout of the connection whose timeout event
+//          // has the specified 'timer' handle.  Return 0 on success, and a
+//          // non-zero value if the connection has already timed out.
+//      {
+//          return d_scheduler.rescheduleEvent(
+//                    timer,
+//                    bsls::SystemTime::nowMonotonicClock() + d_ioTimeout);
+//      }
+//
+//      // ACCESSORS
+//      int numClosed() const
+//          // Return the number of connections closed for timing out.
+//      {
+//          return d_numClosed;
+//      }
+//  };
+//..
+// Then, we open two connections with a timeout of 100 milliseconds:
+//..
+//  my_Server server(bsls::TimeInterval(0.1));
+//
+//  bdlmt::TimerWheelEventScheduler::Handle timer1 = server.newConnection(1);
+//  bdlmt::TimerWheelEventScheduler::Handle timer2 = server.newConnection(2);
+//..
+// Next, data keep arriving on the first connection only:
+//..
+//  for (int i = 0; i < 5; ++i) {
+//      bslmt::ThreadUtil::microSleep(40 * 1000);
+//      assert(0 == server.dataAvailable(timer1));
+//  }
+//..
+// Finally, we observe that the second connection has timed out, and can no
+// longer be rescheduled, while the first one is still open:
+//..
+//  assert(1 == server.numClosed());
+//  assert(0 != server.dataAvailable(timer2));
+//  assert(0 == server.dataAvailable(timer1));
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_CONDITION
+#include <bslmt_condition.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_MUTEX
+#include <bslmt_mutex.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_THREADATTRIBUTES
+#include <bslmt_threadattributes.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_THREADUTIL
+#include <bslmt_threadutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_SYSTEMCLOCKTYPE
+#include <bsls_systemclocktype.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TIMEINTERVAL
+#include <bsls_timeinterval.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_DEQUE
+#include <bsl_deque.h>
+#endif
+
+#ifndef INCLUDED_BSL_FUNCTIONAL
+#include <bsl_functional.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+struct TimerWheelEventSchedulerDispatcher;
+
+                   // ====================================
+                   // class TimerWheelEventScheduler_Wheel
+                   // ====================================
+
+class TimerWheelEventScheduler_Wheel {
+    // This component-private class implements the hierarchical timing wheel
+    // holding the events of a 'TimerWheelEventScheduler'.  All times are
+    // expressed in microseconds since the epoch of the clock of the
+    // scheduler.  This class is *not* thread-safe.
+
+  public:
+    // TYPES
+    typedef bsl::function<void()> Callback;
+        // 'Callback' is an alias for the type of the callback of an event.
+
+    typedef bsls::Types::Int64     Handle;
+        // 'Handle' is an alias for the type identifying an event: the lower
+        // 32 bits hold the index of the node of the event, and the upper 32
+        // bits hold the generation of that node.
+
+    enum {
+        k_NUM_LEVELS      = 4,    // number of levels of the wheel
+        k_BITS_PER_LEVEL  = 8,    // 'log2' of the number of slots per level
+        k_SLOTS_PER_LEVEL = 1 << k_BITS_PER_LEVEL,
+        k_NUM_SLOTS       = k_NUM_LEVELS * k_SLOTS_PER_LEVEL,
+        k_WORDS_PER_LEVEL = k_SLOTS_PER_LEVEL / 64
+                                  // number of words in the occupancy bitmap
+                                  // of a level
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef bsls::Types::Int64  Int64;
+    typedef bsls::Types::Uint64 Uint64;
+
+    struct Node {
+        // This 'struct' holds the bookkeeping data of an event.  The callback
+        // of the event is held separately, at the same index, in
+        // 'd_callbacks'.
+
+        Int64    d_time;        // time of the event
+        Int64    d_interval;    // interval of a recurring event, 0 otherwise
+        Int64    d_tick;        // tick in which 'd_time' falls
+        int      d_prev;        // previous node in the slot
+        int      d_next;        // next node in the slot, or in the free list
+        int      d_slot;        // index of the slot holding this node, or -1
+                                // if this node is free
+        unsigned d_generation;  // incremented each time this node is freed
+    };
+
+    // DATA
+    Int64                 d_tickResolution;  // tick resolution
+
+    Int64                 d_currentTick;     // next tick to be processed
+
+    int                   d_slots[k_NUM_SLOTS];
+                                             // index of the first node of
+                                             // each slot, or -1 if the slot is
+                                             // empty
+
+    Uint64                d_occupied[k_NUM_LEVELS][k_WORDS_PER_LEVEL];
+                                             // bitmap of the non-empty slots
+                                             // of each level
+
+    bsl::vector<Node>     d_nodes;           // bookkeeping data of the
+                                             // events
+
+    bsl::deque<Callback>  d_callbacks;       // callbacks of the events (a
+                                             // deque, so that growing it does
+                                             // not copy the callbacks)
+
+    int                   d_freeList;        // index of the first free node,
+                                             // or -1 if there is none
+
+    int                   d_numEvents;       // number of events in the wheel
+
+    int                   d_numRecurringEvents;
+                                             // number of recurring events in
+                                             // the wheel
+
+    // PRIVATE CLASS METHODS
+    static int findNextOccupied(const Uint64 *bitmap, int start);
+        // Return the index of the first set bit of the specified 'bitmap' of
+        // 'k_SLOTS_PER_LEVEL' bits at or after the specified 'start' index,
+        // wrapping around to the start of the bitmap, or -1 if no bit is set.
+
+    // PRIVATE MANIPULATORS
+    int allocateNode();
+        // Return the index of a free node, taken from the free list if it is
+        // not empty, or appended to the wheel otherwise.
+
+    void cascade(int level, int slot);
+        // Redistribute the nodes of the specified 'slot' of the specified
+        // 'level' into the levels appropriate for the current tick.
+
+    void expire(bsl::vector<Callback> *callbacks);
+        // Remove the nodes expiring in the current tick from the wheel, append
+        // their callbacks to the specified 'callbacks', re-file the recurring
+        // ones at their next occurrence, free the others, and advance the
+        // current tick.
+
+    void freeNode(int index);
+        // Return the node at the specified 'index' to the free list, and
+        // invalidate all the handles that refer to it.
+
+    void insert(int index);
+        // File the node at the specified 'index' into the slot corresponding
+        // to its tick.
+
+    void link(int index, int slot);
+        // Append the node at the specified 'index' to the specified 'slot'.
+
+    int takeSlot(int slot);
+        // Empty the specified 'slot', and return the index of its first node,
+        // whose nodes are linked in order through 'd_next' and terminated by
+        // -1, or -1 if 'slot' was empty.
+
+    void unlink(int index);
+        // Remove the node at the specified 'index' from its slot.
+
+    // PRIVATE ACCESSORS
+    int validIndex(Handle handle) const;
+        // Return the index of the node of the event identified by the
+        // specified 'handle', or -1 if 'handle' does not identify an event in
+        // this wheel.
+
+    Int64 timeToTick(Int64 time) const;
+        // Return the tick in which the specified 'time' falls, i.e., the
+        // smallest tick whose end is at or after 'time'.
+
+  private:
+    // NOT IMPLEMENTED
+    TimerWheelEventScheduler_Wheel(const TimerWheelEventScheduler_Wheel&);
+    TimerWheelEventScheduler_Wheel& operator=(
+                                        const TimerWheelEventScheduler_Wheel&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TimerWheelEventScheduler_Wheel,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    TimerWheelEventScheduler_Wheel(Int64             tickResolution,
+                                   Int64             currentTime,
+                                   bslma::Allocator *basicAllocator = 0);
+        // Create an empty timing wheel having the specified 'tickResolution'
+        // whose first tick to process is the one in which the specified
+        // 'currentTime' falls.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // '0 < tickResolution'.
+
+    // MANIPULATORS
+    Handle add(Int64 time, Int64 interval, const Callback& callback);
+        // Add to this wheel an event invoking the specified 'callback' at the
+        // specified 'time' and, if the specified 'interval' is not 0, every
+        // 'interval' thereafter.  Return the handle of the event.  The
+        // behavior is undefined unless '0 <= interval'.
+
+    int advance(Int64 now, bsl::vector<Callback> *callbacks);
+        // Process all the ticks that end at or before the specified 'now',
+        // appending to the specified 'callbacks', in the order in which they
+        // should be dispatched, the callbacks of the events expiring in these
+        // ticks.  Return the number of callbacks appended.  Non-recurring
+        // events are removed from this wheel; recurring ones are re-filed at
+        // their next occurrence.  The behavior is undefined unless
+        // 'callbacks' uses the same allocator as this wheel.
+
+    int remove(Handle handle);
+        // Remove from this wheel the event identified by the specified
+        // 'handle'.  Return 0 on success, and a non-zero value if 'handle'
+        // does not identify an event in this wheel.
+
+    void removeAll();
+        // Remove all the events from this wheel.
+
+    int update(Handle handle, Int64 newTime);
+        // Move the event identified by the specified 'handle' to the specified
+        // 'newTime' (the next occurrence of a recurring event).  Return 0 on
+        // success, and a non-zero value if 'handle' does not identify an
+        // event in this wheel.
+
+    // ACCESSORS
+    int nextProcessingTime(Int64 *time) const;
+        // Load into the specified 'time' the end of the next tick at which an
+        // event expires or a slot must be cascaded, and return 0; or return a
+        // non-zero value, with no effect on 'time', if this wheel is empty.
+        // Note that no event expires before the loaded 'time'.
+
+    int numEvents() const;
+        // Return the number of events in this wheel.
+
+    int numRecurringEvents() const;
+        // Return the number of recurring events in this wheel.
+
+    Int64 tickResolution() const;
+        // Return the tick resolution of this wheel.
+};
+
+                      // ==============================
+                      // class TimerWheelEventScheduler
+                      // ==============================
+
+class TimerWheelEventScheduler {
+    // This class provides a thread-safe event scheduler backed by a
+    // hierarchical timing wheel.  'scheduleEvent' and 'scheduleRecurringEvent'
+    // schedule an event, returning a handle of type
+    // 'TimerWheelEventScheduler::Handle', which can be used to reschedule the
+    // event (by invoking 'rescheduleEvent') or to cancel it (by invoking
+    // 'cancelEvent').  'start' must be invoked to start dispatching the
+    // callbacks, and 'stop' stops the dispatching of the callbacks without
+    // removing the pending events.
+
+  public:
+    // TYPES
+    typedef bsls::Types::Int64                                Handle;
+        // Defines a type alias for a handle that identifies a scheduled
+        // event.
+
+    typedef bsl::function<void(const bsl::function<void()>&)> Dispatcher;
+        // Defines a type alias for the dispatcher functor type.
+
+    // CONSTANTS
+    enum {
+        e_INVALID_HANDLE = -1  // value of an invalid event handle
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef TimerWheelEventScheduler_Wheel Wheel;
+    typedef Wheel::Callback                Callback;
+
+    // DATA
+    bslma::Allocator          *d_allocator_p;       // memory allocator (held)
+
+    Wheel                      d_wheel;             // events (guarded by
+                                                    // 'd_mutex')
+
+    bsl::vector<Callback>      d_pendingCallbacks;  // callbacks being
+                                                    // dispatched (used only by
+                                                    // the dispatcher thread)
+
+    bsls::Types::Int64         d_wakeTime;          // time at which the
+                                                    // dispatcher thread is due
+                                                    // to wake up (guarded by
+                                                    // 'd_mutex')
+
+    bslmt::Mutex               d_dispatcherMutex;   // serialize starting and
+                                                    // stopping the dispatcher
+                                                    // thread
+
+    mutable bslmt::Mutex       d_mutex;             // mutex guarding the wheel
+
+    bslmt::Condition           d_condition;         // condition used to wake
+                                                    // up the dispatcher thread
+
+    Dispatcher                 d_dispatcherFunctor; // functor used to dispatch
+                                                    // events
+
+    bsls::AtomicInt64          d_dispatcherId;      // id of the dispatcher
+                                                    // thread
+
+    bslmt::ThreadUtil::Handle  d_dispatcherThread;  // handle of the dispatcher
+                                                    // thread
+
+    bsls::AtomicInt            d_running;           // indicates if the
+                                                    // scheduler is running
+
+    bsls::AtomicInt            d_iterations;        // dispatcher cycle
+                                                    // iteration number
+
+    bsls::SystemClockType::Enum
+                               d_clockType;         // clock type used
+
+    // FRIENDS
+    friend struct TimerWheelEventSchedulerDispatcher;
+
+    // NOT IMPLEMENTED
+    TimerWheelEventScheduler(const TimerWheelEventScheduler&);
+    TimerWheelEventScheduler& operator=(const TimerWheelEventScheduler&);
+
+    // PRIVATE MANIPULATORS
+    void wakeDispatcher(bsls::Types::Int64 time);
+        // Wake up the dispatcher thread if it is due to wake up after the
+        // specified 'time' (expressed in microseconds).  The behavior is
+        // undefined unless 'd_mutex' is locked by the calling thread.
+
+    void yieldToDispatcher();
+        // Repeatedly wake up the dispatcher thread until it noticeably starts
+        // running, unless invoked from the dispatcher thread.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TimerWheelEventScheduler,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit TimerWheelEventScheduler(bslma::Allocator *basicAllocator = 0);
+        // Construct an event scheduler using the default dispatcher functor,
+        // a tick resolution of one millisecond, and the realtime clock epoch
+        // for all time intervals (see {Supported Clock-Types} in the component
+        // documentation).  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    explicit TimerWheelEventScheduler(
+                              bsls::SystemClockType::Enum  clockType,
+                              bslma::Allocator            *basicAllocator = 0);
+        // Construct an event scheduler using the default dispatcher functor,
+        // a tick resolution of one millisecond, and the specified 'clockType'
+        // to indicate the epoch used for all time intervals.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    explicit TimerWheelEventScheduler(
+                                 const Dispatcher&  dispatcherFunctor,
+                                 bslma::Allocator  *basicAllocator = 0);
+        // Construct an event scheduler using the specified
+        // 'dispatcherFunctor', a tick resolution of one millisecond, and the
+        // realtime clock epoch for all time intervals.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    TimerWheelEventScheduler(const Dispatcher&            dispatcherFunctor,
+                             bsls::SystemClockType::Enum  clockType,
+                             bslma::Allocator            *basicAllocator = 0);
+        // Construct an event scheduler using the specified
+        // 'dispatcherFunctor', a tick resolution of one millisecond, and the
+        // specified 'clockType' to indicate the epoch used for all time
+        // intervals.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    TimerWheelEventScheduler(const bsls::TimeInterval&    tickResolution,
+                             const Dispatcher&            dispatcherFunctor,
+                             bsls::SystemClockType::Enum  clockType,
+                             bslma::Allocator            *basicAllocator = 0);
+        // Construct an event scheduler using the specified 'tickResolution',
+        // the specified 'dispatcherFunctor', and the specified 'clockType' to
+        // indicate the epoch used for all time intervals.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // 0, the currently installed default allocator is used.  The behavior
+        // is undefined unless 'tickResolution' is at least one microsecond.
+
+    ~TimerWheelEventScheduler();
+        // Stop this scheduler, discard all the unprocessed events and destroy
+        // this object.
+
+    // MANIPULATORS
+    int start();
+        // Begin dispatching events on this scheduler using default attributes
+        // for the dispatcher thread.  Return 0 on success, and a non-zero
+        // value otherwise.  If this scheduler has already started then this
+        // invocation has no effect and 0 is returned.  The behavior is
+        // undefined if this method is invoked in the dispatcher thread.  Note
+        // that any event whose time has already passed is pending and will be
+        // dispatched immediately.
+
+    int start(const bslmt::ThreadAttributes& threadAttributes);
+        // Begin dispatching events on this scheduler using the specified
+        // 'threadAttributes' for the dispatcher thread (except that the
+        // DETACHED attribute is ignored).  Return 0 on success, and a non-zero
+        // value otherwise.  If this scheduler has already started then this
+        // invocation has no effect and 0 is returned.  The behavior is
+        // undefined if this method is invoked in the dispatcher thread.  Note
+        // that any event whose time has already passed is pending and will be
+        // dispatched immediately.
+
+    void stop();
+        // End the dispatching of events on this scheduler (but do not remove
+        // any pending events), and wait for the callbacks currently being
+        // dispatched to complete.  If the scheduler is already stopped then
+        // this method has no effect.  This scheduler can be restarted by
+        // invoking 'start'.  The behavior is undefined if this method is
+        // invoked from the dispatcher thread.
+
+    Handle scheduleEvent(const bsls::TimeInterval&    time,
+                         const bsl::function<void()>& callback);
+        // Schedule the specified 'callback' to be dispatched at the specified
+        // 'time', and return a handle that can be used to reschedule or cancel
+        // the event.  The 'time' is an absolute time represented as an
+        // interval from the epoch of the clock indicated at construction.
+
+    Handle scheduleRecurringEvent(
+               const bsls::TimeInterval&    interval,
+               const bsl::function<void()>& callback,
+               const bsls::TimeInterval&    startTime = bsls::TimeInterval(0));
+        // Schedule a recurring event that invokes the specified 'callback' at
+        // every specified 'interval', starting at the optionally specified
+        // 'startTime', and return a handle that can be used to reschedule or
+        // cancel the event.  If no start time is specified, it is assumed to
+        // be the 'interval' time from now.  The 'startTime' is an absolute
+        // time represented as an interval from the epoch of the clock
+        // indicated at construction.  The behavior is undefined unless
+        // 'interval' is positive.
+
+    int rescheduleEvent(Handle                    handle,
+                        const bsls::TimeInterval& newTime,
+                        bool                      wait = false);
+        // Reschedule the event (or, for a recurring event, the next
+        // occurrence of the event) having the specified 'handle' at the
+        // specified 'newTime'.  If the optionally specified 'wait' is true,
+        // then ensure that an event that could not be rescheduled because it
+        // is being dispatched has been dispatched before the call returns.
+        // Return 0 on success, and a non-zero value if the 'handle' is invalid
+        // *or* if the event has already been dispatched or cancelled.  If this
+        // method is invoked from the dispatcher thread then 'wait' is ignored
+        // to avoid deadlock.
+
+    int cancelEvent(Handle handle, bool wait = false);
+        // Cancel the event having the specified 'handle'.  If the optionally
+        // specified 'wait' is true, then ensure that the callbacks of the
+        // event that are being dispatched have completed before the call
+        // returns.  Return 0 on successful cancellation, and a non-zero value
+        // if the 'handle' is invalid *or* if the event has already been
+        // dispatched or cancelled.  If this method is invoked from the
+        // dispatcher thread then 'wait' is ignored to avoid deadlock.  Note
+        // that an occurrence of a recurring event that is being dispatched
+        // when the event is cancelled still completes.
+
+    void cancelAllEvents(bool wait = false);
+        // Cancel all the events, recurring and non-recurring.  If the
+        // optionally specified 'wait' is true, then ensure that the callbacks
+        // being dispatched have completed before the call returns.  If this
+        // method is invoked from the dispatcher thread then 'wait' is ignored
+        // to avoid deadlock.
+
+    // ACCESSORS
+    bsls::SystemClockType::Enum clockType() const;
+        // Return the value of the clock type that this object was created
+        // with.
+
+    int numEvents() const;
+        // Return a *snapshot* of the number of events, recurring and
+        // non-recurring, scheduled in this scheduler.  Note that the events
+        // being dispatched are not counted, unless they are recurring.
+
+    int numRecurringEvents() const;
+        // Return a *snapshot* of the number of recurring events scheduled in
+        // this scheduler.
+
+    bsls::TimeInterval tickResolution() const;
+        // Return the tick resolution of this scheduler.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                   // ------------------------------------
+                   // class TimerWheelEventScheduler_Wheel
+                   // ------------------------------------
+
+// ACCESSORS
+inline
+int TimerWheelEventScheduler_Wheel::numEvents() const
+{
+    return d_numEvents;
+}
+
+inline
+int TimerWheelEventScheduler_Wheel::numRecurringEvents() const
+{
+    return d_numRecurringEvents;
+}
+
+inline
+bsls::Types::Int64 TimerWheelEventScheduler_Wheel::tickResolution() const
+{
+    return d_tickResolution;
+}
+
+                      // ------------------------------
+                      // class TimerWheelEventScheduler
+                      // ------------------------------
+
+// ACCESSORS
+inline
+bsls::SystemClockType::Enum TimerWheelEventScheduler::clockType() const
+{
+    return d_clockType;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
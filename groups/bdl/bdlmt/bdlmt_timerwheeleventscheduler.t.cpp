@@ -0,0 +1,1279 @@
+// bdlmt_timerwheeleventscheduler.t.cpp                               -*-C++-*-
+#include <bdlmt_timerwheeleventscheduler.h>
+
+#include <bdlmt_eventscheduler.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bdlf_bind.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_systemtime.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              OVERVIEW
+// The component under test is an event scheduler whose events are held in a
+// hierarchical timing wheel, implemented by the component-private class
+// 'bdlmt::TimerWheelEventScheduler_Wheel'.  The wheel is not thread-safe and
+// is driven by explicit times, so we test it deterministically first, against
+// randomly generated events spanning all the levels of the wheel (and
+// beyond), verifying that every event is dispatched in the first call to
+// 'advance' whose time reaches the end of the tick of the event, in order.
+// We then test the scheduler itself using the system clock, with timing
+// margins generous enough for loaded test machines.
+//
+// In addition to positive test cases (run in the nightly builds), a negative
+// test case -1 can be run manually to compare the cost of scheduling,
+// rescheduling, and cancelling a large number of events against
+// 'bdlmt::EventScheduler'.
+// ----------------------------------------------------------------------------
+// TimerWheelEventScheduler_Wheel
+// [ 2] TimerWheelEventScheduler_Wheel(Int64, Int64, Allocator *);
+// [ 2] Handle add(Int64 time, Int64 interval, const Callback& callback);
+// [ 2] int remove(Handle handle);
+// [ 2] void removeAll();
+// [ 2] int update(Handle handle, Int64 newTime);
+// [ 3] int advance(Int64 now, bsl::vector<Callback> *callbacks);
+// [ 4] int nextProcessingTime(Int64 *time) const;
+// [ 2] int numEvents() const;
+// [ 2] int numRecurringEvents() const;
+// [ 2] Int64 tickResolution() const;
+//
+// TimerWheelEventScheduler
+// [ 5] TimerWheelEventScheduler(Allocator *);
+// [ 5] TimerWheelEventScheduler(SystemClockType::Enum, Allocator *);
+// [ 5] TimerWheelEventScheduler(const Dispatcher&, Allocator *);
+// [ 5] TimerWheelEventScheduler(const Dispatcher&, ClockType, Alloc *);
+// [ 5] TimerWheelEventScheduler(const TimeInterval&, ..., Allocator *);
+// [ 5] ~TimerWheelEventScheduler();
+// [ 5] int start();
+// [ 5] int start(const bslmt::ThreadAttributes& threadAttributes);
+// [ 5] void stop();
+// [ 5] Handle scheduleEvent(const TimeInterval&, const function&);
+// [ 5] Handle scheduleRecurringEvent(const TimeInterval&, ...);
+// [ 5] int rescheduleEvent(Handle, const TimeInterval&, bool);
+// [ 5] int cancelEvent(Handle handle, bool wait = false);
+// [ 5] void cancelAllEvents(bool wait = false);
+// [ 5] bsls::SystemClockType::Enum clockType() const;
+// [ 5] int numEvents() const;
+// [ 5] int numRecurringEvents() const;
+// [ 5] bsls::TimeInterval tickResolution() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] TESTING RECURRING EVENTS IN THE WHEEL
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE COMPARISON WITH 'bdlmt::EventScheduler'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::TimerWheelEventScheduler       Obj;
+typedef bdlmt::TimerWheelEventScheduler_Wheel Wheel;
+typedef Wheel::Callback                       Callback;
+typedef bsls::Types::Int64                    Int64;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS  FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void recordId(bsl::vector<int> *ids, int id)
+    // Append the specified 'id' to the specified 'ids'.
+{
+    ids->push_back(id);
+}
+
+void incrementCounter(bsls::AtomicInt *counter)
+    // Increment the specified 'counter'.
+{
+    ++*counter;
+}
+
+void noop()
+    // Do nothing.
+{
+}
+
+void countingDispatcher(bsls::AtomicInt              *numDispatched,
+                        const bsl::function<void()>&  callback)
+    // Increment the specified 'numDispatched' and invoke the specified
+    // 'callback'.
+{
+    ++*numDispatched;
+    callback();
+}
+
+int runCallbacks(bsl::vector<Callback> *callbacks)
+    // Invoke, in order, and then clear the specified 'callbacks', and return
+    // the number of callbacks invoked.
+{
+    const int result = static_cast<int>(callbacks->size());
+    for (bsl::size_t i = 0; i < callbacks->size(); ++i) {
+        (*callbacks)[i]();
+    }
+    callbacks->clear();
+    return result;
+}
+
+Int64 tickEnd(Int64 time, Int64 resolution, Int64 start)
+    // Return the end of the tick in which the specified 'time' falls for the
+    // specified tick 'resolution', assuming that the wheel was created at the
+    // specified 'start' time.
+{
+    const Int64 firstEnd = (start + resolution - 1) / resolution * resolution;
+    const Int64 end      = (time  + resolution - 1) / resolution * resolution;
+    return bsl::max(end, firstEnd);
+}
+
+unsigned nextRandom(unsigned *seed)
+    // Return the next value of a linear congruential pseudo-random sequence
+    // whose state is held in the specified 'seed'.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return *seed >> 8;
+}
+
+Int64 randomDelay(unsigned *seed, Int64 maxDelay)
+    // Return a pseudo-random value in '[0 .. maxDelay]' using the specified
+    // 'seed'.
+{
+    const Int64 high = nextRandom(seed);
+    const Int64 r    = high << 24 | static_cast<Int64>(nextRandom(seed));
+    return r % (maxDelay + 1);
+}
+
+bool waitUntil(const bsls::AtomicInt& counter, int value, int milliseconds)
+    // Wait until the specified 'counter' reaches at least the specified
+    // 'value', for at most the specified 'milliseconds'.  Return 'true' if
+    // 'counter' reached 'value', and 'false' otherwise.
+{
+    for (int i = 0; i < milliseconds; i += 5) {
+        if (counter >= value) {
+            return true;                                              // RETURN
+        }
+        bslmt::ThreadUtil::microSleep(5 * 1000);
+    }
+    return counter >= value;
+}
+
+bsls::TimeInterval nowRealtime()
+    // Return the current time of the realtime clock.
+{
+    return bsls::SystemTime::nowRealtimeClock();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Connection Timeouts
+/// - - - - - - - - - - - - - - -
+// A server closes a connection if no data arrive on it within a timeout.
+// Every arriving message pushes the timeout of its connection back, so the
+// timers are rescheduled far more often than they expire.
+//
+// First, we define a class that closes a connection:
+//..
+    class my_Server {
+        // This class closes connections on which no data arrive within a
+        // timeout.
+
+        // DATA
+        bdlmt::TimerWheelEventScheduler d_scheduler;  // timeout scheduler
+        bsls::TimeInterval              d_ioTimeout;  // timeout
+        bsls::AtomicInt                 d_numClosed;  // number of timed-out
+                                                      // connections
+
+        // PRIVATE MANIPULATORS
+        void closeConnection(int connectionId)
+            // Close the connection having the specified 'connectionId'.
+        {
+            (void)connectionId;
+            ++d_numClosed;
+        }
+
+      public:
+        // CREATORS
+        explicit my_Server(const bsls::TimeInterval& ioTimeout)
+            // Create a server that closes connections on which no data
+            // arrive within the specified 'ioTimeout'.
+        : d_scheduler(bsls::SystemClockType::e_MONOTONIC)
+        , d_ioTimeout(ioTimeout)
+        , d_numClosed(0)
+        {
+            d_scheduler.start();
+        }
+
+        ~my_Server()
+            // Destroy this server.
+        {
+            d_scheduler.stop();
+        }
+
+        // MANIPULATORS
+        bdlmt::TimerWheelEventScheduler::Handle newConnection(
+                                                             int connectionId)
+            // Schedule the timeout of the connection having the specified
+            // 'connectionId', and return the handle of the timeout event.
+        {
+            return d_scheduler.scheduleEvent(
+                     bsls::SystemTime::nowMonotonicClock() + d_ioTimeout,
+                     bdlf::BindUtil::bind(&my_Server::closeConnection,
+                                          this,
+                                          connectionId));
+        }
+
+        int dataAvailable(bdlmt::TimerWheelEventScheduler::Handle timer)
+            // Push back the timeout of the connection whose timeout event
+            // has the specified 'timer' handle.  Return 0 on success, and a
+            // non-zero value if the connection has already timed out.
+        {
+            return d_scheduler.rescheduleEvent(
+                      timer,
+                      bsls::SystemTime::nowMonotonicClock() + d_ioTimeout);
+        }
+
+        // ACCESSORS
+        int numClosed() const
+            // Return the number of connections closed for timing out.
+        {
+            return d_numClosed;
+        }
+    };
+//..
+
+}  // close namespace USAGE_EXAMPLE
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVerbose);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace USAGE_EXAMPLE;
+
+// Then, we open two connections with a timeout of 100 milliseconds:
+//..
+    my_Server server(bsls::TimeInterval(0.1));
+
+    bdlmt::TimerWheelEventScheduler::Handle timer1 = server.newConnection(1);
+    bdlmt::TimerWheelEventScheduler::Handle timer2 = server.newConnection(2);
+//..
+// Next, data keep arriving on the first connection only:
+//..
+    for (int i = 0; i < 5; ++i) {
+        bslmt::ThreadUtil::microSleep(40 * 1000);
+        ASSERT(0 == server.dataAvailable(timer1));
+    }
+//..
+// Finally, we observe that the second connection has timed out, and can no
+// longer be rescheduled, while the first one is still open:
+//..
+    ASSERT(1 == server.numClosed());
+    ASSERT(0 != server.dataAvailable(timer2));
+    ASSERT(0 == server.dataAvailable(timer1));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING THE SCHEDULER
+        //
+        // Concerns:
+        //: 1 Events are dispatched, by the dispatcher functor if one is
+        //:   supplied, no sooner than their time, and soon after it.
+        //:
+        //: 2 Events scheduled before 'start' are dispatched after 'start'.
+        //:
+        //: 3 Rescheduling moves an event, and fails for an event that has
+        //:   been dispatched.
+        //:
+        //: 4 Cancelling removes an event, and fails for an event that has
+        //:   been dispatched or cancelled.
+        //:
+        //: 5 Recurring events are dispatched repeatedly until cancelled, and
+        //:   'cancelEvent' with 'wait' returns only after the dispatching of
+        //:   the event has stopped.
+        //:
+        //: 6 'cancelAllEvents' cancels all the events.
+        //:
+        //: 7 The accessors report the state of the scheduler, and the
+        //:   supplied allocator is used.
+        //
+        // Plan:
+        //: 1 Schedule, reschedule, and cancel events relative to the system
+        //:   clock, polling counters incremented by the callbacks with
+        //:   generous timeouts.  (C-1..7)
+        //
+        // Testing:
+        //   TimerWheelEventScheduler(Allocator *);
+        //   TimerWheelEventScheduler(SystemClockType::Enum, Allocator *);
+        //   TimerWheelEventScheduler(const Dispatcher&, Allocator *);
+        //   TimerWheelEventScheduler(const Dispatcher&, ClockType, Alloc *);
+        //   TimerWheelEventScheduler(const TimeInterval&, ..., Allocator *);
+        //   ~TimerWheelEventScheduler();
+        //   int start();
+        //   int start(const bslmt::ThreadAttributes& threadAttributes);
+        //   void stop();
+        //   Handle scheduleEvent(const TimeInterval&, const function&);
+        //   Handle scheduleRecurringEvent(const TimeInterval&, ...);
+        //   int rescheduleEvent(Handle, const TimeInterval&, bool);
+        //   int cancelEvent(Handle handle, bool wait = false);
+        //   void cancelAllEvents(bool wait = false);
+        //   bsls::SystemClockType::Enum clockType() const;
+        //   int numEvents() const;
+        //   int numRecurringEvents() const;
+        //   bsls::TimeInterval tickResolution() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING THE SCHEDULER" << endl
+                          << "=====================" << endl;
+
+        if (verbose) cout << "\tTesting creators and accessors." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(bsls::SystemClockType::e_REALTIME == X.clockType());
+            ASSERT(bsls::TimeInterval(0, 1000 * 1000) == X.tickResolution());
+            ASSERT(0 == X.numEvents());
+            ASSERT(0 == X.numRecurringEvents());
+
+            Obj mY(bsls::SystemClockType::e_MONOTONIC, &ta);
+            ASSERT(bsls::SystemClockType::e_MONOTONIC == mY.clockType());
+
+            bsls::AtomicInt numDispatched(0);
+            Obj::Dispatcher dispatcher = bdlf::BindUtil::bind(
+                                                       &countingDispatcher,
+                                                       &numDispatched,
+                                                       bdlf::PlaceHolders::_1);
+
+            Obj mZ(dispatcher, &ta);
+            ASSERT(bsls::SystemClockType::e_REALTIME == mZ.clockType());
+
+            Obj mW(dispatcher, bsls::SystemClockType::e_MONOTONIC, &ta);
+            ASSERT(bsls::SystemClockType::e_MONOTONIC == mW.clockType());
+
+            Obj mV(bsls::TimeInterval(0.01),
+                   dispatcher,
+                   bsls::SystemClockType::e_MONOTONIC,
+                   &ta);
+            ASSERT(bsls::TimeInterval(0.01) == mV.tickResolution());
+            ASSERT(bsls::SystemClockType::e_MONOTONIC == mV.clockType());
+
+            mX.scheduleEvent(nowRealtime() + 100, &noop);
+            mX.scheduleRecurringEvent(bsls::TimeInterval(100), &noop);
+            ASSERT(2 == X.numEvents());
+            ASSERT(1 == X.numRecurringEvents());
+
+            ASSERT(0 == mX.start());
+            ASSERT(0 == mX.start());
+            mX.stop();
+            mX.stop();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting dispatching." << endl;
+        {
+            bsls::AtomicInt numDispatched(0);
+            Obj mX(bdlf::BindUtil::bind(&countingDispatcher,
+                                        &numDispatched,
+                                        bdlf::PlaceHolders::_1),
+                   &ta);
+
+            bsls::AtomicInt counter(0);
+
+            // An event in the past, scheduled before 'start'.
+
+            mX.scheduleEvent(nowRealtime() - 1,
+                             bdlf::BindUtil::bind(&incrementCounter,
+                                                  &counter));
+
+            bslmt::ThreadAttributes attributes;
+            ASSERT(0 == mX.start(attributes));
+
+            ASSERT(waitUntil(counter, 1, 5000));
+            ASSERT(1 == numDispatched);
+
+            const bsls::TimeInterval start = nowRealtime();
+            mX.scheduleEvent(start + 0.1,
+                             bdlf::BindUtil::bind(&incrementCounter,
+                                                  &counter));
+            ASSERT(waitUntil(counter, 2, 5000));
+            ASSERT(nowRealtime() >= start + 0.1);
+            ASSERT(2 == numDispatched);
+            ASSERT(0 == mX.numEvents());
+
+            mX.stop();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting 'rescheduleEvent'." << endl;
+        {
+            Obj mX(&ta);
+            ASSERT(0 == mX.start());
+
+            bsls::AtomicInt counter(0);
+
+            const bsls::TimeInterval start = nowRealtime();
+            Obj::Handle handle = mX.scheduleEvent(
+                                   start + 0.05,
+                                   bdlf::BindUtil::bind(&incrementCounter,
+                                                        &counter));
+            ASSERT(0 == mX.rescheduleEvent(handle, start + 0.3));
+
+            // Wake the dispatcher early by scheduling an earlier event.
+
+            mX.scheduleEvent(start + 0.1,
+                             bdlf::BindUtil::bind(&incrementCounter,
+                                                  &counter));
+            ASSERT(waitUntil(counter, 1, 5000));
+            if (nowRealtime() < start + 0.3) {
+                ASSERT(1 == counter);
+            }
+            ASSERT(waitUntil(counter, 2, 5000));
+            ASSERT(nowRealtime() >= start + 0.3);
+
+            ASSERT(0 != mX.rescheduleEvent(handle, start + 1));
+            ASSERT(0 != mX.rescheduleEvent(handle, start + 1, true));
+            ASSERT(0 != mX.rescheduleEvent(Obj::e_INVALID_HANDLE, start));
+
+            mX.stop();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting 'cancelEvent'." << endl;
+        {
+            Obj mX(&ta);
+            ASSERT(0 == mX.start());
+
+            bsls::AtomicInt counter(0);
+
+            const bsls::TimeInterval start = nowRealtime();
+            Obj::Handle handle1 = mX.scheduleEvent(
+                                   start + 0.05,
+                                   bdlf::BindUtil::bind(&incrementCounter,
+                                                        &counter));
+            Obj::Handle handle2 = mX.scheduleEvent(
+                                   start + 0.1,
+                                   bdlf::BindUtil::bind(&incrementCounter,
+                                                        &counter));
+            ASSERT(0 == mX.cancelEvent(handle1));
+            ASSERT(0 != mX.cancelEvent(handle1));
+            ASSERT(1 == mX.numEvents());
+
+            ASSERT(waitUntil(counter, 1, 5000));
+            bslmt::ThreadUtil::microSleep(100 * 1000);
+            ASSERT(1 == counter);
+
+            ASSERT(0 != mX.cancelEvent(handle2, true));
+            ASSERT(0 != mX.cancelEvent(Obj::e_INVALID_HANDLE));
+
+            mX.stop();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting recurring events." << endl;
+        {
+            Obj mX(&ta);
+            ASSERT(0 == mX.start());
+
+            bsls::AtomicInt counter(0);
+
+            Obj::Handle handle = mX.scheduleRecurringEvent(
+                                   bsls::TimeInterval(0.02),
+                                   bdlf::BindUtil::bind(&incrementCounter,
+                                                        &counter));
+            ASSERT(1 == mX.numRecurringEvents());
+            ASSERT(waitUntil(counter, 3, 5000));
+
+            ASSERT(0 == mX.cancelEvent(handle, true));
+            ASSERT(0 == mX.numRecurringEvents());
+            ASSERT(0 == mX.numEvents());
+
+            const int value = counter;
+            bslmt::ThreadUtil::microSleep(100 * 1000);
+            ASSERT(value == counter);
+
+            mX.stop();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting 'cancelAllEvents'." << endl;
+        {
+            Obj mX(&ta);
+            ASSERT(0 == mX.start());
+
+            bsls::AtomicInt counter(0);
+
+            const bsls::TimeInterval start = nowRealtime();
+            for (int i = 0; i < 100; ++i) {
+                mX.scheduleEvent(start + 0.1 + 0.001 * i,
+                                 bdlf::BindUtil::bind(&incrementCounter,
+                                                      &counter));
+            }
+            mX.scheduleRecurringEvent(bsls::TimeInterval(0.01),
+                                      bdlf::BindUtil::bind(&incrementCounter,
+                                                           &counter));
+            ASSERT(101 == mX.numEvents());
+
+            mX.cancelAllEvents(true);
+            ASSERT(0 == mX.numEvents());
+            ASSERT(0 == mX.numRecurringEvents());
+
+            const int value = counter;
+            bslmt::ThreadUtil::microSleep(300 * 1000);
+            ASSERT(value == counter);
+
+            mX.stop();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING RECURRING EVENTS IN THE WHEEL
+        //
+        // Concerns:
+        //: 1 'nextProcessingTime' fails on an empty wheel.
+        //:
+        //: 2 No event expires before the time loaded by 'nextProcessingTime',
+        //:   and the wheel can be driven solely by 'nextProcessingTime'.
+        //:
+        //: 3 A recurring event is dispatched once for each of its
+        //:   occurrences, and stays in the wheel.
+        //:
+        //: 4 Events updated or removed while the wheel is advancing are
+        //:   dispatched at their new time or not at all.
+        //
+        // Plan:
+        //: 1 Invoke 'nextProcessingTime' on an empty wheel.  (C-1)
+        //:
+        //: 2 Fill a wheel with events spanning all its levels, and repeatedly
+        //:   advance it to just before, and then to, the time loaded by
+        //:   'nextProcessingTime', verifying the dispatched events.  (C-2)
+        //:
+        //: 3 Advance a wheel holding a recurring event one tick at a time,
+        //:   and count the occurrences.  (C-3)
+        //:
+        //: 4 Update and remove some events after advancing part way, and
+        //:   verify the events dispatched at the end.  (C-4)
+        //
+        // Testing:
+        //   int nextProcessingTime(Int64 *time) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING RECURRING EVENTS IN THE WHEEL" << endl
+                          << "=====================================" << endl;
+
+        const Int64 RES   = 10;
+        const Int64 START = 1000005;
+
+        if (verbose) cout << "\tTesting 'nextProcessingTime'." << endl;
+        {
+            Wheel mX(RES, START, &ta);  const Wheel& X = mX;
+
+            Int64 time = 17;
+            ASSERT(0 != X.nextProcessingTime(&time));
+            ASSERT(17 == time);
+
+            bsl::vector<int>      ids;
+            bsl::vector<Int64>    ends;
+            bsl::vector<Callback> callbacks(&ta);
+
+            unsigned seed = 12345;
+            const Int64 MAX_DELAYS[] = { 300, 70000, 20000000, 5000000000LL };
+            const int   NUM_MAX_DELAYS = static_cast<int>(
+                                      sizeof MAX_DELAYS / sizeof *MAX_DELAYS);
+
+            const int NUM_EVENTS = 400;
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                const Int64 t = START + randomDelay(&seed,
+                                            MAX_DELAYS[i % NUM_MAX_DELAYS]) *
+                                                                           RES;
+                ends.push_back(tickEnd(t, RES, START));
+                mX.add(t, 0, bdlf::BindUtil::bind(&recordId, &ids, i));
+            }
+
+            int numIterations = 0;
+            while (0 == X.nextProcessingTime(&time)) {
+                ASSERTV(time, 0 == mX.advance(time - 1, &callbacks));
+                mX.advance(time, &callbacks);
+                runCallbacks(&callbacks);
+
+                for (bsl::size_t i = 0; i < ids.size(); ++i) {
+                    ASSERTV(ids[i], time, time == ends[ids[i]]);
+                }
+                ids.clear();
+                ++numIterations;
+            }
+            ASSERT(0 == X.numEvents());
+
+            // Each event is re-filed at most four times (once if it is more
+            // than 2^32 ticks in the future, then once per level) before
+            // expiring.
+
+            ASSERTV(numIterations, numIterations <= 5 * NUM_EVENTS);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting recurring events." << endl;
+        {
+            Wheel mX(RES, START, &ta);  const Wheel& X = mX;
+
+            bsl::vector<int>      ids;
+            bsl::vector<Callback> callbacks(&ta);
+
+            // An event every 2.5 ticks, so that it occurs in some ticks but
+            // not in others.
+
+            const Int64 INTERVAL = 25;
+            Wheel::Handle handle = mX.add(START + INTERVAL,
+                                          INTERVAL,
+                                          bdlf::BindUtil::bind(&recordId,
+                                                               &ids,
+                                                               7));
+            ASSERT(1 == X.numEvents());
+            ASSERT(1 == X.numRecurringEvents());
+
+            const Int64 END = START + 11000;
+
+            int total = 0;
+            for (Int64 now = START; now <= END; now += RES) {
+                total += mX.advance(now, &callbacks);
+            }
+            runCallbacks(&callbacks);
+            ASSERT(1 == X.numEvents());
+            ASSERTV(total, ids.size(), total == static_cast<int>(ids.size()));
+
+            int expected = 0;
+            for (Int64 t = START + INTERVAL; tickEnd(t, RES, START) <= END;
+                                                              t += INTERVAL) {
+                ++expected;
+            }
+            ASSERTV(total, expected, expected == total);
+
+            // An event whose interval is smaller than a tick is dispatched
+            // once per tick.
+
+            Wheel::Handle fast = mX.add(END + 3,
+                                        3,
+                                        bdlf::BindUtil::bind(&recordId,
+                                                             &ids,
+                                                             8));
+            ASSERT(2 == X.numRecurringEvents());
+            mX.advance(END + RES, &callbacks);
+            callbacks.clear();
+            for (Int64 now = END + 2 * RES; now <= END + 50 * RES;
+                                                                 now += RES) {
+                const int n = mX.advance(now, &callbacks);
+                ASSERTV(now, n, 1 <= n && n <= 2);
+            }
+            callbacks.clear();
+            ASSERT(0 == mX.remove(fast));
+
+            // Move the next occurrence to the (tick-aligned) time 'NEXT'.
+
+            const Int64 NEXT = START + 49995;
+            ASSERT(0 == NEXT % RES);
+            ASSERT(0 == mX.update(handle, NEXT));
+            ASSERT(0 == mX.advance(NEXT - 1, &callbacks));
+            ASSERT(1 == mX.advance(NEXT, &callbacks));
+            callbacks.clear();
+
+            ASSERT(0 == mX.remove(handle));
+            ASSERT(0 == X.numEvents());
+            ASSERT(0 == X.numRecurringEvents());
+            ASSERT(0 == mX.advance(START + 100000, &callbacks));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting updates while advancing." << endl;
+        {
+            Wheel mX(RES, START, &ta);  const Wheel& X = mX;
+
+            bsl::vector<int>           ids;
+            bsl::vector<Int64>         ends;
+            bsl::vector<Wheel::Handle> handles;
+            bsl::vector<Callback>      callbacks(&ta);
+
+            unsigned seed = 777;
+
+            const int NUM_EVENTS = 300;
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                const Int64 t = START + randomDelay(&seed, 100000) * RES;
+                ends.push_back(tickEnd(t, RES, START));
+                handles.push_back(mX.add(t,
+                                         0,
+                                         bdlf::BindUtil::bind(&recordId,
+                                                              &ids,
+                                                              i)));
+            }
+
+            Int64 now = START + 50000 * RES;
+            mX.advance(now, &callbacks);
+            runCallbacks(&callbacks);
+            for (bsl::size_t i = 0; i < ids.size(); ++i) {
+                ASSERTV(ids[i], ends[ids[i]] <= now);
+                ends[ids[i]] = -1;
+            }
+            ids.clear();
+
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                const bool pending = -1 != ends[i];
+                if (0 == i % 3) {
+                    const Int64 t = now + randomDelay(&seed, 100000) * RES;
+                    ASSERTV(i, pending == (0 == mX.update(handles[i], t)));
+                    if (pending) {
+                        ends[i] = tickEnd(t, RES, START);
+                    }
+                }
+                else if (1 == i % 3) {
+                    ASSERTV(i, pending == (0 == mX.remove(handles[i])));
+                    ends[i] = -1;
+                }
+            }
+
+            for (Int64 step = 1; 0 != X.numEvents(); step = step * 3 + 1) {
+                const Int64 prev = now;
+                now += step * RES;
+                mX.advance(now, &callbacks);
+                runCallbacks(&callbacks);
+                for (bsl::size_t i = 0; i < ids.size(); ++i) {
+                    const Int64 end = ends[ids[i]];
+                    ASSERTV(ids[i], end, prev, now, prev < end && end <= now);
+                    ends[ids[i]] = -1;
+                }
+                ids.clear();
+            }
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                ASSERTV(i, -1 == ends[i]);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'advance'
+        //
+        // Concerns:
+        //: 1 An event is dispatched by the first call to 'advance' whose time
+        //:   reaches the end of the tick in which the event falls, and never
+        //:   earlier.
+        //:
+        //: 2 Events are dispatched in order of their ticks, and events of the
+        //:   same tick in the order in which they were added.
+        //:
+        //: 3 Events in the past are dispatched by the next call to 'advance'.
+        //:
+        //: 4 Events at any distance, including more than 2^32 ticks in the
+        //:   future, are dispatched correctly.
+        //:
+        //: 5 One-shot events are removed from the wheel once dispatched, and
+        //:   their handles become invalid.
+        //
+        // Plan:
+        //: 1 Using a pseudo-random generator, add events whose delays span all
+        //:   the levels of the wheel, and beyond, and some events in the past.
+        //:   Advance the wheel to times just before, at, and well after the
+        //:   expected dispatch times of the events, and verify the dispatched
+        //:   events after each advance.  (C-1..5)
+        //
+        // Testing:
+        //   int advance(Int64 now, bsl::vector<Callback> *callbacks);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'advance'" << endl
+                          << "=================" << endl;
+
+        const Int64 RESOLUTIONS[] = { 1, 10, 1000 };
+        const int   NUM_RESOLUTIONS = static_cast<int>(
+                                    sizeof RESOLUTIONS / sizeof *RESOLUTIONS);
+
+        const Int64 MAX_DELAYS[] = {
+            200, 300, 60000, 70000, 16000000, 17000000, 5000000000LL,
+            20000000000LL
+        };
+        const int   NUM_MAX_DELAYS = static_cast<int>(
+                                      sizeof MAX_DELAYS / sizeof *MAX_DELAYS);
+
+        for (int ri = 0; ri < NUM_RESOLUTIONS; ++ri) {
+            const Int64 RES   = RESOLUTIONS[ri];
+            const Int64 START = 123456789 + ri;
+
+            if (veryVerbose) { T_ P(RES) }
+
+            Wheel mX(RES, START, &ta);  const Wheel& X = mX;
+
+            bsl::vector<int>           ids;
+            bsl::vector<Int64>         ends;
+            bsl::vector<Wheel::Handle> handles;
+            bsl::vector<Callback>      callbacks(&ta);
+
+            unsigned seed = static_cast<unsigned>(ri) + 1;
+
+            const int NUM_EVENTS = 2000;
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                Int64 t;
+                if (0 == i % 50) {
+                    t = START - randomDelay(&seed, 1000);
+                }
+                else {
+                    t = START + randomDelay(&seed,
+                                        MAX_DELAYS[i % NUM_MAX_DELAYS] * RES);
+                }
+                ends.push_back(tickEnd(t, RES, START));
+                handles.push_back(mX.add(t,
+                                         0,
+                                         bdlf::BindUtil::bind(&recordId,
+                                                              &ids,
+                                                              i)));
+            }
+            ASSERT(NUM_EVENTS == X.numEvents());
+
+            bsl::vector<Int64> sortedEnds(ends);
+            bsl::sort(sortedEnds.begin(), sortedEnds.end());
+            sortedEnds.erase(bsl::unique(sortedEnds.begin(), sortedEnds.end()),
+                             sortedEnds.end());
+
+            // Build the sequence of times to advance to.
+
+            bsl::vector<Int64> nows;
+            for (bsl::size_t i = 0; i < sortedEnds.size(); ++i) {
+                switch (nextRandom(&seed) % 4) {
+                  case 0: {
+                    nows.push_back(sortedEnds[i] - 1);
+                    nows.push_back(sortedEnds[i]);
+                  } break;
+                  case 1: {
+                    nows.push_back(sortedEnds[i] + RES / 2);
+                  } break;
+                  case 2: {
+                    nows.push_back(sortedEnds[i]);
+                  } break;
+                  default: {
+                    // Skip this time.
+                  } break;
+                }
+            }
+            nows.push_back(sortedEnds.back() + 1);
+
+            Int64 prev  = START - 1;
+            int   total = 0;
+            for (bsl::size_t i = 0; i < nows.size(); ++i) {
+                const Int64 now = nows[i];
+                if (now <= prev) {
+                    continue;                                       // CONTINUE
+                }
+
+                const int n = mX.advance(now, &callbacks);
+                ASSERT(n == static_cast<int>(callbacks.size()));
+                runCallbacks(&callbacks);
+
+                int expected = 0;
+                for (int j = 0; j < NUM_EVENTS; ++j) {
+                    if (prev < ends[j] && ends[j] <= now) {
+                        ++expected;
+                    }
+                }
+                ASSERTV(RES, now, expected, ids.size(),
+                        expected == static_cast<int>(ids.size()));
+
+                for (bsl::size_t j = 0; j < ids.size(); ++j) {
+                    const Int64 end = ends[ids[j]];
+                    ASSERTV(RES, ids[j], end, prev, now,
+                            prev < end && end <= now);
+                    if (j) {
+                        const Int64 prevEnd = ends[ids[j - 1]];
+                        ASSERTV(RES, prevEnd, end, prevEnd <= end);
+                        if (prevEnd == end) {
+                            ASSERTV(RES, ids[j - 1] < ids[j]);
+                        }
+                    }
+                    ASSERTV(ids[j], 0 != mX.remove(handles[ids[j]]));
+                }
+                total += static_cast<int>(ids.size());
+                ids.clear();
+                prev = now;
+            }
+            ASSERTV(RES, total, NUM_EVENTS == total);
+            ASSERT(0 == X.numEvents());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING WHEEL PRIMARY MANIPULATORS
+        //
+        // Concerns:
+        //: 1 A wheel is created empty, with the supplied resolution.
+        //:
+        //: 2 'add' returns a distinct valid handle for each event, and updates
+        //:   the counts of events.
+        //:
+        //: 3 'remove' and 'update' succeed for valid handles only, and a
+        //:   removed event's handle stays invalid after its node is reused.
+        //:
+        //: 4 'removeAll' removes all the events.
+        //:
+        //: 5 All memory is supplied by the supplied allocator.
+        //
+        // Plan:
+        //: 1 Add, update, and remove events, verifying the return values and
+        //:   the accessors, and the allocators' usage.  (C-1..5)
+        //
+        // Testing:
+        //   TimerWheelEventScheduler_Wheel(Int64, Int64, Allocator *);
+        //   Handle add(Int64 time, Int64 interval, const Callback& callback);
+        //   int remove(Handle handle);
+        //   void removeAll();
+        //   int update(Handle handle, Int64 newTime);
+        //   int numEvents() const;
+        //   int numRecurringEvents() const;
+        //   Int64 tickResolution() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING WHEEL PRIMARY MANIPULATORS" << endl
+                          << "==================================" << endl;
+
+        {
+            Wheel mX(1000, 5000, &ta);  const Wheel& X = mX;
+            ASSERT(1000 == X.tickResolution());
+            ASSERT(0    == X.numEvents());
+            ASSERT(0    == X.numRecurringEvents());
+
+            Wheel::Handle h1 = mX.add(6000,  0,   &noop);
+            Wheel::Handle h2 = mX.add(7000,  500, &noop);
+            Wheel::Handle h3 = mX.add(10000000000LL, 0, &noop);
+            ASSERT(0 <= h1);  ASSERT(0 <= h2);  ASSERT(0 <= h3);
+            ASSERT(h1 != h2);  ASSERT(h2 != h3);  ASSERT(h1 != h3);
+            ASSERT(3 == X.numEvents());
+            ASSERT(1 == X.numRecurringEvents());
+
+            ASSERT(0 == mX.update(h1, 8000));
+            ASSERT(0 == mX.update(h3, 9000));
+            ASSERT(0 != mX.update(-1, 9000));
+            ASSERT(0 != mX.update(h3 + 100, 9000));
+
+            ASSERT(0 == mX.remove(h1));
+            ASSERT(0 != mX.remove(h1));
+            ASSERT(0 != mX.update(h1, 8000));
+            ASSERT(2 == X.numEvents());
+
+            // The node of 'h1' is reused, but 'h1' stays invalid.
+
+            Wheel::Handle h4 = mX.add(6000, 0, &noop);
+            ASSERT(h4 != h1);
+            ASSERT(0 != mX.remove(h1));
+            ASSERT(3 == X.numEvents());
+
+            ASSERT(0 == mX.remove(h2));
+            ASSERT(2 == X.numEvents());
+            ASSERT(0 == X.numRecurringEvents());
+
+            mX.add(6000, 100, &noop);
+            ASSERT(1 == X.numRecurringEvents());
+
+            mX.removeAll();
+            ASSERT(0 == X.numEvents());
+            ASSERT(0 == X.numRecurringEvents());
+            ASSERT(0 != mX.remove(h3));
+            ASSERT(0 != mX.remove(h4));
+
+            bsl::vector<Callback> callbacks(&ta);
+            ASSERT(0 == mX.advance(100000000, &callbacks));
+
+            ASSERT(0 <  ta.numBlocksInUse());
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Start a scheduler, schedule an event and a recurring event, and
+        //:   verify that they are dispatched.  Cancel an event before it is
+        //:   dispatched.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(&ta);  const Obj& X = mX;
+        ASSERT(0 == mX.start());
+
+        bsls::AtomicInt counter(0);
+        bsls::AtomicInt recurringCounter(0);
+
+        mX.scheduleEvent(nowRealtime() + 0.01,
+                         bdlf::BindUtil::bind(&incrementCounter, &counter));
+        Obj::Handle cancelled = mX.scheduleEvent(
+                         nowRealtime() + 60,
+                         bdlf::BindUtil::bind(&incrementCounter, &counter));
+        Obj::Handle recurring = mX.scheduleRecurringEvent(
+                         bsls::TimeInterval(0.01),
+                         bdlf::BindUtil::bind(&incrementCounter,
+                                              &recurringCounter));
+
+        ASSERT(waitUntil(counter, 1, 5000));
+        ASSERT(waitUntil(recurringCounter, 2, 5000));
+
+        ASSERT(0 == mX.cancelEvent(cancelled));
+        ASSERT(0 == mX.cancelEvent(recurring, true));
+        ASSERT(0 == X.numEvents());
+
+        mX.stop();
+        ASSERT(1 == counter);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE COMPARISON WITH 'bdlmt::EventScheduler'
+        //
+        // Concerns:
+        //: 1 Scheduling, rescheduling, and cancelling events is faster than
+        //:   with 'bdlmt::EventScheduler' when a large number of events are
+        //:   managed.
+        //
+        // Plan:
+        //: 1 Schedule a large number of events (one million by default, or
+        //:   the number of thousands specified by the second argument) at
+        //:   pseudo-random times within the next minute, reschedule each of
+        //:   them once, and cancel them all, measuring the time taken by each
+        //:   phase with both schedulers.  The schedulers are not started, so
+        //:   that only the cost of managing the events is measured.
+        //
+        // Testing:
+        //   PERFORMANCE COMPARISON WITH 'bdlmt::EventScheduler'
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE COMPARISON WITH 'bdlmt::EventScheduler'" << endl
+             << "===================================================" << endl;
+
+        const int NUM_EVENTS = (argc > 2 ? atoi(argv[2]) : 1000) * 1000;
+
+        bsl::vector<bsls::TimeInterval> times;
+        bsl::vector<bsls::TimeInterval> newTimes;
+        {
+            const bsls::TimeInterval now = nowRealtime();
+
+            unsigned seed = 1;
+            times.reserve(NUM_EVENTS);
+            newTimes.reserve(NUM_EVENTS);
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                bsls::TimeInterval t(now);
+                t.addMicroseconds(60 * 1000 * 1000 +
+                                  randomDelay(&seed, 60 * 1000 * 1000));
+                times.push_back(t);
+                t.addMicroseconds(randomDelay(&seed, 60 * 1000 * 1000));
+                newTimes.push_back(t);
+            }
+        }
+
+        const bsl::function<void()> callback(&noop);
+
+        cout << "events: " << NUM_EVENTS << endl
+             << "scheduler\tschedule\treschedule\tcancel\t(seconds)" << endl;
+        {
+            bdlmt::EventScheduler mX;
+
+            bsl::vector<bdlmt::EventScheduler::Event *> handles(NUM_EVENTS);
+
+            bsls::Stopwatch sw;
+            sw.start();
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                mX.scheduleEventRaw(&handles[i], times[i], callback);
+            }
+            const double scheduleTime = sw.elapsedTime();
+
+            sw.reset();
+            sw.start();
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                mX.rescheduleEvent(handles[i], newTimes[i]);
+            }
+            const double rescheduleTime = sw.elapsedTime();
+
+            sw.reset();
+            sw.start();
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                mX.cancelEvent(handles[i]);
+                mX.releaseEventRaw(handles[i]);
+            }
+            const double cancelTime = sw.elapsedTime();
+
+            cout << "EventScheduler\t" << scheduleTime << "\t\t"
+                 << rescheduleTime << "\t\t" << cancelTime << endl;
+        }
+        {
+            Obj mX;
+
+            bsl::vector<Obj::Handle> handles(NUM_EVENTS);
+
+            bsls::Stopwatch sw;
+            sw.start();
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                handles[i] = mX.scheduleEvent(times[i], callback);
+            }
+            const double scheduleTime = sw.elapsedTime();
+
+            sw.reset();
+            sw.start();
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                mX.rescheduleEvent(handles[i], newTimes[i]);
+            }
+            const double rescheduleTime = sw.elapsedTime();
+
+            sw.reset();
+            sw.start();
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                mX.cancelEvent(handles[i]);
+            }
+            const double cancelTime = sw.elapsedTime();
+
+            cout << "TimerWheel\t" << scheduleTime << "\t\t"
+                 << rescheduleTime << "\t\t" << cancelTime << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
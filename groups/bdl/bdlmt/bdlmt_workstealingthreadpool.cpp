@@ -0,0 +1,469 @@
+// bdlmt_workstealingthreadpool.cpp                                   -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_workstealingthreadpool_cpp,"$Id$ $CSID$")
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_platform.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <bsl_c_signal.h>              // sigfillset
+#endif
+
+#include <bsl_deque.h>
+
+namespace BloombergLP {
+namespace {
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+void initBlockSet(sigset_t *blockSet)
+{
+    sigfillset(blockSet);
+
+    const int synchronousSignals[] = {
+      SIGBUS,
+      SIGFPE,
+      SIGILL,
+      SIGSEGV,
+      SIGSYS,
+      SIGABRT,
+      SIGTRAP,
+     #if !defined(BSLS_PLATFORM_OS_CYGWIN) || defined(SIGIOT)
+      SIGIOT
+     #endif
+    };
+
+    const int SIZE = sizeof synchronousSignals / sizeof *synchronousSignals;
+
+    for (int i=0; i < SIZE; ++i) {
+        sigdelset(blockSet, synchronousSignals[i]);
+    }
+}
+#endif
+
+}  // close unnamed namespace
+
+namespace bdlmt {
+
+                     // ==================================
+                     // class WorkStealingThreadPool_Queue
+                     // ==================================
+
+class WorkStealingThreadPool_Queue {
+    // This class provides the queue of pending jobs owned by one processing
+    // thread of a 'WorkStealingThreadPool'.  The owning thread pushes and
+    // pops jobs at the back of the queue, while other threads steal jobs from
+    // the front.  Each object occupies its own cache line(s), so that threads
+    // operating on different queues do not contend.
+
+    // PRIVATE TYPES
+    typedef WorkStealingThreadPool::Job Job;
+
+    // DATA
+    bslmt::Mutex       d_mutex;           // protects 'd_jobs'
+
+    bsl::deque<Job>    d_jobs;            // pending jobs
+
+    bsls::AtomicInt    d_size;            // number of jobs in 'd_jobs',
+                                          // allowing thieves to skip empty
+                                          // queues without locking
+
+    const char         d_pad[bslmt::Platform::e_CACHE_LINE_SIZE];
+                                          // padding to prevent false sharing
+                                          // with the next allocated object
+
+  private:
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool_Queue(const WorkStealingThreadPool_Queue&);
+    WorkStealingThreadPool_Queue& operator=(
+                                          const WorkStealingThreadPool_Queue&);
+
+  public:
+    // CREATORS
+    explicit
+    WorkStealingThreadPool_Queue(bslma::Allocator *basicAllocator);
+        // Create an empty queue, using the specified 'basicAllocator' to
+        // supply memory.
+
+    // MANIPULATORS
+    int removeAll();
+        // Remove all the jobs from this queue, and return the number of jobs
+        // removed.  Note that the jobs are destroyed with no lock held.
+
+    void pushBack(const Job& job);
+        // Append the specified 'job' to the back of this queue.
+
+    bool tryPopBack(Job *job);
+        // Load into the specified 'job' the job at the back of this queue,
+        // remove it, and return 'true'.  Return 'false' if this queue is
+        // empty.
+
+    bool tryPopFront(Job *job);
+        // Load into the specified 'job' the job at the front of this queue,
+        // remove it, and return 'true'.  Return 'false' if this queue is
+        // empty.
+};
+
+                     // ----------------------------------
+                     // class WorkStealingThreadPool_Queue
+                     // ----------------------------------
+
+// CREATORS
+WorkStealingThreadPool_Queue::WorkStealingThreadPool_Queue(
+                                              bslma::Allocator *basicAllocator)
+: d_jobs(basicAllocator)
+, d_size(0)
+, d_pad()
+{
+}
+
+// MANIPULATORS
+int WorkStealingThreadPool_Queue::removeAll()
+{
+    bsl::deque<Job> jobs(d_jobs.get_allocator());
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        d_jobs.swap(jobs);
+        d_size = 0;
+    }
+    return static_cast<int>(jobs.size());
+}
+
+void WorkStealingThreadPool_Queue::pushBack(const Job& job)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_jobs.push_back(job);
+    d_size.storeRelaxed(static_cast<int>(d_jobs.size()));
+}
+
+bool WorkStealingThreadPool_Queue::tryPopBack(Job *job)
+{
+    if (0 == d_size.loadRelaxed()) {
+        return false;                                                 // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    if (d_jobs.empty()) {
+        return false;                                                 // RETURN
+    }
+    *job = d_jobs.back();
+    d_jobs.pop_back();
+    d_size.storeRelaxed(static_cast<int>(d_jobs.size()));
+    return true;
+}
+
+bool WorkStealingThreadPool_Queue::tryPopFront(Job *job)
+{
+    if (0 == d_size.loadRelaxed()) {
+        return false;                                                 // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    if (d_jobs.empty()) {
+        return false;                                                 // RETURN
+    }
+    *job = d_jobs.front();
+    d_jobs.pop_front();
+    d_size.storeRelaxed(static_cast<int>(d_jobs.size()));
+    return true;
+}
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// PRIVATE MANIPULATORS
+void WorkStealingThreadPool::init()
+{
+    BSLS_ASSERT_OPT(1 <= d_numThreads);
+
+    int rc = bslmt::ThreadUtil::createKey(&d_workerKey, 0);
+    BSLS_ASSERT_OPT(0 == rc);  (void)rc;
+
+    d_queues.reserve(d_numThreads);
+    for (int i = 0; i < d_numThreads; ++i) {
+        d_queues.push_back(new (*d_allocator_p)
+                                  WorkStealingThreadPool_Queue(d_allocator_p));
+    }
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    initBlockSet(&d_blockSet);
+#endif
+}
+
+int WorkStealingThreadPool::startNewThread(int index)
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Block all asynchronous signals.
+
+    sigset_t oldset;
+    pthread_sigmask(SIG_BLOCK, &d_blockSet, &oldset);
+#endif
+
+    int rc = d_threadGroup.addThread(
+                    bdlf::BindUtil::bind(&WorkStealingThreadPool::workerThread,
+                                         this,
+                                         index),
+                    d_threadAttributes);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Restore the mask.
+
+    pthread_sigmask(SIG_SETMASK, &oldset, &d_blockSet);
+#endif
+
+    return rc;
+}
+
+void WorkStealingThreadPool::stopWorkerThreads()
+{
+    d_stopping = 1;
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        d_queueSemaphore.post();
+    }
+    d_threadGroup.joinAll();
+
+    // Wake up the threads blocked in 'drain': with no worker threads left,
+    // there is nothing more for them to wait for.
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_drainMutex);
+        d_drainCond.broadcast();
+    }
+
+    // Absorb the wake-ups that were not consumed by exiting threads.
+
+    while (0 == d_queueSemaphore.tryWait()) {
+    }
+    d_stopping = 0;
+}
+
+bool WorkStealingThreadPool::tryPopJob(Job *job, int index)
+{
+    if (d_queues[index]->tryPopBack(job)) {
+        return true;                                                  // RETURN
+    }
+
+    for (int i = 1; i < d_numThreads; ++i) {
+        int victim = index + i;
+        if (victim >= d_numThreads) {
+            victim -= d_numThreads;
+        }
+        if (d_queues[victim]->tryPopFront(job)) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+void WorkStealingThreadPool::workerThread(int index)
+{
+    bslmt::ThreadUtil::setSpecific(d_workerKey,
+                                   reinterpret_cast<void *>(
+                                      static_cast<bsls::Types::IntPtr>(index
+                                                                       + 1)));
+
+    Job functor;
+    while (1) {
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(tryPopJob(&functor, index))) {
+            // Publish the job as active before it stops being pending, so
+            // that 'drain' never observes both counts being 0 while this job
+            // is in flight.
+
+            ++d_numActiveThreads;
+            d_numPendingJobs.addRelaxed(-1);
+
+            functor();
+
+            // The functor has to be cleared before the job is reported as
+            // complete, because it might have some objects bound with
+            // non-trivial destructors.
+
+            functor = Job();
+            --d_numActiveThreads;
+            continue;
+        }
+
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        if (d_stopping) {
+            break;
+        }
+
+        ++d_numThreadsWaiting;
+
+        if (0 >= d_numPendingJobs) {
+            {
+                bslmt::LockGuard<bslmt::Mutex> lock(&d_drainMutex);
+                if (0 == d_numActiveThreads) {
+                    d_drainCond.broadcast();
+                }
+            }
+
+            if (!d_stopping) {
+                d_queueSemaphore.wait();
+            }
+        }
+
+        d_numThreadsWaiting.addRelaxed(-1);
+    }
+
+    bslmt::ThreadUtil::setSpecific(d_workerKey, 0);
+}
+
+// CREATORS
+WorkStealingThreadPool::WorkStealingThreadPool(
+                                              int               numThreads,
+                                              bslma::Allocator *basicAllocator)
+: d_queues(basicAllocator)
+, d_numThreadsWaiting(0)
+, d_numPendingJobs(0)
+, d_numActiveThreads(0)
+, d_nextQueue(0)
+, d_enabled(0)
+, d_stopping(0)
+, d_threadGroup(basicAllocator)
+, d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    init();
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+                      const bslmt::ThreadAttributes&  threadAttributes,
+                      int                             numThreads,
+                      bslma::Allocator               *basicAllocator)
+: d_queues(basicAllocator)
+, d_numThreadsWaiting(0)
+, d_numPendingJobs(0)
+, d_numActiveThreads(0)
+, d_nextQueue(0)
+, d_enabled(0)
+, d_stopping(0)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(threadAttributes)
+, d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    init();
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    shutdown();
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        d_allocator_p->deleteObject(d_queues[i]);
+    }
+    bslmt::ThreadUtil::deleteKey(d_workerKey);
+}
+
+// MANIPULATORS
+int WorkStealingThreadPool::enqueueJob(const Job& functor)
+{
+    BSLS_ASSERT(functor);
+
+    if (!d_enabled.loadRelaxed()) {
+        return 1;                                                     // RETURN
+    }
+
+    int index = static_cast<int>(reinterpret_cast<bsls::Types::IntPtr>(
+                             bslmt::ThreadUtil::getSpecific(d_workerKey))) - 1;
+    if (0 > index) {
+        const unsigned int next =
+                         static_cast<unsigned int>(d_nextQueue.addRelaxed(1));
+        index = static_cast<int>(next
+                                 % static_cast<unsigned int>(d_numThreads));
+    }
+
+    d_queues[index]->pushBack(functor);
+
+    // The increment of 'd_numPendingJobs' must be sequentially consistent
+    // with the load of 'd_numThreadsWaiting': either this thread observes a
+    // waiting thread and wakes it up, or the waiting thread observes the new
+    // job before going to sleep.
+
+    ++d_numPendingJobs;
+    if (d_numThreadsWaiting) {
+        d_queueSemaphore.post();
+    }
+    return 0;
+}
+
+void WorkStealingThreadPool::drain()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_drainMutex);
+
+    while (0 != d_threadGroup.numThreads()
+        && (0 < d_numPendingJobs || 0 != d_numActiveThreads)) {
+        d_drainCond.wait(&d_drainMutex);
+    }
+}
+
+void WorkStealingThreadPool::shutdown()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    disable();
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        d_numPendingJobs.add(-d_queues[i]->removeAll());
+    }
+
+    stopWorkerThreads();
+}
+
+int WorkStealingThreadPool::start()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (d_threadGroup.numThreads()) {
+        return 0;                                                     // RETURN
+    }
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        if (0 != startNewThread(i)) {
+            stopWorkerThreads();
+            return -1;                                                // RETURN
+        }
+    }
+
+    enable();
+    return 0;
+}
+
+void WorkStealingThreadPool::stop()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    disable();
+    stopWorkerThreads();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,517 @@
+// bdlmt_workstealingthreadpool.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+#define INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-size thread pool with per-thread work stealing.
+//
+//@CLASSES:
+//   bdlmt::WorkStealingThreadPool: fixed-size, work-stealing thread pool
+//
+//@SEE_ALSO: bdlmt_threadpool, bdlmt_fixedthreadpool
+//
+//@DESCRIPTION: This component defines a thread pool,
+// 'bdlmt::WorkStealingThreadPool', that distributes user-defined functions
+// ("jobs") among a fixed number of processing threads.  Unlike
+// 'bdlmt::ThreadPool' and 'bdlmt::FixedThreadPool', which feed every
+// processing thread from a single shared queue, each processing thread of a
+// 'bdlmt::WorkStealingThreadPool' owns a local double-ended queue of jobs,
+// protected by its own mutex.  A thread that runs out of local work "steals"
+// jobs from the opposite end of the queues of the other threads in the pool.
+// Contention on any one lock is therefore limited to the owner of a queue and
+// the occasional thief, which allows the pool to scale to a large number of
+// processing threads.
+//
+// Jobs are placed into the queues as follows:
+//
+//: o A job enqueued by a thread that is *not* one of the processing threads of
+//:   the pool is placed onto the queues of the processing threads in
+//:   round-robin order.
+//:
+//: o A job enqueued from within a job running on one of the processing
+//:   threads of the pool is placed onto the local queue of that thread.
+//
+// A processing thread takes jobs from its own queue in last-in, first-out
+// order (favoring jobs whose data are likely still in that thread's cache),
+// and steals jobs from other queues in first-in, first-out order.  As a
+// consequence, no guarantee is made on the relative order in which jobs are
+// executed.
+//
+// The 'enqueueJob', 'drain', 'stop', 'shutdown', 'enable', and 'disable'
+// methods follow the contract of the corresponding methods of
+// 'bdlmt::FixedThreadPool' (except that the queues are unbounded, so
+// 'enqueueJob' never blocks), so that a 'bdlmt::WorkStealingThreadPool' can be
+// substituted for a 'bdlmt::FixedThreadPool' with minimal changes.
+//
+///Thread Safety
+///-------------
+// The 'bdlmt::WorkStealingThreadPool' class is both *fully thread-safe*
+// (i.e., all non-creator methods can correctly execute concurrently), and is
+// *thread-enabled* (i.e., the class does not function correctly in a
+// non-multi-threading environment).  See 'bsldoc_glossary' for complete
+// definitions of *fully thread-safe* and *thread-enabled*.
+//
+///Synchronous Signals on Unix
+///---------------------------
+// A thread pool ensures that, on unix platforms, all the threads in the pool
+// block all asynchronous signals.  Specifically all the signals, except the
+// following synchronous signals are blocked.
+//
+// SIGBUS
+// SIGFPE
+// SIGILL
+// SIGSEGV
+// SIGSYS
+// SIGABRT
+// SIGTRAP
+// SIGIOT
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recursive Divide-and-Conquer
+///- - - - - - - - - - - - - - - - - - - -
+// Work-stealing pools are well suited to jobs that spawn further jobs.  In
+// this example we sum the elements of an array by recursively splitting it in
+// halves, each half being summed by a separate job, until the sub-ranges are
+// small enough to be summed directly.
+//
+// First, we define the state shared by all the jobs, and the job function
+// itself:
+//..
+//  struct SumContext {
+//      bdlmt::WorkStealingThreadPool *d_pool_p;   // pool running the jobs
+//      const int                     *d_data_p;   // data to sum
+//      bsls::AtomicInt64              d_sum;      // accumulated sum
+//  };
+//
+//  void sumRange(SumContext *context, int begin, int end)
+//  {
+//      enum { k_GRAIN = 1024 };
+//
+//      while (end - begin > k_GRAIN) {
+//          const int middle = begin + (end - begin) / 2;
+//..
+// Since this function is executing on one of the processing threads of the
+// pool, the following job is placed onto the local queue of the current
+// thread, and is available to be stolen by idle threads:
+//..
+//          context->d_pool_p->enqueueJob(
+//                      bdlf::BindUtil::bind(&sumRange, context, middle, end));
+//          end = middle;
+//      }
+//
+//      bsls::Types::Int64 sum = 0;
+//      for (int i = begin; i < end; ++i) {
+//          sum += context->d_data_p[i];
+//      }
+//      context->d_sum.add(sum);
+//  }
+//..
+// Then, we create a pool having four processing threads and start it:
+//..
+//  bdlmt::WorkStealingThreadPool pool(4);
+//  int rc = pool.start();
+//  assert(0 == rc);
+//..
+// Next, we create the data to sum, and enqueue the root job:
+//..
+//  bsl::vector<int> data(1 << 20, 1);
+//
+//  SumContext context;
+//  context.d_pool_p = &pool;
+//  context.d_data_p = data.data();
+//
+//  pool.enqueueJob(bdlf::BindUtil::bind(&sumRange,
+//                                       &context,
+//                                       0,
+//                                       static_cast<int>(data.size())));
+//..
+// Finally, we wait for all the jobs, including the ones enqueued by other
+// jobs, to complete, and verify the result:
+//..
+//  pool.drain();
+//  assert(static_cast<bsls::Types::Int64>(data.size()) == context.d_sum);
+//
+//  pool.stop();
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLF_BIND
+#include <bdlf_bind.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_CONDITION
+#include <bslmt_condition.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_MUTEX
+#include <bslmt_mutex.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_SEMAPHORE
+#include <bslmt_semaphore.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_THREADATTRIBUTES
+#include <bslmt_threadattributes.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_THREADGROUP
+#include <bslmt_threadgroup.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_THREADUTIL
+#include <bslmt_threadutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSL_FUNCTIONAL
+#include <bsl_functional.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    #ifndef INCLUDED_BSL_CSIGNAL
+    #include <bsl_csignal.h>              // sigset_t
+    #endif
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+class WorkStealingThreadPool_Queue;
+
+extern "C" typedef void (*WorkStealingThreadPoolJobFunc)(void *);
+    // This type declares the prototype for functions that are suitable to be
+    // specified 'bdlmt::WorkStealingThreadPool::enqueueJob'.
+
+                        // ============================
+                        // class WorkStealingThreadPool
+                        // ============================
+
+class WorkStealingThreadPool {
+    // This class implements a thread pool used for concurrently executing
+    // multiple user-defined functions ("jobs") on a fixed number of threads,
+    // each thread having its own queue of pending jobs and stealing jobs from
+    // the queues of the other threads when its own queue is empty.
+
+  public:
+    // TYPES
+    typedef bsl::function<void()> Job;
+
+  private:
+    // DATA
+    bsl::vector<WorkStealingThreadPool_Queue *>
+                            d_queues;             // one queue per processing
+                                                  // thread (owned)
+
+    bslmt::Semaphore        d_queueSemaphore;     // used to implement blocking
+                                                  // of idle processing threads
+
+    bsls::AtomicInt         d_numThreadsWaiting;  // number of idle threads in
+                                                  // the pool
+
+    bsls::AtomicInt         d_numPendingJobs;     // number of jobs enqueued
+                                                  // but not yet started
+
+    bsls::AtomicInt         d_numActiveThreads;   // number of threads
+                                                  // currently running a job
+
+    bsls::AtomicInt         d_nextQueue;          // round-robin index of the
+                                                  // queue receiving the next
+                                                  // job enqueued by a thread
+                                                  // outside of this pool
+
+    bsls::AtomicInt         d_enabled;            // 1 if enqueuing is
+                                                  // enabled, and 0 otherwise
+
+    bsls::AtomicInt         d_stopping;           // 1 if processing threads
+                                                  // must exit once they run
+                                                  // out of jobs, and 0
+                                                  // otherwise
+
+    bslmt::Mutex            d_metaMutex;          // mutex to ensure that there
+                                                  // is only one controlling
+                                                  // thread at any time
+
+    bslmt::Mutex            d_drainMutex;         // mutex used with
+                                                  // 'd_drainCond'
+
+    bslmt::Condition        d_drainCond;          // condition signaled when a
+                                                  // processing thread becomes
+                                                  // idle
+
+    bslmt::ThreadUtil::Key  d_workerKey;          // thread-specific key
+                                                  // holding (1 + the index of
+                                                  // the queue) of the calling
+                                                  // processing thread
+
+    bslmt::ThreadGroup      d_threadGroup;        // threads used by this pool
+
+    bslmt::ThreadAttributes d_threadAttributes;   // thread attributes to be
+                                                  // used when constructing
+                                                  // processing threads
+
+    const int               d_numThreads;         // number of configured
+                                                  // processing threads
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    sigset_t                d_blockSet;           // set of signals to be
+                                                  // blocked in managed threads
+#endif
+
+    bslma::Allocator       *d_allocator_p;        // memory allocator (held)
+
+    // PRIVATE MANIPULATORS
+    void init();
+        // Create the per-thread queues and the thread-specific key of this
+        // pool.  Note that this method is called only by the constructors.
+
+    int startNewThread(int index);
+        // Spawn a new processing thread servicing the queue at the specified
+        // 'index'.  Return 0 on success, and a non-zero value otherwise.  Note
+        // that this method must be called with 'd_metaMutex' locked.
+
+    void stopWorkerThreads();
+        // Signal all processing threads to exit once they run out of jobs, and
+        // join them.  Note that this method must be called with 'd_metaMutex'
+        // locked.
+
+    bool tryPopJob(Job *job, int index);
+        // Load into the specified 'job' a pending job, taken from the back of
+        // the queue at the specified 'index' or, if that queue is empty,
+        // stolen from the front of one of the other queues, and return 'true'.
+        // Return 'false', with no effect on 'job', if no job is available.
+
+    void workerThread(int index);
+        // The main function executed by the processing thread servicing the
+        // queue at the specified 'index'.
+
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool(const WorkStealingThreadPool&);
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(WorkStealingThreadPool,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit
+    WorkStealingThreadPool(int               numThreads,
+                           bslma::Allocator *basicAllocator = 0);
+        // Construct a thread pool with the specified 'numThreads' number of
+        // processing threads, each having its own queue of pending jobs.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '1 <= numThreads'.
+
+    WorkStealingThreadPool(
+                       const bslmt::ThreadAttributes&  threadAttributes,
+                       int                             numThreads,
+                       bslma::Allocator               *basicAllocator = 0);
+        // Construct a thread pool with the specified 'threadAttributes' and
+        // 'numThreads' number of processing threads, each having its own
+        // queue of pending jobs.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  The behavior is undefined
+        // unless '1 <= numThreads'.
+
+    ~WorkStealingThreadPool();
+        // Remove all pending jobs from the queues without executing them,
+        // block until all currently running jobs complete, and then destroy
+        // this thread pool.
+
+    // MANIPULATORS
+    void disable();
+        // Disable queuing into this pool.  Subsequent calls to 'enqueueJob'
+        // will immediately fail.  Note that this method has no effect on jobs
+        // currently in the pool.
+
+    void enable();
+        // Enable queuing into this pool.
+
+    int enqueueJob(const Job& functor);
+        // Enqueue the specified 'functor' to be executed by a processing
+        // thread.  If this method is called from a job running on one of the
+        // processing threads of this pool, 'functor' is placed onto the local
+        // queue of that thread; otherwise, it is placed onto the queue of the
+        // next processing thread in round-robin order.  Return 0 if enqueued
+        // successfully, and a non-zero value if queuing is currently
+        // disabled.  The behavior is undefined unless 'functor' is not
+        // "unset".  See 'bsl::function' for more information on functors.
+
+    int enqueueJob(WorkStealingThreadPoolJobFunc function, void *userData);
+        // Enqueue the specified 'function' to be executed by a processing
+        // thread.  The specified 'userData' pointer will be passed to the
+        // function by the processing thread.  Return 0 if enqueued
+        // successfully, and a non-zero value if queuing is currently
+        // disabled.
+
+    void drain();
+        // Wait until all pending jobs, including the jobs enqueued by the
+        // jobs being drained, complete.  Note that if any jobs are submitted
+        // concurrently with this method by threads outside of this pool, this
+        // method may or may not wait until they have also completed.  The
+        // behavior is undefined if this method is called from one of the
+        // processing threads of this pool.
+
+    void shutdown();
+        // Disable queuing on this thread pool, cancel all queued jobs, and
+        // after all actives jobs have completed, join all processing threads.
+
+    int start();
+        // Spawn 'numThreads()' processing threads.  On success, enable
+        // enqueuing and return 0.  Return a non-zero value otherwise.  If
+        // 'numThreads()' threads were not successfully started, all threads
+        // are stopped.
+
+    void stop();
+        // Disable queuing on this thread pool and wait until all pending jobs
+        // complete, then shut down all processing threads.
+
+    // ACCESSORS
+    bool isEnabled() const;
+        // Return 'true' if queuing is enabled on this thread pool, and 'false'
+        // otherwise.
+
+    bool isStarted() const;
+        // Return 'true' if 'numThreads()' are started on this thread pool and
+        // 'false' otherwise (indicating that 0 threads are started on this
+        // thread pool).
+
+    int numActiveThreads() const;
+        // Return a snapshot of the number of threads that are currently
+        // processing a job for this thread pool.
+
+    int numPendingJobs() const;
+        // Return a snapshot of the number of jobs currently enqueued to be
+        // processed by this thread pool.
+
+    int numThreads() const;
+        // Return the number of threads passed to this thread pool at
+        // construction.
+
+    int numThreadsStarted() const;
+        // Return a snapshot of the number of threads currently started by this
+        // thread pool.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// MANIPULATORS
+inline
+void WorkStealingThreadPool::disable()
+{
+    d_enabled = 0;
+}
+
+inline
+void WorkStealingThreadPool::enable()
+{
+    d_enabled = 1;
+}
+
+inline
+int WorkStealingThreadPool::enqueueJob(
+                                      WorkStealingThreadPoolJobFunc  function,
+                                      void                          *userData)
+{
+    return enqueueJob(bdlf::BindUtil::bindR<void>(function, userData));
+}
+
+// ACCESSORS
+inline
+bool WorkStealingThreadPool::isEnabled() const
+{
+    return d_enabled;
+}
+
+inline
+bool WorkStealingThreadPool::isStarted() const
+{
+    return d_numThreads == d_threadGroup.numThreads();
+}
+
+inline
+int WorkStealingThreadPool::numActiveThreads() const
+{
+    return d_numActiveThreads.loadRelaxed();
+}
+
+inline
+int WorkStealingThreadPool::numPendingJobs() const
+{
+    const int numPendingJobs = d_numPendingJobs.loadRelaxed();
+    return 0 < numPendingJobs ? numPendingJobs : 0;
+}
+
+inline
+int WorkStealingThreadPool::numThreads() const
+{
+    return d_numThreads;
+}
+
+inline
+int WorkStealingThreadPool::numThreadsStarted() const
+{
+    return d_threadGroup.numThreads();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
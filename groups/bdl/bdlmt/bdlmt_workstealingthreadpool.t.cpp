@@ -0,0 +1,900 @@
+// bdlmt_workstealingthreadpool.t.cpp                                 -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bdlmt_fixedthreadpool.h>
+#include <bdlmt_threadpool.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bdlf_bind.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <bsl_c_signal.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              OVERVIEW
+// A work-stealing thread pool dispatches jobs onto a fixed number of threads,
+// each thread owning a local queue of jobs and stealing jobs from the queues
+// of the other threads when its own queue is empty.  We need to test that the
+// pool can be started, stopped, and drained properly, that jobs are enqueued
+// and executed exactly once whether they are enqueued from outside the pool
+// or from within a job, and that enqueuing is refused when disabled.
+//
+// In addition to positive test cases (run in the nightly builds), a negative
+// test case -1 can be run manually to compare the throughput of this pool
+// against 'bdlmt::ThreadPool' and 'bdlmt::FixedThreadPool'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] WorkStealingThreadPool(int, bslma::Allocator *);
+// [ 2] WorkStealingThreadPool(const ThreadAttributes&, int, Allocator *);
+// [ 2] ~WorkStealingThreadPool();
+//
+// MANIPULATORS
+// [ 2] int start();
+// [ 2] void stop();
+// [ 3] int enqueueJob(const Job& functor);
+// [ 3] int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+// [ 3] void drain();
+// [ 4] void disable();
+// [ 4] void enable();
+// [ 4] void shutdown();
+//
+// ACCESSORS
+// [ 2] bool isStarted() const;
+// [ 2] int numThreads() const;
+// [ 2] int numThreadsStarted() const;
+// [ 3] int numActiveThreads() const;
+// [ 3] int numPendingJobs() const;
+// [ 4] bool isEnabled() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] TESTING JOBS ENQUEUING OTHER JOBS
+// [ 6] TESTING SYNCHRONOUS SIGNALS
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE COMPARISON WITH 'ThreadPool' AND 'FixedThreadPool'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::WorkStealingThreadPool Obj;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS  FOR TESTING
+// ----------------------------------------------------------------------------
+
+extern "C" {
+
+void incrementCounter(void *counter)
+    // Increment the 'bsls::AtomicInt' addressed by the specified 'counter'.
+{
+    ++*static_cast<bsls::AtomicInt *>(counter);
+}
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+void testSynchronousSignals(void *)
+{
+    sigset_t blockedSet;
+    sigemptyset(&blockedSet);
+    pthread_sigmask(SIG_BLOCK, NULL, &blockedSet);
+
+    static const int synchronousSignals[] = {
+      SIGBUS,
+      SIGFPE,
+      SIGILL,
+      SIGSEGV,
+      SIGSYS,
+      SIGABRT,
+      SIGTRAP,
+#ifdef SIGIOT
+      SIGIOT
+#endif
+    };
+
+    int SIZE = sizeof synchronousSignals / sizeof *synchronousSignals;
+
+    for (int i = 0; i < SIZE; ++i) {
+        ASSERT(sigismember(&blockedSet, synchronousSignals[i]) == 0);
+    }
+
+#ifndef BSLS_PLATFORM_OS_CYGWIN
+    ASSERT(sigismember(&blockedSet, SIGINT) == 1);
+#endif
+}
+#endif
+
+}  // extern "C"
+
+void waitOnBarrier(bslmt::Barrier *barrier, bsls::AtomicInt *counter)
+    // Wait on the specified 'barrier' twice, then increment the specified
+    // 'counter'.
+{
+    barrier->wait();
+    barrier->wait();
+    ++*counter;
+}
+
+void spawnTree(Obj *pool, bsls::AtomicInt *counter, int depth)
+    // Increment the specified 'counter' and, unless the specified 'depth' is
+    // 0, enqueue onto the specified 'pool' two jobs executing this function
+    // with 'depth - 1'.  Note that a total of '2^(depth + 1) - 1' jobs are
+    // executed.
+{
+    ++*counter;
+    if (depth) {
+        ASSERT(0 == pool->enqueueJob(
+                        bdlf::BindUtil::bind(&spawnTree, pool, counter,
+                                             depth - 1)));
+        ASSERT(0 == pool->enqueueJob(
+                        bdlf::BindUtil::bind(&spawnTree, pool, counter,
+                                             depth - 1)));
+    }
+}
+
+double spin(int n)
+    // Perform the specified 'n' iterations of a computation meant only to
+    // consume time, and return the result.
+{
+    double result = 1.0;
+    for (int i = 0; i < n; ++i) {
+        result = 1 / (1 + result);
+    }
+    return result;
+}
+
+void spinJob(int n)
+    // Spin for the specified 'n' iterations.
+{
+    volatile double result = spin(n);
+    (void)result;
+}
+
+template <class POOL>
+void spawnSpinTree(POOL *pool, bsls::AtomicInt *remaining, int depth, int work)
+    // Spin for the specified 'work' iterations, unless the specified 'depth'
+    // is 0 enqueue onto the specified 'pool' two jobs executing this function
+    // with 'depth - 1', and decrement the specified 'remaining' count of jobs.
+{
+    spinJob(work);
+    if (depth) {
+        pool->enqueueJob(bdlf::BindUtil::bind(&spawnSpinTree<POOL>,
+                                              pool,
+                                              remaining,
+                                              depth - 1,
+                                              work));
+        pool->enqueueJob(bdlf::BindUtil::bind(&spawnSpinTree<POOL>,
+                                              pool,
+                                              remaining,
+                                              depth - 1,
+                                              work));
+    }
+    remaining->addRelaxed(-1);
+}
+
+template <class POOL>
+double runFlat(POOL *pool, int numJobs, int work)
+    // Enqueue onto the specified 'pool' the specified 'numJobs' jobs each
+    // spinning for the specified 'work' iterations, wait until all have
+    // completed, and return the elapsed time in seconds.
+{
+    bsls::Stopwatch timer;
+    timer.start();
+
+    const bsl::function<void()> job(bdlf::BindUtil::bind(&spinJob, work));
+    for (int i = 0; i < numJobs; ++i) {
+        pool->enqueueJob(job);
+    }
+    pool->drain();
+    return timer.elapsedTime();
+}
+
+template <class POOL>
+double runTree(POOL *pool, int depth, int work)
+    // Enqueue onto the specified 'pool' a root job recursively spawning a
+    // binary tree of jobs having the specified 'depth', each job spinning for
+    // the specified 'work' iterations, wait until all have completed, and
+    // return the elapsed time in seconds.  Note that completion is detected
+    // by counting jobs rather than by calling 'drain', because
+    // 'bdlmt::ThreadPool::drain' disables the enqueuing of the child jobs.
+{
+    bsls::AtomicInt remaining((2 << depth) - 1);
+
+    bsls::Stopwatch timer;
+    timer.start();
+
+    pool->enqueueJob(bdlf::BindUtil::bind(&spawnSpinTree<POOL>,
+                                          pool,
+                                          &remaining,
+                                          depth,
+                                          work));
+    while (remaining) {
+        bslmt::ThreadUtil::yield();
+    }
+    return timer.elapsedTime();
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recursive Divide-and-Conquer
+///- - - - - - - - - - - - - - - - - - - -
+// Work-stealing pools are well suited to jobs that spawn further jobs.  In
+// this example we sum the elements of an array by recursively splitting it in
+// halves, each half being summed by a separate job, until the sub-ranges are
+// small enough to be summed directly.
+//
+// First, we define the state shared by all the jobs, and the job function
+// itself:
+//..
+    struct SumContext {
+        bdlmt::WorkStealingThreadPool *d_pool_p;   // pool running the jobs
+        const int                     *d_data_p;   // data to sum
+        bsls::AtomicInt64              d_sum;      // accumulated sum
+    };
+
+    void sumRange(SumContext *context, int begin, int end)
+    {
+        enum { k_GRAIN = 1024 };
+
+        while (end - begin > k_GRAIN) {
+            const int middle = begin + (end - begin) / 2;
+//..
+// Since this function is executing on one of the processing threads of the
+// pool, the following job is placed onto the local queue of the current
+// thread, and is available to be stolen by idle threads:
+//..
+            context->d_pool_p->enqueueJob(
+                        bdlf::BindUtil::bind(&sumRange, context, middle, end));
+            end = middle;
+        }
+
+        bsls::Types::Int64 sum = 0;
+        for (int i = begin; i < end; ++i) {
+            sum += context->d_data_p[i];
+        }
+        context->d_sum.add(sum);
+    }
+//..
+
+}  // close namespace USAGE_EXAMPLE
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVerbose);
+
+    switch (test) { case 0:  // case 0 is always the first case
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace USAGE_EXAMPLE;
+
+// Then, we create a pool having four processing threads and start it:
+//..
+    bdlmt::WorkStealingThreadPool pool(4);
+    int rc = pool.start();
+    ASSERT(0 == rc);
+//..
+// Next, we create the data to sum, and enqueue the root job:
+//..
+    bsl::vector<int> data(1 << 20, 1);
+
+    SumContext context;
+    context.d_pool_p = &pool;
+    context.d_data_p = data.data();
+
+    pool.enqueueJob(bdlf::BindUtil::bind(&sumRange,
+                                         &context,
+                                         0,
+                                         static_cast<int>(data.size())));
+//..
+// Finally, we wait for all the jobs, including the ones enqueued by other
+// jobs, to complete, and verify the result:
+//..
+    pool.drain();
+    ASSERT(static_cast<bsls::Types::Int64>(data.size()) == context.d_sum);
+
+    pool.stop();
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING SYNCHRONOUS SIGNALS
+        //
+        // Concerns:
+        //: 1 The processing threads block all asynchronous signals, and leave
+        //:   the synchronous signals unblocked.
+        //
+        // Plan:
+        //: 1 Enqueue a job that verifies the signal mask of the thread it is
+        //:   running on.  (C-1)
+        //
+        // Testing:
+        //   TESTING SYNCHRONOUS SIGNALS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING SYNCHRONOUS SIGNALS" << endl
+                          << "===========================" << endl;
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+        Obj mX(2, &ta);
+        ASSERT(0 == mX.start());
+        for (int i = 0; i < 4; ++i) {
+            ASSERT(0 == mX.enqueueJob(&testSynchronousSignals, 0));
+        }
+        mX.stop();
+#endif
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING JOBS ENQUEUING OTHER JOBS
+        //
+        // Concerns:
+        //: 1 Jobs enqueued from within a job are executed exactly once.
+        //:
+        //: 2 'drain' waits for the jobs enqueued by the jobs being drained.
+        //:
+        //: 3 Jobs enqueued from a processing thread of another pool are
+        //:   accepted and executed.
+        //
+        // Plan:
+        //: 1 For a varying number of threads, enqueue a job spawning a binary
+        //:   tree of jobs, drain the pool, and verify the number of jobs that
+        //:   were executed.  (C-1..2)
+        //:
+        //: 2 Enqueue, from a job running in one pool, jobs onto a second pool,
+        //:   and verify they are executed.  (C-3)
+        //
+        // Testing:
+        //   TESTING JOBS ENQUEUING OTHER JOBS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING JOBS ENQUEUING OTHER JOBS" << endl
+                          << "=================================" << endl;
+
+        const int DEPTH = 12;
+        const int NUM_JOBS = (2 << DEPTH) - 1;
+
+        for (int numThreads = 1; numThreads <= 8; ++numThreads) {
+            Obj mX(numThreads, &ta);  const Obj& X = mX;
+            ASSERT(0 == mX.start());
+
+            for (int iteration = 0; iteration < 3; ++iteration) {
+                bsls::AtomicInt counter(0);
+
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&spawnTree,
+                                                               &mX,
+                                                               &counter,
+                                                               DEPTH)));
+                mX.drain();
+
+                LOOP2_ASSERT(numThreads, counter, NUM_JOBS == counter);
+                LOOP_ASSERT(numThreads, 0 == X.numPendingJobs());
+            }
+            mX.stop();
+            ASSERT(0 == X.numThreadsStarted());
+        }
+
+        if (verbose) cout << "\tEnqueuing from another pool." << endl;
+        {
+            Obj mX(2, &ta);
+            Obj mY(3, &ta);
+            ASSERT(0 == mX.start());
+            ASSERT(0 == mY.start());
+
+            bsls::AtomicInt counter(0);
+
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&spawnTree,
+                                                           &mY,
+                                                           &counter,
+                                                           4)));
+            mX.drain();
+            mY.drain();
+
+            ASSERT(31 == counter);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'disable', 'enable', AND 'shutdown'
+        //
+        // Concerns:
+        //: 1 'enqueueJob' fails while the pool is disabled, and succeeds
+        //:   after it is re-enabled.
+        //:
+        //: 2 'shutdown' discards the pending jobs without executing them,
+        //:   waits for the active jobs to complete, and joins the threads.
+        //:
+        //: 3 The pool can be restarted after 'shutdown'.
+        //
+        // Plan:
+        //: 1 Disable a started pool, verify that enqueuing fails, re-enable
+        //:   it and verify that enqueuing succeeds.  (C-1)
+        //:
+        //: 2 Block all the processing threads in jobs waiting on a barrier,
+        //:   enqueue additional jobs, and call 'shutdown' from a separate
+        //:   thread.  Release the blocked jobs, and verify that only they were
+        //:   executed.  (C-2)
+        //:
+        //: 3 Restart the pool and verify that jobs are executed.  (C-3)
+        //
+        // Testing:
+        //   void disable();
+        //   void enable();
+        //   void shutdown();
+        //   bool isEnabled() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'disable', 'enable', AND 'shutdown'"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        const int NUM_THREADS = 3;
+
+        Obj mX(NUM_THREADS, &ta);  const Obj& X = mX;
+
+        ASSERT(false == X.isEnabled());
+
+        bsls::AtomicInt counter(0);
+        ASSERT(0 != mX.enqueueJob(&incrementCounter, &counter));
+
+        ASSERT(0 == mX.start());
+        ASSERT(true == X.isEnabled());
+
+        mX.disable();
+        ASSERT(false == X.isEnabled());
+        ASSERT(0 != mX.enqueueJob(&incrementCounter, &counter));
+
+        mX.enable();
+        ASSERT(true == X.isEnabled());
+        ASSERT(0 == mX.enqueueJob(&incrementCounter, &counter));
+        mX.drain();
+        ASSERT(1 == counter);
+
+        counter = 0;
+
+        bslmt::Barrier barrier(NUM_THREADS + 1);
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&waitOnBarrier,
+                                                           &barrier,
+                                                           &counter)));
+        }
+        barrier.wait();  // all threads are now busy
+
+        ASSERT(NUM_THREADS == X.numActiveThreads());
+
+        const int NUM_EXTRA = 100;
+        for (int i = 0; i < NUM_EXTRA; ++i) {
+            ASSERT(0 == mX.enqueueJob(&incrementCounter, &counter));
+        }
+        ASSERT(NUM_EXTRA == X.numPendingJobs());
+
+        bslmt::ThreadUtil::Handle handle;
+        ASSERT(0 == bslmt::ThreadUtil::create(
+                                 &handle,
+                                 bdlf::BindUtil::bind(&Obj::shutdown, &mX)));
+
+        while (X.isEnabled()) {
+            bslmt::ThreadUtil::yield();
+        }
+        barrier.wait();  // release the blocked jobs
+
+        ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+        LOOP_ASSERT(counter, NUM_THREADS == counter);
+        ASSERT(0 == X.numPendingJobs());
+        ASSERT(0 == X.numActiveThreads());
+        ASSERT(0 == X.numThreadsStarted());
+        ASSERT(false == X.isStarted());
+
+        ASSERT(0 == mX.start());
+        ASSERT(0 == mX.enqueueJob(&incrementCounter, &counter));
+        mX.stop();
+        ASSERT(NUM_THREADS + 1 == counter);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'enqueueJob' AND 'drain'
+        //
+        // Concerns:
+        //: 1 Jobs enqueued from outside the pool, using either overload of
+        //:   'enqueueJob', are each executed exactly once.
+        //:
+        //: 2 'drain' waits until all the jobs have completed, and leaves the
+        //:   pool running.
+        //:
+        //: 3 'numPendingJobs' and 'numActiveThreads' reflect the state of the
+        //:   pool.
+        //
+        // Plan:
+        //: 1 For a varying number of threads, enqueue a number of jobs
+        //:   incrementing a counter, drain, and verify the counter.  (C-1..2)
+        //:
+        //: 2 Block all the threads on a barrier, and verify the accessors.
+        //:   (C-3)
+        //
+        // Testing:
+        //   int enqueueJob(const Job& functor);
+        //   int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+        //   void drain();
+        //   int numActiveThreads() const;
+        //   int numPendingJobs() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'enqueueJob' AND 'drain'" << endl
+                          << "================================" << endl;
+
+        const int NUM_JOBS = 10000;
+
+        for (int numThreads = 1; numThreads <= 8; ++numThreads) {
+            Obj mX(numThreads, &ta);  const Obj& X = mX;
+            ASSERT(0 == mX.start());
+
+            bsls::AtomicInt counter(0);
+            const Obj::Job  job(bdlf::BindUtil::bind(&incrementCounter,
+                                                     (void *)&counter));
+
+            for (int i = 0; i < NUM_JOBS; ++i) {
+                if (i % 2) {
+                    ASSERT(0 == mX.enqueueJob(job));
+                }
+                else {
+                    ASSERT(0 == mX.enqueueJob(&incrementCounter, &counter));
+                }
+            }
+            mX.drain();
+            LOOP2_ASSERT(numThreads, counter, NUM_JOBS == counter);
+            ASSERT(0 == X.numPendingJobs());
+            ASSERT(X.isStarted());
+
+            // Block every thread.
+
+            bslmt::Barrier  barrier(numThreads + 1);
+            bsls::AtomicInt blocked(0);
+            for (int i = 0; i < numThreads; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&waitOnBarrier,
+                                                               &barrier,
+                                                               &blocked)));
+            }
+            barrier.wait();
+            LOOP_ASSERT(numThreads, numThreads == X.numActiveThreads());
+
+            ASSERT(0 == mX.enqueueJob(job));
+            ASSERT(1 == X.numPendingJobs());
+
+            barrier.wait();
+            mX.drain();
+            ASSERT(numThreads == blocked);
+            ASSERT(NUM_JOBS + 1 == counter);
+            ASSERT(0 == X.numPendingJobs());
+            ASSERT(0 == X.numActiveThreads());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS, 'start', AND 'stop'
+        //
+        // Concerns:
+        //: 1 The pool is created stopped and disabled, with the specified
+        //:   number of threads.
+        //:
+        //: 2 'start' starts 'numThreads()' threads, and is idempotent.
+        //:
+        //: 3 'stop' executes the pending jobs before joining the threads.
+        //:
+        //: 4 The pool can be started again after 'stop'.
+        //:
+        //: 5 All memory is supplied by the specified allocator.
+        //
+        // Plan:
+        //: 1 Create pools with each constructor and verify the accessors,
+        //:   start and stop them repeatedly, and verify the jobs enqueued
+        //:   before 'stop' are all executed.  (C-1..5)
+        //
+        // Testing:
+        //   WorkStealingThreadPool(int, bslma::Allocator *);
+        //   WorkStealingThreadPool(const ThreadAttributes&, int, Allocator *);
+        //   ~WorkStealingThreadPool();
+        //   int start();
+        //   void stop();
+        //   bool isStarted() const;
+        //   int numThreads() const;
+        //   int numThreadsStarted() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CREATORS, 'start', AND 'stop'" << endl
+                          << "=====================================" << endl;
+
+        bslmt::ThreadAttributes attributes;
+
+        for (int numThreads = 1; numThreads <= 8; ++numThreads) {
+            for (int ctor = 0; ctor < 2; ++ctor) {
+                {
+                    Obj *objPtr = ctor
+                                ? new (ta) Obj(attributes, numThreads, &ta)
+                                : new (ta) Obj(numThreads, &ta);
+                    Obj& mX = *objPtr;  const Obj& X = mX;
+
+                    ASSERT(numThreads == X.numThreads());
+                    ASSERT(0          == X.numThreadsStarted());
+                    ASSERT(false      == X.isStarted());
+                    ASSERT(false      == X.isEnabled());
+                    ASSERT(0          <  ta.numBlocksInUse());
+
+                    for (int iteration = 0; iteration < 3; ++iteration) {
+                        ASSERT(0 == mX.start());
+                        ASSERT(0 == mX.start());
+
+                        ASSERT(numThreads == X.numThreadsStarted());
+                        ASSERT(true       == X.isStarted());
+                        ASSERT(true       == X.isEnabled());
+
+                        bsls::AtomicInt counter(0);
+                        for (int i = 0; i < 1000; ++i) {
+                            ASSERT(0 == mX.enqueueJob(&incrementCounter,
+                                                      &counter));
+                        }
+                        mX.stop();
+
+                        LOOP2_ASSERT(numThreads, counter, 1000 == counter);
+                        ASSERT(0     == X.numThreadsStarted());
+                        ASSERT(false == X.isStarted());
+                        ASSERT(false == X.isEnabled());
+                    }
+
+                    ta.deleteObject(objPtr);
+                }
+                ASSERT(0 == ta.numBlocksInUse());
+            }
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a pool, start it, enqueue a few jobs, drain it and stop
+        //:   it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(4, &ta);  const Obj& X = mX;
+
+        ASSERT(4 == X.numThreads());
+        ASSERT(0 == mX.start());
+        ASSERT(4 == X.numThreadsStarted());
+
+        bsls::AtomicInt counter(0);
+        for (int i = 0; i < 100; ++i) {
+            ASSERT(0 == mX.enqueueJob(&incrementCounter, &counter));
+        }
+        mX.drain();
+        ASSERT(100 == counter);
+
+        mX.stop();
+        ASSERT(0 == X.numThreadsStarted());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE COMPARISON WITH 'ThreadPool' AND 'FixedThreadPool'
+        //
+        // Concerns:
+        //: 1 The throughput of the work-stealing pool scales with the number
+        //:   of threads better than that of the single-queue pools.
+        //
+        // Plan:
+        //: 1 For a number of threads doubling from 1 to a maximum (by default
+        //:   32, or as specified by the optional second argument), measure
+        //:   the elapsed time of two workloads on each of the three pools: a
+        //:   "flat" workload where many short jobs are enqueued from the main
+        //:   thread, and a "tree" workload where each job enqueues two child
+        //:   jobs.  The amount of work per job may be specified by the
+        //:   optional third argument.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE COMPARISON WITH 'ThreadPool' AND 'FixedThreadPool'
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE COMPARISON WITH 'ThreadPool' AND "
+             << "'FixedThreadPool'" << endl
+             << "============================================="
+             << "=================" << endl;
+
+        const int MAX_THREADS = argc > 2 ? atoi(argv[2]) : 32;
+        const int WORK        = argc > 3 ? atoi(argv[3]) : 100;
+        const int NUM_JOBS    = 1000 * 1000;
+        const int DEPTH       = 19;   // 2^20 - 1 jobs
+
+        bslmt::ThreadAttributes attributes;
+
+        cout << "threads"
+             << "\tflat:ws\tflat:tp\tflat:ftp"
+             << "\ttree:ws\ttree:tp\ttree:ftp" << endl;
+
+        for (int numThreads = 1; numThreads <= MAX_THREADS; numThreads *= 2) {
+            double flat[3], tree[3];
+            {
+                Obj pool(attributes, numThreads);
+                pool.start();
+                tree[0] = runTree(&pool, DEPTH, WORK);
+                flat[0] = runFlat(&pool, NUM_JOBS, WORK);
+                pool.stop();
+            }
+            {
+                bdlmt::ThreadPool pool(attributes,
+                                       numThreads,
+                                       numThreads,
+                                       1000);
+                pool.start();
+                tree[1] = runTree(&pool, DEPTH, WORK);
+                flat[1] = runFlat(&pool, NUM_JOBS, WORK);
+                pool.stop();
+            }
+            {
+                bdlmt::FixedThreadPool pool(attributes,
+                                            numThreads,
+                                            1 << 21);
+                pool.start();
+                tree[2] = runTree(&pool, DEPTH, WORK);
+                flat[2] = runFlat(&pool, NUM_JOBS, WORK);
+                pool.stop();
+            }
+
+            cout << numThreads
+                 << '\t' << flat[0] << '\t' << flat[1] << '\t' << flat[2]
+                 << '\t' << tree[0] << '\t' << tree[1] << '\t' << tree[2]
+                 << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -740,6 +740,83 @@ int FilesystemUtil::sync(char *address, int numBytes, bool)
     return FlushViewOfFile(address, numBytes) ? 0 : -1;
 }
 
+int FilesystemUtil::mapRegion(FileDescriptor   descriptor,
+                              void           **address,
+                              Offset           offset,
+                              bsl::size_t      size,
+                              MappingMode      mode)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(0 < size);
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(0 == offset % MemoryUtil::pageSize());
+
+    static const DWORD protect[] = {
+        PAGE_READONLY,   // e_MAP_READ_ONLY
+        PAGE_WRITECOPY,  // e_MAP_COPY_ON_WRITE
+        PAGE_READWRITE   // e_MAP_SHARED
+    };
+    static const DWORD access[] = {
+        FILE_MAP_READ,   // e_MAP_READ_ONLY
+        FILE_MAP_COPY,   // e_MAP_COPY_ON_WRITE
+        FILE_MAP_WRITE   // e_MAP_SHARED
+    };
+
+    const bsls::Types::Uint64 maxLength = offset + size;
+
+    HANDLE hMap = CreateFileMapping(descriptor,
+                                    NULL,
+                                    protect[mode],
+                                    static_cast<DWORD>(maxLength >> 32),
+                                    static_cast<DWORD>(maxLength & 0xFFFFFFFF),
+                                    NULL);
+    if (NULL == hMap) {
+        *address = 0;
+        return -1;                                                    // RETURN
+    }
+
+    // The view keeps the mapping object alive after its handle is closed.
+
+    *address = MapViewOfFile(hMap,
+                             access[mode],
+                             static_cast<DWORD>(offset >> 32),
+                             static_cast<DWORD>(offset & 0xFFFFFFFF),
+                             size);
+    CloseHandle(hMap);
+
+    return 0 == *address ? -1 : 0;
+}
+
+int FilesystemUtil::unmapRegion(void *address, bsl::size_t)
+{
+    BSLS_ASSERT(address);
+
+    return UnmapViewOfFile(address) ? 0 : -1;
+}
+
+int FilesystemUtil::syncRegion(void *address, bsl::size_t numBytes, bool)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(0 == reinterpret_cast<bsls::Types::UintPtr>(address) %
+                     MemoryUtil::pageSize());
+
+    // As in 'sync', 'FlushViewOfFile' does not distinguish between
+    // synchronous and asynchronous flushing.
+
+    return FlushViewOfFile(address, numBytes) ? 0 : -1;
+}
+
+int FilesystemUtil::adviseRegion(void *address, bsl::size_t, MappingAdvice)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(0 == reinterpret_cast<bsls::Types::UintPtr>(address) %
+                     MemoryUtil::pageSize());
+
+    // Access hints are not supported on all of our Windows platforms.
+
+    return 0;
+}
+
 int FilesystemUtil::lock(FileDescriptor descriptor, bool lockWrite)
 {
     OVERLAPPED overlapped;
@@ -1608,6 +1685,88 @@ int FilesystemUtil::sync(char *address, int numBytes, bool syncFlag)
     return 0 == rc ? 0 : errno;
 }
 
+int FilesystemUtil::mapRegion(FileDescriptor   descriptor,
+                              void           **address,
+                              Offset           offset,
+                              bsl::size_t      size,
+                              MappingMode      mode)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(0 < size);
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(0 == offset % MemoryUtil::pageSize());
+
+    const int protect = e_MAP_READ_ONLY == mode
+                        ? PROT_READ
+                        : PROT_READ | PROT_WRITE;
+    const int flags   = e_MAP_COPY_ON_WRITE == mode
+                        ? MAP_PRIVATE
+                        : MAP_SHARED;
+
+#if defined(BSLS_PLATFORM_OS_FREEBSD) || defined(BSLS_PLATFORM_OS_DARWIN) \
+ || defined(BSLS_PLATFORM_OS_CYGWIN)
+    *address = mmap(0, size, protect, flags, descriptor, offset);
+#else
+    *address = mmap64(0, size, protect, flags, descriptor, offset);
+#endif
+
+    if (MAP_FAILED == *address) {
+        *address = 0;
+        return -1;                                                    // RETURN
+    }
+    return 0;
+}
+
+int FilesystemUtil::unmapRegion(void *address, bsl::size_t size)
+{
+    BSLS_ASSERT(address);
+
+    return munmap(static_cast<char *>(address), size);
+}
+
+int FilesystemUtil::syncRegion(void        *address,
+                               bsl::size_t  numBytes,
+                               bool         syncFlag)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(0 == reinterpret_cast<bsls::Types::UintPtr>(address) %
+                     MemoryUtil::pageSize());
+
+    int rc = ::msync(static_cast<char *>(address),
+                     numBytes,
+                     syncFlag ? MS_SYNC : MS_ASYNC);
+
+    // See 'sync' regarding the returned value.
+
+    return 0 == rc ? 0 : errno;
+}
+
+int FilesystemUtil::adviseRegion(void          *address,
+                                 bsl::size_t    numBytes,
+                                 MappingAdvice  advice)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(0 == reinterpret_cast<bsls::Types::UintPtr>(address) %
+                     MemoryUtil::pageSize());
+
+    // 'posix_madvise' is used rather than 'madvise' because it is never
+    // destructive: 'madvise(MADV_DONTNEED)' discards the modifications of a
+    // copy-on-write mapping on Linux.
+
+    static const int adviceMap[] = {
+        POSIX_MADV_NORMAL,      // e_ADVICE_NORMAL
+        POSIX_MADV_SEQUENTIAL,  // e_ADVICE_SEQUENTIAL
+        POSIX_MADV_RANDOM,      // e_ADVICE_RANDOM
+        POSIX_MADV_WILLNEED,    // e_ADVICE_WILL_NEED
+        POSIX_MADV_DONTNEED     // e_ADVICE_DONT_NEED
+    };
+
+    // Note that 'posix_madvise' returns an error number rather than setting
+    // 'errno'.
+
+    return ::posix_madvise(address, numBytes, adviceMap[advice]);
+}
+
 int FilesystemUtil::tryLock(FileDescriptor descriptor, bool lockWriteFlag)
 {
     int rc = localFcntlLock(descriptor,
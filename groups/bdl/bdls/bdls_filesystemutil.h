@@ -20,7 +20,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bdls::FilesystemUtil: namespace for filesystem access methods
 //
-//@SEE_ALSO: bdls_pathutil
+//@SEE_ALSO: bdls_pathutil, bdls_mappedregion
 //
 //@DESCRIPTION: This component provides a platform-independent interface to
 // filesystem utility methods, supporting multi-language file and path names.
@@ -109,6 +109,30 @@ BSLS_IDENT("$Id: $")
 //: 'e_SEEK_FROM_END':
 //:   Seek from the end of the file.
 //
+///Memory-Mapped Files
+///-------------------
+// 'mapRegion' maps a region of an open file into memory, 'unmapRegion'
+// removes such a mapping, 'syncRegion' writes modifications of a shared
+// mapping back to the file, and 'adviseRegion' tells the operating system how
+// the mapped pages will be accessed.  'mapRegion' is governed by
+// 'bdls::FilesystemUtil::MappingMode':
+//
+//: 'e_MAP_READ_ONLY':
+//:   The mapped pages may only be read.
+//:
+//: 'e_MAP_COPY_ON_WRITE':
+//:   The mapped pages may be read and written, but each page is copied when
+//:   it is first written, so modifications are never seen by other mappings
+//:   or written to the file.
+//:
+//: 'e_MAP_SHARED':
+//:   The mapped pages may be read and written, and modifications are shared
+//:   with other mappings of the file and eventually written to the file.
+//
+// Clients usually manage a mapping with 'bdls::MappedRegion', which unmaps
+// the region on destruction.  (The older 'map', 'unmap', and 'sync' methods
+// always create shared mappings, and are limited to 'int' sizes.)
+//
 ///Platform-Specific File Locking Caveats
 ///--------------------------------------
 // Locking has the following caveats for the following operating systems:
@@ -445,6 +469,40 @@ struct FilesystemUtil {
         e_KEEP       // Keep the file's contents.
     };
 
+    enum MappingMode {
+        // Enumeration used to distinguish between the ways in which a region
+        // of a file may be mapped into memory by 'mapRegion'.
+
+        e_MAP_READ_ONLY,      // Map for reading only.
+
+        e_MAP_COPY_ON_WRITE,  // Map for reading and writing; modifications
+                              // are private to the mapping, and are never
+                              // written to the file.
+
+        e_MAP_SHARED          // Map for reading and writing; modifications
+                              // are visible to other mappings of the file,
+                              // and are written to the file.
+    };
+
+    enum MappingAdvice {
+        // Enumeration used to describe the expected pattern of access to a
+        // mapped region, supplied as a hint to 'adviseRegion'.
+
+        e_ADVICE_NORMAL,      // No particular access pattern.
+
+        e_ADVICE_SEQUENTIAL,  // Pages will be accessed in increasing order;
+                              // read ahead aggressively.
+
+        e_ADVICE_RANDOM,      // Pages will be accessed in random order; do
+                              // not read ahead.
+
+        e_ADVICE_WILL_NEED,   // Pages will be accessed soon; start reading
+                              // them in.
+
+        e_ADVICE_DONT_NEED    // Pages will not be accessed soon; their
+                              // resident memory may be reclaimed.
+    };
+
     // CLASS DATA
     static const FileDescriptor k_INVALID_FD;  // 'FileDescriptor' value
                                                // representing no file, used
@@ -812,6 +870,56 @@ struct FilesystemUtil {
         // 'address' is aligned on a page boundary, 'numBytes' is a multiple of
         // 'pageSize()', and '0 <= numBytes'.
 
+    static int mapRegion(FileDescriptor   descriptor,
+                         void           **address,
+                         Offset           offset,
+                         bsl::size_t      size,
+                         MappingMode      mode);
+        // Map the region of the specified 'size' bytes, starting at the
+        // specified 'offset' bytes into the file with the specified
+        // 'descriptor', to memory as described by the specified 'mode', and
+        // load into the specified 'address' the address of the mapped area.
+        // Return 0 on success, and a non-zero value otherwise.  On failure,
+        // '*address' is set to 0.  The behavior is undefined unless '0 < size'
+        // and 'offset' is a non-negative multiple of
+        // 'MemoryUtil::pageSize()'.  Note that 'descriptor' must have been
+        // opened for reading, and additionally for writing if 'mode' is
+        // 'e_MAP_SHARED'.  Also note that, unlike 'map', 'size' may exceed
+        // the range of 'int', and the region is mapped privately if 'mode' is
+        // 'e_MAP_COPY_ON_WRITE'.  Also note that accessing the mapped memory
+        // beyond the end of the file results in undefined behavior.
+
+    static int unmapRegion(void *address, bsl::size_t size);
+        // Unmap the memory mapping with the specified base 'address' and
+        // specified 'size'.  Return 0 on success, and a non-zero value
+        // otherwise.  The behavior is undefined unless 'address' and 'size'
+        // describe a region previously mapped by a call to 'mapRegion'.
+
+    static int syncRegion(void *address, bsl::size_t numBytes, bool syncFlag);
+        // Write any modifications of the specified 'numBytes' of mapped memory
+        // beginning at the specified 'address' to the underlying file.  If the
+        // specified 'syncFlag' is 'true', block until the writes have
+        // completed, and otherwise return once they have been scheduled.
+        // Return 0 on success, and a non-zero value otherwise.  The behavior
+        // is undefined unless 'address' is aligned on a
+        // 'MemoryUtil::pageSize()' boundary and lies within a region mapped
+        // by 'mapRegion'.  Note that, unlike 'sync', 'numBytes' need not be a
+        // multiple of the page size.  Also note that this operation has no
+        // effect on regions mapped with 'e_MAP_COPY_ON_WRITE'.
+
+    static int adviseRegion(void          *address,
+                            bsl::size_t    numBytes,
+                            MappingAdvice  advice);
+        // Advise the operating system that the specified 'numBytes' of mapped
+        // memory beginning at the specified 'address' will be accessed as
+        // described by the specified 'advice'.  Return 0 on success, and a
+        // non-zero value otherwise.  The behavior is undefined unless
+        // 'address' is aligned on a 'MemoryUtil::pageSize()' boundary and
+        // lies within a region mapped by 'mapRegion'.  Note that the advice
+        // is only a hint: it never changes the contents of the mapped memory,
+        // and platforms that cannot act upon it (e.g., Windows) ignore it and
+        // return 0.
+
     static Offset seek(FileDescriptor descriptor, Offset offset, int whence);
         // Set the file pointer associated with the specified 'descriptor'
         // (used by calls to the 'read' and 'write' system calls) according to
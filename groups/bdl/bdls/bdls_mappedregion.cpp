@@ -0,0 +1,163 @@
+// bdls_mappedregion.cpp                                              -*-C++-*-
+#include <bdls_mappedregion.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdls_mappedregion_cpp,"$Id$ $CSID$")
+
+#include <bdls_filedescriptorguard.h>
+#include <bdls_memoryutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_limits.h>
+
+// IMPLEMENTATION NOTES: 'FilesystemUtil::mapRegion' requires an offset
+// aligned on a page boundary (the allocation granularity on Windows), so
+// 'map' rounds the requested offset down to such a boundary, maps the
+// additional leading bytes, and records both the page-aligned mapping
+// ('d_base_p', 'd_mappedSize') and the requested region ('d_data_p',
+// 'd_size').
+
+namespace BloombergLP {
+namespace bdls {
+
+                            // ------------------
+                            // class MappedRegion
+                            // ------------------
+
+// MANIPULATORS
+int MappedRegion::advise(FilesystemUtil::MappingAdvice advice)
+{
+    if (!d_base_p) {
+        return 0;                                                     // RETURN
+    }
+    return FilesystemUtil::adviseRegion(d_base_p, d_mappedSize, advice);
+}
+
+int MappedRegion::map(FilesystemUtil::FileDescriptor descriptor,
+                      FilesystemUtil::Offset         offset,
+                      bsl::size_t                    size,
+                      FilesystemUtil::MappingMode    mode)
+{
+    BSLS_ASSERT(0 <= offset);
+
+    if (0 == size) {
+        unmap();
+        d_mode = mode;
+        return 0;                                                     // RETURN
+    }
+
+    const FilesystemUtil::Offset pageSize   = MemoryUtil::pageSize();
+    const bsl::size_t            adjustment =
+                                  static_cast<bsl::size_t>(offset % pageSize);
+
+    if (size > bsl::numeric_limits<bsl::size_t>::max() - adjustment) {
+        return -1;                                                    // RETURN
+    }
+
+    void *base = 0;
+    int   rc   = FilesystemUtil::mapRegion(descriptor,
+                                           &base,
+                                           offset - adjustment,
+                                           size + adjustment,
+                                           mode);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    unmap();
+
+    d_base_p     = base;
+    d_mappedSize = size + adjustment;
+    d_data_p     = static_cast<char *>(base) + adjustment;
+    d_size       = size;
+    d_mode       = mode;
+
+    return 0;
+}
+
+int MappedRegion::mapFile(const char                  *path,
+                          FilesystemUtil::MappingMode  mode)
+{
+    BSLS_ASSERT(path);
+
+    FilesystemUtil::FileDescriptor descriptor = FilesystemUtil::open(
+                                 path,
+                                 FilesystemUtil::e_OPEN,
+                                 FilesystemUtil::e_MAP_SHARED == mode
+                                 ? FilesystemUtil::e_READ_WRITE
+                                 : FilesystemUtil::e_READ_ONLY);
+    if (FilesystemUtil::k_INVALID_FD == descriptor) {
+        return -1;                                                    // RETURN
+    }
+
+    FileDescriptorGuard guard(descriptor);
+
+    const FilesystemUtil::Offset fileSize = FilesystemUtil::seek(
+                                          descriptor,
+                                          0,
+                                          FilesystemUtil::e_SEEK_FROM_END);
+    if (fileSize < 0
+     || static_cast<bsls::Types::Uint64>(fileSize) >
+                                    bsl::numeric_limits<bsl::size_t>::max()) {
+        return -1;                                                    // RETURN
+    }
+
+    return map(descriptor, 0, static_cast<bsl::size_t>(fileSize), mode);
+}
+
+void MappedRegion::swap(MappedRegion& other)
+{
+    using bsl::swap;
+
+    swap(d_base_p,     other.d_base_p);
+    swap(d_mappedSize, other.d_mappedSize);
+    swap(d_data_p,     other.d_data_p);
+    swap(d_size,       other.d_size);
+    swap(d_mode,       other.d_mode);
+}
+
+int MappedRegion::sync(bool syncFlag)
+{
+    if (!d_base_p) {
+        return 0;                                                     // RETURN
+    }
+    return FilesystemUtil::syncRegion(d_base_p, d_mappedSize, syncFlag);
+}
+
+int MappedRegion::unmap()
+{
+    if (!d_base_p) {
+        return 0;                                                     // RETURN
+    }
+
+    int rc = FilesystemUtil::unmapRegion(d_base_p, d_mappedSize);
+
+    d_base_p     = 0;
+    d_mappedSize = 0;
+    d_data_p     = 0;
+    d_size       = 0;
+
+    return rc;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
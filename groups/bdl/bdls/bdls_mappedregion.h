@@ -0,0 +1,341 @@
+// bdls_mappedregion.h                                                -*-C++-*-
+#ifndef INCLUDED_BDLS_MAPPEDREGION
+#define INCLUDED_BDLS_MAPPEDREGION
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a RAII type managing a memory-mapped region of a file.
+//
+//@CLASSES:
+//  bdls::MappedRegion: owner of a memory-mapped region of a file
+//
+//@SEE_ALSO: bdls_filesystemutil, bdls_memoryutil
+//
+//@DESCRIPTION: This component defines a class, 'bdls::MappedRegion', an object
+// of which owns a region of a file that has been mapped into memory, and
+// unmaps it when the object is destroyed.  A region is mapped with one of the
+// modes of 'bdls::FilesystemUtil::MappingMode':
+//
+//: 'e_MAP_READ_ONLY':
+//:   The region may only be read.
+//:
+//: 'e_MAP_COPY_ON_WRITE':
+//:   The region may be read and written, but modifications are private to the
+//:   region and are never written to the file.
+//:
+//: 'e_MAP_SHARED':
+//:   The region may be read and written, and modifications are written to the
+//:   file (see 'sync').
+//
+// A region can be mapped from an open file descriptor at any offset (which,
+// unlike the offset supplied to 'bdls::FilesystemUtil::mapRegion', need not be
+// aligned on a page boundary), or a whole file can be mapped by name with
+// 'mapFile', which opens the file, maps it, and closes it again (the mapping
+// remains valid after the file is closed).
+//
+// The 'advise' method forwards an access-pattern hint (e.g.,
+// 'bdls::FilesystemUtil::e_ADVICE_SEQUENTIAL') to the operating system for
+// the pages of the region.
+//
+///Mapping Instead of Reading
+///--------------------------
+// Reading a large file into a heap buffer costs a copy of every byte, and
+// keeps every byte resident for the lifetime of the buffer.  Mapping the file
+// instead makes its contents available immediately: pages are read from the
+// file (or found in the operating system's page cache, and shared with other
+// processes mapping the same file) only when they are first accessed, and
+// pages of a read-only or unmodified mapping can be reclaimed by the operating
+// system under memory pressure without being written to swap.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Scanning a Data File
+///- - - - - - - - - - - - - - - -
+// Suppose we have a large reference-data file that we want to scan once at
+// startup without reading it into a heap buffer.
+//
+// First, we create a file to scan:
+//..
+//  typedef bdls::FilesystemUtil Util;
+//
+//  const char *fileName = "mappedregion_example.dat";
+//
+//  Util::FileDescriptor fd = Util::open(fileName,
+//                                       Util::e_OPEN_OR_CREATE,
+//                                       Util::e_READ_WRITE,
+//                                       Util::e_TRUNCATE);
+//  assert(Util::k_INVALID_FD != fd);
+//
+//  const char data[] = "AAPL,MSFT,IBM\n";
+//  assert(sizeof data - 1 == Util::write(fd, data, sizeof data - 1));
+//  Util::close(fd);
+//..
+// Then, we map the whole file for reading, and tell the operating system that
+// we will scan it sequentially:
+//..
+//  bdls::MappedRegion region;
+//
+//  int rc = region.mapFile(fileName, Util::e_MAP_READ_ONLY);
+//  assert(0 == rc);
+//  assert(region.isMapped());
+//  assert(sizeof data - 1 == region.size());
+//
+//  region.advise(Util::e_ADVICE_SEQUENTIAL);
+//..
+// Now, we scan the contents of the file directly from the mapped memory:
+//..
+//  int numCommas = 0;
+//  for (bsl::size_t i = 0; i < region.size(); ++i) {
+//      if (',' == region.data()[i]) {
+//          ++numCommas;
+//      }
+//  }
+//  assert(2 == numCommas);
+//..
+// Finally, we unmap the region (which the destructor would otherwise do for
+// us) and remove the file:
+//..
+//  region.unmap();
+//  assert(!region.isMapped());
+//
+//  Util::remove(fileName);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLS_FILESYSTEMUTIL
+#include <bdls_filesystemutil.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_STRING
+#include <bsl_string.h>
+#endif
+
+namespace BloombergLP {
+namespace bdls {
+
+                            // ==================
+                            // class MappedRegion
+                            // ==================
+
+class MappedRegion {
+    // This class owns a region of a file mapped into memory, and unmaps the
+    // region upon destruction.  A 'MappedRegion' that does not own a mapping
+    // is *empty*.  This class is not copyable, but the ownership of mappings
+    // can be exchanged with 'swap'.
+
+    // DATA
+    void                        *d_base_p;      // page-aligned address of
+                                                // the mapping, or 0 if empty
+
+    bsl::size_t                  d_mappedSize;  // number of bytes mapped
+                                                // from 'd_base_p'
+
+    char                        *d_data_p;      // address of the first byte
+                                                // of the requested region
+
+    bsl::size_t                  d_size;        // number of bytes in the
+                                                // requested region
+
+    FilesystemUtil::MappingMode  d_mode;        // mode of the mapping
+
+  private:
+    // NOT IMPLEMENTED
+    MappedRegion(const MappedRegion&);
+    MappedRegion& operator=(const MappedRegion&);
+
+  public:
+    // CREATORS
+    MappedRegion();
+        // Create an empty mapped region.
+
+    ~MappedRegion();
+        // Unmap the region owned by this object, if any, and destroy this
+        // object.
+
+    // MANIPULATORS
+    int advise(FilesystemUtil::MappingAdvice advice);
+        // Advise the operating system that the pages of this region will be
+        // accessed as described by the specified 'advice'.  Return 0 on
+        // success, and a non-zero value otherwise.  This method has no effect
+        // and returns 0 if this region is empty.  Note that the advice is only
+        // a hint, and never changes the contents of the region.
+
+    char *data();
+        // Return the address of the first byte of this region, or 0 if this
+        // region is empty.  The behavior is undefined if the memory is
+        // modified and the region was mapped with 'e_MAP_READ_ONLY'.
+
+    int map(FilesystemUtil::FileDescriptor descriptor,
+            FilesystemUtil::Offset         offset,
+            bsl::size_t                    size,
+            FilesystemUtil::MappingMode    mode);
+        // Map the specified 'size' bytes, starting at the specified 'offset'
+        // bytes into the file with the specified 'descriptor', to memory as
+        // described by the specified 'mode', and make this object own the
+        // mapping.  If 'size' is 0, make this object empty.  Return 0 on
+        // success, and a non-zero value otherwise.  On success, any region
+        // previously owned by this object is unmapped; on failure, this object
+        // is unchanged.  The behavior is undefined unless '0 <= offset'.  Note
+        // that 'offset' need not be aligned on a page boundary.  Also note
+        // that 'descriptor' must have been opened for reading, and
+        // additionally for writing if 'mode' is 'e_MAP_SHARED', and that it
+        // may be closed once this method returns.  Also note that accessing
+        // the region beyond the end of the file results in undefined behavior.
+
+    int mapFile(const char                  *path,
+                FilesystemUtil::MappingMode  mode);
+    int mapFile(const bsl::string&           path,
+                FilesystemUtil::MappingMode  mode);
+        // Map the entire contents of the file at the specified 'path' to
+        // memory as described by the specified 'mode', and make this object
+        // own the mapping.  If the file is empty, make this object empty.
+        // Return 0 on success, and a non-zero value otherwise.  On success,
+        // any region previously owned by this object is unmapped; on failure,
+        // this object is unchanged.  Note that the file is opened for reading
+        // (and writing if 'mode' is 'e_MAP_SHARED'), and closed before this
+        // method returns.
+
+    void swap(MappedRegion& other);
+        // Exchange the regions owned by this object and the specified
+        // 'other' object.
+
+    int sync(bool syncFlag = true);
+        // Write any modifications of this region to the underlying file.  If
+        // the optionally specified 'syncFlag' is 'true', block until the
+        // writes have completed, and otherwise return once they have been
+        // scheduled.  Return 0 on success, and a non-zero value otherwise.
+        // This method has no effect and returns 0 if this region is empty.
+        // Note that only regions mapped with 'e_MAP_SHARED' are ever written
+        // to the file.
+
+    int unmap();
+        // Unmap the region owned by this object, if any, and make this object
+        // empty.  Return 0 on success, and a non-zero value otherwise.  Note
+        // that this object is empty after this method returns, even on
+        // failure.
+
+    // ACCESSORS
+    const char *data() const;
+        // Return the address of the first byte of this region, or 0 if this
+        // region is empty.
+
+    bool isMapped() const;
+        // Return 'true' if this object owns a mapping, and 'false' otherwise.
+
+    FilesystemUtil::MappingMode mode() const;
+        // Return the mode with which this region was mapped.  The behavior is
+        // undefined unless 'isMapped()'.
+
+    bsl::size_t size() const;
+        // Return the number of bytes in this region, or 0 if this region is
+        // empty.
+};
+
+// FREE FUNCTIONS
+void swap(MappedRegion& a, MappedRegion& b);
+    // Exchange the regions owned by the specified 'a' and 'b' objects.
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                            // ------------------
+                            // class MappedRegion
+                            // ------------------
+
+// CREATORS
+inline
+MappedRegion::MappedRegion()
+: d_base_p(0)
+, d_mappedSize(0)
+, d_data_p(0)
+, d_size(0)
+, d_mode(FilesystemUtil::e_MAP_READ_ONLY)
+{
+}
+
+inline
+MappedRegion::~MappedRegion()
+{
+    unmap();
+}
+
+// MANIPULATORS
+inline
+char *MappedRegion::data()
+{
+    return d_data_p;
+}
+
+inline
+int MappedRegion::mapFile(const bsl::string&          path,
+                          FilesystemUtil::MappingMode mode)
+{
+    return mapFile(path.c_str(), mode);
+}
+
+// ACCESSORS
+inline
+const char *MappedRegion::data() const
+{
+    return d_data_p;
+}
+
+inline
+bool MappedRegion::isMapped() const
+{
+    return 0 != d_base_p;
+}
+
+inline
+FilesystemUtil::MappingMode MappedRegion::mode() const
+{
+    return d_mode;
+}
+
+inline
+bsl::size_t MappedRegion::size() const
+{
+    return d_size;
+}
+
+}  // close package namespace
+
+// FREE FUNCTIONS
+inline
+void bdls::swap(MappedRegion& a, MappedRegion& b)
+{
+    a.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,867 @@
+// bdls_mappedregion.t.cpp                                            -*-C++-*-
+#include <bdls_mappedregion.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_memoryutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              OVERVIEW
+// A 'bdls::MappedRegion' owns a memory mapping created with
+// 'bdls::FilesystemUtil::mapRegion'.  We need to test that the region exposes
+// exactly the requested bytes of the file for any (including unaligned)
+// offset, that each mapping mode has the documented effect on the underlying
+// file, that the region is unmapped on destruction, on 'unmap', and when it
+// is replaced by a successful 'map', and that a failed 'map' leaves the
+// object unchanged.  The new 'FilesystemUtil' primitives are exercised
+// through this component.
+//
+// In addition to positive test cases (run in the nightly builds), a negative
+// test case -1 can be run manually to compare scanning a file through a
+// mapping with reading it into a heap buffer.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 1] MappedRegion();
+// [ 1] ~MappedRegion();
+//
+// MANIPULATORS
+// [ 4] int advise(FilesystemUtil::MappingAdvice advice);
+// [ 2] char *data();
+// [ 2] int map(FileDescriptor d, Offset o, size_t s, MappingMode m);
+// [ 4] int mapFile(const char *path, MappingMode mode);
+// [ 4] int mapFile(const bsl::string& path, MappingMode mode);
+// [ 4] void swap(MappedRegion& other);
+// [ 3] int sync(bool syncFlag = true);
+// [ 1] int unmap();
+//
+// ACCESSORS
+// [ 2] const char *data() const;
+// [ 1] bool isMapped() const;
+// [ 2] FilesystemUtil::MappingMode mode() const;
+// [ 2] bsl::size_t size() const;
+//
+// FREE FUNCTIONS
+// [ 4] void swap(MappedRegion& a, MappedRegion& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: MAPPING MODES HAVE THE DOCUMENTED EFFECT ON THE FILE
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: MAPPING VS. READING A FILE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdls::MappedRegion   Obj;
+typedef bdls::FilesystemUtil Util;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS  FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+char expectedByte(bsls::Types::Int64 position)
+    // Return the byte expected at the specified 'position' of a file created
+    // by 'createFile'.
+{
+    return static_cast<char>('a' + position % 23);
+}
+
+bsl::string createFile(bsl::size_t size)
+    // Create a temporary file of the specified 'size' bytes, in which the byte
+    // at each position 'i' is 'expectedByte(i)', and return its name.
+{
+    bsl::string                  path;
+    const Util::FileDescriptor   fd = Util::createTemporaryFile(
+                                                      &path,
+                                                      "bdls_mappedregion.t.");
+    ASSERT(Util::k_INVALID_FD != fd);
+
+    bsl::vector<char> buffer(64 * 1024);
+    bsl::size_t       written = 0;
+    while (written < size) {
+        const bsl::size_t n = bsl::min(buffer.size(), size - written);
+        for (bsl::size_t i = 0; i < n; ++i) {
+            buffer[i] = expectedByte(written + i);
+        }
+        ASSERT(static_cast<int>(n) ==
+                           Util::write(fd, &buffer[0], static_cast<int>(n)));
+        written += n;
+    }
+
+    Util::close(fd);
+    return path;
+}
+
+bool verifyRegion(const Obj& region, bsls::Types::Int64 offset)
+    // Return 'true' if every byte of the specified 'region' has the value
+    // written by 'createFile' at its position in the file, given that the
+    // region starts at the specified 'offset' in the file, and 'false'
+    // otherwise.
+{
+    for (bsl::size_t i = 0; i < region.size(); ++i) {
+        if (expectedByte(offset + i) != region.data()[i]) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+char readByte(const bsl::string& path, bsls::Types::Int64 position)
+    // Return the byte at the specified 'position' of the file at the
+    // specified 'path', read without mapping the file.
+{
+    const Util::FileDescriptor fd = Util::open(path,
+                                               Util::e_OPEN,
+                                               Util::e_READ_ONLY);
+    ASSERT(Util::k_INVALID_FD != fd);
+
+    char c = 0;
+    ASSERT(position == Util::seek(fd, position, Util::e_SEEK_FROM_BEGINNING));
+    ASSERT(1 == Util::read(fd, &c, 1));
+    Util::close(fd);
+
+    return c;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // Note that the helper functions use the default allocator, so it is not
+    // checked for use.
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    const int PAGE_SIZE = bdls::MemoryUtil::pageSize();
+
+    switch (test) { case 0:  // case 0 is always the first case
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Scanning a Data File
+///- - - - - - - - - - - - - - - -
+// Suppose we have a large reference-data file that we want to scan once at
+// startup without reading it into a heap buffer.
+//
+// First, we create a file to scan:
+//..
+    typedef bdls::FilesystemUtil Util;
+
+    const char *fileName = "mappedregion_example.dat";
+
+    Util::FileDescriptor fd = Util::open(fileName,
+                                         Util::e_OPEN_OR_CREATE,
+                                         Util::e_READ_WRITE,
+                                         Util::e_TRUNCATE);
+    ASSERT(Util::k_INVALID_FD != fd);
+
+    const char data[] = "AAPL,MSFT,IBM\n";
+    ASSERT(sizeof data - 1 == Util::write(fd, data, sizeof data - 1));
+    Util::close(fd);
+//..
+// Then, we map the whole file for reading, and tell the operating system that
+// we will scan it sequentially:
+//..
+    bdls::MappedRegion region;
+
+    int rc = region.mapFile(fileName, Util::e_MAP_READ_ONLY);
+    ASSERT(0 == rc);
+    ASSERT(region.isMapped());
+    ASSERT(sizeof data - 1 == region.size());
+
+    region.advise(Util::e_ADVICE_SEQUENTIAL);
+//..
+// Now, we scan the contents of the file directly from the mapped memory:
+//..
+    int numCommas = 0;
+    for (bsl::size_t i = 0; i < region.size(); ++i) {
+        if (',' == region.data()[i]) {
+            ++numCommas;
+        }
+    }
+    ASSERT(2 == numCommas);
+//..
+// Finally, we unmap the region (which the destructor would otherwise do for
+// us) and remove the file:
+//..
+    region.unmap();
+    ASSERT(!region.isMapped());
+
+    Util::remove(fileName);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'mapFile', 'swap', AND 'advise'
+        //
+        // Concerns:
+        //: 1 'mapFile' maps the entire contents of an existing file.
+        //:
+        //: 2 'mapFile' of an empty file succeeds and leaves the object empty.
+        //:
+        //: 3 'mapFile' of a file that does not exist fails, and leaves the
+        //:   object unchanged.
+        //:
+        //: 4 'swap' (member and free) exchanges the owned regions.
+        //:
+        //: 5 'advise' accepts every advice value, and does not change the
+        //:   contents of the region.
+        //
+        // Plan:
+        //: 1 Map files of several sizes (including 0) with both 'mapFile'
+        //:   overloads and verify the contents.  (C-1..2)
+        //:
+        //: 2 Attempt to map a file that does not exist.  (C-3)
+        //:
+        //: 3 Swap two mapped regions and verify their attributes.  (C-4)
+        //:
+        //: 4 Call 'advise' with each advice value and verify the contents.
+        //:   (C-5)
+        //
+        // Testing:
+        //   int mapFile(const char *path, MappingMode mode);
+        //   int mapFile(const bsl::string& path, MappingMode mode);
+        //   void swap(MappedRegion& other);
+        //   void swap(MappedRegion& a, MappedRegion& b);
+        //   int advise(FilesystemUtil::MappingAdvice advice);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'mapFile', 'swap', AND 'advise'" << endl
+                          << "===============================" << endl;
+
+        const bsl::size_t PAGE = static_cast<bsl::size_t>(PAGE_SIZE);
+
+        const bsl::size_t SIZES[] = {
+            0, 1, 100, PAGE, 3 * PAGE + 7
+        };
+        const int         NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        if (verbose) cout << "\tTesting 'mapFile'." << endl;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const bsl::size_t SIZE = SIZES[ti];
+            const bsl::string PATH = createFile(SIZE);
+
+            if (veryVerbose) { P_(SIZE) P(PATH) }
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERTV(SIZE, 0 == mX.mapFile(PATH, Util::e_MAP_READ_ONLY));
+            ASSERTV(SIZE, (0 != SIZE) == X.isMapped());
+            ASSERTV(SIZE, SIZE == X.size());
+            ASSERTV(SIZE, verifyRegion(X, 0));
+
+            ASSERTV(SIZE, 0 == mX.mapFile(PATH.c_str(),
+                                          Util::e_MAP_COPY_ON_WRITE));
+            ASSERTV(SIZE, SIZE == X.size());
+            ASSERTV(SIZE, verifyRegion(X, 0));
+
+            ASSERTV(SIZE, 0 == mX.mapFile(PATH, Util::e_MAP_SHARED));
+            ASSERTV(SIZE, SIZE == X.size());
+            ASSERTV(SIZE, verifyRegion(X, 0));
+
+            mX.unmap();
+            Util::remove(PATH);
+        }
+
+        if (verbose) cout << "\tTesting failure of 'mapFile'." << endl;
+        {
+            const bsl::string PATH = createFile(100);
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == mX.mapFile(PATH, Util::e_MAP_READ_ONLY));
+
+            const char *DATA = X.data();
+
+            ASSERT(0 != mX.mapFile(PATH + ".does.not.exist",
+                                   Util::e_MAP_READ_ONLY));
+            ASSERT(X.isMapped());
+            ASSERT(DATA == X.data());
+            ASSERT(100  == X.size());
+            ASSERT(verifyRegion(X, 0));
+
+            mX.unmap();
+            Util::remove(PATH);
+        }
+
+        if (verbose) cout << "\tTesting 'swap'." << endl;
+        {
+            const bsl::string PATH = createFile(2 * PAGE_SIZE);
+
+            Obj mX;  const Obj& X = mX;
+            Obj mY;  const Obj& Y = mY;
+
+            const Util::FileDescriptor fd = Util::open(PATH,
+                                                       Util::e_OPEN,
+                                                       Util::e_READ_ONLY);
+            ASSERT(Util::k_INVALID_FD != fd);
+
+            ASSERT(0 == mX.map(fd, 3,  10, Util::e_MAP_READ_ONLY));
+            ASSERT(0 == mY.map(fd, 50, 20, Util::e_MAP_COPY_ON_WRITE));
+
+            Util::close(fd);
+
+            const char *XDATA = X.data();
+            const char *YDATA = Y.data();
+
+            mX.swap(mY);
+
+            ASSERT(YDATA == X.data());  ASSERT(20 == X.size());
+            ASSERT(XDATA == Y.data());  ASSERT(10 == Y.size());
+            ASSERT(Util::e_MAP_COPY_ON_WRITE == X.mode());
+            ASSERT(Util::e_MAP_READ_ONLY     == Y.mode());
+            ASSERT(verifyRegion(X, 50));
+            ASSERT(verifyRegion(Y, 3));
+
+            swap(mX, mY);
+
+            ASSERT(XDATA == X.data());  ASSERT(10 == X.size());
+            ASSERT(YDATA == Y.data());  ASSERT(20 == Y.size());
+
+            Obj mZ;  const Obj& Z = mZ;
+
+            bdls::swap(mX, mZ);
+
+            ASSERT(!X.isMapped());
+            ASSERT( Z.isMapped());
+            ASSERT(verifyRegion(Z, 3));
+
+            Util::remove(PATH);
+        }
+
+        if (verbose) cout << "\tTesting 'advise'." << endl;
+        {
+            const Util::MappingAdvice ADVICE[] = {
+                Util::e_ADVICE_NORMAL,
+                Util::e_ADVICE_SEQUENTIAL,
+                Util::e_ADVICE_RANDOM,
+                Util::e_ADVICE_WILL_NEED,
+                Util::e_ADVICE_DONT_NEED
+            };
+            const int NUM_ADVICE = sizeof ADVICE / sizeof *ADVICE;
+
+            const bsl::string PATH = createFile(4 * PAGE_SIZE + 11);
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == mX.advise(Util::e_ADVICE_WILL_NEED));  // empty
+
+            ASSERT(0 == mX.mapFile(PATH, Util::e_MAP_READ_ONLY));
+
+            for (int ti = 0; ti < NUM_ADVICE; ++ti) {
+                ASSERTV(ti, 0 == mX.advise(ADVICE[ti]));
+                ASSERTV(ti, verifyRegion(X, 0));
+            }
+
+            mX.unmap();
+            Util::remove(PATH);
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MAPPING MODES AND 'sync'
+        //
+        // Concerns:
+        //: 1 Modifications of a region mapped with 'e_MAP_COPY_ON_WRITE' are
+        //:   visible through the region, but are not written to the file and
+        //:   not visible to other mappings of the file.
+        //:
+        //: 2 Modifications of a region mapped with 'e_MAP_SHARED' are visible
+        //:   to other mappings of the file, and are written to the file by
+        //:   'sync' (both synchronously and asynchronously).
+        //:
+        //: 3 'sync' on an empty region returns 0.
+        //:
+        //: 4 'map' with 'e_MAP_SHARED' fails on a descriptor opened for
+        //:   reading only.
+        //
+        // Plan:
+        //: 1 Map the same file with a copy-on-write region, a shared region,
+        //:   and a read-only region.  Modify the first two regions, and verify
+        //:   the contents of all regions and of the file.  (C-1..3)
+        //:
+        //: 2 Attempt to map a read-only descriptor with 'e_MAP_SHARED'.  (C-4)
+        //
+        // Testing:
+        //   int sync(bool syncFlag = true);
+        //   CONCERN: MAPPING MODES HAVE THE DOCUMENTED EFFECT ON THE FILE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MAPPING MODES AND 'sync'" << endl
+                          << "========================" << endl;
+
+        const bsl::size_t SIZE = 2 * PAGE_SIZE + 100;
+        const bsl::string PATH = createFile(SIZE);
+
+        {
+            Obj empty;
+            ASSERT(0 == empty.sync());
+            ASSERT(0 == empty.sync(false));
+        }
+
+        Obj mC;  const Obj& C = mC;  // copy-on-write
+        Obj mS;  const Obj& S = mS;  // shared
+        Obj mR;  const Obj& R = mR;  // read-only
+
+        ASSERT(0 == mC.mapFile(PATH, Util::e_MAP_COPY_ON_WRITE));
+        ASSERT(0 == mS.mapFile(PATH, Util::e_MAP_SHARED));
+        ASSERT(0 == mR.mapFile(PATH, Util::e_MAP_READ_ONLY));
+
+        if (verbose) cout << "\tModifying a copy-on-write region." << endl;
+
+        mC.data()[0]        = 'X';
+        mC.data()[SIZE - 1] = 'Y';
+
+        ASSERT('X' == C.data()[0]);
+        ASSERT('Y' == C.data()[SIZE - 1]);
+        ASSERT(expectedByte(0)        == S.data()[0]);
+        ASSERT(expectedByte(SIZE - 1) == R.data()[SIZE - 1]);
+
+        ASSERT(0 == mC.sync());
+
+        ASSERT(expectedByte(0)        == readByte(PATH, 0));
+        ASSERT(expectedByte(SIZE - 1) == readByte(PATH, SIZE - 1));
+
+        if (verbose) cout << "\tModifying a shared region." << endl;
+
+        mS.data()[1]        = 'P';
+        mS.data()[SIZE - 2] = 'Q';
+
+        ASSERT('P' == R.data()[1]);
+        ASSERT('Q' == R.data()[SIZE - 2]);
+
+        ASSERT(0 == mS.sync(false));
+        ASSERT(0 == mS.sync());
+
+        ASSERT('P' == readByte(PATH, 1));
+        ASSERT('Q' == readByte(PATH, SIZE - 2));
+
+        // The copy-on-write region still sees its own modifications.
+
+        ASSERT('X' == C.data()[0]);
+        ASSERT('Y' == C.data()[SIZE - 1]);
+
+        mC.unmap();
+        mS.unmap();
+        mR.unmap();
+
+        if (verbose) cout << "\tMapping a read-only descriptor." << endl;
+        {
+            const Util::FileDescriptor fd = Util::open(PATH,
+                                                       Util::e_OPEN,
+                                                       Util::e_READ_ONLY);
+            ASSERT(Util::k_INVALID_FD != fd);
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 != mX.map(fd, 0, SIZE, Util::e_MAP_SHARED));
+            ASSERT(!X.isMapped());
+
+            ASSERT(0 == mX.map(fd, 0, SIZE, Util::e_MAP_COPY_ON_WRITE));
+            ASSERT(X.isMapped());
+
+            Util::close(fd);
+        }
+
+        Util::remove(PATH);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'map' AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 'map' exposes exactly the requested bytes of the file, whether or
+        //:   not the offset is aligned on a page boundary.
+        //:
+        //: 2 'size' and 'mode' return the requested size and mode, and both
+        //:   'data' overloads return the same address.
+        //:
+        //: 3 A successful 'map' replaces (and unmaps) the current region.
+        //:
+        //: 4 'map' of 0 bytes succeeds and leaves the object empty.
+        //:
+        //: 5 A failed 'map' leaves the object unchanged.
+        //:
+        //: 6 The region remains valid after the descriptor is closed.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, map regions at a variety of
+        //:   offsets and sizes (crossing page boundaries) into the same
+        //:   object, and verify the contents and attributes after closing the
+        //:   descriptor.  (C-1..3, 6)
+        //:
+        //: 2 Map 0 bytes.  (C-4)
+        //:
+        //: 3 Attempt to map an invalid descriptor.  (C-5)
+        //
+        // Testing:
+        //   int map(FileDescriptor d, Offset o, size_t s, MappingMode m);
+        //   char *data();
+        //   const char *data() const;
+        //   FilesystemUtil::MappingMode mode() const;
+        //   bsl::size_t size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'map' AND BASIC ACCESSORS" << endl
+                          << "=========================" << endl;
+
+        const bsl::size_t FILE_SIZE = 4 * PAGE_SIZE;
+        const bsl::string PATH      = createFile(FILE_SIZE);
+
+        const Util::MappingMode RO  = Util::e_MAP_READ_ONLY;
+        const Util::MappingMode COW = Util::e_MAP_COPY_ON_WRITE;
+        const Util::MappingMode SH  = Util::e_MAP_SHARED;
+
+        const struct {
+            int               d_line;
+            int               d_offset;
+            int               d_size;
+            Util::MappingMode d_mode;
+        } DATA[] = {
+            //LINE  OFFSET             SIZE               MODE
+            //----  -----------------  -----------------  ----
+            { L_,   0,                 1,                 RO   },
+            { L_,   0,                 PAGE_SIZE,         SH   },
+            { L_,   1,                 1,                 RO   },
+            { L_,   7,                 PAGE_SIZE,         RO   },
+            { L_,   PAGE_SIZE - 1,     2,                 SH   },
+            { L_,   PAGE_SIZE,         PAGE_SIZE,         COW  },
+            { L_,   PAGE_SIZE + 3,     2 * PAGE_SIZE,     SH   },
+            { L_,   3 * PAGE_SIZE - 5, PAGE_SIZE + 5,     RO   },
+            { L_,   0,                 4 * PAGE_SIZE,     COW  },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        Obj mX;  const Obj& X = mX;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int               LINE   = DATA[ti].d_line;
+            const int               OFFSET = DATA[ti].d_offset;
+            const bsl::size_t       SIZE   = DATA[ti].d_size;
+            const Util::MappingMode MODE   = DATA[ti].d_mode;
+
+            if (veryVerbose) { P_(LINE) P_(OFFSET) P_(SIZE) P(MODE) }
+
+            const Util::FileDescriptor fd = Util::open(PATH,
+                                                       Util::e_OPEN,
+                                                       Util::e_READ_WRITE);
+            ASSERTV(LINE, Util::k_INVALID_FD != fd);
+
+            ASSERTV(LINE, 0 == mX.map(fd, OFFSET, SIZE, MODE));
+
+            Util::close(fd);
+
+            ASSERTV(LINE, X.isMapped());
+            ASSERTV(LINE, SIZE == X.size());
+            ASSERTV(LINE, MODE == X.mode());
+            ASSERTV(LINE, X.data() == mX.data());
+            ASSERTV(LINE, verifyRegion(X, OFFSET));
+        }
+
+        if (verbose) cout << "\tMapping 0 bytes." << endl;
+        {
+            const Util::FileDescriptor fd = Util::open(PATH,
+                                                       Util::e_OPEN,
+                                                       Util::e_READ_ONLY);
+            ASSERT(Util::k_INVALID_FD != fd);
+
+            ASSERT(0 == mX.map(fd, 5, 0, Util::e_MAP_READ_ONLY));
+            ASSERT(!X.isMapped());
+            ASSERT(0 == X.data());
+            ASSERT(0 == X.size());
+
+            ASSERT(0 == mX.map(fd, 5, 10, Util::e_MAP_READ_ONLY));
+            ASSERT(X.isMapped());
+
+            Util::close(fd);
+        }
+
+        if (verbose) cout << "\tFailing to map." << endl;
+        {
+            const char *DATA_BEFORE = X.data();
+
+            ASSERT(0 != mX.map(Util::k_INVALID_FD,
+                               0,
+                               PAGE_SIZE,
+                               Util::e_MAP_READ_ONLY));
+            ASSERT(X.isMapped());
+            ASSERT(DATA_BEFORE == X.data());
+            ASSERT(10 == X.size());
+            ASSERT(verifyRegion(X, 5));
+        }
+
+        mX.unmap();
+        Util::remove(PATH);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an empty region, map a small file, verify its contents,
+        //:   and unmap it.  Map the file again and let the destructor unmap
+        //:   it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   MappedRegion();
+        //   ~MappedRegion();
+        //   int unmap();
+        //   bool isMapped() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const bsl::string PATH = createFile(1000);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(!X.isMapped());
+            ASSERT(0 == X.data());
+            ASSERT(0 == X.size());
+            ASSERT(0 == mX.unmap());
+
+            const Util::FileDescriptor fd = Util::open(PATH,
+                                                       Util::e_OPEN,
+                                                       Util::e_READ_ONLY);
+            ASSERT(Util::k_INVALID_FD != fd);
+
+            ASSERT(0 == mX.map(fd, 0, 1000, Util::e_MAP_READ_ONLY));
+            ASSERT(X.isMapped());
+            ASSERT(1000 == X.size());
+            ASSERT(verifyRegion(X, 0));
+
+            ASSERT(0 == mX.unmap());
+            ASSERT(!X.isMapped());
+            ASSERT(0 == X.data());
+            ASSERT(0 == X.size());
+
+            ASSERT(0 == mX.map(fd, 0, 1000, Util::e_MAP_READ_ONLY));
+            ASSERT(X.isMapped());
+
+            Util::close(fd);
+        }
+
+        Util::remove(PATH);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: MAPPING VS. READING A FILE
+        //
+        // Concerns:
+        //: 1 Scanning a file through a read-only mapping is faster than
+        //:   reading it into a heap buffer and scanning the buffer.
+        //
+        // Plan:
+        //: 1 Create a file (of a size given on the command line in megabytes,
+        //:   64 by default), and time summing its bytes after reading it into
+        //:   a buffer and through a mapping.  Report the results.
+        //
+        // Testing:
+        //   PERFORMANCE: MAPPING VS. READING A FILE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: MAPPING VS. READING A FILE" << endl
+                          << "=======================================" << endl;
+
+        const int         NUM_MB = argc > 2 && atoi(argv[2]) > 0
+                                   ? atoi(argv[2])
+                                   : 64;
+        const bsl::size_t SIZE   = static_cast<bsl::size_t>(NUM_MB) << 20;
+        const bsl::string PATH   = createFile(SIZE);
+
+        bsls::Types::Uint64 sumRead = 0, sumMapped = 0;
+
+        bsls::Stopwatch readTimer;
+        readTimer.start();
+        {
+            const Util::FileDescriptor fd = Util::open(PATH,
+                                                       Util::e_OPEN,
+                                                       Util::e_READ_ONLY);
+            bsl::vector<char> buffer(SIZE);
+            bsl::size_t       numRead = 0;
+            while (numRead < SIZE) {
+                const bsl::size_t chunk = bsl::min<bsl::size_t>(
+                                                              SIZE - numRead,
+                                                              1 << 30);
+                const int         n     = Util::read(fd,
+                                                     &buffer[numRead],
+                                                     static_cast<int>(chunk));
+                if (n <= 0) {
+                    break;
+                }
+                numRead += n;
+            }
+            Util::close(fd);
+            for (bsl::size_t i = 0; i < numRead; ++i) {
+                sumRead += static_cast<unsigned char>(buffer[i]);
+            }
+        }
+        readTimer.stop();
+
+        bsls::Stopwatch mapTimer;
+        mapTimer.start();
+        {
+            Obj mX;
+            ASSERT(0 == mX.mapFile(PATH, Util::e_MAP_READ_ONLY));
+            mX.advise(Util::e_ADVICE_SEQUENTIAL);
+
+            const char *data = mX.data();
+            for (bsl::size_t i = 0; i < mX.size(); ++i) {
+                sumMapped += static_cast<unsigned char>(data[i]);
+            }
+        }
+        mapTimer.stop();
+
+        ASSERT(sumRead == sumMapped);
+
+        cout << "file size: " << NUM_MB << " MB" << endl
+             << "read + scan: " << readTimer.elapsedTime() << "s" << endl
+             << "map + scan:  " << mapTimer.elapsedTime()  << "s" << endl;
+
+        Util::remove(PATH);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
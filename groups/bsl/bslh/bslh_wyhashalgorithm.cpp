@@ -0,0 +1,60 @@
+// bslh_wyhashalgorithm.cpp                                           -*-C++-*-
+#include <bslh_wyhashalgorithm.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+namespace BloombergLP {
+
+namespace bslh {
+
+                          // ---------------------------
+                          // class bslh::WyHashAlgorithm
+                          // ---------------------------
+
+// PRIVATE MANIPULATORS
+void WyHashAlgorithm::mixBlocks(const unsigned char *data, size_t numBlocks)
+{
+    BSLS_ASSERT(data);
+    BSLS_ASSERT(0 < numBlocks);
+
+    Uint64 seed = d_seed;
+    Uint64 see1 = d_see1;
+    Uint64 see2 = d_see2;
+
+    const unsigned char *end = data + numBlocks * k_BLOCK_SIZE;
+
+    for (; data != end; data += k_BLOCK_SIZE) {
+        seed = mix(load64(data)      ^ k_SECRET1, load64(data + 8)  ^ seed);
+        see1 = mix(load64(data + 16) ^ k_SECRET2, load64(data + 24) ^ see1);
+        see2 = mix(load64(data + 32) ^ k_SECRET3, load64(data + 40) ^ see2);
+    }
+
+    d_seed = seed;
+    d_see1 = see1;
+    d_see2 = see2;
+
+    // 'memmove', as 'data' may be the buffer itself.
+
+    memmove(d_buffer, end - k_TAIL_SIZE, k_TAIL_SIZE);
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,524 @@
+// bslh_wyhashalgorithm.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLH_WYHASHALGORITHM
+#define INCLUDED_BSLH_WYHASHALGORITHM
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an implementation of the wyhash algorithm.
+//
+//@CLASSES:
+//  bslh::WyHashAlgorithm: functor implementing the wyhash algorithm
+//
+//@SEE_ALSO: bslh_hash, bslh_spookyhashalgorithm
+//
+//@DESCRIPTION: 'bslh::WyHashAlgorithm' implements the wyhash algorithm by Wang
+// Yi (final version 3).  This algorithm is a fast, general purpose algorithm
+// whose mixing step is a single 64 by 64 to 128-bit multiplication, folded
+// back to 64 bits.  Keys of up to 16 bytes, which include the fundamental
+// types and most identifiers, are hashed with two such multiplications and no
+// loop, which makes the algorithm particularly well suited to the short
+// integer and string keys typical of unordered associative containers.  For
+// more information, see: https://github.com/wangyi-fudan/wyhash
+//
+// This class satisfies the requirements for regular 'bslh' hashing algorithms
+// and seeded 'bslh' hashing algorithms, defined in 'bslh_hash.h' and
+// 'bslh_seededhash.h' respectively, and so may be supplied to 'bslh::Hash':
+//..
+//  bsl::unordered_map<MyType, int, bslh::Hash<bslh::WyHashAlgorithm> > map;
+//..
+// More information can be found in the package level documentation for
+// 'bslh'.
+//
+///Security
+///--------
+// In this context "security" refers to the ability of the algorithm to produce
+// hashes that are not predictable by an attacker.  Security is a concern when
+// an attacker may be able to provide malicious input into a hash table,
+// thereby causing hashes to collide to buckets, which degrades performance.
+// There are *no* security guarantees made by 'bslh::WyHashAlgorithm', meaning
+// attackers may be able to engineer keys that will cause a Denial of Service
+// (DoS) attack in hash tables using this algorithm, even without knowledge of
+// the seed.  If security is required, an algorithm that documents better
+// secure properties should be used, such as 'bslh::SipHashAlgorithm'.
+//
+///Speed
+///-----
+// This algorithm will compute a hash on the order of O(n) where 'n' is the
+// length of the input data.  The full-width multiplication it relies on is a
+// single instruction on 64-bit platforms, where it is used through the
+// '__int128' extension of GCC and Clang, or the '_umul128' intrinsic of MSVC;
+// elsewhere it is emulated with four 32-bit multiplications.  The algorithm
+// is quicker than SpookyHash for short keys, and is comparable to it for long
+// ones.  The input is buffered in 48-byte blocks so that it may be supplied
+// in pieces, and keys of up to 48 bytes are hashed entirely when
+// 'computeHash' is called.
+//
+///Hash Distribution
+///-----------------
+// Output hashes will be well distributed and will avalanche, which means
+// changing one bit of the input will change approximately 50% of the output
+// bits.  This will prevent similar values from funneling to the same hash or
+// bucket.  The algorithm passes the SMHasher test suite.
+//
+///Hash Consistency
+///----------------
+// The input is read in little-endian byte order on every platform, so that
+// this algorithm produces the same hashes as the canonical implementation,
+// regardless of the byte order of the machine, for the same sequence of
+// bytes.  Note that the bytes that represent a value of a fundamental type,
+// such as 'int', still depend on the byte order of the machine, so that it is
+// not recommended to send hashes of such values over a network, or to write
+// them to memory accessible by multiple machines.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example: Hashing Short Keys
+///- - - - - - - - - - - - - -
+// Suppose we identify securities by a ticker symbol and the code of the
+// exchange on which they trade, and that we need a hash functor for these
+// identifiers, to be used in a hash table.  The identifiers are short and not
+// supplied by an adversary, so we want a fast, general purpose algorithm.
+//
+// First, we define the identifier type:
+//..
+//  struct SecurityId {
+//      // This 'struct' identifies a security by its ticker symbol and the
+//      // code of its exchange.
+//
+//      // DATA
+//      const char *d_ticker;    // held, not owned
+//      int         d_exchange;
+//  };
+//..
+// Then, we define a hash functor that supplies the attributes of an
+// identifier that are salient to hashing to a 'bslh::WyHashAlgorithm':
+//..
+//  struct HashSecurityId {
+//      // This 'struct' is a functor that applies the wyhash algorithm to
+//      // objects of type 'SecurityId'.
+//
+//      size_t operator()(const SecurityId& id) const
+//          // Return the hash of the specified 'id'.
+//      {
+//          bslh::WyHashAlgorithm hashAlg;
+//
+//          hashAlg(id.d_ticker, strlen(id.d_ticker));
+//          hashAlg(&id.d_exchange, sizeof id.d_exchange);
+//
+//          return static_cast<size_t>(hashAlg.computeHash());
+//      }
+//  };
+//..
+// Next, we hash some identifiers, and observe that equal identifiers have
+// equal hashes, while identifiers that differ only in their exchange do not:
+//..
+//  const SecurityId IBM_1 = { "IBM", 1 };
+//  const SecurityId IBM_2 = { "IBM", 2 };
+//  const SecurityId IBM_X = { "IBM", 1 };
+//
+//  HashSecurityId hasher;
+//
+//  assert(hasher(IBM_1) == hasher(IBM_X));
+//  assert(hasher(IBM_1) != hasher(IBM_2));
+//..
+// Finally, we observe that the hash of a sequence of bytes does not depend on
+// how the sequence is divided among calls to the function-call operator:
+//..
+//  bslh::WyHashAlgorithm whole;
+//  bslh::WyHashAlgorithm pieces;
+//
+//  whole("ABCDEFGH", 8);
+//  pieces("ABC", 3);
+//  pieces("DEFGH", 5);
+//
+//  assert(whole.computeHash() == pieces.computeHash());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_BYTEORDER
+#include <bsls_byteorder.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#if defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_X86_64)
+#ifndef INCLUDED_INTRIN_H
+#include <intrin.h>  // for '_umul128'
+#define INCLUDED_INTRIN_H
+#endif
+#endif
+
+#ifndef INCLUDED_STDDEF_H
+#include <stddef.h>  // for 'size_t'
+#define INCLUDED_STDDEF_H
+#endif
+
+#ifndef INCLUDED_STRING_H
+#include <string.h>  // for 'memcpy'
+#define INCLUDED_STRING_H
+#endif
+
+namespace BloombergLP {
+
+namespace bslh {
+
+                          // ===========================
+                          // class bslh::WyHashAlgorithm
+                          // ===========================
+
+class WyHashAlgorithm {
+    // This class implements the "wyhash" hash algorithm in an interface that
+    // is usable in the modular hashing system in 'bslh'.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+        // Typedef for a 64-bit integer type used in the hashing algorithm.
+
+    enum {
+        k_BLOCK_SIZE = 48,  // number of bytes mixed by each iteration of the
+                            // main loop
+
+        k_TAIL_SIZE  = 16   // number of bytes of the previous block that
+                            // the finalization may read
+    };
+
+    // CLASS DATA
+    static const Uint64 k_SECRET0 = 0xa0761d6478bd642fULL;
+    static const Uint64 k_SECRET1 = 0xe7037ed1a0b428dbULL;
+    static const Uint64 k_SECRET2 = 0x8ebc6af09c88c6e3ULL;
+    static const Uint64 k_SECRET3 = 0x589965cc75374cc3ULL;
+        // Constants of the algorithm.
+
+    // DATA
+    Uint64 d_seed;
+    Uint64 d_see1;
+    Uint64 d_see2;
+        // The three lanes of the intermediate state of the algorithm.
+
+    union {
+        Uint64        d_alignment;
+            // Provides alignment.
+
+        unsigned char d_buffer[k_TAIL_SIZE + k_BLOCK_SIZE];
+            // The last 'k_TAIL_SIZE' bytes of the most recently mixed block,
+            // followed by the data not yet mixed.
+    };
+
+    size_t d_bufferLength;
+        // The number of bytes of data not yet mixed, which follow the first
+        // 'k_TAIL_SIZE' bytes of 'd_buffer'.
+
+    Uint64 d_totalLength;
+        // The total length of all data that has been passed into the
+        // algorithm.
+
+    // NOT IMPLEMENTED
+    WyHashAlgorithm(const WyHashAlgorithm& original); // = delete;
+        // Do not allow copy construction.
+
+    WyHashAlgorithm& operator=(const WyHashAlgorithm& rhs); // = delete;
+        // Do not allow assignment.
+
+    // PRIVATE CLASS METHODS
+    static Uint64 load32(const unsigned char *data);
+        // Return the 32-bit little-endian integer at the specified 'data'.
+
+    static Uint64 load64(const unsigned char *data);
+        // Return the 64-bit little-endian integer at the specified 'data'.
+
+    static Uint64 mix(Uint64 lhs, Uint64 rhs);
+        // Return the exclusive or of the low and high halves of the 128-bit
+        // product of the specified 'lhs' and 'rhs'.
+
+    static void multiply(Uint64 *lhs, Uint64 *rhs);
+        // Load into the specified 'lhs' and 'rhs' the low and high halves,
+        // respectively, of the 128-bit product of their values.
+
+    // PRIVATE MANIPULATORS
+    void mixBlocks(const unsigned char *data, size_t numBlocks);
+        // Mix the specified 'numBlocks' consecutive blocks, of 'k_BLOCK_SIZE'
+        // bytes each, at the specified 'data' into the state of this
+        // algorithm, and copy the last 'k_TAIL_SIZE' bytes of the last block
+        // to the start of the buffer.  The behavior is undefined unless
+        // '0 < numBlocks'.
+
+  public:
+    // TYPES
+    typedef bsls::Types::Uint64 result_type;
+        // Typedef indicating the value type returned by this algorithm.
+
+    // CONSTANTS
+    enum { k_SEED_LENGTH = 8 }; // Seed length in bytes.
+
+    // CREATORS
+    WyHashAlgorithm();
+        // Create a 'bslh::WyHashAlgorithm' using a default initial seed.
+
+    explicit WyHashAlgorithm(const char *seed);
+        // Create a 'bslh::WyHashAlgorithm', seeded with a 64-bit
+        // ('k_SEED_LENGTH' bytes) seed pointed to by the specified 'seed', in
+        // little-endian byte order.  Each bit of the supplied seed will
+        // contribute to the final hash produced by 'computeHash()'.  The
+        // behavior is undefined unless 'seed' points to at least 8 bytes of
+        // initialized memory.
+
+    //! ~WyHashAlgorithm() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void operator()(const void *data, size_t numBytes);
+        // Incorporate the specified 'data', of at least the specified
+        // 'numBytes', into the internal state of the hashing algorithm.  Every
+        // bit of data incorporated into the internal state of the algorithm
+        // will contribute to the final hash produced by 'computeHash()'.  The
+        // same hash value will be produced regardless of whether a sequence of
+        // bytes is passed in all at once or through multiple calls to this
+        // member function.  Input where 'numBytes' is 0 will have no effect on
+        // the internal state of the algorithm.  The behavior is undefined
+        // unless 'data' points to a valid memory location with at least
+        // 'numBytes' bytes of initialized memory.
+
+    result_type computeHash();
+        // Return the finalized version of the hash that has been accumulated.
+        // Note that this changes the internal state of the object, so calling
+        // 'computeHash()' multiple times in a row will return different
+        // results, and only the first result returned will match the expected
+        // result of the algorithm.  Also note that a value will be returned,
+        // even if data has not been passed into 'operator()'
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+// PRIVATE CLASS METHODS
+inline
+WyHashAlgorithm::Uint64 WyHashAlgorithm::load32(const unsigned char *data)
+{
+    unsigned int result;
+    memcpy(&result, data, sizeof result);
+    return BSLS_BYTEORDER_LE_U32_TO_HOST(result);
+}
+
+inline
+WyHashAlgorithm::Uint64 WyHashAlgorithm::load64(const unsigned char *data)
+{
+    Uint64 result;
+    memcpy(&result, data, sizeof result);
+    return BSLS_BYTEORDER_LE_U64_TO_HOST(result);
+}
+
+inline
+WyHashAlgorithm::Uint64 WyHashAlgorithm::mix(Uint64 lhs, Uint64 rhs)
+{
+    multiply(&lhs, &rhs);
+    return lhs ^ rhs;
+}
+
+inline
+void WyHashAlgorithm::multiply(Uint64 *lhs, Uint64 *rhs)
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 Uint128;
+
+    const Uint128 product = static_cast<Uint128>(*lhs) * *rhs;
+
+    *lhs = static_cast<Uint64>(product);
+    *rhs = static_cast<Uint64>(product >> 64);
+#elif defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_X86_64)
+    *lhs = _umul128(*lhs, *rhs, rhs);
+#else
+    const Uint64 lhsHigh = *lhs >> 32;
+    const Uint64 lhsLow  = *lhs & 0xffffffffULL;
+    const Uint64 rhsHigh = *rhs >> 32;
+    const Uint64 rhsLow  = *rhs & 0xffffffffULL;
+
+    const Uint64 high    = lhsHigh * rhsHigh;
+    const Uint64 middle0 = lhsHigh * rhsLow;
+    const Uint64 middle1 = rhsHigh * lhsLow;
+    const Uint64 low     = lhsLow  * rhsLow;
+
+    const Uint64 partial = low + (middle0 << 32);
+    Uint64       carry   = partial < low;
+    const Uint64 result  = partial + (middle1 << 32);
+    carry += result < partial;
+
+    *lhs = result;
+    *rhs = high + (middle0 >> 32) + (middle1 >> 32) + carry;
+#endif
+}
+
+// CREATORS
+inline
+WyHashAlgorithm::WyHashAlgorithm()
+: d_seed(k_SECRET0)
+, d_see1(d_seed)
+, d_see2(d_seed)
+, d_bufferLength(0)
+, d_totalLength(0)
+{
+}
+
+inline
+WyHashAlgorithm::WyHashAlgorithm(const char *seed)
+: d_bufferLength(0)
+, d_totalLength(0)
+{
+    BSLS_ASSERT(seed);
+
+    const Uint64 value = load64(reinterpret_cast<const unsigned char *>(seed));
+
+    d_seed = value ^ k_SECRET0;
+    d_see1 = d_seed;
+    d_see2 = d_seed;
+}
+
+// MANIPULATORS
+inline
+void WyHashAlgorithm::operator()(const void *data, size_t numBytes)
+{
+    BSLS_ASSERT(data);
+
+    const unsigned char *input = static_cast<const unsigned char *>(data);
+
+    d_totalLength += numBytes;
+
+    if (k_BLOCK_SIZE - d_bufferLength >= numBytes) {
+        // The data fits in the buffer.  Note that a full buffer is not mixed
+        // until more data arrives, as the last block is finalized
+        // differently.
+
+        memcpy(d_buffer + k_TAIL_SIZE + d_bufferLength, input, numBytes);
+        d_bufferLength += numBytes;
+        return;                                                       // RETURN
+    }
+
+    if (d_bufferLength) {
+        const size_t numFill = k_BLOCK_SIZE - d_bufferLength;
+
+        memcpy(d_buffer + k_TAIL_SIZE + d_bufferLength, input, numFill);
+        input    += numFill;
+        numBytes -= numFill;
+
+        mixBlocks(d_buffer + k_TAIL_SIZE, 1);
+    }
+
+    // Mix each complete block except the last, which is kept in the buffer
+    // even if it is complete.
+
+    const size_t numBlocks = (numBytes - 1) / k_BLOCK_SIZE;
+    if (numBlocks) {
+        mixBlocks(input, numBlocks);
+        input    += numBlocks * k_BLOCK_SIZE;
+        numBytes -= numBlocks * k_BLOCK_SIZE;
+    }
+
+    memcpy(d_buffer + k_TAIL_SIZE, input, numBytes);
+    d_bufferLength = numBytes;
+}
+
+inline
+WyHashAlgorithm::result_type WyHashAlgorithm::computeHash()
+{
+    const unsigned char *tail = d_buffer + k_TAIL_SIZE;
+
+    Uint64 seed = d_seed;
+    Uint64 a;
+    Uint64 b;
+
+    if (d_totalLength <= 16) {
+        const size_t length = d_bufferLength;
+
+        if (length >= 4) {
+            const size_t offset = (length >> 3) << 2;
+
+            a = (load32(tail) << 32) | load32(tail + offset);
+            b = (load32(tail + length - 4) << 32)
+              | load32(tail + length - 4 - offset);
+        }
+        else if (length > 0) {
+            a = (static_cast<Uint64>(tail[0]) << 16)
+              | (static_cast<Uint64>(tail[length >> 1]) << 8)
+              | tail[length - 1];
+            b = 0;
+        }
+        else {
+            a = 0;
+            b = 0;
+        }
+    }
+    else {
+        if (d_totalLength > k_BLOCK_SIZE) {
+            seed ^= d_see1 ^ d_see2;
+        }
+
+        // The last 16 bytes are read from the end of the data, which may
+        // reach back into the previous block.
+
+        size_t length = d_bufferLength;
+        while (length > 16) {
+            seed = mix(load64(tail) ^ k_SECRET1, load64(tail + 8) ^ seed);
+            tail   += 16;
+            length -= 16;
+        }
+        a = load64(tail + length - 16);
+        b = load64(tail + length - 8);
+    }
+
+    return mix(k_SECRET1 ^ d_totalLength, mix(a ^ k_SECRET1, b ^ seed));
+}
+
+}  // close package namespace
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslmf {
+template <>
+struct IsBitwiseMoveable<bslh::WyHashAlgorithm>
+    : bsl::true_type {};
+}  // close namespace bslmf
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,946 @@
+// bslh_wyhashalgorithm.t.cpp                                         -*-C++-*-
+#include <bslh_wyhashalgorithm.h>
+
+#include <bslh_defaulthashalgorithm.h>
+#include <bslh_siphashalgorithm.h>
+#include <bslh_spookyhashalgorithm.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_issame.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+using namespace bslh;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a 'bslh' hashing algorithm.  The basic test plan
+// is to compare the output of the function call operator with the expected
+// output generated by a known-good implementation of the hashing algorithm,
+// and to verify that the output does not depend on how the input is divided
+// among calls to the function call operator.  We also verify the distribution
+// of the hashes: their avalanche behavior, and the absence of collisions among
+// similar keys.  The component will also be tested for conformance to the
+// requirements on 'bslh' hashing algorithms, outlined in the 'bslh' package
+// level documentation.  A negative test case compares the speed and the
+// distribution of the algorithm with those of the other 'bslh' algorithms.
+//-----------------------------------------------------------------------------
+// TYPEDEF
+// [ 4] typedef bsls::Types::Uint64 result_type;
+//
+// CONSTANTS
+// [ 5] enum { k_SEED_LENGTH = 8 };
+//
+// CREATORS
+// [ 2] WyHashAlgorithm();
+// [ 2] WyHashAlgorithm(const char *seed);
+// [ 2] ~WyHashAlgorithm();
+//
+// MANIPULATORS
+// [ 3] void operator()(void const* key, size_t len);
+// [ 3] result_type computeHash();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] Trait IsBitwiseMoveable
+// [ 7] CONCERN: Hashes avalanche and do not collide for similar keys.
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: COMPARISON WITH OTHER ALGORITHMS
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  PRINTF FORMAT MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ZU BSLS_BSLTESTUTIL_FORMAT_ZU
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bslh::WyHashAlgorithm Obj;
+typedef bsls::Types::Uint64   Uint64;
+
+//=============================================================================
+//                             USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example: Hashing Short Keys
+///- - - - - - - - - - - - - -
+// Suppose we identify securities by a ticker symbol and the code of the
+// exchange on which they trade, and that we need a hash functor for these
+// identifiers, to be used in a hash table.  The identifiers are short and not
+// supplied by an adversary, so we want a fast, general purpose algorithm.
+//
+// First, we define the identifier type:
+//..
+    struct SecurityId {
+        // This 'struct' identifies a security by its ticker symbol and the
+        // code of its exchange.
+
+        // DATA
+        const char *d_ticker;    // held, not owned
+        int         d_exchange;
+    };
+//..
+// Then, we define a hash functor that supplies the attributes of an
+// identifier that are salient to hashing to a 'bslh::WyHashAlgorithm':
+//..
+    struct HashSecurityId {
+        // This 'struct' is a functor that applies the wyhash algorithm to
+        // objects of type 'SecurityId'.
+
+        size_t operator()(const SecurityId& id) const
+            // Return the hash of the specified 'id'.
+        {
+            bslh::WyHashAlgorithm hashAlg;
+
+            hashAlg(id.d_ticker, strlen(id.d_ticker));
+            hashAlg(&id.d_exchange, sizeof id.d_exchange);
+
+            return static_cast<size_t>(hashAlg.computeHash());
+        }
+    };
+//..
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void fillRandom(unsigned char *buffer, size_t length, unsigned *state)
+    // Load into the specified 'buffer' of the specified 'length' pseudo-random
+    // bytes generated from, and advancing, the specified 'state'.
+{
+    for (size_t i = 0; i < length; ++i) {
+        *state = *state * 1103515245u + 12345u;
+        buffer[i] = static_cast<unsigned char>(*state >> 16);
+    }
+}
+
+template <class HASH_ALGORITHM>
+Uint64 hashBytes(const void *data, size_t length)
+    // Return the hash of the specified 'data' of the specified 'length'
+    // computed by a default-constructed (template parameter)
+    // 'HASH_ALGORITHM'.
+{
+    HASH_ALGORITHM hashAlg;
+    hashAlg(data, length);
+    return hashAlg.computeHash();
+}
+
+template <>
+Uint64 hashBytes<SipHashAlgorithm>(const void *data, size_t length)
+    // Return the hash of the specified 'data' of the specified 'length'
+    // computed by a 'SipHashAlgorithm' having a fixed seed.
+{
+    static const char SEED[SipHashAlgorithm::k_SEED_LENGTH] = { 0 };
+
+    SipHashAlgorithm hashAlg(SEED);
+    hashAlg(data, length);
+    return hashAlg.computeHash();
+}
+
+extern "C"
+int compareUint64(const void *lhs, const void *rhs)
+    // Return a negative value, 0, or a positive value if the 'Uint64' at the
+    // specified 'lhs' is less than, equal to, or greater than the 'Uint64' at
+    // the specified 'rhs', respectively.
+{
+    const Uint64 a = *static_cast<const Uint64 *>(lhs);
+    const Uint64 b = *static_cast<const Uint64 *>(rhs);
+    return a < b ? -1 : a > b ? 1 : 0;
+}
+
+int countCollisions(Uint64 *hashes, int numHashes)
+    // Sort the specified 'hashes' of the specified 'numHashes' length, and
+    // return the number of them equal to their predecessor.
+{
+    qsort(hashes, numHashes, sizeof *hashes, &compareUint64);
+
+    int result = 0;
+    for (int i = 1; i < numHashes; ++i) {
+        result += hashes[i] == hashes[i - 1];
+    }
+    return result;
+}
+
+template <class HASH_ALGORITHM>
+void benchmark(const char *name)
+    // Print the time taken by the specified (template parameter)
+    // 'HASH_ALGORITHM', identified by the specified 'name', to hash keys of
+    // various lengths, and the number of collisions among the low 20 bits of
+    // the hashes of consecutive integers.
+{
+    static const size_t LENGTHS[] = { 4, 8, 16, 32, 64, 256, 4096 };
+    const int           NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+    static unsigned char data[4096 + 64];
+    unsigned             state = 1;
+    fillRandom(data, sizeof data, &state);
+
+    printf("%-28s", name);
+
+    Uint64 sum = 0;
+
+    for (int i = 0; i < NUM_LENGTHS; ++i) {
+        const size_t LENGTH = LENGTHS[i];
+        const int    NUM_ITERATIONS = static_cast<int>(
+                                                    (1 << 24) / (LENGTH + 32));
+
+        bsls::Stopwatch timer;
+        timer.start();
+        for (int j = 0; j < NUM_ITERATIONS; ++j) {
+            sum += hashBytes<HASH_ALGORITHM>(data + (j & 63), LENGTH);
+        }
+        timer.stop();
+
+        printf(" %8.1f", timer.elapsedTime() * 1e9 / NUM_ITERATIONS);
+    }
+
+    const int NUM_KEYS = 1 << 20;
+    Uint64   *hashes   = new Uint64[NUM_KEYS];
+
+    for (int i = 0; i < NUM_KEYS; ++i) {
+        hashes[i] = hashBytes<HASH_ALGORITHM>(&i, sizeof i) & (NUM_KEYS - 1);
+    }
+    printf(" %10d\n", countCollisions(hashes, NUM_KEYS));
+
+    delete [] hashes;
+
+    ASSERT(0 != sum);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;      // suppress warning
+    (void)veryVeryVeryVerbose;  // suppress warning
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   The hashing algorithm can be used to create more powerful
+        //   components such as functors that can be used to power hash tables.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("USAGE EXAMPLE\n"
+                            "=============\n");
+
+// Next, we hash some identifiers, and observe that equal identifiers have
+// equal hashes, while identifiers that differ only in their exchange do not:
+//..
+    const SecurityId IBM_1 = { "IBM", 1 };
+    const SecurityId IBM_2 = { "IBM", 2 };
+    const SecurityId IBM_X = { "IBM", 1 };
+
+    HashSecurityId hasher;
+
+    ASSERT(hasher(IBM_1) == hasher(IBM_X));
+    ASSERT(hasher(IBM_1) != hasher(IBM_2));
+//..
+// Finally, we observe that the hash of a sequence of bytes does not depend on
+// how the sequence is divided among calls to the function-call operator:
+//..
+    bslh::WyHashAlgorithm whole;
+    bslh::WyHashAlgorithm pieces;
+
+    whole("ABCDEFGH", 8);
+    pieces("ABC", 3);
+    pieces("DEFGH", 5);
+
+    ASSERT(whole.computeHash() == pieces.computeHash());
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // HASH DISTRIBUTION
+        //   Verify that the hashes are well distributed.
+        //
+        // Concerns:
+        //: 1 Changing any one bit of the input changes each bit of the hash
+        //:   with a probability close to 50%, for inputs of each of the
+        //:   lengths that are finalized differently.
+        //:
+        //: 2 Consecutive integers, and strings differing only in a number,
+        //:   have distinct hashes.
+        //:
+        //: 3 The low bits of the hashes of consecutive integers, used to
+        //:   select buckets in a hash table, are evenly distributed.
+        //
+        // Plan:
+        //: 1 For random inputs of several lengths, flip each input bit, and
+        //:   count how often each bit of the hash changes.  Verify that each
+        //:   frequency is between 40% and 60%.  Inputs of 1 byte are omitted,
+        //:   as there are too few of them for the frequencies to be
+        //:   meaningful.  (C-1)
+        //:
+        //: 2 Hash 100,000 consecutive integers, and as many strings formed
+        //:   from them, and verify that no two hashes are equal.  (C-2)
+        //:
+        //: 3 Count the consecutive integers whose hashes select each of 1024
+        //:   buckets, and verify that each count is within 50% of the mean.
+        //:   (C-3)
+        //
+        // Testing:
+        //   CONCERN: Hashes avalanche and do not collide for similar keys.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nHASH DISTRIBUTION"
+                            "\n=================\n");
+
+        if (verbose) printf("Verify avalanche behavior. (C-1)\n");
+        {
+            static const size_t LENGTHS[] = { 2, 3, 4, 8, 12, 16, 17, 33,
+                                              48, 49, 64, 100 };
+            const int           NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            const int NUM_SAMPLES = 2000;
+
+            static int counts[100 * 8][64];
+
+            for (int i = 0; i < NUM_LENGTHS; ++i) {
+                const size_t LENGTH = LENGTHS[i];
+                const int    NUM_BITS = static_cast<int>(LENGTH * 8);
+
+                memset(counts, 0, sizeof counts);
+
+                unsigned      state = static_cast<unsigned>(LENGTH);
+                unsigned char data[100];
+
+                for (int sample = 0; sample < NUM_SAMPLES; ++sample) {
+                    fillRandom(data, LENGTH, &state);
+                    const Uint64 HASH = hashBytes<Obj>(data, LENGTH);
+
+                    for (int bit = 0; bit < NUM_BITS; ++bit) {
+                        data[bit / 8] ^= static_cast<unsigned char>(
+                                                              1 << bit % 8);
+                        const Uint64 DIFF = HASH ^ hashBytes<Obj>(data,
+                                                                  LENGTH);
+                        data[bit / 8] ^= static_cast<unsigned char>(
+                                                              1 << bit % 8);
+
+                        for (int out = 0; out < 64; ++out) {
+                            counts[bit][out] += static_cast<int>(
+                                                             DIFF >> out & 1);
+                        }
+                    }
+                }
+
+                double minRatio = 1;
+                double maxRatio = 0;
+                for (int bit = 0; bit < NUM_BITS; ++bit) {
+                    for (int out = 0; out < 64; ++out) {
+                        const double RATIO = counts[bit][out] /
+                                             static_cast<double>(NUM_SAMPLES);
+                        minRatio = RATIO < minRatio ? RATIO : minRatio;
+                        maxRatio = RATIO > maxRatio ? RATIO : maxRatio;
+                    }
+                }
+
+                if (veryVerbose) {
+                    P_(LENGTH) P_(minRatio) P(maxRatio)
+                }
+                ASSERTV(LENGTH, minRatio, 0.4 < minRatio);
+                ASSERTV(LENGTH, maxRatio, 0.6 > maxRatio);
+            }
+        }
+
+        const int NUM_KEYS = 100000;
+        Uint64   *hashes   = new Uint64[NUM_KEYS];
+
+        if (verbose) printf("Verify there are no collisions. (C-2)\n");
+        {
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                hashes[i] = hashBytes<Obj>(&i, sizeof i);
+            }
+            ASSERT(0 == countCollisions(hashes, NUM_KEYS));
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                char buffer[64];
+                sprintf(buffer, "security-%d", i);
+                hashes[i] = hashBytes<Obj>(buffer, strlen(buffer));
+            }
+            ASSERT(0 == countCollisions(hashes, NUM_KEYS));
+        }
+
+        if (verbose) printf("Verify the distribution among buckets. (C-3)\n");
+        {
+            const int NUM_BUCKETS = 1024;
+            int       buckets[NUM_BUCKETS] = { 0 };
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                ++buckets[hashBytes<Obj>(&i, sizeof i) & (NUM_BUCKETS - 1)];
+            }
+
+            const int MEAN = NUM_KEYS / NUM_BUCKETS;
+            for (int i = 0; i < NUM_BUCKETS; ++i) {
+                ASSERTV(i, buckets[i], MEAN / 2 < buckets[i]);
+                ASSERTV(i, buckets[i], MEAN * 3 / 2 > buckets[i]);
+            }
+        }
+
+        delete [] hashes;
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING BDE TYPE TRAITS
+        //   The class is bitwise movable and should have a trait that
+        //   indicates that.
+        //
+        // Concerns:
+        //: 1 The class is marked as 'IsBitwiseMoveable'.
+        //
+        // Plan:
+        //: 1 ASSERT the presence of the trait using the
+        //:   'bslmf::IsBitwiseMoveable' metafunction. (C-1)
+        //
+        // Testing:
+        //   Trait IsBitwiseMoveable
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING BDE TYPE TRAITS"
+                            "\n=======================\n");
+
+        if (verbose) printf("ASSERT the presence of the trait using the"
+                            " 'bslmf::IsBitwiseMoveable' metafunction."
+                            " (C-1)\n");
+        {
+            ASSERT(bslmf::IsBitwiseMoveable<WyHashAlgorithm>::value);
+        }
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'k_SEED_LENGTH'
+        //   The class is a seeded algorithm and should expose a
+        //   'k_SEED_LENGTH' enum.
+        //
+        // Concerns:
+        //: 1 'k_SEED_LENGTH' is publicly accessible.
+        //:
+        //: 2 'k_SEED_LENGTH' is set to 8.
+        //
+        // Plan:
+        //: 1 Access 'k_SEED_LENGTH' and ASSERT it is equal to the expected
+        //:   value. (C-1,2)
+        //
+        // Testing:
+        //   enum { k_SEED_LENGTH = 8 };
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'k_SEED_LENGTH'"
+                            "\n=======================\n");
+
+        if (verbose) printf("Access 'k_SEED_LENGTH' and ASSERT it is equal to"
+                            " the expected value. (C-1,2)\n");
+        {
+            ASSERT(8 == WyHashAlgorithm::k_SEED_LENGTH);
+        }
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'result_type' TYPEDEF
+        //   Verify that the class offers the result_type typedef that needs to
+        //   be exposed by all 'bslh' hashing algorithms
+        //
+        // Concerns:
+        //: 1 The typedef 'result_type' is publicly accessible and an alias for
+        //:   'bsls::Types::Uint64'.
+        //:
+        //: 2 'computeHash()' returns 'result_type'
+        //
+        // Plan:
+        //: 1 ASSERT the typedef is accessible and is the correct type using
+        //:   'bslmf::IsSame'. (C-1)
+        //:
+        //: 2 Declare the expected signature of 'computeHash()' and then assign
+        //:   to it.  If it compiles, the test passes. (C-2)
+        //
+        // Testing:
+        //   typedef bsls::Types::Uint64 result_type;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'result_type' TYPEDEF"
+                            "\n=============================\n");
+
+        if (verbose) printf("ASSERT the typedef is accessible and is the"
+                            " correct type using 'bslmf::IsSame'. (C-1)\n");
+        {
+            ASSERT((bslmf::IsSame<bsls::Types::Uint64,
+                                        WyHashAlgorithm::result_type>::VALUE));
+        }
+
+        if (verbose) printf("Declare the expected signature of 'computeHash()'"
+                            " and then assign to it.  If it compiles, the test"
+                            " passes. (C-2)\n");
+        {
+            Obj::result_type (Obj::*expectedSignature) ();
+
+            (void)(expectedSignature = &Obj::computeHash);
+        }
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'operator()' AND 'computeHash()'
+        //   Verify the class provides an overload for the function call
+        //   operator that can be called with some bytes and a length.  Verify
+        //   that calling 'operator()' will permute the algorithm's internal
+        //   state as specified by wyhash.  Verify that 'computeHash()' returns
+        //   the final value by wyhash specifications.
+        //
+        // Concerns:
+        //: 1 The function call operator is callable.
+        //:
+        //: 2 Given the same bytes, the function call operator will permute the
+        //:   internal state of the algorithm in the same way, regardless of
+        //:   whether the bytes are passed in all at once or in pieces of any
+        //:   lengths, including pieces that span or end at the boundaries of
+        //:   the blocks of the algorithm.
+        //:
+        //: 3 Byte sequences passed in to 'operator()' with a length of 0 will
+        //:   not contribute to the final hash
+        //:
+        //: 4 'computeHash()' exists and returns the appropriate value
+        //:   according to the wyhash specification, for the seed supplied at
+        //:   construction.
+        //:
+        //: 5 'operator()' does a BSLS_ASSERT for null pointers.
+        //
+        // Plan:
+        //: 1 Check the output of 'computeHash()' against the test vectors
+        //:   published with the canonical implementation.  (C-4)
+        //:
+        //: 2 For random data of each length up to 200 bytes, verify that the
+        //:   hash of the data supplied all at once is the same as that of the
+        //:   data supplied in two pieces split at every position, and in
+        //:   pieces of every length up to 50 bytes, with calls having a
+        //:   length of 0 in between.  (C-1..3)
+        //:
+        //: 3 Call 'operator()' with a null pointer. (C-5)
+        //
+        // Testing:
+        //   void operator()(void const* key, size_t len);
+        //   result_type computeHash();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'operator()' AND 'computeHash()'"
+                            "\n========================================\n");
+
+        if (verbose) printf("Check the output of 'computeHash()' against the"
+                            " expected results from a known good version of"
+                            " the algorithm. (C-4)\n");
+        {
+            static const struct {
+                int         d_line;
+                const char *d_value;
+                Uint64      d_seed;
+                Uint64      d_expectedHash;
+            } DATA[] = {
+                // LINE  VALUE                                 SEED
+                // HASH
+                { L_,    "",                                    0,
+                  0x42bc986dc5eec4d3ULL },
+                { L_,    "a",                                   1,
+                  0x84508dc903c31551ULL },
+                { L_,    "abc",                                 2,
+                  0x0bc54887cfc9ecb1ULL },
+                { L_,    "message digest",                      3,
+                  0x6e2ff3298208a67cULL },
+                { L_,    "abcdefghijklmnopqrstuvwxyz",          4,
+                  0x9a64e42e897195b9ULL },
+                { L_,    "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                         "abcdefghijklmnopqrstuvwxyz0123456789", 5,
+                  0x9199383239c32554ULL },
+                { L_,    "1234567890123456789012345678901234567890"
+                         "1234567890123456789012345678901234567890",
+                                                                6,
+                  0x7c1ccf6bba30f5a5ULL },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int i = 0; i != NUM_DATA; ++i) {
+                const int     LINE  = DATA[i].d_line;
+                const char   *VALUE = DATA[i].d_value;
+                const Uint64  HASH  = DATA[i].d_expectedHash;
+
+                // The seed is supplied as bytes in little-endian order.
+
+                char seed[Obj::k_SEED_LENGTH];
+                for (int j = 0; j < Obj::k_SEED_LENGTH; ++j) {
+                    seed[j] = static_cast<char>(DATA[i].d_seed >> (8 * j));
+                }
+
+                Obj hash(seed);
+                hash(VALUE, strlen(VALUE));
+                const Uint64 hashResult = hash.computeHash();
+
+                if (veryVerbose) {
+                    P_(LINE) P_(VALUE) P_(HASH) P(hashResult)
+                }
+                LOOP_ASSERT(LINE, hashResult == HASH);
+            }
+
+            // The default seed is 0.
+
+            const char ZERO_SEED[Obj::k_SEED_LENGTH] = { 0 };
+
+            Obj mX;
+            Obj mY(ZERO_SEED);
+            mX("message digest", 14);
+            mY("message digest", 14);
+            ASSERT(mX.computeHash() == mY.computeHash());
+        }
+
+        if (verbose) printf("Hash random data all at once and in pieces."
+                            " (C-1..3)\n");
+        {
+            unsigned      state = 7;
+            unsigned char data[200];
+
+            for (size_t length = 0; length <= sizeof data; ++length) {
+                fillRandom(data, length, &state);
+
+                const Uint64 EXPECTED = hashBytes<Obj>(data, length);
+
+                for (size_t split = 0; split <= length; ++split) {
+                    Obj mX;
+                    mX(data, split);
+                    mX(data + split, length - split);
+
+                    ASSERTV(length, split, EXPECTED == mX.computeHash());
+                }
+
+                for (size_t piece = 1; piece <= 50; ++piece) {
+                    Obj mX;
+                    for (size_t i = 0; i < length; i += piece) {
+                        mX(data + i, piece < length - i ? piece : length - i);
+                        mX(data, 0);
+                    }
+
+                    ASSERTV(length, piece, EXPECTED == mX.computeHash());
+                }
+            }
+        }
+
+        if (verbose) printf("Call 'operator()' with null pointers. (C-5)\n");
+        {
+            const char data[5] = {'a', 'b', 'c', 'd', 'e'};
+
+            bsls::AssertTestHandlerGuard guard;
+
+            ASSERT_FAIL(Obj().operator()(   0, 5));
+            ASSERT_PASS(Obj().operator()(data, 5));
+        }
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS
+        //   Ensure that the implicit destructor as well as the explicit
+        //   default and parameterized constructors are publicly callable.
+        //   Verify that the algorithm can be instantiated with or without a
+        //   seed.
+        //
+        // Concerns:
+        //: 1 Objects can be created using the default constructor.
+        //:
+        //: 2 Objects can be created using the parameterized constructor.
+        //:
+        //: 3 Objects can be destroyed.
+        //:
+        //: 4 Different seeds produce different hashes.
+        //:
+        //: 5 The parameterized constructor does a BSLS_ASSERT for null
+        //:   pointers.
+        //
+        // Plan:
+        //: 1 Create a default constructed 'WyHashAlgorithm' and allow it to
+        //:   leave scope to be destroyed. (C-1,3)
+        //:
+        //: 2 Call the parameterized constructor with several seeds, and
+        //:   verify the hashes of the same data differ.  (C-2,4)
+        //:
+        //: 3 Call the parameterized constructor with a null pointer. (C-5)
+        //
+        // Testing:
+        //   WyHashAlgorithm();
+        //   WyHashAlgorithm(const char *seed);
+        //   ~WyHashAlgorithm();
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            printf("\nTESTING CREATORS"
+                   "\n================\n");
+
+        if (verbose) printf("Create a default constructed 'WyHashAlgorithm'"
+                            " and allow it to leave scope to be destroyed."
+                            " (C-1,3)\n");
+        {
+            Obj alg1;
+        }
+
+        if (verbose) printf("Call the parameterized constructor with several"
+                            " seeds. (C-2,4)\n");
+        {
+            Uint64 hashes[Obj::k_SEED_LENGTH * 8];
+
+            for (int i = 0; i < Obj::k_SEED_LENGTH * 8; ++i) {
+                char seed[Obj::k_SEED_LENGTH] = { 0 };
+                seed[i / 8] = static_cast<char>(1 << i % 8);
+
+                Obj alg(seed);
+                alg("Hello World", 11);
+                hashes[i] = alg.computeHash();
+            }
+            ASSERT(0 == countCollisions(hashes, Obj::k_SEED_LENGTH * 8));
+        }
+
+        if (verbose) printf("Call the parameterized constructor with a null"
+                            " pointer. (C-5)\n");
+        {
+            const char seed[Obj::k_SEED_LENGTH] = { 0 };
+
+            bsls::AssertTestHandlerGuard guard;
+
+            ASSERT_FAIL(Obj dummy(0));
+            ASSERT_PASS(Obj dummy(seed));
+        }
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an instance of 'bslh::WyHashAlgorithm'. (C-1)
+        //:
+        //: 2 Verify different hashes are produced for different c-strings.
+        //:   (C-1)
+        //:
+        //: 3 Verify the same hashes are produced for the same c-strings. (C-1)
+        //:
+        //: 4 Verify different hashes are produced for different 'int's. (C-1)
+        //:
+        //: 5 Verify the same hashes are produced for the same 'int's. (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        if (verbose) printf("Instantiate 'bslh::WyHashAlgorithm'\n");
+        {
+            WyHashAlgorithm hashAlg;
+        }
+
+        if (verbose) printf("Verify different hashes are produced for"
+                            " different c-strings.\n");
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            const char * str1 = "Hello World";
+            const char * str2 = "Goodbye World";
+            hashAlg1(str1, strlen(str1));
+            hashAlg2(str2, strlen(str2));
+            ASSERT(hashAlg1.computeHash() != hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify the same hashes are produced for the same"
+                            " c-strings.\n");
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            const char * str1 = "Hello World";
+            const char * str2 = "Hello World";
+            hashAlg1(str1, strlen(str1));
+            hashAlg2(str2, strlen(str2));
+            ASSERT(hashAlg1.computeHash() == hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify different hashes are produced for"
+                            " different ints.\n");
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            int int1 = 123456;
+            int int2 = 654321;
+            hashAlg1(&int1, sizeof(int));
+            hashAlg2(&int2, sizeof(int));
+            ASSERT(hashAlg1.computeHash() != hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify the same hashes are produced for the same"
+                            " ints.\n");
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            int int1 = 123456;
+            int int2 = 123456;
+            hashAlg1(&int1, sizeof(int));
+            hashAlg2(&int2, sizeof(int));
+            ASSERT(hashAlg1.computeHash() == hashAlg2.computeHash());
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: COMPARISON WITH OTHER ALGORITHMS
+        //   This case prints, for each 'bslh' algorithm, the time in
+        //   nanoseconds taken to hash keys of several lengths, and the number
+        //   of collisions among the low 20 bits of the hashes of 2^20
+        //   consecutive integers (about 385,000 are expected of a random
+        //   function).
+        //
+        // Testing:
+        //   PERFORMANCE TEST: COMPARISON WITH OTHER ALGORITHMS
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE TEST: COMPARISON WITH OTHER ALGORITHMS"
+               "\n==================================================\n");
+
+        printf("%-28s %8s %8s %8s %8s %8s %8s %8s %10s\n",
+               "(ns per hash)",
+               "4",
+               "8",
+               "16",
+               "32",
+               "64",
+               "256",
+               "4096",
+               "collisions");
+
+        benchmark<WyHashAlgorithm>("bslh::WyHashAlgorithm");
+        benchmark<SpookyHashAlgorithm>("bslh::SpookyHashAlgorithm");
+        benchmark<DefaultHashAlgorithm>("bslh::DefaultHashAlgorithm");
+        benchmark<SipHashAlgorithm>("bslh::SipHashAlgorithm");
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -32,6 +32,7 @@ bslmt::ThreadAttributes::ThreadAttributes(bslma::Allocator *basicAllocator)
 , d_schedulingPriority(e_UNSET_PRIORITY)
 , d_stackSize(e_UNSET_STACK_SIZE)
 , d_threadName(basicAllocator)
+, d_cpuSet(basicAllocator)
 {
 }
 
@@ -46,6 +47,7 @@ bslmt::ThreadAttributes::ThreadAttributes(
 , d_schedulingPriority(original.d_schedulingPriority)
 , d_stackSize(original.d_stackSize)
 , d_threadName(original.d_threadName, basicAllocator)
+, d_cpuSet(original.d_cpuSet, basicAllocator)
 {
 }
 
@@ -60,6 +62,7 @@ bslmt::ThreadAttributes& bslmt::ThreadAttributes::operator=(
     d_schedulingPriority  = rhs.d_schedulingPriority;
     d_stackSize           = rhs.d_stackSize;
     d_threadName          = rhs.d_threadName;
+    d_cpuSet              = rhs.d_cpuSet;
 
     return *this;
 }
@@ -74,7 +77,8 @@ bool bslmt::operator==(const ThreadAttributes& lhs,
            lhs.schedulingPolicy()   == rhs.schedulingPolicy()   &&
            lhs.schedulingPriority() == rhs.schedulingPriority() &&
            lhs.stackSize()          == rhs.stackSize()          &&
-           lhs.threadName()         == rhs.threadName();
+           lhs.threadName()         == rhs.threadName()         &&
+           lhs.cpuSet()             == rhs.cpuSet();
 }
 
 bool bslmt::operator!=(const ThreadAttributes& lhs,
@@ -86,7 +90,8 @@ bool bslmt::operator!=(const ThreadAttributes& lhs,
            lhs.schedulingPolicy()   != rhs.schedulingPolicy()   ||
            lhs.schedulingPriority() != rhs.schedulingPriority() ||
            lhs.stackSize()          != rhs.stackSize()          ||
-           lhs.threadName()         != rhs.threadName();
+           lhs.threadName()         != rhs.threadName()         ||
+           lhs.cpuSet()             != rhs.cpuSet();
 }
 
 }  // close enterprise namespace
@@ -38,6 +38,7 @@ BSLS_IDENT("$Id: $")
 //  schedulingPolicy    enum SchedulingPolicy  e_SCHED_DEFAULT
 //  schedulingPriority  int                    e_UNSET_PRIORITY
 //  threadName          bsl::string            ""
+//  cpuSet              bsl::vector<int>       empty
 //
 //  Name          Constraint
 //  ---------     ---------------------------------------------------
@@ -132,6 +133,23 @@ BSLS_IDENT("$Id: $")
 // thread names, and there is a maximum thread name length of 15 on both of
 // those platforms.
 //
+///'cpuSet' Attribute
+/// - - - - - - - - -
+// The 'cpuSet' attribute indicates the set of CPUs, identified by their
+// zero-based operating system indices, on which the created thread may be
+// scheduled (i.e., the thread's CPU affinity).  An empty 'cpuSet' (the
+// default) indicates that the thread may run on any CPU available to its
+// parent (i.e., the affinity of the parent thread is inherited).  Restricting
+// a latency-sensitive thread to a single CPU avoids the cost of the operating
+// system migrating it between CPUs (which loses the contents of the CPU's
+// caches), and, on a NUMA machine, restricting a thread to the CPUs of one
+// socket keeps it close to the memory it allocates (most operating systems
+// allocate physical memory from the node of the CPU that first touches it).
+// At this time, only Linux and Windows support this attribute; it is ignored
+// on other platforms.  On Windows, only the first 64 CPUs (the CPUs of the
+// first processor group) can be specified.  See 'bslmt_threadutil' for
+// information about changing the CPU affinity of a running thread.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -284,6 +302,10 @@ BSLS_IDENT("$Id: $")
 #include <bsl_string.h>
 #endif
 
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
 namespace BloombergLP {
 namespace bslmt {
 
@@ -368,6 +390,10 @@ class ThreadAttributes {
 
     bsl::string      d_threadName;          // name of the thread
 
+    bsl::vector<int> d_cpuSet;              // indices of the CPUs on which
+                                            // the thread may run (empty if
+                                            // unrestricted)
+
   public:
     // CREATORS
     explicit
@@ -381,6 +407,7 @@ class ThreadAttributes {
         //: o 'schedulingPriority() == e_UNSET_PRIORITY'
         //: o 'stackSize()          == e_UNSET_STACK_SIZE'
         //: o 'threadName()         == ""'
+        //: o 'cpuSet()             == bsl::vector<int>()'
         // Optionally specify a 'basicAllocator' used to supply memory.  If
         // 'basicAllocator' is 0, the currently installed default allocator is
         // used.
@@ -398,6 +425,16 @@ class ThreadAttributes {
         // return a reference providing modifiable access to this object.
 
     // MANIPULATORS
+    void setCpuSet(const bsl::vector<int>& value);
+        // Set the 'cpuSet' attribute of this object to the specified 'value'.
+        // An empty 'value' indicates that a thread may run on any CPU
+        // available to the thread that creates it; otherwise a thread may run
+        // only on the CPUs having the (zero-based) indices in 'value'.  See
+        // the {'cpuSet' Attribute} section in the component-level
+        // documentation for information about support for this attribute.
+        // The behavior is undefined unless each element of 'value' is
+        // non-negative.
+
     void setDetachedState(DetachedState value);
         // Set the 'detachedState' attribute of this object to the specified
         // 'value'.  A value of 'e_CREATE_JOINABLE' (the default) indicates
@@ -455,6 +492,11 @@ class ThreadAttributes {
     bslma::Allocator *allocator() const;
         // Return the allocator used by this object to supply memory.
 
+    const bsl::vector<int>& cpuSet() const;
+        // Return a reference providing non-modifiable access to the 'cpuSet'
+        // attribute of this object.  An empty 'cpuSet' indicates that a
+        // thread may run on any CPU available to the thread that creates it.
+
     DetachedState detachedState() const;
         // Return the value of the 'detachedState' attribute of this object.  A
         // value of 'e_CREATE_JOINABLE' indicates that a thread must be joined
@@ -511,14 +553,16 @@ bool operator==(const ThreadAttributes& lhs, const ThreadAttributes& rhs);
     // value, and 'false' otherwise.  Two 'ThreadAttributes' objects have the
     // same value if the corresponding values of their 'detachedState',
     // 'guardSize', 'inheritSchedule', 'schedulingPolicy',
-    // 'schedulingPriority', and 'stackSize' attributes are the same.
+    // 'schedulingPriority', 'stackSize', 'threadName', and 'cpuSet' attributes
+    // are the same.
 
 bool operator!=(const ThreadAttributes& lhs, const ThreadAttributes& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
     // same value, and 'false' otherwise.  Two 'baltzo::LocalTimeDescriptor'
     // objects do not have the same value if the corresponding values of their
     // 'detachedState', 'guardSize', 'inheritSchedule', 'schedulingPolicy',
-    // 'schedulingPriority', and 'stackSize' attributes are not the same.
+    // 'schedulingPriority', 'stackSize', 'threadName', and 'cpuSet'
+    // attributes are not the same.
 
 }  // close package namespace
 
@@ -531,6 +575,12 @@ bool operator!=(const ThreadAttributes& lhs, const ThreadAttributes& rhs);
                           // ----------------------
 
 // MANIPULATORS
+inline
+void bslmt::ThreadAttributes::setCpuSet(const bsl::vector<int>& value)
+{
+    d_cpuSet = value;
+}
+
 inline
 void bslmt::ThreadAttributes::setDetachedState(
                                          ThreadAttributes::DetachedState value)
@@ -596,6 +646,12 @@ bslma::Allocator *bslmt::ThreadAttributes::allocator() const
     return d_threadName.get_allocator().mechanism();
 }
 
+inline
+const bsl::vector<int>& bslmt::ThreadAttributes::cpuSet() const
+{
+    return d_cpuSet;
+}
+
 inline
 bslmt::ThreadAttributes::DetachedState
 bslmt::ThreadAttributes::detachedState() const
@@ -21,6 +21,7 @@
 #include <bsl_cstdlib.h>
 #include <bsl_ios.h>
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 #ifdef BSLMT_PLATFORM_POSIX_THREADS
 #include <pthread.h>
@@ -242,7 +243,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 3: {
+      case 4: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE TEST
         //
@@ -291,6 +292,101 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'cpuSet' ATTRIBUTE
+        //
+        // Concerns:
+        //: 1 The 'cpuSet' attribute is empty by default.
+        //:
+        //: 2 'setCpuSet' sets the attribute to the specified value, which is
+        //:   returned by 'cpuSet'.
+        //:
+        //: 3 The 'cpuSet' attribute participates in copy construction,
+        //:   assignment, and equality comparison.
+        //:
+        //: 4 The 'cpuSet' attribute uses the object allocator, and never the
+        //:   default allocator.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, set the 'cpuSet' attribute of
+        //:   objects created with a test allocator to a variety of values,
+        //:   copy and assign them, and verify the attribute and the value of
+        //:   the objects.  (C-1..4)
+        //
+        // Testing:
+        //   void setCpuSet(const bsl::vector<int>& value);
+        //   const bsl::vector<int>& cpuSet() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'cpuSet' ATTRIBUTE" << endl
+                                  << "==================" << endl;
+
+        bslma::TestAllocator ta;
+        bslma::TestAllocator da;
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        static const struct {
+            int         d_line;
+            int         d_numCpus;
+            int         d_cpus[4];
+        } DATA[] = {
+            //LINE  NUM  CPUS
+            //----  ---  -----------------
+            { L_,   0,   { 0 }             },
+            { L_,   1,   { 0 }             },
+            { L_,   1,   { 7 }             },
+            { L_,   2,   { 0, 1 }          },
+            { L_,   3,   { 2, 4, 6 }       },
+            { L_,   4,   { 1, 3, 64, 100 } },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        {
+            Obj mX(&ta);    const Obj& X = mX;
+            ASSERT(X.cpuSet().empty());
+        }
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int              LINE = DATA[ti].d_line;
+            const bsl::vector<int> CPUS(DATA[ti].d_cpus,
+                                        DATA[ti].d_cpus + DATA[ti].d_numCpus,
+                                        &ta);
+
+            Obj mX(&ta);    const Obj& X = mX;
+
+            mX.setCpuSet(CPUS);
+            ASSERTV(LINE, CPUS == X.cpuSet());
+            ASSERTV(LINE, CPUS.empty() == (Obj(&ta) == X));
+
+            const Obj Y(X, &ta);
+            ASSERTV(LINE, CPUS == Y.cpuSet());
+            ASSERTV(LINE, X == Y);
+
+            Obj mZ(&ta);    const Obj& Z = mZ;
+            mZ.setCpuSet(bsl::vector<int>(1, 1000, &ta));
+            ASSERTV(LINE, X != Z);
+
+            mZ = X;
+            ASSERTV(LINE, CPUS == Z.cpuSet());
+            ASSERTV(LINE, X == Z);
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const bsl::vector<int> OTHER(
+                                        DATA[tj].d_cpus,
+                                        DATA[tj].d_cpus + DATA[tj].d_numCpus,
+                                        &ta);
+
+                Obj mW(&ta);    const Obj& W = mW;
+                mW.setCpuSet(OTHER);
+
+                ASSERTV(LINE, DATA[tj].d_line, (ti == tj) == (X == W));
+                ASSERTV(LINE, DATA[tj].d_line, (ti != tj) == (X != W));
+            }
+        }
+
+        ASSERT(0 == da.numAllocations());
+      } break;
       case 2: {
         // ------------------------------------------------------------------
         // Testing Primary Manipulators / Accessors
@@ -465,6 +561,7 @@ int main(int argc, char *argv[])
         ASSERT(X.inheritSchedule());
         ASSERT(0 != X.stackSize());
         ASSERT("" == X.threadName());
+        ASSERT(X.cpuSet().empty());
       } break;
       case -1: {
         // --------------------------------------------------------------------
@@ -112,6 +112,33 @@ BSLS_IDENT("$Id: $")
 //               'inheritSchedule' are ignored for all clients.
 //..
 //
+///Setting Thread CPU Affinity
+///---------------------------
+// 'bslmt::ThreadUtil' allows clients to restrict the set of CPUs on which a
+// newly created thread may run by setting the 'cpuSet' attribute of a thread
+// attributes object supplied to the 'create' method, and to change or obtain
+// the set of CPUs on which a running thread may run with the
+// 'setThreadCpuSet' and 'getThreadCpuSet' methods.  CPUs are identified by
+// their zero-based operating system indices.  Pinning a latency-sensitive
+// thread to a CPU (or to the CPUs of one NUMA node) avoids the cost of the
+// operating system migrating it between CPUs, which discards the contents of
+// the CPU caches and, across sockets, leaves the thread far from the memory
+// it has touched.
+//..
+// Platform      Restrictions
+// ------------  --------------------------------------------------------------
+// Linux         None.  Spawning of threads fails if 'cpuSet' contains no CPU
+//               available to the process.
+//
+// Windows       Only the CPUs of the first processor group (i.e., indices
+//               less than 64 on 64-bit platforms, and less than 32 on 32-bit
+//               platforms) can be specified.  The 'cpuSet' attribute is
+//               applied once a thread has been spawned.
+//
+// Other         The 'cpuSet' attribute is ignored, and 'setThreadCpuSet' and
+//               'getThreadCpuSet' fail.
+//..
+//
 ///Supported Clock-Types
 ///---------------------
 // The component 'bsls::SystemClockType' supplies the enumeration indicating
@@ -328,6 +355,10 @@ BSLS_IDENT("$Id: $")
 #include <bsl_string.h>
 #endif
 
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
 namespace BloombergLP {
 
 extern "C" {
@@ -561,6 +592,17 @@ struct ThreadUtil {
         // platform / policy combinations, 'getMinSchedulingPriority(policy)'
         // and 'getMaxSchedulingPriority(policy)' return the same value.
 
+    static int getThreadCpuSet(bsl::vector<int> *cpuSet,
+                               const Handle&     threadHandle);
+        // Load into the specified 'cpuSet' the (zero-based) indices, in
+        // increasing order, of the CPUs on which the thread referred to by the
+        // specified 'threadHandle' may run.  Return 0 on success, and a
+        // non-zero value otherwise.  The behavior is undefined unless
+        // 'threadHandle' refers to a running thread.  Note that this method
+        // fails on all platforms other than Linux and Windows (see {Setting
+        // Thread CPU Affinity}).  Also note that 'self()' can be supplied to
+        // obtain the CPUs on which the current thread may run.
+
     static void getThreadName(bsl::string *threadName);
         // Load the name of the current thread into the specified
         // '*threadName'.  Note that this method clears '*threadName' on all
@@ -582,6 +624,20 @@ struct ThreadUtil {
         // many factors including system scheduling and system timer
         // resolution, and may be significantly longer than the time requested.
 
+    static int setThreadCpuSet(const Handle&           threadHandle,
+                               const bsl::vector<int>& cpuSet);
+        // Restrict the thread referred to by the specified 'threadHandle' to
+        // run only on the CPUs having the (zero-based) indices in the
+        // specified 'cpuSet', or, if 'cpuSet' is empty, allow it to run on
+        // any CPU available to the process.  Return 0 on success, and a
+        // non-zero value otherwise (e.g., if 'cpuSet' contains no CPU
+        // available to the process).  The behavior is undefined unless
+        // 'threadHandle' refers to a running thread, and each element of
+        // 'cpuSet' is non-negative.  Note that this method fails on all
+        // platforms other than Linux and Windows (see {Setting Thread CPU
+        // Affinity}).  Also note that 'self()' can be supplied to restrict the
+        // current thread.
+
     static void setThreadName(const bslstl::StringRef& threadName);
         // Set the name of the current thread to the specified 'threadName'.
         // On all platforms other than Linux and Darwin this method has no
@@ -889,6 +945,15 @@ int bslmt::ThreadUtil::getMaxSchedulingPriority(
     return Imp::getMaxSchedulingPriority(policy);
 }
 
+inline
+int bslmt::ThreadUtil::getThreadCpuSet(bsl::vector<int> *cpuSet,
+                                       const Handle&     threadHandle)
+{
+    BSLS_ASSERT_SAFE(cpuSet);
+
+    return Imp::getThreadCpuSet(cpuSet, threadHandle);
+}
+
 inline
 void bslmt::ThreadUtil::getThreadName(bsl::string *threadName)
 {
@@ -909,6 +974,13 @@ void bslmt::ThreadUtil::microSleep(int microseconds, int seconds)
     Imp::microSleep(microseconds, seconds);
 }
 
+inline
+int bslmt::ThreadUtil::setThreadCpuSet(const Handle&           threadHandle,
+                                       const bsl::vector<int>& cpuSet)
+{
+    return Imp::setThreadCpuSet(threadHandle, cpuSet);
+}
+
 inline
 void bslmt::ThreadUtil::setThreadName(const bslstl::StringRef& threadName)
 {
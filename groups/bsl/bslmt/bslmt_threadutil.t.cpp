@@ -32,10 +32,12 @@
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_c_limits.h>
+#include <bsl_functional.h>
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_map.h>
 #include <bsl_set.h>
+#include <bsl_vector.h>
 
 #include <errno.h>
 
@@ -296,6 +298,41 @@ class Mutex {
 }  // close namespace u
 }  // close unnamed namespace
 
+//-----------------------------------------------------------------------------
+//                              CPU Affinity Test
+//-----------------------------------------------------------------------------
+
+namespace BSLMT_THREADUTIL_CPU_AFFINITY_TEST {
+
+class CpuSetRecorder {
+    // This functor, when invoked, loads the CPU set of the current thread
+    // into the vector supplied at construction.
+
+    // DATA
+    bsl::vector<int> *d_cpuSet_p;  // where to load the CPU set (held)
+    int              *d_status_p;  // status of 'getThreadCpuSet' (held)
+
+  public:
+    // CREATORS
+    CpuSetRecorder(bsl::vector<int> *cpuSet, int *status)
+    : d_cpuSet_p(cpuSet)
+    , d_status_p(status)
+        // Create a functor that loads the CPU set of the thread invoking it
+        // into the specified 'cpuSet', and the status of the operation into
+        // the specified 'status'.
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Load the CPU set of the current thread.
+    {
+        *d_status_p = Obj::getThreadCpuSet(d_cpuSet_p, Obj::self());
+    }
+};
+
+}  // close namespace BSLMT_THREADUTIL_CPU_AFFINITY_TEST
+
 //-----------------------------------------------------------------------------
 //                               All Create Test
 //-----------------------------------------------------------------------------
@@ -1409,6 +1446,148 @@ int main(int argc, char *argv[])
 #endif
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 17: {
+        // --------------------------------------------------------------------
+        // CPU AFFINITY TEST
+        //
+        // Concerns:
+        //: 1 'getThreadCpuSet' loads a non-empty, sorted set of CPUs for the
+        //:   current thread (on platforms supporting CPU affinity).
+        //:
+        //: 2 'setThreadCpuSet' restricts the thread to exactly the specified
+        //:   CPUs, and an empty set makes every CPU available to the process
+        //:   available to the thread again.
+        //:
+        //: 3 A thread created with a 'cpuSet' attribute runs only on the
+        //:   specified CPUs, and a thread created without one inherits the
+        //:   CPU set of its parent.
+        //:
+        //: 4 'setThreadCpuSet' fails, and leaves the CPU set of the thread
+        //:   unchanged, if the CPU set contains an index that cannot be
+        //:   represented.
+        //:
+        //: 5 On platforms not supporting CPU affinity, 'setThreadCpuSet' and
+        //:   'getThreadCpuSet' fail, and the 'cpuSet' attribute is ignored.
+        //
+        // Plan:
+        //: 1 Obtain the CPU set of the current thread and verify it.  (C-1)
+        //:
+        //: 2 Restrict the current thread to its first and to its last
+        //:   available CPU, verifying the CPU set after each call, and then
+        //:   restore the original CPU set.  (C-2)
+        //:
+        //: 3 Create threads with and without a 'cpuSet' attribute that record
+        //:   their own CPU sets, and verify the recorded sets.  (C-3, 5)
+        //:
+        //: 4 Attempt to set a CPU set containing a very large index.  (C-4)
+        //
+        // Testing:
+        //   int getThreadCpuSet(bsl::vector<int> *, const Handle&);
+        //   int setThreadCpuSet(const Handle&, const bsl::vector<int>&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "CPU AFFINITY TEST\n"
+                             "=================\n";
+
+        using namespace BSLMT_THREADUTIL_CPU_AFFINITY_TEST;
+
+        bsl::vector<int> original;
+        int              rc = Obj::getThreadCpuSet(&original, Obj::self());
+
+#if defined(BSLS_PLATFORM_OS_LINUX) || defined(BSLS_PLATFORM_OS_WINDOWS)
+        ASSERT(0 == rc);
+        ASSERT(!original.empty());
+        ASSERT(bsl::adjacent_find(original.begin(),
+                                  original.end(),
+                                  bsl::greater_equal<int>()) ==
+                                                               original.end());
+
+        if (veryVerbose) {
+            cout << "\tAvailable CPUs:";
+            for (bsl::size_t i = 0; i < original.size(); ++i) {
+                cout << ' ' << original[i];
+            }
+            cout << endl;
+        }
+
+        const int FIRST = original.front();
+        const int LAST  = original.back();
+
+        bsl::vector<int> cpuSet;
+
+        if (verbose) cout << "\tRestricting the current thread.\n";
+        {
+            bsl::vector<int> first(1, FIRST);
+
+            ASSERT(0 == Obj::setThreadCpuSet(Obj::self(), first));
+            ASSERT(0 == Obj::getThreadCpuSet(&cpuSet, Obj::self()));
+            ASSERT(first == cpuSet);
+
+            bsl::vector<int> last(1, LAST);
+
+            ASSERT(0 == Obj::setThreadCpuSet(Obj::self(), last));
+            ASSERT(0 == Obj::getThreadCpuSet(&cpuSet, Obj::self()));
+            ASSERT(last == cpuSet);
+
+            ASSERT(0 == Obj::setThreadCpuSet(Obj::self(),
+                                             bsl::vector<int>()));
+            ASSERT(0 == Obj::getThreadCpuSet(&cpuSet, Obj::self()));
+            ASSERT(original == cpuSet);
+        }
+
+        if (verbose) cout << "\tCreating threads.\n";
+        {
+            Attr attr;
+            attr.setCpuSet(bsl::vector<int>(1, LAST));
+
+            int              status = -1;
+            Obj::Handle      handle;
+
+            ASSERT(0 == Obj::create(&handle,
+                                    attr,
+                                    CpuSetRecorder(&cpuSet, &status)));
+            ASSERT(0 == Obj::join(handle));
+            ASSERT(0 == status);
+            ASSERT(bsl::vector<int>(1, LAST) == cpuSet);
+
+            bsl::vector<int> first(1, FIRST);
+            ASSERT(0 == Obj::setThreadCpuSet(Obj::self(), first));
+
+            status = -1;
+            ASSERT(0 == Obj::create(&handle,
+                                    CpuSetRecorder(&cpuSet, &status)));
+            ASSERT(0 == Obj::join(handle));
+            ASSERT(0 == status);
+            ASSERT(first == cpuSet);
+
+            ASSERT(0 == Obj::setThreadCpuSet(Obj::self(), original));
+        }
+
+        if (verbose) cout << "\tSetting an invalid CPU set.\n";
+        {
+            const bsl::vector<int> invalid(1, 1 << 20);
+
+            ASSERT(0 != Obj::setThreadCpuSet(Obj::self(), invalid));
+            ASSERT(0 == Obj::getThreadCpuSet(&cpuSet, Obj::self()));
+            ASSERT(original == cpuSet);
+        }
+#else
+        ASSERT(0 != rc);
+        ASSERT(0 != Obj::setThreadCpuSet(Obj::self(), bsl::vector<int>()));
+
+        Attr attr;
+        attr.setCpuSet(bsl::vector<int>(1, 0));
+
+        int         status = 0;
+        Obj::Handle handle;
+
+        ASSERT(0 == Obj::create(&handle,
+                                attr,
+                                CpuSetRecorder(&original, &status)));
+        ASSERT(0 == Obj::join(handle));
+        ASSERT(0 != status);
+#endif
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // ALL THREAD CREATE TEST
@@ -44,6 +44,7 @@ BSLS_IDENT_RCSID(bslmt_threadutilimpl_pthread_cpp,"$Id$ $CSID$")
 # include <sys/utsname.h>
 #elif defined(BSLS_PLATFORM_OS_LINUX)
 # include <sys/prctl.h>
+# include <sched.h>        // 'cpu_set_t'
 #endif
 
 #include <errno.h>         // constant 'EINTR'
@@ -74,6 +75,37 @@ int localPthreadsPolicy(int policy)
     BSLS_ASSERT_OPT(0);
 }
 
+#if defined(BSLS_PLATFORM_OS_LINUX)
+static int loadNativeCpuSet(cpu_set_t               *destination,
+                            const bsl::vector<int>&  cpuSet)
+    // Load into the specified 'destination' the CPUs having the indices in
+    // the specified 'cpuSet', or every CPU that can be represented if
+    // 'cpuSet' is empty.  Return 0 on success, and a non-zero value if an
+    // element of 'cpuSet' cannot be represented in a 'cpu_set_t'.
+{
+    CPU_ZERO(destination);
+
+    if (cpuSet.empty()) {
+        // The kernel silently ignores CPUs that are not available to the
+        // process.
+
+        for (int i = 0; i < CPU_SETSIZE; ++i) {
+            CPU_SET(i, destination);
+        }
+        return 0;                                                     // RETURN
+    }
+
+    for (bsl::size_t i = 0; i < cpuSet.size(); ++i) {
+        const int cpu = cpuSet[i];
+        if (cpu < 0 || CPU_SETSIZE <= cpu) {
+            return -1;                                                // RETURN
+        }
+        CPU_SET(cpu, destination);
+    }
+    return 0;
+}
+#endif
+
 static int initPthreadAttribute(pthread_attr_t                 *destination,
                                 const bslmt::ThreadAttributes&  src)
     // Initialize the specified pthreads attribute type 'destination',
@@ -167,6 +199,14 @@ static int initPthreadAttribute(pthread_attr_t                 *destination,
         rc |= pthread_attr_setstacksize(destination, stackSize);
     }
 
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (!src.cpuSet().empty()) {
+        cpu_set_t cpuSet;
+        rc |= loadNativeCpuSet(&cpuSet, src.cpuSet());
+        rc |= pthread_attr_setaffinity_np(destination, sizeof cpuSet, &cpuSet);
+    }
+#endif
+
     return rc;
 }
 
@@ -395,6 +435,36 @@ int bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::sleep(
     return result;
 }
 
+int bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::getThreadCpuSet(
+                                                bsl::vector<int> *cpuSet,
+                                                const Handle&     threadHandle)
+{
+    BSLS_ASSERT(cpuSet);
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    cpu_set_t nativeCpuSet;
+    const int rc = pthread_getaffinity_np(threadHandle,
+                                          sizeof nativeCpuSet,
+                                          &nativeCpuSet);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    cpuSet->clear();
+    for (int i = 0; i < CPU_SETSIZE; ++i) {
+        if (CPU_ISSET(i, &nativeCpuSet)) {
+            cpuSet->push_back(i);
+        }
+    }
+    return 0;
+#else
+    // CPU affinity is not supported on other platforms.
+
+    (void)threadHandle;
+    return -1;
+#endif
+}
+
 void bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::getThreadName(
                                                        bsl::string *threadName)
 {
@@ -457,6 +527,27 @@ int bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::microSleep(
     return result;
 }
 
+int bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::setThreadCpuSet(
+                                         const Handle&           threadHandle,
+                                         const bsl::vector<int>& cpuSet)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    cpu_set_t nativeCpuSet;
+    if (0 != loadNativeCpuSet(&nativeCpuSet, cpuSet)) {
+        return -1;                                                    // RETURN
+    }
+    return pthread_setaffinity_np(threadHandle,
+                                  sizeof nativeCpuSet,
+                                  &nativeCpuSet);
+#else
+    // CPU affinity is not supported on other platforms.
+
+    (void)threadHandle;
+    (void)cpuSet;
+    return -1;
+#endif
+}
+
 void bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::setThreadName(
                                            const bslstl::StringRef& threadName)
 {
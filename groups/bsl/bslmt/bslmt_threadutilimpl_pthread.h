@@ -86,6 +86,10 @@ BSLS_IDENT("$Id: $")
 #include <bsl_string.h>
 #endif
 
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
 #ifndef INCLUDED_PTHREAD
 #include <pthread.h>
 #define INCLUDED_PTHREAD
@@ -196,6 +200,13 @@ struct ThreadUtilImpl<Platform::PosixThreads> {
         // platform / policy combinations, 'getMinSchedulingPriority(policy)'
         // and 'getMaxSchedulingPriority(policy)' return the same value.
 
+    static int getThreadCpuSet(bsl::vector<int> *cpuSet,
+                               const Handle&     threadHandle);
+        // Load into the specified 'cpuSet' the (zero-based) indices, in
+        // increasing order, of the CPUs on which the thread referred to by the
+        // specified 'threadHandle' may run.  Return 0 on success, and a
+        // non-zero value otherwise.
+
     static void getThreadName(bsl::string *threadName);
         // Load the name of the current thread into the specified 'threadName'.
         // Note that this method clears '*threadName' on all platforms other
@@ -222,6 +233,14 @@ struct ThreadUtilImpl<Platform::PosixThreads> {
         // depends on many factors including system scheduling, and system
         // timer resolution.
 
+    static int setThreadCpuSet(const Handle&           threadHandle,
+                               const bsl::vector<int>& cpuSet);
+        // Restrict the thread referred to by the specified 'threadHandle' to
+        // run only on the CPUs having the (zero-based) indices in the
+        // specified 'cpuSet', or, if 'cpuSet' is empty, allow it to run on
+        // any CPU available to the process.  Return 0 on success, and a
+        // non-zero value otherwise.
+
     static void setThreadName(const bslstl::StringRef& threadName);
         // Set the name of the current thread to the specified 'threadName'.
         // On all platforms other than Linux and Darwin this method has no
@@ -326,6 +326,34 @@ static unsigned _stdcall ThreadEntry(void *arg)
     return (unsigned)(bsls::Types::IntPtr)ret;
 }
 
+static int loadAffinityMask(DWORD_PTR               *mask,
+                            const bsl::vector<int>&  cpuSet)
+    // Load into the specified 'mask' the affinity mask having a bit set for
+    // each CPU index in the specified 'cpuSet', or the affinity mask of the
+    // process if 'cpuSet' is empty.  Return 0 on success, and a non-zero value
+    // if an element of 'cpuSet' cannot be represented in an affinity mask
+    // (i.e., is not in the first processor group).
+{
+    if (cpuSet.empty()) {
+        DWORD_PTR systemMask;
+        return GetProcessAffinityMask(GetCurrentProcess(), mask, &systemMask)
+               ? 0
+               : -1;                                                  // RETURN
+    }
+
+    const int k_MASK_BITS = static_cast<int>(sizeof(DWORD_PTR) * 8);
+
+    *mask = 0;
+    for (bsl::size_t i = 0; i < cpuSet.size(); ++i) {
+        const int cpu = cpuSet[i];
+        if (cpu < 0 || k_MASK_BITS <= cpu) {
+            return -1;                                                // RETURN
+        }
+        *mask |= static_cast<DWORD_PTR>(1) << cpu;
+    }
+    return 0;
+}
+
 }  // close unnamed namespace
 
                // --------------------------------------------
@@ -369,6 +397,13 @@ int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::create(
                                         // but allow it just in case anyone was
                                         // depending on it.
 
+    DWORD_PTR affinityMask = 0;
+    if (!attribute.cpuSet().empty()
+     && 0 != loadAffinityMask(&affinityMask, attribute.cpuSet())) {
+        freeStartupInfo(startInfo);
+        return 1;                                                     // RETURN
+    }
+
     startInfo->d_threadArg = userData;
     startInfo->d_function  = function;
     handle->d_handle = (HANDLE)_beginthreadex(
@@ -382,6 +417,12 @@ int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::create(
         freeStartupInfo(startInfo);
         return 1;                                                     // RETURN
     }
+    if (affinityMask) {
+        // The thread has already been spawned, so a mask containing no CPU
+        // available to the process is ignored rather than reported.
+
+        SetThreadAffinityMask(handle->d_handle, affinityMask);
+    }
     if (ThreadAttributes::e_CREATE_DETACHED ==
                                                    attribute.detachedState()) {
         HANDLE tmpHandle = handle->d_handle;
@@ -472,6 +513,48 @@ void bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::exit(void *status)
     _endthreadex((unsigned)(bsls::Types::IntPtr)status);
 }
 
+int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::getThreadCpuSet(
+                                                bsl::vector<int> *cpuSet,
+                                                const Handle&     threadHandle)
+{
+    BSLS_ASSERT(cpuSet);
+
+    // Windows provides no function to obtain the affinity mask of a thread,
+    // but 'SetThreadAffinityMask' returns the previous mask, so we briefly
+    // set the mask of the process, and then restore the previous mask.
+
+    DWORD_PTR processMask;
+    if (0 != loadAffinityMask(&processMask, bsl::vector<int>())) {
+        return -1;                                                    // RETURN
+    }
+
+    const DWORD_PTR mask = SetThreadAffinityMask(threadHandle.d_handle,
+                                                 processMask);
+    if (0 == mask) {
+        return -1;                                                    // RETURN
+    }
+    SetThreadAffinityMask(threadHandle.d_handle, mask);
+
+    cpuSet->clear();
+    for (int i = 0; i < static_cast<int>(sizeof(DWORD_PTR) * 8); ++i) {
+        if (mask & (static_cast<DWORD_PTR>(1) << i)) {
+            cpuSet->push_back(i);
+        }
+    }
+    return 0;
+}
+
+int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::setThreadCpuSet(
+                                         const Handle&           threadHandle,
+                                         const bsl::vector<int>& cpuSet)
+{
+    DWORD_PTR mask;
+    if (0 != loadAffinityMask(&mask, cpuSet)) {
+        return -1;                                                    // RETURN
+    }
+    return 0 == SetThreadAffinityMask(threadHandle.d_handle, mask) ? -1 : 0;
+}
+
 int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::createKey(
                                        Key                         *key,
                                        bslmt_KeyDestructorFunction  destructor)
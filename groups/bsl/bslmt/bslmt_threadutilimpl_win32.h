@@ -90,6 +90,10 @@ BSLS_IDENT("$Id: $")
 #include <bsl_string.h>
 #endif
 
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
 typedef unsigned long DWORD;
 typedef int BOOL;
 typedef void *HANDLE;
@@ -225,6 +229,13 @@ struct ThreadUtilImpl<Platform::Win32Threads> {
         // policy combinations, 'getMinSchedulingPriority(policy)' and
         // 'getMaxSchedulingPriority(policy)' return the same value.
 
+    static int getThreadCpuSet(bsl::vector<int> *cpuSet,
+                               const Handle&     threadHandle);
+        // Load into the specified 'cpuSet' the (zero-based) indices, in
+        // increasing order, of the CPUs on which the thread referred to by the
+        // specified 'threadHandle' may run.  Return 0 on success, and a
+        // non-zero value otherwise.
+
     static void getThreadName(bsl::string *threadName);
         // Load the name of the current thread into the specified 'threadName'.
         // Note that this method clears '*threadName' as thread naming is not
@@ -242,6 +253,14 @@ struct ThreadUtilImpl<Platform::Win32Threads> {
         // schedule another thread to run.  This allows cooperating threads of
         // the same priority to share CPU resources equally.
 
+    static int setThreadCpuSet(const Handle&           threadHandle,
+                               const bsl::vector<int>& cpuSet);
+        // Restrict the thread referred to by the specified 'threadHandle' to
+        // run only on the CPUs having the (zero-based) indices in the
+        // specified 'cpuSet', or, if 'cpuSet' is empty, allow it to run on
+        // any CPU available to the process.  Return 0 on success, and a
+        // non-zero value otherwise.
+
     static void setThreadName(const bslstl::StringRef&  threadName);
         // Set the name of the current thread to the specified 'threadName'.
         // On Windows this function has no effect.
@@ -468,6 +468,18 @@ class Channel {
                                                          // synchronized with
                                                          // 'd_writeMutex'
 
+    bsls::AtomicInt64                d_numBytesCopied;   // bytes requested to
+                                                         // be written that
+                                                         // were copied into
+                                                         // buffers owned by
+                                                         // the channel
+
+    bsls::AtomicInt64                d_numBytesZeroCopy; // bytes requested to
+                                                         // be written that
+                                                         // were written, or
+                                                         // enqueued, without
+                                                         // being copied
+
     bsls::AtomicInt                  d_recordedMaxWriteQueueSize;
                                                          // maximum recorded
                                                          // size of the write
@@ -801,6 +813,16 @@ class Channel {
         // Return the number of bytes request to be written to this channel
         // since its construction or since the last reset.
 
+    bsls::Types::Int64 numBytesCopied() const;
+        // Return the number of bytes requested to be written to this channel
+        // since its construction that were copied into buffers owned by this
+        // channel before being written.
+
+    bsls::Types::Int64 numBytesZeroCopy() const;
+        // Return the number of bytes requested to be written to this channel
+        // since its construction that were written directly from, or enqueued
+        // by sharing ownership of, the buffers supplied by the caller.
+
     int currentWriteQueueSize() const;
         // Return a snapshot of the number of bytes currently queued to be
         // written to this channel.
@@ -899,6 +921,18 @@ bsls::Types::Int64 Channel::numBytesRequestedToBeWritten() const
     return d_numBytesRequestedToBeWritten.loadRelaxed();
 }
 
+inline
+bsls::Types::Int64 Channel::numBytesCopied() const
+{
+    return d_numBytesCopied.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 Channel::numBytesZeroCopy() const
+{
+    return d_numBytesZeroCopy.loadRelaxed();
+}
+
 inline
 int Channel::currentWriteQueueSize() const
 {
@@ -1414,6 +1448,10 @@ void Channel::notifyChannelDown(ChannelHandle             self,
             d_channelPool_p->d_totalBytesReadAdjustment    += numBytesRead();
             d_channelPool_p->d_totalBytesRequestedWrittenAdjustment +=
                                                 numBytesRequestedToBeWritten();
+            d_channelPool_p->d_totalBytesCopiedAdjustment +=
+                                                              numBytesCopied();
+            d_channelPool_p->d_totalBytesZeroCopyAdjustment +=
+                                                            numBytesZeroCopy();
 
             int rc = d_channelPool_p->d_channels.remove(d_channelId);
 
@@ -1968,6 +2006,8 @@ Channel::Channel(bslma::ManagedPtr<StreamSocket> *socket,
 , d_numBytesRead(0)
 , d_numBytesWritten(0)
 , d_numBytesRequestedToBeWritten(0)
+, d_numBytesCopied(0)
+, d_numBytesZeroCopy(0)
 , d_recordedMaxWriteQueueSize(0)
 , d_readBlobFactory_p(readBlobBufferPool)
 , d_blobReadData(d_readBlobFactory_p, basicAllocator)
@@ -2223,6 +2263,8 @@ int Channel::writeMessage(const MessageType&   msg,
 
         d_writeActiveQueueSize.addRelaxed(-writeRet);
 
+        d_numBytesZeroCopy.addRelaxed(writeRet);
+
         if (dataLength == writeRet) {
             // We succeeded in writing the whole message.  We did release the
             // lock, however, and maybe another thread enqueued some data to
@@ -2247,6 +2289,13 @@ int Channel::writeMessage(const MessageType&   msg,
                                                       msg,
                                                       writeRet);
 
+            if (MessageUtil::isSharedOnEnqueue(msg)) {
+                d_numBytesZeroCopy.addRelaxed(dataLength - writeRet);
+            }
+            else {
+                d_numBytesCopied.addRelaxed(dataLength - writeRet);
+            }
+
             d_writeActiveDataCurrentBuffer = 0;
             d_writeActiveDataCurrentOffset = startingIndex;
         }
@@ -2280,6 +2329,13 @@ int Channel::writeMessage(const MessageType&   msg,
 
     MessageUtil::appendToBlob(d_writeEnqueuedData.get(), msg);
 
+    if (MessageUtil::isSharedOnEnqueue(msg)) {
+        d_numBytesZeroCopy.addRelaxed(dataLength);
+    }
+    else {
+        d_numBytesCopied.addRelaxed(dataLength);
+    }
+
     return ChannelStatus::e_SUCCESS;
 }
 
@@ -2493,7 +2549,7 @@ void ChannelPool::init()
 
         if (d_startFlag) {
             bslmt::ThreadAttributes attr;
-            attr.setStackSize(d_config.threadStackSize());
+            loadThreadAttributes(&attr, i);
             manager->enable(attr);
         }
         else {
@@ -3440,6 +3496,20 @@ void ChannelPool::metricsCb()
                          d_metricsFunctor));
 }
 
+// PRIVATE ACCESSORS
+void ChannelPool::loadThreadAttributes(bslmt::ThreadAttributes *attributes,
+                                       int managerIndex) const
+{
+    BSLS_ASSERT(attributes);
+    BSLS_ASSERT(0 <= managerIndex);
+
+    attributes->setStackSize(d_config.threadStackSize());
+    if (!d_threadCpuSets.empty()) {
+        attributes->setCpuSet(d_threadCpuSets[managerIndex
+                                                 % d_threadCpuSets.size()]);
+    }
+}
+
 // CREATORS
 ChannelPool::ChannelPool(ChannelStateChangeCallback       channelStateCb,
                          BlobBasedReadCallback            blobBasedReadCb,
@@ -3459,6 +3529,7 @@ ChannelPool::ChannelPool(ChannelStateChangeCallback       channelStateCb,
 , d_config(parameters)
 , d_startFlag(0)
 , d_collectTimeMetrics(parameters.collectTimeMetrics())
+, d_threadCpuSets(basicAllocator)
 , d_channelStateCb(channelStateCb)
 , d_poolStateCb(poolStateCb)
 , d_blobBasedReadCb(blobBasedReadCb)
@@ -3467,6 +3538,8 @@ ChannelPool::ChannelPool(ChannelStateChangeCallback       channelStateCb,
 , d_totalBytesReadAdjustment(0)
 , d_totalBytesWrittenAdjustment(0)
 , d_totalBytesRequestedWrittenAdjustment(0)
+, d_totalBytesCopiedAdjustment(0)
+, d_totalBytesZeroCopyAdjustment(0)
 , d_metricAdjustmentMutex()
 , d_factory(basicAllocator)
 , d_pool(sizeof(Channel), basicAllocator)
@@ -3493,6 +3566,7 @@ ChannelPool::ChannelPool(btlb::BlobBufferFactory         *blobBufferFactory,
 , d_config(parameters)
 , d_startFlag(0)
 , d_collectTimeMetrics(parameters.collectTimeMetrics())
+, d_threadCpuSets(basicAllocator)
 , d_channelStateCb(channelStateCb)
 , d_poolStateCb(poolStateCb)
 , d_blobBasedReadCb(blobBasedReadCb)
@@ -3501,6 +3575,8 @@ ChannelPool::ChannelPool(btlb::BlobBufferFactory         *blobBufferFactory,
 , d_totalBytesReadAdjustment(0)
 , d_totalBytesWrittenAdjustment(0)
 , d_totalBytesRequestedWrittenAdjustment(0)
+, d_totalBytesCopiedAdjustment(0)
+, d_totalBytesZeroCopyAdjustment(0)
 , d_metricAdjustmentMutex()
 , d_factory(basicAllocator)
 , d_pool(sizeof(Channel), basicAllocator)
@@ -4065,7 +4141,7 @@ int ChannelPool::stopAndRemoveAllChannels()
         if (d_managers[i]->disable()) {
            while(--i >= 0) {
                bslmt::ThreadAttributes attr;
-               attr.setStackSize(d_config.threadStackSize());
+               loadThreadAttributes(&attr, i);
 
                int rc = d_managers[i]->enable(attr);
                (void)rc; BSLS_ASSERT(0 == rc);
@@ -4174,7 +4250,7 @@ int ChannelPool::start()
     int numManagers = static_cast<int>(d_managers.size());
     for (int i = 0; i < numManagers; ++i) {
         bslmt::ThreadAttributes attr;
-        attr.setStackSize(d_config.threadStackSize());
+        loadThreadAttributes(&attr, i);
         int ret = d_managers[i]->enable(attr);
         if (0 != ret) {
            while(--i >= 0) {
@@ -4188,6 +4264,31 @@ int ChannelPool::start()
     return 0;
 }
 
+void ChannelPool::setThreadCpuSets(
+                                 const bsl::vector<bsl::vector<int> >& cpuSets)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_managersStateChangeLock);
+
+    d_threadCpuSets = cpuSets;
+}
+
+int ChannelPool::setRegistrationHint(btlso::TcpTimerEventManager::Hint hint)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_managersStateChangeLock);
+
+    if (d_startFlag) {
+        return -1;                                                    // RETURN
+    }
+
+    int numManagers = static_cast<int>(d_managers.size());
+    for (int i = 0; i < numManagers; ++i) {
+        if (d_managers[i]->setRegistrationHint(hint)) {
+            return -1;                                                // RETURN
+        }
+    }
+    return 0;
+}
+
 int ChannelPool::stop()
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_managersStateChangeLock);
@@ -4197,7 +4298,7 @@ int ChannelPool::stop()
         if (d_managers[i]->disable()) {
            while(--i >= 0) {
                bslmt::ThreadAttributes attr;
-               attr.setStackSize(d_config.threadStackSize());
+               loadThreadAttributes(&attr, i);
                int rc = d_managers[i]->enable(attr);
                (void)rc; BSLS_ASSERT(0 == rc);
            }
@@ -4849,6 +4950,17 @@ ChannelPool::getPeerAddress(btlso::IPv4Address *result,
     return 1;
 }
 
+int ChannelPool::numBytesCopied(bsls::Types::Int64 *result,
+                                int                 channelId) const
+{
+    ChannelHandle channelHandle;
+    if (0 == findChannelHandle(&channelHandle, channelId)) {
+        *result = channelHandle->numBytesCopied();
+        return 0;                                                     // RETURN
+    }
+    return 1;
+}
+
 int ChannelPool::numBytesRead(bsls::Types::Int64 *result,
                               int                 channelId) const
 {
@@ -4883,6 +4995,34 @@ int ChannelPool::numBytesWritten(bsls::Types::Int64 *result,
     return 1;
 }
 
+int ChannelPool::numBytesZeroCopy(bsls::Types::Int64 *result,
+                                  int                 channelId) const
+{
+    ChannelHandle channelHandle;
+    if (0 == findChannelHandle(&channelHandle, channelId)) {
+        *result = channelHandle->numBytesZeroCopy();
+        return 0;                                                     // RETURN
+    }
+    return 1;
+}
+
+void ChannelPool::totalBytesCopied(bsls::Types::Int64 *result) const
+{
+    // Note that this lock must be held to ensure that updating the adjustment
+    // to the metric total, and removing the channel is handled atomically.
+
+    bslmt::LockGuard<bslmt::Mutex>          guard(&d_metricAdjustmentMutex);
+    bdlcc::ObjectCatalogIter<ChannelHandle> it(d_channels);
+    bsls::Types::Int64                      total = 0;
+
+    for (; it; ++it) {
+        if (it().second) {
+            total += it().second->numBytesCopied();
+        }
+    }
+    *result = total + d_totalBytesCopiedAdjustment;
+}
+
 void ChannelPool::totalBytesWritten(bsls::Types::Int64 *result) const
 {
     // Note that this lock must be held to ensure that updating the adjustment
@@ -4935,6 +5075,23 @@ void ChannelPool::totalBytesRequestedToBeWritten(
     *result = total + d_totalBytesRequestedWrittenAdjustment;
 }
 
+void ChannelPool::totalBytesZeroCopy(bsls::Types::Int64 *result) const
+{
+    // Note that this lock must be held to ensure that updating the adjustment
+    // to the metric total, and removing the channel is handled atomically.
+
+    bslmt::LockGuard<bslmt::Mutex>          guard(&d_metricAdjustmentMutex);
+    bdlcc::ObjectCatalogIter<ChannelHandle> it(d_channels);
+    bsls::Types::Int64                      total = 0;
+
+    for (; it; ++it) {
+        if (it().second) {
+            total += it().second->numBytesZeroCopy();
+        }
+    }
+    *result = total + d_totalBytesZeroCopyAdjustment;
+}
+
 int ChannelPool::numEvents(int index) const
 {
     BSLS_ASSERT(0 <= index);
@@ -172,6 +172,53 @@ BSLS_IDENT("$Id: $")
 //            T
 //..
 //
+///Zero-Copy Writes
+///----------------
+// A 'btlb::Blob' supplied to 'write' is never copied: the channel first
+// attempts to 'writev' the message directly from the blob buffers, and any
+// part that cannot be written immediately is enqueued by sharing ownership of
+// those buffers (the buffers are reference counted, so the caller may reuse
+// or destroy the blob as soon as 'write' returns, but should not modify the
+// buffer contents).  An array of 'btls::Iovec' or 'btls::Ovec' supplied to
+// 'write' is also written directly from the caller's memory, but since the
+// channel pool cannot retain that memory, the part that cannot be written
+// immediately is copied into buffers owned by the pool.  Clients sending
+// large or bursty messages should therefore prefer blobs.
+//
+// The number of bytes copied and the number of bytes sent without copying
+// are reported, per channel, by 'numBytesCopied' and 'numBytesZeroCopy', and,
+// for the whole pool, by 'totalBytesCopied' and 'totalBytesZeroCopy'.  For
+// every accepted 'write', the sum of the two counters increases by the
+// length of the message.
+//
+///Pinning Threads to CPUs
+///-----------------------
+// The threads managed by a channel pool (one per event manager, up to
+// 'maxThreads') can be restricted to sets of CPUs by calling
+// 'setThreadCpuSets' before the pool is started.  The 'i'th thread is
+// restricted to the CPUs in the '(i % n)'th of the 'n' supplied CPU sets, so
+// that, e.g., supplying one set per CPU of a NUMA node spreads the threads
+// over that node, and supplying a single set restricts all threads to it.
+// Pinning each thread to its own CPU prevents the operating system from
+// migrating it between CPUs (which discards the contents of the CPU caches).
+// Note that CPU affinity is supported only on some platforms (see
+// 'bslmt_threadutil'); the CPU sets are ignored on other platforms.
+//
+///Batching Socket Event Registrations
+///-----------------------------------
+// A channel registers for WRITE events on its socket each time the socket
+// buffer fills, and deregisters once its write queue is drained; under heavy
+// load such registration changes happen on most dispatches, and each costs a
+// system call with the default ('epoll'-based, on Linux) socket event
+// manager.  Calling 'setRegistrationHint' with the
+// 'btlso::TcpTimerEventManager::e_FREQUENT_REGISTRATION' hint before the pool
+// is started makes the event managers of the pool use, on Linux kernels
+// supporting it, an 'io_uring'-based socket event manager that submits the
+// registration changes made between two dispatches in the single system call
+// that waits for events (see 'btlso_defaulteventmanager_iouring').  Note
+// that the channels still read and write with one system call per operation:
+// 'io_uring' is used only to monitor the sockets.
+//
 ///Thread Safety
 ///-------------
 // The channel pool is *thread-enabled* meaning that any operation on the same
@@ -1065,6 +1112,12 @@ class ChannelPool {
                                                // whether to collect time
                                                // metrics
 
+    bsl::vector<bsl::vector<int> >      d_threadCpuSets;
+                                               // CPU sets cycled over the
+                                               // managed threads (empty if
+                                               // the threads are not
+                                               // restricted)
+
                                         // *** Capacity monitoring ***
 
     bdlb::NullableValue<void *>         d_metricsTimerId;
@@ -1107,6 +1160,20 @@ class ChannelPool {
                                                // channels and calls to
                                                // reset
 
+    volatile bsls::Types::Int64         d_totalBytesCopiedAdjustment;
+                                               // adjustment to
+                                               // the sum of individual
+                                               // channel numBytesCopied(),
+                                               // accounting for closed
+                                               // channels
+
+    volatile bsls::Types::Int64         d_totalBytesZeroCopyAdjustment;
+                                               // adjustment to
+                                               // the sum of individual
+                                               // channel numBytesZeroCopy(),
+                                               // accounting for closed
+                                               // channels
+
     mutable bslmt::Mutex                d_metricAdjustmentMutex;
                                                // synchronize operations on
                                                // two metric adjustment values
@@ -1368,6 +1435,12 @@ class ChannelPool {
         // Note that a channel handle in 'd_channels' may be null, if the
         // channel has been added but not yet initialized.
 
+    void loadThreadAttributes(bslmt::ThreadAttributes *attributes,
+                              int                      managerIndex) const;
+        // Load into the specified 'attributes' the attributes of the thread
+        // of the event manager at the specified 'managerIndex' in
+        // 'd_managers'.
+
   private:
     // NOT IMPLEMENTED
     ChannelPool(const ChannelPool& original);
@@ -1803,6 +1876,24 @@ class ChannelPool {
         // function has no effect on the state of any channel managed by this
         // pool.
 
+    void setThreadCpuSets(const bsl::vector<bsl::vector<int> >& cpuSets);
+        // Restrict each thread subsequently created by this pool to the CPUs
+        // in one of the specified 'cpuSets', the 'i'th thread being
+        // restricted to 'cpuSets[i % cpuSets.size()]', or, if 'cpuSets' is
+        // empty, do not restrict the threads.  The behavior is undefined
+        // unless this pool has not been started or has been stopped.  Note
+        // that 'start' fails if a thread cannot be restricted to its CPU set.
+        // See {Pinning Threads to CPUs}.
+
+    int setRegistrationHint(btlso::TcpTimerEventManager::Hint hint);
+        // Make the event managers of this pool use socket event managers
+        // optimized for the registration frequency indicated by the specified
+        // 'hint'.  Return 0 on success, and a non-zero value if this pool is
+        // started, or if any of its event managers has registered socket
+        // events (in which case the hint may have been applied to some of
+        // the event managers only).  See {Batching Socket Event
+        // Registrations}.
+
                                   // *** Incoming messages ***
 
     btlb::BlobBufferFactory *incomingBlobBufferFactory();
@@ -2050,6 +2141,15 @@ class ChannelPool {
         // channel having the specified 'channelId'.  Return 0 on success, and
         // a non-zero value with no effect on 'result' otherwise.
 
+    int numBytesCopied(bsls::Types::Int64 *result, int channelId) const;
+        // Load, into the specified 'result', the number of bytes requested to
+        // be written to the channel identified by the specified 'channelId'
+        // that were copied into buffers owned by this channel pool before
+        // being written, and return 0 if the specified 'channelId' is a valid
+        // channel id.  Otherwise, return a non-zero value.  Note that only
+        // the part of an iovec or ovec message that cannot be written
+        // immediately is copied; see {Zero-Copy Writes}.
+
     int numBytesRead(bsls::Types::Int64 *result, int channelId) const;
         // Load, into the specified 'result', the number of bytes read by the
         // channel identified by the specified 'channelId' and return 0 if the
@@ -2069,6 +2169,14 @@ class ChannelPool {
         // and return 0 if the specified 'channelId' is a valid channel id.
         // Otherwise, return a non-zero value.
 
+    int numBytesZeroCopy(bsls::Types::Int64 *result, int channelId) const;
+        // Load, into the specified 'result', the number of bytes requested to
+        // be written to the channel identified by the specified 'channelId'
+        // that were written directly from, or enqueued by sharing ownership
+        // of, the buffers supplied by the caller, and return 0 if the
+        // specified 'channelId' is a valid channel id.  Otherwise, return a
+        // non-zero value.  See {Zero-Copy Writes}.
+
     int numChannels() const;
         // Return the number of channels currently managed by this channel
         // pool.
@@ -2096,6 +2204,11 @@ class ChannelPool {
         // channel pool is undefined if the underlying socket is manipulated
         // while still under management by this channel pool.
 
+    void totalBytesCopied(bsls::Types::Int64 *result) const;
+        // Load, into the specified 'result', the total number of bytes
+        // requested to be written by the pool that were copied into buffers
+        // owned by the pool before being written.
+
     void totalBytesRead(bsls::Types::Int64 *result) const;
         // Load, into the specified 'result', the total number of bytes read by
         // the pool.
@@ -2108,6 +2221,12 @@ class ChannelPool {
         // Load, into the specified 'result', the total number of bytes written
         // by the pool.
 
+    void totalBytesZeroCopy(bsls::Types::Int64 *result) const;
+        // Load, into the specified 'result', the total number of bytes
+        // requested to be written by the pool that were written directly
+        // from, or enqueued by sharing ownership of, the buffers supplied by
+        // the callers.
+
 
 
 };
@@ -2272,6 +2391,13 @@ struct ChannelPool_MessageUtil {
         // Append, to the specified 'dest' blob, the data buffers in the
         // specified 'msg'.  The behavior is undefined unless the last buffer
         // in 'dest' is trimmed.
+
+    template <class IOVEC>
+    static bool isSharedOnEnqueue(const ChannelPool_IovecArray<IOVEC>& msg);
+    static bool isSharedOnEnqueue(const btlb::Blob&                    msg);
+        // Return 'true' if 'loadBlob' and 'appendToBlob' share ownership of
+        // the buffers of the specified 'msg', and 'false' if they copy its
+        // data.
 };
 
 // ============================================================================
@@ -2515,6 +2641,19 @@ void ChannelPool_MessageUtil::appendToBlob(
     btls::IovecUtil::appendToBlob(dest, msg.iovecs(), msg.numIovecs());
 }
 
+template <class IOVEC>
+inline
+bool ChannelPool_MessageUtil::isSharedOnEnqueue(
+                                        const ChannelPool_IovecArray<IOVEC>&)
+{
+    return false;
+}
+
+inline
+bool ChannelPool_MessageUtil::isSharedOnEnqueue(const btlb::Blob&)
+{
+    return true;
+}
 
 
 }  // close package namespace
@@ -33,7 +33,9 @@
 #include <bslmt_lockguard.h>
 #include <bslmt_condition.h>
 #include <bslmt_mutex.h>
+#include <bslmt_semaphore.h>
 #include <bslmt_threadattributes.h>
+#include <bslmt_timedsemaphore.h>
 #include <bslmt_threadutil.h>
 #include <bdlmt_fixedthreadpool.h>
 
@@ -134,6 +136,12 @@ using namespace bdlf::PlaceHolders;
 // [  ]  int btlmt::ChannelPool::numChannels() const;
 // [  ]  int btlmt::ChannelPool::numEvents() const;
 // [  ]  int btlmt::ChannelPool::numThreads() const;
+// [40]  void btlmt::ChannelPool::setThreadCpuSets(...);
+// [41]  int btlmt::ChannelPool::setRegistrationHint(Hint);
+// [42]  int btlmt::ChannelPool::numBytesCopied(...) const;
+// [42]  int btlmt::ChannelPool::numBytesZeroCopy(...) const;
+// [42]  void btlmt::ChannelPool::totalBytesCopied(...) const;
+// [42]  void btlmt::ChannelPool::totalBytesZeroCopy(...) const;
 // [13]  double btlmt::ChannelPool::reportWeightedAverageReset();
 // [28]  int btlmt::ChannelPool::busyMetrics() const;
 // [14]  int btlmt::ChannelPool::getChannelStatistics*(...);
@@ -7950,6 +7958,153 @@ void *usageExampleMinusOne(void *arg)
 }  // close namespace QUEUE_CLIENT_NAMESPACE
 
 
+namespace TEST_CASE_THREAD_CPU_SETS {
+
+void recordCpuSet(bslmt::Mutex       *mutex,
+                  bsl::vector<int>   *cpuSet,
+                  bslmt::Barrier     *barrier)
+    // Load into the specified 'cpuSet' the CPUs on which the calling thread
+    // may run, under the protection of the specified 'mutex', and wait on the
+    // specified 'barrier'.
+{
+    bsl::vector<int> result;
+    ASSERT(0 == bslmt::ThreadUtil::getThreadCpuSet(
+                                               &result,
+                                               bslmt::ThreadUtil::self()));
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(mutex);
+        *cpuSet = result;
+    }
+    barrier->wait();
+}
+
+}  // close namespace TEST_CASE_THREAD_CPU_SETS
+
+namespace TEST_CASE_REGISTRATION_HINT {
+
+struct EchoState {
+    // This 'struct' holds the state of a loopback echo between two channels
+    // of the same channel pool.
+
+    bslmt::Mutex           d_mutex;
+    int                    d_serverChannelId;   // echoing channel
+    int                    d_clientChannelId;   // counting channel
+    int                    d_numEchoedBytes;
+    int                    d_numExpectedBytes;
+    bslmt::Semaphore       d_channelsUp;
+    bslmt::TimedSemaphore  d_done;
+    btlmt::ChannelPool    *d_pool_p;
+};
+
+void echoChannelStateCb(int        channelId,
+                        int        sourceId,
+                        int        state,
+                        void      *,
+                        EchoState *echoState)
+    // Record the specified 'channelId' in the specified 'echoState', as the
+    // server channel if the specified 'sourceId' is 1, and as the client
+    // channel otherwise, if the specified 'state' is 'e_CHANNEL_UP'.
+{
+    if (btlmt::ChannelPool::e_CHANNEL_UP != state) {
+        return;                                                       // RETURN
+    }
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&echoState->d_mutex);
+        if (1 == sourceId) {
+            echoState->d_serverChannelId = channelId;
+        }
+        else {
+            echoState->d_clientChannelId = channelId;
+        }
+    }
+    echoState->d_channelsUp.post();
+}
+
+void echoDataCb(int        *numNeeded,
+                btlb::Blob *msg,
+                int         channelId,
+                void       *,
+                EchoState  *echoState)
+    // Write the specified 'msg' back to the specified 'channelId' if it is
+    // the server channel of the specified 'echoState', and count its bytes
+    // otherwise, then consume 'msg' and load 1 into the specified
+    // 'numNeeded'.
+{
+    const int length = msg->length();
+
+    bool isServer;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&echoState->d_mutex);
+        isServer = channelId == echoState->d_serverChannelId;
+    }
+
+    if (isServer) {
+        ASSERT(0 == echoState->d_pool_p->write(channelId, *msg));
+    }
+    else {
+        bool done;
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&echoState->d_mutex);
+            echoState->d_numEchoedBytes += length;
+            done = echoState->d_numEchoedBytes ==
+                                               echoState->d_numExpectedBytes;
+        }
+        if (done) {
+            echoState->d_done.post();
+        }
+    }
+
+    btlb::BlobUtil::erase(msg, 0, length);
+    *numNeeded = 1;
+}
+
+}  // close namespace TEST_CASE_REGISTRATION_HINT
+
+namespace TEST_CASE_ZERO_COPY_COUNTERS {
+
+struct ChannelIds {
+    // This 'struct' holds the ids of the two channels of a loopback
+    // connection within a channel pool.
+
+    bslmt::Mutex     d_mutex;
+    int              d_serverChannelId;
+    int              d_clientChannelId;
+    bslmt::Semaphore d_channelsUp;
+};
+
+void channelStateCb(int         channelId,
+                    int         sourceId,
+                    int         state,
+                    void       *,
+                    ChannelIds *channelIds)
+    // Record the specified 'channelId' in the specified 'channelIds', as the
+    // server channel if the specified 'sourceId' is 1, and as the client
+    // channel otherwise, if the specified 'state' is 'e_CHANNEL_UP'.
+{
+    if (btlmt::ChannelPool::e_CHANNEL_UP != state) {
+        return;                                                       // RETURN
+    }
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&channelIds->d_mutex);
+        if (1 == sourceId) {
+            channelIds->d_serverChannelId = channelId;
+        }
+        else {
+            channelIds->d_clientChannelId = channelId;
+        }
+    }
+    channelIds->d_channelsUp.post();
+}
+
+void discardDataCb(int *numNeeded, btlb::Blob *msg, int, void *)
+    // Consume the specified 'msg' and load 1 into the specified 'numNeeded'.
+{
+    btlb::BlobUtil::erase(msg, 0, msg->length());
+    *numNeeded = 1;
+}
+
+}  // close namespace TEST_CASE_ZERO_COPY_COUNTERS
+
 // ============================================================================
 //                     GLOBAL 'class' FOR TESTING
 // ----------------------------------------------------------------------------
@@ -7960,6 +8115,15 @@ class TestDriver {
 
   public:
     // TEST CASES
+    static void testCase42();
+        // Test the copied and zero-copy write counters.
+
+    static void testCase41();
+        // Test 'setRegistrationHint'.
+
+    static void testCase40();
+        // Test 'setThreadCpuSets'.
+
     static void testCase39();
         // Test usage example.
 
@@ -8095,6 +8259,409 @@ class TestDriver {
                                // TEST APPARATUS
                                // --------------
 
+void TestDriver::testCase42()
+{
+        // --------------------------------------------------------------------
+        // TESTING COPIED AND ZERO-COPY WRITE COUNTERS
+        //
+        // Concerns:
+        //: 1 Data written directly from the caller's buffers is counted as
+        //:   zero-copy, whether supplied as a blob or as iovecs.
+        //:
+        //: 2 Data of a blob that must be enqueued is counted as zero-copy.
+        //:
+        //: 3 Data of iovecs that must be enqueued is counted as copied.
+        //:
+        //: 4 The pool totals match the sum of the channel counters, and the
+        //:   sum of both counters is the number of bytes requested to be
+        //:   written.
+        //
+        // Plan:
+        //: 1 Connect the pool to itself and write iovecs and a blob to an
+        //:   idle channel; verify that only the zero-copy counter increases.
+        //:   (C-1)
+        //:
+        //: 2 Disable reading on the peer, write blobs until data is enqueued,
+        //:   then write iovecs; verify the counters.  Re-enable reading and
+        //:   wait until all the data is written.  (C-2..4)
+        //
+        // Testing:
+        //   int numBytesCopied(Int64 *result, int channelId) const;
+        //   int numBytesZeroCopy(Int64 *result, int channelId) const;
+        //   void totalBytesCopied(Int64 *result) const;
+        //   void totalBytesZeroCopy(Int64 *result) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING COPIED AND ZERO-COPY WRITE COUNTERS"
+                          << "\n==========================================="
+                          << endl;
+
+        using namespace TEST_CASE_ZERO_COPY_COUNTERS;
+        typedef bsls::Types::Int64 Int64;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        enum {
+            k_SMALL_SIZE    = 100,
+            k_MESSAGE_SIZE  = 64 * 1024,
+            k_MAX_MESSAGES  = 1024
+        };
+
+        {
+            ChannelIds channelIds;
+            channelIds.d_serverChannelId = -1;
+            channelIds.d_clientChannelId = -1;
+
+            btlmt::ChannelPoolConfiguration config;
+            config.setMaxThreads(1);
+            config.setMetricsInterval(10.0);
+
+            btlmt::ChannelPool::ChannelStateChangeCallback channelCb(
+                               bdlf::BindUtil::bind(&channelStateCb,
+                                                    bdlf::PlaceHolders::_1,
+                                                    bdlf::PlaceHolders::_2,
+                                                    bdlf::PlaceHolders::_3,
+                                                    bdlf::PlaceHolders::_4,
+                                                    &channelIds));
+            btlmt::ChannelPool::BlobBasedReadCallback dataCb(&discardDataCb);
+            btlmt::ChannelPool::PoolStateChangeCallback poolCb;
+            makeNull(&poolCb);
+
+            btlmt::ChannelPool mX(channelCb, dataCb, poolCb, config, &ta);
+
+            ASSERT(0 == mX.start());
+            ASSERT(0 == mX.listen(0, 5, 1));
+
+            btlso::IPv4Address serverAddress;
+            ASSERT(0 == mX.getServerAddress(&serverAddress, 1));
+            serverAddress.setIpAddress("127.0.0.1");
+
+            ASSERT(0 == mX.connect(serverAddress,
+                                   1,
+                                   bsls::TimeInterval(1),
+                                   2));
+
+            channelIds.d_channelsUp.wait();
+            channelIds.d_channelsUp.wait();
+
+            int clientId, serverId;
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&channelIds.d_mutex);
+                clientId = channelIds.d_clientChannelId;
+                serverId = channelIds.d_serverChannelId;
+            }
+
+            Int64 copied, zeroCopy, requested, written, total;
+
+            ASSERT(0 == mX.numBytesCopied(&copied, clientId));
+            ASSERT(0 == mX.numBytesZeroCopy(&zeroCopy, clientId));
+            ASSERT(0 == copied);
+            ASSERT(0 == zeroCopy);
+            ASSERT(0 != mX.numBytesCopied(&copied, -1));
+            ASSERT(0 != mX.numBytesZeroCopy(&zeroCopy, -1));
+
+            if (verbose) cout << "\tWriting to an idle channel." << endl;
+
+            char smallBuffer[k_SMALL_SIZE];
+            bsl::memset(smallBuffer, 'x', sizeof smallBuffer);
+            btls::Iovec smallVecs[2];
+            smallVecs[0].setBuffer(smallBuffer, k_SMALL_SIZE / 2);
+            smallVecs[1].setBuffer(smallBuffer + k_SMALL_SIZE / 2,
+                                   k_SMALL_SIZE / 2);
+
+            ASSERT(0 == mX.write(clientId, smallVecs, 2));
+
+            btlb::PooledBlobBufferFactory factory(4096, &ta);
+            {
+                btlb::Blob message(&factory, &ta);
+                message.setLength(k_SMALL_SIZE);
+                ASSERT(0 == mX.write(clientId, message));
+            }
+
+            ASSERT(0 == mX.numBytesCopied(&copied, clientId));
+            ASSERT(0 == mX.numBytesZeroCopy(&zeroCopy, clientId));
+            LOOP_ASSERT(copied,   0                == copied);
+            LOOP_ASSERT(zeroCopy, 2 * k_SMALL_SIZE == zeroCopy);
+
+            if (verbose) cout << "\tWriting to a full channel." << endl;
+
+            ASSERT(0 == mX.disableRead(serverId));
+
+            int numMessages = 0;
+            do {
+                btlb::Blob message(&factory, &ta);
+                message.setLength(k_MESSAGE_SIZE);
+                ASSERT(0 == mX.write(clientId, message));
+                ++numMessages;
+
+                ASSERT(0 == mX.numBytesRequestedToBeWritten(&requested,
+                                                            clientId));
+                ASSERT(0 == mX.numBytesWritten(&written, clientId));
+            } while (written == requested && numMessages < k_MAX_MESSAGES);
+
+            ASSERT(written < requested);
+
+            ASSERT(0 == mX.numBytesCopied(&copied, clientId));
+            ASSERT(0 == mX.numBytesZeroCopy(&zeroCopy, clientId));
+            LOOP_ASSERT(copied, 0 == copied);
+            LOOP2_ASSERT(zeroCopy, requested, requested == zeroCopy);
+
+            ASSERT(0 == mX.write(clientId, smallVecs, 2));
+
+            ASSERT(0 == mX.numBytesCopied(&copied, clientId));
+            ASSERT(0 == mX.numBytesZeroCopy(&zeroCopy, clientId));
+            ASSERT(0 == mX.numBytesRequestedToBeWritten(&requested,
+                                                        clientId));
+            LOOP_ASSERT(copied, k_SMALL_SIZE == copied);
+            LOOP3_ASSERT(copied, zeroCopy, requested,
+                         requested == copied + zeroCopy);
+
+            mX.totalBytesCopied(&total);
+            LOOP2_ASSERT(copied, total, copied == total);
+            mX.totalBytesZeroCopy(&total);
+            LOOP2_ASSERT(zeroCopy, total, zeroCopy == total);
+
+            ASSERT(0 == mX.enableRead(serverId));
+
+            bsls::TimeInterval deadline = bdlt::CurrentTime::now();
+            deadline.addSeconds(30);
+            do {
+                bslmt::ThreadUtil::microSleep(10 * 1000);
+                ASSERT(0 == mX.numBytesWritten(&written, clientId));
+            } while (written < requested
+                  && bdlt::CurrentTime::now() < deadline);
+
+            LOOP2_ASSERT(written, requested, written == requested);
+
+            ASSERT(0 == mX.stop());
+        }
+}
+
+void TestDriver::testCase41()
+{
+        // --------------------------------------------------------------------
+        // TESTING 'setRegistrationHint'
+        //
+        // Concerns:
+        //: 1 'setRegistrationHint' succeeds before the pool is started, and
+        //:   fails while it is started.
+        //:
+        //: 2 A pool given the 'e_FREQUENT_REGISTRATION' hint transfers data
+        //:   correctly when its write queues repeatedly fill and drain.
+        //
+        // Plan:
+        //: 1 Set the hint on a new pool and start it, then verify that
+        //:   setting the hint again fails.  (C-1)
+        //:
+        //: 2 Connect the pool to itself, echo messages written by the client
+        //:   channel back from the server channel, and verify that all the
+        //:   written bytes are echoed.  (C-2)
+        //
+        // Testing:
+        //   int setRegistrationHint(btlso::TcpTimerEventManager::Hint);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'setRegistrationHint'"
+                          << "\n=============================" << endl;
+
+        using namespace TEST_CASE_REGISTRATION_HINT;
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        enum {
+            k_MESSAGE_SIZE = 64 * 1024,
+            k_NUM_MESSAGES = 64
+        };
+
+        {
+            EchoState echoState;
+            echoState.d_serverChannelId  = -1;
+            echoState.d_clientChannelId  = -1;
+            echoState.d_numEchoedBytes   = 0;
+            echoState.d_numExpectedBytes = k_MESSAGE_SIZE * k_NUM_MESSAGES;
+
+            btlmt::ChannelPoolConfiguration config;
+            config.setMaxThreads(2);
+            config.setMetricsInterval(10.0);
+            config.setIncomingMessageSizes(1, 1024, k_MESSAGE_SIZE);
+
+            btlmt::ChannelPool::ChannelStateChangeCallback channelCb(
+                               bdlf::BindUtil::bind(&echoChannelStateCb,
+                                                    bdlf::PlaceHolders::_1,
+                                                    bdlf::PlaceHolders::_2,
+                                                    bdlf::PlaceHolders::_3,
+                                                    bdlf::PlaceHolders::_4,
+                                                    &echoState));
+            btlmt::ChannelPool::BlobBasedReadCallback dataCb(
+                               bdlf::BindUtil::bind(&echoDataCb,
+                                                    bdlf::PlaceHolders::_1,
+                                                    bdlf::PlaceHolders::_2,
+                                                    bdlf::PlaceHolders::_3,
+                                                    bdlf::PlaceHolders::_4,
+                                                    &echoState));
+            btlmt::ChannelPool::PoolStateChangeCallback poolCb;
+            makeNull(&poolCb);
+
+            btlmt::ChannelPool mX(channelCb, dataCb, poolCb, config, &ta);
+            echoState.d_pool_p = &mX;
+
+            ASSERT(0 == mX.setRegistrationHint(
+                       btlso::TcpTimerEventManager::e_FREQUENT_REGISTRATION));
+            ASSERT(0 == mX.start());
+            ASSERT(0 != mX.setRegistrationHint(
+                                     btlso::TcpTimerEventManager::e_NO_HINT));
+
+            ASSERT(0 == mX.listen(0, 5, 1));
+
+            btlso::IPv4Address serverAddress;
+            ASSERT(0 == mX.getServerAddress(&serverAddress, 1));
+            serverAddress.setIpAddress("127.0.0.1");
+
+            ASSERT(0 == mX.connect(serverAddress,
+                                   1,
+                                   bsls::TimeInterval(1),
+                                   2));
+
+            echoState.d_channelsUp.wait();
+            echoState.d_channelsUp.wait();
+
+            int clientChannelId;
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&echoState.d_mutex);
+                clientChannelId = echoState.d_clientChannelId;
+            }
+
+            btlb::PooledBlobBufferFactory factory(4096, &ta);
+            for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+                btlb::Blob message(&factory, &ta);
+                message.setLength(k_MESSAGE_SIZE);
+                ASSERT(0 == mX.write(clientChannelId, message));
+            }
+
+            ASSERT(0 == echoState.d_done.timedWait(
+                                     bdlt::CurrentTime::now().addSeconds(30)));
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&echoState.d_mutex);
+                LOOP_ASSERT(echoState.d_numEchoedBytes,
+                            echoState.d_numExpectedBytes ==
+                                                  echoState.d_numEchoedBytes);
+            }
+
+            ASSERT(0 == mX.stop());
+        }
+}
+
+void TestDriver::testCase40()
+{
+        // --------------------------------------------------------------------
+        // TESTING 'setThreadCpuSets'
+        //
+        // Concerns:
+        //: 1 The event manager threads created by 'start' are restricted to
+        //:   the CPU set supplied to 'setThreadCpuSets'.
+        //:
+        //: 2 'start' fails if the threads cannot be restricted to the CPU
+        //:   set.
+        //:
+        //: 3 An empty sequence of CPU sets removes the restriction.
+        //
+        // Plan:
+        //: 1 Restrict the pool to the first CPU on which the test driver may
+        //:   run, start the pool, and register a clock that records the CPU
+        //:   set of the event manager thread.  (C-1)
+        //:
+        //: 2 Restrict the pool to a CPU that does not exist, and verify that
+        //:   'start' fails.  (C-2)
+        //:
+        //: 3 Restrict a pool to a CPU that does not exist, then supply an
+        //:   empty sequence of CPU sets, and verify that 'start' succeeds.
+        //:   (C-3)
+        //
+        // Testing:
+        //   void setThreadCpuSets(const bsl::vector<bsl::vector<int> >&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'setThreadCpuSets'"
+                          << "\n==========================" << endl;
+
+        using namespace TEST_CASE_THREAD_CPU_SETS;
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        bsl::vector<int> available;
+        if (0 != bslmt::ThreadUtil::getThreadCpuSet(
+                                               &available,
+                                               bslmt::ThreadUtil::self())) {
+            if (verbose) cout << "\tCPU affinity is not supported." << endl;
+            return;                                                   // RETURN
+        }
+        ASSERT(!available.empty());
+
+        btlmt::ChannelPoolConfiguration config;
+        config.setMaxThreads(1);
+        config.setMetricsInterval(10.0);
+
+        btlmt::ChannelPool::ChannelStateChangeCallback channelCb;
+        btlmt::ChannelPool::BlobBasedReadCallback      dataCb;
+        btlmt::ChannelPool::PoolStateChangeCallback    poolCb;
+
+        makeNull(&channelCb);
+        makeNull(&dataCb);
+        makeNull(&poolCb);
+
+        {
+            btlmt::ChannelPool mX(channelCb, dataCb, poolCb, config, &ta);
+
+            bsl::vector<bsl::vector<int> > cpuSets(
+                                          1,
+                                          bsl::vector<int>(1, available[0]));
+            mX.setThreadCpuSets(cpuSets);
+            ASSERT(0 == mX.start());
+
+            bslmt::Mutex     mutex;
+            bsl::vector<int> cpuSet;
+            bslmt::Barrier   barrier(2);
+
+            ASSERT(0 == mX.registerClock(bdlf::BindUtil::bind(&recordCpuSet,
+                                                              &mutex,
+                                                              &cpuSet,
+                                                              &barrier),
+                                         bdlt::CurrentTime::now(),
+                                         bsls::TimeInterval(0),
+                                         1));
+            barrier.wait();
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&mutex);
+                LOOP_ASSERT(cpuSet.size(), cpuSets[0] == cpuSet);
+            }
+            ASSERT(0 == mX.stop());
+        }
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+        if (verbose) cout << "\tRestricting to a non-existent CPU." << endl;
+        {
+            btlmt::ChannelPool mX(channelCb, dataCb, poolCb, config, &ta);
+
+            mX.setThreadCpuSets(bsl::vector<bsl::vector<int> >(
+                                                   1,
+                                                   bsl::vector<int>(1, 1023)));
+            ASSERT(0 != mX.start());
+        }
+#endif
+
+        if (verbose) cout << "\tRemoving the restriction." << endl;
+        {
+            btlmt::ChannelPool mX(channelCb, dataCb, poolCb, config, &ta);
+
+            mX.setThreadCpuSets(bsl::vector<bsl::vector<int> >(
+                                                   1,
+                                                   bsl::vector<int>(1, 1023)));
+            mX.setThreadCpuSets(bsl::vector<bsl::vector<int> >());
+            ASSERT(0 == mX.start());
+            ASSERT(0 == mX.stop());
+        }
+
+        ASSERT(0 == ta.numBytesInUse());
+}
+
 void TestDriver::testCase39()
 {
         // --------------------------------------------------------------------
@@ -15966,6 +16533,9 @@ int main(int argc, char **argv)
 
     switch (test) { case 0:  // Zero is always the leading case.
 #define CASE(NUMBER) case NUMBER: TestDriver::testCase##NUMBER(); break
+      CASE(42);
+      CASE(41);
+      CASE(40);
       CASE(38);
       CASE(37);
       CASE(36);
@@ -15,6 +15,7 @@ BSLS_IDENT_RCSID(btlmt_tcptimereventmanager_cpp,"$Id$ $CSID$")
 #include <btlso_defaulteventmanager.h>
 #include <btlso_defaulteventmanager_devpoll.h>
 #include <btlso_defaulteventmanager_epoll.h>
+#include <btlso_defaulteventmanager_iouring.h>
 #include <btlso_defaulteventmanager_poll.h>
 #include <btlso_defaulteventmanager_select.h>
 #include <btlso_eventmanager.h>
@@ -915,29 +916,47 @@ void TcpTimerEventManager_ExpiredTimersManager::disableAllCallbacks()
                          // --------------------------
 
 // PRIVATE METHODS
-void TcpTimerEventManager::initialize()
+btlso::EventManager *TcpTimerEventManager::createRawEventManager(
+                                        btlso::TcpTimerEventManager::Hint hint)
 {
-    BSLS_ASSERT(d_allocator_p);
-
     btlso::TimeMetrics *metrics = d_collectMetrics ? &d_metrics : 0;
 
-    // Initialize the (managed) event manager.
 #ifdef BSLS_PLATFORM_OS_LINUX
+    typedef btlso::DefaultEventManager<btlso::Platform::IO_URING>
+                                                           IoUringEventManager;
+
+    if (btlso::TcpTimerEventManager::e_FREQUENT_REGISTRATION == hint
+     && IoUringEventManager::isSupported()) {
+        return new (*d_allocator_p) IoUringEventManager(metrics,
+                                                        d_allocator_p);
+                                                                      // RETURN
+    }
+
     if (btlso::DefaultEventManager<>::isSupported()) {
-        d_manager_p = new (*d_allocator_p)
-                                   btlso::DefaultEventManager<>(metrics,
-                                                                d_allocator_p);
+        return new (*d_allocator_p) btlso::DefaultEventManager<>(
+                                                               metrics,
+                                                               d_allocator_p);
+                                                                      // RETURN
     }
-    else {
-        d_manager_p = new (*d_allocator_p)
+    return new (*d_allocator_p)
               btlso::DefaultEventManager<btlso::Platform::POLL>(metrics,
                                                                 d_allocator_p);
-    }
 #else
-    d_manager_p = new (*d_allocator_p)
-                                   btlso::DefaultEventManager<>(metrics,
-                                                                d_allocator_p);
+    (void)hint;
+
+    return new (*d_allocator_p) btlso::DefaultEventManager<>(metrics,
+                                                             d_allocator_p);
 #endif
+}
+
+void TcpTimerEventManager::initialize()
+{
+    BSLS_ASSERT(d_allocator_p);
+
+    // Initialize the (managed) event manager.
+
+    d_manager_p = createRawEventManager(
+                                     btlso::TcpTimerEventManager::e_NO_HINT);
 
     d_isManagedFlag = 1;
 
@@ -1666,6 +1685,24 @@ int TcpTimerEventManager::rescheduleTimer(const void                *id,
     return rc;
 }
 
+int TcpTimerEventManager::setRegistrationHint(
+                                        btlso::TcpTimerEventManager::Hint hint)
+{
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_stateLock);
+
+    if (e_DISABLED != d_state || !d_isManagedFlag
+     || 0 != d_manager_p->numEvents()) {
+        return -1;                                                    // RETURN
+    }
+
+    btlso::EventManager *manager = createRawEventManager(hint);
+
+    d_allocator_p->deleteObjectRaw(d_manager_p);
+    d_manager_p = manager;
+
+    return 0;
+}
+
 void TcpTimerEventManager::deregisterSocketEvent(
                                      const btlso::SocketHandle::Handle& handle,
                                      btlso::EventType::Type             event)
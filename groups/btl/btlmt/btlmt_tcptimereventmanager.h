@@ -217,6 +217,10 @@ BSLS_IDENT("$Id: $")
 #include <btlso_timereventmanager.h>
 #endif
 
+#ifndef INCLUDED_BTLSO_TCPTIMEREVENTMANAGER
+#include <btlso_tcptimereventmanager.h>
+#endif
+
 #ifndef INCLUDED_BTLSO_TIMEMETRICS
 #include <btlso_timemetrics.h>
 #endif
@@ -486,6 +490,12 @@ class TcpTimerEventManager : public btlso::TimerEventManager {
     TcpTimerEventManager& operator=(const TcpTimerEventManager&);
 
     // PRIVATE MANIPULATORS
+    btlso::EventManager *createRawEventManager(
+                                   btlso::TcpTimerEventManager::Hint hint);
+        // Create, using the allocator of this object, and return a socket
+        // event manager optimized for the registration frequency indicated by
+        // the specified 'hint'.
+
     void initialize();
         // Initialize this event manager.
 
@@ -650,6 +660,18 @@ class TcpTimerEventManager : public btlso::TimerEventManager {
         // associated callback will be invoked the first time that the
         // callbacks are dispatched.
 
+    int setRegistrationHint(btlso::TcpTimerEventManager::Hint hint);
+        // Replace the socket event manager of this object by one optimized
+        // for the registration frequency indicated by the specified 'hint'
+        // (see 'btlso_tcptimereventmanager').  Return 0 on success, and a
+        // non-zero value, with no effect, if this object is enabled, if any
+        // socket event is registered, or if the socket event manager was
+        // supplied at construction.  Note that the
+        // 'btlso::TcpTimerEventManager::e_FREQUENT_REGISTRATION' hint selects,
+        // on Linux kernels supporting it, an 'io_uring'-based event manager
+        // that submits the registration changes made between two dispatches
+        // in a single system call.
+
     // ACCESSORS
     virtual bool hasLimitedSocketCapacity() const;
         // Return 'true' if this event manager has a limited socket capacity,
@@ -80,6 +80,7 @@ using namespace BloombergLP;
 // [ 6] int registerSocketEvent(handle, event, callback);
 // [ 4] void *registerTimer(expiryTime, callback);
 // [13] int rescheduleTimer(timerId, expiryTime);
+// [17] int setRegistrationHint(btlso::TcpTimerEventManager::Hint hint);
 //
 // ACCESSORS
 // [14] bool hasLimitedSocketCapacity() const;
@@ -97,7 +98,7 @@ using namespace BloombergLP;
 // [15] TEST closure of control channel sockets
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [16] USAGE EXAMPLE
+// [18] USAGE EXAMPLE
 //=============================================================================
 
 //=============================================================================
@@ -278,6 +279,24 @@ void testIsEnabled(btlmt::TcpTimerEventManager *manager,
 
 }  // close namespace TEST_CASE_ENABLE_TEST
 
+//=============================================================================
+//                   TEST: 'setRegistrationHint'
+//-----------------------------------------------------------------------------
+
+namespace TEST_CASE_REGISTRATION_HINT {
+
+void readByte(btlso::SocketHandle::Handle  handle,
+              bslmt::Barrier              *barrier)
+    // Read a byte from the specified 'handle', and wait on the specified
+    // 'barrier'.
+{
+    char byte;
+    ASSERT(1 == btlso::SocketImpUtil::read(&byte, handle, 1));
+    barrier->wait();
+}
+
+}  // close namespace TEST_CASE_REGISTRATION_HINT
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -890,7 +909,7 @@ int main(int argc, char *argv[])
     }
 
     switch (test) { case 0:
-      case 17: {
+      case 18: {
         // ----------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -940,6 +959,96 @@ int main(int argc, char *argv[])
             }
         }
       } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // TESTING 'setRegistrationHint'
+        //
+        // Concerns:
+        //: 1 'setRegistrationHint' succeeds on a disabled object having no
+        //:   registered socket events, with any hint.
+        //:
+        //: 2 Socket events are dispatched by an object after it was given
+        //:   the 'e_FREQUENT_REGISTRATION' hint.
+        //:
+        //: 3 'setRegistrationHint' fails if the object is enabled, has
+        //:   registered socket events, or was supplied a raw event manager.
+        //
+        // Plan:
+        //: 1 Call 'setRegistrationHint' with each hint on a new object.
+        //:   (C-1)
+        //:
+        //: 2 Enable the object, register a read event on one end of a socket
+        //:   pair, write to the other end and verify that the callback is
+        //:   invoked.  (C-2)
+        //:
+        //: 3 Verify that 'setRegistrationHint' fails while the object is
+        //:   enabled, and after it is disabled while the read event is still
+        //:   registered, then succeeds once the event is deregistered.
+        //:   Verify that it fails on an object supplied a raw event manager.
+        //:   (C-3)
+        //
+        // Testing:
+        //   int setRegistrationHint(btlso::TcpTimerEventManager::Hint hint);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'setRegistrationHint'" << endl
+                          << "=============================" << endl;
+
+        using namespace TEST_CASE_REGISTRATION_HINT;
+
+        typedef btlso::TcpTimerEventManager RawObj;
+
+        {
+            Obj mX(&testAllocator);
+
+            ASSERT(0 == mX.setRegistrationHint(RawObj::e_NO_HINT));
+            ASSERT(0 == mX.setRegistrationHint(
+                                           RawObj::e_INFREQUENT_REGISTRATION));
+            ASSERT(0 == mX.setRegistrationHint(
+                                             RawObj::e_FREQUENT_REGISTRATION));
+
+            ASSERT(0 == mX.enable());
+            ASSERT(0 != mX.setRegistrationHint(RawObj::e_NO_HINT));
+
+            btlso::SocketHandle::Handle handles[2];
+            int rc = btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+                                        handles,
+                                        btlso::SocketImpUtil::k_SOCKET_STREAM);
+            ASSERT(0 == rc);
+
+            bslmt::Barrier barrier(2);
+
+            ASSERT(0 == mX.registerSocketEvent(
+                                      handles[0],
+                                      btlso::EventType::e_READ,
+                                      bdlf::BindUtil::bind(&readByte,
+                                                           handles[0],
+                                                           &barrier)));
+
+            const char byte = 'x';
+            ASSERT(1 == btlso::SocketImpUtil::write(handles[1], &byte, 1));
+            barrier.wait();
+
+            ASSERT(0 == mX.disable());
+            ASSERT(0 != mX.setRegistrationHint(RawObj::e_NO_HINT));
+
+            mX.deregisterSocket(handles[0]);
+            ASSERT(0 == mX.setRegistrationHint(RawObj::e_NO_HINT));
+
+            btlso::SocketImpUtil::close(handles[0]);
+            btlso::SocketImpUtil::close(handles[1]);
+        }
+
+        {
+            btlso::DefaultEventManager<btlso::Platform::POLL> rawManager;
+
+            Obj mX(&rawManager, &testAllocator);
+
+            ASSERT(0 != mX.setRegistrationHint(
+                                             RawObj::e_FREQUENT_REGISTRATION));
+        }
+      } break;
       case 16: {
           // ----------------------------------------------------------------
           // TESTING deregistering timers during callbacks
@@ -42,6 +42,8 @@ BSLS_IDENT("$Id: $")
 //  +------------------------------------------------------------------------+
 //  | <btlso::Platform::EPOLL>   |         epoll         |       Linux*      |
 //  +------------------------------------------------------------------------+
+//  | <btlso::Platform::IO_URING>|        io_uring       |       Linux       |
+//  +------------------------------------------------------------------------+
 //  | <btlso::Platform::POLLSET> |        pollset        |       AIX*        |
 //  +------------------------------------------------------------------------+
 //  | <btlso::Platform::POLL>    |          poll         | Solaris, AIX,     |
@@ -93,6 +95,10 @@ BSLS_IDENT("$Id: $")
 #include <btlso_defaulteventmanager_epoll.h>
 #endif
 
+#ifndef INCLUDED_BTLSO_DEFAULTEVENTMANAGER_IOURING
+#include <btlso_defaulteventmanager_iouring.h>
+#endif
+
 #ifndef INCLUDED_BTLSO_DEFAULTEVENTMANAGER_POLL
 #include <btlso_defaulteventmanager_poll.h>
 #endif
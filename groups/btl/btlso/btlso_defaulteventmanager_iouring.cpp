@@ -0,0 +1,878 @@
+// btlso_defaulteventmanager_iouring.cpp                              -*-C++-*-
+#include <btlso_defaulteventmanager_iouring.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(btlso_defaulteventmanager_iouring_cpp,"$Id$ $CSID$")
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+#include <btlso_flag.h>
+#include <btlso_timemetrics.h>
+
+#include <bdlb_bitmaskutil.h>
+#include <bdlb_bitutil.h>
+#include <bdlt_currenttime.h>
+
+#include <bslma_default.h>
+#include <bsls_assert.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstring.h>
+#include <bsl_c_errno.h>
+#include <bsl_c_signal.h>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+#endif
+
+#if defined(IORING_ENTER_EXT_ARG) && defined(__NR_io_uring_setup)
+#define BTLSO_DEFAULTEVENTMANAGER_IOURING_ENABLED 1
+#endif
+
+// IMPLEMENTATION NOTES: The 'user_data' of each poll request holds the socket
+// handle in its low 32 bits and a token, unique to the request, in its high
+// 32 bits.  A socket's poll request is canceled (with 'IORING_OP_POLL_REMOVE',
+// whose own 'user_data' is 0) whenever it is replaced or the socket is
+// deregistered, but its completion may already be in the completion queue, or
+// in 'd_completions'; such stale completions are recognized, and discarded,
+// because their token no longer matches the token of the socket's pending
+// request.
+//
+// The ring is shared with the kernel: the kernel reads the submission queue
+// entries up to the tail we publish, and publishes the completion queue tail.
+// The GCC '__atomic' builtins provide the acquire/release ordering required
+// on these shared indices.
+
+namespace BloombergLP {
+
+namespace btlso {
+
+namespace {
+
+enum {
+    k_RING_SIZE = 256  // number of submission queue entries
+};
+
+const uint32_t k_POLLIN_EVENTS = bdlb::BitMaskUtil::eq(EventType::e_READ) |
+                                 bdlb::BitMaskUtil::eq(EventType::e_ACCEPT);
+
+const uint32_t k_POLLOUT_EVENTS = bdlb::BitMaskUtil::eq(EventType::e_WRITE) |
+                                  bdlb::BitMaskUtil::eq(EventType::e_CONNECT);
+
+int sleep(int                       *resultErrno,
+          const bsls::TimeInterval&  timeout,
+          int                        flags,
+          btlso::TimeMetrics        *metrics)
+{
+    bsls::TimeInterval now(bdlt::CurrentTime::now());
+
+    while (timeout > now) {
+        bsls::TimeInterval currTimeout(timeout - now);
+        struct timespec    ts;
+
+        ts.tv_sec  = static_cast<time_t>(currTimeout.seconds());
+        ts.tv_nsec = static_cast<long>(currTimeout.nanoseconds());
+
+        // Sleep till it's time.
+
+        int savedErrno;
+        int rc;
+        if (metrics) {
+            metrics->switchTo(btlso::TimeMetrics::e_IO_BOUND);
+            rc = nanosleep(&ts, 0);
+            savedErrno = errno;
+            metrics->switchTo(btlso::TimeMetrics::e_CPU_BOUND);
+        }
+        else {
+            rc = nanosleep(&ts, 0);
+            savedErrno = errno;
+        }
+
+        errno = 0;
+        *resultErrno = savedErrno;
+        if (0 > rc) {
+            BSLS_ASSERT(savedErrno == EINTR);
+
+            if (flags & btlso::Flag::k_ASYNC_INTERRUPT) {
+                // We're allowing async interrupts.
+
+                return -1;                                            // RETURN
+            }
+        }
+        now = bdlt::CurrentTime::now();
+    }
+    return 0;
+}
+
+inline
+bsls::Types::Uint64 makeUserData(int handle, unsigned int token)
+    // Return the 'user_data' of the poll request having the specified 'token'
+    // for the specified socket 'handle'.
+{
+    return static_cast<bsls::Types::Uint64>(token) << 32
+         | static_cast<unsigned int>(handle);
+}
+
+unsigned int makePollEvents(uint32_t eventMask)
+    // Return the 'poll' events to monitor for the registered events in the
+    // specified 'eventMask'.  Assert that if multiple events are registered,
+    // they are READ and WRITE.
+{
+    int pollinEvents = bdlb::BitUtil::numBitsSet(eventMask & k_POLLIN_EVENTS);
+    int polloutEvents =
+                       bdlb::BitUtil::numBitsSet(eventMask & k_POLLOUT_EVENTS);
+    BSLS_ASSERT(2 > pollinEvents);
+    BSLS_ASSERT(2 > polloutEvents);
+    BSLS_ASSERT(!(pollinEvents && polloutEvents) ||
+                (eventMask & bdlb::BitMaskUtil::eq(EventType::e_READ) &&
+                 eventMask & bdlb::BitMaskUtil::eq(EventType::e_WRITE)));
+
+    return (POLLIN * pollinEvents) | (POLLOUT * polloutEvents);
+}
+
+#ifdef BTLSO_DEFAULTEVENTMANAGER_IOURING_ENABLED
+
+inline
+unsigned int loadAcquire(const unsigned int *address)
+    // Return the value at the specified 'address', shared with the kernel,
+    // with acquire semantics.
+{
+    return __atomic_load_n(address, __ATOMIC_ACQUIRE);
+}
+
+inline
+void storeRelease(unsigned int *address, unsigned int value)
+    // Store the specified 'value' at the specified 'address', shared with the
+    // kernel, with release semantics.
+{
+    __atomic_store_n(address, value, __ATOMIC_RELEASE);
+}
+
+inline
+int ioUringSetup(unsigned int entries, struct io_uring_params *params)
+    // Create an 'io_uring' instance having the specified 'entries' submission
+    // queue entries, described by the specified 'params'.  Return the file
+    // descriptor of the instance on success, and -1 otherwise.
+{
+    return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+inline
+int ioUringEnter(int           ringFd,
+                 unsigned int  toSubmit,
+                 unsigned int  minComplete,
+                 unsigned int  flags,
+                 const void   *argument,
+                 bsl::size_t   argumentSize)
+    // Invoke the 'io_uring_enter' system call with the specified 'ringFd',
+    // 'toSubmit', 'minComplete', 'flags', 'argument', and 'argumentSize'.
+{
+    return static_cast<int>(syscall(__NR_io_uring_enter,
+                                    ringFd,
+                                    toSubmit,
+                                    minComplete,
+                                    flags,
+                                    argument,
+                                    argumentSize));
+}
+
+#endif
+
+}  // close unnamed namespace
+
+          // ---------------------------------------------
+          // class DefaultEventManager<Platform::IO_URING>
+          // ---------------------------------------------
+
+typedef DefaultEventManager<Platform::IO_URING> EventManagerName;
+    // Alias for brevity.
+
+#ifdef BTLSO_DEFAULTEVENTMANAGER_IOURING_ENABLED
+
+// PRIVATE MANIPULATORS
+void EventManagerName::arm(const SocketHandle::Handle& handle,
+                           uint32_t                    eventMask)
+{
+    BSLS_ASSERT(0 <= handle);
+
+    if (static_cast<bsl::size_t>(handle) >= d_polls.size()) {
+        PollState unarmed = { 0, false };
+        d_polls.resize(handle + 1, unarmed);
+    }
+
+    disarm(handle);
+
+    PollState& state = d_polls[handle];
+    state.d_token = d_nextToken;
+    state.d_armed = true;
+    if (0 == ++d_nextToken) {
+        d_nextToken = 1;
+    }
+
+    struct io_uring_sqe *sqe =
+                          static_cast<struct io_uring_sqe *>(nextSubmission());
+    sqe->opcode        = IORING_OP_POLL_ADD;
+    sqe->fd            = handle;
+    sqe->poll32_events = makePollEvents(eventMask);
+    sqe->user_data     = makeUserData(handle, state.d_token);
+}
+
+void EventManagerName::disarm(const SocketHandle::Handle& handle)
+{
+    if (handle < 0 || static_cast<bsl::size_t>(handle) >= d_polls.size()) {
+        return;                                                       // RETURN
+    }
+
+    PollState& state = d_polls[handle];
+    if (state.d_armed) {
+        struct io_uring_sqe *sqe =
+                          static_cast<struct io_uring_sqe *>(nextSubmission());
+        sqe->opcode    = IORING_OP_POLL_REMOVE;
+        sqe->fd        = -1;
+        sqe->addr      = makeUserData(handle, state.d_token);
+        sqe->user_data = 0;
+    }
+    state.d_token = 0;
+    state.d_armed = false;
+}
+
+int EventManagerName::dispatchCallbacks()
+{
+    int numCallbacks = 0;
+
+    d_dispatching.swap(d_completions);
+
+    // Discard the completions of poll requests that were replaced after the
+    // completions were reaped.  This is done before invoking any callback, so
+    // that a callback replacing the poll request of another socket does not
+    // prevent the dispatch of the events of that socket.
+
+    typedef bsl::vector<Completion>::iterator Iterator;
+    for (Iterator it = d_dispatching.begin();
+                  it != d_dispatching.end();
+                  ++it) {
+        const int handle = it->d_handle;
+
+        if (static_cast<bsl::size_t>(handle) >= d_polls.size()
+         || d_polls[handle].d_armed
+         || d_polls[handle].d_token != it->d_token) {
+            it->d_token = 0;
+        }
+    }
+
+    for (Iterator it = d_dispatching.begin();
+                  it != d_dispatching.end();
+                  ++it) {
+        if (0 == it->d_token) {
+            continue;
+        }
+
+        const int handle = it->d_handle;
+
+        const int events = 0 > it->d_result ? POLLERR : it->d_result;
+
+        // Read/Accept.
+
+        if (events & (POLLIN | POLLERR | POLLHUP)) {
+            if (d_callbacks.contains(Event(handle, EventType::e_READ))) {
+                numCallbacks += !d_callbacks.invoke(Event(handle,
+                                                          EventType::e_READ));
+            } else {
+                numCallbacks += !d_callbacks.invoke(
+                                          Event(handle, EventType::e_ACCEPT));
+            }
+        }
+
+        // Write/Connect.
+
+        if (events & POLLOUT) {
+            if (d_callbacks.contains(Event(handle, EventType::e_WRITE))) {
+                numCallbacks += !d_callbacks.invoke(Event(handle,
+                                                          EventType::e_WRITE));
+            } else {
+                numCallbacks += !d_callbacks.invoke(
+                                          Event(handle, EventType::e_CONNECT));
+            }
+        }
+
+        // Re-arm the poll request of the socket (unless a callback already
+        // did), which provides level-triggered semantics.
+
+        const uint32_t eventMask = d_callbacks.getRegisteredEventMask(handle);
+        if (eventMask && !d_polls[handle].d_armed) {
+            arm(handle, eventMask);
+        }
+    }
+    d_dispatching.clear();
+
+    return numCallbacks;
+}
+
+int EventManagerName::dispatchImp(int                       flags,
+                                  const bsls::TimeInterval *timeout)
+{
+    bsls::TimeInterval now;
+    if (timeout) {
+        now = bdlt::CurrentTime::now();
+    }
+    int numCallbacks = 0;                    // number of callbacks dispatched
+    const bool allowAsyncInterrupts =
+                               (0 != (btlso::Flag::k_ASYNC_INTERRUPT & flags));
+
+    do {
+        int rc = 0;                  // result of the last system call
+        int savedErrno = 0;          // saved errno value set by the call
+        while (1) {
+            if (!d_completions.empty()) {
+                // Completions were reaped while queuing submissions; submit
+                // without waiting.
+
+                submitPending();
+                break;
+            }
+
+            bsls::TimeInterval relativeTimeout;
+            if (timeout && *timeout > now) {
+                relativeTimeout = *timeout - now;
+            }
+
+            if (d_timeMetric_p) {
+                d_timeMetric_p->switchTo(btlso::TimeMetrics::e_IO_BOUND);
+            }
+
+            rc = submit(true, timeout ? &relativeTimeout : 0);
+            savedErrno = errno;
+
+            if (d_timeMetric_p) {
+                d_timeMetric_p->switchTo(btlso::TimeMetrics::e_CPU_BOUND);
+            }
+            errno = 0;
+
+            const int numReaped = reapCompletions();
+            if (!d_completions.empty()) {
+                break;
+            }
+
+            if (0 <= rc
+             && 0 == numReaped
+             && (!timeout || bdlt::CurrentTime::now() < *timeout)) {
+                // The wait ended early without a completion: if entries were
+                // submitted, 'io_uring_enter' returns their number even if the
+                // wait was interrupted by a signal.
+
+                savedErrno = EINTR;
+                rc         = -1;
+            }
+
+            if (rc < 0 && EINTR == savedErrno && allowAsyncInterrupts) {
+                // We've been interrupted and the user wants to know.
+
+                return -1;                                            // RETURN
+            }
+
+            BSLS_ASSERT(0 <= rc
+                     || EINTR  == savedErrno
+                     || ETIME  == savedErrno
+                     || EBUSY  == savedErrno
+                     || EAGAIN == savedErrno);
+
+            if (timeout) {
+                now = bdlt::CurrentTime::now();
+                if (now >= *timeout) {
+                    // We reached the timeout.
+
+                    return 0;                                         // RETURN
+                }
+            }
+        }
+
+        numCallbacks += dispatchCallbacks();
+        if (timeout) {
+            now = bdlt::CurrentTime::now();
+        }
+    } while (0 == numCallbacks && (0 == timeout || now < *timeout));
+
+    return numCallbacks;
+}
+
+void *EventManagerName::nextSubmission()
+{
+    if (d_sqTail - loadAcquire(d_sqHead_p) == d_sqEntries) {
+        submitPending();
+    }
+    BSLS_ASSERT_OPT(d_sqTail - loadAcquire(d_sqHead_p) < d_sqEntries);
+
+    struct io_uring_sqe *sqe = static_cast<struct io_uring_sqe *>(d_sqes_p)
+                             + (d_sqTail & d_sqMask);
+    bsl::memset(sqe, 0, sizeof *sqe);
+    ++d_sqTail;
+    return sqe;
+}
+
+int EventManagerName::reapCompletions()
+{
+    const unsigned int head = *d_cqHead_p;
+    const unsigned int tail = loadAcquire(d_cqTail_p);
+
+    const struct io_uring_cqe *cqes =
+                          static_cast<const struct io_uring_cqe *>(d_cqes_p);
+
+    for (unsigned int index = head; index != tail; ++index) {
+        const struct io_uring_cqe& cqe = cqes[index & d_cqMask];
+
+        if (0 == cqe.user_data) {
+            continue;  // completion of a cancellation
+        }
+
+        const int          handle = static_cast<int>(cqe.user_data
+                                                               & 0xFFFFFFFF);
+        const unsigned int token  = static_cast<unsigned int>(cqe.user_data
+                                                                       >> 32);
+
+        if (static_cast<bsl::size_t>(handle) < d_polls.size()
+         && d_polls[handle].d_armed
+         && d_polls[handle].d_token == token) {
+            d_polls[handle].d_armed = false;
+
+            Completion completion = { handle, token, cqe.res };
+            d_completions.push_back(completion);
+        }
+    }
+
+    storeRelease(d_cqHead_p, tail);
+
+    return static_cast<int>(tail - head);
+}
+
+void EventManagerName::submitPending()
+{
+    while (d_sqTail != loadAcquire(d_sqHead_p)) {
+        const int rc         = submit(false);
+        const int savedErrno = errno;
+
+        // Reaping the completion queue makes room for the completions that
+        // the kernel could not post, which is what 'EBUSY' reports: the
+        // kernel posts them, and accepts the submissions, on the next try.
+
+        reapCompletions();
+
+        if (0 > rc) {
+            errno = 0;
+            if (EBUSY != savedErrno
+             && EAGAIN != savedErrno
+             && EINTR != savedErrno) {
+                BSLS_ASSERT(0 && "io_uring_enter failed");
+                return;                                               // RETURN
+            }
+        }
+    }
+    reapCompletions();
+}
+
+int EventManagerName::submit(bool                      waitFlag,
+                             const bsls::TimeInterval *timeout)
+{
+    storeRelease(d_sqTailAddr_p, d_sqTail);
+
+    const unsigned int toSubmit = d_sqTail - loadAcquire(d_sqHead_p);
+
+    if (0 == toSubmit && !waitFlag) {
+        return 0;                                                     // RETURN
+    }
+
+    ++d_numSystemCalls;
+
+    if (!waitFlag) {
+        return ioUringEnter(d_ringFd, toSubmit, 0, 0, 0, _NSIG / 8);
+                                                                      // RETURN
+    }
+
+    if (!timeout) {
+        return ioUringEnter(d_ringFd,
+                            toSubmit,
+                            1,
+                            IORING_ENTER_GETEVENTS,
+                            0,
+                            _NSIG / 8);                               // RETURN
+    }
+
+    struct __kernel_timespec ts;
+    ts.tv_sec  = timeout->seconds();
+    ts.tv_nsec = timeout->nanoseconds();
+
+    struct io_uring_getevents_arg argument;
+    bsl::memset(&argument, 0, sizeof argument);
+    argument.sigmask_sz = _NSIG / 8;
+    argument.ts         = reinterpret_cast<bsls::Types::Uint64>(&ts);
+
+    return ioUringEnter(d_ringFd,
+                        toSubmit,
+                        1,
+                        IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+                        &argument,
+                        sizeof argument);
+}
+
+// PUBLIC CLASS METHODS
+bool EventManagerName::isSupported()
+{
+    struct io_uring_params params;
+    bsl::memset(&params, 0, sizeof params);
+
+    int fd = ioUringSetup(k_RING_SIZE, &params);
+    if (-1 == fd) {
+        return false;                                                 // RETURN
+    }
+    close(fd);
+
+    return (params.features & IORING_FEAT_EXT_ARG)
+        && (params.features & IORING_FEAT_NODROP);
+}
+
+// CREATORS
+EventManagerName::DefaultEventManager(btlso::TimeMetrics *timeMetric,
+                                      bslma::Allocator   *basicAllocator)
+: d_ringFd(-1)
+, d_sqRing_p(0)
+, d_sqRingSize(0)
+, d_cqRing_p(0)
+, d_cqRingSize(0)
+, d_sqes_p(0)
+, d_sqesSize(0)
+, d_sqHead_p(0)
+, d_sqTailAddr_p(0)
+, d_sqTail(0)
+, d_sqMask(0)
+, d_sqEntries(0)
+, d_cqHead_p(0)
+, d_cqTail_p(0)
+, d_cqMask(0)
+, d_cqes_p(0)
+, d_nextToken(1)
+, d_numSystemCalls(0)
+, d_polls(basicAllocator)
+, d_completions(basicAllocator)
+, d_dispatching(basicAllocator)
+, d_timeMetric_p(timeMetric)
+, d_callbacks(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    struct io_uring_params params;
+    bsl::memset(&params, 0, sizeof params);
+
+    d_ringFd = ioUringSetup(k_RING_SIZE, &params);
+    if (-1 == d_ringFd) {
+        bsl::perror("io_uring_setup returned ");
+        BSLS_ASSERT_OPT("io_uring_setup() failed" && 0);
+    }
+
+    d_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    d_cqRingSize = params.cq_off.cqes
+                 + params.cq_entries * sizeof(struct io_uring_cqe);
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        if (d_cqRingSize > d_sqRingSize) {
+            d_sqRingSize = d_cqRingSize;
+        }
+        d_cqRingSize = d_sqRingSize;
+    }
+
+    d_sqRing_p = mmap(0,
+                      d_sqRingSize,
+                      PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE,
+                      d_ringFd,
+                      IORING_OFF_SQ_RING);
+    BSLS_ASSERT_OPT(MAP_FAILED != d_sqRing_p);
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        d_cqRing_p = d_sqRing_p;
+    }
+    else {
+        d_cqRing_p = mmap(0,
+                          d_cqRingSize,
+                          PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE,
+                          d_ringFd,
+                          IORING_OFF_CQ_RING);
+        BSLS_ASSERT_OPT(MAP_FAILED != d_cqRing_p);
+    }
+
+    d_sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    d_sqes_p   = mmap(0,
+                      d_sqesSize,
+                      PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE,
+                      d_ringFd,
+                      IORING_OFF_SQES);
+    BSLS_ASSERT_OPT(MAP_FAILED != d_sqes_p);
+
+    char *sqRing = static_cast<char *>(d_sqRing_p);
+    char *cqRing = static_cast<char *>(d_cqRing_p);
+
+    d_sqHead_p     = reinterpret_cast<unsigned *>(sqRing + params.sq_off.head);
+    d_sqTailAddr_p = reinterpret_cast<unsigned *>(sqRing + params.sq_off.tail);
+    d_sqMask       = *reinterpret_cast<unsigned *>(sqRing
+                                                 + params.sq_off.ring_mask);
+    d_sqEntries    = params.sq_entries;
+    d_sqTail       = *d_sqTailAddr_p;
+
+    // Submission queue entries are always used in order, so the indirection
+    // array maps each slot to the entry having the same index.
+
+    unsigned *sqArray = reinterpret_cast<unsigned *>(sqRing
+                                                     + params.sq_off.array);
+    for (unsigned i = 0; i < params.sq_entries; ++i) {
+        sqArray[i] = i;
+    }
+
+    d_cqHead_p = reinterpret_cast<unsigned *>(cqRing + params.cq_off.head);
+    d_cqTail_p = reinterpret_cast<unsigned *>(cqRing + params.cq_off.tail);
+    d_cqMask   = *reinterpret_cast<unsigned *>(cqRing
+                                               + params.cq_off.ring_mask);
+    d_cqes_p   = cqRing + params.cq_off.cqes;
+}
+
+EventManagerName::~DefaultEventManager()
+{
+    // Closing the ring cancels any pending request.
+
+    munmap(d_sqes_p, d_sqesSize);
+    if (d_cqRing_p != d_sqRing_p) {
+        munmap(d_cqRing_p, d_cqRingSize);
+    }
+    munmap(d_sqRing_p, d_sqRingSize);
+
+    int rc = close(d_ringFd);
+    (void)rc; BSLS_ASSERT(0 == rc);
+}
+
+#else  // BTLSO_DEFAULTEVENTMANAGER_IOURING_ENABLED
+
+// The kernel headers do not provide the required 'io_uring' interface: this
+// event manager is not supported.
+
+// PRIVATE MANIPULATORS
+void EventManagerName::arm(const SocketHandle::Handle&, uint32_t)
+{
+}
+
+void EventManagerName::disarm(const SocketHandle::Handle&)
+{
+}
+
+int EventManagerName::dispatchCallbacks()
+{
+    return 0;
+}
+
+int EventManagerName::dispatchImp(int, const bsls::TimeInterval *)
+{
+    return -2;
+}
+
+void *EventManagerName::nextSubmission()
+{
+    return 0;
+}
+
+int EventManagerName::reapCompletions()
+{
+    return 0;
+}
+
+void EventManagerName::submitPending()
+{
+}
+
+int EventManagerName::submit(bool, const bsls::TimeInterval *)
+{
+    return 0;
+}
+
+// PUBLIC CLASS METHODS
+bool EventManagerName::isSupported()
+{
+    return false;
+}
+
+// CREATORS
+EventManagerName::DefaultEventManager(btlso::TimeMetrics *timeMetric,
+                                      bslma::Allocator   *basicAllocator)
+: d_ringFd(-1)
+, d_sqRing_p(0)
+, d_sqRingSize(0)
+, d_cqRing_p(0)
+, d_cqRingSize(0)
+, d_sqes_p(0)
+, d_sqesSize(0)
+, d_sqHead_p(0)
+, d_sqTailAddr_p(0)
+, d_sqTail(0)
+, d_sqMask(0)
+, d_sqEntries(0)
+, d_cqHead_p(0)
+, d_cqTail_p(0)
+, d_cqMask(0)
+, d_cqes_p(0)
+, d_nextToken(1)
+, d_numSystemCalls(0)
+, d_polls(basicAllocator)
+, d_completions(basicAllocator)
+, d_dispatching(basicAllocator)
+, d_timeMetric_p(timeMetric)
+, d_callbacks(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_OPT("io_uring is not supported" && 0);
+}
+
+EventManagerName::~DefaultEventManager()
+{
+}
+
+#endif  // BTLSO_DEFAULTEVENTMANAGER_IOURING_ENABLED
+
+// MANIPULATORS
+void EventManagerName::deregisterAll()
+{
+    for (bsl::size_t handle = 0; handle < d_polls.size(); ++handle) {
+        disarm(static_cast<int>(handle));
+    }
+    d_callbacks.removeAll();
+    d_completions.clear();
+
+    // Cancel the poll requests now, so that the sockets can be closed.
+
+    submitPending();
+}
+
+void EventManagerName::deregisterSocketEvent(
+                                     const btlso::SocketHandle::Handle& handle,
+                                     btlso::EventType::Type             event)
+{
+    Event handleEvent(handle, event);
+
+    if (!d_callbacks.remove(handleEvent)) {
+        return;                                                       // RETURN
+    }
+
+    uint32_t newMask = d_callbacks.getRegisteredEventMask(handle);
+    if (0 == newMask) {
+        // There are no more events to monitor for this handle.  Cancel its
+        // poll request now, so that the socket can be closed.
+
+        disarm(handle);
+        submitPending();
+        return;                                                       // RETURN
+    }
+
+    // We're still interested in another event for this handle: replace the
+    // poll request.
+
+    arm(handle, newMask);
+}
+
+int EventManagerName::deregisterSocket(
+                                     const btlso::SocketHandle::Handle& handle)
+{
+    int numEvents = d_callbacks.removeSocket(handle);
+
+    if (numEvents) {
+        disarm(handle);
+        submitPending();
+    }
+    return numEvents;
+}
+
+int EventManagerName::dispatch(const bsls::TimeInterval& timeout,
+                               int                       flags)
+{
+    if (0 == numEvents()) {
+        submitPending();
+
+        int dummy;
+        return sleep(&dummy, timeout, flags, d_timeMetric_p);         // RETURN
+    }
+    return dispatchImp(flags, &timeout);
+}
+
+int EventManagerName::dispatch(int flags)
+{
+    if (0 == numEvents()) {
+        submitPending();
+        return 0;                                                     // RETURN
+    }
+    return dispatchImp(flags, 0);
+}
+
+int EventManagerName::registerSocketEvent(
+                                 const btlso::SocketHandle::Handle&   handle,
+                                 const btlso::EventType::Type         event,
+                                 const btlso::EventManager::Callback& callback)
+{
+    BSLS_ASSERT(0 <= handle);
+
+    Event handleEvent(handle, event);
+
+    uint32_t eventMask = d_callbacks.registerCallback(handleEvent, callback);
+    if (0 == eventMask) {
+        // Event was already registered; we simply changed the callback
+
+        return 0;                                                     // RETURN
+    }
+
+    arm(handle, eventMask);
+    return 0;
+}
+
+// ACCESSORS
+int EventManagerName::numSocketEvents(
+                               const btlso::SocketHandle::Handle& handle) const
+{
+    return bdlb::BitUtil::numBitsSet(
+                                  d_callbacks.getRegisteredEventMask(handle));
+}
+
+int EventManagerName::numEvents() const
+{
+    return d_callbacks.numCallbacks();
+}
+
+int EventManagerName::isRegistered(
+                                const btlso::SocketHandle::Handle& handle,
+                                const btlso::EventType::Type       event) const
+{
+    return d_callbacks.contains(Event(handle, event));
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif  // BSLS_PLATFORM_OS_LINUX
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,591 @@
+// btlso_defaulteventmanager_iouring.h                                -*-C++-*-
+#ifndef INCLUDED_BTLSO_DEFAULTEVENTMANAGER_IOURING
+#define INCLUDED_BTLSO_DEFAULTEVENTMANAGER_IOURING
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide socket multiplexer implementation using Linux 'io_uring'.
+//
+//@CLASSES:
+//  btlso::DefaultEventManager<btlso::Platform::IO_URING>: 'io_uring' mux
+//
+//@SEE_ALSO: btlso_eventmanager btlso_defaulteventmanager btlso_timemetrics
+//
+//@DESCRIPTION: This component provides an implementation of an event manager,
+// 'btlso::DefaultEventManager<btlso::Platform::IO_URING>', that uses a Linux
+// 'io_uring' submission/completion queue pair to monitor for socket events and
+// adheres to the 'btlso::EventManager' protocol.  In particular, this protocol
+// supports the registration of level-triggered socket events, along with an
+// associated 'bsl::function' callback functor, which is invoked when the
+// corresponding socket event occurs.
+//
+// Registering a socket event requires specifying a socket handle and the type
+// of event to monitor on the indicated socket.  Socket event registrations
+// stay in effect until they are subsequently deregistered; the associated
+// callback is invoked each time the specified socket event occurs provided
+// that appropriate method (i.e., 'dispatch') is called.  Once deregistered,
+// the callback will no longer be invoked.
+//
+///Batched Registration
+///--------------------
+// The 'epoll'-based event manager (see 'btlso_defaulteventmanager_epoll')
+// makes one 'epoll_ctl' system call for every registration and for every
+// deregistration that leaves other events registered on the socket.  Clients
+// that frequently toggle their interest in an event -- e.g., a channel that
+// registers for 'e_WRITE' each time its socket buffer fills, and deregisters
+// once its write queue is drained -- make many such calls.
+//
+// This event manager monitors each socket with a one-shot poll request
+// submitted through the 'io_uring' submission queue.  Registrations and
+// deregistrations only queue submissions, and the poll request of each socket
+// whose events were dispatched is re-armed (which provides level-triggered
+// semantics) by queuing another submission after its callbacks return.  All
+// queued submissions are handed to the kernel by the single 'io_uring_enter'
+// system call that 'dispatch' makes to wait for events, so that the number of
+// system calls made per 'dispatch' is one, regardless of the number of
+// registration changes.  The 'numSystemCalls' accessor reports the number of
+// 'io_uring_enter' calls made by an event manager.
+//
+// The exception to this rule is the deregistration of *all* the events of a
+// socket (by 'deregisterSocketEvent', 'deregisterSocket', or
+// 'deregisterAll'): a pending poll request holds a reference to the socket,
+// so the request is canceled immediately to ensure that closing the socket
+// after deregistering it releases the socket.
+//
+// Note that, as with other event managers, an error on a registered socket
+// (including the socket being invalid) is reported by invoking the callbacks
+// registered for the socket, and that, unlike with the 'epoll'-based event
+// manager, registering an invalid socket handle does not fail immediately.
+//
+///Scope: Readiness Only
+///---------------------
+// This event manager uses 'io_uring' only to *monitor* sockets.  It
+// implements the readiness-based 'btlso::EventManager' protocol, under which
+// a callback is notified that a socket is ready and then performs the read,
+// write, accept, or connect itself, with its own system call.  The I/O
+// operations themselves are *not* submitted through 'io_uring', and no
+// buffers (e.g., those of a 'btlb::PooledBlobBufferFactory') are registered
+// with the kernel: that requires a completion-based protocol, in which the
+// caller lends buffers to the event manager and is called back with the
+// result of each operation, and the channels of 'btlmt::ChannelPool', which
+// read and write from their readiness callbacks, would have to be rewritten
+// on top of it.  Consequently, the system calls saved by this component are
+// those of registration changes (see {Batched Registration}); the number of
+// system calls made to transfer a message is the same as with the
+// 'epoll'-based event manager.
+//
+///Availability
+///------------
+// 'io_uring' (with the 'IORING_FEAT_EXT_ARG' feature used to wait with a
+// timeout) is available in Linux kernels 5.11 and later, and may be disabled
+// by the system administrator.  The 'isSupported' class method reports
+// whether the running kernel supports this event manager; the behavior of
+// creating an event manager is undefined unless 'isSupported' returns 'true'.
+// Direct use of this library component on *any* platform may result in
+// non-portable software.
+//
+///Component Diagram
+///-----------------
+// This specialized component is one of the specializations of the
+// 'btlso_defaulteventmanager' component; the other components are shown
+// (schematically) on the following diagram:
+//..
+//                         _____btlso_defaulteventmanager_____
+//                 _______/    |      |      |       |        \_________
+//                 *_poll   *_epoll *_iouring *_select *_devpoll *_pollset
+//..
+//
+///Thread Safety
+///-------------
+// This component depends on a 'bslma::Allocator' instance to supply memory.
+// If the allocator is not thread enabled then the instances of this component
+// that use the same allocator instance will consequently not be thread safe
+// Otherwise, this component provides the following guarantees.
+//
+// Accessing an instance of the event manager provided by this component from
+// different threads may result in undefined behavior.  Accessing distinct
+// instances from different threads is safe.  Distinct instances of the event
+// manager provided by this component are *thread* *enabled* meaning that
+// operations invoked on distinct instances from different threads can proceed
+// concurrently.  The event manager is not *async-safe*, meaning that one or
+// more functions cannot be invoked safely from a signal handler.
+//
+///Performance
+///-----------
+// Given that S is the number of socket events registered, and H the largest
+// socket handle registered, this component provides the following complexity
+// guarantees:
+//..
+//  +=======================================================================+
+//  |        FUNCTION          | EXPECTED COMPLEXITY | WORST CASE COMPLEXITY|
+//  +-----------------------------------------------------------------------+
+//  | dispatch                 |        O(S)         |       O(S^2)         |
+//  +-----------------------------------------------------------------------+
+//  | registerSocketEvent      |        O(1)         |        O(S)          |
+//  +-----------------------------------------------------------------------+
+//  | deregisterSocketEvent    |        O(1)         |        O(S)          |
+//  +-----------------------------------------------------------------------+
+//  | deregisterSocket         |        O(1)         |        O(S)          |
+//  +-----------------------------------------------------------------------+
+//  | deregisterAll            |        O(H)         |        O(H)          |
+//  +-----------------------------------------------------------------------+
+//  | numSocketEvents          |        O(1)         |        O(S)          |
+//  +-----------------------------------------------------------------------+
+//  | numEvents                |        O(1)         |        O(1)          |
+//  +-----------------------------------------------------------------------+
+//  | isRegistered             |        O(1)         |        O(S)          |
+//  +=======================================================================+
+//..
+//
+///Metrics
+///-------
+// The event manager provided by this component can use external (i.e.,
+// user-installed) time metrics (see 'btlso_timemetrics' component) to record
+// times spend in IO-bound and CPU-bound operations using the category IDs
+// defined in 'btlso::TimeMetrics'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Batching Registration Changes
+///- - - - - - - - - - - - - - - - - - - - -
+// The following snippets of code illustrate how registration changes made
+// between two calls to 'dispatch' are submitted to the kernel together.
+// First, we verify that the running kernel supports this event manager, and
+// create the event manager and a (locally-connected) socket pair:
+//..
+//  typedef btlso::DefaultEventManager<btlso::Platform::IO_URING> EventManager;
+//
+//  if (!EventManager::isSupported()) {
+//      return;                                                       // RETURN
+//  }
+//
+//  EventManager mX;  const EventManager& X = mX;
+//
+//  btlso::SocketHandle::Handle socket[2];
+//
+//  int rc = btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+//                                      socket,
+//                                      btlso::SocketImpUtil::k_SOCKET_STREAM);
+//  assert(0 == rc);
+//..
+// Then, we register for both ends of the socket pair becoming writable, and
+// for 'socket[0]' becoming readable, without making any system call:
+//..
+//  int numInvoked = 0;
+//
+//  btlso::EventManager::Callback countCb(
+//                            bdlf::BindUtil::bind(&incrementCounter,
+//                                                 &numInvoked));
+//
+//  mX.registerSocketEvent(socket[0], btlso::EventType::e_READ,  countCb);
+//  mX.registerSocketEvent(socket[0], btlso::EventType::e_WRITE, countCb);
+//  mX.registerSocketEvent(socket[1], btlso::EventType::e_WRITE, countCb);
+//
+//  assert(3 == X.numEvents());
+//  assert(0 == X.numSystemCalls());
+//..
+// Now, we dispatch the pending events.  Both sockets are writable, so two
+// callbacks are invoked, and the three registrations were submitted by a
+// single system call:
+//..
+//  rc = mX.dispatch(bsls::TimeInterval(bdlt::CurrentTime::now()) + 5, 0);
+//  assert(2 == rc);
+//  assert(2 == numInvoked);
+//  assert(1 == X.numSystemCalls());
+//..
+// Finally, we deregister all the events and close the sockets:
+//..
+//  mX.deregisterAll();
+//  assert(0 == X.numEvents());
+//
+//  btlso::SocketImpUtil::close(socket[0]);
+//  btlso::SocketImpUtil::close(socket[1]);
+//..
+// The following snippet of code shows what 'incrementCounter' may look like:
+//..
+//  static void incrementCounter(int *counter)
+//  {
+//      ++*counter;
+//  }
+//..
+
+#ifndef INCLUDED_BTLSCM_VERSION
+#include <btlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_DEFAULTEVENTMANAGERIMPL
+#include <btlso_defaulteventmanagerimpl.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_EVENT
+#include <btlso_event.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_EVENTCALLBACKREGISTRY
+#include <btlso_eventcallbackregistry.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_EVENTMANAGER
+#include <btlso_eventmanager.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_EVENTTYPE
+#include <btlso_eventtype.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_PLATFORM
+#include <btlso_platform.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_SOCKETHANDLE
+#include <btlso_sockethandle.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+namespace BloombergLP {
+
+namespace bslma { class Allocator; }
+
+namespace bsls { class TimeInterval; }
+
+namespace btlso {
+
+class TimeMetrics;
+
+          // =============================================
+          // class DefaultEventManager<Platform::IO_URING>
+          // =============================================
+
+template <>
+class DefaultEventManager<Platform::IO_URING> : public EventManager
+{
+    // This class implements the 'btlso::EventManager' protocol using a Linux
+    // 'io_uring' instance, submitting registration changes in batches (see
+    // {Batched Registration}).
+
+    // PRIVATE TYPES
+    struct PollState {
+        // This 'struct' describes the poll request of a socket.
+
+        unsigned int d_token;  // token identifying the latest poll request
+                               // submitted for the socket, or 0 if none
+
+        bool         d_armed;  // 'true' if the latest poll request has not
+                               // completed
+    };
+
+    struct Completion {
+        // This 'struct' describes a completed poll request whose callbacks
+        // have not yet been invoked.
+
+        int          d_handle;  // socket handle
+
+        unsigned int d_token;   // token of the completed request
+
+        int          d_result;  // poll mask, or negated 'errno' value
+    };
+
+    // DATA
+    int                      d_ringFd;         // 'io_uring' file descriptor
+
+    void                    *d_sqRing_p;       // submission queue ring
+                                               // mapping
+
+    bsl::size_t              d_sqRingSize;     // size of 'd_sqRing_p'
+
+    void                    *d_cqRing_p;       // completion queue ring
+                                               // mapping (may be
+                                               // 'd_sqRing_p')
+
+    bsl::size_t              d_cqRingSize;     // size of 'd_cqRing_p'
+
+    void                    *d_sqes_p;         // submission queue entries
+
+    bsl::size_t              d_sqesSize;       // size of 'd_sqes_p'
+
+    unsigned int            *d_sqHead_p;       // kernel-owned head of the
+                                               // submission queue
+
+    unsigned int            *d_sqTailAddr_p;   // shared tail of the
+                                               // submission queue
+
+    unsigned int             d_sqTail;         // local tail of the
+                                               // submission queue
+
+    unsigned int             d_sqMask;         // submission queue index
+                                               // mask
+
+    unsigned int             d_sqEntries;      // submission queue capacity
+
+    unsigned int            *d_cqHead_p;       // shared head of the
+                                               // completion queue
+
+    unsigned int            *d_cqTail_p;       // kernel-owned tail of the
+                                               // completion queue
+
+    unsigned int             d_cqMask;         // completion queue index
+                                               // mask
+
+    void                    *d_cqes_p;         // completion queue entries
+
+    unsigned int             d_nextToken;      // token of the next poll
+                                               // request
+
+    bsls::Types::Int64       d_numSystemCalls; // number of 'io_uring_enter'
+                                               // calls made
+
+    bsl::vector<PollState>   d_polls;          // poll request state, indexed
+                                               // by socket handle
+
+    bsl::vector<Completion>  d_completions;    // completed poll requests
+                                               // awaiting dispatch
+
+    bsl::vector<Completion>  d_dispatching;    // completions being
+                                               // dispatched
+
+    TimeMetrics             *d_timeMetric_p;   // metrics to use for
+                                               // reporting percent-busy
+                                               // statistics
+
+    EventCallbackRegistry    d_callbacks;      // map of events to callbacks
+
+    bslma::Allocator        *d_allocator_p;    // supplies memory
+
+    // PRIVATE MANIPULATORS
+    void arm(const SocketHandle::Handle& handle, uint32_t eventMask);
+        // Submit a poll request for the events in the specified 'eventMask'
+        // on the specified 'handle', replacing any pending poll request for
+        // 'handle'.  Note that the request is queued, and is submitted to the
+        // kernel by the next call to 'submit'.
+
+    void disarm(const SocketHandle::Handle& handle);
+        // Cancel the pending poll request for the specified 'handle', if any.
+        // Note that the cancellation is queued, and is submitted to the kernel
+        // by the next call to 'submit'.
+
+    int dispatchCallbacks();
+        // Invoke the registered callbacks for the events reported by the
+        // completions in 'd_completions', re-arm the poll requests of the
+        // corresponding sockets, and clear 'd_completions'.  Return the
+        // number of callbacks invoked.
+
+    int dispatchImp(int flags, const bsls::TimeInterval *timeout = 0);
+        // For each pending socket event, invoke the corresponding callback
+        // registered with this event manager.
+
+    void *nextSubmission();
+        // Return the address of the next free submission queue entry, which
+        // is zero-initialized, submitting the queued entries to the kernel
+        // first if the submission queue is full.
+
+    int reapCompletions();
+        // Move the current poll request completions from the completion queue
+        // to 'd_completions', discarding those of canceled or replaced
+        // requests.  Return the number of completion queue entries consumed
+        // (including the discarded ones).
+
+    void submitPending();
+        // Submit the queued submission queue entries to the kernel without
+        // waiting for completions, reaping the completion queue (see
+        // 'reapCompletions') and retrying for as long as the kernel reports
+        // that it cannot accept them yet (e.g., with 'EBUSY' because
+        // completions are waiting for room in the completion queue).
+
+    int submit(bool                      waitFlag,
+               const bsls::TimeInterval *timeout = 0);
+        // Submit the queued submission queue entries to the kernel.  If the
+        // specified 'waitFlag' is 'true', also wait until at least one
+        // completion is available or, if the optionally specified relative
+        // 'timeout' is not 0, until 'timeout' elapses.  Return the result of
+        // the 'io_uring_enter' system call (or 0 if no system call was
+        // needed), with 'errno' indicating the error if the result is
+        // negative.  Note that if entries were submitted, the result is their
+        // number even if the wait was interrupted or timed out.
+
+  private:
+    // NOT IMPLEMENTED
+    DefaultEventManager(const DefaultEventManager&);
+    DefaultEventManager& operator=(const DefaultEventManager&);
+
+  public:
+    // PUBLIC CLASS METHODS
+    static bool isSupported();
+        // Return true if the current kernel supports this event manager.
+
+    // CREATORS
+    explicit
+    DefaultEventManager(TimeMetrics      *timeMetric     = 0,
+                        bslma::Allocator *basicAllocator = 0);
+        // Create an 'io_uring'-based event manager.  Optionally specify a
+        // 'timeMetric' to report time spent in CPU-bound and IO-bound
+        // operations.  If 'timeMetric' is not specified or is 0, these metrics
+        // are not reported.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // 'isSupported()'.
+
+    ~DefaultEventManager();
+        // Destroy this object.  Note that the registered callbacks are NOT
+        // invoked.
+
+    // MANIPULATORS
+    int dispatch(const bsls::TimeInterval& timeout, int flags);
+        // For each pending socket event, invoke the corresponding callback
+        // registered with this event manager.  If no event is pending, wait
+        // until either (1) at least one event occurs (in which case the
+        // corresponding callback(s) is invoked), (2) the specified absolute
+        // 'timeout' is reached, or (3) provided that the specified 'flags'
+        // contains 'btlso::Flag::k_ASYNC_INTERRUPT', an underlying system call
+        // is interrupted by a signal.  Return the number of dispatched
+        // callbacks on success, 0 if 'timeout' is reached, and a negative
+        // value otherwise; -1 is reserved to indicate that an underlying
+        // system call was interrupted.  When such an interruption occurs this
+        // method will return (-1) if 'flags' contains
+        // 'btlso::Flag::k_ASYNC_INTERRUPT', and otherwise will automatically
+        // restart (i.e., reissue the identical system call).  Note that all
+        // callbacks are invoked in the same thread that invokes 'dispatch',
+        // and the order of invocation, relative to the order of registration,
+        // is unspecified.  Also note that -1 is never returned unless 'flags'
+        // contains 'btlso::Flag::k_ASYNC_INTERRUPT'.
+
+    int dispatch(int flags);
+        // For each pending socket event, invoke the corresponding callback
+        // registered with this event manager.  If no event is pending, wait
+        // until either (1) at least one event occurs (in which case the
+        // corresponding callback(s) is invoked) or (2) provided that the
+        // specified 'flags' contains 'btlso::Flag::k_ASYNC_INTERRUPT', an
+        // underlying system call is interrupted by a signal.  Return the
+        // number of dispatched callbacks on success, and a negative value
+        // otherwise; -1 is reserved to indicate that an underlying system call
+        // was interrupted.  When such an interruption occurs this method will
+        // return (-1) if 'flags' contains 'btlso::Flag::k_ASYNC_INTERRUPT' and
+        // otherwise will automatically restart (i.e., reissue the identical
+        // system call).  Note that all callbacks are invoked in the same
+        // thread that invokes 'dispatch', and the order of invocation,
+        // relative to the order of registration, is unspecified.  Also note
+        // that -1 is never returned unless 'flags' contains
+        // 'btlso::Flag::k_ASYNC_INTERRUPT'.
+
+    int registerSocketEvent(const SocketHandle::Handle&   handle,
+                            const EventType::Type         event,
+                            const EventManager::Callback& callback);
+        // Register with this event manager the specified 'callback' to be
+        // invoked when the specified 'event' occurs on the specified socket
+        // 'handle'.  Each socket event registration stays in effect until it
+        // is subsequently deregistered; the callback is invoked each time the
+        // corresponding event is detected.  'EventType::e_READ' and
+        // 'EventType::e_WRITE' are the only events that can be registered
+        // simultaneously for a socket.  If a registration attempt is made for
+        // an event that is already registered, the callback associated with
+        // this event will be overwritten with the new one.  Simultaneous
+        // registration of incompatible events for the same socket 'handle'
+        // will result in undefined behavior.  Return 0 on success and a
+        // non-zero value otherwise.  The behavior is undefined unless
+        // '0 <= handle'.  Note that the registration is submitted to the
+        // kernel by the next call to 'dispatch'.
+
+    void deregisterSocketEvent(const SocketHandle::Handle& handle,
+                               EventType::Type             event);
+        // Deregister from this event manager the callback associated with the
+        // specified 'event' on the specified 'handle' so that said callback
+        // will not be invoked should 'event' occur.
+
+    int deregisterSocket(const SocketHandle::Handle& handle);
+        // Deregister from this event manager all events associated with the
+        // specified socket 'handle'.  Return the number of deregistered
+        // callbacks.
+
+    void deregisterAll();
+        // Deregister from this event manager all events on every socket
+        // handle.
+
+    // ACCESSORS
+    bool hasLimitedSocketCapacity() const;
+        // Return 'true' if this event manager has a limited socket capacity,
+        // and 'false' otherwise.
+
+    int isRegistered(const SocketHandle::Handle& handle,
+                     const EventType::Type       event) const;
+        // Return 1 if the specified 'event' is registered with this event
+        // manager for the specified socket 'handle' and 0 otherwise.
+
+    int numEvents() const;
+        // Return the total number of all socket events currently registered
+        // with this event manager.
+
+    int numSocketEvents(const SocketHandle::Handle& handle) const;
+        // Return the number of socket events currently registered with this
+        // event manager for the specified 'handle'.
+
+    bsls::Types::Int64 numSystemCalls() const;
+        // Return the number of 'io_uring_enter' system calls made by this
+        // event manager.
+};
+
+//-----------------------------------------------------------------------------
+//                      INLINE FUNCTION DEFINITIONS
+//-----------------------------------------------------------------------------
+
+          // ---------------------------------------------
+          // class DefaultEventManager<Platform::IO_URING>
+          // ---------------------------------------------
+
+// ACCESSORS
+inline
+bool DefaultEventManager<Platform::IO_URING>::hasLimitedSocketCapacity() const
+{
+    return false;
+}
+
+inline
+bsls::Types::Int64
+DefaultEventManager<Platform::IO_URING>::numSystemCalls() const
+{
+    return d_numSystemCalls;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif // BSLS_PLATFORM_OS_LINUX
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
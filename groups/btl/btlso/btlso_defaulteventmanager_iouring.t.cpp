@@ -0,0 +1,1766 @@
+// btlso_defaulteventmanager_iouring.t.cpp                            -*-C++-*-
+#include <btlso_defaulteventmanager_iouring.h>
+
+#include <btlso_defaulteventmanager_epoll.h>
+#include <btlso_socketimputil.h>
+#include <btlso_socketoptutil.h>
+#include <btlso_timemetrics.h>
+#include <btlso_eventmanagertester.h>
+#include <btlso_platform.h>
+#include <btlso_flag.h>
+#include <bdlf_bind.h>
+#include <bdlf_memfn.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bdlt_currenttime.h>
+#include <bsls_timeinterval.h>
+#include <bsls_platform.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_c_stdio.h>
+#include <bsl_c_stdlib.h>
+#include <bsl_functional.h>
+#include <bsls_assert.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    #define BTESO_EVENTMANAGER_ENABLETEST
+    typedef btlso::DefaultEventManager<btlso::Platform::IO_URING> Obj;
+#endif
+
+#ifdef BTESO_EVENTMANAGER_ENABLETEST
+
+#include <bsl_c_errno.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <linux/version.h>
+#include <unistd.h>
+
+using namespace bsl;  // automatically added by script
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              OVERVIEW
+// Test the corresponding event manager component by using
+// 'btlso::EventManagerTester' to exercise the "standard" test which applies to
+// any event manager's test.  Since the difference exists in implementation
+// between different event manager components, the "customized" test is also
+// given for this event manager.  The "customized" test is implemented by
+// utilizing the same script grammar and the same script interpreting defined
+// in 'btlso::EventManagerTester' function but a new set of data to test this
+// specific event manager component.
+//-----------------------------------------------------------------------------
+//
+// Test cases are skipped (and succeed) if 'Obj::isSupported()' is 'false'.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 1] bool isSupported();
+//
+// CREATORS
+// [ 2] btlso::DefaultEventManager
+// [ 2] ~btlso::DefaultEventManager
+//
+// MANIPULATORS
+// [ 4] registerSocketEvent
+// [ 5] deregisterSocketEvent
+// [ 6] deregisterSocket
+// [ 9] deregisterSocket
+// [ 7] deregisterAll
+// [ 8] dispatch
+//
+// ACCESSORS
+// [13] hasLimitedSocketCapacity
+// [ 3] numSocketEvents
+// [ 3] numEvents
+// [ 3] isRegistered
+// [12] bsls::Types::Int64 numSystemCalls() const;
+//-----------------------------------------------------------------------------
+// [16] USAGE EXAMPLE
+// [15] CONCERN: Completion queue overflow
+// [14] CONCERN: Memory is allocated from the specified allocator
+// [12] CONCERN: Registration changes are submitted by 'dispatch'
+// [11] CONCERN: Registration changes from callbacks
+// [10] CONCERN: Poll requests replaced before they are dispatched
+// [ 1] Breathing test
+// [-1] 'dispatch' PERFORMANCE DATA
+// [-2] 'registerSocketEvent' PERFORMANCE DATA
+// [-3] REGISTRATION TOGGLING PERFORMANCE DATA (vs 'epoll')
+//=============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+#define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+
+//=============================================================================
+//                  SEMI-STANDARD TEST OUTPUT MACROS
+//-----------------------------------------------------------------------------
+#define P(X) cout << #X " = " << (X) << endl; // Print identifier and value.
+#define Q(X) cout << "<| " #X " |>" << endl;  // Quote identifier literally.
+#define P_(X) cout << #X " = " << (X) << ", "<< flush; // P(X) without '\n'
+#define L_ __LINE__                           // current Line number
+
+//=============================================================================
+//                  STANDARD BDE LOOP-ASSERT TEST MACROS
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT(I,X) { \
+   if (!(X)) { cout << #I << ": " << I << "\n"; aSsErT(1, #X, __LINE__); }}
+
+#define LOOP2_ASSERT(I,J,X) { \
+   if (!(X)) { cout << #I << ": " << I << "\t" << #J << ": " \
+              << J << "\n"; aSsErT(1, #X, __LINE__); } }
+
+#define LOOP3_ASSERT(I,J,K,X) { \
+   if (!(X)) { cout << #I << ": " << I << "\t" << #J << ": " << J << "\t" \
+              << #K << ": " << K << "\n"; aSsErT(1, #X, __LINE__); } }
+
+//=============================================================================
+// The level of verbosity.
+//-----------------------------------------------------------------------------
+static int globalVerbose, globalVeryVerbose, globalVeryVeryVerbose;
+
+//=============================================================================
+// Control byte used to verify reads and writes.
+//-----------------------------------------------------------------------------
+const char control_byte(0x53);
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef btlso::EventManagerTester EventManagerTester;
+
+// Test success and failure codes.
+enum {
+    FAIL    = -1,
+    SUCCESS = 0
+};
+
+enum {
+    MAX_SCRIPT = 50,
+    MAX_PORT   = 50,
+    BUF_LEN    = 8192
+};
+
+//=============================================================================
+//                              HELPER CLASSES
+//-----------------------------------------------------------------------------
+
+void assertCb()
+{
+    BSLS_ASSERT_OPT(0);
+}
+
+static void emptyCb()
+{
+}
+
+static void allocatedArgument(const bsl::string& argument) {
+    (void)argument;
+}
+
+static void multiRegisterDeregisterCb(Obj *mX)
+{
+    btlso::SocketHandle::Handle socket[2];
+    int rc = btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+                                        socket,
+                                        btlso::SocketImpUtil::k_SOCKET_STREAM);
+    ASSERT(0 == rc);
+
+    bsl::function<void()> emptyCallBack(&emptyCb);
+
+    // Register and deregister the socket handle six times.  All registrations
+    // are done by invoking 'registerSocketEvent'.  The deregistrations are
+    // done by invoking 'deregisterSocketEvent' twice, 'deregisterSocket'
+    // twice, and 'deregisterAll' twice.
+
+    ASSERT(0 == mX->registerSocketEvent(socket[0],
+                                        btlso::EventType::e_READ,
+                                        emptyCallBack));
+    mX->deregisterSocketEvent(socket[0], btlso::EventType::e_READ);
+
+    ASSERT(0 == mX->registerSocketEvent(socket[0],
+                                        btlso::EventType::e_READ,
+                                        emptyCallBack));
+    mX->deregisterSocket(socket[0]);
+
+    ASSERT(0 == mX->registerSocketEvent(socket[0],
+                                        btlso::EventType::e_READ,
+                                        emptyCallBack));
+    mX->deregisterAll();
+
+    ASSERT(0 == mX->registerSocketEvent(socket[0],
+                                        btlso::EventType::e_READ,
+                                        emptyCallBack));
+    mX->deregisterSocketEvent(socket[0], btlso::EventType::e_READ);
+
+
+    ASSERT(0 == mX->registerSocketEvent(socket[0],
+                                        btlso::EventType::e_READ,
+                                        emptyCallBack));
+    mX->deregisterSocket(socket[0]);
+
+    ASSERT(0 == mX->registerSocketEvent(socket[0],
+                                        btlso::EventType::e_READ,
+                                        emptyCallBack));
+    mX->deregisterAll();
+}
+
+static void incrementCounter(int *counter)
+{
+    ++*counter;
+}
+
+static void reregisterCb(Obj                         *mX,
+                         btlso::SocketHandle::Handle  handle,
+                         int                         *counter)
+    // Increment the specified 'counter', then deregister and register again
+    // the read event of the specified 'handle' with the specified 'mX', and
+    // register (and deregister) its write event, replacing the poll request
+    // of 'handle' several times.
+{
+    ++*counter;
+
+    btlso::EventManager::Callback cb(bdlf::BindUtil::bind(&reregisterCb,
+                                                          mX,
+                                                          handle,
+                                                          counter));
+
+    mX->deregisterSocketEvent(handle, btlso::EventType::e_READ);
+    ASSERT(0 == mX->registerSocketEvent(handle, btlso::EventType::e_READ, cb));
+    ASSERT(0 == mX->registerSocketEvent(handle,
+                                        btlso::EventType::e_WRITE,
+                                        &emptyCb));
+    mX->deregisterSocketEvent(handle, btlso::EventType::e_WRITE);
+}
+
+namespace TEST_CASE_TOGGLE_PERFORMANCE {
+
+struct Toggler {
+    // This 'struct' implements a ping-pong over a socket pair in which the
+    // writer registers for 'e_WRITE' before every write, and deregisters once
+    // the write is done, in the manner of a channel whose write queue
+    // repeatedly fills and drains.
+
+    btlso::EventManager         *d_manager_p;
+    btlso::SocketHandle::Handle  d_socket[2];
+    int                          d_numRoundTrips;
+
+    void onWritable()
+        // Write a byte to the first socket, and deregister its write event.
+    {
+        char byte = control_byte;
+        ASSERT(1 == write(d_socket[0], &byte, 1));
+        d_manager_p->deregisterSocketEvent(d_socket[0],
+                                           btlso::EventType::e_WRITE);
+    }
+
+    void onReadable()
+        // Read a byte from the second socket and register the write event of
+        // the first socket.
+    {
+        char byte;
+        ASSERT(1 == read(d_socket[1], &byte, 1));
+        ++d_numRoundTrips;
+        d_manager_p->registerSocketEvent(
+                        d_socket[0],
+                        btlso::EventType::e_WRITE,
+                        bdlf::MemFnUtil::memFn(&Toggler::onWritable, this));
+    }
+};
+
+template <class EVENT_MANAGER>
+double runToggler(EVENT_MANAGER *manager, int numRoundTrips)
+    // Run the ping-pong described by 'Toggler' for the specified
+    // 'numRoundTrips' using the specified 'manager', and return the elapsed
+    // time in seconds.
+{
+    Toggler toggler;
+    toggler.d_manager_p     = manager;
+    toggler.d_numRoundTrips = 0;
+
+    int rc = btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+                                        toggler.d_socket,
+                                        btlso::SocketImpUtil::k_SOCKET_STREAM);
+    ASSERT(0 == rc);
+
+    // Register a read event on the first socket too, so that deregistering
+    // its write event leaves it registered.
+
+    manager->registerSocketEvent(toggler.d_socket[0],
+                                 btlso::EventType::e_READ,
+                                 &emptyCb);
+    manager->registerSocketEvent(
+                     toggler.d_socket[1],
+                     btlso::EventType::e_READ,
+                     bdlf::MemFnUtil::memFn(&Toggler::onReadable, &toggler));
+    manager->registerSocketEvent(
+                     toggler.d_socket[0],
+                     btlso::EventType::e_WRITE,
+                     bdlf::MemFnUtil::memFn(&Toggler::onWritable, &toggler));
+
+    bsls::TimeInterval start = bdlt::CurrentTime::now();
+    while (toggler.d_numRoundTrips < numRoundTrips) {
+        manager->dispatch(0);
+    }
+    bsls::TimeInterval elapsed = bdlt::CurrentTime::now() - start;
+
+    manager->deregisterAll();
+    btlso::SocketImpUtil::close(toggler.d_socket[0]);
+    btlso::SocketImpUtil::close(toggler.d_socket[1]);
+
+    return elapsed.totalSecondsAsDouble();
+}
+
+}  // close namespace TEST_CASE_TOGGLE_PERFORMANCE
+
+#endif // BTESO_EVENTMANAGER_ENABLETEST
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+#ifdef BTESO_EVENTMANAGER_ENABLETEST
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;                 globalVerbose = verbose;
+    int veryVerbose = argc > 3;         globalVeryVerbose = veryVerbose;
+    int veryVeryVerbose = argc > 4; globalVeryVeryVerbose = veryVeryVerbose;
+
+    int controlFlag = 0;
+    if (veryVeryVerbose) {
+        controlFlag |= btlso::EventManagerTester::k_VERY_VERY_VERBOSE;
+    }
+    if (veryVerbose) {
+        controlFlag |= btlso::EventManagerTester::k_VERY_VERBOSE;
+    }
+    if (verbose) {
+        controlFlag |= btlso::EventManagerTester::k_VERBOSE;
+    }
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    if (!Obj::isSupported()) {
+        cout << "'io_uring' is not supported: skipping." << endl;
+        return 0;                                                     // RETURN
+    }
+
+    btlso::SocketImpUtil::startup();
+    bslma::TestAllocator testAllocator("test", veryVeryVerbose);
+    testAllocator.setNoAbort(1); // tbd -- really? why?
+    btlso::TimeMetrics timeMetric(btlso::TimeMetrics::e_MIN_NUM_CATEGORIES,
+                                  btlso::TimeMetrics::e_CPU_BOUND,
+                                  &testAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove
+        //   leading comment characters, and replace 'assert' with
+        //   'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Usage Example"
+                          << "\n=====================" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Batching Registration Changes
+///- - - - - - - - - - - - - - - - - - - - -
+// The following snippets of code illustrate how registration changes made
+// between two calls to 'dispatch' are submitted to the kernel together.
+// First, we verify that the running kernel supports this event manager, and
+// create the event manager and a (locally-connected) socket pair:
+//..
+    typedef btlso::DefaultEventManager<btlso::Platform::IO_URING> EventManager;
+
+    if (!EventManager::isSupported()) {
+        break;
+    }
+
+    EventManager mX;  const EventManager& X = mX;
+
+    btlso::SocketHandle::Handle socket[2];
+
+    int rc = btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+                                        socket,
+                                        btlso::SocketImpUtil::k_SOCKET_STREAM);
+    ASSERT(0 == rc);
+//..
+// Then, we register for both ends of the socket pair becoming writable, and
+// for 'socket[0]' becoming readable, without making any system call:
+//..
+    int numInvoked = 0;
+
+    btlso::EventManager::Callback countCb(
+                              bdlf::BindUtil::bind(&incrementCounter,
+                                                   &numInvoked));
+
+    mX.registerSocketEvent(socket[0], btlso::EventType::e_READ,  countCb);
+    mX.registerSocketEvent(socket[0], btlso::EventType::e_WRITE, countCb);
+    mX.registerSocketEvent(socket[1], btlso::EventType::e_WRITE, countCb);
+
+    ASSERT(3 == X.numEvents());
+    ASSERT(0 == X.numSystemCalls());
+//..
+// Now, we dispatch the pending events.  Both sockets are writable, so two
+// callbacks are invoked, and the three registrations were submitted by a
+// single system call:
+//..
+    rc = mX.dispatch(bsls::TimeInterval(bdlt::CurrentTime::now()) + 5, 0);
+    ASSERT(2 == rc);
+    ASSERT(2 == numInvoked);
+    ASSERT(1 == X.numSystemCalls());
+//..
+// Finally, we deregister all the events and close the sockets:
+//..
+    mX.deregisterAll();
+    ASSERT(0 == X.numEvents());
+
+    btlso::SocketImpUtil::close(socket[0]);
+    btlso::SocketImpUtil::close(socket[1]);
+//..
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING COMPLETION QUEUE OVERFLOW
+        //
+        // Concerns:
+        //: 1 Queuing more submissions than the submission queue holds while
+        //:   more completions are pending than the completion queue holds
+        //:   (so that the kernel may refuse submissions with 'EBUSY') neither
+        //:   fails nor loses events.
+        //
+        // Plan:
+        //: 1 Register for reading on more sockets than the completion queue
+        //:   holds, and dispatch so that the poll requests are submitted.
+        //:   Then make every socket readable, register for writing on every
+        //:   socket (which replaces every poll request, queuing more
+        //:   submissions than the submission queue holds), and dispatch
+        //:   until the callbacks of both events have been invoked for every
+        //:   socket.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: Completion queue overflow
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING COMPLETION QUEUE OVERFLOW" << endl
+                          << "=================================" << endl;
+
+        enum {
+            NUM_PAIRS   = 300,  // twice as many sockets as the completion
+                                // queue (twice the ring size) holds entries
+            NUM_SOCKETS = 2 * NUM_PAIRS
+        };
+
+        Obj mX(&timeMetric, &testAllocator);
+
+        bsl::vector<btlso::SocketHandle::Handle> sockets(NUM_SOCKETS);
+        bsl::vector<int>                         numReads(NUM_SOCKETS, 0);
+        bsl::vector<int>                         numWrites(NUM_SOCKETS, 0);
+
+        int rc;
+
+        for (int i = 0; i < NUM_PAIRS; ++i) {
+            rc = btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+                                        &sockets[2 * i],
+                                        btlso::SocketImpUtil::k_SOCKET_STREAM);
+            LOOP2_ASSERT(i, rc, 0 == rc);
+        }
+
+        for (int i = 0; i < NUM_SOCKETS; ++i) {
+            btlso::EventManager::Callback cb(
+                           bdlf::BindUtil::bind(&incrementCounter,
+                                                &numReads[i]));
+            rc = mX.registerSocketEvent(sockets[i],
+                                        btlso::EventType::e_READ,
+                                        cb);
+            LOOP2_ASSERT(i, rc, 0 == rc);
+        }
+
+        rc = mX.dispatch(bdlt::CurrentTime::now() + bsls::TimeInterval(0.1),
+                         0);
+        LOOP_ASSERT(rc, 0 == rc);
+
+        for (int i = 0; i < NUM_SOCKETS; ++i) {
+            const char byte = 'x';
+            rc = btlso::SocketImpUtil::write(sockets[i], &byte, 1);
+            LOOP2_ASSERT(i, rc, 1 == rc);
+        }
+
+        for (int i = 0; i < NUM_SOCKETS; ++i) {
+            btlso::EventManager::Callback cb(
+                           bdlf::BindUtil::bind(&incrementCounter,
+                                                &numWrites[i]));
+            rc = mX.registerSocketEvent(sockets[i],
+                                        btlso::EventType::e_WRITE,
+                                        cb);
+            LOOP2_ASSERT(i, rc, 0 == rc);
+        }
+
+        int numMissing = NUM_SOCKETS;
+        for (int iteration = 0; 0 < numMissing && iteration < 100;
+                                                                 ++iteration) {
+            rc = mX.dispatch(bdlt::CurrentTime::now() +
+                                                bsls::TimeInterval(1.0), 0);
+            LOOP2_ASSERT(iteration, rc, 0 < rc);
+
+            numMissing = 0;
+            for (int i = 0; i < NUM_SOCKETS; ++i) {
+                if (0 == numReads[i] || 0 == numWrites[i]) {
+                    ++numMissing;
+                }
+            }
+            if (veryVerbose) { P_(iteration) P(numMissing) }
+        }
+        LOOP_ASSERT(numMissing, 0 == numMissing);
+
+        mX.deregisterAll();
+        for (int i = 0; i < NUM_SOCKETS; ++i) {
+            btlso::SocketImpUtil::close(sockets[i]);
+        }
+      } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // Test allocator usage
+        //
+        // Concern:
+        //: 1 Registered events hold memory from the specified allocator
+        //
+        // Plan:
+        //: 1 Register an event having a callback functor requiring dynamic
+        //    memory allocation
+        //: 2 Check that no memory is outstanding from the default allocator,
+        //    and that memory is outstanding from the test allocator
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING allocator usage" << endl
+                          << "=======================" << endl;
+
+        Obj mX(0, &testAllocator);
+
+        btlso::SocketHandle::Handle socket[2];
+
+        int rc = btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+                             socket, btlso::SocketImpUtil::k_SOCKET_STREAM);
+        ASSERT(0 == rc);
+
+        {
+            bsl::string argument =
+                "a long string that must be heap-allocated";
+            btlso::EventManager::Callback cb =
+                bdlf::BindUtil::bind(&allocatedArgument, argument);
+
+            if (veryVerbose) cout << "...registering event..." << endl;
+            ASSERT(0 == mX.registerSocketEvent(socket[0],
+                                               btlso::EventType::e_READ,
+                                               cb));
+        }
+
+        ASSERT(0 != testAllocator.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+      } break;
+
+
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING 'hasLimitedSocketCapacity'
+        //
+        // Concern:
+        //: 1 'hasLimitedSocketCapacity' returns 'false'.
+        //
+        // Plan:
+        //: 1 Assert that 'hasLimitedSocketCapacity' returns 'false'.
+        //
+        // Testing:
+        //   bool hasLimitedSocketCapacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'hasLimitedSocketCapacity'" << endl
+                          << "==================================" << endl;
+
+        if (verbose) cout << "Testing 'hasLimitedSocketCapacity'" << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            bool hlsc = X.hasLimitedSocketCapacity();
+            LOOP_ASSERT(hlsc, false == hlsc);
+        }
+      } break;
+
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING BATCHED SUBMISSIONS
+        //
+        // Concerns:
+        //: 1 'numSystemCalls' is 0 on a newly created object.
+        //:
+        //: 2 Registrations, and deregistrations leaving other events
+        //:   registered on the socket, do not make a system call.
+        //:
+        //: 3 'dispatch' submits all the pending registration changes, and
+        //:   waits for events, with a single system call.
+        //:
+        //: 4 Deregistering all the events of a socket cancels its poll
+        //:   request immediately.
+        //
+        // Plan:
+        //: 1 Create an object and verify that 'numSystemCalls' is 0.  (C-1)
+        //:
+        //: 2 Register and deregister events on several sockets, and verify
+        //:   that 'numSystemCalls' is unchanged.  (C-2)
+        //:
+        //: 3 Dispatch events on writable sockets, and verify that
+        //:   'numSystemCalls' increases by 1, and that only the callbacks
+        //:   of the registered events are invoked.  (C-3)
+        //:
+        //: 4 Deregister sockets and verify that 'numSystemCalls' increases
+        //:   by at most 1 per socket.  Then verify that dispatching the
+        //:   remaining events makes at most one system call.  (C-3..4)
+        //
+        // Testing:
+        //   bsls::Types::Int64 numSystemCalls() const;
+        //   CONCERN: Registration changes are submitted by 'dispatch'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BATCHED SUBMISSIONS" << endl
+                          << "===========================" << endl;
+
+        enum { NUM_PAIRS = 8 };
+
+        Obj mX(&timeMetric, &testAllocator);  const Obj& X = mX;
+        ASSERT(0 == X.numSystemCalls());
+
+        btlso::EventManagerTestPair socketPairs[NUM_PAIRS];
+
+        int numInvoked = 0;
+        btlso::EventManager::Callback countCb(
+                                  bdlf::BindUtil::bind(&incrementCounter,
+                                                       &numInvoked));
+
+        for (int i = 0; i < NUM_PAIRS; ++i) {
+            const btlso::SocketHandle::Handle fd = socketPairs[i].observedFd();
+
+            ASSERT(0 == mX.registerSocketEvent(fd,
+                                               btlso::EventType::e_READ,
+                                               countCb));
+            ASSERT(0 == mX.registerSocketEvent(fd,
+                                               btlso::EventType::e_WRITE,
+                                               countCb));
+            if (i % 2) {
+                mX.deregisterSocketEvent(fd, btlso::EventType::e_WRITE);
+            }
+        }
+        LOOP_ASSERT(X.numSystemCalls(), 0 == X.numSystemCalls());
+
+        // Half the sockets are registered for writing; none is readable.
+
+        int rc = mX.dispatch(bdlt::CurrentTime::now() + 5, 0);
+        LOOP_ASSERT(rc, NUM_PAIRS / 2 == rc);
+        LOOP_ASSERT(numInvoked, NUM_PAIRS / 2 == numInvoked);
+        LOOP_ASSERT(X.numSystemCalls(), 1 == X.numSystemCalls());
+
+        // The poll requests re-armed by 'dispatch' are submitted by the next
+        // 'dispatch'.
+
+        rc = mX.dispatch(bdlt::CurrentTime::now() + 5, 0);
+        LOOP_ASSERT(rc, NUM_PAIRS / 2 == rc);
+        LOOP_ASSERT(numInvoked, NUM_PAIRS == numInvoked);
+        LOOP_ASSERT(X.numSystemCalls(), 2 == X.numSystemCalls());
+
+        // Deregistering a socket submits the pending poll requests (and the
+        // cancellation of the request of the socket, unless it completed).
+
+        bsls::Types::Int64 numCalls = X.numSystemCalls();
+
+        for (int i = 0; i < NUM_PAIRS; i += 2) {
+            ASSERT(2 == mX.deregisterSocket(socketPairs[i].observedFd()));
+        }
+        LOOP2_ASSERT(numCalls, X.numSystemCalls(),
+                     numCalls < X.numSystemCalls());
+        LOOP2_ASSERT(numCalls, X.numSystemCalls(),
+                     numCalls + NUM_PAIRS / 2 >= X.numSystemCalls());
+
+        // Only read events remain registered: write to one socket.
+
+        const char controlByte = control_byte;
+        ASSERT(1 == write(socketPairs[1].controlFd(), &controlByte, 1));
+
+        numCalls   = X.numSystemCalls();
+        numInvoked = 0;
+
+        rc = mX.dispatch(bdlt::CurrentTime::now() + 5, 0);
+        LOOP_ASSERT(rc, 1 == rc);
+        LOOP_ASSERT(numInvoked, 1 == numInvoked);
+        LOOP2_ASSERT(numCalls, X.numSystemCalls(),
+                     numCalls + 1 >= X.numSystemCalls());
+
+        mX.deregisterAll();
+        ASSERT(0 == X.numEvents());
+      } break;
+
+      case 11: {
+        // --------------------------------------------------------------------
+        // MULTIPLE REGISTERING AND DEREGISTERING IN CALLBACK
+        //
+        // Concerns:
+        //   Registering and deregistering functions can be called in pairs
+        //   multiple times in a callback function without problem.
+        //
+        // Methodology:
+        //   We register a socket handle to a event manager with a special
+        //   callback function that does extra multiple registering and
+        //   deregistering to the same event manager by invoking the methods
+        //   inteded for testing.  Verify there is no printed error or crash
+        //   ater the callback is executed.
+        //
+        // Testing:
+        //   'registerSocketEvent'   in a callback function
+        //   'deregisterSocketEvent' in a callback function
+        //   'deregisterSocket'      in a callback function
+        //   'deregisterAll'         in a callback function
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+               << "MULTIPLE REGISTERING AND DEREGISTERING IN CALLBACK" << endl
+               << "==================================================" << endl;
+
+        enum { NUM_BYTES = 16 };
+
+        Obj mX;
+
+        btlso::SocketHandle::Handle socket[2];
+
+        int rc = btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+                             socket, btlso::SocketImpUtil::k_SOCKET_STREAM);
+        ASSERT(0 == rc);
+
+        btlso::EventManager::Callback multiRegisterDeregisterCallback(
+                     bdlf::BindUtil::bind(&multiRegisterDeregisterCb, &mX));
+
+        ASSERT(0 == mX.registerSocketEvent(socket[0],
+                                           btlso::EventType::e_READ,
+                                           multiRegisterDeregisterCallback));
+        ASSERT(0 == mX.registerSocketEvent(socket[0],
+                                           btlso::EventType::e_WRITE,
+                                           multiRegisterDeregisterCallback));
+        ASSERT(0 == mX.registerSocketEvent(socket[1],
+                                           btlso::EventType::e_READ,
+                                           multiRegisterDeregisterCallback));
+        ASSERT(0 == mX.registerSocketEvent(socket[1],
+                                           btlso::EventType::e_WRITE,
+                                           multiRegisterDeregisterCallback));
+
+        char wBuffer[NUM_BYTES];
+        memset(wBuffer,'4', NUM_BYTES);
+        rc = btlso::SocketImpUtil::write(socket[0], &wBuffer, NUM_BYTES, 0);
+        ASSERT(0 < rc);
+
+        ASSERT(1 == mX.dispatch(bsls::TimeInterval(1.0), 0));
+
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING REPLACED POLL REQUESTS
+        //
+        // Concerns:
+        //: 1 The completion of a poll request that was replaced (e.g., by
+        //:   registering or deregistering an event of the socket) before it
+        //:   was dispatched does not invoke callbacks.
+        //:
+        //: 2 Replacing poll requests from a callback does not prevent later
+        //:   events from being dispatched.
+        //
+        // Plan:
+        //: 1 Register a read event on readable sockets, dispatch once to let
+        //:   the poll requests complete, then replace their poll requests
+        //:   repeatedly by registering and deregistering write events.
+        //:   Verify that each read callback is invoked once per 'dispatch'.
+        //:   (C-1)
+        //:
+        //: 2 Register a read callback that deregisters and re-registers its
+        //:   events, and verify that it is invoked by each of several calls
+        //:   to 'dispatch'.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: Poll requests replaced before they are dispatched
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING REPLACED POLL REQUESTS" << endl
+                          << "==============================" << endl;
+
+        enum { NUM_PAIRS = 4, NUM_ITERATIONS = 10 };
+
+        const char controlByte = control_byte;
+
+        if (verbose) cout << "\tReplacing requests between dispatches."
+                          << endl;
+        {
+            Obj mX(&timeMetric, &testAllocator);
+
+            btlso::EventManagerTestPair socketPairs[NUM_PAIRS];
+
+            int numInvoked = 0;
+            btlso::EventManager::Callback countCb(
+                                  bdlf::BindUtil::bind(&incrementCounter,
+                                                       &numInvoked));
+
+            for (int i = 0; i < NUM_PAIRS; ++i) {
+                ASSERT(1 == write(socketPairs[i].controlFd(),
+                                  &controlByte,
+                                  1));
+                ASSERT(0 == mX.registerSocketEvent(
+                                                   socketPairs[i].observedFd(),
+                                                   btlso::EventType::e_READ,
+                                                   countCb));
+            }
+
+            for (int j = 0; j < NUM_ITERATIONS; ++j) {
+                // Give the kernel time to complete the pending requests.
+
+                bsls::TimeInterval deadline = bdlt::CurrentTime::now();
+                deadline.addMilliseconds(10);
+
+                numInvoked = 0;
+                int rc = mX.dispatch(deadline, 0);
+                LOOP2_ASSERT(j, rc, NUM_PAIRS == rc);
+                LOOP2_ASSERT(j, numInvoked, NUM_PAIRS == numInvoked);
+
+                for (int i = 0; i < NUM_PAIRS; ++i) {
+                    const btlso::SocketHandle::Handle fd =
+                                                   socketPairs[i].observedFd();
+
+                    ASSERT(0 == mX.registerSocketEvent(
+                                                    fd,
+                                                    btlso::EventType::e_WRITE,
+                                                    &emptyCb));
+                    mX.deregisterSocketEvent(fd, btlso::EventType::e_WRITE);
+                }
+            }
+        }
+
+        if (verbose) cout << "\tReplacing requests from callbacks." << endl;
+        {
+            Obj mX(&timeMetric, &testAllocator);
+
+            btlso::EventManagerTestPair socketPairs[NUM_PAIRS];
+
+            int numInvoked = 0;
+            for (int i = 0; i < NUM_PAIRS; ++i) {
+                const btlso::SocketHandle::Handle fd =
+                                                   socketPairs[i].observedFd();
+
+                ASSERT(1 == write(socketPairs[i].controlFd(),
+                                  &controlByte,
+                                  1));
+                ASSERT(0 == mX.registerSocketEvent(
+                                  fd,
+                                  btlso::EventType::e_READ,
+                                  bdlf::BindUtil::bind(&reregisterCb,
+                                                       &mX,
+                                                       fd,
+                                                       &numInvoked)));
+            }
+
+            for (int j = 0; j < NUM_ITERATIONS; ++j) {
+                numInvoked = 0;
+
+                int numDispatched = 0;
+                while (numDispatched < NUM_PAIRS) {
+                    int rc = mX.dispatch(bdlt::CurrentTime::now() + 5, 0);
+                    LOOP2_ASSERT(j, rc, 0 < rc);
+                    if (0 >= rc) {
+                        break;
+                    }
+                    numDispatched += rc;
+                }
+                LOOP2_ASSERT(j, numInvoked, NUM_PAIRS == numInvoked);
+            }
+            ASSERT(NUM_PAIRS == mX.numEvents());
+        }
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING 'deregisterSocket' METHOD
+        //
+        // Concern:
+        //   o  Deregistration from a callback of the same socket is handled
+        //      correctly
+        //   o  Deregistration from a callback of another socket  is handled
+        //      correctly
+        //   o  Deregistration from a callback of one of the _previous_
+        //      sockets and subsequent registration is handled correctly -
+        //
+        // Plan:
+        //   Create custom set of scripts for each concern and exercise them
+        //   using 'btlso::EventManagerTester'.
+        //
+        // Testing:
+        //   int deregisterSocket();
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl << "TESTING 'deregisterSocket'" << endl
+                                  << "==========================" << endl;
+        if (verbose)
+            cout << "\tAddressing concern# 1" << endl;
+        {
+            struct {
+                int         d_line;
+                int         d_fails;  // number of failures in this script
+                const char *d_script;
+            } SCRIPTS[] =
+            {
+//-------------->
+{ L_, 0,  "+0r64,{-0}; W0,64; T1; Dn,1; T0"                              },
+{ L_, 0,  "+0r64,{-0}; +1r64; W0,64;  W1,64; T2; Dn,2; T1; E1r; E0"      },
+{ L_, 0,  "+0r64,{-0}; +1r64; +2r64; W0,64;  W1,64; W2,64; T3; Dn,3; T2;"
+          "E0; E1r; E2r"                                                 },
+{ L_, 0,  "+0r64; +1r64,{-1}; +2r64; W0,64;  W1,64; W2,64; T3; Dn,3; T2"
+          "E0r; E1; E2r"                                                 },
+{ L_, 0,  "+0r64; +1r64; +2r64,{-2}; W0,64;  W1,64; W2,64; T3; Dn,3; T2"
+          "E0r; E1r; E2"                                                 },
+{ L_, 0,  "+0r64,{-1; +1r64}; +1r64; W0,64; W1,64; T2; Dn,2; T2"         },
+//-------------->
+            };
+            const int NUM_SCRIPTS = sizeof SCRIPTS / sizeof *SCRIPTS;
+
+            for (int i = 0; i < NUM_SCRIPTS; ++i) {
+
+                Obj mX(&timeMetric, &testAllocator);
+                const int LINE =  SCRIPTS[i].d_line;
+
+                enum { NUM_PAIRS = 4 };
+                btlso::EventManagerTestPair socketPairs[NUM_PAIRS];
+
+                for (int j = 0; j < NUM_PAIRS; j++) {
+                    socketPairs[j].setObservedBufferOptions(BUF_LEN, 1);
+                    socketPairs[j].setControlBufferOptions(BUF_LEN, 1);
+                }
+
+                int fails = btlso::EventManagerTester::gg(&mX,
+                                                          socketPairs,
+                                                          SCRIPTS[i].d_script,
+                                                          controlFlag);
+
+                LOOP_ASSERT(LINE, SCRIPTS[i].d_fails == fails);
+            }
+        }
+        if (verbose)
+            cout << "\tAddressing concern# 2" << endl;
+        {
+            struct {
+                int         d_line;
+                int         d_fails;  // number of failures in this script
+                const char *d_script;
+            } SCRIPTS[] =
+            {
+//-------------->
+/// On length 2
+// Deregistering signaled socket handle
+{ L_, 0,  "+0r64,{-1}; +1r64,{-0}; W0,64;  W1,64; T2; Dn,1; T1"         },
+{ L_, 0,  "+0r64,{-1}; +1r64,{-0}; W1,64;  W0,64; T2; Dn,1; T1"         },
+// Deregistering non-signaled socket handle
+{ L_, 0,  "+0r64, {-1}; +1r; W0,64; T2; Dn,1; T1; E0r; E1"              },
+{ L_, 0,  "+0r; +1r64, {-0}; W1,64; T2; Dn,1; T1; E0;  E1r"             },
+
+#if defined(LINUX_VERSION_CODE) && LINUX_VERSION_CODE > KERNEL_VERSION(2,6,9)
+    // Linux 2.6.9 does not seem to guarantee the order of fds, while
+    // later versions do.  So we'll run this only if compiled on 2.6.10 and
+    // later.
+
+#if 0
+    // Actually, it turns out 2.6.18 doesn't seem to guarantee the order either
+    // so these broke again.
+
+/// On length 3
+// Deregistering signaled socket handle.  Registering 'r'/'w' without number of
+// bytes registers number of bytes as '-1' which will fail when 'Dn' is called,
+// unless the event is deregistered before it happens.
+{ L_, 0,  "+0r64,{-1}; +1r; +2r64; W0,64; W1,64; W2,64; T3; Dn,2; T2;"
+          "E0r; E1; E2r"                                                },
+
+{ L_, 0,  "+0r64,{-2}; +1r64; +2r; W0,64; W1,64; W2,64; T3; Dn,2; T2;"
+          "E0r; E1r; E2"                                                },
+
+{ L_, 0,  "+0r64; +1r64,{-0}; +2r64; W0,64; W1,64; W2,64; T3; Dn,3; T2;"
+          "E0; E1r; E2r"                                                },
+
+{ L_, 0,  "+0r64; +1r64, {-2}; +2r; W0,64; W1,64; W2,64; T3; Dn,2; T2;"
+          "E0r; E1r; E2"                                                },
+#endif
+#endif
+// Deregistering non-signaled socket handle
+
+//-------------->
+            };
+            const int NUM_SCRIPTS = sizeof SCRIPTS / sizeof *SCRIPTS;
+
+            for (int i = 0; i < NUM_SCRIPTS; ++i) {
+
+                Obj mX(&timeMetric, &testAllocator);
+                const int LINE =  SCRIPTS[i].d_line;
+
+                enum { NUM_PAIRS = 4 };
+                btlso::EventManagerTestPair socketPairs[NUM_PAIRS];
+
+                for (int j = 0; j < NUM_PAIRS; j++) {
+                    socketPairs[j].setObservedBufferOptions(BUF_LEN, 1);
+                    socketPairs[j].setControlBufferOptions(BUF_LEN, 1);
+                }
+
+                int fails = btlso::EventManagerTester::gg(&mX,
+                                                          socketPairs,
+                                                          SCRIPTS[i].d_script,
+                                                          controlFlag);
+
+                LOOP_ASSERT(LINE, SCRIPTS[i].d_fails == fails);
+            }
+        }
+      } break;
+
+      case 8: {
+        // ------i-------------------------------------------------------------
+        // TESTING 'dispatch' METHOD
+        //   The goal is to ensure that 'dispatch' invokes the callback
+        //   method for the write socket handle and event, for all possible
+        //   events.
+        //
+        // Plan:
+        // Standard test:
+        //   Create an object of the event manager under test, call the
+        //   corresponding test function of 'btlso::EventManagerTester', where
+        //   multiple socket pairs are created to test the dispatch() in
+        //   this event manager.
+        // Customized test:
+        //   Create an object of the event manager under test and a list
+        //   of test scripts based on the script grammar defined in
+        //   'btlso::EventManagerTester', call the script interpreting function
+        //   gg() of 'btlso::EventManagerTester' to execute the test data.
+        // Exhausting test:
+        //   Test the "timeout" from the dispatch() with the loop-driven
+        //   implementation where timeout value are generated during each
+        //   iteration and invoke the dispatch() with it.
+        // Testing:
+        //   int dispatch();
+        //   int dispatch(const bsls::TimeInterval&, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'dispatch'" << endl
+                                  << "==================" << endl;
+
+        if (verbose)
+            cout << "\tStandard test for 'dispatch'" << endl;
+        {
+            Obj mX(&timeMetric, &testAllocator);
+            int notFailed = !btlso::EventManagerTester::testDispatch(
+                                                                  &mX,
+                                                                  controlFlag);
+            ASSERT("BLACK-BOX (standard) TEST FAILED" && notFailed);
+        }
+
+        if (verbose)
+            cout << "\tCustom test for 'dispatch'" << endl;
+        {
+            struct {
+                int         d_line;
+                int         d_fails;  // number of failures in this script
+                const char *d_script;
+            } SCRIPTS[] =
+            {
+                {L_, 0, "Dn0,0"                                              },
+                {L_, 0, "Dn100,0"                                            },
+                {L_, 0, "+0w2; Dn,1"                                         },
+                {L_, 0, "+0w40; +0r3; Dn0,1; W0,30;  Dn0,2"                  },
+                {L_, 0, "+0w40; +0r3; Dn100,1; W0,30; Dn120,2"               },
+                {L_, 0, "+0w20; +0r12; Dn,1; W0,30; +1w6; +2w8; Dn,4"        },
+                {L_, 0, "+0w40; +1r6; +1w41; +2w42; +3w43; +0r12; W3,30;"
+                        "Dn,4; W0,30; +1r6; W1,30; +2r8; W2,30; +3r10; Dn,8" },
+                {L_, 0, "+2r3; Dn100,0; +2w40; Dn50,1;  W2,30; Dn55,2"       },
+                {L_, 0, "+0w20; +0r12; Dn0,1; W0,30; +1w6; +2w8; Dn100,4"    },
+                {L_, 0, "+0w40; +1r6; +1w41; +2w42; +3w43; +0r12; Dn100,4;"
+                        "W0,60; W1,70; +1r6; W2,60; W3,60; +2r8; +3r10;"
+                        "Dn120,8"                                            },
+            };
+            const int NUM_SCRIPTS = sizeof SCRIPTS / sizeof *SCRIPTS;
+
+            for (int i = 0; i < NUM_SCRIPTS; ++i) {
+
+                Obj mX(&timeMetric, &testAllocator);
+                const int LINE =  SCRIPTS[i].d_line;
+
+                btlso::EventManagerTestPair socketPairs[4];
+
+                const int NUM_PAIR = sizeof socketPairs /sizeof socketPairs[0];
+
+                for (int j = 0; j < NUM_PAIR; j++) {
+                    socketPairs[j].setObservedBufferOptions(BUF_LEN, 1);
+                    socketPairs[j].setControlBufferOptions(BUF_LEN, 1);
+                }
+
+                int fails = btlso::EventManagerTester::gg(&mX,
+                                                          socketPairs,
+                                                          SCRIPTS[i].d_script,
+                                                          controlFlag);
+
+                LOOP_ASSERT(LINE, SCRIPTS[i].d_fails == fails);
+
+                if (veryVerbose) {
+                    P_(LINE);   P(fails);
+                }
+            }
+        }
+        if (verbose)
+            cout << "\tVerifying behavior on timeout (no sockets)." << endl;
+        {
+            const int NUM_ATTEMPTS = 50;
+            for (int i = 0; i < NUM_ATTEMPTS; ++i) {
+                Obj mX(&timeMetric, &testAllocator);
+                bsls::TimeInterval deadline = bdlt::CurrentTime::now();
+
+                deadline.addMilliseconds(i % 10);
+                deadline.addNanoseconds(i % 1000);
+
+                LOOP_ASSERT(i, 0 == mX.dispatch(
+                                              deadline,
+                                              btlso::Flag::k_ASYNC_INTERRUPT));
+
+                bsls::TimeInterval now = bdlt::CurrentTime::now();
+                LOOP_ASSERT(i, deadline <= now);
+
+                if (veryVeryVerbose) {
+                    P_(deadline); P(now);
+                }
+            }
+        }
+        if (verbose)
+            cout << "\tVerifying behavior on timeout (at least one socket)."
+                 << endl;
+        {
+            btlso::EventManagerTestPair socketPair;
+            bsl::function<void()>  nullFunctor;
+
+            const int NUM_ATTEMPTS = 50;
+            for (int i = 0; i < NUM_ATTEMPTS; ++i) {
+                Obj mX(&timeMetric, &testAllocator);
+                mX.registerSocketEvent(socketPair.observedFd(),
+                                       btlso::EventType::e_READ,
+                                       nullFunctor);
+
+                bsls::TimeInterval deadline = bdlt::CurrentTime::now();
+
+                deadline.addMilliseconds(i % 10);
+                deadline.addNanoseconds(i % 1000);
+
+                LOOP_ASSERT(i, 0 ==
+                        mX.dispatch(deadline, btlso::Flag::k_ASYNC_INTERRUPT));
+
+                bsls::TimeInterval now = bdlt::CurrentTime::now();
+                LOOP3_ASSERT(deadline, now, i, deadline <= now);
+
+                if (veryVeryVerbose) {
+                    P_(deadline); P(now);
+                }
+            }
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'deregisterAll' METHODS
+        //   It must be verified that the application of 'deregisterAll'
+        //   from any state returns the event manager.
+        //
+        // Plan:
+        // Standard test:
+        //   Create an object of the event manager under test, call the
+        //   corresponding test function of 'btlso::EventManagerTester', where
+        //   multiple socket pairs are created to test the deregisterAll() in
+        //   this event manager.
+        // Customized test:
+        //   No customized test since no difference in implementation
+        //   between all event managers.
+        // Testing:
+        //   void deregisterAll();
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl << "TESTING 'deregisterAll'" << endl
+                                  << "=======================" << endl;
+        if (verbose)
+            cout << "Standard test for 'deregisterAll'" << endl
+                 << "=================================" << endl;
+        {
+            Obj mX(&timeMetric, &testAllocator);
+            int fails = EventManagerTester::testDeregisterAll(&mX,
+                                                              controlFlag);
+            ASSERT(0 == fails);
+        }
+
+      } break;
+
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'deregisterSocket' METHOD
+        //   All possible transitions from other state to 0 must be
+        //   exhaustively tested.
+        //
+        // Plan:
+        // Standard test:
+        //   Create an object of the event manager under test, call the
+        //   corresponding test function of 'btlso::EventManagerTester', where
+        //   multiple socket pairs are created to test the deregisterSocket()
+        //   in this event manager.
+        // Customized test:
+        //   Create a socket, register and then unregister more than the system
+        //   limit for open files and then try to dispatch.  This will make
+        //   sure that the internal poll request state is consistent with the
+        //   number of open files.
+        // Testing:
+        //   int deregisterSocket();
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl << "TESTING 'deregisterSocket'" << endl
+                                  << "==========================" << endl;
+        {
+            Obj mX(&timeMetric, &testAllocator);
+
+            int fails = EventManagerTester::testDeregisterSocket(&mX,
+                                                                 controlFlag);
+            ASSERT(0 == fails);
+        }
+        {
+            enum { NUM_DEREGISTERS = 70000 };
+            Obj mX;
+
+            bsl::function<void()> cb(&assertCb);
+
+            for (int i = 0; i < NUM_DEREGISTERS; ++i) {
+                int fd = socket(PF_INET, SOCK_STREAM, 0);
+                BSLS_ASSERT_OPT(fd != -1);
+                mX.registerSocketEvent(fd, btlso::EventType::e_READ, cb);
+                mX.deregisterSocket(fd);
+                close(fd);
+            }
+            btlso::EventManagerTestPair socketPair;
+            mX.registerSocketEvent(socketPair.controlFd(),
+                                   btlso::EventType::e_READ, cb);
+            bsls::TimeInterval timeout = bdlt::CurrentTime::now();
+            timeout.addMilliseconds(200);
+            ASSERT(0 == mX.dispatch(timeout, 0));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'deregisterSocketEvent' METHOD
+        //   All possible deregistration transitions must be exhaustively
+        //   tested.
+        //
+        // Plan:
+        // Standard test:
+        //   Create an object of the event manager under test, call the
+        //   corresponding test function of 'btlso::EventManagerTester', where
+        //   multiple socket pairs are created to test the
+        //   deregisterSocketEvent() in this event manager.
+        // Customized test:
+        //   Create a socket, register and then unregister more than the system
+        //   limit for open files and then try to dispatch.  This will make
+        //   sure that the internal poll request state is consistent with the
+        //   number of open files.
+        // Testing:
+        //   void deregisterSocketEvent();
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl << "TESTING 'deregisterSocketEvent'" << endl
+                                  << "===============================" << endl;
+        if (verbose)
+            cout << "Standard test for 'deregisterSocketEvent'" << endl
+                 << "=========================================" << endl;
+        {
+            Obj mX(&timeMetric, &testAllocator);
+
+            int fails = EventManagerTester::testDeregisterSocketEvent(
+                                                                  &mX,
+                                                                  controlFlag);
+            ASSERT(0 == fails);
+        }
+
+        if (verbose)
+            cout << "Customized test for 'deregisterSocketEvent'" << endl
+                 << "===========================================" << endl;
+        {
+            struct {
+                int         d_line;
+                int         d_fails;  // number of failures in this script
+                const char *d_script;
+            } SCRIPTS[] =
+            {
+               {L_, 0, "+0w; -0w; T0"          },
+               {L_, 0, "+0w; +0r; -0w; E0r; T1"},
+               {L_, 0, "+0w; +1r; -0w; E1r; T1"},
+               {L_, 0, "+0w; +1r; -1r; E0w; T1"},
+            };
+            const int NUM_SCRIPTS = sizeof SCRIPTS / sizeof *SCRIPTS;
+
+            for (int i = 0; i < NUM_SCRIPTS; ++i) {
+
+                Obj mX(&timeMetric, &testAllocator);
+                const int LINE =  SCRIPTS[i].d_line;
+
+                btlso::EventManagerTestPair socketPairs[4];
+
+                const int NUM_PAIR = sizeof socketPairs /sizeof socketPairs[0];
+
+                for (int j = 0; j < NUM_PAIR; j++) {
+                    socketPairs[j].setObservedBufferOptions(BUF_LEN, 1);
+                    socketPairs[j].setControlBufferOptions(BUF_LEN, 1);
+                }
+                int fails = btlso::EventManagerTester::gg(&mX,
+                                                          socketPairs,
+                                                          SCRIPTS[i].d_script,
+                                                          controlFlag);
+
+                LOOP_ASSERT(LINE, SCRIPTS[i].d_fails == fails);
+
+                if (veryVerbose) {
+                    P_(LINE);   P(fails);
+                }
+            }
+        }
+        {
+            enum { NUM_DEREGISTERS = 70000 };
+            Obj mX;
+
+            bsl::function<void()> cb(&assertCb);
+
+            for (int i = 0; i < NUM_DEREGISTERS; ++i) {
+                int fd = socket(PF_INET, SOCK_STREAM, 0);
+                BSLS_ASSERT_OPT(fd != -1);
+                mX.registerSocketEvent(fd, btlso::EventType::e_READ, cb);
+                mX.deregisterSocketEvent(fd, btlso::EventType::e_READ);
+                close(fd);
+            }
+            btlso::EventManagerTestPair socketPair;
+            mX.registerSocketEvent(socketPair.observedFd(),
+                                   btlso::EventType::e_READ, cb);
+            bsls::TimeInterval timeout = bdlt::CurrentTime::now();
+            timeout.addMilliseconds(200);
+            ASSERT(0 == mX.dispatch(timeout, 0));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'registerSocketEvent' METHOD
+        //   The main concern about this function is to ensure full coverage
+        //   of the every legal event combination that can be registered for
+        //   one and two sockets.
+        //
+        // Plan:
+        // Standard test:
+        //   Create an object of the event manager under test, call the
+        //   corresponding function of 'btlso::EventManagerTester', where a
+        //   number of socket pairs are created to test the
+        //   registerSocketEvent() in this event manager.
+        // Customized test:
+        //   Create an object of the event manager under test and a list
+        //   of test scripts based on the script grammar defined in
+        //   'btlso::EventManagerTester', call the script interpreting function
+        //   gg() of 'btlso::EventManagerTester' to execute the test data.
+        // Testing:
+        //   void registerSocketEvent();
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl << "TESTING 'registerSocketEvent'" << endl
+                                  << "=============================" << endl;
+        if (verbose)
+            cout << "Standard test for 'registerSocketEvent'" << endl
+                 << "=======================================" << endl;
+        {
+            Obj mX(&timeMetric, &testAllocator);
+            int fails = EventManagerTester::testRegisterSocketEvent(
+                                                                  &mX,
+                                                                  controlFlag);
+            ASSERT(0 == fails);
+
+            if (verbose) {
+                P(timeMetric.percentage(btlso::TimeMetrics::e_CPU_BOUND));
+            }
+            ASSERT(100 == timeMetric.percentage(
+                                             btlso::TimeMetrics::e_CPU_BOUND));
+        }
+
+        if (verbose)
+            cout << "Customized test for 'registerSocketEvent'" << endl
+                 << "=========================================" << endl;
+        {
+            struct {
+                int         d_line;
+                int         d_fails;  // number of failures in this script
+                const char *d_script;
+            } SCRIPTS[] =
+            {
+               {L_, 0, "+0w; E0w; T1"                      },
+               {L_, 0, "+0r; E0r; T1"                      },
+               {L_, 0, "+0w; +0w; E0w; T1"                 },
+               {L_, 0, "+0r; +0r; E0r; T1"                 },
+               {L_, 0, "+0w; +0w; +0r; +0r; E0rw; T2"      },
+               {L_, 0, "+0w; +1r; E0w; E1r; T2"            },
+               {L_, 0, "+0w; +1r; +1w; +0r; E0rw; E1rw; T4"},
+            };
+            const int NUM_SCRIPTS = sizeof SCRIPTS / sizeof *SCRIPTS;
+
+            for (int i = 0; i < NUM_SCRIPTS; ++i) {
+
+                Obj mX(&timeMetric, &testAllocator);
+                const int LINE =  SCRIPTS[i].d_line;
+
+                btlso::EventManagerTestPair socketPairs[4];
+
+                const int NUM_PAIR =
+                               sizeof socketPairs / sizeof socketPairs[0];
+
+                for (int j = 0; j < NUM_PAIR; j++) {
+                    socketPairs[j].setObservedBufferOptions(BUF_LEN, 1);
+                    socketPairs[j].setControlBufferOptions(BUF_LEN, 1);
+                }
+                int fails = btlso::EventManagerTester::gg(&mX,
+                                                          socketPairs,
+                                                          SCRIPTS[i].d_script,
+                                                          controlFlag);
+
+                LOOP_ASSERT(LINE, SCRIPTS[i].d_fails == fails);
+
+                if (veryVerbose) {
+                    P_(LINE);   P(fails);
+                }
+            }
+            if (verbose) {
+                P(timeMetric.percentage(btlso::TimeMetrics::e_CPU_BOUND));
+            }
+            ASSERT(100 == timeMetric.percentage(
+                                             btlso::TimeMetrics::e_CPU_BOUND));
+        }
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING ACCESSORS
+        //   The main concern about this function is to ensure full coverage
+        //   of the every legal event combination that can be registered for
+        //   one and two sockets.
+        //
+        // Plan:
+        // Standard test:
+        //   Create an object of the event manager under test, call the
+        //   corresponding function of 'btlso::EventManagerTester', where a
+        //   number of socket pairs are created to test the accessors in
+        //   this event manager.
+        // Customized test:
+        //   No customized test since no difference in implementation
+        //   between all event managers.
+        // Testing:
+        //   int isRegistered();
+        //   int numEvents() const;
+        //   int numSocketEvents();
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl << "TESTING ACCESSORS" << endl
+                                  << "=================" << endl;
+
+        if (verbose) cout << "\tOn a non-metered object" << endl;
+        {
+
+            Obj mX((btlso::TimeMetrics*)0, &testAllocator);
+
+            int fails = EventManagerTester::testAccessors(&mX, controlFlag);
+            ASSERT(0 == fails);
+        }
+        if (verbose) cout << "\tOn a metered object" << endl;
+        {
+
+            Obj mX(&timeMetric, &testAllocator);
+            int fails = EventManagerTester::testAccessors(&mX, controlFlag);
+            ASSERT(0 == fails);
+            if (verbose) {
+                P(timeMetric.percentage(btlso::TimeMetrics::e_CPU_BOUND));
+            }
+            ASSERT(100 == timeMetric.percentage(
+                                             btlso::TimeMetrics::e_CPU_BOUND));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATORS
+        //
+        // Plan:
+        // Standard test:
+        //   Create objects of the event manager under test and a list
+        //   of test scripts based on the script grammar defined in
+        //   'btlso::EventManagerTester', call the script interpreting function
+        //   gg() of 'btlso::EventManagerTester' to execute the test data.
+        // Testing:
+        //   btlso::DefaultEventManager();
+        //   ~btlso::DefaultEventManager();
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl << "TESTING PRIMARY MANIPULATORS" << endl
+                                  << "============================" << endl;
+        {
+            Obj mX[2];
+            const int NUM_OBJ = sizeof mX / sizeof mX[0];
+            for (int k = 0; k < NUM_OBJ; k++) {
+                 struct {
+                     int         d_line;
+                     int         d_fails;  // failures in this script
+                     const char *d_script;
+                } SCRIPTS[] =
+                {
+         //------------------>
+         { L_, 0, "+0r; E0r; T1; -0r; E0; T0"                               },
+         { L_, 0, "+0w; E0w; T1; -0w; E0; T0"                               },
+         { L_, 0, "+0w; +0w; E0w; T1; -0w; E0; T0"                          },
+         { L_, 0, "+0r; +0r; E0r; T1; -0r; E0; T0"                          },
+         { L_, 0, "+0r; +0w; E0rw; T2; -0r; -0w; E0; T0"                    },
+         { L_, 0, "+0r; +1r; E0r; E1r; T2; -0r; -1r; E0; E1; T0"            },
+         { L_, 0, "+0r; +1r; +1w; E0r; E1wr; T3; -0r; -1r; -1w; E0; E1; T0" },
+         { L_, 0, "+0r; +1r; +1w; +0w E0rw; E1wr; T4"                       },
+         //------------------>
+                };
+                const int NUM_SCRIPTS = sizeof SCRIPTS / sizeof *SCRIPTS;
+
+                for (int i = 0; i < NUM_SCRIPTS; ++i) {
+
+                    const int LINE =  SCRIPTS[i].d_line;
+                    enum { NUM_PAIRS = 4 };
+
+                    btlso::EventManagerTestPair socketPairs[NUM_PAIRS];
+
+                    for (int j = 0; j < NUM_PAIRS; j++) {
+                        socketPairs[i].setObservedBufferOptions(BUF_LEN, 1);
+                        socketPairs[i].setControlBufferOptions(BUF_LEN, 1);
+                    }
+
+                    int fails = EventManagerTester::gg(&mX[k],
+                                                       socketPairs,
+                                                       SCRIPTS[i].d_script,
+                                                       controlFlag);
+
+                    LOOP_ASSERT(LINE, SCRIPTS[i].d_fails == fails);
+
+                    if (veryVerbose) {
+                        P_(LINE);   P(fails);
+                    }
+                }
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   Ensure the basic liveness of an event manager instance.
+        //
+        // Testing:
+        //   Create an object of this event manager under test.  Perform
+        //   some basic operations on it.
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+        {
+            ASSERT(Obj::isSupported());
+            struct {
+                int         d_line;
+                int         d_fails;  // number of failures in this script
+                const char *d_script;
+            } SCRIPTS[] =
+            {
+               {L_, 0, "Dn0,0"                                            },
+               {L_, 0, "Dn100,0"                                          },
+               {L_, 0, "+0w2; Dn,1"                                       },
+               {L_, 0, "+0w40; +0r3; Dn0,1; W0,40; Dn0,2"                 },
+               {L_, 0, "+0w40; +0r3; Dn100,1; W0,40; Dn120,2"             },
+               {L_, 0, "+0w20; +0r12; Dn,1; W0,30; +1w6; +2w8; Dn,4"      },
+               {L_, 0, "+0w40; +1r6; +1w41; +2w42; +3w43; +0r12;"
+                        "Dn,4; W0,40; +1r6; W1,40; W2,40; W3,40; +2r8;"
+                        "+3r10; Dn,8"                                     },
+               {L_, 0, "+2r3; Dn100,0; +2w40; Dn50,1; W2,40; Dn55,2"      },
+               {L_, 0, "+0w20; +0r12; Dn0,1; +1w6; +2w8; W0,40; Dn100,4"  },
+               {L_, 0, "+0w40; +1r6; +1w41; +2w42; +3w43; +0r12;"
+                       "Dn100,4; W0,40; W1,40; W2,40; W3,40; +1r6; +2r8;"
+                       "+3r10; Dn120,8"                                   },
+            };
+            const int NUM_SCRIPTS = sizeof SCRIPTS / sizeof *SCRIPTS;
+
+            for (int i = 0; i < NUM_SCRIPTS; ++i) {
+
+                Obj mX((btlso::TimeMetrics*)0, &testAllocator);
+                const int LINE =  SCRIPTS[i].d_line;
+
+                enum { NUM_PAIRS  = 4 };
+                btlso::EventManagerTestPair socketPairs[NUM_PAIRS];
+
+                for (int j = 0; j < NUM_PAIRS; j++) {
+                    socketPairs[j].setObservedBufferOptions(BUF_LEN, 1);
+                    socketPairs[j].setControlBufferOptions(BUF_LEN, 1);
+                }
+
+                int fails = EventManagerTester::gg(&mX,
+                                                   socketPairs,
+                                                   SCRIPTS[i].d_script,
+                                                   controlFlag);
+
+                LOOP_ASSERT(LINE, SCRIPTS[i].d_fails == fails);
+
+                if (veryVerbose) {
+                    P_(LINE);   P(fails);
+                }
+            }
+        }
+      } break;
+
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TESTING 'dispatch'
+        //   Get the performance data.
+        //
+        // Plan:
+        //   Set up a collection of socketPairs and register one end of all the
+        //   pairs with the event manager.  Write 1 byte to
+        //   'fracBusy * numSocketPairs' of the connections, and measure the
+        //   average time taken to dispatch a read event for a given number of
+        //   registered read event.  If 'timeOut > 0' register a timeout
+        //   interval with the 'dispatch' call.  If 'R|N' is 'R', actually read
+        //   the bytes in the dispatch, if it's 'N', just call a null function
+        //   within the dispatch.
+        //
+        // Testing:
+        //   'dispatch' capacity
+        //
+        // See the compilation of results for all event managers & platforms
+        // at the beginning of 'btlso_eventmanagertester.t.cpp'.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE TESTING 'dispatch'\n"
+                             "==============================\n";
+
+        {
+            Obj mX(&timeMetric, &testAllocator);
+            btlso::EventManagerTester::testDispatchPerformance(&mX,
+                                                               "io_uring",
+                                                               controlFlag);
+        }
+      } break;
+
+      case -2: {
+        // --------------------------------------------------------------------
+        // TESTING PERFORMANCE 'registerSocketEvent' METHOD
+        //   Get performance data.
+        //
+        // Plan:
+        //   Open multiple sockets and register a read event for each
+        //   socket, calculate the average time taken to register a read
+        //   event for a given number of registered read event.
+        //
+        // Testing:
+        //   Obj::registerSocketEvent
+        //
+        // See the compilation of results for all event managers & platforms
+        // at the beginning of 'btlso_eventmanagertester.t.cpp'.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE TESTING 'registerSocketEvent'\n"
+                             "=========================================\n";
+
+        Obj mX(&timeMetric, &testAllocator);
+        btlso::EventManagerTester::testRegisterPerformance(&mX, controlFlag);
+      } break;
+
+      case -3: {
+        // --------------------------------------------------------------------
+        // REGISTRATION TOGGLING PERFORMANCE DATA
+        //   Compare this event manager with the 'epoll'-based event manager
+        //   when registrations change on every 'dispatch'.
+        //
+        // Plan:
+        //   Run a ping-pong over a socket pair in which the writer registers
+        //   for 'e_WRITE' before every write, and deregisters once the write
+        //   is done, with each event manager.  Report the average round-trip
+        //   time, and the number of system calls made per round trip by this
+        //   event manager.
+        //
+        // Testing:
+        //   REGISTRATION TOGGLING PERFORMANCE DATA (vs 'epoll')
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "REGISTRATION TOGGLING PERFORMANCE DATA\n"
+                             "======================================\n";
+
+        using namespace TEST_CASE_TOGGLE_PERFORMANCE;
+
+        const int NUM_ROUND_TRIPS = argc > 2 ? atoi(argv[2]) : 100000;
+
+        btlso::DefaultEventManager<btlso::Platform::EPOLL> epollManager;
+        const double epollTime = runToggler(&epollManager, NUM_ROUND_TRIPS);
+
+        Obj mX;  const Obj& X = mX;
+        const double ioUringTime = runToggler(&mX, NUM_ROUND_TRIPS);
+
+        cout << "round trips: " << NUM_ROUND_TRIPS << endl
+             << "epoll:    " << epollTime / NUM_ROUND_TRIPS * 1e6
+             << " us/round trip" << endl
+             << "io_uring: " << ioUringTime / NUM_ROUND_TRIPS * 1e6
+             << " us/round trip, "
+             << static_cast<double>(X.numSystemCalls()) / NUM_ROUND_TRIPS
+             << " system calls/round trip" << endl;
+      } break;
+
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      } break;
+    }
+
+    btlso::SocketImpUtil::cleanup();
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+#else
+    return -1;
+#endif // BTESO_EVENTMANAGER_ENABLETEST
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -15,6 +15,7 @@ BSLS_IDENT_RCSID(btlso_tcptimereventmanager_cpp,"$Id$ $CSID$")
 #include <btlso_defaulteventmanager.h>
 #include <btlso_defaulteventmanager_devpoll.h>
 #include <btlso_defaulteventmanager_epoll.h>
+#include <btlso_defaulteventmanager_iouring.h>
 #include <btlso_defaulteventmanager_poll.h>
 #include <btlso_defaulteventmanager_select.h>
 #include <btlso_flag.h>
@@ -79,7 +80,8 @@ TcpTimerEventManager::TcpTimerEventManager(Hint              hint,
                                                                basicAllocator);
 #elif defined(BSLS_PLATFORM_OS_SOLARIS)
     switch (hint) {
-      case e_NO_HINT: {
+      case e_NO_HINT:
+      case e_FREQUENT_REGISTRATION: {
         d_manager_p = new (*d_allocator_p) DefaultEventManager<Platform::POLL>(
                                                                &d_metrics,
                                                                basicAllocator);
@@ -94,11 +96,17 @@ TcpTimerEventManager::TcpTimerEventManager(Hint              hint,
       }
     }
 #elif defined(BSLS_PLATFORM_OS_LINUX)
-    (void) hint;    // silence unused warning
-
-    d_manager_p = new (*d_allocator_p) DefaultEventManager<Platform::EPOLL>(
-                                                               &d_metrics,
+    if (e_FREQUENT_REGISTRATION == hint
+     && DefaultEventManager<Platform::IO_URING>::isSupported()) {
+        d_manager_p = new (*d_allocator_p)
+                       DefaultEventManager<Platform::IO_URING>(&d_metrics,
                                                                basicAllocator);
+    }
+    else {
+        d_manager_p = new (*d_allocator_p)
+                          DefaultEventManager<Platform::EPOLL>(&d_metrics,
+                                                               basicAllocator);
+    }
 #else
     (void) hint;    // silence unused warning
 
@@ -41,6 +41,15 @@ BSLS_IDENT("$Id: $")
 // registrations are infrequent.  For this situation, the currently installed
 // hint should be provided to this event manager for optimal performance.
 //
+// Conversely, clients that register and deregister socket events between most
+// calls to 'dispatch' (e.g., a channel registering for WRITE events each time
+// its socket buffer fills) should provide the 'e_FREQUENT_REGISTRATION' hint:
+// on Linux, if the running kernel supports it, this hint selects an
+// 'io_uring'-based event manager (see 'btlso_defaulteventmanager_iouring')
+// that submits the registration changes made between two calls to 'dispatch'
+// in a single system call.  On other platforms (and kernels), this hint is
+// equivalent to 'e_NO_HINT'.
+//
 // When callbacks are being dispatched (through the 'dispatch' method) priority
 // is given to callbacks associated with socket events.  The timer- related
 // callbacks are invoked only after all socket callbacks are invoked.  If two
@@ -290,9 +299,9 @@ class TcpTimerEventManager : public TimerEventManager
   public:
     enum Hint {
         e_NO_HINT,                 // the registrations may be frequent
-        e_INFREQUENT_REGISTRATION  // the (de)registrations will be infrequent
-
-
+        e_INFREQUENT_REGISTRATION, // the (de)registrations will be infrequent
+        e_FREQUENT_REGISTRATION    // the (de)registrations will be frequent,
+                                   // and should be batched where supported
     };
 
   private:
@@ -9,6 +9,7 @@
 
 #include <btlso_tcptimereventmanager.h>
 
+#include <btlso_defaulteventmanager_iouring.h>
 #include <btlso_flag.h>
 #include <btlso_socketimputil.h>
 
@@ -1210,6 +1211,29 @@ int main(int argc, char *argv[])
             ASSERT(btlso::TimeMetrics::e_CPU_BOUND ==
                    metrics->currentCategory());
             }
+
+            {
+            Obj mX(btlso::TcpTimerEventManager::e_FREQUENT_REGISTRATION,
+                   &testAllocator); const Obj& X = mX;
+
+            ASSERT(0 != testAllocator.numAllocations());
+            const btlso::EventManager *eventManager = X.socketEventManager();
+            ASSERT(eventManager); ASSERT(0 == eventManager->numEvents());
+            ASSERT(0 == X.numEvents()); ASSERT(0 == X.numTimers());
+#ifdef BSLS_PLATFORM_OS_LINUX
+            typedef btlso::DefaultEventManager<btlso::Platform::IO_URING>
+                                                               IoUringManager;
+
+            ASSERT(IoUringManager::isSupported() ==
+                   (0 != dynamic_cast<const IoUringManager *>(eventManager)));
+#endif
+            btlso::TimeMetrics *metrics = mX.timeMetrics();
+            ASSERT(metrics);
+            ASSERT(btlso::TimeMetrics::e_MIN_NUM_CATEGORIES
+                   == metrics->numCategories());
+            ASSERT(btlso::TimeMetrics::e_CPU_BOUND ==
+                   metrics->currentCategory());
+            }
         }
 
         if (verbose)